@@ -0,0 +1,825 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Command line, timing and reporting shared by the benchmark programs. Every program takes
+//
+//   --n=<count>              number of values (default 2000000)
+//   --runs=<count>           timed runs of every case, after one untimed warm up run (default 10)
+//   --type=<list>            e.g. --type=double,float or --type="unsigned long long"
+//   --format=<list>          general, scientific, fixed or hex, for the floating point programs
+//   --precision=<list>       precision of to_chars, or of the input of from_chars. -1 is the shortest representation
+//   --digits=<list>          significant digits of the values, 0 for values made of random bits
+//   --impl=<list>            boost, std or libc
+//   --output=<text|json|csv> human readable lines (default), or one document for tools
+//   --corpus=<list>          read the values of the floating point programs from files instead of generating them
+//   --perf=<on|off>          also report hardware counters per value: instructions, branch misses, L1D read misses and IPC.
+//                            Needs Linux perf_event_open, and elsewhere the counters are left out (default off)
+//   --cold=<KiB>             write to that much memory before every value and time each call on its own, so that the
+//                            tables of the conversions are not in the caches (default 0, every value with hot caches)
+//
+// Lists are comma separated. An option that is not given selects what the program runs by default.
+// A corpus is a bundled data set of the data folder (prices, counters, sensors or coordinates) or the path
+// of any text file, of which every number is a value. --n and --digits do not apply to a corpus.
+// Every case reports the time per value of each run: min, p10, median, p90, p99 and max, and the throughput at the median.
+// Where there is a cycle counter (rdtsc on x86, cntvct_el0 on ARM64) the median and p90 cycles per value are reported as well.
+// --cold is for the floating point programs, and is meant for a small --n such as 10000.
+
+#ifndef BOOST_CHARCONV_BENCHMARK_HPP
+#define BOOST_CHARCONV_BENCHMARK_HPP
+
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(_MSC_VER) && ( defined(_M_X64) || defined(_M_IX86) )
+#  include <intrin.h>
+#  define BOOST_CHARCONV_BENCHMARK_RDTSC
+#elif defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h>
+#  define BOOST_CHARCONV_BENCHMARK_RDTSC
+#endif
+
+#if defined(__linux__) && defined(__has_include)
+#  if __has_include(<linux/perf_event.h>)
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#    include <cerrno>
+#    define BOOST_CHARCONV_BENCHMARK_PERF_EVENT
+#  endif
+#endif
+
+namespace bench {
+
+// Reference cycles on x86 and ticks of the generic timer on ARM64, whose frequency is fixed and often lower than the clock
+#if defined(BOOST_CHARCONV_BENCHMARK_RDTSC)
+
+constexpr bool has_cycle_counter = true;
+
+inline std::uint64_t cycles()
+{
+    return __rdtsc();
+}
+
+#elif defined(__aarch64__) && ( defined(__GNUC__) || defined(__clang__) )
+
+constexpr bool has_cycle_counter = true;
+
+inline std::uint64_t cycles()
+{
+    std::uint64_t value;
+    __asm__ __volatile__( "isb\n\tmrs %0, cntvct_el0" : "=r"( value ) :: "memory" );
+    return value;
+}
+
+#else
+
+constexpr bool has_cycle_counter = false;
+
+inline std::uint64_t cycles()
+{
+    return 0;
+}
+
+#endif
+
+// A tick of cycles(), or a nanosecond without a cycle counter, that is not reordered with the instructions around it
+inline std::uint64_t ordered_ticks()
+{
+    std::atomic_signal_fence( std::memory_order_seq_cst );
+
+#if defined(BOOST_CHARCONV_BENCHMARK_RDTSC)
+    _mm_lfence();
+    std::uint64_t const t = __rdtsc();
+    _mm_lfence();
+#else
+    std::uint64_t const t = has_cycle_counter? cycles():
+        static_cast<std::uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count() );
+#endif
+
+    std::atomic_signal_fence( std::memory_order_seq_cst );
+    return t;
+}
+
+struct options
+{
+    std::size_t n = 2'000'000;
+    int runs = 10;
+    std::vector<std::string> types;
+    std::vector<std::string> formats;
+    std::vector<std::string> precisions;
+    std::vector<std::string> digits;
+    std::vector<std::string> impls;
+    std::vector<std::string> corpora;
+    std::string output = "text";
+    bool perf = false;
+    std::size_t cold = 0; // KiB written between two values, 0 for hot caches
+};
+
+inline std::vector<std::string> split( std::string const& list )
+{
+    std::vector<std::string> items;
+    std::size_t first = 0;
+
+    while( first <= list.size() )
+    {
+        std::size_t last = list.find( ',', first );
+        if( last == std::string::npos ) last = list.size();
+
+        if( last != first ) items.push_back( list.substr( first, last - first ) );
+        first = last + 1;
+    }
+
+    return items;
+}
+
+[[noreturn]] inline void usage( char const* program, std::string const& error )
+{
+    if( !error.empty() ) std::cerr << program << ": " << error << "\n";
+
+    std::cerr << "usage: " << program << " [--n=<count>] [--runs=<count>] [--type=<list>] [--format=<list>]"
+                 " [--precision=<list>] [--digits=<list>] [--impl=<list>] [--output=text|json|csv]"
+                 " [--corpus=<list>] [--perf=on|off] [--cold=<KiB>]\n";
+
+    std::exit( error.empty()? 0: 2 );
+}
+
+inline long parse_number( char const* program, std::string const& key, std::string const& value )
+{
+    char* end = nullptr;
+    long const x = std::strtol( value.c_str(), &end, 10 );
+
+    if( value.empty() || *end != '\0' ) usage( program, "invalid value of --" + key + ": " + value );
+    return x;
+}
+
+#ifndef BOOST_CHARCONV_BENCHMARK_DATA_DIR
+#define BOOST_CHARCONV_BENCHMARK_DATA_DIR ""
+#endif
+
+// The folder of the bundled corpora, which is the data folder next to this file unless the build says otherwise
+inline std::string data_dir()
+{
+    std::string dir = BOOST_CHARCONV_BENCHMARK_DATA_DIR;
+    if( !dir.empty() ) return dir;
+
+    dir = __FILE__;
+    std::size_t const slash = dir.find_last_of( "/\\" );
+    return ( slash == std::string::npos? std::string( "." ): dir.substr( 0, slash ) ) + "/data";
+}
+
+// The file of a corpus, or an empty string if there is none
+inline std::string corpus_path( std::string const& name )
+{
+    for( std::string path: { name, data_dir() + "/" + name + ".txt" } )
+    {
+        if( std::ifstream( path ) ) return path;
+    }
+
+    return "";
+}
+
+// The defaults are those of options, unless the program passes its own
+inline options parse_options( int argc, char const* const* argv, options const& defaults = options() )
+{
+    options opt = defaults;
+
+    for( int i = 1; i < argc; ++i )
+    {
+        std::string const arg = argv[ i ];
+
+        if( arg == "--help" || arg == "-h" ) usage( argv[ 0 ], "" );
+
+        std::size_t const eq = arg.find( '=' );
+        if( arg.compare( 0, 2, "--" ) != 0 || eq == std::string::npos ) usage( argv[ 0 ], "unknown argument " + arg );
+
+        std::string const key = arg.substr( 2, eq - 2 );
+        std::string const value = arg.substr( eq + 1 );
+
+        if( key == "n" )
+        {
+            long const n = parse_number( argv[ 0 ], key, value );
+            if( n <= 0 ) usage( argv[ 0 ], "--n has to be positive" );
+            opt.n = static_cast<std::size_t>( n );
+        }
+        else if( key == "runs" )
+        {
+            long const runs = parse_number( argv[ 0 ], key, value );
+            if( runs <= 0 || runs > 100000 ) usage( argv[ 0 ], "--runs has to be between 1 and 100000" );
+            opt.runs = static_cast<int>( runs );
+        }
+        else if( key == "type" ) opt.types = split( value );
+        else if( key == "format" ) opt.formats = split( value );
+        else if( key == "precision" ) opt.precisions = split( value );
+        else if( key == "digits" ) opt.digits = split( value );
+        else if( key == "impl" ) opt.impls = split( value );
+        else if( key == "corpus" ) opt.corpora = split( value );
+        else if( key == "perf" )
+        {
+            if( value != "on" && value != "off" ) usage( argv[ 0 ], "--perf is on or off" );
+            opt.perf = value == "on";
+        }
+        else if( key == "cold" )
+        {
+            long const cold = parse_number( argv[ 0 ], key, value );
+            if( cold < 0 || cold > 1024 * 1024 ) usage( argv[ 0 ], "--cold has to be between 0 and 1048576 KiB" );
+            opt.cold = static_cast<std::size_t>( cold );
+        }
+        else if( key == "output" )
+        {
+            if( value != "text" && value != "json" && value != "csv" ) usage( argv[ 0 ], "--output is text, json or csv" );
+            opt.output = value;
+        }
+        else
+        {
+            usage( argv[ 0 ], "unknown option --" + key );
+        }
+    }
+
+    for( auto const& p: opt.precisions ) parse_number( argv[ 0 ], "precision", p );
+    for( auto const& d: opt.digits ) parse_number( argv[ 0 ], "digits", d );
+    for( auto const& c: opt.corpora ) if( corpus_path( c ).empty() ) usage( argv[ 0 ], "cannot open corpus " + c );
+
+    return opt;
+}
+
+// Whether name is in the list given on the command line, an empty list selecting everything
+inline bool selected( std::vector<std::string> const& list, std::string const& name )
+{
+    return list.empty() || std::find( list.begin(), list.end(), name ) != list.end();
+}
+
+// The numbers given on the command line, or the defaults of the program
+inline std::vector<int> numbers( std::vector<std::string> const& list, std::vector<int> defaults )
+{
+    if( list.empty() ) return defaults;
+
+    std::vector<int> result;
+    for( auto const& x: list ) result.push_back( std::atoi( x.c_str() ) );
+    return result;
+}
+
+// Nearest rank percentile of sorted values, or 0 for none
+inline double nearest_rank( std::vector<double> const& sorted, double p )
+{
+    if( sorted.empty() ) return 0;
+
+    std::size_t rank = static_cast<std::size_t>( std::ceil( p / 100 * static_cast<double>( sorted.size() ) ) );
+    rank = ( std::max )( rank, std::size_t( 1 ) );
+    return sorted[ ( std::min )( rank, sorted.size() ) - 1 ];
+}
+
+struct result
+{
+    std::string impl;       // boost, std or libc
+    std::string function;   // e.g. boost::charconv::from_chars
+    std::string type;
+    std::string format;
+    int precision = -1;
+    int digits = 0;
+    std::string corpus;     // empty for generated values
+    std::string exponents;  // decimal exponent range of the values, e.g. [-5,0), or empty for any
+    std::size_t cold = 0;   // KiB written before every value, or 0 for hot caches
+    std::size_t values = 0;
+    std::size_t bytes = 0;  // characters read or written by one run
+    std::vector<double> ns; // per value, of every run in ascending order
+    std::vector<double> cycles; // per value, of every run in ascending order, or empty without a cycle counter
+
+    // Hardware counters per value, of every run in ascending order, or empty without --perf
+    std::vector<double> instructions;
+    std::vector<double> branch_misses;
+    std::vector<double> l1d_misses;
+    std::vector<double> ipc;
+    double checksum = 0;    // of the last run, which is the same for every implementation that agrees on the values
+
+    double percentile( double p ) const { return nearest_rank( ns, p ); }
+    double cycles_percentile( double p ) const { return nearest_rank( cycles, p ); }
+
+    // Megabytes of characters per second at the median
+    double mb_per_s() const
+    {
+        return static_cast<double>( bytes ) * 1e3 / ( percentile( 50 ) * static_cast<double>( values ) );
+    }
+};
+
+inline std::string json_string( std::string const& str )
+{
+    std::string escaped = "\"";
+    for( char c: str )
+    {
+        if( c == '"' || c == '\\' ) escaped += '\\';
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+// Writes each result as it is measured, except for JSON which is one document written when the program ends
+class reporter
+{
+private:
+
+    options opt_;
+    std::string benchmark_;
+    std::vector<result> results_;
+
+public:
+
+    reporter( options const& opt, char const* benchmark ): opt_( opt ), benchmark_( benchmark )
+    {
+        std::cout << std::setprecision( 4 );
+
+        if( opt_.output == "text" )
+        {
+            std::cout << BOOST_COMPILER << "\n" << BOOST_STDLIB << "\n\n";
+        }
+        else if( opt_.output == "csv" )
+        {
+            std::cout << "benchmark,impl,function,type,format,precision,digits,corpus,exponents,cold_kib,values,bytes,runs,"
+                         "min_ns,p10_ns,median_ns,p90_ns,p99_ns,max_ns,mb_per_s,median_cycles,p90_cycles,"
+                         "instructions,branch_misses,l1d_misses,ipc,checksum\n";
+        }
+    }
+
+    reporter( reporter const& ) = delete;
+    reporter& operator=( reporter const& ) = delete;
+
+    ~reporter()
+    {
+        if( opt_.output != "json" ) return;
+
+        std::cout << "{\n  \"context\": {\"benchmark\": " << json_string( benchmark_ ) << ", \"compiler\": " << json_string( BOOST_COMPILER )
+                  << ", \"stdlib\": " << json_string( BOOST_STDLIB ) << ", \"values\": " << opt_.n << ", \"runs\": " << opt_.runs << "},\n"
+                  << "  \"benchmarks\": [";
+
+        for( std::size_t i = 0; i < results_.size(); ++i )
+        {
+            result const& r = results_[ i ];
+
+            std::cout << ( i == 0? "\n": ",\n" ) << "    {\"impl\": " << json_string( r.impl ) << ", \"function\": " << json_string( r.function )
+                      << ", \"type\": " << json_string( r.type ) << ", \"format\": " << json_string( r.format )
+                      << ", \"precision\": " << r.precision << ", \"digits\": " << r.digits
+                      << ", \"corpus\": " << json_string( r.corpus ) << ", \"exponents\": " << json_string( r.exponents ) << ", \"cold_kib\": " << r.cold << ", \"values\": " << r.values << ", \"bytes\": " << r.bytes
+                      << ", \"min_ns\": " << r.ns.front() << ", \"p10_ns\": " << r.percentile( 10 ) << ", \"median_ns\": " << r.percentile( 50 )
+                      << ", \"p90_ns\": " << r.percentile( 90 ) << ", \"p99_ns\": " << r.percentile( 99 ) << ", \"max_ns\": " << r.ns.back()
+                      << ", \"mb_per_s\": " << r.mb_per_s() << ", \"median_cycles\": " << r.cycles_percentile( 50 )
+                      << ", \"p90_cycles\": " << r.cycles_percentile( 90 );
+
+            if( !r.instructions.empty() )
+            {
+                std::cout << ", \"instructions\": " << nearest_rank( r.instructions, 50 ) << ", \"branch_misses\": " << nearest_rank( r.branch_misses, 50 )
+                          << ", \"l1d_misses\": " << nearest_rank( r.l1d_misses, 50 ) << ", \"ipc\": " << nearest_rank( r.ipc, 50 );
+            }
+
+            std::cout << ", \"checksum\": " << r.checksum << ", \"runs_ns\": [";
+
+            for( std::size_t j = 0; j < r.ns.size(); ++j ) std::cout << ( j == 0? "": ", " ) << r.ns[ j ];
+            std::cout << "], \"runs_cycles\": [";
+            for( std::size_t j = 0; j < r.cycles.size(); ++j ) std::cout << ( j == 0? "": ", " ) << r.cycles[ j ];
+            std::cout << "]}";
+        }
+
+        std::cout << "\n  ]\n}\n";
+    }
+
+    void add( result r )
+    {
+        std::sort( r.ns.begin(), r.ns.end() );
+        for( auto* v: { &r.cycles, &r.instructions, &r.branch_misses, &r.l1d_misses, &r.ipc } ) std::sort( v->begin(), v->end() );
+
+        if( opt_.output == "text" )
+        {
+            std::string const name = r.function + "<" + r.type + ">";
+            std::cout << std::setw( 44 ) << name << ", " << r.format << ", precision " << r.precision
+                      << ( r.corpus.empty()? ", digits " + std::to_string( r.digits ): ", corpus " + r.corpus )
+                      << ( r.exponents.empty()? "": ", exponents " + r.exponents )
+                      << ( r.cold == 0? "": ", cold " + std::to_string( r.cold ) + " KiB" ) << ": "
+                      << std::setw( 7 ) << r.percentile( 50 ) << " ns median (p10 " << r.percentile( 10 ) << ", p90 " << r.percentile( 90 ) << "), "
+                      << std::setw( 7 ) << r.mb_per_s() << " MB/s";
+
+            if( !r.cycles.empty() ) std::cout << ", " << r.cycles_percentile( 50 ) << " cycles";
+
+            if( !r.instructions.empty() )
+            {
+                std::cout << ", " << nearest_rank( r.instructions, 50 ) << " instructions, " << nearest_rank( r.branch_misses, 50 ) << " branch misses, "
+                          << nearest_rank( r.l1d_misses, 50 ) << " L1D misses, IPC " << nearest_rank( r.ipc, 50 );
+            }
+
+            std::cout << " (s=" << r.checksum << ")\n";
+        }
+        else if( opt_.output == "csv" )
+        {
+            std::cout << benchmark_ << "," << r.impl << "," << r.function << ",\"" << r.type << "\"," << r.format << "," << r.precision << "," << r.digits
+                      << "," << r.corpus << ",\"" << r.exponents << "\"," << r.cold << "," << r.values << "," << r.bytes << "," << r.ns.size() << "," << r.ns.front() << "," << r.percentile( 10 ) << ","
+                      << r.percentile( 50 ) << "," << r.percentile( 90 ) << "," << r.percentile( 99 ) << "," << r.ns.back() << ","
+                      << r.mb_per_s() << "," << r.cycles_percentile( 50 ) << "," << r.cycles_percentile( 90 ) << ","
+                      << nearest_rank( r.instructions, 50 ) << "," << nearest_rank( r.branch_misses, 50 ) << "," << nearest_rank( r.l1d_misses, 50 ) << ","
+                      << nearest_rank( r.ipc, 50 ) << "," << r.checksum << "\n";
+        }
+
+        results_.push_back( std::move( r ) );
+    }
+
+    // Separates the groups of the text output
+    void end_group()
+    {
+        if( opt_.output == "text" ) std::cout << std::endl;
+    }
+};
+
+// Hardware counters of the calling thread in user space, read as one group so that they cover the same instructions
+struct perf_values
+{
+    double cycles = 0;
+    double instructions = 0;
+    double branch_misses = 0;
+    double l1d_misses = 0;
+};
+
+#if defined(BOOST_CHARCONV_BENCHMARK_PERF_EVENT)
+
+class perf_counters
+{
+private:
+
+    static constexpr int count = 4; // in the order of perf_values
+    int fds_[ count ] = { -1, -1, -1, -1 };
+    std::string error_;
+
+    static int open( std::uint32_t type, std::uint64_t config, int group )
+    {
+        perf_event_attr attr;
+        std::memset( &attr, 0, sizeof( attr ) );
+        attr.size = sizeof( attr );
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = group == -1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+
+        return static_cast<int>( syscall( SYS_perf_event_open, &attr, 0, -1, group, 0 ) );
+    }
+
+public:
+
+    perf_counters()
+    {
+        std::uint64_t const l1d_read_miss = PERF_COUNT_HW_CACHE_L1D | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 );
+
+        fds_[ 0 ] = open( PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1 );
+        if( fds_[ 0 ] >= 0 ) fds_[ 1 ] = open( PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, fds_[ 0 ] );
+        if( fds_[ 1 ] >= 0 ) fds_[ 2 ] = open( PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, fds_[ 0 ] );
+        if( fds_[ 2 ] >= 0 ) fds_[ 3 ] = open( PERF_TYPE_HW_CACHE, l1d_read_miss, fds_[ 0 ] );
+
+        if( fds_[ count - 1 ] < 0 )
+        {
+            error_ = std::string( "perf_event_open failed: " ) + std::strerror( errno ) + " (see /proc/sys/kernel/perf_event_paranoid)";
+            for( int& fd: fds_ ) if( fd >= 0 ) { close( fd ); fd = -1; }
+        }
+    }
+
+    ~perf_counters()
+    {
+        for( int fd: fds_ ) if( fd >= 0 ) close( fd );
+    }
+
+    perf_counters( perf_counters const& ) = delete;
+    perf_counters& operator=( perf_counters const& ) = delete;
+
+    bool available() const { return fds_[ 0 ] >= 0; }
+    std::string const& error() const { return error_; }
+
+    void start()
+    {
+        ioctl( fds_[ 0 ], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP );
+        ioctl( fds_[ 0 ], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP );
+    }
+
+    perf_values stop()
+    {
+        ioctl( fds_[ 0 ], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP );
+
+        // The number of events, then their values in the order they were opened
+        std::uint64_t buffer[ 1 + count ] = {};
+        perf_values v;
+
+        if( read( fds_[ 0 ], buffer, sizeof( buffer ) ) == static_cast<ssize_t>( sizeof( buffer ) ) && buffer[ 0 ] == count )
+        {
+            v.cycles = static_cast<double>( buffer[ 1 ] );
+            v.instructions = static_cast<double>( buffer[ 2 ] );
+            v.branch_misses = static_cast<double>( buffer[ 3 ] );
+            v.l1d_misses = static_cast<double>( buffer[ 4 ] );
+        }
+
+        return v;
+    }
+};
+
+#else
+
+class perf_counters
+{
+public:
+
+    bool available() const { return false; }
+    std::string const& error() const { static std::string const e = "hardware counters need Linux perf_event_open"; return e; }
+
+    void start() {}
+    perf_values stop() { return {}; }
+};
+
+#endif
+
+// The counters of the program, opened on first use. The benchmarks run on one thread
+inline perf_counters* hardware_counters( options const& opt )
+{
+    if( !opt.perf ) return nullptr;
+
+    static perf_counters counters;
+    static bool const warned = !counters.available() && ( std::cerr << "--perf: " << counters.error() << ", leaving the counters out\n", true );
+    static_cast<void>( warned );
+
+    return counters.available()? &counters: nullptr;
+}
+
+// Runs f once to warm up and then opt.runs times, f processing every value once and returning a checksum of what it produced
+template<class F> void measure( reporter& rep, options const& opt, result info, F&& f )
+{
+    if( opt.cold != 0 )
+    {
+        std::cerr << "--cold is not available for " << info.function << "\n";
+        std::exit( 2 );
+    }
+
+    info.checksum = static_cast<double>( f() );
+
+    perf_counters* const counters = hardware_counters( opt );
+    double const n = static_cast<double>( info.values );
+
+    for( int i = 0; i < opt.runs; ++i )
+    {
+        if( counters ) counters->start();
+
+        auto const t1 = std::chrono::steady_clock::now();
+        std::uint64_t const c1 = cycles();
+        info.checksum = static_cast<double>( f() );
+        std::uint64_t const c2 = cycles();
+        auto const t2 = std::chrono::steady_clock::now();
+
+        perf_values const v = counters? counters->stop(): perf_values();
+
+        info.ns.push_back( std::chrono::duration<double, std::nano>( t2 - t1 ).count() / n );
+        if( has_cycle_counter ) info.cycles.push_back( static_cast<double>( c2 - c1 ) / n );
+
+        if( counters )
+        {
+            info.instructions.push_back( v.instructions / n );
+            info.branch_misses.push_back( v.branch_misses / n );
+            info.l1d_misses.push_back( v.l1d_misses / n );
+            info.ipc.push_back( v.cycles > 0? v.instructions / v.cycles: 0 );
+        }
+    }
+
+    rep.add( std::move( info ) );
+}
+
+// Pushes the tables of the conversions out of the data caches by writing to every cache line of a larger buffer
+class cache_thrasher
+{
+private:
+
+    std::vector<unsigned char> buffer_;
+
+public:
+
+    explicit cache_thrasher( std::size_t bytes ): buffer_( bytes ) {}
+
+    void operator()()
+    {
+        for( std::size_t i = 0; i < buffer_.size(); i += 64 ) ++buffer_[ i ];
+    }
+};
+
+// Like measure, but f( first, last ) processes the values [first, last) and returns a checksum. With --cold every value
+// is converted on its own after the cache thrasher, and only the call is timed: less the cost of timing an empty call
+template<class F> void measure_values( reporter& rep, options const& opt, result info, F&& f )
+{
+    std::size_t const n = info.values;
+
+    if( opt.cold == 0 )
+    {
+        measure( rep, opt, std::move( info ), [&]{ return f( std::size_t( 0 ), n ); } );
+        return;
+    }
+
+    info.cold = opt.cold;
+
+    cache_thrasher thrash( opt.cold * 1024 );
+    perf_counters* const counters = hardware_counters( opt );
+    volatile double sink = 0;
+
+    std::uint64_t overhead = ( std::numeric_limits<std::uint64_t>::max )();
+
+    for( int i = 0; i < 1000; ++i )
+    {
+        std::uint64_t const t1 = ordered_ticks();
+        sink = static_cast<double>( f( std::size_t( 0 ), std::size_t( 0 ) ) );
+        std::uint64_t const t2 = ordered_ticks();
+
+        overhead = ( std::min )( overhead, t2 - t1 );
+    }
+
+    // The first run warms up
+    for( int run = -1; run < opt.runs; ++run )
+    {
+        double checksum = 0;
+        std::uint64_t ticks = 0;
+        perf_values total;
+
+        auto const start = std::chrono::steady_clock::now();
+        std::uint64_t const start_ticks = ordered_ticks();
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            thrash();
+
+            if( counters ) counters->start();
+
+            std::uint64_t const t1 = ordered_ticks();
+            double const y = static_cast<double>( f( i, i + 1 ) );
+            sink = y;
+            std::uint64_t const t2 = ordered_ticks();
+
+            if( counters )
+            {
+                perf_values const v = counters->stop();
+                total.cycles += v.cycles;
+                total.instructions += v.instructions;
+                total.branch_misses += v.branch_misses;
+                total.l1d_misses += v.l1d_misses;
+            }
+
+            ticks += t2 - t1 - ( std::min )( overhead, t2 - t1 );
+            checksum += y;
+        }
+
+        std::uint64_t const end_ticks = ordered_ticks();
+        auto const end = std::chrono::steady_clock::now();
+
+        if( run < 0 ) continue;
+
+        // Converts the cycles to nanoseconds at the rate of the whole run, thrasher included
+        double const ns = std::chrono::duration<double, std::nano>( end - start ).count();
+        double const ticks_per_ns = has_cycle_counter && ns > 0? static_cast<double>( end_ticks - start_ticks ) / ns: 1;
+
+        info.ns.push_back( static_cast<double>( ticks ) / ticks_per_ns / static_cast<double>( n ) );
+        if( has_cycle_counter ) info.cycles.push_back( static_cast<double>( ticks ) / static_cast<double>( n ) );
+
+        if( counters )
+        {
+            info.instructions.push_back( total.instructions / static_cast<double>( n ) );
+            info.branch_misses.push_back( total.branch_misses / static_cast<double>( n ) );
+            info.l1d_misses.push_back( total.l1d_misses / static_cast<double>( n ) );
+            info.ipc.push_back( total.cycles > 0? total.instructions / total.cycles: 0 );
+        }
+
+        info.checksum = checksum;
+    }
+
+    static_cast<void>( sink );
+    rep.add( std::move( info ) );
+}
+
+inline char const* format_name( boost::charconv::chars_format fmt )
+{
+    switch( fmt )
+    {
+        case boost::charconv::chars_format::scientific: return "scientific";
+        case boost::charconv::chars_format::fixed: return "fixed";
+        case boost::charconv::chars_format::hex: return "hex";
+        default: return "general";
+    }
+}
+
+// The formats given on the command line, or the defaults of the program
+inline std::vector<boost::charconv::chars_format> formats( std::vector<std::string> const& list,
+                                                           std::vector<boost::charconv::chars_format> defaults )
+{
+    if( list.empty() ) return defaults;
+
+    std::vector<boost::charconv::chars_format> result;
+    for( auto fmt: { boost::charconv::chars_format::general, boost::charconv::chars_format::scientific,
+                     boost::charconv::chars_format::fixed, boost::charconv::chars_format::hex } )
+    {
+        if( selected( list, format_name( fmt ) ) ) result.push_back( fmt );
+    }
+    return result;
+}
+
+// x rounded to digits significant digits, or x itself for 0 digits
+template<class T> T round_to_digits( T x, int digits )
+{
+    if( digits <= 0 ) return x;
+
+    char buffer[ 128 ];
+    auto const r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, boost::charconv::chars_format::scientific, digits - 1 );
+    T y = x;
+    boost::charconv::from_chars( buffer, r.ptr, y );
+    return y;
+}
+
+// Maximum number of decimal digits of T
+template<class T> constexpr int max_digits()
+{
+    return std::numeric_limits<T>::digits10 + 1;
+}
+
+// The random bits, or a value with exactly digits decimal digits and the sign taken from the highest of the bits.
+// digits is at most max_digits<T>()
+template<class T> T integer_with_digits( std::uint64_t bits, int digits )
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    if( digits <= 0 ) return static_cast<T>( static_cast<U>( bits ) );
+
+    std::uint64_t lo = 1;
+    for( int i = 1; i < digits; ++i ) lo *= 10;
+
+    std::uint64_t const max = static_cast<std::uint64_t>( ( std::numeric_limits<T>::max )() );
+    std::uint64_t const hi = lo > max / 10? max: ( std::min )( lo * 10 - 1, max );
+
+    std::uint64_t const range = hi - lo;
+    std::uint64_t const x = lo + ( range == ( std::numeric_limits<std::uint64_t>::max )()? bits: bits % ( range + 1 ) );
+
+    BOOST_IF_CONSTEXPR( std::is_signed<T>::value )
+    {
+        if( bits >> 63 ) return static_cast<T>( -static_cast<T>( x ) );
+    }
+
+    return static_cast<T>( x );
+}
+
+// Every number of the file name, or of the bundled corpus of that name. Anything else separates the numbers,
+// so one number per line, CSV and JSON files such as canada.geojson can all be read as they are
+inline std::vector<std::string> load_corpus( char const* program, std::string const& name )
+{
+    std::ifstream in( corpus_path( name ), std::ios::binary );
+    if( !in ) usage( program, "cannot open corpus " + name );
+
+    std::string const text( ( std::istreambuf_iterator<char>( in ) ), std::istreambuf_iterator<char>() );
+    std::vector<std::string> values;
+
+    auto const is_number_char = []( char c )
+    {
+        return ( c >= '0' && c <= '9' ) || c == '.' || c == '-' || c == '+' || c == 'e' || c == 'E';
+    };
+
+    std::size_t i = 0;
+    while( i < text.size() )
+    {
+        if( !is_number_char( text[ i ] ) ) { ++i; continue; }
+
+        std::size_t j = i;
+        while( j < text.size() && is_number_char( text[ j ] ) ) ++j;
+
+        // A run of letters such as "true" or a key around an e is not a number
+        bool const word = ( i > 0 && std::isalpha( static_cast<unsigned char>( text[ i - 1 ] ) ) ) ||
+                          ( j < text.size() && std::isalpha( static_cast<unsigned char>( text[ j ] ) ) );
+
+        std::string token = text.substr( i, j - i );
+        if( token[ 0 ] == '+' ) token.erase( 0, 1 );
+
+        if( !word && std::any_of( token.begin(), token.end(), []( char c ) { return c >= '0' && c <= '9'; } ) )
+        {
+            values.push_back( std::move( token ) );
+        }
+
+        i = j;
+    }
+
+    if( values.empty() ) usage( program, "corpus " + name + " has no numbers" );
+    return values;
+}
+
+} // namespace bench
+
+#endif // BOOST_CHARCONV_BENCHMARK_HPP
@@ -0,0 +1,409 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Head to head comparison of from_chars and to_chars for float and double. Every implementation gets the same values,
+// the same warm up and timed runs, and is first checked against Boost.Charconv: parsed values have to be the same,
+// and written strings have to read back as the value. Disagreements are printed to stderr before the timings.
+//
+// The implementations, selected with --impl, are
+//
+//   boost               boost::charconv::from_chars and to_chars
+//   std                 std::from_chars and std::to_chars, where the standard library has them
+//   libc                std::strtod and std::snprintf. The shortest representation is %.17g (%.9g for float)
+//   double-conversion   Google double-conversion, built with BOOST_CHARCONV_BENCHMARK_HAS_DOUBLE_CONVERSION
+//   fmt                 fmt::format_to_n for to_chars, built with BOOST_CHARCONV_BENCHMARK_HAS_FMT
+//
+// The values are random, or read from --corpus. --precision selects the shortest representation (-1, the default)
+// or scientific format with that precision. See benchmark.hpp for the rest of the command line
+
+#include "benchmark.hpp"
+#include <boost/core/type_name.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <charconv>
+
+#ifdef BOOST_CHARCONV_BENCHMARK_HAS_DOUBLE_CONVERSION
+#include <double-conversion/double-conversion.h>
+#endif
+
+#ifdef BOOST_CHARCONV_BENCHMARK_HAS_FMT
+#include <fmt/format.h>
+#endif
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#  define BOOST_CHARCONV_BENCHMARK_HAS_STD_CHARS
+#endif
+
+constexpr std::size_t buffer_size = 512;
+
+template<class T> static BOOST_NOINLINE void init_input_data( std::vector<T>& data, std::size_t n, int digits )
+{
+    data.clear();
+    data.reserve( n );
+
+    boost::detail::splitmix64 rng;
+
+    while( data.size() < n )
+    {
+        std::uint64_t tmp = rng();
+
+        T x;
+        std::memcpy( &x, &tmp, sizeof(x) );
+
+        if( !std::isfinite(x) ) continue;
+
+        data.push_back( bench::round_to_digits( x, digits ) );
+    }
+}
+
+// Parsing
+
+struct boost_parser
+{
+    template<class T> void operator()( std::string const& str, T& value ) const
+    {
+        boost::charconv::from_chars( str.data(), str.data() + str.size(), value );
+    }
+};
+
+#ifdef BOOST_CHARCONV_BENCHMARK_HAS_STD_CHARS
+
+struct std_parser
+{
+    template<class T> void operator()( std::string const& str, T& value ) const
+    {
+        std::from_chars( str.data(), str.data() + str.size(), value );
+    }
+};
+
+#endif
+
+struct libc_parser
+{
+    void operator()( std::string const& str, float& value ) const { value = std::strtof( str.c_str(), nullptr ); }
+    void operator()( std::string const& str, double& value ) const { value = std::strtod( str.c_str(), nullptr ); }
+};
+
+#ifdef BOOST_CHARCONV_BENCHMARK_HAS_DOUBLE_CONVERSION
+
+struct double_conversion_parser
+{
+    double_conversion::StringToDoubleConverter converter { double_conversion::StringToDoubleConverter::NO_FLAGS,
+                                                           0.0, 0.0, "inf", "nan" };
+
+    void operator()( std::string const& str, float& value ) const
+    {
+        int processed = 0;
+        value = converter.StringToFloat( str.data(), static_cast<int>( str.size() ), &processed );
+    }
+
+    void operator()( std::string const& str, double& value ) const
+    {
+        int processed = 0;
+        value = converter.StringToDouble( str.data(), static_cast<int>( str.size() ), &processed );
+    }
+};
+
+#endif
+
+template<class T, class Parser> static BOOST_NOINLINE double test_parse( std::vector<std::string> const& data, Parser const& parse )
+{
+    T s = 0;
+
+    for( auto const& x: data )
+    {
+        T y {};
+        parse( x, y );
+        s = s / 16 + y;
+    }
+
+    return static_cast<double>( s );
+}
+
+// Writing, with the shortest representation for a negative precision and scientific format otherwise
+
+struct boost_writer
+{
+    template<class T> std::size_t operator()( char* buffer, T value, int precision ) const
+    {
+        auto const r = precision < 0?
+                       boost::charconv::to_chars( buffer, buffer + buffer_size, value ):
+                       boost::charconv::to_chars( buffer, buffer + buffer_size, value, boost::charconv::chars_format::scientific, precision );
+
+        return static_cast<std::size_t>( r.ptr - buffer );
+    }
+};
+
+#ifdef BOOST_CHARCONV_BENCHMARK_HAS_STD_CHARS
+
+struct std_writer
+{
+    template<class T> std::size_t operator()( char* buffer, T value, int precision ) const
+    {
+        auto const r = precision < 0?
+                       std::to_chars( buffer, buffer + buffer_size, value ):
+                       std::to_chars( buffer, buffer + buffer_size, value, std::chars_format::scientific, precision );
+
+        return static_cast<std::size_t>( r.ptr - buffer );
+    }
+};
+
+#endif
+
+struct libc_writer
+{
+    template<class T> std::size_t operator()( char* buffer, T value, int precision ) const
+    {
+        int const r = precision < 0?
+                      std::snprintf( buffer, buffer_size, "%.*g", std::numeric_limits<T>::max_digits10, static_cast<double>( value ) ):
+                      std::snprintf( buffer, buffer_size, "%.*e", precision, static_cast<double>( value ) );
+
+        return static_cast<std::size_t>( r );
+    }
+};
+
+#ifdef BOOST_CHARCONV_BENCHMARK_HAS_DOUBLE_CONVERSION
+
+struct double_conversion_writer
+{
+    double_conversion::DoubleToStringConverter const& converter = double_conversion::DoubleToStringConverter::EcmaScriptConverter();
+
+    std::size_t operator()( char* buffer, float value, int precision ) const
+    {
+        double_conversion::StringBuilder builder( buffer, static_cast<int>( buffer_size ) );
+
+        if( precision < 0 ) converter.ToShortestSingle( value, &builder );
+        else converter.ToExponential( value, precision, &builder );
+
+        return static_cast<std::size_t>( builder.position() );
+    }
+
+    std::size_t operator()( char* buffer, double value, int precision ) const
+    {
+        double_conversion::StringBuilder builder( buffer, static_cast<int>( buffer_size ) );
+
+        if( precision < 0 ) converter.ToShortest( value, &builder );
+        else converter.ToExponential( value, precision, &builder );
+
+        return static_cast<std::size_t>( builder.position() );
+    }
+};
+
+#endif
+
+#ifdef BOOST_CHARCONV_BENCHMARK_HAS_FMT
+
+struct fmt_writer
+{
+    template<class T> std::size_t operator()( char* buffer, T value, int precision ) const
+    {
+        auto const r = precision < 0?
+                       fmt::format_to_n( buffer, buffer_size, "{}", value ):
+                       fmt::format_to_n( buffer, buffer_size, "{:.{}e}", value, precision );
+
+        return r.size;
+    }
+};
+
+#endif
+
+template<class T, class Writer> static BOOST_NOINLINE std::size_t test_write( std::vector<T> const& data, int precision, Writer const& write )
+{
+    std::size_t s = 0;
+
+    char buffer[ buffer_size ];
+
+    for( auto x: data )
+    {
+        s += write( buffer, x, precision );
+        s += static_cast<unsigned char>( buffer[0] );
+    }
+
+    return s;
+}
+
+// Checks against Boost.Charconv. Written strings are compared by the value they read back as,
+// since the libraries differ in how they write the exponent
+
+template<class T> static bool same_value( T x, T y )
+{
+    return std::memcmp( &x, &y, sizeof( T ) ) == 0;
+}
+
+template<class T, class Parser> static void verify_parse( char const* impl, std::vector<std::string> const& data, Parser const& parse )
+{
+    std::size_t mismatches = 0;
+
+    for( auto const& x: data )
+    {
+        T expected {};
+        T y {};
+        boost_parser()( x, expected );
+        parse( x, y );
+
+        if( !same_value( expected, y ) && mismatches++ == 0 )
+        {
+            std::cerr << impl << ": " << x << " is read as " << std::setprecision( std::numeric_limits<T>::max_digits10 ) << y
+                      << " instead of " << expected << "\n";
+        }
+    }
+
+    if( mismatches != 0 ) std::cerr << impl << ": " << mismatches << " of " << data.size() << " " << boost::core::type_name<T>() << " values differ\n";
+}
+
+template<class T, class Writer> static void verify_write( char const* impl, std::vector<T> const& data, int precision, Writer const& write )
+{
+    std::size_t mismatches = 0;
+
+    char buffer[ buffer_size ];
+    char expected[ buffer_size ];
+
+    for( auto x: data )
+    {
+        std::string const str( buffer, write( buffer, x, precision ) );
+
+        T y {};
+        boost_parser()( str, y );
+
+        // The shortest representation has to read back as the value, and a precision as the same rounded value
+        T rounded = x;
+        if( precision >= 0 ) boost_parser()( std::string( expected, boost_writer()( expected, x, precision ) ), rounded );
+
+        if( !same_value( rounded, y ) && mismatches++ == 0 )
+        {
+            std::cerr << impl << ": " << std::setprecision( std::numeric_limits<T>::max_digits10 ) << x << " is written as " << str << "\n";
+        }
+    }
+
+    if( mismatches != 0 ) std::cerr << impl << ": " << mismatches << " of " << data.size() << " " << boost::core::type_name<T>() << " values differ\n";
+}
+
+template<class T> static void test_from_chars( bench::reporter& rep, bench::options const& opt, std::vector<std::string> const& data, int digits, std::string const& corpus )
+{
+    bench::result info;
+    info.type = boost::core::type_name<T>();
+    info.format = "general";
+    info.digits = digits;
+    info.corpus = corpus;
+    info.values = data.size();
+    for( auto const& x: data ) info.bytes += x.size();
+
+    auto const run = [&]( char const* impl, char const* function, auto const& parse )
+    {
+        if( !bench::selected( opt.impls, impl ) ) return;
+
+        verify_parse<T>( impl, data, parse );
+
+        info.impl = impl;
+        info.function = function;
+        bench::measure( rep, opt, info, [&]{ return test_parse<T>( data, parse ); } );
+    };
+
+    run( "boost", "boost::charconv::from_chars", boost_parser() );
+    #ifdef BOOST_CHARCONV_BENCHMARK_HAS_STD_CHARS
+    run( "std", "std::from_chars", std_parser() );
+    #endif
+    run( "libc", "std::strtod", libc_parser() );
+    #ifdef BOOST_CHARCONV_BENCHMARK_HAS_DOUBLE_CONVERSION
+    run( "double-conversion", "double_conversion::StringToDoubleConverter", double_conversion_parser() );
+    #endif
+
+    rep.end_group();
+}
+
+template<class T> static void test_to_chars( bench::reporter& rep, bench::options const& opt, std::vector<T> const& data, int digits, std::string const& corpus )
+{
+    for( int precision: bench::numbers( opt.precisions, { -1 } ) )
+    {
+        bench::result info;
+        info.type = boost::core::type_name<T>();
+        info.format = precision < 0? "shortest": "scientific";
+        info.precision = precision;
+        info.digits = digits;
+        info.corpus = corpus;
+        info.values = data.size();
+
+        char buffer[ buffer_size ];
+        for( auto x: data ) info.bytes += boost_writer()( buffer, x, precision );
+
+        auto const run = [&]( char const* impl, char const* function, auto const& write )
+        {
+            if( !bench::selected( opt.impls, impl ) ) return;
+
+            verify_write( impl, data, precision, write );
+
+            info.impl = impl;
+            info.function = function;
+            bench::measure( rep, opt, info, [&]{ return test_write( data, precision, write ); } );
+        };
+
+        run( "boost", "boost::charconv::to_chars", boost_writer() );
+        #ifdef BOOST_CHARCONV_BENCHMARK_HAS_STD_CHARS
+        run( "std", "std::to_chars", std_writer() );
+        #endif
+        run( "libc", "std::snprintf", libc_writer() );
+        #ifdef BOOST_CHARCONV_BENCHMARK_HAS_DOUBLE_CONVERSION
+        run( "double-conversion", "double_conversion::DoubleToStringConverter", double_conversion_writer() );
+        #endif
+        #ifdef BOOST_CHARCONV_BENCHMARK_HAS_FMT
+        run( "fmt", "fmt::format_to_n", fmt_writer() );
+        #endif
+
+        rep.end_group();
+    }
+}
+
+template<class T> static void test( bench::reporter& rep, bench::options const& opt )
+{
+    if( !bench::selected( opt.types, boost::core::type_name<T>() ) ) return;
+
+    std::vector<T> values;
+    std::vector<std::string> strings;
+
+    auto const run = [&]( int digits, std::string const& corpus )
+    {
+        test_from_chars<T>( rep, opt, strings, digits, corpus );
+        test_to_chars<T>( rep, opt, values, digits, corpus );
+    };
+
+    for( auto const& corpus: opt.corpora )
+    {
+        strings = bench::load_corpus( "compare", corpus );
+        values.clear();
+        for( auto const& x: strings )
+        {
+            T y {};
+            boost_parser()( x, y );
+            values.push_back( y );
+        }
+
+        run( 0, corpus );
+    }
+
+    if( !opt.corpora.empty() ) return;
+
+    for( int digits: bench::numbers( opt.digits, { 0 } ) )
+    {
+        init_input_data( values, opt.n, digits );
+
+        strings.clear();
+        char buffer[ buffer_size ];
+        for( auto x: values ) strings.emplace_back( buffer, boost_writer()( buffer, x, -1 ) );
+
+        run( digits, "" );
+    }
+}
+
+int main( int argc, char const* argv[] )
+{
+    bench::options const opt = bench::parse_options( argc, argv );
+    bench::reporter rep( opt, "compare" );
+
+    test<float>( rep, opt );
+    test<double>( rep, opt );
+}
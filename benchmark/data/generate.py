@@ -0,0 +1,59 @@
+# Copyright 2024 Matt Borland
+# Distributed under the Boost Software License, Version 1.0.
+# https://www.boost.org/LICENSE_1_0.txt
+#
+# Writes the bundled corpora of the benchmarks, one number per line.
+# The seed is fixed so that running it again writes the same files.
+
+import math
+import random
+
+COUNT = 10000
+
+def prices(rng):
+    # Retail prices with two decimals and exchange rates with four
+    for _ in range(COUNT):
+        if rng.random() < 0.8:
+            x = math.exp(rng.gauss(3.0, 1.5))
+            if rng.random() < 0.5:
+                x = math.floor(x) + rng.choice([0.99, 0.95, 0.49, 0.0, 0.5])
+            yield '%.2f' % x
+        else:
+            yield '%.4f' % math.exp(rng.gauss(0.0, 1.0))
+
+def counters(rng):
+    # Event counts, mostly small
+    for _ in range(COUNT):
+        yield str(int(math.exp(rng.expovariate(0.5))) - 1)
+
+def sensors(rng):
+    # Temperature, humidity, pressure and acceleration readings
+    for i in range(COUNT):
+        kind = i % 4
+        if kind == 0:
+            yield '%.1f' % rng.gauss(21.0, 6.0)
+        elif kind == 1:
+            yield '%.1f' % min(100.0, max(0.0, rng.gauss(45.0, 15.0)))
+        elif kind == 2:
+            yield '%.2f' % rng.gauss(1013.25, 8.0)
+        else:
+            yield '%.4f' % rng.gauss(0.0, 0.05)
+
+def coordinates(rng):
+    # Polygon vertices in degrees, walking along a border, like the coordinates of canada.geojson:
+    # six decimals that went through binary arithmetic, so most print with 15 to 17 digits
+    lon, lat = -65.0, 47.0
+    for _ in range(COUNT // 2):
+        lon += rng.gauss(0.0, 0.01)
+        lat += rng.gauss(0.0, 0.01)
+        for x in (lon, lat):
+            y = round(x, 6)
+            if rng.random() < 0.7:
+                y = y * (1.0 + rng.choice([-1, 1]) * 2.0 ** -52)
+            yield repr(y)
+
+for name, generator in (('prices', prices), ('counters', counters), ('sensors', sensors), ('coordinates', coordinates)):
+    rng = random.Random(name)
+    with open(name + '.txt', 'w', newline='\n') as f:
+        for value in generator(rng):
+            f.write(value + '\n')
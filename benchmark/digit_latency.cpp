@@ -0,0 +1,287 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Latency by input length. Each engine is timed on buckets of values that have the same number of significant
+// digits and decimal exponents in the same range, which shows where an algorithm gets slower.
+// The engines, selected with --impl, are
+//
+//   integer     from_chars of unsigned long long (from_chars_integer_impl), 1 to 20 digits
+//   fast_float  from_chars of double, 1 to 17 digits
+//   dragonbox   to_chars of double with the shortest representation, 1 to 17 digits
+//   fixed       to_chars of double with the shortest representation in fixed format (to_chars_fixed_impl), 1 to 17 digits
+//   floff       to_chars of double in scientific format with a precision of digits - 1, 1 to 17 digits
+//   ryu         to_chars of long double with the shortest representation (Ryu generic 128), 1 to 19 digits,
+//               where long double has 80 or 128 bits
+//
+// The floating point values are written with exactly that many digits, the last of them not zero, so the shortest
+// representation of 16 and 17 digit values can be shorter. --n is the number of values in each bucket (default 10000).
+// See benchmark.hpp for the rest of the command line
+
+#include "benchmark.hpp"
+#include <boost/charconv/detail/config.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+struct exponent_range
+{
+    int lo;
+    int hi;
+};
+
+// Decimal exponents in scientific notation, [lo, hi)
+static exponent_range const exponent_ranges[] = {
+    { -307, -100 }, { -100, -20 }, { -20, -5 }, { -5, 0 }, { 0, 5 }, { 5, 20 }, { 20, 100 }, { 100, 308 }
+};
+
+static std::string range_name( exponent_range const& r )
+{
+    return "[" + std::to_string( r.lo ) + "," + std::to_string( r.hi ) + ")";
+}
+
+// Unsigned integers with digits decimal digits
+static BOOST_NOINLINE void init_integer_data( std::vector<std::string>& data, std::size_t n, int digits )
+{
+    data.clear();
+    data.reserve( n );
+
+    boost::detail::splitmix64 rng;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        std::uint64_t const x = bench::integer_with_digits<std::uint64_t>( rng(), digits );
+        data.push_back( std::to_string( x ) );
+    }
+}
+
+// d.ddd...e+x with digits significant digits, the last of them not zero, and exponents in r
+static BOOST_NOINLINE void init_decimal_data( std::vector<std::string>& data, std::size_t n, int digits, exponent_range const& r )
+{
+    data.clear();
+    data.reserve( n );
+
+    boost::detail::splitmix64 rng;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        std::uint64_t m = bench::integer_with_digits<std::uint64_t>( rng(), digits );
+        if( m % 10 == 0 ) ++m;
+
+        int const e = r.lo + static_cast<int>( rng() % static_cast<std::uint64_t>( r.hi - r.lo ) );
+
+        std::string const significand = std::to_string( m );
+        std::string str = significand.substr( 0, 1 );
+        if( digits > 1 ) str += "." + significand.substr( 1 );
+        str += "e" + std::to_string( e );
+
+        data.push_back( std::move( str ) );
+    }
+}
+
+template<class T> static std::vector<T> parse_all( std::vector<std::string> const& data )
+{
+    std::vector<T> values;
+    values.reserve( data.size() );
+
+    for( auto const& x: data )
+    {
+        T y {};
+        boost::charconv::from_chars( x.data(), x.data() + x.size(), y );
+        values.push_back( y );
+    }
+
+    return values;
+}
+
+static BOOST_NOINLINE std::size_t test_from_chars_integer( std::vector<std::string> const& data, std::size_t first, std::size_t last )
+{
+    std::size_t s = 0;
+
+    for( std::size_t i = first; i < last; ++i )
+    {
+        std::string const& x = data[ i ];
+        unsigned long long y {};
+        boost::charconv::from_chars( x.data(), x.data() + x.size(), y );
+
+        s += static_cast<std::size_t>( y );
+    }
+
+    return s;
+}
+
+static BOOST_NOINLINE double test_from_chars_double( std::vector<std::string> const& data, std::size_t first, std::size_t last )
+{
+    double s = 0;
+
+    for( std::size_t i = first; i < last; ++i )
+    {
+        std::string const& x = data[ i ];
+        double y {};
+        boost::charconv::from_chars( x.data(), x.data() + x.size(), y );
+
+        s = s / 16 + y;
+    }
+
+    return s;
+}
+
+template<class T> static BOOST_NOINLINE std::size_t test_to_chars( std::vector<T> const& data, std::size_t first, std::size_t last, boost::charconv::chars_format fmt, int precision )
+{
+    std::size_t s = 0;
+
+    char buffer[ 5000 ];
+
+    for( std::size_t i = first; i < last; ++i )
+    {
+        auto r = precision < 0?
+                 boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), data[ i ], fmt ):
+                 boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), data[ i ], fmt, precision );
+
+        s += static_cast<std::size_t>( r.ptr - buffer );
+        s += static_cast<unsigned char>( buffer[0] );
+    }
+
+    return s;
+}
+
+template<class T> static std::size_t output_bytes( std::vector<T> const& data, boost::charconv::chars_format fmt, int precision )
+{
+    std::size_t bytes = 0;
+
+    char buffer[ 5000 ];
+
+    for( auto x: data )
+    {
+        auto r = precision < 0?
+                 boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, fmt ):
+                 boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, fmt, precision );
+
+        bytes += static_cast<std::size_t>( r.ptr - buffer );
+    }
+
+    return bytes;
+}
+
+static std::size_t input_bytes( std::vector<std::string> const& data )
+{
+    std::size_t bytes = 0;
+    for( auto const& x: data ) bytes += x.size();
+    return bytes;
+}
+
+static void test_integer( bench::reporter& rep, bench::options const& opt )
+{
+    if( !bench::selected( opt.impls, "integer" ) ) return;
+
+    std::vector<std::string> data;
+
+    for( int digits: bench::numbers( opt.digits, { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 } ) )
+    {
+        if( digits < 1 || digits > bench::max_digits<std::uint64_t>() ) continue;
+
+        init_integer_data( data, opt.n, digits );
+
+        bench::result info;
+        info.impl = "integer";
+        info.function = "boost::charconv::from_chars";
+        info.type = "unsigned long long";
+        info.format = "dec";
+        info.digits = digits;
+        info.values = data.size();
+        info.bytes = input_bytes( data );
+
+        bench::measure_values( rep, opt, info, [&]( std::size_t first, std::size_t last ){ return test_from_chars_integer( data, first, last ); } );
+    }
+
+    rep.end_group();
+}
+
+// One engine that writes values of type T, on every bucket of digits up to max_digits
+template<class T> static void test_to_chars_engine( bench::reporter& rep, bench::options const& opt, char const* engine, char const* type,
+                                                    boost::charconv::chars_format fmt, bool precision_from_digits, int max_digits )
+{
+    if( !bench::selected( opt.impls, engine ) ) return;
+
+    std::vector<std::string> data;
+
+    for( auto const& r: exponent_ranges )
+    {
+        for( int digits: bench::numbers( opt.digits, { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19 } ) )
+        {
+            if( digits < 1 || digits > max_digits ) continue;
+
+            // The precision is what varies, so the values have all their digits
+            init_decimal_data( data, opt.n, precision_from_digits? 17: digits, r );
+            std::vector<T> const values = parse_all<T>( data );
+
+            int const precision = precision_from_digits? digits - 1: -1;
+
+            bench::result info;
+            info.impl = engine;
+            info.function = "boost::charconv::to_chars";
+            info.type = type;
+            info.format = bench::format_name( fmt );
+            info.precision = precision;
+            info.digits = digits;
+            info.exponents = range_name( r );
+            info.values = values.size();
+            info.bytes = output_bytes( values, fmt, precision );
+
+            bench::measure_values( rep, opt, info, [&]( std::size_t first, std::size_t last ){ return test_to_chars( values, first, last, fmt, precision ); } );
+        }
+
+        rep.end_group();
+    }
+}
+
+static void test_fast_float( bench::reporter& rep, bench::options const& opt )
+{
+    if( !bench::selected( opt.impls, "fast_float" ) ) return;
+
+    std::vector<std::string> data;
+
+    for( auto const& r: exponent_ranges )
+    {
+        for( int digits: bench::numbers( opt.digits, { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17 } ) )
+        {
+            if( digits < 1 || digits > 17 ) continue;
+
+            init_decimal_data( data, opt.n, digits, r );
+
+            bench::result info;
+            info.impl = "fast_float";
+            info.function = "boost::charconv::from_chars";
+            info.type = "double";
+            info.format = "general";
+            info.digits = digits;
+            info.exponents = range_name( r );
+            info.values = data.size();
+            info.bytes = input_bytes( data );
+
+            bench::measure_values( rep, opt, info, [&]( std::size_t first, std::size_t last ){ return test_from_chars_double( data, first, last ); } );
+        }
+
+        rep.end_group();
+    }
+}
+
+int main( int argc, char const* argv[] )
+{
+    bench::options defaults;
+    defaults.n = 10000;
+
+    bench::options const opt = bench::parse_options( argc, argv, defaults );
+    bench::reporter rep( opt, "digit_latency" );
+
+    test_integer( rep, opt );
+    test_fast_float( rep, opt );
+    test_to_chars_engine<double>( rep, opt, "dragonbox", "double", boost::charconv::chars_format::general, false, 17 );
+    test_to_chars_engine<double>( rep, opt, "fixed", "double", boost::charconv::chars_format::fixed, false, 17 );
+    test_to_chars_engine<double>( rep, opt, "floff", "double", boost::charconv::chars_format::scientific, true, 17 );
+
+    #if BOOST_CHARCONV_LDBL_BITS > 64
+    test_to_chars_engine<long double>( rep, opt, "ryu", "long double", boost::charconv::chars_format::general, false, 19 );
+    #endif
+}
@@ -0,0 +1,178 @@
+# Copyright 2024 Matt Borland
+# Distributed under the Boost Software License, Version 1.0.
+# https://www.boost.org/LICENSE_1_0.txt
+#
+# Static footprint of a build of the library: the size of each table, the code size of each exported
+# to_chars and from_chars overload, and how much of both each feature pulls in: an algorithm such as Dragonbox
+# or Ryu, or the overloads of one type.
+#
+#   python3 footprint.py [--nm=<nm>] [--output=text|csv|json] <library or object files>
+#   python3 footprint.py --diff <before.json> <after.json>
+#
+# The sizes come from the symbols that nm lists with --print-size, so this works with GNU binutils and
+# llvm-nm on ELF and Mach-O files. A symbol that is in several object files, such as the tables of the
+# headers, is counted once, as the linker keeps one copy.
+# To see what a feature costs, write the JSON report of two builds, e.g. with and without
+# BOOST_CHARCONV_NO_QUADMATH or in C++20 and C++23 for std::float16_t, and compare them with --diff.
+
+import json
+import re
+import subprocess
+import sys
+
+# The features, by the first pattern that a symbol matches, tables and code alike
+FEATURES = [
+    ('powers of ten shared by from_chars and to_chars double', r'significand_template'),
+    ('to_chars long double and __float128 (Ryu and binary128 Dragonbox)', r'ryu::|dragonbox_binary128::|fixed_precision_binary128'),
+    ('to_chars double with a precision (exact digits)', r'fixed_precision_binary64'),
+    ('to_chars double with a precision (floff)', r'extended_cache_(long|compact|super_compact)_impl|additional_static_data_holder_impl|floff|power_of_10_template'),
+    ('to_chars float and double (Dragonbox)', r'cache_holder_ieee754_binary32_impl|main_cache_holder_impl|compressed_cache_detail_impl|dragonbox|radix_100_head_table'),
+    ('from_chars long double and __float128', r'extended_powers_template|float80_powers_template|compute_float80|compute_float128|parser<unsigned __int128'),
+    ('from_chars float and double (fast_float)', r'fast_float::|slow_path_divide|parser<|compute_float(32|64)|float64_powers_template|is_hex_char'),
+    ('integer from_chars', r'char_values_template|from_chars_integer_impl|is_integer_char'),
+    ('integer to_chars', r'digit_tables_template|to_chars_(128)?integer_impl|num_digits|print_8_digits'),
+]
+
+# The value type of the rest, by the first of these in the name
+TYPES = [
+    ('__float128', r'__float128'),
+    ('std::float128_t', r'std::float128_t|_Float128'),
+    ('std::float16_t', r'std::float16_t|_Float16'),
+    ('std::bfloat16_t', r'std::bfloat16_t|__bf16|decltype\(0\.0bf16\)'),
+    ('long double', r'long double'),
+    ('double', r'(?<![a-z_])double'),
+    ('float', r'(?<![a-z_:])float(?![a-z_0-9])'),
+    ('integer', r'(?<![a-z_])(short|int|long|unsigned|__int128)(?![a-z_0-9])'),
+]
+
+EXPORTED = re.compile(r'^boost::charconv::(to_chars|from_chars)[a-z_]*\(')
+
+def feature(name):
+    for label, pattern in FEATURES:
+        if re.search(pattern, name):
+            return label
+
+    # An overload or a helper of one type, e.g. to_chars of std::float16_t that converts to float
+    direction = next((d + ' ' for d in ('to_chars', 'from_chars') if d in name), '')
+    return direction + next((label for label, pattern in TYPES if re.search(pattern, name)), 'other')
+
+def read_symbols(nm, files):
+    out = subprocess.run([nm, '-C', '--print-size', '--defined-only'] + files, check=True, capture_output=True, text=True).stdout
+
+    symbols = {}
+    for line in out.splitlines():
+        fields = line.split(None, 3)
+        if len(fields) != 4 or 'boost::charconv' not in fields[3]:
+            continue
+
+        size = int(fields[1], 16)
+        kind = 'code' if fields[2] in 'TtWw' else 'data'
+        name = re.sub(r' \[clone [^\]]*\]', '', fields[3])
+
+        key = (kind, name)
+        symbols[key] = max(symbols.get(key, 0), size)
+
+    return symbols
+
+def report(symbols):
+    tables = []
+    functions = []
+    totals = {}
+
+    def add(label, kind, size):
+        totals.setdefault(label, {'tables': 0, 'exported': 0, 'internal': 0})[kind] += size
+
+    for (kind, name), size in sorted(symbols.items(), key=lambda s: -s[1]):
+        if kind == 'data':
+            tables.append({'name': name, 'bytes': size, 'used_by': feature(name)})
+            add(feature(name), 'tables', size)
+        else:
+            exported = bool(EXPORTED.match(name))
+            if exported:
+                functions.append({'name': name, 'bytes': size})
+            add(feature(name), 'exported' if exported else 'internal', size)
+
+    return {'tables': tables, 'functions': functions, 'features': totals}
+
+def write(rep, output):
+    if output == 'json':
+        json.dump(rep, sys.stdout, indent=2)
+        print()
+    elif output == 'csv':
+        print('kind,name,bytes,used_by')
+        for t in rep['tables']:
+            print('table,"%s",%d,"%s"' % (t['name'], t['bytes'], t['used_by']))
+        for f in rep['functions']:
+            print('function,"%s",%d,' % (f['name'], f['bytes']))
+        for label, t in sorted(rep['features'].items()):
+            for kind in ('tables', 'exported', 'internal'):
+                print('feature_%s,"%s",%d,' % (kind, label, t[kind]))
+    else:
+        print('Tables')
+        for t in rep['tables']:
+            print('  %8d  %s\n            used by %s' % (t['bytes'], t['name'], t['used_by']))
+        print('  %8d  total\n' % sum(t['bytes'] for t in rep['tables']))
+
+        print('Exported to_chars and from_chars overloads, not counting the internal functions they call')
+        for f in rep['functions']:
+            print('  %8d  %s' % (f['bytes'], f['name']))
+        print()
+
+        print('By feature: total, tables, exported code and internal code')
+        for label, t in sorted(rep['features'].items(), key=lambda x: -sum(x[1].values())):
+            print('  %8d %8d %8d %8d  %s' % (sum(t.values()), t['tables'], t['exported'], t['internal'], label))
+
+def diff(before, after):
+    # Every table, function and feature whose size changed
+    def sizes(rep):
+        s = {}
+        for t in rep['tables']:
+            s['table ' + t['name']] = t['bytes']
+        for f in rep['functions']:
+            s['function ' + f['name']] = f['bytes']
+        for label, t in rep['features'].items():
+            s['feature ' + label] = sum(t.values())
+        return s
+
+    b = sizes(before)
+    a = sizes(after)
+
+    for name in sorted(set(a) | set(b), key=lambda n: -abs(a.get(n, 0) - b.get(n, 0))):
+        change = a.get(name, 0) - b.get(name, 0)
+        if change != 0:
+            print('  %+8d  %s' % (change, name))
+
+    total_b = sum(v for n, v in b.items() if n.startswith('feature '))
+    total_a = sum(v for n, v in a.items() if n.startswith('feature '))
+    print('  %+8d  total (%d to %d bytes)' % (total_a - total_b, total_b, total_a))
+
+def main(argv):
+    nm = 'nm'
+    output = 'text'
+    files = []
+
+    if len(argv) == 4 and argv[1] == '--diff':
+        with open(argv[2]) as b, open(argv[3]) as a:
+            diff(json.load(b), json.load(a))
+        return 0
+
+    for arg in argv[1:]:
+        if arg.startswith('--nm='):
+            nm = arg[5:]
+        elif arg.startswith('--output='):
+            output = arg[9:]
+            if output not in ('text', 'csv', 'json'):
+                sys.exit('%s: --output is text, csv or json' % argv[0])
+        elif arg.startswith('--'):
+            sys.exit('usage: %s [--nm=<nm>] [--output=text|csv|json] <files> or %s --diff <before.json> <after.json>' % (argv[0], argv[0]))
+        else:
+            files.append(arg)
+
+    if not files:
+        sys.exit('%s: no library or object files' % argv[0])
+
+    write(report(read_symbols(nm, files)), output)
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -2,280 +2,211 @@
 // Copyright 2023 Matt Borland
 // Distributed under the Boost Software License, Version 1.0.
 // https://www.boost.org/LICENSE_1_0.txt
+//
+// from_chars for floating point types against std::strtod and std::from_chars.
+// The input is written with to_chars in the selected format and precision. The uint64 format is
+// integers written as strings, which are read as the floating point type. A corpus is read as it is, with the general format.
+// See benchmark.hpp for the command line
 
-#include <boost/charconv/from_chars.hpp>
-#include <boost/charconv/to_chars.hpp>
+#include "benchmark.hpp"
 #include <boost/core/type_name.hpp>
 #include <boost/core/detail/splitmix64.hpp>
-#include <boost/config.hpp>
-#include <type_traits>
-#include <chrono>
 #include <cstdio>
-#include <iostream>
-#include <iomanip>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
 #include <charconv>
-#include <random>
 
-constexpr unsigned N = 2'000'000;
-constexpr int K = 10;
-
-template<class T> static BOOST_NOINLINE void init_input_data( std::vector<std::string>& data, bool general )
+template<class T> static T random_value( boost::detail::splitmix64& rng )
 {
-    data.reserve( N );
-
-    boost::detail::splitmix64 rng;
-
-    for( unsigned i = 0; i < N; ++i )
-    {
-        std::uint64_t tmp = rng();
+    std::uint64_t tmp = rng();
 
-        T x;
-        std::memcpy( &x, &tmp, sizeof(x) );
-
-        if( !std::isfinite(x) ) continue;
-
-        char buffer[ 64 ];
-        auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, general? boost::charconv::chars_format::general: boost::charconv::chars_format::scientific );
+    T x;
+    std::memcpy( &x, &tmp, sizeof(x) );
+    return x;
+}
 
-        std::string y( buffer, r.ptr );
-        data.push_back( y );
-    }
+// Made of the bits of a double, which keeps the values in a range that strtold and std::from_chars can write and read
+template<> long double random_value<long double>( boost::detail::splitmix64& rng )
+{
+    return static_cast<long double>( random_value<double>( rng ) );
 }
 
-template <>
-BOOST_NOINLINE void init_input_data<long double>( std::vector<std::string>& data, bool general )
+template<class T> static BOOST_NOINLINE void init_input_data( std::vector<std::string>& data, std::size_t n, boost::charconv::chars_format fmt, int precision, int digits )
 {
-    data.reserve(N / 10);
+    data.clear();
+    data.reserve( n );
 
-    std::random_device rd;
-    std::mt19937_64 rng(rd());
-    std::uniform_real_distribution<long double> dist(0.0L, (std::numeric_limits<long double>::max)());
+    boost::detail::splitmix64 rng;
 
-    for( unsigned i = 0; i < N / 10; ++i )
+    while( data.size() < n )
     {
-        const long double x = dist(rng);
+        T const x = bench::round_to_digits( random_value<T>( rng ), digits );
 
-        char buffer[ 64 ];
-        auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, general? boost::charconv::chars_format::general : boost::charconv::chars_format::scientific );
+        if( !std::isfinite(x) ) continue;
 
-        std::string y( buffer, r.ptr );
-        data.push_back( y );
+        char buffer[ 5000 ];
+        auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, fmt, precision );
+
+        data.emplace_back( buffer, r.ptr );
     }
 }
 
-template<class T> static BOOST_NOINLINE void init_input_data_uint64( std::vector<std::string>& data )
+static BOOST_NOINLINE void init_input_data_uint64( std::vector<std::string>& data, std::size_t n, int digits )
 {
-    data.reserve( N );
+    data.clear();
+    data.reserve( n );
 
     boost::detail::splitmix64 rng;
 
-    for( unsigned i = 0; i < N; ++i )
+    while( data.size() < n )
     {
-        std::uint64_t x = rng();
+        std::uint64_t x = bench::integer_with_digits<std::uint64_t>( rng(), digits );
 
         char buffer[ 64 ];
         auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
 
-        std::string y( buffer, r.ptr );
-        data.push_back( y );
+        data.emplace_back( buffer, r.ptr );
     }
 }
 
-using namespace std::chrono_literals;
-
-template<class T> void test_strtox( std::vector<std::string> const& data, bool general, char const* label );
+static float strtox( char const* str, float* ) { return std::strtof( str, nullptr ); }
+static double strtox( char const* str, double* ) { return std::strtod( str, nullptr ); }
+static long double strtox( char const* str, long double* ) { return std::strtold( str, nullptr ); }
 
-template<> BOOST_NOINLINE void test_strtox<float>( std::vector<std::string> const& data, bool, char const* label )
+template<class T> static BOOST_NOINLINE double test_strtox( std::vector<std::string> const& data, std::size_t first, std::size_t last )
 {
-    auto t1 = std::chrono::steady_clock::now();
-
-    double s = 0;
+    T s = 0;
 
-    for( int i = 0; i < K; ++i )
+    for( std::size_t i = first; i < last; ++i )
     {
-        for( auto const& x: data )
-        {
-            float y = std::strtof( x.c_str(), nullptr );
-            s = s / 16.0 + y;
-        }
+        std::string const& x = data[ i ];
+        T y = strtox( x.c_str(), static_cast<T*>( nullptr ) );
+        s = s / 16 + y;
     }
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "                std::strtox<float>, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+    return static_cast<double>( s );
 }
 
-template<> BOOST_NOINLINE void test_strtox<double>( std::vector<std::string> const& data, bool, char const* label )
-{
-    auto t1 = std::chrono::steady_clock::now();
-
-    double s = 0;
-
-    for( int i = 0; i < K; ++i )
-    {
-        for( auto const& x: data )
-        {
-            double y = std::strtod( x.c_str(), nullptr );
-            s = s / 16.0 + y;
-        }
-    }
-
-    auto t2 = std::chrono::steady_clock::now();
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
 
-    std::cout << "                std::strtox<double>, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
-}
-
-template<> BOOST_NOINLINE void test_strtox<long double>( std::vector<std::string> const& data, bool, char const* label )
+template<class T> static BOOST_NOINLINE double test_std_from_chars( std::vector<std::string> const& data, std::size_t first, std::size_t last, std::chars_format fmt )
 {
-    auto t1 = std::chrono::steady_clock::now();
-
-    long double s = 0;
+    T s = 0;
 
-    for( int i = 0; i < K; ++i )
+    for( std::size_t i = first; i < last; ++i )
     {
-        for( auto const& x: data )
-        {
-            double y = std::strtold( x.c_str(), nullptr );
-            s = s / 16.0L + y;
-        }
-    }
+        std::string const& x = data[ i ];
+        T y {};
+        std::from_chars( x.data(), x.data() + x.size(), y, fmt );
 
-    auto t2 = std::chrono::steady_clock::now();
+        s = s / 16 + y;
+    }
 
-    std::cout << "                std::strtox<long double>, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+    return static_cast<double>( s );
 }
 
-template<class T> static BOOST_NOINLINE void test_std_from_chars( std::vector<std::string> const& data, bool general, char const* label )
-{
-    auto t1 = std::chrono::steady_clock::now();
+#endif
 
-    double s = 0;
+template<class T> static BOOST_NOINLINE double test_boost_from_chars( std::vector<std::string> const& data, std::size_t first, std::size_t last, boost::charconv::chars_format fmt )
+{
+    T s = 0;
 
-    for( int i = 0; i < K; ++i )
+    for( std::size_t i = first; i < last; ++i )
     {
-        for( auto const& x: data )
-        {
-            T y;
-            std::from_chars( x.data(), x.data() + x.size(), y, general? std::chars_format::general: std::chars_format::scientific );
+        std::string const& x = data[ i ];
+        T y {};
+        boost::charconv::from_chars( x.data(), x.data() + x.size(), y, fmt );
 
-            s = s / 16.0 + y;
-        }
+        s = s / 16 + y;
     }
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "            std::from_chars<" << boost::core::type_name<T>() << ">, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+    return static_cast<double>( s );
 }
 
-template<> BOOST_NOINLINE void test_std_from_chars<long double>( std::vector<std::string> const& data, bool general, char const* label )
+template<class T> static void test_data( bench::reporter& rep, bench::options const& opt, std::vector<std::string> const& data,
+                                         boost::charconv::chars_format fmt, char const* format, int precision, int digits,
+                                         std::string const& corpus = "" )
 {
-    auto t1 = std::chrono::steady_clock::now();
-
-    long double s = 0;
-
-    for( int i = 0; i < K; ++i )
+    bench::result info;
+    info.type = boost::core::type_name<T>();
+    info.format = format;
+    info.precision = precision;
+    info.digits = digits;
+    info.corpus = corpus;
+    info.values = data.size();
+    for( auto const& x: data ) info.bytes += x.size();
+
+    // strtod does not read hexadecimal numbers without the 0x prefix
+    if( bench::selected( opt.impls, "libc" ) && fmt != boost::charconv::chars_format::hex )
     {
-        for( auto const& x: data )
-        {
-            long double y;
-            std::from_chars( x.data(), x.data() + x.size(), y, general? std::chars_format::general: std::chars_format::scientific );
+        info.impl = "libc";
+        info.function = "std::strtox";
+        bench::measure_values( rep, opt, info, [&]( std::size_t first, std::size_t last ){ return test_strtox<T>( data, first, last ); } );
+    }
 
-            s = s / 16.0L + y;
-        }
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    if( bench::selected( opt.impls, "std" ) )
+    {
+        info.impl = "std";
+        info.function = "std::from_chars";
+        std::chars_format const std_fmt = static_cast<std::chars_format>( static_cast<unsigned>( fmt ) );
+        bench::measure_values( rep, opt, info, [&]( std::size_t first, std::size_t last ){ return test_std_from_chars<T>( data, first, last, std_fmt ); } );
     }
+#endif
 
-    auto t2 = std::chrono::steady_clock::now();
+    if( bench::selected( opt.impls, "boost" ) )
+    {
+        info.impl = "boost";
+        info.function = "boost::charconv::from_chars";
+        bench::measure_values( rep, opt, info, [&]( std::size_t first, std::size_t last ){ return test_boost_from_chars<T>( data, first, last, fmt ); } );
+    }
 
-    std::cout << "            std::from_chars<long double>, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+    rep.end_group();
 }
 
-template<class T> static BOOST_NOINLINE void test_boost_from_chars( std::vector<std::string> const& data, bool general, char const* label )
+template<class T> static void test( bench::reporter& rep, bench::options const& opt )
 {
-    auto t1 = std::chrono::steady_clock::now();
+    if( !bench::selected( opt.types, boost::core::type_name<T>() ) ) return;
 
-    double s = 0;
-
-    for( int i = 0; i < K; ++i )
+    if( !opt.corpora.empty() )
     {
-        for( auto const& x: data )
+        for( auto const& corpus: opt.corpora )
         {
-            T y;
-            boost::charconv::from_chars( x.data(), x.data() + x.size(), y, general? boost::charconv::chars_format::general: boost::charconv::chars_format::scientific );
-
-            s = s / 16.0 + y;
+            test_data<T>( rep, opt, bench::load_corpus( "from_chars_floating", corpus ), boost::charconv::chars_format::general, "general", -1, 0, corpus );
         }
-    }
-
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "boost::charconv::from_chars<" << boost::core::type_name<T>() << ">, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
-}
 
-template<>
-BOOST_NOINLINE void test_boost_from_chars<long double>( std::vector<std::string> const& data, bool general, char const* label )
-{
-    auto t1 = std::chrono::steady_clock::now();
+        return;
+    }
 
-    long double s = 0;
+    std::vector<std::string> data;
 
-    for( int i = 0; i < K; ++i )
+    for( int digits: bench::numbers( opt.digits, { 0 } ) )
     {
-        for( auto const& x: data )
+        for( auto fmt: bench::formats( opt.formats, { boost::charconv::chars_format::scientific, boost::charconv::chars_format::general } ) )
         {
-            long double y;
-            boost::charconv::from_chars( x.data(), x.data() + x.size(), y, general? boost::charconv::chars_format::general: boost::charconv::chars_format::scientific );
+            for( int precision: bench::numbers( opt.precisions, { -1 } ) )
+            {
+                init_input_data<T>( data, opt.n, fmt, precision, digits );
+                test_data<T>( rep, opt, data, fmt, bench::format_name( fmt ), precision, digits );
+            }
+        }
 
-            s = s / 16.0L + y;
+        if( opt.formats.empty() || bench::selected( opt.formats, "uint64" ) )
+        {
+            init_input_data_uint64( data, opt.n, digits );
+            test_data<T>( rep, opt, data, boost::charconv::chars_format::general, "uint64", -1, digits );
         }
     }
-
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "boost::charconv::from_chars<long double>, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
-}
-
-template<class T> static void test( bool general )
-{
-    std::vector<std::string> data;
-    init_input_data<T>( data, general );
-
-    char const* label = general? "general": "scientific";
-
-    test_strtox<T>( data, general, label );
-    test_std_from_chars<T>( data, general, label );
-    test_boost_from_chars<T>( data, general, label );
-
-    std::cout << std::endl;
 }
 
-template<class T> static void test2()
+int main( int argc, char const* argv[] )
 {
-    std::vector<std::string> data;
-    init_input_data_uint64<T>( data );
-
-    bool general = true;
-    char const* label = "uint64";
-
-    test_strtox<T>( data, general, label );
-    test_std_from_chars<T>( data, general, label );
-    test_boost_from_chars<T>( data, general, label );
-
-    std::cout << std::endl;
-}
-
-int main()
-{
-    std::cout << BOOST_COMPILER << "\n";
-    std::cout << BOOST_STDLIB << "\n\n";
-
-    test<float>( false );
-    test<double>( false );
-    test<long double>( false );
-
-    test<float>( true );
-    test<double>( true );
-    test<long double>( true );
+    bench::options const opt = bench::parse_options( argc, argv );
+    bench::reporter rep( opt, "from_chars_floating" );
 
-    test2<float>();
-    test2<double>();
+    test<float>( rep, opt );
+    test<double>( rep, opt );
+    test<long double>( rep, opt );
 }
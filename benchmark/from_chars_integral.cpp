@@ -1,114 +1,145 @@
 // Copyright 2023 Peter Dimov
 // Distributed under the Boost Software License, Version 1.0.
 // https://www.boost.org/LICENSE_1_0.txt
+//
+// from_chars for integral types against std::strtoll and std::from_chars.
+// See benchmark.hpp for the command line
 
-#include <boost/charconv/from_chars.hpp>
-#include <boost/charconv/to_chars.hpp>
+#include "benchmark.hpp"
 #include <boost/core/type_name.hpp>
 #include <boost/core/detail/splitmix64.hpp>
-#include <boost/config.hpp>
 #include <type_traits>
-#include <chrono>
 #include <cstdio>
-#include <iostream>
-#include <iomanip>
+#include <cstdlib>
+#include <string>
+#include <vector>
 #include <charconv>
 
-constexpr unsigned N = 2'000'000;
-constexpr int K = 25;
-
-template<class T> static BOOST_NOINLINE void init_input_data( std::vector<std::string>& data )
+template<class T> static BOOST_NOINLINE void init_input_data( std::vector<std::string>& data, std::size_t n, int digits )
 {
-    data.reserve( N );
+    data.clear();
+    data.reserve( n );
 
     boost::detail::splitmix64 rng;
 
-    for( unsigned i = 0; i < N; ++i )
+    for( std::size_t i = 0; i < n; ++i )
     {
-        T x = static_cast<T>( static_cast<typename std::make_unsigned<T>::type>( rng() ) );
+        T x = bench::integer_with_digits<T>( rng(), digits );
 
         char buffer[ 21 ];
         auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
 
-        std::string y( buffer, r.ptr );
-        data.push_back( y );
+        data.emplace_back( buffer, r.ptr );
     }
 }
 
-using namespace std::chrono_literals;
-
-template<class T> static void BOOST_NOINLINE test_std_from_chars( std::vector<std::string> const& data )
+template<class T> static BOOST_NOINLINE std::size_t test_strtox( std::vector<std::string> const& data )
 {
-    auto t1 = std::chrono::steady_clock::now();
-
     std::size_t s = 0;
 
-    for( int i = 0; i < K; ++i )
+    for( auto const& x: data )
     {
-        for( auto const& x: data )
-        {
-            T y;
-            std::from_chars( x.data(), x.data() + x.size(), y );
+        T y = std::is_signed<T>::value?
+              static_cast<T>( std::strtoll( x.c_str(), nullptr, 10 ) ):
+              static_cast<T>( std::strtoull( x.c_str(), nullptr, 10 ) );
 
-            s += static_cast<std::size_t>( y );
-        }
+        s += static_cast<std::size_t>( y );
     }
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "            std::from_chars<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+    return s;
 }
 
-template<class T> static void BOOST_NOINLINE test_boost_from_chars( std::vector<std::string> const& data )
+template<class T> static BOOST_NOINLINE std::size_t test_std_from_chars( std::vector<std::string> const& data )
 {
-    auto t1 = std::chrono::steady_clock::now();
-
     std::size_t s = 0;
 
-    for( int i = 0; i < K; ++i )
+    for( auto const& x: data )
     {
-        for( auto const& x: data )
-        {
-            T y;
-            boost::charconv::from_chars( x.data(), x.data() + x.size(), y );
+        T y {};
+        std::from_chars( x.data(), x.data() + x.size(), y );
 
-            s += static_cast<std::size_t>( y );
-        }
+        s += static_cast<std::size_t>( y );
     }
 
-    auto t2 = std::chrono::steady_clock::now();
+    return s;
+}
+
+template<class T> static BOOST_NOINLINE std::size_t test_boost_from_chars( std::vector<std::string> const& data )
+{
+    std::size_t s = 0;
+
+    for( auto const& x: data )
+    {
+        T y {};
+        boost::charconv::from_chars( x.data(), x.data() + x.size(), y );
 
-    std::cout << "boost::charconv::from_chars<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+        s += static_cast<std::size_t>( y );
+    }
+
+    return s;
 }
 
-template<class T> static void test()
+template<class T> static void test( bench::reporter& rep, bench::options const& opt )
 {
+    if( !bench::selected( opt.types, boost::core::type_name<T>() ) ) return;
+
     std::vector<std::string> data;
-    init_input_data<T>( data );
 
-    test_std_from_chars<T>( data );
-    test_boost_from_chars<T>( data );
+    for( int digits: bench::numbers( opt.digits, { 0 } ) )
+    {
+        if( digits > bench::max_digits<T>() ) continue;
+
+        init_input_data<T>( data, opt.n, digits );
+
+        bench::result info;
+        info.type = boost::core::type_name<T>();
+        info.format = "dec";
+        info.digits = digits;
+        info.values = data.size();
+        for( auto const& x: data ) info.bytes += x.size();
+
+        if( bench::selected( opt.impls, "libc" ) )
+        {
+            info.impl = "libc";
+            info.function = "std::strtox";
+            bench::measure( rep, opt, info, [&]{ return test_strtox<T>( data ); } );
+        }
 
-    std::cout << std::endl;
+        if( bench::selected( opt.impls, "std" ) )
+        {
+            info.impl = "std";
+            info.function = "std::from_chars";
+            bench::measure( rep, opt, info, [&]{ return test_std_from_chars<T>( data ); } );
+        }
+
+        if( bench::selected( opt.impls, "boost" ) )
+        {
+            info.impl = "boost";
+            info.function = "boost::charconv::from_chars";
+            bench::measure( rep, opt, info, [&]{ return test_boost_from_chars<T>( data ); } );
+        }
+
+        rep.end_group();
+    }
 }
 
-int main()
+int main( int argc, char const* argv[] )
 {
-    std::cout << BOOST_COMPILER << "\n";
-    std::cout << BOOST_STDLIB << "\n\n";
+    bench::options const opt = bench::parse_options( argc, argv );
+    bench::reporter rep( opt, "from_chars_integral" );
 
-    test<signed char>();
-    test<unsigned char>();
+    test<signed char>( rep, opt );
+    test<unsigned char>( rep, opt );
 
-    test<short>();
-    test<unsigned short>();
+    test<short>( rep, opt );
+    test<unsigned short>( rep, opt );
 
-    test<int>();
-    test<unsigned int>();
+    test<int>( rep, opt );
+    test<unsigned int>( rep, opt );
 
-    test<long>();
-    test<unsigned long>();
+    test<long>( rep, opt );
+    test<unsigned long>( rep, opt );
 
-    test<long long>();
-    test<unsigned long long>();
+    test<long long>( rep, opt );
+    test<unsigned long long>( rep, opt );
 }
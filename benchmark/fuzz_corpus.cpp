@@ -0,0 +1,265 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Latency of from_chars on the inputs of the fuzzers: the seed corpora, the old crashes and the slow inputs of
+// fuzzing/, which are edge cases such as halfway values with hundreds of digits and mantissas of thousands.
+// Every file is one input, as for the fuzzer, and every line of a file of several lines is one more.
+// Each input is timed on its own, as the best of --runs repetitions, and every case reports the distribution
+// of the time per call across the inputs of a corpus instead of across runs: its max is the worst case.
+// The slowest input of each case is written to stderr.
+//
+//   --impl=<list>      float (from_chars of float, double and long double) or int (integers in bases 2, 10 and 16)
+//   --type=<list>      e.g. --type=double
+//   --format=<list>    general, scientific, fixed or hex, for float
+//   --limit-us=<us>    fail with exit status 1 when any call takes longer
+//
+// See benchmark.hpp for the rest of the command line. --n and --digits do not apply.
+
+#include "benchmark.hpp"
+#include <boost/core/type_name.hpp>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#ifndef BOOST_CHARCONV_BENCHMARK_FUZZING_DIR
+#define BOOST_CHARCONV_BENCHMARK_FUZZING_DIR ""
+#endif
+
+struct input
+{
+    std::string name;
+    std::string text;
+};
+
+static std::string fuzzing_dir()
+{
+    std::string dir = BOOST_CHARCONV_BENCHMARK_FUZZING_DIR;
+    if( !dir.empty() ) return dir;
+
+    return bench::data_dir() + "/../../fuzzing";
+}
+
+// The inputs of fuzzer in the corpus folder of fuzzing/, in the order of their names
+static std::vector<input> load_inputs( std::string const& corpus, std::string const& fuzzer )
+{
+    std::vector<input> inputs;
+
+    std::filesystem::path const dir = std::filesystem::path( fuzzing_dir() ) / corpus / fuzzer;
+    std::error_code ec;
+    if( !std::filesystem::is_directory( dir, ec ) ) return inputs;
+
+    std::vector<std::filesystem::path> files;
+    for( auto const& entry: std::filesystem::directory_iterator( dir, ec ) )
+    {
+        if( entry.is_regular_file() ) files.push_back( entry.path() );
+    }
+    std::sort( files.begin(), files.end() );
+
+    for( auto const& file: files )
+    {
+        std::ifstream is( file, std::ios::binary );
+        std::string const text( ( std::istreambuf_iterator<char>( is ) ), std::istreambuf_iterator<char>() );
+        std::string const name = file.filename().string();
+
+        inputs.push_back( { name, text } );
+
+        if( std::count( text.begin(), text.end(), '\n' ) > 1 )
+        {
+            std::size_t first = 0;
+            for( std::size_t line = 1; first < text.size(); ++line )
+            {
+                std::size_t last = text.find( '\n', first );
+                if( last == std::string::npos ) last = text.size();
+
+                inputs.push_back( { name + ":" + std::to_string( line ), text.substr( first, last - first ) } );
+                first = last + 1;
+            }
+        }
+    }
+
+    return inputs;
+}
+
+// The best time per call of runs repetitions, each of enough calls to be well above the resolution of the clock
+template<class F> static double best_ns( int runs, F&& f )
+{
+    auto const t1 = std::chrono::steady_clock::now();
+    f();
+    auto const t2 = std::chrono::steady_clock::now();
+
+    double const once = std::chrono::duration<double, std::nano>( t2 - t1 ).count();
+    int const calls = once >= 1000? 1: static_cast<int>( 1000 / ( std::max )( once, 10.0 ) );
+
+    double best = once;
+
+    for( int i = 0; i < runs; ++i )
+    {
+        auto const t3 = std::chrono::steady_clock::now();
+        for( int j = 0; j < calls; ++j ) f();
+        auto const t4 = std::chrono::steady_clock::now();
+
+        best = ( std::min )( best, std::chrono::duration<double, std::nano>( t4 - t3 ).count() / calls );
+    }
+
+    return best;
+}
+
+// What an input looks like in a message: its name, its size and its beginning
+static std::string describe( std::string const& corpus, input const& in )
+{
+    std::string prefix = in.text.substr( 0, 40 );
+    for( char& c: prefix ) if( static_cast<unsigned char>( c ) < 0x20 || static_cast<unsigned char>( c ) >= 0x7F ) c = '?';
+
+    return corpus + "/" + in.name + " (" + std::to_string( in.text.size() ) + " bytes: " + prefix + ( in.text.size() > 40? "...": "" ) + ")";
+}
+
+struct limit
+{
+    double us = 0; // 0 for none
+    bool exceeded = false;
+};
+
+// Times parse( text ) on every input and reports the case, with the inputs as the values
+template<class F> static void run_case( bench::reporter& rep, bench::options const& opt, limit& lim, bench::result info,
+                                        std::string const& corpus, std::vector<input> const& inputs, F&& parse )
+{
+    if( inputs.empty() ) return;
+
+    info.corpus = corpus;
+    info.values = inputs.size();
+
+    double checksum = 0;
+    double worst = -1;
+    std::size_t worst_index = 0;
+
+    for( std::size_t i = 0; i < inputs.size(); ++i )
+    {
+        std::string const& text = inputs[ i ].text;
+        info.bytes += text.size();
+
+        double const ns = best_ns( opt.runs, [&]{ checksum += parse( text ); } );
+        info.ns.push_back( ns );
+
+        if( ns > worst )
+        {
+            worst = ns;
+            worst_index = i;
+        }
+    }
+
+    info.checksum = checksum;
+
+    std::string const name = info.function + "<" + info.type + ">, " + info.format;
+    rep.add( std::move( info ) );
+
+    std::cout << std::flush;
+    std::cerr << "  slowest input of " << name << ": " << worst << " ns, " << describe( corpus, inputs[ worst_index ] ) << "\n";
+
+    if( lim.us > 0 && worst > lim.us * 1000 )
+    {
+        std::cerr << "  exceeds the limit of " << lim.us << " us\n";
+        lim.exceeded = true;
+    }
+}
+
+static char const* const corpora[] = { "seedcorpus", "old_crashes", "slow_inputs" };
+
+template<class T> static void test_float( bench::reporter& rep, bench::options const& opt, limit& lim )
+{
+    if( !bench::selected( opt.impls, "float" ) || !bench::selected( opt.types, boost::core::type_name<T>() ) ) return;
+
+    for( auto fmt: bench::formats( opt.formats, { boost::charconv::chars_format::general, boost::charconv::chars_format::fixed,
+                                                  boost::charconv::chars_format::scientific, boost::charconv::chars_format::hex } ) )
+    {
+        bench::result info;
+        info.impl = "float";
+        info.function = "boost::charconv::from_chars";
+        info.type = boost::core::type_name<T>();
+        info.format = bench::format_name( fmt );
+
+        for( char const* corpus: corpora )
+        {
+            run_case( rep, opt, lim, info, corpus, load_inputs( corpus, "fuzz_from_chars_float" ), [&]( std::string const& text ){
+                T value {};
+                auto const r = boost::charconv::from_chars( text.data(), text.data() + text.size(), value, fmt );
+                return static_cast<double>( r.ptr - text.data() ) + static_cast<double>( value != 0 );
+            });
+        }
+
+        rep.end_group();
+    }
+}
+
+template<class T> static void test_int( bench::reporter& rep, bench::options const& opt, limit& lim )
+{
+    if( !bench::selected( opt.impls, "int" ) || !bench::selected( opt.types, boost::core::type_name<T>() ) ) return;
+
+    for( int base: { 2, 10, 16 } )
+    {
+        bench::result info;
+        info.impl = "int";
+        info.function = "boost::charconv::from_chars";
+        info.type = boost::core::type_name<T>();
+        info.format = "base " + std::to_string( base );
+
+        for( char const* corpus: corpora )
+        {
+            run_case( rep, opt, lim, info, corpus, load_inputs( corpus, "fuzz_from_chars_int" ), [&]( std::string const& text ){
+                T value {};
+                auto const r = boost::charconv::from_chars( text.data(), text.data() + text.size(), value, base );
+                return static_cast<double>( r.ptr - text.data() ) + static_cast<double>( value != 0 );
+            });
+        }
+
+        rep.end_group();
+    }
+}
+
+int main( int argc, char const* argv[] )
+{
+    // --limit-us is for this program only
+    limit lim;
+    std::vector<char const*> args;
+
+    for( int i = 0; i < argc; ++i )
+    {
+        std::string const arg = argv[ i ];
+
+        if( arg.compare( 0, 11, "--limit-us=" ) == 0 )
+        {
+            lim.us = static_cast<double>( bench::parse_number( argv[ 0 ], "limit-us", arg.substr( 11 ) ) );
+        }
+        else
+        {
+            args.push_back( argv[ i ] );
+        }
+    }
+
+    bench::options defaults;
+    defaults.runs = 20;
+
+    bench::options const opt = bench::parse_options( static_cast<int>( args.size() ), args.data(), defaults );
+    bench::reporter rep( opt, "fuzz_corpus" );
+
+    if( load_inputs( "seedcorpus", "fuzz_from_chars_float" ).empty() )
+    {
+        std::cerr << argv[ 0 ] << ": no corpus in " << fuzzing_dir() << "\n";
+        return 2;
+    }
+
+    test_float<float>( rep, opt, lim );
+    test_float<double>( rep, opt, lim );
+    test_float<long double>( rep, opt, lim );
+
+    test_int<int>( rep, opt, lim );
+    test_int<long long>( rep, opt, lim );
+    test_int<unsigned long long>( rep, opt, lim );
+
+    return lim.exceeded? 1: 0;
+}
@@ -0,0 +1,459 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Training workload for profile guided optimization and BOLT: a build of the library instrumented with
+// -fprofile-generate (or running under perf record) runs this program, and the profile it leaves is used
+// to build the library again. Every round calls the public from_chars and to_chars overloads on
+//
+//   - every number of the bundled corpora, as double, float and long double, parsed and written in the ways
+//     that a reader of such files does: shortest, fixed with the decimals of the input, scientific and JSON
+//   - generated integers of every type, mostly in base 10, then 16, 2 and 8, and every other base
+//   - generated values of every floating point type, in every chars_format and a spread of precisions
+//   - inputs and buffers that fail, which are a few percent of the calls as in the input of a real reader
+//
+// The share of each part is set by the weights below, so that the branches are taken about as often as in
+// a program that reads and writes numbers like those of the corpora. The output is the number of calls
+// and a checksum, so that runs can be compared.
+//
+//   --rounds=<count>   number of rounds (default 10)
+//   --corpus=<list>    the corpora of the first part (default prices,counters,sensors,coordinates)
+
+#include "benchmark.hpp"
+#include <boost/charconv.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using boost::charconv::chars_format;
+
+// Values generated per round by the second and third parts, next to the 40000 numbers of the corpora
+static constexpr std::size_t integers_per_round = 20000;
+static constexpr std::size_t floats_per_round = 20000;
+static constexpr std::size_t errors_per_round = 1000;
+
+// The share of each floating point type in the third part, in percent. The extended types are __float128,
+// std::float128_t, std::float16_t and std::bfloat16_t, where they are supported
+static constexpr std::size_t float_share = 25;
+static constexpr std::size_t double_share = 55;
+static constexpr std::size_t long_double_share = 10;
+static constexpr std::size_t extended_share = 10;
+
+struct sink
+{
+    std::uint64_t calls = 0;
+    std::uint64_t checksum = 0;
+
+    void add( char const* first, char const* last )
+    {
+        ++calls;
+        checksum = checksum * 31 + static_cast<std::uint64_t>( last - first ) + static_cast<unsigned char>( *first );
+    }
+
+    void add( bool ok )
+    {
+        ++calls;
+        checksum = checksum * 31 + ( ok? 1: 2 );
+    }
+};
+
+// A weighted choice: the first entry whose cumulative weight is above r % total
+template<class T, std::size_t N> static T pick( std::uint64_t r, T const ( &values )[ N ], int const ( &weights )[ N ] )
+{
+    int total = 0;
+    for( int w: weights ) total += w;
+
+    int x = static_cast<int>( r % static_cast<std::uint64_t>( total ) );
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        if( x < weights[ i ] ) return values[ i ];
+        x -= weights[ i ];
+    }
+
+    return values[ N - 1 ];
+}
+
+static chars_format random_format( std::uint64_t r )
+{
+    static chars_format const formats[] = { chars_format::general, chars_format::scientific, chars_format::fixed, chars_format::hex };
+    static int const weights[] = { 50, 20, 25, 5 };
+    return pick( r, formats, weights );
+}
+
+// Mostly the shortest representation, then the few digits of prices and readings, and rarely long ones
+static int random_precision( std::uint64_t r )
+{
+    static int const precisions[] = { -1, 0, 1, 2, 3, 4, 6, 9, 12, 15, 17, 25, 40, 100 };
+    static int const weights[] = { 60, 2, 2, 8, 3, 3, 10, 2, 2, 2, 3, 1, 1, 1 };
+    return pick( r, precisions, weights );
+}
+
+static int random_base( std::uint64_t r )
+{
+    static int const bases[] = { 10, 16, 2, 8, 0 };
+    static int const weights[] = { 80, 10, 4, 3, 3 };
+
+    int const base = pick( r, bases, weights );
+    return base != 0? base: 3 + static_cast<int>( ( r >> 32 ) % 34 );
+}
+
+// The numbers of the corpora --------------------------------------------------------------------------------
+
+// Number of digits after the decimal point of a number such as 12.50 or 1.5e-3
+static int decimals( std::string const& s )
+{
+    std::size_t const dot = s.find( '.' );
+    if( dot == std::string::npos ) return 0;
+
+    std::size_t const end = s.find_first_of( "eE", dot );
+    return static_cast<int>( ( end == std::string::npos? s.size(): end ) - dot - 1 );
+}
+
+static BOOST_NOINLINE void train_corpus( std::vector<std::string> const& values, sink& s )
+{
+    char buffer[ 512 ];
+    char* const last = buffer + sizeof( buffer );
+
+    for( std::size_t i = 0; i < values.size(); ++i )
+    {
+        std::string const& text = values[ i ];
+        char const* const first = text.data();
+        char const* const end = first + text.size();
+
+        double d = 0;
+        auto r = i % 2 == 0? boost::charconv::from_chars( first, end, d ):
+                             boost::charconv::from_chars( boost::core::string_view( text ), d );
+        s.add( r.ec == std::errc() );
+
+        if( i % 4 == 1 )
+        {
+            auto const r2 = boost::charconv::from_chars( first, end, d, chars_format::fixed );
+            s.add( r2.ec == std::errc() );
+        }
+
+        float f = 0;
+        if( i % 2 == 0 )
+        {
+            auto const r2 = boost::charconv::from_chars( first, end, f );
+            s.add( r2.ec == std::errc() );
+        }
+
+        if( i % 8 == 3 )
+        {
+            long double ld = 0;
+            auto const r2 = boost::charconv::from_chars( first, end, ld );
+            s.add( r2.ec == std::errc() );
+        }
+
+        if( i % 16 == 5 )
+        {
+            double v = 0;
+            auto const r2 = boost::charconv::json_from_chars( first, end, v );
+            s.add( r2.ec == std::errc() );
+            auto const r3 = boost::charconv::from_chars_erange( first, end, v );
+            s.add( r3.ec == std::errc() );
+            auto const r4 = boost::charconv::from_chars( first, end, v, chars_format::general, boost::charconv::rounding_mode::toward_zero );
+            s.add( r4.ec == std::errc() );
+        }
+
+        // The same number with a decimal comma, as in the files of many locales
+        if( i % 16 == 9 )
+        {
+            std::string comma = text;
+            std::replace( comma.begin(), comma.end(), '.', ',' );
+
+            double v = 0;
+            auto const r2 = boost::charconv::from_chars( comma.data(), comma.data() + comma.size(), v, chars_format::general,
+                                                         boost::charconv::chars_format_options( ',' ) );
+            s.add( r2.ec == std::errc() );
+        }
+
+        // The integers of the counters
+        if( text.find_first_of( ".eE" ) == std::string::npos )
+        {
+            long long n = 0;
+            auto const r2 = boost::charconv::from_chars( first, end, n );
+            s.add( r2.ec == std::errc() );
+
+            auto const w = boost::charconv::to_chars( buffer, last, n );
+            s.add( buffer, w.ptr );
+
+            unsigned u = 0;
+            auto const r3 = boost::charconv::from_chars( first, end, u );
+            s.add( r3.ec == std::errc() );
+        }
+
+        auto w = boost::charconv::to_chars( buffer, last, d );
+        s.add( buffer, w.ptr );
+
+        w = boost::charconv::to_chars( buffer, last, d, chars_format::fixed, decimals( text ) );
+        s.add( buffer, w.ptr );
+
+        if( i % 2 == 0 )
+        {
+            w = boost::charconv::to_chars( buffer, last, f );
+            s.add( buffer, w.ptr );
+
+            w = boost::charconv::to_chars( buffer, last, d, chars_format::scientific, 6 );
+            s.add( buffer, w.ptr );
+        }
+
+        if( i % 4 == 3 )
+        {
+            w = boost::charconv::to_chars( buffer, last, d, chars_format::general, i % 8 == 3? 17: 15 );
+            s.add( buffer, w.ptr );
+        }
+
+        if( i % 8 == 7 )
+        {
+            w = boost::charconv::to_chars( buffer, last, static_cast<long double>( d ) );
+            s.add( buffer, w.ptr );
+        }
+
+        if( i % 16 == 13 )
+        {
+            w = boost::charconv::json_to_chars( buffer, last, d );
+            s.add( buffer, w.ptr );
+
+            w = boost::charconv::to_chars( buffer, last, d, chars_format::hex );
+            s.add( buffer, w.ptr );
+
+            w = boost::charconv::to_chars( buffer, last, d, chars_format::fixed, 2, boost::charconv::rounding_mode::toward_infinity );
+            s.add( buffer, w.ptr );
+
+            w = boost::charconv::to_chars( buffer, last, d, chars_format::general, boost::charconv::chars_format_options( ',' ) );
+            s.add( buffer, w.ptr );
+        }
+    }
+}
+
+// Generated integers ----------------------------------------------------------------------------------------
+
+template<class T> static T random_integer( boost::detail::splitmix64& rng )
+{
+    // Counts and identifiers are mostly short, so the number of digits is skewed towards few
+    int const digits = 1 + static_cast<int>( ( rng() % static_cast<std::uint64_t>( bench::max_digits<T>() ) ) * ( rng() % 4 + 1 ) / 4 );
+    return bench::integer_with_digits<T>( rng(), std::min( digits, bench::max_digits<T>() ) );
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+
+template<> boost::int128_type random_integer<boost::int128_type>( boost::detail::splitmix64& rng )
+{
+    auto const x = static_cast<boost::int128_type>( ( static_cast<boost::uint128_type>( rng() ) << 64 ) | rng() );
+    return x >> ( rng() % 127 );
+}
+
+template<> boost::uint128_type random_integer<boost::uint128_type>( boost::detail::splitmix64& rng )
+{
+    auto const x = ( static_cast<boost::uint128_type>( rng() ) << 64 ) | rng();
+    return x >> ( rng() % 128 );
+}
+
+#endif
+
+template<class T> static BOOST_NOINLINE void train_integer( std::size_t n, boost::detail::splitmix64& rng, sink& s )
+{
+    char buffer[ 160 ];
+    char* const last = buffer + sizeof( buffer );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        T const x = random_integer<T>( rng );
+        int const base = random_base( rng() );
+
+        auto const w = i % 2 == 0? boost::charconv::to_chars( buffer, last, x, base ): boost::charconv::to_chars( buffer, last, x );
+        s.add( buffer, w.ptr );
+
+        T y = 0;
+        auto const r = i % 2 == 0? boost::charconv::from_chars( buffer, w.ptr, y, base ):
+                                   boost::charconv::from_chars( boost::core::string_view( buffer, static_cast<std::size_t>( w.ptr - buffer ) ), y );
+        s.add( r.ec == std::errc() && x == y );
+    }
+}
+
+static void train_integers( std::size_t n, boost::detail::splitmix64& rng, sink& s )
+{
+    // int, long long and their unsigned types are most of the integers of real programs
+    train_integer<int>( n * 25 / 100, rng, s );
+    train_integer<unsigned>( n * 15 / 100, rng, s );
+    train_integer<long long>( n * 15 / 100, rng, s );
+    train_integer<unsigned long long>( n * 15 / 100, rng, s );
+    train_integer<long>( n * 5 / 100, rng, s );
+    train_integer<unsigned long>( n * 5 / 100, rng, s );
+    train_integer<short>( n * 4 / 100, rng, s );
+    train_integer<unsigned short>( n * 4 / 100, rng, s );
+    train_integer<signed char>( n * 3 / 100, rng, s );
+    train_integer<unsigned char>( n * 3 / 100, rng, s );
+    train_integer<char>( n * 2 / 100, rng, s );
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+    train_integer<boost::int128_type>( n * 2 / 100, rng, s );
+    train_integer<boost::uint128_type>( n * 2 / 100, rng, s );
+#endif
+}
+
+// Generated floating point values ---------------------------------------------------------------------------
+
+// Random bits, half of the time rounded to a few digits like the values of a file
+template<class T> static T random_float( boost::detail::splitmix64& rng )
+{
+    std::uint64_t bits[ 2 ] = { rng(), rng() };
+
+    T x;
+    std::memcpy( &x, bits, sizeof( x ) );
+    return x;
+}
+
+// Made of the bits of a double scaled by a power of two, since not every 80 or 128 bits are a long double
+template<> long double random_float<long double>( boost::detail::splitmix64& rng )
+{
+    double const d = random_float<double>( rng );
+    return rng() % 4 == 0? std::ldexp( static_cast<long double>( d ), static_cast<int>( rng() % 8192 ) - 4096 ): static_cast<long double>( d );
+}
+
+template<class T> static BOOST_NOINLINE void train_float( std::size_t n, boost::detail::splitmix64& rng, sink& s )
+{
+    // The fixed format of the largest long double and __float128 values has almost 5000 digits
+    static char buffer[ 6000 ];
+    char* const last = buffer + sizeof( buffer );
+
+    for( std::size_t i = 0; i < n; )
+    {
+        T x = random_float<T>( rng );
+        if( !( x == x ) || x - x != x - x ) continue;
+        ++i;
+
+        chars_format const fmt = random_format( rng() );
+        int const precision = random_precision( rng() );
+
+        if( i % 2 == 0 ) x = bench::round_to_digits( x, 1 + static_cast<int>( rng() % 8 ) );
+
+        auto const w = precision < 0 && i % 4 != 0? boost::charconv::to_chars( buffer, last, x, fmt ):
+                                                    boost::charconv::to_chars( buffer, last, x, fmt, precision );
+        s.add( buffer, w.ptr );
+
+        T y = 0;
+        auto const r = boost::charconv::from_chars( buffer, w.ptr, y, fmt );
+        s.add( r.ec == std::errc() );
+    }
+}
+
+static void train_floats( std::size_t n, boost::detail::splitmix64& rng, sink& s )
+{
+    train_float<float>( n * float_share / 100, rng, s );
+    train_float<double>( n * double_share / 100, rng, s );
+    train_float<long double>( n * long_double_share / 100, rng, s );
+
+    std::size_t const extended = n * extended_share / 100;
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+    train_float<__float128>( extended / 2, rng, s );
+#endif
+#ifdef BOOST_CHARCONV_HAS_STDFLOAT128
+    train_float<std::float128_t>( extended / 8, rng, s );
+#endif
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+    train_float<std::float16_t>( extended / 4, rng, s );
+#endif
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+    train_float<std::bfloat16_t>( extended / 8, rng, s );
+#endif
+
+    static_cast<void>( extended );
+}
+
+// Errors ----------------------------------------------------------------------------------------------------
+
+static char const* const bad_floats[] =
+{
+    "", "-", "+1", ".", "e5", "1e", "1e+", "abc", "--1", " 1", "0x1p3", "1e400", "-1e-400", "1e99999999999999999999",
+    "nan(", "infinity!", "1.2.3", "1,5"
+};
+
+static char const* const bad_integers[] =
+{
+    "", "-", "+1", "abc", "99999999999999999999999999999999999999999", "-99999999999999999999999999999999999999999",
+    "0x10", " 1", "--1", "18446744073709551616", "-9223372036854775809", "2147483648", "300"
+};
+
+static BOOST_NOINLINE void train_errors( std::size_t n, boost::detail::splitmix64& rng, sink& s )
+{
+    constexpr std::size_t float_count = sizeof( bad_floats ) / sizeof( bad_floats[ 0 ] );
+    constexpr std::size_t integer_count = sizeof( bad_integers ) / sizeof( bad_integers[ 0 ] );
+
+    char small[ 4 ];
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        char const* const f = bad_floats[ i % float_count ];
+        char const* const k = bad_integers[ i % integer_count ];
+
+        double d = 0;
+        s.add( boost::charconv::from_chars( f, f + std::strlen( f ), d, random_format( rng() ) ).ec == std::errc() );
+
+        float x = 0;
+        s.add( boost::charconv::from_chars( f, f + std::strlen( f ), x ).ec == std::errc() );
+
+        int v = 0;
+        s.add( boost::charconv::from_chars( k, k + std::strlen( k ), v ).ec == std::errc() );
+
+        unsigned long long u = 0;
+        s.add( boost::charconv::from_chars( k, k + std::strlen( k ), u, random_base( rng() ) ).ec == std::errc() );
+
+        // Buffers that are too small
+        auto const w = boost::charconv::to_chars( small, small + sizeof( small ), random_float<double>( rng ), random_format( rng() ), random_precision( rng() ) );
+        s.add( w.ec == std::errc() );
+
+        auto const w2 = boost::charconv::to_chars( small, small + sizeof( small ), static_cast<long long>( rng() ) );
+        s.add( w2.ec == std::errc() );
+    }
+}
+
+int main( int argc, char const* argv[] )
+{
+    int rounds = 10;
+    std::vector<std::string> corpora = { "prices", "counters", "sensors", "coordinates" };
+
+    for( int i = 1; i < argc; ++i )
+    {
+        std::string const arg = argv[ i ];
+        std::size_t const eq = arg.find( '=' );
+        std::string const key = arg.substr( 0, eq );
+        std::string const value = eq == std::string::npos? std::string(): arg.substr( eq + 1 );
+
+        if( key == "--rounds" ) rounds = static_cast<int>( bench::parse_number( argv[ 0 ], "rounds", value ) );
+        else if( key == "--corpus" ) corpora = bench::split( value );
+        else
+        {
+            std::cerr << argv[ 0 ] << ": unknown option " << arg << "\nusage: " << argv[ 0 ] << " [--rounds=<count>] [--corpus=<list>]\n";
+            return 2;
+        }
+    }
+
+    std::vector<std::string> values;
+    for( auto const& c: corpora )
+    {
+        auto const v = bench::load_corpus( argv[ 0 ], c );
+        values.insert( values.end(), v.begin(), v.end() );
+    }
+
+    boost::detail::splitmix64 rng;
+    sink s;
+
+    for( int round = 0; round < rounds; ++round )
+    {
+        train_corpus( values, s );
+        train_integers( integers_per_round, rng, s );
+        train_floats( floats_per_round, rng, s );
+        train_errors( errors_per_round, rng, s );
+    }
+
+    std::cout << "pgo_training: " << rounds << " rounds, " << s.calls << " calls, checksum " << s.checksum << "\n";
+}
@@ -0,0 +1,291 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Latency of the conversions of double and float when their tables of powers of ten have been partly evicted,
+// by band of decimal exponents. Before every value the program writes to --cold KiB of memory (default 256, about
+// the L2 cache of a core) and then times the value on its own, so that every case reports the distribution of the time
+// of single calls across the values instead of across runs, and its p99 is that of one conversion. The bands,
+// selected with --impl, are
+//
+//   hot      values from 1e-6 to 1e9, which is where most numbers of most programs are
+//   extreme  values from 1e-300 to 1e-100 and from 1e100 to 1e300 (1e-37 to 1e-20 and 1e20 to 1e37 for float)
+//   mixed    values of the hot band, and one in a hundred of the extreme one
+//
+// For every case the number of cache lines of the table that the values of the band index is written to stderr
+// with the p99, and with --perf=on the mean L1 data cache misses of a call: since the tables are in the order of the
+// exponent and start on a cache line, the hot band reads a few lines that stay in the cache, and the extreme values
+// miss. --n is the number of values of each case (default 10000), and --digits their significant digits
+// (default 6 and 17). See benchmark.hpp for the rest of the command line
+
+#include "benchmark.hpp"
+#include <boost/charconv/detail/significand_tables.hpp>
+#include <boost/charconv/detail/dragonbox/dragonbox.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+struct band
+{
+    char const* name;
+    int hot_lo;         // decimal exponents in scientific notation, [hot_lo, hot_hi)
+    int hot_hi;
+    int extreme_lo;     // and the extreme exponents, [extreme_lo, extreme_hi) and its negation
+    int extreme_hi;
+    unsigned extreme_percent;
+};
+
+template<class T> static std::vector<band> bands()
+{
+    int const lo = std::is_same<T, float>::value? 20: 100;
+    int const hi = std::is_same<T, float>::value? 37: 300;
+
+    return { { "hot", -6, 9, lo, hi, 0 }, { "extreme", -6, 9, lo, hi, 100 }, { "mixed", -6, 9, lo, hi, 1 } };
+}
+
+struct decimal
+{
+    std::string text;
+    int exponent;       // of the last digit, which is what from_chars indexes the table with
+};
+
+// d.ddd...e+x with digits significant digits, the last of them not zero, and an exponent of the band
+static BOOST_NOINLINE std::vector<decimal> init_data( std::size_t n, int digits, band const& b )
+{
+    std::vector<decimal> data;
+    data.reserve( n );
+
+    boost::detail::splitmix64 rng;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        std::uint64_t m = bench::integer_with_digits<std::uint64_t>( rng(), digits );
+        if( m % 10 == 0 ) ++m;
+
+        int e;
+        if( rng() % 100 < b.extreme_percent )
+        {
+            e = b.extreme_lo + static_cast<int>( rng() % static_cast<std::uint64_t>( b.extreme_hi - b.extreme_lo ) );
+            if( rng() % 2 == 0 ) e = -e;
+        }
+        else
+        {
+            e = b.hot_lo + static_cast<int>( rng() % static_cast<std::uint64_t>( b.hot_hi - b.hot_lo ) );
+        }
+
+        std::string const significand = std::to_string( m );
+        std::string str = significand.substr( 0, 1 );
+        if( digits > 1 ) str += "." + significand.substr( 1 );
+        str += "e" + std::to_string( e );
+
+        data.push_back( { std::move( str ), e - ( digits - 1 ) } );
+    }
+
+    return data;
+}
+
+// The cache lines of a table of entries of entry_size bytes that the indices read
+static std::size_t lines_read( void const* table, std::size_t entry_size, std::vector<int> const& indices )
+{
+    std::set<std::uintptr_t> lines;
+    for( int i: indices ) lines.insert( ( reinterpret_cast<std::uintptr_t>( table ) + static_cast<std::uintptr_t>( i ) * entry_size ) / 64 );
+    return lines.size();
+}
+
+// The k of 10^k that Dragonbox multiplies a finite nonzero value with, for the full cache policy
+template<class T> static int dragonbox_k( T x )
+{
+    int const significand_bits = std::numeric_limits<T>::digits - 1;
+    int const kappa = std::is_same<T, float>::value? 1: 2;
+    int const e = ( std::max )( std::ilogb( x ), std::numeric_limits<T>::min_exponent - 1 ) - significand_bits;
+
+    return kappa - static_cast<int>( std::floor( e * 0.30102999566398120 ) );
+}
+
+// The table that each direction reads, and the index of every value in it
+template<class T> static std::size_t from_chars_lines( std::vector<decimal> const& data )
+{
+    using table = boost::charconv::detail::significands_table;
+
+    std::vector<int> indices;
+    for( auto const& x: data ) indices.push_back( x.exponent - table::smallest_power );
+
+    return lines_read( table::power_of_ten_128, 16, indices );
+}
+
+template<class T> static std::size_t to_chars_lines( std::vector<T> const& values )
+{
+    std::vector<int> indices;
+
+    BOOST_CHARCONV_IF_CONSTEXPR( std::is_same<T, float>::value )
+    {
+        using cache = boost::charconv::detail::cache_holder_ieee754_binary32;
+        for( T x: values ) indices.push_back( dragonbox_k( x ) - cache::min_k );
+
+        return lines_read( cache::cache, sizeof( cache::cache[0] ), indices );
+    }
+    else
+    {
+        using table = boost::charconv::detail::significands_table;
+        for( T x: values ) indices.push_back( dragonbox_k( x ) - table::smallest_power );
+
+        return lines_read( table::power_of_ten_128, 16, indices );
+    }
+}
+
+// Times f( i ) for every value on its own after the cache thrasher, less the cost of timing an empty call
+template<class F> static void measure_each( bench::reporter& rep, bench::options const& opt, bench::result info, std::size_t lines, F&& f )
+{
+    std::size_t const n = info.values;
+    info.cold = opt.cold;
+
+    bench::cache_thrasher thrash( opt.cold * 1024 );
+    bench::perf_counters* const counters = bench::hardware_counters( opt );
+    volatile double sink = 0;
+
+    std::uint64_t overhead = ( std::numeric_limits<std::uint64_t>::max )();
+
+    for( int i = 0; i < 1000; ++i )
+    {
+        std::uint64_t const t1 = bench::ordered_ticks();
+        std::uint64_t const t2 = bench::ordered_ticks();
+
+        overhead = ( std::min )( overhead, t2 - t1 );
+    }
+
+    for( std::size_t i = 0; i < n; ++i ) sink = f( i );
+
+    std::vector<std::uint64_t> ticks( n );
+    double misses = 0;
+    double checksum = 0;
+
+    auto const start = std::chrono::steady_clock::now();
+    std::uint64_t const start_ticks = bench::ordered_ticks();
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        thrash();
+
+        if( counters ) counters->start();
+
+        std::uint64_t const t1 = bench::ordered_ticks();
+        double const y = f( i );
+        sink = y;
+        std::uint64_t const t2 = bench::ordered_ticks();
+
+        if( counters )
+        {
+            bench::perf_values const v = counters->stop();
+            info.instructions.push_back( v.instructions );
+            info.branch_misses.push_back( v.branch_misses );
+            info.l1d_misses.push_back( v.l1d_misses );
+            info.ipc.push_back( v.cycles > 0? v.instructions / v.cycles: 0 );
+            misses += v.l1d_misses;
+        }
+
+        ticks[ i ] = t2 - t1 - ( std::min )( overhead, t2 - t1 );
+        checksum += y;
+    }
+
+    std::uint64_t const end_ticks = bench::ordered_ticks();
+    auto const end = std::chrono::steady_clock::now();
+
+    // Converts the cycles to nanoseconds at the rate of the whole run, thrasher included
+    double const ns = std::chrono::duration<double, std::nano>( end - start ).count();
+    double const ticks_per_ns = bench::has_cycle_counter && ns > 0? static_cast<double>( end_ticks - start_ticks ) / ns: 1;
+
+    for( std::uint64_t t: ticks )
+    {
+        info.ns.push_back( static_cast<double>( t ) / ticks_per_ns );
+        if( bench::has_cycle_counter ) info.cycles.push_back( static_cast<double>( t ) );
+    }
+
+    info.checksum = checksum;
+    static_cast<void>( sink );
+
+    std::vector<double> sorted = info.ns;
+    std::sort( sorted.begin(), sorted.end() );
+
+    std::string const name = info.exponents + " " + info.function + "<" + info.type + ">, digits " + std::to_string( info.digits );
+    rep.add( std::move( info ) );
+
+    std::cout << std::flush;
+    std::cerr << "  " << name << ": p99 " << bench::nearest_rank( sorted, 99 ) << " ns, " << lines << " cache lines of the table";
+    if( counters ) std::cerr << ", " << misses / static_cast<double>( n ) << " L1D misses per call";
+    std::cerr << "\n";
+}
+
+template<class T> static void test_type( bench::reporter& rep, bench::options const& opt )
+{
+    std::string const type = std::is_same<T, float>::value? "float": "double";
+    if( !bench::selected( opt.types, type ) ) return;
+
+    for( auto const& b: bands<T>() )
+    {
+        if( !bench::selected( opt.impls, b.name ) ) continue;
+
+        for( int digits: bench::numbers( opt.digits, { 6, 17 } ) )
+        {
+            if( digits < 1 || digits > std::numeric_limits<T>::max_digits10 ) continue;
+
+            std::vector<decimal> const data = init_data( opt.n, digits, b );
+
+            std::vector<T> values;
+            std::size_t input_bytes = 0;
+            for( auto const& x: data )
+            {
+                T y {};
+                boost::charconv::from_chars( x.text.data(), x.text.data() + x.text.size(), y );
+                values.push_back( y );
+                input_bytes += x.text.size();
+            }
+
+            bench::result info;
+            info.impl = b.name;
+            info.type = type;
+            info.format = "general";
+            info.digits = digits;
+            info.exponents = b.name;
+            info.values = data.size();
+
+            info.function = "boost::charconv::from_chars";
+            info.bytes = input_bytes;
+            measure_each( rep, opt, info, from_chars_lines<T>( data ), [&]( std::size_t i ){
+                T y {};
+                boost::charconv::from_chars( data[ i ].text.data(), data[ i ].text.data() + data[ i ].text.size(), y );
+                return static_cast<double>( y );
+            });
+
+            char buffer[ 64 ];
+            std::size_t output_bytes = 0;
+            for( T x: values ) output_bytes += static_cast<std::size_t>( boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x ).ptr - buffer );
+
+            info.function = "boost::charconv::to_chars";
+            info.bytes = output_bytes;
+            measure_each( rep, opt, info, to_chars_lines( values ), [&]( std::size_t i ){
+                auto const r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), values[ i ] );
+                return static_cast<double>( r.ptr - buffer ) + static_cast<unsigned char>( buffer[ 0 ] );
+            });
+        }
+
+        rep.end_group();
+    }
+}
+
+int main( int argc, char const* argv[] )
+{
+    bench::options defaults;
+    defaults.n = 10000;
+    defaults.cold = 256;
+
+    bench::options const opt = bench::parse_options( argc, argv, defaults );
+    bench::reporter rep( opt, "table_locality" );
+
+    test_type<double>( rep, opt );
+    test_type<float>( rep, opt );
+}
@@ -2,7 +2,12 @@
 // Copyright 2023 Matt Borland
 // Distributed under the Boost Software License, Version 1.0.
 // https://www.boost.org/LICENSE_1_0.txt
+//
+// to_chars for floating point types against std::snprintf and std::to_chars, for every selected format and precision.
+// The values are random, or read from a corpus.
+// See benchmark.hpp for the command line
 
+#include "benchmark.hpp"
 #include <boost/charconv/detail/config.hpp>
 #include <ostream>
 
@@ -19,28 +24,25 @@ std::ostream& operator<<( std::ostream& os, std::float128_t v)
 
 #endif
 
-
-#include <boost/charconv/to_chars.hpp>
 #include <boost/core/type_name.hpp>
 #include <boost/core/detail/splitmix64.hpp>
-#include <boost/config.hpp>
 #include <type_traits>
-#include <chrono>
 #include <cstdio>
-#include <iostream>
-#include <iomanip>
+#include <cstring>
+#include <vector>
 #include <charconv>
 
-constexpr unsigned N = 2'000'000;
-constexpr int K = 10;
+// Large enough for every value in fixed format
+constexpr std::size_t buffer_size = 5000;
 
-template<class T> static BOOST_NOINLINE void init_input_data( std::vector<T>& data )
+template<class T> static BOOST_NOINLINE void init_input_data( std::vector<T>& data, std::size_t n, int digits )
 {
-    data.reserve( N );
+    data.clear();
+    data.reserve( n );
 
     boost::detail::splitmix64 rng;
 
-    for( unsigned i = 0; i < N; ++i )
+    while( data.size() < n )
     {
         std::uint64_t tmp = rng();
 
@@ -49,18 +51,19 @@ template<class T> static BOOST_NOINLINE void init_input_data( std::vector<T>& da
 
         if( !std::isfinite(x) ) continue;
 
-        data.push_back( x );
+        data.push_back( bench::round_to_digits( x, digits ) );
     }
 }
 
 #ifdef BOOST_CHARCONV_HAS_STDFLOAT128
-template<> BOOST_NOINLINE void init_input_data<std::float128_t>( std::vector<std::float128_t>& data )
+template<> BOOST_NOINLINE void init_input_data<std::float128_t>( std::vector<std::float128_t>& data, std::size_t n, int digits )
 {
-    data.reserve( N );
+    data.clear();
+    data.reserve( n );
 
     boost::detail::splitmix64 rng;
 
-    for( unsigned i = 0; i < N; ++i )
+    while( data.size() < n )
     {
         boost::charconv::detail::uint128 tmp {rng(), rng()};
         boost::uint128_type temp {tmp};
@@ -70,172 +73,189 @@ template<> BOOST_NOINLINE void init_input_data<std::float128_t>( std::vector<std
 
         if( !std::isfinite(x) ) continue;
 
-        data.push_back( x );
+        data.push_back( bench::round_to_digits( x, digits ) );
     }
 }
 #endif
 
-using namespace std::chrono_literals;
-
-template<class T> static BOOST_NOINLINE void test_snprintf( std::vector<T> const& data, bool general, char const* label, int precision )
+// The printf precision closest to the shortest representation
+template<class T> static int printf_precision( int precision )
 {
-    auto t1 = std::chrono::steady_clock::now();
+    if( precision >= 0 ) return precision;
+    return std::is_same<T, float>::value? 8: 16;
+}
 
+template<class T> static BOOST_NOINLINE std::size_t test_snprintf( std::vector<T> const& data, std::size_t first, std::size_t last, boost::charconv::chars_format fmt, int precision )
+{
     std::size_t s = 0;
 
-    char const* format = general? "%.*g": "%.*e";
+    char const* format = fmt == boost::charconv::chars_format::general? "%.*g":
+                         fmt == boost::charconv::chars_format::fixed? "%.*f":
+                         fmt == boost::charconv::chars_format::hex? "%.*a": "%.*e";
 
-    int prec = precision;
+    int const prec = printf_precision<T>( precision );
 
-    if( prec == 0 )
-    {
-        prec = 16;
+    char buffer[ buffer_size ];
 
-        BOOST_IF_CONSTEXPR( std::is_same<T, float>::value )
-        {
-            prec = 8;
-        }
-    }
-
-    for( int i = 0; i < K; ++i )
+    for( std::size_t i = first; i < last; ++i )
     {
-        char buffer[ 22 ];
+        auto const x = data[ i ];
 
-        for( auto x: data )
-        {
-            auto r = std::snprintf( buffer, sizeof( buffer ), format, prec, x );
-            s += r;
-            s += static_cast<unsigned char>( buffer[0] );
-        }
+        auto r = std::snprintf( buffer, sizeof( buffer ), format, prec, static_cast<double>( x ) );
+        s += static_cast<std::size_t>( r );
+        s += static_cast<unsigned char>( buffer[0] );
     }
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "            std::snprintf<" << boost::core::type_name<T>() << ">, " << label << ", " << precision << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+    return s;
 }
 
-template<class T> static BOOST_NOINLINE void test_std_to_chars( std::vector<T> const& data, bool general, char const* label, int precision )
-{
-    auto t1 = std::chrono::steady_clock::now();
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
 
+template<class T> static BOOST_NOINLINE std::size_t test_std_to_chars( std::vector<T> const& data, std::size_t first, std::size_t last, std::chars_format fmt, int precision )
+{
     std::size_t s = 0;
 
-    for( int i = 0; i < K; ++i )
-    {
-        char buffer[ 21 ];
+    char buffer[ buffer_size ];
 
-        for( auto x: data )
-        {
-            std::chars_format fmt = general? std::chars_format::general: std::chars_format::scientific;
+    for( std::size_t i = first; i < last; ++i )
+    {
+        auto const x = data[ i ];
 
-            auto r = precision == 0?
-                     std::to_chars( buffer, buffer + sizeof( buffer ), x, fmt ):
-                     std::to_chars( buffer, buffer + sizeof( buffer ), x, fmt, precision );
+        auto r = precision < 0?
+                 std::to_chars( buffer, buffer + sizeof( buffer ), x, fmt ):
+                 std::to_chars( buffer, buffer + sizeof( buffer ), x, fmt, precision );
 
-            s += static_cast<std::size_t>( r.ptr - buffer );
-            s += static_cast<unsigned char>( buffer[0] );
-        }
+        s += static_cast<std::size_t>( r.ptr - buffer );
+        s += static_cast<unsigned char>( buffer[0] );
     }
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "            std::to_chars<" << boost::core::type_name<T>() << ">, " << label << ", " << precision << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+    return s;
 }
 
-template<class T> static BOOST_NOINLINE void test_boost_to_chars( std::vector<T> const& data, bool general, char const* label, int precision )
-{
-    auto t1 = std::chrono::steady_clock::now();
+#endif
 
+template<class T> static BOOST_NOINLINE std::size_t test_boost_to_chars( std::vector<T> const& data, std::size_t first, std::size_t last, boost::charconv::chars_format fmt, int precision )
+{
     std::size_t s = 0;
 
-    for( int i = 0; i < K; ++i )
-    {
-        char buffer[ 21 ];
+    char buffer[ buffer_size ];
 
-        for( auto x: data )
-        {
-            boost::charconv::chars_format fmt = general? boost::charconv::chars_format::general: boost::charconv::chars_format::scientific;
+    for( std::size_t i = first; i < last; ++i )
+    {
+        auto const x = data[ i ];
 
-            auto r = precision == 0?
-                     boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, fmt ):
-                     boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, fmt, precision );
+        auto r = precision < 0?
+                 boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, fmt ):
+                 boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, fmt, precision );
 
-            s += static_cast<std::size_t>( r.ptr - buffer );
-            s += static_cast<unsigned char>( buffer[0] );
-        }
+        s += static_cast<std::size_t>( r.ptr - buffer );
+        s += static_cast<unsigned char>( buffer[0] );
     }
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "boost::charconv::to_chars<" << boost::core::type_name<T>() << ">, " << label << ", " << precision << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+    return s;
 }
 
-template<class T> static void test()
+// Characters written by one run, the same for every implementation that writes the same output
+template<class T> static std::size_t output_bytes( std::vector<T> const& data, boost::charconv::chars_format fmt, int precision )
 {
-    std::vector<T> data;
-    init_input_data( data );
+    std::size_t bytes = 0;
 
-    test_snprintf( data, false, "scientific", 0 );
-    test_std_to_chars( data, false, "scientific", 0 );
-    test_boost_to_chars( data, false, "scientific", 0 );
+    char buffer[ buffer_size ];
 
-    std::cout << std::endl;
-
-    test_snprintf( data, false, "scientific", 6 );
-    test_std_to_chars( data, false, "scientific", 6 );
-    test_boost_to_chars( data, false, "scientific", 6 );
+    for( auto x: data )
+    {
+        auto r = precision < 0?
+                 boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, fmt ):
+                 boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, fmt, precision );
 
-    std::cout << std::endl;
+        bytes += static_cast<std::size_t>( r.ptr - buffer );
+    }
 
-    test_snprintf( data, true, "general", 0 );
-    test_std_to_chars( data, true, "general", 0 );
-    test_boost_to_chars( data, true, "general", 0 );
+    return bytes;
+}
 
-    std::cout << std::endl;
+template<class T> static void test_data( bench::reporter& rep, bench::options const& opt, std::vector<T> const& data, int digits, std::string const& corpus )
+{
+    for( auto fmt: bench::formats( opt.formats, { boost::charconv::chars_format::scientific, boost::charconv::chars_format::general } ) )
+    {
+        for( int precision: bench::numbers( opt.precisions, { -1, 6 } ) )
+        {
+            bench::result info;
+            info.type = boost::core::type_name<T>();
+            info.format = bench::format_name( fmt );
+            info.precision = precision;
+            info.digits = digits;
+            info.corpus = corpus;
+            info.values = data.size();
+            info.bytes = output_bytes( data, fmt, precision );
+
+            // printf has no conversion for std::float128_t
+            if( bench::selected( opt.impls, "libc" ) && std::is_convertible<T, double>::value && sizeof( T ) <= sizeof( double ) )
+            {
+                info.impl = "libc";
+                info.function = "std::snprintf";
+                bench::measure_values( rep, opt, info, [&]( std::size_t first, std::size_t last ){ return test_snprintf( data, first, last, fmt, precision ); } );
+            }
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+            if( bench::selected( opt.impls, "std" ) )
+            {
+                info.impl = "std";
+                info.function = "std::to_chars";
+                std::chars_format const std_fmt = static_cast<std::chars_format>( static_cast<unsigned>( fmt ) );
+                bench::measure_values( rep, opt, info, [&]( std::size_t first, std::size_t last ){ return test_std_to_chars( data, first, last, std_fmt, precision ); } );
+            }
+#endif
 
-    test_snprintf( data, true, "general", 6 );
-    test_std_to_chars( data, true, "general", 6 );
-    test_boost_to_chars( data, true, "general", 6 );
+            if( bench::selected( opt.impls, "boost" ) )
+            {
+                info.impl = "boost";
+                info.function = "boost::charconv::to_chars";
+                bench::measure_values( rep, opt, info, [&]( std::size_t first, std::size_t last ){ return test_boost_to_chars( data, first, last, fmt, precision ); } );
+            }
 
-    std::cout << std::endl;
+            rep.end_group();
+        }
+    }
 }
 
-#ifdef BOOST_CHARCONV_HAS_STDFLOAT128
-template<> void test<std::float128_t>()
+template<class T> static void test( bench::reporter& rep, bench::options const& opt )
 {
-    std::vector<std::float128_t> data;
-    init_input_data( data );
-
-    test_std_to_chars( data, false, "scientific", 0 );
-    test_boost_to_chars( data, false, "scientific", 0 );
+    if( !bench::selected( opt.types, boost::core::type_name<T>() ) ) return;
 
-    std::cout << std::endl;
-
-    test_std_to_chars( data, false, "scientific", 6 );
-    test_boost_to_chars( data, false, "scientific", 6 );
+    std::vector<T> data;
 
-    std::cout << std::endl;
+    for( auto const& corpus: opt.corpora )
+    {
+        data.clear();
 
-    test_std_to_chars( data, true, "general", 0 );
-    test_boost_to_chars( data, true, "general", 0 );
+        for( auto const& x: bench::load_corpus( "to_chars_floating", corpus ) )
+        {
+            T y {};
+            boost::charconv::from_chars( x.data(), x.data() + x.size(), y );
+            data.push_back( y );
+        }
 
-    std::cout << std::endl;
+        test_data( rep, opt, data, 0, corpus );
+    }
 
-    test_std_to_chars( data, true, "general", 6 );
-    test_boost_to_chars( data, true, "general", 6 );
+    if( !opt.corpora.empty() ) return;
 
-    std::cout << std::endl;
+    for( int digits: bench::numbers( opt.digits, { 0 } ) )
+    {
+        init_input_data( data, opt.n, digits );
+        test_data( rep, opt, data, digits, "" );
+    }
 }
-#endif
 
-int main()
+int main( int argc, char const* argv[] )
 {
-    std::cout << BOOST_COMPILER << "\n";
-    std::cout << BOOST_STDLIB << "\n\n";
+    bench::options const opt = bench::parse_options( argc, argv );
+    bench::reporter rep( opt, "to_chars_floating" );
 
-    test<float>();
-    test<double>();
+    test<float>( rep, opt );
+    test<double>( rep, opt );
     #ifdef BOOST_CHARCONV_HAS_STDFLOAT128
-    test<std::float128_t>();
+    test<std::float128_t>( rep, opt );
     #endif
 }
@@ -1,39 +1,33 @@
 // Copyright 2023 Peter Dimov
 // Distributed under the Boost Software License, Version 1.0.
 // https://www.boost.org/LICENSE_1_0.txt
+//
+// to_chars for integral types against std::snprintf and std::to_chars.
+// See benchmark.hpp for the command line
 
-#include <boost/charconv/to_chars.hpp>
+#include "benchmark.hpp"
 #include <boost/core/type_name.hpp>
 #include <boost/core/detail/splitmix64.hpp>
-#include <boost/config.hpp>
 #include <type_traits>
-#include <chrono>
 #include <cstdio>
-#include <iostream>
-#include <iomanip>
+#include <vector>
 #include <charconv>
 
-constexpr unsigned N = 2'000'000;
-constexpr int K = 10;
-
-template<class T> static BOOST_NOINLINE void init_input_data( std::vector<T>& data )
+template<class T> static BOOST_NOINLINE void init_input_data( std::vector<T>& data, std::size_t n, int digits )
 {
-    data.reserve( N );
+    data.clear();
+    data.reserve( n );
 
     boost::detail::splitmix64 rng;
 
-    for( unsigned i = 0; i < N; ++i )
+    for( std::size_t i = 0; i < n; ++i )
     {
-        data.push_back( static_cast<T>( static_cast<typename std::make_unsigned<T>::type>( rng() ) ) );
+        data.push_back( bench::integer_with_digits<T>( rng(), digits ) );
     }
 }
 
-using namespace std::chrono_literals;
-
-template<class T> static BOOST_NOINLINE void test_snprintf( std::vector<T> const& data )
+template<class T> static BOOST_NOINLINE std::size_t test_snprintf( std::vector<T> const& data )
 {
-    auto t1 = std::chrono::steady_clock::now();
-
     std::size_t s = 0;
 
     char const* format = "%d";
@@ -63,98 +57,111 @@ template<class T> static BOOST_NOINLINE void test_snprintf( std::vector<T> const
         format = "%llu";
     }
 
-    for( int i = 0; i < K; ++i )
-    {
-        char buffer[ 22 ];
+    char buffer[ 22 ];
 
-        for( auto x: data )
-        {
-            auto r = std::snprintf( buffer, sizeof( buffer ), format, x );
-            s += r;
-            s += static_cast<unsigned char>( buffer[0] );
-        }
+    for( auto x: data )
+    {
+        auto r = std::snprintf( buffer, sizeof( buffer ), format, x );
+        s += static_cast<std::size_t>( r );
+        s += static_cast<unsigned char>( buffer[0] );
     }
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "            std::snprintf<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+    return s;
 }
 
-template<class T> static BOOST_NOINLINE void test_std_to_chars( std::vector<T> const& data )
+template<class T> static BOOST_NOINLINE std::size_t test_std_to_chars( std::vector<T> const& data )
 {
-    auto t1 = std::chrono::steady_clock::now();
-
     std::size_t s = 0;
 
-    for( int i = 0; i < K; ++i )
-    {
-        char buffer[ 21 ];
+    char buffer[ 21 ];
 
-        for( auto x: data )
-        {
-            auto r = std::to_chars( buffer, buffer + sizeof( buffer ), x );
-            s += static_cast<std::size_t>( r.ptr - buffer );
-            s += static_cast<unsigned char>( buffer[0] );
-        }
+    for( auto x: data )
+    {
+        auto r = std::to_chars( buffer, buffer + sizeof( buffer ), x );
+        s += static_cast<std::size_t>( r.ptr - buffer );
+        s += static_cast<unsigned char>( buffer[0] );
     }
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "            std::to_chars<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+    return s;
 }
 
-template<class T> static BOOST_NOINLINE void test_boost_to_chars( std::vector<T> const& data )
+template<class T> static BOOST_NOINLINE std::size_t test_boost_to_chars( std::vector<T> const& data )
 {
-    auto t1 = std::chrono::steady_clock::now();
-
     std::size_t s = 0;
 
-    for( int i = 0; i < K; ++i )
-    {
-        char buffer[ 21 ];
+    char buffer[ 21 ];
 
-        for( auto x: data )
-        {
-            auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
-            s += static_cast<std::size_t>( r.ptr - buffer );
-            s += static_cast<unsigned char>( buffer[0] );
-        }
+    for( auto x: data )
+    {
+        auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
+        s += static_cast<std::size_t>( r.ptr - buffer );
+        s += static_cast<unsigned char>( buffer[0] );
     }
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "boost::charconv::to_chars<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+    return s;
 }
 
-template<class T> static void test()
+template<class T> static void test( bench::reporter& rep, bench::options const& opt )
 {
+    if( !bench::selected( opt.types, boost::core::type_name<T>() ) ) return;
+
     std::vector<T> data;
-    init_input_data( data );
 
-    test_snprintf( data );
-    test_std_to_chars( data );
-    test_boost_to_chars( data );
+    for( int digits: bench::numbers( opt.digits, { 0 } ) )
+    {
+        if( digits > bench::max_digits<T>() ) continue;
 
-    std::cout << std::endl;
+        init_input_data( data, opt.n, digits );
+
+        bench::result info;
+        info.type = boost::core::type_name<T>();
+        info.format = "dec";
+        info.digits = digits;
+        info.values = data.size();
+        for( auto x: data ) info.bytes += boost::charconv::to_chars_length( x );
+
+        if( bench::selected( opt.impls, "libc" ) )
+        {
+            info.impl = "libc";
+            info.function = "std::snprintf";
+            bench::measure( rep, opt, info, [&]{ return test_snprintf( data ); } );
+        }
+
+        if( bench::selected( opt.impls, "std" ) )
+        {
+            info.impl = "std";
+            info.function = "std::to_chars";
+            bench::measure( rep, opt, info, [&]{ return test_std_to_chars( data ); } );
+        }
+
+        if( bench::selected( opt.impls, "boost" ) )
+        {
+            info.impl = "boost";
+            info.function = "boost::charconv::to_chars";
+            bench::measure( rep, opt, info, [&]{ return test_boost_to_chars( data ); } );
+        }
+
+        rep.end_group();
+    }
 }
 
-int main()
+int main( int argc, char const* argv[] )
 {
-    std::cout << BOOST_COMPILER << "\n";
-    std::cout << BOOST_STDLIB << "\n\n";
+    bench::options const opt = bench::parse_options( argc, argv );
+    bench::reporter rep( opt, "to_chars_integral" );
 
-    test<signed char>();
-    test<unsigned char>();
+    test<signed char>( rep, opt );
+    test<unsigned char>( rep, opt );
 
-    test<short>();
-    test<unsigned short>();
+    test<short>( rep, opt );
+    test<unsigned short>( rep, opt );
 
-    test<int>();
-    test<unsigned int>();
+    test<int>( rep, opt );
+    test<unsigned int>( rep, opt );
 
-    test<long>();
-    test<unsigned long>();
+    test<long>( rep, opt );
+    test<unsigned long>( rep, opt );
 
-    test<long long>();
-    test<unsigned long long>();
+    test<long long>( rep, opt );
+    test<unsigned long long>( rep, opt );
 }
@@ -8,5 +8,6 @@
 #include <boost/charconv/from_chars.hpp>
 #include <boost/charconv/to_chars.hpp>
 #include <boost/charconv/limits.hpp>
+#include <boost/charconv/slow_path_counters.hpp>
 
 #endif // #ifndef BOOST_CHARCONV_HPP_INCLUDED
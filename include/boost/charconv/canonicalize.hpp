@@ -0,0 +1,425 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_CANONICALIZE_HPP
+#define BOOST_CHARCONV_CANONICALIZE_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/parser.hpp>
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/detail/to_chars_integer_impl.hpp>
+#include <boost/charconv/detail/integer_search_trees.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <system_error>
+#include <type_traits>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost { namespace charconv {
+
+struct canonicalize_result
+{
+    // One past the end of the number in the input
+    const char* in_ptr;
+
+    // One past the end of the canonical form in the output
+    char* out_ptr;
+
+    std::errc ec;
+
+    friend constexpr bool operator==(const canonicalize_result& lhs, const canonicalize_result& rhs) noexcept
+    {
+        return lhs.in_ptr == rhs.in_ptr && lhs.out_ptr == rhs.out_ptr && lhs.ec == rhs.ec;
+    }
+
+    friend constexpr bool operator!=(const canonicalize_result& lhs, const canonicalize_result& rhs) noexcept
+    {
+        return !(lhs == rhs); // NOLINT : Expression can not be simplified since this is the definition
+    }
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
+namespace detail {
+
+// The value is d1.d2d3...dn * 10^exponent with the significant digits d1 to dn of the input, neither of the ends being zero.
+// Zero has no digits. The decimal point of the input can be between them, and otherwise dot is before or after them
+struct canonical_decimal
+{
+    bool negative;
+    const char* digits;
+    const char* dot;
+    std::size_t num_digits;
+    std::int64_t exponent;
+};
+
+// Splits the number in [first, last), which has the grammar of from_chars with chars_format::general, with the digit scanner of
+// the parser. Nothing is converted to an integer, so the digits are kept at every length and only the exponent is parsed.
+// Infinity and nan are std::errc::not_supported, since only a floating point type knows how to print them
+inline from_chars_result split_canonical_decimal(const char* first, const char* last, canonical_decimal& d) noexcept
+{
+    auto next = first;
+    d.negative = next != last && *next == '-';
+    next += static_cast<std::ptrdiff_t>(d.negative);
+    if (next != last && (*next == 'i' || *next == 'I' || *next == 'n' || *next == 'N'))
+    {
+        return {first, std::errc::not_supported};
+    }
+
+    const char* integer_first = next;
+    const char* integer_last = find_digit_run_end(next, last, false);
+    const char* fraction_first = integer_last;
+    const char* fraction_last = integer_last;
+    if (integer_last != last && *integer_last == '.')
+    {
+        fraction_first = integer_last + 1;
+        fraction_last = find_digit_run_end(fraction_first, last, false);
+    }
+    if (integer_first == integer_last && fraction_first == fraction_last)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+    next = fraction_last;
+
+    // An exponent character without digits is not part of the number
+    std::int64_t exponent = 0;
+    if (next != last && (*next == 'e' || *next == 'E'))
+    {
+        auto exponent_first = next + 1;
+        const bool exponent_negative = exponent_first != last && *exponent_first == '-';
+        if (exponent_first != last && (*exponent_first == '+' || *exponent_first == '-'))
+        {
+            ++exponent_first;
+        }
+
+        const char* exponent_last = find_digit_run_end(exponent_first, last, false);
+        if (exponent_first != exponent_last)
+        {
+            while (exponent_first != exponent_last && *exponent_first == '0')
+            {
+                ++exponent_first;
+            }
+            if (exponent_last - exponent_first > 18)
+            {
+                return {exponent_last, std::errc::result_out_of_range};
+            }
+
+            for (; exponent_first != exponent_last; ++exponent_first)
+            {
+                exponent = exponent * 10 + (*exponent_first - '0');
+            }
+            exponent = exponent_negative ? -exponent : exponent;
+            next = exponent_last;
+        }
+    }
+
+    // The first significant digit, and how many digits from it are in front of the decimal point
+    const char* digits = integer_first;
+    while (digits != integer_last && *digits == '0')
+    {
+        ++digits;
+    }
+    std::int64_t point = integer_last - digits;
+    if (digits == integer_last)
+    {
+        digits = fraction_first;
+        while (digits != fraction_last && *digits == '0')
+        {
+            ++digits;
+        }
+        point = fraction_first - digits;
+    }
+
+    d.digits = digits;
+    d.dot = integer_last;
+    if (digits == fraction_last)
+    {
+        d.num_digits = 0;
+        d.exponent = 0;
+        return {next, std::errc()};
+    }
+
+    // There is a digit other than zero, so this stops at it
+    const char* digits_last = fraction_first != fraction_last ? fraction_last : integer_last;
+    while (digits_last[-1] == '0' || digits_last[-1] == '.')
+    {
+        --digits_last;
+    }
+
+    d.num_digits = static_cast<std::size_t>(digits_last - digits) - static_cast<std::size_t>(digits < integer_last && digits_last > fraction_first);
+    d.exponent = point - 1 + exponent;
+    return {next, std::errc()};
+}
+
+// Copies count digits, skipping the decimal point of the input
+inline char* copy_canonical_digits(char* first, const char*& digits, const char* dot, std::size_t count) noexcept
+{
+    if (digits < dot)
+    {
+        const auto before = static_cast<std::size_t>(dot - digits) < count ? static_cast<std::size_t>(dot - digits) : count;
+        std::memcpy(first, digits, before);
+        first += before;
+        digits += before;
+        count -= before;
+    }
+    if (count != 0 && digits == dot)
+    {
+        ++digits;
+    }
+
+    std::memcpy(first, digits, count);
+    digits += count;
+    return first + count;
+}
+
+inline std::int64_t canonical_exponent_digits(std::int64_t exponent) noexcept
+{
+    const auto abs_exponent = static_cast<std::uint64_t>(exponent < 0 ? -exponent : exponent);
+    return abs_exponent < 100 ? 2 : num_digits(abs_exponent);
+}
+
+inline std::int64_t canonical_fixed_length(const canonical_decimal& d) noexcept
+{
+    const auto n = static_cast<std::int64_t>(d.num_digits);
+    if (d.exponent < 0)
+    {
+        // "0." and the zeros in front of the digits
+        return static_cast<std::int64_t>(d.negative) + 1 - d.exponent + n;
+    }
+
+    const std::int64_t integer_digits = d.exponent + 1;
+    return static_cast<std::int64_t>(d.negative) + (n > integer_digits ? n + 1 : integer_digits);
+}
+
+inline std::int64_t canonical_scientific_length(const canonical_decimal& d) noexcept
+{
+    const auto n = static_cast<std::int64_t>(d.num_digits);
+    return static_cast<std::int64_t>(d.negative) + n + static_cast<std::int64_t>(n > 1) + 2 + canonical_exponent_digits(d.exponent);
+}
+
+inline to_chars_result to_chars_canonical_fixed(char* first, char* last, const canonical_decimal& d) noexcept
+{
+    if (canonical_fixed_length(d) > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (d.negative)
+    {
+        *first++ = '-';
+    }
+
+    const char* digits = d.digits;
+    if (d.exponent < 0)
+    {
+        *first++ = '0';
+        *first++ = '.';
+        std::memset(first, '0', static_cast<std::size_t>(-d.exponent - 1));
+        first += -d.exponent - 1;
+        return {copy_canonical_digits(first, digits, d.dot, d.num_digits), std::errc()};
+    }
+
+    const auto integer_digits = static_cast<std::size_t>(d.exponent) + 1U;
+    if (d.num_digits <= integer_digits)
+    {
+        first = copy_canonical_digits(first, digits, d.dot, d.num_digits);
+        std::memset(first, '0', integer_digits - d.num_digits);
+        return {first + (integer_digits - d.num_digits), std::errc()};
+    }
+
+    first = copy_canonical_digits(first, digits, d.dot, integer_digits);
+    *first++ = '.';
+    return {copy_canonical_digits(first, digits, d.dot, d.num_digits - integer_digits), std::errc()};
+}
+
+// d1.d2d3...dn followed by an exponent of at least two digits, like to_chars with chars_format::scientific
+inline to_chars_result to_chars_canonical_scientific(char* first, char* last, const canonical_decimal& d) noexcept
+{
+    if (canonical_scientific_length(d) > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (d.negative)
+    {
+        *first++ = '-';
+    }
+
+    const char* digits = d.digits;
+    first = copy_canonical_digits(first, digits, d.dot, 1);
+    if (d.num_digits > 1)
+    {
+        *first++ = '.';
+        first = copy_canonical_digits(first, digits, d.dot, d.num_digits - 1);
+    }
+
+    *first++ = 'e';
+    *first++ = d.exponent < 0 ? '-' : '+';
+    const auto abs_exponent = static_cast<std::uint64_t>(d.exponent < 0 ? -d.exponent : d.exponent);
+    if (abs_exponent < 10)
+    {
+        *first++ = '0';
+    }
+
+    return to_chars_integer_impl(first, last, abs_exponent);
+}
+
+// Zero is "0" in fixed and general format and "0e+00" in scientific format, like the output of to_chars
+inline to_chars_result to_chars_canonical_zero(char* first, char* last, bool negative, chars_format fmt) noexcept
+{
+    const std::ptrdiff_t length = static_cast<std::ptrdiff_t>(negative) + (fmt == chars_format::scientific ? 5 : 1);
+    if (length > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (negative)
+    {
+        *first++ = '-';
+    }
+    std::memcpy(first, "0e+00", static_cast<std::size_t>(length - static_cast<std::ptrdiff_t>(negative))); // NOLINT : No null terminator is purposeful
+    return {first + (length - static_cast<std::ptrdiff_t>(negative)), std::errc()};
+}
+
+// Whatever is shorter in general format, and fixed format on a tie
+inline to_chars_result to_chars_canonical(char* first, char* last, const canonical_decimal& d, chars_format fmt) noexcept
+{
+    if (d.num_digits == 0)
+    {
+        return to_chars_canonical_zero(first, last, d.negative, fmt);
+    }
+    if (fmt == chars_format::fixed || (fmt == chars_format::general && canonical_fixed_length(d) <= canonical_scientific_length(d)))
+    {
+        return to_chars_canonical_fixed(first, last, d);
+    }
+
+    return to_chars_canonical_scientific(first, last, d);
+}
+
+// A decimal of at most digits10 digits in the normal range of Real is the only one of at most that many digits that rounds
+// to its value, so it is already the shortest representation that Dragonbox would find. From 10^16 (10^7 for float) up to 2^64
+// (2^32) to_chars prints the integer of the binary value instead, so these values take the round trip as well
+template <typename Real>
+bool is_canonical_shortest(const canonical_decimal& d) noexcept
+{
+    constexpr std::int64_t fixed_limit = std::is_same<Real, double>::value ? 16 : 7;
+    constexpr std::int64_t integer_limit = std::is_same<Real, double>::value ? 20 : 10;
+
+    return d.num_digits == 0 ||
+           (d.num_digits <= static_cast<std::size_t>(std::numeric_limits<Real>::digits10) &&
+            d.exponent > std::numeric_limits<Real>::min_exponent10 && d.exponent < std::numeric_limits<Real>::max_exponent10 &&
+            (d.exponent < fixed_limit || d.exponent >= integer_limit));
+}
+
+inline bool is_canonical_format(chars_format fmt) noexcept
+{
+    return fmt == chars_format::general || fmt == chars_format::fixed || fmt == chars_format::scientific;
+}
+
+template <typename Real>
+canonicalize_result canonicalize_round_trip(const char* first, const char* last, char* out_first, char* out_last, chars_format fmt) noexcept
+{
+    Real value {};
+    const auto fr = boost::charconv::from_chars(first, last, value);
+    if (!fr)
+    {
+        return {fr.ptr, out_first, fr.ec};
+    }
+
+    const auto r = boost::charconv::to_chars(out_first, out_last, value, fmt);
+    return {fr.ptr, r.ptr, r.ec};
+}
+
+inline canonicalize_result canonicalize_number_impl(const char* first, const char* last, char* out_first, char* out_last, chars_format fmt) noexcept
+{
+    if (!is_canonical_format(fmt))
+    {
+        return {first, out_first, std::errc::invalid_argument};
+    }
+
+    canonical_decimal d;
+    const auto r = split_canonical_decimal(first, last, d);
+    if (r.ec == std::errc::not_supported)
+    {
+        return canonicalize_round_trip<double>(first, last, out_first, out_last, fmt);
+    }
+    else if (r.ec != std::errc())
+    {
+        return {r.ptr, out_first, r.ec};
+    }
+
+    const auto tr = to_chars_canonical(out_first, out_last, d, fmt);
+    return {r.ptr, tr.ptr, tr.ec};
+}
+
+template <typename Real>
+canonicalize_result canonicalize_number_impl(const char* first, const char* last, char* out_first, char* out_last, chars_format fmt) noexcept
+{
+    static_assert(std::is_same<Real, float>::value || std::is_same<Real, double>::value, "Real must be float or double");
+
+    canonical_decimal d;
+    const auto r = split_canonical_decimal(first, last, d);
+    if (r.ec != std::errc() || !is_canonical_format(fmt) || !is_canonical_shortest<Real>(d))
+    {
+        return canonicalize_round_trip<Real>(first, last, out_first, out_last, fmt);
+    }
+
+    // Like to_chars, general format is fixed from 1 up to fixed_limit, and scientific otherwise
+    if (fmt == chars_format::general)
+    {
+        constexpr std::int64_t fixed_limit = std::is_same<Real, double>::value ? 16 : 7;
+        fmt = d.exponent >= 0 && d.exponent < fixed_limit ? chars_format::fixed : chars_format::scientific;
+    }
+
+    const auto tr = d.num_digits == 0 ? to_chars_canonical_zero(out_first, out_last, d.negative, fmt) :
+                    fmt == chars_format::fixed ? to_chars_canonical_fixed(out_first, out_last, d) :
+                                                 to_chars_canonical_scientific(out_first, out_last, d);
+    return {r.ptr, tr.ptr, tr.ec};
+}
+
+} // namespace detail
+
+// Rewrites the number in [first, last) in its canonical form, e.g. "001.500E+01" as "15": the significant digits without
+// leading or trailing zeros, in fixed or scientific format, or in general format whichever of the two is shorter.
+// The digits are those of the input at any length, and nothing goes through a floating point type.
+// The input has the grammar of from_chars with chars_format::general; infinity and nan are written as by to_chars
+
+inline canonicalize_result canonicalize_number(const char* first, const char* last, char* out_first, char* out_last,
+                                               chars_format fmt = chars_format::general) noexcept
+{
+    return detail::canonicalize_number_impl(first, last, out_first, out_last, fmt);
+}
+
+inline canonicalize_result canonicalize_number(boost::core::string_view sv, char* out_first, char* out_last,
+                                               chars_format fmt = chars_format::general) noexcept
+{
+    return detail::canonicalize_number_impl(sv.data(), sv.data() + sv.size(), out_first, out_last, fmt);
+}
+
+// Writes the shortest representation of the Real nearest to the number, the same as from_chars followed by to_chars.
+// Short decimals in the normal range are already that representation and are rewritten like above,
+// and only the others are converted to Real and back
+
+template <typename Real>
+canonicalize_result canonicalize_number(const char* first, const char* last, char* out_first, char* out_last,
+                                        chars_format fmt = chars_format::general) noexcept
+{
+    return detail::canonicalize_number_impl<Real>(first, last, out_first, out_last, fmt);
+}
+
+template <typename Real>
+canonicalize_result canonicalize_number(boost::core::string_view sv, char* out_first, char* out_last,
+                                        chars_format fmt = chars_format::general) noexcept
+{
+    return detail::canonicalize_number_impl<Real>(sv.data(), sv.data() + sv.size(), out_first, out_last, fmt);
+}
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_CANONICALIZE_HPP
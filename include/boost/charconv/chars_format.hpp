@@ -8,15 +8,81 @@
 namespace boost { namespace charconv {
 
 // Floating-point format for primitive numerical conversion
-// chars_format is a bitmask type (16.3.3.3.3)
+// chars_format is a bitmask type (16.3.3.3.3).
+// engineering is scientific notation with an exponent that is a multiple of 3, and parses like scientific
 enum class chars_format : unsigned
 {
     scientific = 1 << 0,
     fixed = 1 << 1,
     hex = 1 << 2,
-    general = fixed | scientific
+    general = fixed | scientific,
+    engineering = scientific | (1 << 3)
 };
 
+// Punctuation of the floating point formats, set per call instead of taken from the global locale.
+// The decimal point is used by every format and the exponent character by the decimal ones (hex always uses 'p').
+// from_chars accepts a letter as exponent character in either case, like 'e' and 'E' by default.
+// A group separator other than '\0' is written between every three digits of the integer part of decimal output,
+// and from_chars skips it wherever it stands between two digits of the integer part
+struct chars_format_options
+{
+    char decimal_point = '.';
+    char exponent = 'e';
+    char group_separator = '\0';
+
+    constexpr chars_format_options() noexcept = default;
+    explicit constexpr chars_format_options(char decimal_point_, char exponent_ = 'e', char group_separator_ = '\0') noexcept
+        : decimal_point(decimal_point_), exponent(exponent_), group_separator(group_separator_) {}
+};
+
+// Direction in which a conversion rounds a value that the result can not hold exactly, named like std::float_round_style.
+// to_nearest breaks ties to even. The rounding mode of the floating point environment is never used
+enum class rounding_mode : unsigned
+{
+    to_nearest,
+    toward_zero,
+    toward_infinity,
+    toward_neg_infinity
+};
+
+namespace detail {
+
+// Whether a magnitude between two representable ones goes to the larger of the two in a directed mode
+constexpr bool rounds_magnitude_up(rounding_mode mode, bool is_negative) noexcept
+{
+    return mode == rounding_mode::toward_infinity ? !is_negative : mode == rounding_mode::toward_neg_infinity && is_negative;
+}
+
+constexpr bool is_number_char(char c) noexcept
+{
+    return (c >= '0' && c <= '9') || c == '+' || c == '-';
+}
+
+constexpr char to_lower_ascii(char c) noexcept
+{
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+// The decimal point can not be a letter because of the hexadecimal digits, neither character can be part of a number,
+// and the two have to be told apart. The same goes for a group separator, which can not be a letter either
+constexpr bool is_valid_group_separator(chars_format_options options) noexcept
+{
+    return options.group_separator == '\0' ||
+           (!is_number_char(options.group_separator) &&
+            !(to_lower_ascii(options.group_separator) >= 'a' && to_lower_ascii(options.group_separator) <= 'z') &&
+            options.group_separator != options.decimal_point && options.group_separator != options.exponent);
+}
+
+constexpr bool is_valid_format_options(chars_format_options options) noexcept
+{
+    return !is_number_char(options.decimal_point) && !is_number_char(options.exponent) &&
+           !(to_lower_ascii(options.decimal_point) >= 'a' && to_lower_ascii(options.decimal_point) <= 'z') &&
+           to_lower_ascii(options.decimal_point) != to_lower_ascii(options.exponent) &&
+           is_valid_group_separator(options);
+}
+
+} // namespace detail
+
 }} // Namespaces
 
 #endif // BOOST_CHARCONV_CHARS_FORMAT_HPP
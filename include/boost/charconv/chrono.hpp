@@ -0,0 +1,517 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_CHRONO_HPP
+#define BOOST_CHARCONV_CHRONO_HPP
+
+// to_chars and from_chars of std::chrono::system_clock time points as ISO 8601 UTC timestamps, e.g.
+// "2026-10-14T12:34:56.123456789Z", or as the number of nanoseconds since the epoch, and of durations as a number of
+// nanoseconds. The layout of a timestamp is fixed by the Duration of the time point, so the digits of every field are
+// written from the digit pair table and read with SWAR checks of two words instead of one conversion per field
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/to_chars_integer_impl.hpp>
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/swar.hpp>
+#include <boost/charconv/integer.hpp>
+#include <system_error>
+#include <type_traits>
+#include <ratio>
+#include <chrono>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+
+namespace boost { namespace charconv {
+
+enum class timestamp_format : unsigned
+{
+    // YYYY-MM-DDTHH:MM:SS, a fraction of a second with the digits of the Duration, and Z
+    iso8601,
+
+    // The number of nanoseconds since 1970-01-01T00:00:00Z
+    epoch_nanoseconds
+};
+
+namespace detail {
+
+#ifdef BOOST_MSVC
+# pragma warning(push)
+# pragma warning(disable: 4127) // Conditional expression is constant (BOOST_IF_CONSTEXPR in pre-C++17 modes)
+#endif
+
+template <typename Rep, typename Period>
+struct chrono_duration_traits
+{
+    static_assert(std::is_integral<Rep>::value && std::is_signed<Rep>::value && sizeof(Rep) <= sizeof(std::int64_t),
+                  "The representation of the duration has to be a signed integer of up to 64 bits");
+    static_assert(Period::num == 1 || Period::den == 1, "The period has to be a whole number of seconds or one over a whole number of seconds");
+    static_assert(Period::den == 1 || UINT64_C(1000000000) % static_cast<std::uint64_t>(Period::den) == 0 ||
+                  static_cast<std::uint64_t>(Period::den) % UINT64_C(1000000000) == 0,
+                  "A fraction of a second has to divide a nanosecond, or be a multiple of one");
+
+    static constexpr std::int64_t seconds_per_tick = Period::den == 1 ? static_cast<std::int64_t>(Period::num) : 0;
+    static constexpr std::int64_t ticks_per_second = Period::den == 1 ? 1 : static_cast<std::int64_t>(Period::den);
+
+    static constexpr std::int64_t max_ticks = static_cast<std::int64_t>((std::numeric_limits<Rep>::max)());
+    static constexpr std::int64_t min_ticks = static_cast<std::int64_t>((std::numeric_limits<Rep>::min)());
+};
+
+constexpr int chrono_fraction_digits(std::int64_t ticks_per_second, std::int64_t power = 1, int digits = 0) noexcept
+{
+    return ticks_per_second == 1 ? 0 :
+           power == ticks_per_second ? digits :
+           power > ticks_per_second / 10 ? -1 : chrono_fraction_digits(ticks_per_second, power * 10, digits + 1);
+}
+
+BOOST_CHARCONV_CXX14_CONSTEXPR std::int64_t floor_div(std::int64_t a, std::int64_t b) noexcept
+{
+    const std::int64_t q = a / b;
+    return q - static_cast<std::int64_t>((a % b != 0) && ((a < 0) != (b < 0)));
+}
+
+// Multiplies by a positive b without overflow, or returns false
+inline bool checked_multiply(std::int64_t a, std::int64_t b, std::int64_t& result) noexcept
+{
+    if (a > 0 ? a > INT64_MAX / b : a < INT64_MIN / b)
+    {
+        return false;
+    }
+
+    result = a * b;
+    return true;
+}
+
+// The nanoseconds of a number of ticks, and the floor of the ticks of a number of nanoseconds
+template <typename Rep, typename Period>
+bool ticks_to_nanoseconds(std::int64_t ticks, std::int64_t& nanoseconds) noexcept
+{
+    using traits = chrono_duration_traits<Rep, Period>;
+    BOOST_IF_CONSTEXPR (traits::seconds_per_tick != 0)
+    {
+        return checked_multiply(ticks, traits::seconds_per_tick * 1000000000, nanoseconds);
+    }
+    else BOOST_IF_CONSTEXPR (traits::ticks_per_second <= 1000000000)
+    {
+        return checked_multiply(ticks, 1000000000 / traits::ticks_per_second, nanoseconds);
+    }
+    else
+    {
+        nanoseconds = floor_div(ticks, traits::ticks_per_second / 1000000000);
+        return true;
+    }
+}
+
+template <typename Rep, typename Period>
+bool nanoseconds_to_ticks(std::int64_t nanoseconds, std::int64_t& ticks) noexcept
+{
+    using traits = chrono_duration_traits<Rep, Period>;
+    BOOST_IF_CONSTEXPR (traits::seconds_per_tick != 0)
+    {
+        ticks = floor_div(nanoseconds, traits::seconds_per_tick * 1000000000);
+    }
+    else BOOST_IF_CONSTEXPR (traits::ticks_per_second <= 1000000000)
+    {
+        ticks = floor_div(nanoseconds, 1000000000 / traits::ticks_per_second);
+    }
+    else if (!checked_multiply(nanoseconds, traits::ticks_per_second / 1000000000, ticks))
+    {
+        return false;
+    }
+
+    return ticks >= traits::min_ticks && ticks <= traits::max_ticks;
+}
+
+// The seconds of 0000-01-01T00:00:00Z and 9999-12-31T23:59:59Z since the epoch
+constexpr std::int64_t iso8601_min_seconds = INT64_C(-62167219200);
+constexpr std::int64_t iso8601_max_seconds = INT64_C(253402300799);
+
+// Days since the epoch of a proleptic Gregorian date and back, in eras of 400 years
+// See: https://howardhinnant.github.io/date_algorithms.html
+BOOST_CHARCONV_CXX14_CONSTEXPR std::int64_t days_from_civil(std::int64_t year, unsigned month, unsigned day) noexcept
+{
+    year -= static_cast<std::int64_t>(month <= 2);
+    const std::int64_t era = floor_div(year, 400);
+    const auto year_of_era = static_cast<unsigned>(year - era * 400);
+    const unsigned day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const unsigned day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + static_cast<std::int64_t>(day_of_era) - 719468;
+}
+
+struct civil_date
+{
+    std::int64_t year;
+    unsigned month;
+    unsigned day;
+};
+
+BOOST_CHARCONV_CXX14_CONSTEXPR civil_date civil_from_days(std::int64_t days) noexcept
+{
+    days += 719468;
+    const std::int64_t era = floor_div(days, 146097);
+    const auto day_of_era = static_cast<unsigned>(days - era * 146097);
+    const unsigned year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    const unsigned day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    const unsigned mp = (5 * day_of_year + 2) / 153;
+    const unsigned month = mp < 10 ? mp + 3 : mp - 9;
+    return {static_cast<std::int64_t>(year_of_era) + era * 400 + static_cast<std::int64_t>(month <= 2), month, day_of_year - (153 * mp + 2) / 5 + 1};
+}
+
+BOOST_FORCEINLINE void write_two_digits(char* first, std::uint32_t value) noexcept
+{
+    std::memcpy(first, radix_table() + value * 2, 2);
+}
+
+// Writes value < 10^Digits with leading zeros
+template <int Digits>
+BOOST_FORCEINLINE void write_fixed_digits(char* first, std::uint64_t value) noexcept
+{
+    for (int i = Digits; i >= 2; i -= 2)
+    {
+        write_two_digits(first + i - 2, static_cast<std::uint32_t>(value % 100));
+        value /= 100;
+    }
+
+    BOOST_IF_CONSTEXPR (Digits % 2 != 0)
+    {
+        *first = static_cast<char>('0' + value);
+    }
+}
+
+template <int Fraction_Digits>
+to_chars_result to_chars_iso8601(char* first, char* last, std::int64_t seconds, std::uint64_t fraction) noexcept
+{
+    constexpr std::ptrdiff_t length = 20 + (Fraction_Digits > 0 ? Fraction_Digits + 1 : 0);
+    if (seconds < iso8601_min_seconds || seconds > iso8601_max_seconds)
+    {
+        return {last, std::errc::value_too_large};
+    }
+    if (last - first < length)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    const std::int64_t days = floor_div(seconds, 86400);
+    const auto second_of_day = static_cast<std::uint32_t>(seconds - days * 86400);
+    const auto date = civil_from_days(days);
+    const auto year = static_cast<std::uint32_t>(date.year);
+
+    write_two_digits(first, year / 100);
+    write_two_digits(first + 2, year % 100);
+    first[4] = '-';
+    write_two_digits(first + 5, date.month);
+    first[7] = '-';
+    write_two_digits(first + 8, date.day);
+    first[10] = 'T';
+    write_two_digits(first + 11, second_of_day / 3600);
+    first[13] = ':';
+    write_two_digits(first + 14, second_of_day / 60 % 60);
+    first[16] = ':';
+    write_two_digits(first + 17, second_of_day % 60);
+
+    BOOST_IF_CONSTEXPR (Fraction_Digits > 0)
+    {
+        first[19] = '.';
+        write_fixed_digits<(Fraction_Digits > 0 ? Fraction_Digits : 1)>(first + 20, fraction);
+    }
+
+    first[length - 1] = 'Z';
+    return {first + length, std::errc()};
+}
+
+template <typename Rep, typename Period>
+to_chars_result to_chars_iso8601(char* first, char* last, std::int64_t ticks) noexcept
+{
+    using traits = chrono_duration_traits<Rep, Period>;
+    constexpr int digits = chrono_fraction_digits(traits::ticks_per_second);
+
+    BOOST_IF_CONSTEXPR (traits::seconds_per_tick != 0)
+    {
+        // No time point of such a duration has a year of 4 digits if the multiplication overflows
+        std::int64_t seconds {};
+        if (!checked_multiply(ticks, traits::seconds_per_tick, seconds))
+        {
+            return {last, std::errc::value_too_large};
+        }
+        return to_chars_iso8601<0>(first, last, seconds, 0);
+    }
+    else BOOST_IF_CONSTEXPR (digits >= 0)
+    {
+        const std::int64_t seconds = floor_div(ticks, traits::ticks_per_second);
+        return to_chars_iso8601<(digits >= 0 ? digits : 0)>(first, last, seconds, static_cast<std::uint64_t>(ticks - seconds * traits::ticks_per_second));
+    }
+    else
+    {
+        // Fractions that are not a power of ten, e.g. 1/2 s, are written in nanoseconds
+        const std::int64_t seconds = floor_div(ticks, traits::ticks_per_second);
+        const auto sub = static_cast<std::uint64_t>(ticks - seconds * traits::ticks_per_second);
+        constexpr std::uint64_t nanoseconds_per_tick = traits::ticks_per_second <= 1000000000 ? 1000000000 / traits::ticks_per_second : 1;
+        constexpr std::uint64_t ticks_per_nanosecond = traits::ticks_per_second <= 1000000000 ? 1 : traits::ticks_per_second / 1000000000;
+        const std::uint64_t fraction = sub * nanoseconds_per_tick / ticks_per_nanosecond;
+        return to_chars_iso8601<9>(first, last, seconds, fraction);
+    }
+}
+
+BOOST_FORCEINLINE bool is_chrono_digit(char c) noexcept
+{
+    return static_cast<unsigned char>(c - '0') <= 9;
+}
+
+// The two digit values of the bytes at even positions of word, whose digits are selected by mask
+BOOST_FORCEINLINE std::uint64_t swar_digit_pairs(std::uint64_t word, std::uint64_t digits_mask) noexcept
+{
+    const std::uint64_t values = (word & digits_mask) - (UINT64_C(0x3030303030303030) & digits_mask);
+    return values * 10 + (values >> 8);
+}
+
+inline from_chars_result from_chars_iso8601(const char* first, const char* last, std::int64_t& seconds, std::uint64_t& nanoseconds) noexcept
+{
+    // YYYY-MM-DDTHH:MM:SS is 19 characters, read as the words YYYY-MM- and DDTHH:MM and the last 8 from HH:MM:SS
+    if (last - first < 20)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    const std::uint64_t date = swar_load8(first);
+    const std::uint64_t mid = swar_load8(first + 8);
+    const std::uint64_t time = swar_load8(first + 11);
+
+    // The digits of YYYY-MM- and HH:MM:SS are masked with the separators that have to be between them,
+    // and DDTHH:MM only needs its digits checked since the colon after HH is in the last word
+    constexpr std::uint64_t date_digits = UINT64_C(0x00FFFF00FFFFFFFF);
+    constexpr std::uint64_t date_separators = UINT64_C(0x2D00002D00000000);
+    constexpr std::uint64_t day_hour_minute_digits = UINT64_C(0xFFFF00FFFF00FFFF);
+    constexpr std::uint64_t time_digits = UINT64_C(0xFFFF00FFFF00FFFF);
+    constexpr std::uint64_t time_separators = UINT64_C(0x00003A00003A0000);
+    const char date_time_separator = first[10];
+
+    constexpr std::uint64_t high_bits = UINT64_C(0x8080808080808080);
+    const bool digits_valid = ((swar_bytes_in_range(date, '0', '9') | ~date_digits) & high_bits) == high_bits &&
+                              ((swar_bytes_in_range(mid, '0', '9') | ~day_hour_minute_digits) & high_bits) == high_bits &&
+                              ((swar_bytes_in_range(time, '0', '9') | ~time_digits) & high_bits) == high_bits;
+    const bool separators_valid = (date & ~date_digits) == date_separators && (time & ~time_digits) == time_separators &&
+                                  (date_time_separator == 'T' || date_time_separator == 't' || date_time_separator == ' ');
+    if (BOOST_UNLIKELY(!digits_valid || !separators_valid))
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    const std::uint64_t date_pairs = swar_digit_pairs(date, date_digits);
+    const std::uint64_t mid_pairs = swar_digit_pairs(mid, day_hour_minute_digits);
+    const std::uint64_t time_pairs = swar_digit_pairs(time, time_digits);
+
+    const auto year = static_cast<std::int64_t>((date_pairs & 0xFF) * 100 + ((date_pairs >> 16) & 0xFF));
+    const auto month = static_cast<unsigned>((date_pairs >> 40) & 0xFF);
+    const auto day = static_cast<unsigned>(mid_pairs & 0xFF);
+    const auto hour = static_cast<unsigned>((mid_pairs >> 24) & 0xFF);
+    const auto minute = static_cast<unsigned>((mid_pairs >> 48) & 0xFF);
+    const auto second = static_cast<unsigned>((time_pairs >> 48) & 0xFF);
+
+    constexpr unsigned char days_in_month[] = {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    const bool leap_year = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+    if (month - 1 >= 12 || day - 1 >= days_in_month[(month - 1) % 12] || (month == 2 && day == 29 && !leap_year) ||
+        hour > 23 || minute > 59 || second > 59)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    const char* next = first + 19;
+
+    // Any number of fraction digits, of which the first 9 are kept
+    nanoseconds = 0;
+    if (*next == '.' || *next == ',')
+    {
+        const char* const fraction_first = ++next;
+        int digits = 0;
+        if (last - next >= 8 && swar_is_eight_digits(swar_load8(next)))
+        {
+            nanoseconds = swar_parse_eight_digits(swar_load8(next));
+            next += 8;
+            digits = 8;
+        }
+        while (next != last && is_chrono_digit(*next))
+        {
+            if (digits < 9)
+            {
+                nanoseconds = nanoseconds * 10 + static_cast<std::uint64_t>(*next - '0');
+                ++digits;
+            }
+            ++next;
+        }
+
+        if (next == fraction_first)
+        {
+            return {first, std::errc::invalid_argument};
+        }
+
+        for (; digits < 9; ++digits)
+        {
+            nanoseconds *= 10;
+        }
+    }
+
+    // Z, or the offset from UTC as +HH:MM or -HH:MM
+    std::int64_t offset = 0;
+    if (next != last && (*next == 'Z' || *next == 'z'))
+    {
+        ++next;
+    }
+    else if (last - next >= 6 && (*next == '+' || *next == '-') && is_chrono_digit(next[1]) && is_chrono_digit(next[2]) &&
+             next[3] == ':' && is_chrono_digit(next[4]) && is_chrono_digit(next[5]))
+    {
+        const int offset_hours = (next[1] - '0') * 10 + (next[2] - '0');
+        const int offset_minutes = (next[4] - '0') * 10 + (next[5] - '0');
+        if (offset_hours > 23 || offset_minutes > 59)
+        {
+            return {first, std::errc::invalid_argument};
+        }
+
+        offset = (*next == '+' ? 1 : -1) * static_cast<std::int64_t>(offset_hours * 3600 + offset_minutes * 60);
+        next += 6;
+    }
+    else
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    seconds = days_from_civil(year, month, day) * 86400 + static_cast<std::int64_t>(hour * 3600 + minute * 60 + second) - offset;
+    return {next, std::errc()};
+}
+
+template <typename Rep, typename Period>
+from_chars_result from_chars_iso8601(const char* first, const char* last, std::int64_t& ticks) noexcept
+{
+    using traits = chrono_duration_traits<Rep, Period>;
+
+    std::int64_t seconds {};
+    std::uint64_t nanoseconds {};
+    const auto r = from_chars_iso8601(first, last, seconds, nanoseconds);
+    if (!r)
+    {
+        return r;
+    }
+
+    // The fraction is less than a second, so it only adds to the ticks of durations that are shorter
+    BOOST_IF_CONSTEXPR (traits::seconds_per_tick != 0)
+    {
+        ticks = floor_div(seconds, traits::seconds_per_tick);
+        if (ticks < traits::min_ticks || ticks > traits::max_ticks)
+        {
+            return {first, std::errc::result_out_of_range};
+        }
+    }
+    else
+    {
+        std::int64_t fraction_ticks {};
+        if (!checked_multiply(seconds, traits::ticks_per_second, ticks) ||
+            !nanoseconds_to_ticks<std::int64_t, Period>(static_cast<std::int64_t>(nanoseconds), fraction_ticks) ||
+            ticks > traits::max_ticks - fraction_ticks || (ticks += fraction_ticks) < traits::min_ticks)
+        {
+            return {first, std::errc::result_out_of_range};
+        }
+    }
+
+    return r;
+}
+
+template <typename Rep, typename Period>
+to_chars_result to_chars_chrono_nanoseconds(char* first, char* last, std::int64_t ticks) noexcept
+{
+    std::int64_t nanoseconds {};
+    if (!ticks_to_nanoseconds<Rep, Period>(ticks, nanoseconds))
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    return boost::charconv::to_chars(first, last, nanoseconds);
+}
+
+template <typename Rep, typename Period>
+from_chars_result from_chars_chrono_nanoseconds(const char* first, const char* last, std::int64_t& ticks) noexcept
+{
+    std::int64_t nanoseconds {};
+    const auto r = boost::charconv::from_chars(first, last, nanoseconds);
+    if (r && !nanoseconds_to_ticks<Rep, Period>(nanoseconds, ticks))
+    {
+        return {r.ptr, std::errc::result_out_of_range};
+    }
+
+    return r;
+}
+
+#ifdef BOOST_MSVC
+# pragma warning(pop)
+#endif
+
+} // namespace detail
+
+// Writes value as an ISO 8601 timestamp in UTC, with as many fraction digits as the Duration has (none for seconds,
+// 3 for milliseconds, 6 for microseconds and 9 for nanoseconds), or as the number of nanoseconds since the epoch.
+// Timestamps before the year 0 or after 9999, and nanoseconds that do not fit into 64 bits, return std::errc::value_too_large
+template <typename Duration>
+to_chars_result to_chars(char* first, char* last, std::chrono::time_point<std::chrono::system_clock, Duration> value,
+                         timestamp_format fmt = timestamp_format::iso8601) noexcept
+{
+    const auto ticks = static_cast<std::int64_t>(value.time_since_epoch().count());
+    return fmt == timestamp_format::iso8601 ?
+           detail::to_chars_iso8601<typename Duration::rep, typename Duration::period>(first, last, ticks) :
+           detail::to_chars_chrono_nanoseconds<typename Duration::rep, typename Duration::period>(first, last, ticks);
+}
+
+// Writes value as a number of nanoseconds
+template <typename Rep, typename Period>
+to_chars_result to_chars(char* first, char* last, std::chrono::duration<Rep, Period> value) noexcept
+{
+    return detail::to_chars_chrono_nanoseconds<Rep, Period>(first, last, static_cast<std::int64_t>(value.count()));
+}
+
+// Reads YYYY-MM-DDTHH:MM:SS, an optional fraction of any length and Z or an offset from UTC as +HH:MM or -HH:MM,
+// or a number of nanoseconds since the epoch. A time that falls between two ticks of Duration is rounded down
+template <typename Duration>
+from_chars_result from_chars(const char* first, const char* last, std::chrono::time_point<std::chrono::system_clock, Duration>& value,
+                             timestamp_format fmt = timestamp_format::iso8601) noexcept
+{
+    std::int64_t ticks {};
+    const auto r = fmt == timestamp_format::iso8601 ?
+                   detail::from_chars_iso8601<typename Duration::rep, typename Duration::period>(first, last, ticks) :
+                   detail::from_chars_chrono_nanoseconds<typename Duration::rep, typename Duration::period>(first, last, ticks);
+    if (r)
+    {
+        value = std::chrono::time_point<std::chrono::system_clock, Duration>(Duration(static_cast<typename Duration::rep>(ticks)));
+    }
+
+    return r;
+}
+
+template <typename Duration>
+from_chars_result from_chars(boost::core::string_view sv, std::chrono::time_point<std::chrono::system_clock, Duration>& value,
+                             timestamp_format fmt = timestamp_format::iso8601) noexcept
+{
+    return boost::charconv::from_chars(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+
+// Reads a number of nanoseconds, rounded down to the ticks of the duration
+template <typename Rep, typename Period>
+from_chars_result from_chars(const char* first, const char* last, std::chrono::duration<Rep, Period>& value) noexcept
+{
+    std::int64_t ticks {};
+    const auto r = detail::from_chars_chrono_nanoseconds<Rep, Period>(first, last, ticks);
+    if (r)
+    {
+        value = std::chrono::duration<Rep, Period>(static_cast<Rep>(ticks));
+    }
+
+    return r;
+}
+
+template <typename Rep, typename Period>
+from_chars_result from_chars(boost::core::string_view sv, std::chrono::duration<Rep, Period>& value) noexcept
+{
+    return boost::charconv::from_chars(sv.data(), sv.data() + sv.size(), value);
+}
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_CHRONO_HPP
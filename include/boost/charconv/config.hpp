@@ -12,7 +12,13 @@
 // This header implements separate compilation features as described in
 // http://www.boost.org/more/separate_compilation.html
 
-#if defined(BOOST_ALL_DYN_LINK) || defined(BOOST_CHARCONV_DYN_LINK)
+// With BOOST_CHARCONV_HEADER_ONLY the definitions are included by the headers as inline functions,
+// so that calls can be inlined and nothing needs to be linked
+
+#if defined(BOOST_CHARCONV_HEADER_ONLY)
+# define BOOST_CHARCONV_DECL inline
+# define BOOST_CHARCONV_HEADER_ONLY_INLINE inline
+#elif defined(BOOST_ALL_DYN_LINK) || defined(BOOST_CHARCONV_DYN_LINK)
 # if defined(BOOST_CHARCONV_SOURCE)
 #  define BOOST_CHARCONV_DECL BOOST_SYMBOL_EXPORT
 # else
@@ -22,9 +28,13 @@
 # define BOOST_CHARCONV_DECL
 #endif
 
+#ifndef BOOST_CHARCONV_HEADER_ONLY_INLINE
+# define BOOST_CHARCONV_HEADER_ONLY_INLINE
+#endif
+
 // Autolink
 
-#if !defined(BOOST_CHARCONV_SOURCE) && !defined(BOOST_ALL_NO_LIB) && !defined(BOOST_CHARCONV_NO_LIB)
+#if !defined(BOOST_CHARCONV_SOURCE) && !defined(BOOST_ALL_NO_LIB) && !defined(BOOST_CHARCONV_NO_LIB) && !defined(BOOST_CHARCONV_HEADER_ONLY)
 
 #define BOOST_LIB_NAME boost_charconv
 
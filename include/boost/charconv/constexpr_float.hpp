@@ -0,0 +1,424 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_CONSTEXPR_FLOAT_HPP
+#define BOOST_CHARCONV_CONSTEXPR_FLOAT_HPP
+
+// to_chars and from_chars for float and double that can be evaluated at compile time, e.g. to generate lookup tables.
+// The compiled library functions can not be constexpr, so these are separate overloads which forward to them at run time.
+// At compile time the shortest output is built from the constexpr Dragonbox directly, and parsing uses fast_float
+// and the hexadecimal decoder, which gives exactly the same results as the library
+
+#include <boost/charconv/detail/config.hpp>
+
+#ifdef BOOST_CHARCONV_HAS_CONSTEXPR_FLOAT
+
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/buffer_sizing.hpp>
+#include <boost/charconv/detail/integer_search_trees.hpp>
+#include <boost/charconv/detail/to_chars_integer_impl.hpp>
+#include <boost/charconv/detail/dragonbox/dragonbox.hpp>
+#include <boost/charconv/detail/fast_float/fast_float.hpp>
+#include <boost/charconv/detail/from_chars_hex_float.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <type_traits>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost { namespace charconv {
+
+namespace detail { namespace constexpr_float {
+
+template <typename T>
+constexpr int max_digits() noexcept
+{
+    return std::is_same<T, float>::value ? 9 : 17;
+}
+
+constexpr to_chars_result copy_chars(char* first, char* last, const char* str, std::ptrdiff_t length) noexcept
+{
+    if (last - first < length)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    for (std::ptrdiff_t i = 0; i < length; ++i)
+    {
+        first[i] = str[i];
+    }
+
+    return {first + length, std::errc()};
+}
+
+// Same output as dragon_box_print_chars: d[.ddd] without trailing zeros, followed by an exponent of at least two digits
+template <typename T, typename Unsigned_Integer>
+constexpr to_chars_result print_scientific(Unsigned_Integer significand, int exponent, char* first, char* last, chars_format fmt) noexcept
+{
+    char digits[20] {};
+    const auto r = to_chars_integer_impl(digits, digits + sizeof(digits), significand);
+    int num_dig = static_cast<int>(r.ptr - digits);
+    exponent += num_dig - 1;
+
+    while (num_dig > 1 && digits[num_dig - 1] == '0')
+    {
+        --num_dig;
+    }
+
+    const int abs_exponent = exponent < 0 ? -exponent : exponent;
+    const bool has_exponent = exponent != 0 || fmt == chars_format::scientific;
+    const int length = num_dig + (num_dig > 1 ? 1 : 0) + (has_exponent ? 2 + (abs_exponent >= 100 ? 3 : 2) : 0);
+    if (length > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    *first++ = digits[0];
+    if (num_dig > 1)
+    {
+        *first++ = '.';
+        for (int i = 1; i < num_dig; ++i)
+        {
+            *first++ = digits[i];
+        }
+    }
+
+    if (!has_exponent)
+    {
+        return {first, std::errc()};
+    }
+
+    *first++ = 'e';
+    *first++ = exponent < 0 ? '-' : '+';
+    if (abs_exponent >= 100)
+    {
+        *first++ = static_cast<char>('0' + abs_exponent / 100);
+    }
+    *first++ = static_cast<char>('0' + abs_exponent / 10 % 10);
+    *first++ = static_cast<char>('0' + abs_exponent % 10);
+
+    return {first, std::errc()};
+}
+
+// Same as to_chars_n_impl with the default policies
+template <typename T>
+constexpr to_chars_result dragonbox_to_chars(T value, char* first, char* last, chars_format fmt) noexcept
+{
+    const auto br = dragonbox_float_bits<T>(value);
+    const auto exponent_bits = br.extract_exponent_bits();
+    const auto s = br.remove_exponent_bits(exponent_bits);
+
+    if (s.is_negative())
+    {
+        if (first == last)
+        {
+            return {last, std::errc::result_out_of_range};
+        }
+        *first++ = '-';
+    }
+
+    if (br.is_finite(exponent_bits))
+    {
+        if (br.is_nonzero())
+        {
+            const auto decimal = to_decimal<T>(s, exponent_bits, policy::sign::ignore, policy::trailing_zero::ignore);
+            return print_scientific<T>(decimal.significand, decimal.exponent, first, last, fmt);
+        }
+
+        return fmt == chars_format::scientific ? copy_chars(first, last, "0e+00", 5) : copy_chars(first, last, "0", 1);
+    }
+
+    if (s.has_all_zero_significand_bits())
+    {
+        return copy_chars(first, last, "inf", 3);
+    }
+
+    const auto quiet_nan = std::is_same<T, float>::value ? UINT32_C(4194304) : UINT64_C(2251799813685248);
+    if (br.extract_significand_bits() == quiet_nan)
+    {
+        return s.is_negative() ? copy_chars(first, last, "nan(ind)", 8) : copy_chars(first, last, "nan", 3);
+    }
+
+    return copy_chars(first, last, "nan(snan)", 9);
+}
+
+// Same as to_chars_fixed_impl for values in [1, 1e16) or [1, 1e7) for float
+template <typename T>
+constexpr to_chars_result to_chars_fixed(char* first, char* last, T value) noexcept
+{
+    const auto decimal = to_decimal(value);
+    const int num_dig = num_digits(decimal.significand);
+    const std::ptrdiff_t total_length = static_cast<std::ptrdiff_t>(decimal.is_negative) +
+                                        (decimal.exponent >= 0 ? num_dig + decimal.exponent : num_dig + 1);
+    if (total_length > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (decimal.is_negative)
+    {
+        *first++ = '-';
+    }
+
+    auto r = to_chars_integer_impl(first, last, decimal.significand);
+    if (r.ec != std::errc())
+    {
+        return r;
+    }
+
+    if (decimal.exponent < 0)
+    {
+        for (int i = 0; i < -decimal.exponent; ++i)
+        {
+            r.ptr[-i] = r.ptr[-i - 1];
+        }
+        r.ptr[decimal.exponent] = '.';
+        ++r.ptr;
+    }
+
+    for (int i = 0; i < decimal.exponent; ++i)
+    {
+        *r.ptr++ = '0';
+    }
+
+    return r;
+}
+
+// Same as detail::to_chars_fixed_shortest for the finite nonzero values below 1 or at least 2^64 (2^32 for float)
+template <typename T>
+constexpr to_chars_result to_chars_fixed_shortest(char* first, char* last, T value) noexcept
+{
+    const auto decimal = to_decimal(value);
+    const int num_dig = num_digits(decimal.significand);
+    const std::ptrdiff_t total_length = static_cast<std::ptrdiff_t>(decimal.is_negative) +
+                                        (decimal.exponent >= 0 ? num_dig + decimal.exponent : 2 - decimal.exponent);
+    if (total_length > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (decimal.is_negative)
+    {
+        *first++ = '-';
+    }
+
+    if (decimal.exponent >= 0)
+    {
+        auto r = to_chars_integer_impl(first, last, decimal.significand);
+        for (int i = 0; i < decimal.exponent; ++i)
+        {
+            *r.ptr++ = '0';
+        }
+        return r;
+    }
+
+    *first++ = '0';
+    *first++ = '.';
+    for (int i = num_dig; i < -decimal.exponent; ++i)
+    {
+        *first++ = '0';
+    }
+    return to_chars_integer_impl(first, last, decimal.significand);
+}
+
+// Same as to_chars_hex with unspecified precision
+template <typename T>
+constexpr to_chars_result to_chars_hex(char* first, char* last, T value) noexcept
+{
+    using format = typename dragonbox_float_traits<T>::format;
+    using Unsigned_Integer = typename dragonbox_float_traits<T>::carrier_uint;
+
+    const std::ptrdiff_t buffer_size = last - first;
+    if (buffer_size < max_digits<T>())
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    // Float is shifted by one so that its 23 bits fill 6 hexits
+    constexpr int hex_precision = std::is_same<T, float>::value ? 6 : 13;
+    constexpr int hex_bits = hex_precision * 4;
+
+    const auto bits = std::bit_cast<Unsigned_Integer>(value);
+    const Unsigned_Integer significand = bits & ((Unsigned_Integer(1) << format::significand_bits) - 1);
+    const auto exponent = static_cast<int>((bits >> format::significand_bits) & ((Unsigned_Integer(1) << format::exponent_bits) - 1));
+
+    Unsigned_Integer aligned_significand = std::is_same<T, float>::value ? static_cast<Unsigned_Integer>(significand << 1) : significand;
+    int unbiased_exponent = 1 + format::exponent_bias;
+    if (exponent != 0)
+    {
+        aligned_significand |= Unsigned_Integer(1) << hex_bits;
+        unbiased_exponent = exponent + format::exponent_bias;
+    }
+
+    const auto abs_unbiased_exponent = static_cast<std::uint32_t>(unbiased_exponent < 0 ? -unbiased_exponent : unbiased_exponent);
+    if (total_buffer_length(max_digits<T>(), abs_unbiased_exponent, value < 0) > buffer_size)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (value < 0)
+    {
+        *first++ = '-';
+    }
+
+    *first++ = digit_tables::digit_table[aligned_significand >> hex_bits];
+    *first++ = '.';
+
+    // Trailing zeros are not printed, but the point is
+    aligned_significand &= (Unsigned_Integer(1) << hex_bits) - 1;
+    for (int remaining_bits = hex_bits; aligned_significand != 0; )
+    {
+        remaining_bits -= 4;
+        *first++ = digit_tables::digit_table[aligned_significand >> remaining_bits];
+        aligned_significand &= (Unsigned_Integer(1) << remaining_bits) - 1;
+    }
+
+    *first++ = 'p';
+    *first++ = unbiased_exponent < 0 ? '-' : '+';
+    return to_chars_integer_impl(first, last, abs_unbiased_exponent);
+}
+
+// Same dispatch as to_chars_float_impl with unspecified precision
+template <typename T>
+constexpr to_chars_result to_chars_shortest(char* first, char* last, T value, chars_format fmt) noexcept
+{
+    using Unsigned_Integer = typename std::conditional<std::is_same<T, double>::value, std::uint64_t, std::uint32_t>::type;
+
+    if (first >= last)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    const T abs_value = value < 0 ? -value : value;
+    constexpr auto max_fractional_value = std::is_same<T, double>::value ? static_cast<T>(1e16) : static_cast<T>(1e7);
+    constexpr auto max_value = static_cast<T>((std::numeric_limits<Unsigned_Integer>::max)());
+
+    if (fmt == chars_format::general || fmt == chars_format::fixed)
+    {
+        if (abs_value >= 1 && abs_value < max_fractional_value)
+        {
+            return to_chars_fixed(first, last, value);
+        }
+        else if (abs_value >= max_fractional_value && abs_value < max_value)
+        {
+            if (value < 0)
+            {
+                *first++ = '-';
+            }
+            return to_chars_integer_impl(first, last, static_cast<std::uint64_t>(abs_value));
+        }
+        else if (fmt == chars_format::fixed && abs_value != 0 && abs_value <= (std::numeric_limits<T>::max)())
+        {
+            return to_chars_fixed_shortest(first, last, value);
+        }
+
+        return dragonbox_to_chars(value, first, last, fmt);
+    }
+    else if (fmt == chars_format::scientific)
+    {
+        return dragonbox_to_chars(value, first, last, fmt);
+    }
+
+    const auto br = dragonbox_float_bits<T>(value);
+    if (!br.is_finite(br.extract_exponent_bits()))
+    {
+        return dragonbox_to_chars(value, first, last, chars_format::general);
+    }
+    else if (!br.is_nonzero())
+    {
+        if (br.is_negative())
+        {
+            *first++ = '-';
+        }
+        return copy_chars(first, last, "0p+0", 4);
+    }
+
+    return to_chars_hex(first, last, value);
+}
+
+// Same as from_chars_erange
+template <typename T>
+constexpr from_chars_result from_chars_erange(const char* first, const char* last, T& value, chars_format fmt) noexcept
+{
+    if (fmt != chars_format::hex)
+    {
+        return fast_float::from_chars(first, last, value, fmt);
+    }
+
+    if (is_non_finite_start(first, last))
+    {
+        return fast_float::detail::parse_infnan(first, last, value);
+    }
+
+    return from_chars_hex_float(first, last, value);
+}
+
+}} // Namespace detail::constexpr_float
+
+// Shortest round trip output of value, the same as to_chars(first, last, value, fmt) but usable in constant expressions.
+// For a given precision use to_chars, which is only available at run time
+constexpr to_chars_result to_chars_constexpr(char* first, char* last, float value, chars_format fmt = chars_format::general) noexcept
+{
+    if (!std::is_constant_evaluated())
+    {
+        return boost::charconv::to_chars(first, last, value, fmt);
+    }
+
+    return detail::constexpr_float::to_chars_shortest(first, last, value, fmt);
+}
+
+constexpr to_chars_result to_chars_constexpr(char* first, char* last, double value, chars_format fmt = chars_format::general) noexcept
+{
+    if (!std::is_constant_evaluated())
+    {
+        return boost::charconv::to_chars(first, last, value, fmt);
+    }
+
+    return detail::constexpr_float::to_chars_shortest(first, last, value, fmt);
+}
+
+// The same as from_chars(first, last, value, fmt), so the value is only modified on success
+constexpr from_chars_result from_chars_constexpr(const char* first, const char* last, float& value, chars_format fmt = chars_format::general) noexcept
+{
+    if (!std::is_constant_evaluated())
+    {
+        return boost::charconv::from_chars(first, last, value, fmt);
+    }
+
+    float temp_value {};
+    const auto r = detail::constexpr_float::from_chars_erange(first, last, temp_value, fmt);
+    if (r)
+    {
+        value = temp_value;
+    }
+
+    return r;
+}
+
+constexpr from_chars_result from_chars_constexpr(const char* first, const char* last, double& value, chars_format fmt = chars_format::general) noexcept
+{
+    if (!std::is_constant_evaluated())
+    {
+        return boost::charconv::from_chars(first, last, value, fmt);
+    }
+
+    double temp_value {};
+    const auto r = detail::constexpr_float::from_chars_erange(first, last, temp_value, fmt);
+    if (r)
+    {
+        value = temp_value;
+    }
+
+    return r;
+}
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_HAS_CONSTEXPR_FLOAT
+
+#endif // BOOST_CHARCONV_CONSTEXPR_FLOAT_HPP
@@ -0,0 +1,449 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DECIMAL_HPP
+#define BOOST_CHARCONV_DECIMAL_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/parser.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/detail/to_chars_integer_impl.hpp>
+#include <boost/charconv/detail/apply_sign.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
+#include <boost/charconv/detail/integer_search_trees.hpp>
+#include <boost/charconv/limits.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <system_error>
+#include <type_traits>
+#include <cstring>
+#include <cstdint>
+
+namespace boost { namespace charconv {
+
+// What from_chars_decimal does with digits past the scale, e.g. the 9 of "1.239" at a scale of 2
+enum class decimal_rounding : unsigned
+{
+    reject,         // Digits other than trailing zeros return std::errc::result_out_of_range
+    toward_zero,    // The digits are dropped
+    to_nearest      // Rounds half away from zero, like std::llround
+};
+
+namespace detail {
+
+template <typename Unsigned_Integer>
+inline Unsigned_Integer decimal_power_of_10(int n) noexcept
+{
+    static constexpr std::uint64_t powers[] = {
+        UINT64_C(1), UINT64_C(10), UINT64_C(100), UINT64_C(1000), UINT64_C(10000), UINT64_C(100000), UINT64_C(1000000),
+        UINT64_C(10000000), UINT64_C(100000000), UINT64_C(1000000000), UINT64_C(10000000000), UINT64_C(100000000000),
+        UINT64_C(1000000000000), UINT64_C(10000000000000), UINT64_C(100000000000000), UINT64_C(1000000000000000),
+        UINT64_C(10000000000000000), UINT64_C(100000000000000000), UINT64_C(1000000000000000000), UINT64_C(10000000000000000000)
+    };
+
+    if (n < 20)
+    {
+        return static_cast<Unsigned_Integer>(powers[n]);
+    }
+
+    return static_cast<Unsigned_Integer>(powers[19]) * static_cast<Unsigned_Integer>(powers[n - 19]);
+}
+
+template <typename Unsigned_Integer>
+struct decimal_dropped_digits
+{
+    Unsigned_Integer leading;   // The first digits that were skipped, as many as were asked for
+    int next_digit;             // The digit after those
+    bool rest_nonzero;          // Whether any digit after next_digit is not zero
+};
+
+// The parser keeps a fixed number of significant digits and skips the ones after them.
+// value == (significand + 0.d1d2d3...) * 10^exponent holds with the skipped digits d1, d2, ..., so they are found again by
+// walking [first, last) past the kept digits. The first count of them are returned as an integer, missing ones counting as zero
+template <typename Unsigned_Integer>
+decimal_dropped_digits<Unsigned_Integer> find_dropped_digits(const char* first, const char* last, int kept_digits, int count) noexcept
+{
+    decimal_dropped_digits<Unsigned_Integer> dropped {0, 0, false};
+
+    while (first != last && (*first == '-' || *first == '0' || *first == '.'))
+    {
+        ++first;
+    }
+
+    bool found_next = false;
+    for (; first != last; ++first)
+    {
+        if (*first == '.')
+        {
+            continue;
+        }
+        if (!is_integer_char(*first))
+        {
+            break;
+        }
+
+        const int digit = *first - '0';
+        if (kept_digits > 0)
+        {
+            --kept_digits;
+        }
+        else if (count > 0)
+        {
+            dropped.leading = dropped.leading * 10U + static_cast<Unsigned_Integer>(digit);
+            --count;
+        }
+        else if (!found_next)
+        {
+            dropped.next_digit = digit;
+            found_next = true;
+        }
+        else if (digit != 0)
+        {
+            dropped.rest_nonzero = true;
+            break;
+        }
+    }
+
+    if (count > 0)
+    {
+        dropped.leading *= decimal_power_of_10<Unsigned_Integer>(count);
+    }
+
+    return dropped;
+}
+
+// The parser stops in front of the exponent of a zero significand ("0e5") and takes an exponent character without digits ("5e").
+// Returns the end of the number that from_chars with chars_format::general finds instead of ptr, the end the parser returned
+inline const char* decimal_exponent_end(const char* first, const char* ptr, const char* last) noexcept
+{
+    if (ptr != last && (*ptr == 'e' || *ptr == 'E'))
+    {
+        auto next = ptr + 1;
+        if (next != last && (*next == '+' || *next == '-'))
+        {
+            ++next;
+        }
+        if (next == last || !is_integer_char(*next))
+        {
+            return ptr;
+        }
+        while (next != last && is_integer_char(*next))
+        {
+            ++next;
+        }
+        return next;
+    }
+
+    auto next = ptr;
+    if (next - first > 1 && (next[-1] == '+' || next[-1] == '-'))
+    {
+        --next;
+    }
+    if (next - first > 1 && (next[-1] == 'e' || next[-1] == 'E'))
+    {
+        return next - 1;
+    }
+
+    return ptr;
+}
+
+// The value of the number in [first, last) is significand * 10^exponent as split by the parser, so the mantissa at scale is
+// significand * 10^(exponent + scale). A positive power is a multiplication with an overflow check, and a negative one a division
+// whose remainder is what is past the scale
+template <typename Integer, typename Unsigned_Integer>
+from_chars_result from_chars_decimal_impl(const char* first, const char* last, Integer& mantissa, int scale, decimal_rounding rounding) noexcept
+{
+    // The parser accepts an empty significand, and infinity and nan have no decimal value
+    auto next = first;
+    if (next != last && *next == '-')
+    {
+        ++next;
+    }
+    if (next == last || !(is_integer_char(*next) || (*next == '.' && next + 1 != last && is_integer_char(next[1]))))
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    bool sign {};
+    Unsigned_Integer significand {};
+    std::int64_t exponent {};
+    auto r = parser(first, last, sign, significand, exponent, chars_format::general);
+
+    if (r.ec == std::errc::invalid_argument)
+    {
+        // After the check above this is only a significand of zeros followed by something else, which the parser does not take
+        while (next != last && *next == '0')
+        {
+            ++next;
+        }
+        if (next != last && *next == '.')
+        {
+            ++next;
+            while (next != last && *next == '0')
+            {
+                ++next;
+            }
+        }
+
+        mantissa = 0;
+        return {decimal_exponent_end(first, next, last), std::errc()};
+    }
+    else if (r.ec != std::errc())
+    {
+        return r;
+    }
+
+    r.ptr = decimal_exponent_end(first, r.ptr, last);
+    if (significand == 0)
+    {
+        mantissa = 0;
+        return r;
+    }
+
+    constexpr int max_power = sizeof(Unsigned_Integer) > sizeof(std::uint64_t) ? 38 : 19;
+    constexpr int kept_digits = limits<Unsigned_Integer>::max_chars10 - 1;
+    const Unsigned_Integer limit = ((static_cast<Unsigned_Integer>(1) << (sizeof(Integer) * 8U - 1U)) - 1U) + static_cast<Unsigned_Integer>(sign);
+    const bool has_dropped_digits = num_digits(significand) == kept_digits;
+    const std::int64_t power = exponent + scale;
+
+    Unsigned_Integer magnitude;
+    bool exact;
+    bool round_up;
+
+    if (power >= 0)
+    {
+        if (power > max_power)
+        {
+            return {r.ptr, std::errc::result_out_of_range};
+        }
+
+        const auto multiplier = decimal_power_of_10<Unsigned_Integer>(static_cast<int>(power));
+        if (significand > limit / multiplier)
+        {
+            return {r.ptr, std::errc::result_out_of_range};
+        }
+
+        magnitude = significand * multiplier;
+        exact = true;
+        round_up = false;
+
+        // The skipped digits continue the mantissa up to the power, and what is after them is past the scale
+        if (has_dropped_digits)
+        {
+            const auto dropped = find_dropped_digits<Unsigned_Integer>(first, r.ptr, kept_digits, static_cast<int>(power));
+            magnitude += dropped.leading;
+            exact = dropped.next_digit == 0 && !dropped.rest_nonzero;
+            round_up = dropped.next_digit >= 5;
+        }
+    }
+    else
+    {
+        bool sticky = false;
+        if (has_dropped_digits)
+        {
+            const auto dropped = find_dropped_digits<Unsigned_Integer>(first, r.ptr, kept_digits, 0);
+            sticky = dropped.next_digit != 0 || dropped.rest_nonzero;
+        }
+
+        if (-power > max_power)
+        {
+            // The significand has fewer digits than the power, so it is below half of it
+            magnitude = 0;
+            exact = false;
+            round_up = false;
+        }
+        else
+        {
+            const auto divisor = decimal_power_of_10<Unsigned_Integer>(static_cast<int>(-power));
+            magnitude = significand / divisor;
+            const Unsigned_Integer remainder = significand % divisor;
+
+            // Half away from zero rounds up on a tie, so whatever follows the remainder does not matter
+            exact = remainder == 0 && !sticky;
+            round_up = remainder >= divisor / 2U;
+        }
+    }
+
+    if (!exact)
+    {
+        if (rounding == decimal_rounding::reject)
+        {
+            return {r.ptr, std::errc::result_out_of_range};
+        }
+        else if (rounding == decimal_rounding::to_nearest && round_up)
+        {
+            ++magnitude;
+        }
+    }
+
+    if (magnitude > limit)
+    {
+        return {r.ptr, std::errc::result_out_of_range};
+    }
+
+    mantissa = static_cast<Integer>(sign ? ~magnitude + 1U : magnitude);
+    return r;
+}
+
+inline to_chars_result to_chars_decimal_digits(char* first, char* last, std::uint64_t value) noexcept
+{
+    return to_chars_integer_impl(first, last, value);
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+inline to_chars_result to_chars_decimal_digits(char* first, char* last, boost::uint128_type value) noexcept
+{
+    return to_chars_128integer_impl(first, last, value);
+}
+#endif
+
+// Writes the digits of the magnitude with the integer formatting, and then copies them to the output around the decimal point.
+// The fraction is the last scale digits of the mantissa, with its trailing zeros removed down to min_frac_digits digits
+template <typename Unsigned_Integer>
+to_chars_result to_chars_decimal_impl(char* first, char* last, bool negative, Unsigned_Integer magnitude, int scale, int min_frac_digits) noexcept
+{
+    if (first > last || min_frac_digits < 0)
+    {
+        return {last, std::errc::invalid_argument};
+    }
+
+    char digits[40];
+    const auto digits_r = to_chars_decimal_digits(digits, digits + sizeof(digits), magnitude);
+    const auto num_digits = static_cast<std::int64_t>(digits_r.ptr - digits);
+
+    // Zeros after the digits of the mantissa, and zeros between the decimal point and the digits
+    std::int64_t integer_zeros = 0;
+    std::int64_t fraction_zeros = 0;
+    std::int64_t integer_digits = num_digits;
+    std::int64_t fraction_digits = 0;
+    if (scale <= 0)
+    {
+        integer_zeros = magnitude == 0 ? 0 : -static_cast<std::int64_t>(scale);
+    }
+    else
+    {
+        fraction_digits = scale < num_digits ? scale : num_digits;
+        integer_digits = num_digits - fraction_digits;
+        fraction_zeros = scale - fraction_digits;
+
+        while (fraction_digits > 0 && digits[static_cast<std::size_t>(integer_digits + fraction_digits - 1)] == '0')
+        {
+            --fraction_digits;
+        }
+        if (fraction_digits == 0)
+        {
+            fraction_zeros = 0;
+        }
+    }
+
+    // Trailing zeros of the fraction written up to min_frac_digits
+    const std::int64_t fraction_length = fraction_zeros + fraction_digits;
+    const std::int64_t padding = min_frac_digits > fraction_length ? min_frac_digits - fraction_length : 0;
+    const std::int64_t total_fraction = fraction_length + padding;
+
+    const std::int64_t total_length = static_cast<std::int64_t>(negative) + (integer_digits == 0 ? 1 : integer_digits + integer_zeros) +
+                                      (total_fraction == 0 ? 0 : total_fraction + 1);
+
+    if (total_length > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (negative)
+    {
+        *first++ = '-';
+    }
+
+    if (integer_digits == 0)
+    {
+        *first++ = '0';
+    }
+    else
+    {
+        std::memcpy(first, digits, static_cast<std::size_t>(integer_digits));
+        first += integer_digits;
+        std::memset(first, '0', static_cast<std::size_t>(integer_zeros));
+        first += integer_zeros;
+    }
+
+    if (total_fraction != 0)
+    {
+        *first++ = '.';
+        std::memset(first, '0', static_cast<std::size_t>(fraction_zeros));
+        first += fraction_zeros;
+        std::memcpy(first, digits + integer_digits, static_cast<std::size_t>(fraction_digits));
+        first += fraction_digits;
+        std::memset(first, '0', static_cast<std::size_t>(padding));
+        first += padding;
+    }
+
+    return {first, std::errc()};
+}
+
+} // namespace detail
+
+// Parses a decimal number like "12345.6789" into the integer mantissa with value == mantissa * 10^-scale,
+// e.g. 123456789 at a scale of 4. The conversion is exact and never goes through a floating point type.
+// An exponent ("1.5e3") is allowed, and infinity and nan are std::errc::invalid_argument.
+// Mantissas out of the range of the type, and excess digits with decimal_rounding::reject, are std::errc::result_out_of_range.
+// On error mantissa is not modified
+
+inline from_chars_result from_chars_decimal(const char* first, const char* last, std::int64_t& mantissa, int scale,
+                                            decimal_rounding rounding = decimal_rounding::reject) noexcept
+{
+    return detail::from_chars_decimal_impl<std::int64_t, std::uint64_t>(first, last, mantissa, scale, rounding);
+}
+
+inline from_chars_result from_chars_decimal(boost::core::string_view sv, std::int64_t& mantissa, int scale,
+                                            decimal_rounding rounding = decimal_rounding::reject) noexcept
+{
+    return detail::from_chars_decimal_impl<std::int64_t, std::uint64_t>(sv.data(), sv.data() + sv.size(), mantissa, scale, rounding);
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+
+inline from_chars_result from_chars_decimal(const char* first, const char* last, boost::int128_type& mantissa, int scale,
+                                            decimal_rounding rounding = decimal_rounding::reject) noexcept
+{
+    return detail::from_chars_decimal_impl<boost::int128_type, boost::uint128_type>(first, last, mantissa, scale, rounding);
+}
+
+inline from_chars_result from_chars_decimal(boost::core::string_view sv, boost::int128_type& mantissa, int scale,
+                                            decimal_rounding rounding = decimal_rounding::reject) noexcept
+{
+    return detail::from_chars_decimal_impl<boost::int128_type, boost::uint128_type>(sv.data(), sv.data() + sv.size(), mantissa, scale, rounding);
+}
+
+#endif // BOOST_CHARCONV_HAS_INT128
+
+// Formats mantissa * 10^-scale with a decimal point, e.g. "12345.6789" for the mantissa 123456789 at a scale of 4.
+// Trailing zeros of the fraction are removed, but at least min_frac_digits fraction digits are written ("1.50" for 150 at a
+// scale of 2 and min_frac_digits 2), adding zeros past the scale if needed. The decimal point is left out without fraction digits.
+// The digits are those of the integer, so nothing goes through a floating point type
+
+template <typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+inline to_chars_result to_chars_decimal(char* first, char* last, Integer mantissa, int scale, int min_frac_digits = 0) noexcept
+{
+    // Everything up to 64 bits shares one instantiation of the formatter
+    using Unsigned_Integer = typename std::conditional<(sizeof(Integer) > sizeof(std::uint64_t)),
+                                                       detail::make_unsigned_t<Integer>, std::uint64_t>::type;
+
+    bool is_negative = false;
+    Unsigned_Integer magnitude = static_cast<Unsigned_Integer>(mantissa);
+    BOOST_IF_CONSTEXPR (detail::is_signed<Integer>::value)
+    {
+        if (mantissa < 0)
+        {
+            is_negative = true;
+            magnitude = static_cast<Unsigned_Integer>(detail::apply_sign(mantissa));
+        }
+    }
+
+    return detail::to_chars_decimal_impl(first, last, is_negative, magnitude, scale, min_frac_digits);
+}
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_DECIMAL_HPP
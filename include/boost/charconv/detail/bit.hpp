@@ -0,0 +1,56 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_BIT_HPP
+#define BOOST_CHARCONV_DETAIL_BIT_HPP
+
+// Bit counts for the conversions that can run in device code.
+// CUDA and HIP kernels use the device intrinsics, everything else boost/core/bit.hpp
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/core/bit.hpp>
+#include <cstdint>
+
+namespace boost { namespace charconv { namespace detail {
+
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE BOOST_CHARCONV_CXX14_CONSTEXPR_NO_INLINE int countl_zero(std::uint32_t x) noexcept
+{
+    #if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+    if (!BOOST_CHARCONV_IS_CONSTANT_EVALUATED(x))
+    {
+        return __clz(static_cast<int>(x));
+    }
+    #endif
+
+    return boost::core::countl_zero(x);
+}
+
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE BOOST_CHARCONV_CXX14_CONSTEXPR_NO_INLINE int countl_zero(std::uint64_t x) noexcept
+{
+    #if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+    if (!BOOST_CHARCONV_IS_CONSTANT_EVALUATED(x))
+    {
+        return __clzll(static_cast<long long>(x));
+    }
+    #endif
+
+    return boost::core::countl_zero(x);
+}
+
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE BOOST_CHARCONV_CXX14_CONSTEXPR_NO_INLINE int countr_zero(std::uint64_t x) noexcept
+{
+    #if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+    if (!BOOST_CHARCONV_IS_CONSTANT_EVALUATED(x))
+    {
+        // __ffsll is the one based position of the lowest set bit, and 0 for 0
+        return x == 0 ? 64 : __ffsll(static_cast<long long>(x)) - 1;
+    }
+    #endif
+
+    return boost::core::countr_zero(x);
+}
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_BIT_HPP
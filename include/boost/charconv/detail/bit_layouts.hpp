@@ -15,6 +15,39 @@
 
 namespace boost { namespace charconv { namespace detail {
 
+// binary16 (std::float16_t)
+struct ieee754_binary16
+{
+    static constexpr int significand_bits = 10;
+    static constexpr int exponent_bits = 5;
+    static constexpr int min_exponent = -14;
+    static constexpr int max_exponent = 15;
+    static constexpr int exponent_bias = -15;
+    static constexpr int decimal_digits = 5;
+};
+
+// bfloat16 (std::bfloat16_t) is the upper half of a binary32
+struct ieee754_bfloat16
+{
+    static constexpr int significand_bits = 7;
+    static constexpr int exponent_bits = 8;
+    static constexpr int min_exponent = -126;
+    static constexpr int max_exponent = 127;
+    static constexpr int exponent_bias = -127;
+    static constexpr int decimal_digits = 4;
+};
+
+// Bit patterns of the 16-bit types, so that they can be handled on compilers without <stdfloat>
+struct binary16_bits
+{
+    std::uint16_t bits;
+};
+
+struct bfloat16_bits
+{
+    std::uint16_t bits;
+};
+
 struct ieee754_binary32 
 {
     static constexpr int significand_bits = 23;
@@ -6,6 +6,7 @@
 #define BOOST_CHARCONV_DETAIL_BUFFER_SIZING_HPP
 
 #include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/bit_layouts.hpp>
 #include <boost/charconv/detail/integer_search_trees.hpp>
 #include <type_traits>
 
@@ -51,7 +52,7 @@ inline int get_real_precision(int precision = -1) noexcept
 }
 
 template <typename Int>
-inline int total_buffer_length(int real_precision, Int exp, bool signed_value)
+BOOST_CHARCONV_CXX14_CONSTEXPR int total_buffer_length(int real_precision, Int exp, bool signed_value)
 {
     // Sign + integer part + '.' + precision of fraction part + e+/e- or p+/p- + exponent digits
     return static_cast<int>(signed_value) + 1 + real_precision + 2 + num_digits(exp);
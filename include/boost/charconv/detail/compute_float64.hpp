@@ -17,11 +17,31 @@
 
 namespace boost { namespace charconv { namespace detail { 
 
-static constexpr double powers_of_ten[] = {
-    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
-    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+#if (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+template <bool b>
+struct float64_powers_template
+#else
+struct float64_powers_table
+#endif
+{
+    static constexpr double powers_of_ten[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
 };
 
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES) && (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+
+template <bool b> constexpr double float64_powers_template<b>::powers_of_ten[];
+
+#endif
+
+#if (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+
+using float64_powers_table = float64_powers_template<true>;
+
+#endif
+
 // Attempts to compute i * 10^(power) exactly; and if "negative" is true, negate the result.
 // 
 // This function will only work in some cases, when it does not work, success is
@@ -31,6 +51,8 @@ inline double compute_float64(std::int64_t power, std::uint64_t i, bool negative
 {
     static constexpr auto smallest_power = -325;
     static constexpr auto largest_power = 308;
+    static_assert(smallest_power >= significands_table::smallest_power && largest_power <= significands_table::largest_power,
+                  "The powers are in the shared table");
 
     // We start with a fast path
     // It was described in Clinger WD. 
@@ -55,11 +77,11 @@ inline double compute_float64(std::int64_t power, std::uint64_t i, bool negative
         
         if (power < 0) 
         {
-            d = d / powers_of_ten[-power];
+            d = d / float64_powers_table::powers_of_ten[-power];
         } 
         else 
         {
-            d = d * powers_of_ten[power];
+            d = d * float64_powers_table::powers_of_ten[power];
         }
         
         if (negative) 
@@ -98,7 +120,7 @@ inline double compute_float64(std::int64_t power, std::uint64_t i, bool negative
         return negative ? -HUGE_VAL : HUGE_VAL;
     }
 
-    const std::uint64_t factor_significand = significands_table::significand_64[power - smallest_power];
+    const std::uint64_t factor_significand = significand_high(static_cast<int>(power));
     const std::int64_t exponent = (((152170 + 65536) * power) >> 16) + 1024 + 63;
     int leading_zeros = boost::core::countl_zero(i);
     i <<= static_cast<std::uint64_t>(leading_zeros);
@@ -123,7 +145,7 @@ inline double compute_float64(std::int64_t power, std::uint64_t i, bool negative
     // lower + i < lower to be true (proba. much higher than 1%).
     if (BOOST_UNLIKELY((high & 0x1FF) == 0x1FF) && (low + i < low))
     {
-        const std::uint64_t factor_significand_low = significands_table::significand_128[power - smallest_power];
+        const std::uint64_t factor_significand_low = significand_low(static_cast<int>(power));
         product = umul128(i, factor_significand_low);
         //const std::uint64_t product_low = product.low;
         const std::uint64_t product_middle2 = product.high;
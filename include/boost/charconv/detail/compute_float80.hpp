@@ -8,10 +8,15 @@
 #include <boost/charconv/detail/config.hpp>
 #include <boost/charconv/detail/emulated128.hpp>
 #include <boost/charconv/detail/bit_layouts.hpp>
+#include <boost/charconv/detail/extended_power_table.hpp>
+#include <boost/charconv/detail/from_chars_slow_path.hpp>
+#include <boost/core/bit.hpp>
 #include <system_error>
 #include <type_traits>
 #include <limits>
 #include <cstdint>
+#include <cstddef>
+#include <cstring>
 #include <cmath>
 #include <climits>
 #include <cfloat>
@@ -26,28 +31,52 @@ namespace boost { namespace charconv { namespace detail {
 
 #if BOOST_CHARCONV_LDBL_BITS > 64
 
-static constexpr long double powers_of_ten_ld[] = {
-    1e0L,  1e1L,  1e2L,  1e3L,  1e4L,  1e5L,  1e6L,
-    1e7L,  1e8L,  1e9L,  1e10L, 1e11L, 1e12L, 1e13L,
-    1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L, 1e20L,
-    1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L,
-    1e28L, 1e29L, 1e30L, 1e31L, 1e32L, 1e33L, 1e34L,
-    1e35L, 1e36L, 1e37L, 1e38L, 1e39L, 1e40L, 1e41L,
-    1e42L, 1e43L, 1e44L, 1e45L, 1e46L, 1e47L, 1e48L,
-    1e49L, 1e50L, 1e51L, 1e52L, 1e53L, 1e54L, 1e55L
+#if (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+template <bool b>
+struct float80_powers_template
+#else
+struct float80_powers_table
+#endif
+{
+    static constexpr long double powers_of_ten_ld[] = {
+        1e0L,  1e1L,  1e2L,  1e3L,  1e4L,  1e5L,  1e6L,
+        1e7L,  1e8L,  1e9L,  1e10L, 1e11L, 1e12L, 1e13L,
+        1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L, 1e20L,
+        1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L,
+        1e28L, 1e29L, 1e30L, 1e31L, 1e32L, 1e33L, 1e34L,
+        1e35L, 1e36L, 1e37L, 1e38L, 1e39L, 1e40L, 1e41L,
+        1e42L, 1e43L, 1e44L, 1e45L, 1e46L, 1e47L, 1e48L,
+        1e49L, 1e50L, 1e51L, 1e52L, 1e53L, 1e54L, 1e55L
+    };
+
+    #ifdef BOOST_CHARCONV_HAS_FLOAT128
+    static constexpr __float128 powers_of_tenq[] = {
+        1e0Q,  1e1Q,  1e2Q,  1e3Q,  1e4Q,  1e5Q,  1e6Q,
+        1e7Q,  1e8Q,  1e9Q,  1e10Q, 1e11Q, 1e12Q, 1e13Q,
+        1e14Q, 1e15Q, 1e16Q, 1e17Q, 1e18Q, 1e19Q, 1e20Q,
+        1e21Q, 1e22Q, 1e23Q, 1e24Q, 1e25Q, 1e26Q, 1e27Q,
+        1e28Q, 1e29Q, 1e30Q, 1e31Q, 1e32Q, 1e33Q, 1e34Q,
+        1e35Q, 1e36Q, 1e37Q, 1e38Q, 1e39Q, 1e40Q, 1e41Q,
+        1e42Q, 1e43Q, 1e44Q, 1e45Q, 1e46Q, 1e47Q, 1e48Q,
+        1e49Q, 1e50Q, 1e51Q, 1e52Q, 1e53Q, 1e54Q, 1e55Q
+    };
+    #endif
 };
 
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES) && (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+
+template <bool b> constexpr long double float80_powers_template<b>::powers_of_ten_ld[];
+
 #ifdef BOOST_CHARCONV_HAS_FLOAT128
-static constexpr __float128 powers_of_tenq[] = {
-    1e0Q,  1e1Q,  1e2Q,  1e3Q,  1e4Q,  1e5Q,  1e6Q,
-    1e7Q,  1e8Q,  1e9Q,  1e10Q, 1e11Q, 1e12Q, 1e13Q,
-    1e14Q, 1e15Q, 1e16Q, 1e17Q, 1e18Q, 1e19Q, 1e20Q,
-    1e21Q, 1e22Q, 1e23Q, 1e24Q, 1e25Q, 1e26Q, 1e27Q,
-    1e28Q, 1e29Q, 1e30Q, 1e31Q, 1e32Q, 1e33Q, 1e34Q,
-    1e35Q, 1e36Q, 1e37Q, 1e38Q, 1e39Q, 1e40Q, 1e41Q,
-    1e42Q, 1e43Q, 1e44Q, 1e45Q, 1e46Q, 1e47Q, 1e48Q,
-    1e49Q, 1e50Q, 1e51Q, 1e52Q, 1e53Q, 1e54Q, 1e55Q
-};
+template <bool b> constexpr __float128 float80_powers_template<b>::powers_of_tenq[];
+#endif
+
+#endif
+
+#if (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+
+using float80_powers_table = float80_powers_template<true>;
+
 #endif
 
 template <typename ResultType, typename Unsigned_Integer, typename ArrayPtr>
@@ -78,19 +107,221 @@ inline ResultType fast_path(std::int64_t q, Unsigned_Integer w, bool negative, A
     return ld;
 }
 
+// Eisel-Lemire for the extended formats.
+// Daniel Lemire, Number Parsing at a Gigabyte per Second, Software: Practice and Experience 51 (8), 2021
+// https://arxiv.org/abs/2101.11408
+//
+// The significand w (up to 38 digits, so 128 bits) is multiplied with a 256-bit (binary128) or 128-bit (80-bit)
+// truncation of 10^q. The truncated power is low by less than 3 units in its last place, so the exact product
+// lies in [P, P + 2^130) which only affects the bits far below the significand of the result.
+// Both ends of that interval are rounded, and if they agree so does the exact value.
+// Ties and the rare values too close to a halfway point are left to the slow path.
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+inline void extended_split(boost::uint128_type w, std::uint64_t& high, std::uint64_t& low) noexcept
+{
+    high = static_cast<std::uint64_t>(w >> 64);
+    low = static_cast<std::uint64_t>(w);
+}
+#endif
+
+inline void extended_split(uint128 w, std::uint64_t& high, std::uint64_t& low) noexcept
+{
+    high = w.high;
+    low = w.low;
+}
+
+// Writes the Words most significant words of the normalized significand of 10^q (least significant word first),
+// and returns the binary exponent e such that 10^q ~= significand * 2^(e - 64 * Words + 1)
+template <std::size_t Words>
+inline std::int64_t extended_power_of_ten(std::int64_t q, std::uint64_t* significand) noexcept
+{
+    using table = extended_powers;
+
+    const auto index = static_cast<std::size_t>(q - table::smallest_power_of_ten);
+    const auto entry = index / table::step;
+    const auto r = index % table::step;
+
+    const std::uint64_t* power = table::power_of_ten_256 + 4 * entry;
+    std::uint64_t m[5] = {power[3], power[2], power[1], power[0], 0};
+
+    // floor(log2(10^q)) for the stored power
+    const std::int64_t stored_power = table::smallest_power_of_ten + static_cast<std::int64_t>(entry) * table::step;
+    std::int64_t exponent = (stored_power * INT64_C(14267572527)) >> 32;
+
+    if (r != 0)
+    {
+        // 10^q = 10^stored_power * 5^r * 2^r
+        std::uint64_t carry = 0;
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            const uint128 product = umul128(m[i], table::power_of_five[r]);
+            m[i] = product.low + carry;
+            carry = product.high + (m[i] < carry ? 1U : 0U);
+        }
+        m[4] = carry;
+
+        // 5^r < 2^63 so the top word is non-zero and has at least one leading zero.
+        // Normalize and truncate back to 256 bits
+        const int lz = boost::core::countl_zero(m[4]);
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            m[i] = (m[i + 1] << lz) | (m[i] >> (64 - lz));
+        }
+
+        exponent += static_cast<std::int64_t>(r) + 64 - lz;
+    }
+
+    for (std::size_t i = 0; i < Words; ++i)
+    {
+        significand[i] = m[4 - Words + i];
+    }
+
+    return exponent - static_cast<std::int64_t>(64 * Words) + 1;
+}
+
+// Adds addend to the word at index of the n word integer x, and returns the carry out of the top word
+inline std::uint64_t extended_add(std::uint64_t* x, std::size_t n, std::size_t index, std::uint64_t addend) noexcept
+{
+    for (; index < n && addend != 0; ++index)
+    {
+        x[index] += addend;
+        addend = x[index] < addend ? 1U : 0U;
+    }
+
+    return addend;
+}
+
+// Computes P = (w << lz) * power where lz normalizes w to 128 bits.
+// Returns the binary exponent e such that w * 10^q ~= (P >> 64 * Words) * 2^e
+template <std::size_t Words>
+inline std::int64_t extended_product(std::int64_t q, std::uint64_t w_high, std::uint64_t w_low,
+                                     std::uint64_t* power, std::uint64_t* product, int& lz) noexcept
+{
+    const std::int64_t exponent = extended_power_of_ten<Words>(q, power);
+
+    lz = w_high != 0 ? boost::core::countl_zero(w_high) : 64 + boost::core::countl_zero(w_low);
+    std::uint64_t w[2];
+    if (lz >= 64)
+    {
+        w[1] = w_low << (lz - 64);
+        w[0] = 0;
+    }
+    else
+    {
+        w[1] = lz == 0 ? w_high : (w_high << lz) | (w_low >> (64 - lz));
+        w[0] = w_low << lz;
+    }
+
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        std::uint64_t carry = 0;
+        for (std::size_t j = 0; j < Words; ++j)
+        {
+            const uint128 partial = umul128(w[i], power[j]);
+            std::uint64_t low = partial.low + carry;
+            std::uint64_t high = partial.high + (low < carry ? 1U : 0U);
+            product[i + j] += low;
+            high += product[i + j] < low ? 1U : 0U;
+            carry = high;
+        }
+        product[i + Words] = carry;
+    }
+
+    return exponent - lz + static_cast<std::int64_t>(64 * Words);
+}
+
+template <typename T, std::size_t Words>
+inline from_chars_result extended_round(const std::uint64_t* product, std::int64_t exponent, bool negative, T& value) noexcept
+{
+    bool sticky = false;
+    for (std::size_t i = 0; i < Words; ++i)
+    {
+        sticky = sticky || product[i] != 0;
+    }
+
+    return slow_path_round(nullptr, negative, product[Words + 1], product[Words], sticky, exponent, value);
+}
+
+template <typename T, std::size_t Words, typename Unsigned_Integer>
+inline std::errc compute_float_extended(std::int64_t q, Unsigned_Integer significand, bool negative, T& value) noexcept
+{
+    std::uint64_t high;
+    std::uint64_t low;
+    extended_split(significand, high, low);
+
+    std::uint64_t power[Words];
+    std::uint64_t lower[Words + 2] {};
+    int lz;
+    const std::int64_t exponent = extended_product<Words>(q, high, low, power, lower, lz);
+
+    std::uint64_t upper[Words + 2];
+    std::memcpy(upper, lower, sizeof(upper));
+    std::uint64_t carry = 0;
+
+    // The parser keeps at most 38 digits. With 38 digits (w >= 10^37) the rest may have been dropped
+    // and the exact significand lies in [w, w + 1), so the upper end also adds (1 << lz) * power
+    if (high > UINT64_C(0x0785EE10D5DA46D9) || (high == UINT64_C(0x0785EE10D5DA46D9) && low >= UINT64_C(0x00F436A000000000)))
+    {
+        for (std::size_t i = 0; i < Words; ++i)
+        {
+            carry |= extended_add(upper, Words + 2, i, power[i] << lz);
+            if (lz != 0)
+            {
+                carry |= extended_add(upper, Words + 2, i + 1, power[i] >> (64 - lz));
+            }
+        }
+    }
+
+    // Error of the truncated power of ten
+    carry |= extended_add(upper, Words + 2, 2, 4);
+    if (carry != 0)
+    {
+        return std::errc::not_supported;
+    }
+
+    T lower_value {};
+    const auto r = extended_round<T, Words>(lower, exponent, negative, lower_value);
+
+    // The top 128 bits have at least p + 1 significant bits, so the round bit is never below bit 128 - p - 2.
+    // When both ends agree on everything above that bit, and the lower end is not exactly on it or a tie,
+    // they round the same way for normal and subnormal results alike
+    constexpr int certain_bit = 128 - slow_path_format<T>::digits - 2;
+    bool inexact = false;
+    for (std::size_t i = 0; i < Words; ++i)
+    {
+        inexact = inexact || lower[i] != 0;
+    }
+    inexact = inexact || (lower[Words] & ((UINT64_C(1) << certain_bit) - 1)) != 0;
+
+    if (lower[Words + 1] != upper[Words + 1] || ((lower[Words] ^ upper[Words]) >> certain_bit) != 0 || !inexact)
+    {
+        T upper_value {};
+        extended_round<T, Words>(upper, exponent, negative, upper_value);
+        if (!(lower_value == upper_value))
+        {
+            return std::errc::not_supported;
+        }
+    }
+
+    value = lower_value;
+    return r.ec;
+}
+
 #ifdef BOOST_CHARCONV_HAS_FLOAT128
 template <typename Unsigned_Integer>
 inline __float128 compute_float128(std::int64_t q, Unsigned_Integer w, bool negative, std::errc& success) noexcept
 {
-    // GLIBC uses 2^-16444 but MPFR uses 2^-16445 as the smallest subnormal value for 80 bit
+    // The smallest subnormal value is 2^-16494 (about 6.5e-4966)
     // 39 is the max number of digits in an uint128_t
-    static constexpr auto smallest_power = -4951 - 39;
+    static constexpr auto smallest_power = -4966 - 39;
     static constexpr auto largest_power = 4932;
 
-    if (-55 <= q && q <= 48 && w <= static_cast<Unsigned_Integer>(1) << 113)
+    // Clinger's fast path needs the power of ten to be exact, and 5^49 does not fit into the 113-bit significand
+    if (-48 <= q && q <= 48 && w <= static_cast<Unsigned_Integer>(1) << 113)
     {
         success = std::errc();
-        return fast_path<__float128>(q, w, negative, powers_of_tenq);
+        return fast_path<__float128>(q, w, negative, float80_powers_table::powers_of_tenq);
     }
 
     if (w == 0)
@@ -101,7 +332,7 @@ inline __float128 compute_float128(std::int64_t q, Unsigned_Integer w, bool nega
     else if (q > largest_power)
     {
         success = std::errc::result_out_of_range;
-        return negative ? -HUGE_VALQ : HUGE_VALQ;
+        return negative ? -__builtin_huge_valq() : __builtin_huge_valq();
     }
     else if (q < smallest_power)
     {
@@ -109,17 +340,19 @@ inline __float128 compute_float128(std::int64_t q, Unsigned_Integer w, bool nega
         return negative ? -0.0Q : 0.0Q;
     }
 
-    success = std::errc::not_supported;
-    return 0;
+    __float128 value = 0;
+    success = compute_float_extended<__float128, 4>(q, w, negative, value);
+    return value;
 }
 #endif
 
 template <typename ResultType, typename Unsigned_Integer>
 inline ResultType compute_float80(std::int64_t q, Unsigned_Integer w, bool negative, std::errc& success) noexcept
 {
-    // GLIBC uses 2^-16444 but MPFR uses 2^-16445 as the smallest subnormal value for 80 bit
+    // GLIBC uses 2^-16444 but MPFR uses 2^-16445 as the smallest subnormal value for 80 bit,
+    // and the smallest binary128 subnormal value is 2^-16494
     // 39 is the max number of digits in an uint128_t
-    static constexpr auto smallest_power = -4951 - 39;
+    static constexpr auto smallest_power = BOOST_CHARCONV_LDBL_BITS == 80 ? -4951 - 39 : -4966 - 39; // NOLINT : Only changes by platform
     static constexpr auto largest_power = 4932;
 
     // We start with a fast path
@@ -127,13 +360,17 @@ inline ResultType compute_float80(std::int64_t q, Unsigned_Integer w, bool negat
     // How to read floating point numbers accurately.
     // ACM SIGPLAN Notices. 1990
     // https://dl.acm.org/doi/pdf/10.1145/93542.93557
+    //
+    // Both the significand and the power of ten have to be exact,
+    // so 5^q and w have to fit into the 64-bit or 113-bit significand
     static constexpr auto clinger_max_exp = BOOST_CHARCONV_LDBL_BITS == 80 ? 27 : 48;   // NOLINT : Only changes by platform
-    static constexpr auto clinger_min_exp = BOOST_CHARCONV_LDBL_BITS == 80 ? -34 : -55; // NOLINT
+    static constexpr auto clinger_min_exp = BOOST_CHARCONV_LDBL_BITS == 80 ? -27 : -48; // NOLINT
+    static constexpr auto clinger_max_bits = BOOST_CHARCONV_LDBL_BITS == 80 ? 64 : 113; // NOLINT
 
-    if (clinger_min_exp <= q && q <= clinger_max_exp && w <= static_cast<Unsigned_Integer>(1) << 113)
+    if (clinger_min_exp <= q && q <= clinger_max_exp && w <= static_cast<Unsigned_Integer>(1) << clinger_max_bits)
     {
         success = std::errc();
-        return fast_path<ResultType>(q, w, negative, powers_of_ten_ld);
+        return fast_path<ResultType>(q, w, negative, float80_powers_table::powers_of_ten_ld);
     }
 
     if (w == 0)
@@ -152,8 +389,10 @@ inline ResultType compute_float80(std::int64_t q, Unsigned_Integer w, bool negat
         return negative ? -0.0L : 0.0L;
     }
 
-    success = std::errc::not_supported;
-    return 0;
+    // The 64-bit significand of the 80-bit format only needs the top half of the 256-bit powers
+    ResultType value = 0;
+    success = compute_float_extended<ResultType, BOOST_CHARCONV_LDBL_BITS == 80 ? 2 : 4>(q, w, negative, value);
+    return value;
 }
 
 #endif // BOOST_CHARCONV_LDBL_BITS > 64
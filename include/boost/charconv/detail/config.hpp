@@ -27,9 +27,48 @@
 #  define BOOST_CHARCONV_UINT128_MAX (2 * static_cast<boost::uint128_type>(BOOST_CHARCONV_INT128_MAX) + 1)
 #endif
 
+// With BOOST_CHARCONV_FREESTANDING nothing calls into the C library (printf, strtod, localeconv) or libquadmath,
+// so that the library can be used without a C runtime. __float128 is then classified with compiler builtins
+//
+// With BOOST_CHARCONV_NO_LOCALE (implied by BOOST_CHARCONV_FREESTANDING) no conversion reads the process locale
+// or takes a lock: the printf fallback for long double formats that the library does not know gives
+// std::errc::not_supported instead, so that conversions scale across threads whatever the values are
+#if defined(BOOST_CHARCONV_FREESTANDING) && !defined(BOOST_CHARCONV_NO_LOCALE)
+#  define BOOST_CHARCONV_NO_LOCALE
+#endif
+
 #if defined(BOOST_HAS_FLOAT128) && !defined(__STRICT_ANSI__) && !defined(BOOST_CHARCONV_NO_QUADMATH)
 #  define BOOST_CHARCONV_HAS_FLOAT128
-#  include <quadmath.h>
+#  ifndef BOOST_CHARCONV_FREESTANDING
+#    include <quadmath.h>
+#  endif
+#endif
+
+// Decimal to_chars of a value below BOOST_CHARCONV_SMALL_INTEGER_LIMIT copies its digits from a table of 4 characters
+// per value, e.g. status codes, ports and counts. It is 10000 by default (a 40 KB table), and can be 1000, 100 or 10
+// for a smaller table, or 0 to not have one
+#ifndef BOOST_CHARCONV_SMALL_INTEGER_LIMIT
+#  define BOOST_CHARCONV_SMALL_INTEGER_LIMIT 10000
+#endif
+
+#if BOOST_CHARCONV_SMALL_INTEGER_LIMIT != 0 && BOOST_CHARCONV_SMALL_INTEGER_LIMIT != 10 && BOOST_CHARCONV_SMALL_INTEGER_LIMIT != 100 && \
+    BOOST_CHARCONV_SMALL_INTEGER_LIMIT != 1000 && BOOST_CHARCONV_SMALL_INTEGER_LIMIT != 10000
+#  error BOOST_CHARCONV_SMALL_INTEGER_LIMIT has to be 0, 10, 100, 1000 or 10000
+#endif
+
+// The integer conversions can be called from CUDA, HIP and SYCL kernels. BOOST_CHARCONV_DEVICE_COMPILE is defined
+// in the pass that compiles them for the device, which uses the portable paths instead of SIMD and the host tables.
+// Defining it for a host build compiles the same paths, so that they can be tested without a device
+#if defined(__CUDACC__) || defined(__HIPCC__)
+#  define BOOST_CHARCONV_GPU_ENABLED __host__ __device__
+#  if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+#    define BOOST_CHARCONV_DEVICE_COMPILE
+#  endif
+#else
+#  define BOOST_CHARCONV_GPU_ENABLED
+#  ifdef __SYCL_DEVICE_ONLY__
+#    define BOOST_CHARCONV_DEVICE_COMPILE
+#  endif
 #endif
 
 #ifndef BOOST_NO_CXX14_CONSTEXPR
@@ -71,7 +110,9 @@
 #endif // Determine endianness
 
 // Inclue intrinsics if available
-#if defined(BOOST_MSVC)
+#if defined(BOOST_CHARCONV_DEVICE_COMPILE)
+#  define BOOST_CHARCONV_HAS_NO_INTRINSICS
+#elif defined(BOOST_MSVC)
 #  include <intrin.h>
 #  if defined(_WIN64)
 #    define BOOST_CHARCONV_HAS_MSVC_64BIT_INTRINSICS
@@ -88,6 +129,34 @@
 #  define BOOST_CHARCONV_HAS_NO_INTRINSICS
 #endif
 
+// 128-bit vector instructions used for scanning runs of characters
+#if defined(BOOST_CHARCONV_DEVICE_COMPILE)
+// Device code has neither
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define BOOST_CHARCONV_HAS_SSE2
+#elif defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#  include <arm_neon.h>
+#  define BOOST_CHARCONV_HAS_NEON
+#endif
+
+// Kernels for AVX2 and AVX-512 that the compiled library selects at run time, see detail/cpu_features.hpp.
+// They are built with target attributes, so they do not need -mavx2, and only used by the code of the library
+// (or with BOOST_CHARCONV_HEADER_ONLY), so that the headers do not need to link it.
+// Define BOOST_CHARCONV_NO_RUNTIME_DISPATCH to use SSE2 only. BOOST_CHARCONV_FREESTANDING implies it,
+// since the selected kernel is cached in a static variable
+#if defined(BOOST_CHARCONV_HAS_SSE2) && !defined(BOOST_CHARCONV_NO_RUNTIME_DISPATCH) && !defined(BOOST_CHARCONV_FREESTANDING) && \
+    (defined(BOOST_CHARCONV_SOURCE) || defined(BOOST_CHARCONV_HEADER_ONLY)) && \
+    ((defined(__x86_64__) && ((defined(__GNUC__) && __GNUC__ >= 5) || defined(__clang__))) || (defined(_M_X64) && defined(_MSC_VER) && _MSC_VER >= 1910 && !defined(__clang__)))
+#  define BOOST_CHARCONV_HAS_RUNTIME_DISPATCH
+#endif
+
+// The tables of powers of ten start on a cache line. Their entries are in the order of the exponent, so that the entries
+// of a band of exponents, such as those of 1e-6 to 1e9, are contiguous and take the same lines in every build,
+// rather than one line more or less depending on where the linker put the table
+#define BOOST_CHARCONV_CACHE_LINE_SIZE 64
+#define BOOST_CHARCONV_CACHE_LINE_ALIGNED alignas(BOOST_CHARCONV_CACHE_LINE_SIZE)
+
 static_assert((BOOST_CHARCONV_ENDIAN_BIG_BYTE || BOOST_CHARCONV_ENDIAN_LITTLE_BYTE) &&
              !(BOOST_CHARCONV_ENDIAN_BIG_BYTE && BOOST_CHARCONV_ENDIAN_LITTLE_BYTE),
 "Inconsistent endianness detected. Please file an issue at https://github.com/cppalliance/charconv with your architecture");
@@ -162,6 +231,22 @@ static_assert((BOOST_CHARCONV_ENDIAN_BIG_BYTE || BOOST_CHARCONV_ENDIAN_LITTLE_BY
 #  define BOOST_CHARCONV_NO_CONSTEXPR_DETECTION
 #endif
 
+// The floating point paths can only be evaluated at compile time with std::bit_cast and std::is_constant_evaluated
+#if defined(__has_include)
+#  if __has_include(<version>)
+#    include <version>
+#  endif
+#endif
+
+#if defined(__cpp_lib_bit_cast) && __cpp_lib_bit_cast >= 201806L && \
+    defined(__cpp_lib_is_constant_evaluated) && __cpp_lib_is_constant_evaluated >= 201811L
+#  include <bit>
+#  define BOOST_CHARCONV_HAS_CONSTEXPR_FLOAT
+#  define BOOST_CHARCONV_CXX20_CONSTEXPR constexpr
+#else
+#  define BOOST_CHARCONV_CXX20_CONSTEXPR
+#endif
+
 #ifdef BOOST_MSVC
 #  define BOOST_CHARCONV_ASSUME(expr) __assume(expr)
 #elif defined(__clang__)
@@ -178,6 +263,30 @@ static_assert((BOOST_CHARCONV_ENDIAN_BIG_BYTE || BOOST_CHARCONV_ENDIAN_LITTLE_BY
 #  define BOOST_CHARCONV_ASSUME(expr)
 #endif
 
+// Size of the power of ten tables used by to_chars for double, as a trade of speed against the cache footprint.
+// BOOST_CHARCONV_CACHE_POLICY selects the main tables of Dragonbox and floff: full (the default, about 20 KB)
+// stores every entry, and compact (about 600 bytes) stores one in 27 and recovers the others with a multiplication.
+// BOOST_CHARCONV_EXTENDED_CACHE_POLICY selects the floff table used for the digits past the first 18 or 19:
+// long (about 3.6 KB) or compact (about 600 bytes), and defaults to the same size as the main tables.
+// These are properties of the compiled library, so they have to be set when building it
+#define BOOST_CHARCONV_CACHE_POLICY_FULL 0
+#define BOOST_CHARCONV_CACHE_POLICY_COMPACT 1
+
+#ifndef BOOST_CHARCONV_CACHE_POLICY
+#  define BOOST_CHARCONV_CACHE_POLICY BOOST_CHARCONV_CACHE_POLICY_FULL
+#endif
+
+#define BOOST_CHARCONV_EXTENDED_CACHE_POLICY_LONG 0
+#define BOOST_CHARCONV_EXTENDED_CACHE_POLICY_COMPACT 1
+
+#ifndef BOOST_CHARCONV_EXTENDED_CACHE_POLICY
+#  if BOOST_CHARCONV_CACHE_POLICY == BOOST_CHARCONV_CACHE_POLICY_COMPACT
+#    define BOOST_CHARCONV_EXTENDED_CACHE_POLICY BOOST_CHARCONV_EXTENDED_CACHE_POLICY_COMPACT
+#  else
+#    define BOOST_CHARCONV_EXTENDED_CACHE_POLICY BOOST_CHARCONV_EXTENDED_CACHE_POLICY_LONG
+#  endif
+#endif
+
 // Detection for C++23 fixed width floating point types
 // All of these types are optional so check for each of them individually
 #if (defined(_MSVC_LANG) && _MSVC_LANG > 202002L) || __cplusplus > 202002L
@@ -201,4 +310,9 @@ static_assert((BOOST_CHARCONV_ENDIAN_BIG_BYTE || BOOST_CHARCONV_ENDIAN_LITTLE_BY
 #  define BOOST_CHARCONV_HAS_BRAINFLOAT16
 #endif
 
+// C++20 char8_t, which from_chars and to_chars accept as a character type
+#if defined(__cpp_char8_t) && __cpp_char8_t >= 201811L
+#  define BOOST_CHARCONV_HAS_CHAR8_T
+#endif
+
 #endif // BOOST_CHARCONV_DETAIL_CONFIG_HPP
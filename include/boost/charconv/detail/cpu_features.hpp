@@ -0,0 +1,42 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_CPU_FEATURES_HPP
+#define BOOST_CHARCONV_DETAIL_CPU_FEATURES_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/config.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost { namespace charconv { namespace detail {
+
+// The instruction sets of the host that the kernels of the library can use, which the CPU and the operating system
+// both support. Detected on the first call, without taking a lock
+struct cpu_features
+{
+    bool avx2;
+    bool avx512bw;
+    bool f16c;
+};
+
+BOOST_CHARCONV_DECL cpu_features host_cpu_features() noexcept;
+
+// Skips whole blocks of digits ([0-9] or [0-9a-fA-F] for hex) of [first, last) with the widest kernel of the host,
+// 64 characters per step with AVX-512BW and 32 with AVX2, and returns a pointer that is at most the first character
+// that is not a digit. Returns first when the host has neither, so that the caller goes on with SSE2
+BOOST_CHARCONV_DECL const char* skip_long_digit_run(const char* first, const char* last, bool hex) noexcept;
+
+// Widens the binary16 values of bits to float with F16C, 8 at a time, up to the first block of 8 that holds an infinity
+// or a NaN, and returns how many were written to out. vcvtph2ps sets the quiet bit of a signaling NaN, so those blocks are
+// left to the caller, like the values past the last whole block. Returns 0 when the host does not have F16C
+BOOST_CHARCONV_DECL std::size_t widen_binary16_blocks(const std::uint16_t* bits, std::size_t n, float* out) noexcept;
+
+}}} // Namespaces
+
+#ifdef BOOST_CHARCONV_HEADER_ONLY
+#  include <boost/charconv/detail/impl/cpu_features.ipp>
+#endif
+
+#endif // BOOST_CHARCONV_DETAIL_CPU_FEATURES_HPP
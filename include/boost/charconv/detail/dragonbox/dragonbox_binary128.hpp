@@ -0,0 +1,924 @@
+// Copyright 2020-2022 Junekey Jeon
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_DRAGONBOX_DRAGONBOX_BINARY128_HPP
+#define BOOST_CHARCONV_DETAIL_DRAGONBOX_DRAGONBOX_BINARY128_HPP
+
+// Shortest round trip output of IEEE 754 binary128 (__float128, std::float128_t, and long double where it has 113
+// significand bits) with the Dragonbox algorithm, in place of the generic Ryu path which needs a 128-bit division and
+// several 256-bit multiplications per digit it removes.
+//
+// The cache holds the 256-bit significands of 10^k rounded up, for -4897 <= k <= 4969. Only one in
+// compressed_cache_detail::compression_ratio of them is stored, and the others are recovered with a multiplication
+// by a power of five as for binary64, which leaves them at most two above the rounded up value
+// and their upper 128 bits exact.
+//
+// Dragonbox needs the product of the cache and a 115-bit integer to be within the error of the cache of the right
+// integer. With 256 bits that holds for all but a few (k, beta) pairs and inputs, which the continued fraction of
+// 10^k * 2^beta puts at a distance below 2^-126 of an integer. These are detected from the fraction bits of the
+// product, a one in 2^126 event, and to_decimal then returns false for the caller to fall back to Ryu.
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/dragonbox/dragonbox_common.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+
+namespace boost { namespace charconv { namespace detail { namespace dragonbox_binary128 {
+
+using carrier_uint = boost::uint128_type;
+
+static constexpr int significand_bits = 112;
+static constexpr int exponent_bits = 15;
+static constexpr int min_exponent = -16382;
+static constexpr int exponent_bias = -16383;
+
+// floor(log10(2^(carrier_bits - significand_bits - 2))) - 1
+static constexpr int kappa = 3;
+static constexpr std::uint32_t big_divisor = 10000;
+static constexpr std::uint32_t small_divisor = 1000;
+
+// The cache is exact, or the products with it close enough to tell integers apart, for 10^k with -49 <= k <= 54.
+// Outside of that no product of a binary128 endpoint and 10^k is an integer
+static constexpr int min_integer_k = -49;
+static constexpr int max_integer_k = 54;
+
+static constexpr int case_shorter_interval_left_endpoint_lower_threshold = 2;
+static constexpr int case_shorter_interval_left_endpoint_upper_threshold = 3;
+static constexpr int shorter_interval_tie_lower_threshold =
+    -log::floor_log5_pow2_minus_log5_3(significand_bits + 4) - 2 - significand_bits;
+static constexpr int shorter_interval_tie_upper_threshold =
+    -log::floor_log5_pow2(significand_bits + 2) - 2 - significand_bits;
+
+// The log functions of dragonbox_common.hpp only cover the exponents of binary64.
+// These are exact over -16500 <= e <= 16500 and -5000 <= k <= 5000
+namespace log {
+
+constexpr int floor_log10_pow2(int e) noexcept
+{
+    return static_cast<int>((std::int64_t(e) * INT64_C(20201781)) >> 26);
+}
+
+constexpr int floor_log2_pow10(int k) noexcept
+{
+    return static_cast<int>((std::int64_t(k) * INT64_C(55732705)) >> 24);
+}
+
+constexpr int floor_log10_pow2_minus_log10_4_over_3(int e) noexcept
+{
+    return static_cast<int>((std::int64_t(e) * INT64_C(20201781) - INT64_C(8384493)) >> 26);
+}
+
+} // Namespace log
+
+struct cache_entry_type
+{
+    carrier_uint high;
+    carrier_uint low;
+};
+
+template <bool b>
+struct cache_holder_impl
+{
+    static constexpr int min_k = -4897;
+    static constexpr int max_k = 4969;
+    static constexpr int compression_ratio = compressed_cache_detail::compression_ratio;
+    static constexpr std::size_t compressed_table_size = (max_k - min_k + compression_ratio) / compression_ratio;
+
+    // ceil(10^k * 2^(255 - floor(log2(10^k)))) for k = min_k, min_k + 27, ..., from the most significant word
+    static constexpr std::uint64_t table[][4] = {
+            {0xb74ea21ab2946479, 0xbab3a28a6f0a489c, 0x5a7d22b5236bcad4, 0xc09b7fe7c4659d9c},
+            {0x9413084d8f348794, 0x925af3e6cef5dd98, 0x244977e2d3f77d85, 0x77343f249a702941},
+            {0xef3a1d2778f63353, 0xb29c910ea124e63d, 0xf42d431253c5c486, 0x5b42291696837bd6},
+            {0xc13efc51ade7df64, 0xe05fe4207ca3d508, 0x4e3cc383eaa17b7b, 0x0333d510cf27e5a6},
+            {0x9c1a580c2687c913, 0x32ac28e9d82f8955, 0x0c7359ab6f16eafc, 0x4f0b0a9839303553},
+            {0xfc32a61159655ab2, 0x38bff09b3d6f48d8, 0xc832da0ac29f1aa2, 0x8e42c81cf0546d17},
+            {0xcbb94ad34cac4b8b, 0xf7ac3df2f8d2a9da, 0xdf3037bfa11448f9, 0x4ca26954a0d027a2},
+            {0xa4911810a98cfe08, 0x3897d402e6c26e88, 0xed5014f6e7d3c0ce, 0x59e12946702adb57},
+            {0x84ef9c723920c754, 0x5168595226582eb2, 0x950850a131146617, 0xf31c1e299634ae60},
+            {0xd6c50877206aaf59, 0x03c7047f8a0d30f9, 0xb57d42a3cb6882c4, 0x2295408a0e941888},
+            {0xad7d5327271a146d, 0x02c036754c3a1df7, 0xd04bfaaf70ecd80e, 0xcaf4bd3667d060fc},
+            {0x8c24cc4e867eb529, 0xcd77bc4633689770, 0xbec56ff2c1071641, 0xee47fcda0444abbd},
+            {0xe26a17e73fbc7205, 0xb499658ab5a84046, 0x28c02b6f41dabce0, 0x744d223671928049},
+            {0xb6e567f9a3167886, 0xe457bf75827b5692, 0xe3252326713fede0, 0x9228854905f4920e},
+            {0x93be07db04a13f97, 0x542c608c1525e9a6, 0x6e8f5f31c4c815f5, 0xf9867e4d891f9076},
+            {0xeeb0c9415b412e08, 0xa23f1d392662a809, 0xb738eda2a0950559, 0xc0db3fc65e1ee875},
+            {0xc0d00d9c2f3a5ec6, 0xa60a3caf9c5492cd, 0x9ac6ece1c1a3197f, 0xba41c88f602c942f},
+            {0x9bc0bbc0c8052f2c, 0x3e7013bec05ffc21, 0x194d3593e4723db4, 0x1cfb6b3ce3130564},
+            {0xfba1e005f52e8cf4, 0x57c0c0c5ea4a820e, 0xf5a28c9f7f215628, 0xc9bf1a8b71b1035d},
+            {0xcb44585821c722ec, 0xec6ec617f2819a18, 0x6489536309952135, 0xe81189ae24fdce13},
+            {0xa4329ff3dfaa5024, 0xd3d87d88c0ca1310, 0xcde67393e4026c7b, 0x1e4556d5e6193982},
+            {0x84a34cacfc01d12e, 0xffe4caaa907b2292, 0x9ab22907abaaa9f2, 0xbdbec31707fd227f},
+            {0xd649beb9d64db88c, 0x5d3bc457c80a031e, 0xed170cfb97f31f9b, 0x02e6a2ac6517c2b9},
+            {0xad19bbc86aee76e7, 0x30a0831fe1304870, 0x43417ab584d5c595, 0x3e34b2715c21cb6f},
+            {0x8bd4594f91db7288, 0x0a01eafd1d6cc17e, 0x40a082d518ab3fe0, 0xd7a8fdd032b0455b},
+            {0xe1e81ee494186984, 0x6f4a6a30fdd6111e, 0x8751a1f693714331, 0x039183f5ed355a79},
+            {0xb67c6a405978ffb5, 0xf25b5ae38d1a96d1, 0xee6a58595a5fdb3a, 0x27dd10bd84e5be5b},
+            {0x936938340359e22c, 0xa64ea358dfcf3467, 0x6192c77a2778cd8c, 0x67d54b5e43146e91},
+            {0xee27c43067e0b31e, 0x522ed8945302acd3, 0xfe4bcc8486b450ef, 0x13e4485a3c7faeca},
+            {0xc0615e94e7bad6d7, 0xb90686d0c60e1b20, 0x95a5138d85e1b5e1, 0xbd61265f9ade8f45},
+            {0x9b6752e63cab95ed, 0xa9816751a676397a, 0xeccdcfb68a83ec1b, 0x4338bd91ee2ed9cd},
+            {0xfb116d15f344b9b0, 0x953d136b9a19cdb5, 0x3cc4fe5541a1306d, 0x3aabf07c983d152b},
+            {0xcacfa8ff152c233c, 0x404254207f3f4f5c, 0x39c1d81f75f8b317, 0xb22dbabd6ac3b162},
+            {0xa3d45e11ebbfdd22, 0xabe84d7fea1a94fb, 0xd3e29a4f22b48884, 0x6c0d347e760535ec},
+            {0x845728b6360b9a74, 0xbe250181ae1a520d, 0x75c1619a24947b52, 0xf11114e3f20632bb},
+            {0xd5cebbc27e65a603, 0xf81807575fd38f1e, 0x51cb9794eeabc016, 0x59da85a36d8f433d},
+            {0xacb65d953e3416f2, 0x46a1318f79dfe933, 0x792ad4fe1fe9395b, 0xf69971b1af4c25d3},
+            {0x8b84147f20284f84, 0x7c72eae77cd5608f, 0x60371cc9b70232c2, 0x6c4b8e31229450a3},
+            {0xe166707e3498dd40, 0x50d99ebb1f694cee, 0x288e69d832a591fd, 0x63a4a50c7b70a354},
+            {0xb613a8cc28ca374b, 0x05a503eb272cc542, 0x836fbac287cd7a03, 0xb1a6126d0237f1be},
+            {0x9314993c88a15ce7, 0x7a77a235e021f3a1, 0x7cdd929d9e2ba85b, 0x4659b052bd4dd44d},
+            {0xed9f0dc75de0cd44, 0x8a09f5043b279b1d, 0x4387d5a60e2ac79a, 0x85dcda374ca12df1},
+            {0xbff2ef1749292865, 0xb293d505b66ebc4e, 0x33bfbc083532baf3, 0xe9d145163e581b75},
+            {0x9b0e1d5efcf22639, 0xcede6f194474c022, 0x1747a37896c7b291, 0x3fe99ed013129f25},
+            {0xfa814d119e91ad0b, 0x94db906123225e60, 0x9c5fd0022cae7afb, 0xaebe986274da50ce},
+            {0xca5b3ca19d34288a, 0xd3f8b6a11bde8906, 0x5a3afebde3e7a5e5, 0x6f3966d9c102a9be},
+            {0xa376524bac6471a5, 0xc18284b9beaadbde, 0x4dd6d9b10a7eee52, 0x05a4f0d06a132464},
+            {0x840b3074c19a94e0, 0x4056bdc43c50b4ec, 0xd70eec1088bcde87, 0xa99c4ff6719f5686},
+            {0xd553ff6878216d7e, 0x859c3d35d2ebc4ed, 0x7a04b70eaf7f29b7, 0xa57d0a58138f6cd4},
+            {0xac53386ccf683342, 0x5ca6e44dee8d33ce, 0x762a4f19c2c6dbb1, 0x6d5e42299959c671},
+            {0x8b33fdc2aeb597bd, 0x88220b9ad7ed40b6, 0x058da952ab40d794, 0x6dcd779b9b0cd752},
+            {0xe0e50c894cc21dfd, 0x81884dd8cb5eb34a, 0x294d82f85639fb9c, 0x6ddd26ef279b0d06},
+            {0xb5ab237a780026cf, 0xb488122830b22f41, 0x6cffe2faffdfb62f, 0xe34b0e471219629e},
+            {0x92c02ad8a1cef60d, 0xa136f1c944446f98, 0x857679af3ee9c2b4, 0x3e407abc8f50af95},
+            {0xed16a5d91647d82b, 0x5bb8126cf1430f6f, 0x4de36657a3da7e18, 0x087832a148ed0528},
+            {0xbf84befeda414971, 0x841a8f22aca55cba, 0xb920e80d2c67ca5a, 0xa23d2065f522f5a1},
+            {0x9ab51b0d924391a3, 0x406f7004039e42ab, 0xe2515cb48f80e562, 0x914a1d676ada1a67},
+            {0xf9f17fc95d621855, 0xb757828a0a9cb678, 0x2f0e0657f9950663, 0x9a1c7555824c0f8a},
+            {0xc9e7131946576a0e, 0xf86b4f750d5d6094, 0x1ccfe338c55891ea, 0x9bb18b843c01d69e},
+            {0xa3187c82120dace6, 0x7401c6f091f87727, 0x08251c601e346456, 0x40ed8056af76ac44},
+            {0x83bf63cf877ab54e, 0xdc109c6f283a3ef0, 0x782c82708af1cbce, 0x048bd6bdbf37e04d},
+            {0xd4d989833a4270c5, 0x81bc6a3204eb765a, 0xd12b0ba9845a8fd0, 0x0fdc797484cccb3c},
+            {0xabf04c2e5fdee8e2, 0x9467735ae8a66a70, 0x972a4b0dd4fe9a9f, 0x27a78eac38c29642},
+            {0x8ae414ffca0b78a6, 0xe037643adf69f154, 0x28092b0160d2da96, 0xa3fdd7e28de58b77},
+            {0xe063f2db20ae9f98, 0xccb1ccef123f00bd, 0xf93beb7f447e3de0, 0xc3634c7eef9eee85},
+            {0xb542da28c1ed32d8, 0xf10c71059bef1855, 0xb4c6d9fe94536e23, 0x99d18448e9e2b7d8},
+            {0x926becec6c45119d, 0x08653838c58a9eb0, 0x643742a067e7d510, 0xb04299b53b3fbed3},
+            {0xec8e8c38840796e9, 0xb770cee5123a5dd6, 0x8bc30a99c36e5e05, 0xbdd32df8e0f9617d},
+            {0xbf16ce2736af395a, 0x6ed0995755b03bde, 0xcc971ea625937d0c, 0x92f0060f9365be6c},
+            {0x9a5c4bd496f45753, 0x3be1d5234b9fdf4d, 0xfe6df49f296a2f72, 0xc925afab924695db},
+            {0xf962050db155d974, 0x61fecd00e68463a7, 0x7ba40493f8fa747b, 0xf65a9e25ff0fdcb0},
+            {0xc9732c3fb320c71a, 0xfbedd1f7dcae406d, 0x7ab342913ad88003, 0x2efdce0eed642802},
+            {0xa2badc961f05be86, 0xd4b6f02d493a81c7, 0xa496473515e55988, 0x0495133b655e8a18},
+            {0x8373c2ad7edf2a59, 0xfcfb59d62dee0d6d, 0x7f22b760ba1253c2, 0x7d38ca483fb37ad0},
+            {0xd45f59ea52cf1a5e, 0x7da8d742d35eba3a, 0x4950ff1ecf7967f8, 0xeb3caca6d3d68813},
+            {0xab8d98b943b862a6, 0x876a27a72e171a44, 0xa75aa337c7c5434f, 0xc9267fc73f5c7aaf},
+            {0x8a945a1c0de1451d, 0x60f2841d196ac766, 0x33808da7f3d473ee, 0xff428b06158e3044},
+            {0xdfe323490d00dbe4, 0xf9b8f0e6ccde36a8, 0x995ead7ef7adab9c, 0x1dbc100e581f60f9},
+            {0xb4daccb49534b65c, 0x2788f6e2d3549d06, 0xdb9fd135f6202de2, 0x72987efe65299440},
+            {0x9217df5c1567fb9d, 0x7022ac7459862eaf, 0x880bccd20d9cd5f2, 0xc81d100744cf76a7},
+            {0xec06c0b8b3ee52f3, 0x7bc1c3a68f8d0d4b, 0x8009059216f34d22, 0x0bb65b3f6554d859},
+            {0xbea91c6c0f02fbf3, 0x3fb5d48d6ea56439, 0x8ed1751bee01791e, 0x70146221909faecc},
+            {0x9a03af96b6390e86, 0x222496be8c2fd150, 0x7e89219a3ea7ee0b, 0x81dd0e4571f989b9},
+            {0xf8d2dcaf37504b51, 0x9492db3d978aaca8, 0x50d3e92e2e4f8210, 0x946e2f2071475acb},
+            {0xc8ff87ee9c211b5d, 0xf7e0be0e7d08f371, 0x4756563338091538, 0xd6f08bd0d92b8f01},
+            {0xa25d7268e7612a4b, 0x85cdea5bf79d4c19, 0x239e79b0ea747c2d, 0xfdb12e3a18617f8b},
+            {0x83284cf5ad5a17b2, 0x628207e6a2ecff5b, 0x7df4c3da994239ca, 0x74569f2753b7b2e8},
+            {0xd3e57075670581eb, 0xda84beac12680510, 0x2362cf9a1702089d, 0x95b69ee78076f530},
+            {0xab2b1dece1d60ed0, 0xfdb71ed7cd9b8e9f, 0x093f15867b5446d2, 0xe74be30ab7e4136a},
+            {0x8a44ccfd2514bdfe, 0xb927745ecf035059, 0x0a28420f09ceed2c, 0x65ac92f009eb920e},
+            {0xdf629da886d53da2, 0x41b4f6bbedd87589, 0xd82ac3d90c3da0f0, 0x427f7317bddcda26},
+            {0xb472fafb943fa28f, 0xd19c70f25ea3841d, 0xb987afdb6c11dd30, 0x14475f6a311e654e},
+            {0x91c4020bda94b7bb, 0x8bb7fd84a0f9c8d6, 0x39228216f1329f20, 0xa1324d20133fc12e},
+            {0xeb7f432ccc98039a, 0x178fa7718cd79a3c, 0x75457b71fb996f35, 0x1cc5f894745c948f},
+            {0xbe3ba9a928a49b7d, 0xd7b135dc9029d2e4, 0xc219dd15bb99d2f9, 0xabcb11eb0fb628f7},
+            {0x99ab4636ac1cb69a, 0xbca0f10146b4d9a2, 0xd80ba657540f7601, 0x8cd7aaacd2258718},
+            {0xf844067ea7689f4c, 0x9f52a93384c4e053, 0xd679661b412a5c0f, 0xd8843cc50660bad5},
+            {0xc88c25ffcfe29a6a, 0xaf1275c913448af0, 0xbdfe5ce0f33acb47, 0xc9ad3a2770cc195a},
+            {0xa2003ddb90f491b4, 0xc3595d1b8c25698d, 0x3d6c30ece695c354, 0xd2bd0d11b958266d},
+            {0x82dd028f26d4563a, 0x6b78172159fa0165, 0xfdcea0b8fa132196, 0x1988e8259d238db5},
+            {0xd36bccfc334e1838, 0x8ae3a86aa9eb109b, 0x34f0e3cf9b1af020, 0x69e83eed846b5b38},
+            {0xaac8dba8b3cfdaec, 0x5ce2ab3cd3a147da, 0xc67ebde29b7a6a5d, 0xa1df654285998e3f},
+            {0x89f56d88c9a15fc2, 0x02f9acd410b5c3bb, 0x0f9e1355db78040e, 0xdfed0a7235ced520},
+            {0xdee261cf1bb4138b, 0x3b3a270b46e36aaf, 0xb01b9edc96f8df2f, 0x6ccaf1ce4d0e6817},
+            {0xb40b64db75312553, 0xbbbae7828473dfff, 0x42b463b1e8f134de, 0xc8c5102893ab259d},
+            {0x917054e00917d62a, 0x856bec6e83976bfe, 0xc155dcba3c8e5b59, 0x22784edafd00e5ec},
+            {0xeaf813680e5f7e12, 0xd6e078798eef0137, 0x690bf23c9d13417f, 0xad080c95466f29a7},
+            {0xbdce75ba5dc83189, 0x09de0e5c0a15659b, 0x96e72277e3dcda08, 0xea3067628c6239d1},
+            {0x99530f9745770cb1, 0x1d21bafbc6bdf274, 0x071757fa70f8ecf6, 0x7582aaaf505f7d2d},
+            {0xf7b5824cd4da3fa6, 0xcded519287913ab9, 0xdb2850eced681b9c, 0x516a2af60a11b996},
+            {0xc819064d32dc3280, 0x5004c8187c4dc5bd, 0x51bc6d1770b8b899, 0xf485a2f816b802e8},
+            {0xa1a33ecf534a8374, 0x370eda2e4518d507, 0x488bbfb8f4b671c6, 0x298dcc1af05f46fb},
+            {0x8291e3610d8538dc, 0xb6355d435d047d1f, 0xe6b8f367a8215733, 0xbf2dd5924ac726a3},
+            {0xd2f26f568b2e5aea, 0x742e7ecc2487536b, 0xae554b9889bef25a, 0xb8115efe239e5a91},
+            {0xaa66d1cc45e975d1, 0x412d3bba910e6288, 0x6d2ef9122930e6f1, 0x28a1d058bb22e41c},
+            {0x89a63ba4c497b50e, 0x6c83ad1260ff20f4, 0xc098e6ed0bfbd6f6, 0xb62593291c76891a},
+            {0xde626f9271838b72, 0x9845f7c1d9258fb5, 0xa61e2a2de198badf, 0xc3bff2a401102804},
+            {0xb3a40a3201db561d, 0x3dacbb8ccff07907, 0x8547cba3050a905a, 0x55ac28b61dc84a05},
+            {0x911cd7bcfe244dc8, 0xde1de1bad23e3145, 0xc75f08e4908f88c4, 0x10324f07f4258393},
+            {0xea71313dd34fadfd, 0xf60d1acb7b204a8c, 0xb0ff65cac17bd494, 0x3e59ede98a1d7066},
+            {0xbd61807b9d61f6ac, 0xdc5f294523e7e980, 0xede1fa24b4368569, 0x8bec2789466543c2},
+            {0x98fb0b9b5fe2e6d5, 0xe731dbb0149142b1, 0x7c43ff512858f6a9, 0x0553952a5849ff60},
+            {0xf7274feaadf53ae6, 0xdf142c7d6f088d99, 0x23cd574ab47d548b, 0xb33bd20248fc1a57},
+            {0xc7a628b0bf64f690, 0xf09266bca93ac229, 0x0b54335acf053f47, 0x385459940b9bc504},
+            {0xa1467525779950bc, 0x392cd41cf4347a42, 0x5623bbbcbab9fefd, 0x6db3ccf4dd1cd775},
+            {0x8246ef5291ea561c, 0x5d38aa74d2458e95, 0x892b0995bbac2c36, 0x6eab4b60564b40bb},
+            {0xd279575c593b8fd7, 0x0b98443b3a71892a, 0xc01565402e69645c, 0x46187c5bb3d52b6c},
+            {0xaa050037370797d7, 0xb47ae2943d28f38b, 0x05fcc205ef3ddf27, 0x60bb12c9f1b98d01},
+            {0x89573736ee14ae4d, 0x12c005da94a67ff5, 0xe347987eefbd5a8b, 0xb98b6a48e3daeb46},
+            {0xdde2c6c84679b56d, 0x1500629c19be6ef3, 0x19222fd0f47d532e, 0x881b2f91f68f0d1e},
+            {0xb33ceadd17b3e963, 0xa8841ea4f77f5c6d, 0xc8e559168c56d51d, 0x7dac8e9194abe735},
+            {0x90c98a8726ca5b85, 0xa332c62897ba44ed, 0x77fe33643bfc6866, 0x308c428f5da17317},
+            {0xe9ea9c818f14d669, 0x99c7c550f656da54, 0xa3174265daf49f0e, 0x6059e17f6fd98f7f},
+            {0xbcf4c9c8eb1a5921, 0x3a5224e1b922e878, 0xa8469a99501675b7, 0x63a186d2c515e3f2},
+            {0x98a33a25e9b494b6, 0xd38f79ff460453ea, 0xeab50fb21621d700, 0x6052c899e383ff11},
+            {0xf6996f293c0eb82e, 0x23597123cfc991fb, 0x1df6972050b0adcf, 0x1ab7f17419c9a773},
+            {0xc7338d0485a78f81, 0x9ad3f8fd59034f5f, 0x9ae886c3a1b5cb79, 0x6466fc6d7747875c},
+            {0xa0e9e0bf58b8e865, 0x22f23b41de0b3210, 0x606dfb9b2df4e746, 0x3e91c6d38075aacd},
+            {0x81fc264af2bf565c, 0x19f0fddc015eb9f3, 0x4179741657c2b589, 0x5e68a82370cf4309},
+            {0xd20084e59f0d87f5, 0xcccfc0a963738eff, 0x7c5372b59db5875c, 0xc373430b354cc167},
+            {0xa9a366c938a5512f, 0x78eef13f6e95a459, 0xc97061ca58b48090, 0xe8bf89c10bbae5c0},
+            {0x890860252d38fe33, 0x32adc85727db52ff, 0x067f2f35c7554e5d, 0x348b5cf6e306c9c0},
+            {0xdd636746710e8f02, 0xf8ac9335e627b8f8, 0xc8723bda24d57298, 0x7c81c42c0e8a58c2},
+            {0xb2d606baa7c8ea89, 0x2eb30a609088263e, 0x58c728940f715bb6, 0xec662d05faca7f00},
+            {0x90766d22ffee6702, 0xf71d6515e9de5944, 0xf8fb277c055696c5, 0x9281ac348e8172c0},
+            {0xe9645506ceeddb4b, 0xcd31e81906ecdc98, 0xb40604207cfdf235, 0xfb8e868c142ace92},
+            {0xbc88517e5f421a2b, 0x27c0dbeccd75c5ab, 0x72e52cdac4d366e0, 0x0503b950466a82cd},
+            {0x984b9b19e1f045dd, 0x402596199721b820, 0x4bc70aefb308d9aa, 0x7ed7db93bf1b3a6b},
+            {0xf60bdfd9a371747a, 0x20fc81b4879b8bbd, 0x7c43c47e9886e383, 0x5b16081b66e4aa5f},
+            {0xc6c13322ab95b49f, 0xc58758b7d66ea3d5, 0x61a15f9d60c3077e, 0x0b298f36c289c3a6},
+            {0xa08d817e6318b7e5, 0x58fd102c7c3f409b, 0x155c8e25660bc713, 0x93e3b57af7509d98},
+            {0x81b188317cf5c6d9, 0x98dc052405b4298c, 0xb227fa2d83228dac, 0x6ac325dcf0521729},
+            {0xd187f7ca753169ec, 0x2b1f77da6f8c0942, 0x5758232b3e30b6b3, 0x70da84edb9ccb4dd},
+            {0xa94205620ec95e5b, 0xdf005355bebda248, 0xbc2c05711737efa8, 0x854a1a49c54c6426},
+            {0x88b9b65578207b41, 0xd64e8811be4362eb, 0xe31c7b768305ee99, 0x1cd70b71060e98ec},
+            {0xdce450e2dfee1664, 0x8cc9f4e5f06e51ff, 0xeb4f73380d74e5dc, 0x645f79b2a9340ccb},
+            {0xb26f5da8b6b57c3c, 0x8d1044ccce623b7d, 0xb6e82246cecf503c, 0xc35309779585ef0b},
+            {0x90237f75163fec72, 0xea869f5035ce6bd8, 0x5e18227476dd8d27, 0xa5543b60d284e1ea},
+            {0xe8de5aa1399d936e, 0xaa07eb4b59458e63, 0x083f2e9bb17b6f99, 0x7cd45f19285c7e9a},
+            {0xbc1c177826c6725c, 0x8ab0d993bb75625e, 0x44629202484772c8, 0xc8f92282fc9245e0},
+            {0x97f42e5a5840756b, 0xa0d0c0303ce40108, 0xc690741996dea298, 0x3500d543d5e7c28f},
+            {0xf57ea1cd234e48cd, 0x9d378c0cb53dea26, 0x5f5a1a6a7d4009c8, 0x393ab503b95f583d},
+            {0xc64f1ae56cdbab48, 0x149d049bec2a1cea, 0x3d825d3a0723748f, 0x68b1df7a3cd56e4f},
+            {0xa031574414b59218, 0xb5d191c89ea338e4, 0xfb3cc46ca8d60690, 0x4188394cd563be7a},
+            {0x816714ed8bacf15a, 0x4bb64866f22e6ec9, 0xa0b0e1d947665b46, 0x292d213b72c4176f},
+            {0xd10fafe30b1c842e, 0xa02fc3073d003b3d, 0xdec674c7aa74b421, 0xf7bce4d640f80a48},
+            {0xa8e0dbe18ffb82cf, 0xa0e25c08b5c189d6, 0x8dbf63ea468c724f, 0x55ea8ffd792576d3},
+            {0x886b39add3d98638, 0x24bf62b68c0069b9, 0x44adce397f5bfb85, 0xcc09a7aa60f8972f},
+            {0xdc65837399ea659c, 0xf10c086169cc2098, 0xb165bd79c751310a, 0x71aa9b4d7c145c5e},
+            {0xb208ef855c969f4f, 0xbdbd2d335e51a935, 0x125e305aa39ec108, 0xeadc16801df141f6},
+            {0x8fd0c16206306bab, 0xa5d3b6d479f8e056, 0x8ca6a79794740162, 0xf786c221a807425f},
+            {0xe858ad248f5c22c9, 0xd1b3400f8f9cff68, 0xf910f9f648232f14, 0x6a40608fe10de7e8},
+            {0xbbb01b9283253ca2, 0x9eb1aaedfb016f16, 0x6e70b9b9889a7f57, 0xcf613f823e7d3c35},
+            {0x979cf3ca6cec5b5a, 0xa705992ceecf9c42, 0xbc2f26a194dd4e37, 0x6dfd6e29b1f45d3c},
+            {0xf4f1b4d515acb93b, 0xee92fb5515482d44, 0x357aa1a42528181e, 0x51cb94130fc82e79},
+            {0xc5dd44271ad3cdba, 0x40eff1e1853f29fd, 0x84597744a189dcf1, 0x89a163429dca4e18},
+            {0x9fd561f1fd0f9bd3, 0xfeb6ea8bedefa633, 0xd655d349b644b8da, 0xbb81385bf1617c1f},
+            {0x811ccc668829b887, 0x0806357d5a3f525f, 0xbc62cbb696057bb4, 0x01d27c0a54c51870},
+            {0xd097ad07a71f26b2, 0x7e2000a41346a7a7, 0xa4ca04661a16c57f, 0xa48c17d1bcf9d09c},
+            {0xa87fea27a539e9a5, 0x3f2398d747b36224, 0x2a1fee40d90aab31, 0x0e128b5d938cfb40},
+            {0x881cea14545c7575, 0x7e50d64177da2e54, 0xbbfe6e04db164412, 0x40a4a418449a0bbd},
+            {0xdbe6fecebdedd5be, 0xb573440e5a884d1b, 0x2fbf06fcce912adc, 0xb8d8422ea03cd10b},
+            {0xb1a2bc2ec5000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+            {0x8f7e32ce7bea5c6f, 0xe4820023a2000000, 0x0000000000000000, 0x0000000000000000},
+            {0xe7d34c64a9c85d44, 0x60dbbca87196b616, 0x18a4bd2168000000, 0x0000000000000000},
+            {0xbb445da9ca61281f, 0x2a8a6e45ae8edc97, 0x9c2ea52a04fc967d, 0x8fb4cea990000000},
+            {0x9745eb4d50ce6332, 0xf840b7ba963646e0, 0x43cbba5ba0cdaf55, 0x09ffc3e5a10722b7},
+            {0xf46518c2ef5b8cd1, 0x7eb258665fc25d69, 0x6c57abeaec94e5af, 0x8f195ffdee2e8e20},
+            {0xc56baec21c7a1916, 0x088aaa1845b8fdd0, 0xd838d493160047e3, 0xb42427a9cb0932d6},
+            {0x9f79a169bd203e41, 0x0f0062c6e984d386, 0xbc6e825806b72777, 0xd367e211bd1ee5f4},
+            {0x80d2ae83e9ce78f3, 0xc1d72b7c6b426019, 0x482ca8432dc76fc5, 0x6929467c2ba394e1},
+            {0xd01fef10a657842c, 0x2d2b7569b0432d85, 0x05ff7caf730b919d, 0xc9f98b4225c36c12},
+            {0xa81f301449ee8c70, 0x5c68f256bfff5a74, 0xb4e870990780e79b, 0x918639872807b19b},
+            {0x87cec76f1c830548, 0x8f2293910d0b15b5, 0x975dd6cbd4dccd82, 0x8703ddb100e4e85a},
+            {0xdb68c2ca82ed2a05, 0xa67398db9f6820e1, 0x5750d25a71e7f1c5, 0x5d961fc86f24a670},
+            {0xb13cc3832ef0c9ab, 0x8246fac210f8ffb4, 0xc5b6d4ea231a22a5, 0x77b55c8f56958dde},
+            {0x8f2bd39f334827e8, 0xc5874cc0ec691b9f, 0xe56c781930229735, 0xda7ed3c3cf668a59},
+            {0xe74e38357bd931da, 0x89d823f6f183aace, 0xe8e452653cd01f0e, 0x7fcc366790ea7209},
+            {0xbad8dd9a66f5f0c8, 0x91e543aa47023945, 0x0b164e53d0b35a03, 0xbf90106cb1d4358d},
+            {0x96ef14c6454aa840, 0x4cf76e8df8d89498, 0x45df5607e39c3bbc, 0xdec35376c35edcff},
+            {0xf3d8cd683fe16e54, 0x64fba9447ae230a6, 0xa6df70017dcbd19e, 0xf98579b2012fdc2f},
+            {0xc4fa5a90ee5fc27d, 0x0b3a07bb3369ec69, 0xcdaeef4543fe4504, 0x7c4375597a93a43a},
+            {0x9f1e158d07501f00, 0x67c327b40165db14, 0xf19c1743c60fdfa4, 0x81f4f542e01197e8},
+            {0x8088bb2d3612eed0, 0xb404b1aac3b0b1ac, 0x294c110e9db61219, 0x2658425c7bc895d0},
+            {0xcfa875d67ca49ad5, 0x7f8cb2e0f3944055, 0xee80a5da1de0ace8, 0x640c6865a2eba624},
+            {0xa7bead878be4a024, 0x982ef1559d5cfd95, 0xfe38e7e10baaa1d1, 0x5d34b530c9579d9c},
+            {0x8780d1a45dffcd28, 0x8468f120a84864d6, 0xb2cacb833e04d952, 0x4b22bcc9ff17d563},
+            {0xdaeacf3d37d9c2e9, 0x39b6094ba67834d0, 0x6fb7ab263a38eb99, 0x4079902811db3a68},
+            {0xb0d70560ecc880f0, 0xfda84abbcac8f32b, 0x1ee7c7c81e9c99eb, 0xb597fd80537f3203},
+            {0x8ed9a3b8f7cb274d, 0xf59d6cc93b593ba2, 0x53c4f6b4d8d9e898, 0x29487e45dbc01cf5},
+            {0xe6c9706b11cf1e22, 0x052307759e8221f2, 0x21972c959320442e, 0xbcbf95e44257f2b0},
+            {0xba6d9b40d7cc9ecc, 0xdf143bbe46291876, 0xd9f922f5d6b023a3, 0xb7bc579e9a5a1a52},
+            {0x969870189c45773a, 0xd38fc935c5b03e69, 0x3b50103a8f89d6e3, 0xc4432db1c330fded},
+            {0xf34cd296b16d95d8, 0x0666243fa37a7224, 0xfcca5bfbeef3e83b, 0x09982a3080481cb1},
+            {0xc489476e229ed355, 0x7989eeb43b87fe98, 0x33326c6bf342fe4d, 0x0ee55ae0abd3937d},
+            {0x9ec2be3d9f6d1e0c, 0xd3e0a7a1ea113aa9, 0xa253adff2725af36, 0x237a4e8683097248},
+            {0x803ef24a007c2042, 0x49002ced7ba39f75, 0xbf95e559d208addb, 0x2373ab0ccffd7c9e},
+            {0xcf314131b49924b7, 0xc8cf2273139d62e3, 0xe57a37b9a5d8fc0f, 0x0719abff4e100f45},
+            {0xa75e62618b3e080e, 0x6a7d641fdd0d57ff, 0x539db0cf0c133d48, 0x80b821295ed3fb7d},
+            {0x8733089a5955b9d5, 0x9221285f3b009255, 0xb9e320a2db7a4bd6, 0x26b61c12ad62a854},
+            {0xda6d23fd4393d91b, 0x0ca211f8f5c4287e, 0x62cffdaf0a5a9271, 0xdfc0b324cb257561},
+            {0xb07181a6643be435, 0x9450f9e7ef8d5c99, 0xb85fd56ff351b054, 0x0cafc375e2ab8ffb},
+            {0x8e87a300a492a7b9, 0x3a1533e3719de6e6, 0x3bd32eaa99cb1aad, 0xecec7f7208466889},
+            {0xe644f4d99125aa28, 0x89bcea6c7f20dd35, 0x169de30352c2b7ee, 0xb7cd8cd1bee13087},
+            {0xba029679b02fccb3, 0xe347123eb4e9c6e8, 0xd82305924eb14b9c, 0x3dfa1599f1d0bbf6},
+            {0x9641fd27b819d563, 0xb4b3e36003417364, 0xf2ba2e131e84bfc8, 0xdf90d619bb06652e},
+            {0xf2c1282008c87b1e, 0xa9a722490271812a, 0x69f6619238c125aa, 0xcfcc4e4122234f51},
+            {0xc418753460cdcca9, 0x7ea30dbd7ea479e3, 0x6eac3085943ccc0f, 0xdd093192ef5508d1},
+            {0x9e679b5d5aa0595d, 0xd2345c3ee031426a, 0x68afbe2458dd5f5a, 0xab88eb1d2195648b},
+            {0xffeaa783d52898ba, 0x3109584912d308b6, 0x3a1117c916e57dc6, 0x643d5ec9dfc596bc},
+            {0xceba50faef6e8f75, 0x6839b135b9fd8f5f, 0xa29bb23b7937fa1b, 0xda6c9e9f9c25ca91},
+            {0xa6fe4e827a68ceda, 0x847adde36b83ed55, 0xf8d7b6b400c559f4, 0x67c6a3fcb95fae62},
+            {0x86e56c375dcf8c5d, 0xf8982043c5f7976a, 0x29d3ddb2d3ff50e4, 0xc7707fe919e124d5},
+            {0xd9efc0e124dcc06c, 0xe8797316fe5abb69, 0xa5501251c93bd304, 0x68c6b2b2c50e8d44},
+            {0xb00c38320e49d28d, 0x467220892a2de083, 0x24dfc7c15085d233, 0x5708b37b2fc099d2},
+            {0x8e35d15b2452f322, 0x648280a4312280e9, 0x102d2e09e1d966ed, 0xb3ddea5adcb2ced5},
+            {0xe5c0c5553884eca7, 0x8226ae89353a2e51, 0x091b9b5922310652, 0x748c39fb4b972fb3},
+            {0xb997cf2197bff43c, 0x8dc36a2313fdd3ce, 0xe43272f436e1b60d, 0x0341b2de46b74a14},
+            {0x95ebbbd70b900d11, 0x982184100472b9d7, 0x8a99ea38affecb74, 0x1104cc1bb69f0327},
+            {0xf235cdd6254490c3, 0xf1dca6bbf183bacf, 0x8e9e7849ab916449, 0x313ed8509219e097},
+            {0xc3a7e3be65f3519f, 0x4fda0b57de29b863, 0x3b378afe877adfe3, 0x9f85600fa8c3b3a1},
+            {0x9e0cacce1f643645, 0x79999d3a10ef2ec8, 0x3f7d6cf87d0e976c, 0x9f51883469a6cf89},
+            {0xff57bef947c5bd86, 0xa0698f4370bc8713, 0xefbabd8152424185, 0xc266f3254960aa77},
+            {0xce43a50ae4f7fb8e, 0x7877892520ee1715, 0x5b1545b7a4a86071, 0x562ca41d21f9f2cf},
+            {0xa69e71ca9e14a5a8, 0x3bcda1ca654faa6b, 0x548a15347815675c, 0x7289e115e50428bb},
+            {0x8697fc61c9775e04, 0xbac531ed37220143, 0x2b662d5045250ff5, 0x820373a3110409c3},
+            {0xd972a5bf72493299, 0xc26d3a2bf51e2455, 0x4dbfb8c7bf6adb9c, 0xe134c3caf61dfa96},
+            {0xafa728e277303902, 0x53577ce73150ed15, 0x405f3cdd58932fc6, 0x9140793cf7bbe0c4},
+            {0x8de42ead714c5e80, 0xb946dd72d21a411c, 0xcb74d00c308a5edc, 0x1faf605843a638a2},
+            {0xe53ce1b25fb31788, 0x355fde18e8448607, 0x731f0b7d820918bd, 0x351eec49f72bc62f},
+            {0xb92d45154a67c1f1, 0x9cea6223c82c6d62, 0x2613f8de7a581324, 0xb95258edae0a5795},
+            {0x9595ac0a19d43faa, 0x0ae2a34be99c8749, 0xaf7473f780f667a5, 0x85e24ecd480ac956},
+            {0xf1aac38b00af082b, 0x34bb923c4cbe7e5c, 0x3832e49648c6b733, 0x48ea8c2db8e431a6},
+            {0xc33792e70479d905, 0xcf187da5e7a0db7f, 0x32b41a256cd3f2f6, 0x28063518fcbc4ff7},
+            {0x9db1f271e57a7086, 0x8c62bfc72f4cab1c, 0xbd331507c0d2eb4a, 0xb125fb6dd6f76128},
+            {0xfec52ac3d3c8cfc1, 0xbd4c24b2c0457430, 0x83c6ba228651e703, 0x81cdeae93a226db3},
+            {0xcdcd3d3a6395431c, 0x591c490fafdf73af, 0x91ff3a8ddbeb1c17, 0xe505d479338fe79e},
+            {0xa63ecc1a4d286923, 0x88b67d00a64f20ba, 0x8ea547dc228cc08a, 0xe659155c0c5cb4d6},
+            {0x864ab900090e2907, 0x381710d14507e218, 0x8551dff765ce4829, 0x2399eaab6486896b},
+            {0xd8f5d26eda33a1ed, 0x30adbb561ac082ed, 0x1ec5ea96e9b2cc89, 0xb945453d92bebfae},
+            {0xaf4253963e610637, 0xde6d3887132604ee, 0xeeda61f46a2c45c3, 0x39fb5e4da16f6490},
+            {0x8d92badc95425d0e, 0xd4b36f9a42106d9c, 0xef68b3fea4a96393, 0x6f24e9f6f0387531},
+            {0xe4b949c577860cb3, 0x9e135fc17876ae84, 0x408965b59dbc94e5, 0xc5a23103fa038cce},
+            {0xb8c2f83198506f71, 0xce0e32af3d064ff3, 0xc65e680e7dd915fe, 0xd34568562cf74a03},
+            {0x953fcda4766cfd04, 0xa9a635eb25ea4911, 0x42cf03cfaaec9a2e, 0x39ae2496e6112821},
+            {0xf1200910af409e2c, 0xa42cab49e86cc37d, 0x089abd31b2277a44, 0xac782cc6d84ddfc9},
+            {0xc2c78289242365f1, 0xaf9eb0a61316c138, 0x75c3d21566f2cc47, 0x70b6204c5521e850},
+            {0x9d576c2ab5e22f1f, 0x72be5bae797e96bd, 0xba30c277c2c66b15, 0x98eb18301e287f5a},
+            {0xfe32eab310053387, 0x73c87a427943dc4e, 0xa9bd526998e54fca, 0x988eb6047cdb901f},
+            {0xcd571962502607ff, 0xc91845ef8a9cb003, 0xfed6e0dee68b7e85, 0x2e91ab500dcdf6ac},
+            {0xa5df5d51f0b7aca3, 0x20cfdf2b96fa883b, 0x7814960bedd29b30, 0x6d7798b3e386a11e},
+            {0x85fda1f89803563e, 0xddeccfc584c791d6, 0xe2928915f8698fa4, 0x70e1e41e1a732cc9},
+            {0xd87946c622ae93c4, 0xd0107abc3f99157f, 0x4f509493259368ae, 0x109810dd4af1a085},
+            {0xaeddb82c16772464, 0x3214129fdaa531b7, 0x902dd227b9a44ab4, 0xa77b2eae0e79f8d7},
+            {0x8d4175cda97298ae, 0x1c2d0d065c8af261, 0xee88ae028ff65536, 0x2561f5ef9c52d231},
+            {0xe435fd6309d4fb29, 0x2cda83ae165bf80e, 0xde442da4f65a1f9f, 0xd5ae1b791c98df7f},
+            {0xb858e85365d62467, 0xb3511a96bec03c53, 0xcc83b1e48401cf12, 0xdaa1581870d5b72d},
+            {0x94ea2089c531e034, 0xf3ba490004c33efb, 0x179712718f5a8b99, 0x967831edd33fa6d7},
+            {0xf0959e395f8e707c, 0x462712be5eb9e09e, 0x1e14b5916709667c, 0xe3904ce14e2c5e5f},
+            {0xc257b27fc1fd4767, 0x0ef28acd11dda912, 0x9568776c447fcddd, 0x068b70454722c70f},
+            {0x9cfd19daaace1ec6, 0xd56a0d18c92b7ce0, 0xf7eba496d173789b, 0x047bfef9110481f2},
+            {0xfda0fe96af18931b, 0x37f79b926f8b78d3, 0xa3cfd5d8dd20c6d4, 0x2c0554e532c87cfc},
+            {0xcce1395ba5fcc97d, 0x4ba70f9f7a6f1a1e, 0x393778f16649c8e5, 0x1d370b268966a012},
+            {0xa580255203f84b47, 0x3a5828869701a165, 0xa0eaf3f62dc1777c, 0xe1f8b43b08b5d0f0},
+            {0x85b0b732006c4f9c, 0x268fdf8f517bf539, 0x6894855ea80137f9, 0xa3fe180570355391},
+            {0xd7fd029c297702e7, 0x187eda2a22fb395a, 0x09a27f73d55de62f, 0xa998d07ed39927ba},
+            {0xae795682c52b799e, 0xfc3b637c7d1ed5e9, 0x0197262d25363a45, 0xe147f9d3a0f36f7e},
+            {0x8cf05f65d68c0f66, 0xca6e7bcc9e46ba7c, 0x1f557f3c40418eb8, 0x6b191a526c00da0c},
+            {0xe3b2fc5fb96a0457, 0xb53a2b982e0f6760, 0x6e9b3f9f0dd359a2, 0xd775834b1847aa9c},
+            {0xb7ef1557ab7c5e2d, 0x58fc2ebe7cebc9a0, 0x28387b692e76710c, 0xfcbbefb1ef2da877},
+            {0x9494a49dba4231b7, 0xacf11d6be847cc94, 0xd6a9a01625eca232, 0x6f52f02bb60d672e},
+            {0xf00b82d75a7adbc5, 0xb8787d891ab45d5a, 0xa66af5def99ba79b, 0xb5e77e9f6cf3a47a},
+            {0xc1e822a5f053df0b, 0x7623d5a5e6f04d44, 0x03aa9d962e9667b4, 0x689b5e24c1044643},
+            {0x9ca2fb63ef9a9216, 0x93f373d3194bd7a2, 0x1c23fe4f8f906fc5, 0x30243a463c209880},
+            {0xfd0f663e7f5aeaf9, 0x23425b28bbe9371e, 0x3f477bd36e1cdc1b, 0xecc0c92667e8e2d5},
+            {0xcc6b9cff76d20143, 0x93b6b89183a7cd26, 0x0acace34da7bcf3d, 0x6dd5b6fdef61be1d},
+            {0xa52123fb1437ff15, 0x85e9a883d027b193, 0x03e4fdc389e22c2d, 0xb0991635c4532d5f},
+            {0x8563f892dafc1778, 0x1d1ddb29e0b5cd44, 0xb9a348a0e321cfbc, 0x89153ba1db34b354},
+            {0xd78105c7e3e6c9ab, 0x20f6b528ce836d91, 0x0881783a8b133ce1, 0xf5b28034c2ae6cdf},
+            {0xae152e792349ee7f, 0xe2cf7498cb3ae42a, 0xed8526767ba690fc, 0x61145a39dfa79dcf},
+            {0x8c9f778a54a63601, 0xa7b51094e052446e, 0x143b221c55afefd1, 0x49b24b84b8ac790f},
+            {0xe330469041f3e9b3, 0xc7b80ecfc49147d9, 0x1778f1942858c766, 0x7544486b5d053b1d},
+            {0xb7857f1b75e25e17, 0xe5f0ab9af906f807, 0xad31b7b6dcf433e5, 0x1e0c9e9dc037e5ad},
+            {0x943f59c419fb8f00, 0xb682951fc2bfa35c, 0x0b5f2626222587e3, 0xff8995b293f0a6fa},
+            {0xef81b6bd03266277, 0xc10ba8997903a0b4, 0x78ff0f92a3b5cf89, 0x504ea5c6d7837d16},
+            {0xc178d2d6d6a66edc, 0x39e0cfa68676dcc4, 0xe4d7425afcb19da9, 0xa23328e430bd1840},
+            {0x9c4910a8c0c3a761, 0xd3a885f6336374b0, 0x57c832cca0f090e5, 0xb60acdd0621533c2},
+            {0xfc7e217a6ace9f0f, 0x7119aa2c0c5ee694, 0x192df5f08f7399f1, 0x4b12afaa89fdde71},
+            {0xcbf64426eab747d7, 0xb4393d3ddbb63ef2, 0x4b09f05073187d82, 0x16f8bbf3e72bf134},
+            {0xa4c2592dc0d1fe0e, 0xee7d28284240c246, 0xf52419c08af2d58b, 0xb8920bc9f05e8d48},
+            {0x85176601cefae4b9, 0x9f6a021d765fca1a, 0x2dce225c96f349d7, 0xf8c965561e4d20a9},
+            {0xd70550205ee713ec, 0xd67aeffbfcacc7b9, 0x1581d1cb0bebe3cc, 0x7bdc63772d0e2582},
+            {0xadb13fee1ca67b09, 0xd0207e41af7a1795, 0x4933bbd3490d2b54, 0xff733d72a54cf7a9},
+            {0x8c4ebe206b381fb8, 0x80531ad2cf4ac1a3, 0x35476ab32799b5e7, 0xb7eefe91056dfb52},
+            {0xe2addbc977f7c286, 0xbe1eca4c8d1f3e8e, 0xe257f3dbc7c12acd, 0xe6b4e3d14f7856b7},
+            {0xb71c257be5b79e67, 0x65092dfb9e89b4f0, 0xaa0c5751a5f96cbd, 0x5b563f7172a47d66},
+            {0x93ea3fe0b8f09766, 0x48c1deee9c4a6902, 0x370f00abbaeb58b2, 0x32b4375afb65a92b},
+            {0xeef839bcd6e09c3a, 0xae1bf0f3271a769f, 0x1fa9d444fe07779f, 0x9122577923e01b53},
+            {0xc109c2edb19aede5, 0x3227369929740ff7, 0xce10ac286e95590b, 0x8bf015772b001a83},
+            {0x9bef598b6bdb7432, 0xe6378d5497c61c2d, 0xaea8d278225d7766, 0xe492b7c2488a30e0},
+            {0xfbed301a7710991b, 0x1950fe7127df2c37, 0x3195dcdf11d6ddf8, 0x659e2a922ca57870},
+            {0xcb812eab400a8062, 0xd642dd37d587cf52, 0x59c573b027c3969b, 0xe03f8f4a584dfdea},
+            {0xa463c4cabb249d3b, 0xb18d1901b754e375, 0x63a62f1933292833, 0x7069e7f3fb1801cb},
+            {0x84caff65923dc3cb, 0x9876629e2b8c406a, 0x6ea58fc376fd3380, 0x464bfd6d997a2a78},
+            {0xd689e17cbee2d8c9, 0x2be55caa39a3e6a6, 0x8751ec9c692d4d91, 0x54cf3dfb9bf07968},
+            {0xad4d8ac0b01239df, 0x597b3e09a526ccd7, 0x735cc79714c14956, 0xe5f11cec00015eb3},
+            {0x8bfe330d710faafa, 0x6dd1d01180b2deb4, 0x142ef064e3cead4c, 0xbbbbf6a893259a1d},
+            {0xe22bbbe048c2b9f1, 0xc1be8bc9345928a1, 0xc88a1100702467df, 0xb554729cb8021f5d},
+            {0xb6b308562fb04dd6, 0xe771bc4844ae1177, 0x7d58aa5adf0f6707, 0xdf181fc9895b6bb0},
+            {0x939556d77bdf9e66, 0x7944e444f1092562, 0x372f896aaa161f6f, 0x1eb1e54fa9eb96bf},
+            {0xee6f0ba96d192e0c, 0x8ca1c95829f0fbf6, 0x85ce5928612d3eff, 0x7c06290b52318de3},
+            {0xc09af2c5d2f1e3f3, 0xc4adef984fca0bea, 0xb70ff460ed2a8978, 0xa81e73a80b123f26},
+            {0x9b95d5ee4f80366d, 0xc8dd55687a68bb70, 0x3666af1cb2f0356b, 0x555464b4f76b344c},
+            {0xfb5c91eec5487022, 0x49572570005f17c5, 0xa09732cfb3973647, 0x81beadce6e02c571},
+            {0xcb0c5c65cb690bdd, 0x384846024d78b972, 0x34fec0895756000e, 0xf7d4c9a5b364b346},
+            {0xa40566b2c686f9aa, 0x63279d34e31319c3, 0x1fcacfd93a8ca649, 0x56d6acc0f4613f45},
+            {0x847ec4a4e91e3c61, 0x6fbbec3af2869ffa, 0x8cd6a2ca83e629aa, 0x796f19a498679420},
+            {0xd60eb9b43fb95c1d, 0xcb1d3d6f831a106b, 0x51a6a7d21393a927, 0x78ddc142ce171935},
+            {0xacea0ecfef5081bc, 0xa43f8a28ef6774f6, 0x9b10fc0239935107, 0xd50d9f50250cdfd8},
+            {0x8badd636cc48b341, 0x0879b2e5f6ee8b1c, 0xac376f28b45e5acc, 0x5e2075ba289a360c},
+            {0xe1a9e6a9ba5bd520, 0x162db6da3b6be60b, 0xb30b39e77bc25e9b, 0x2fef98a04fe8ebcb},
+            {0xb64a27879c79d1c9, 0x322dcaa7586a36ad, 0xb84712f76d3d8e63, 0x6aeb526455d97ae4},
+            {0x93409e8c57a96343, 0xfadf8e2328e42a81, 0xd533b18295269a39, 0x0d0c7da3b9246b51},
+            {0xede62c557750cafe, 0x3e1ef1b82c1675b4, 0x28bb0233c670f4f4, 0xf0ba2242187d1133},
+            {0xc02c623aa17a4c42, 0x3f7213691771e1b5, 0x3605d290cec91119, 0x7b16cee6a79d8c48},
+            {0x9b3c85b3db528b13, 0xfedd2b53c559b585, 0xa20f2962e4e6cb69, 0xcd497a9237e38b9f},
+            {0xfacc46c792189907, 0x808cb24436cad539, 0x394fcff52a56e17a, 0x88898677a75b8095},
+            {0xca97cd2ff7a30392, 0x3c3e17ac3f323525, 0x7192ad9bfe0702d7, 0xb57d4ffd30f712db},
+            {0xa3a73ec6b83ea75e, 0x73b4975fb8f66d1b, 0x5da34fd104d9e574, 0x27c596c9bba5ab6e},
+            {0x8432b5a6a671fc06, 0xeb0ef134ece68a23, 0x529479860b01c926, 0xdae7fe819788dbef},
+            {0xd593d89e34b0b7c7, 0xd2c6168b00379cf1, 0x1d59a8c5b8338427, 0x9d3429d79fcd9231},
+            {0xac86cbfaff0c0533, 0x2fd3859535d87f8e, 0x3bbc4d1339da7c9f, 0xf610d7dece18975a},
+            {0x8b5da781f24447f3, 0x98c4c7015c805f49, 0xe1cfdcf944c75881, 0xed7914b94ffffae0},
+            {0xe1285bfaeb75c1a3, 0xf5c0e4be4ecbe788, 0x41506544427a3c84, 0x395e23d50e8db209},
+            {0xb5e182ed88af4f0e, 0x2b326435703ac3b0, 0x1aff0a61b27bdd6d, 0x057b14fdff766373},
+            {0x92ec16e35147cdf7, 0x069884f8d1a19173, 0x0191b10b9b45793d, 0x2b237748e85878b7},
+            {0xed5d9b93c10a3d8c, 0x79cadb9f5c03a4a4, 0x8d2591c0387a7883, 0xd0b39afcb0d72965},
+            {0xbfbe112799057f17, 0x831f74c02d901eb2, 0xd80939dd38954f17, 0x425a15d507d16e78},
+            {0x9ae368be8febaaa6, 0x8bda5b7a0eabc7ef, 0x042e15490765a2d5, 0x06d39a17c9bf7d04},
+            {0xfa3c4e75358ea030, 0x16f849f10aee029a, 0xa1a39dee6e88dea6, 0xb572c5e132717b7d},
+            {0xca2380e345ae7af9, 0x4cc88dbe23aabb68, 0xd988b4293fa0d640, 0x33e84dd0ab058b32},
+            {0xa3494ce77775662a, 0xcf2aca8e1f49b13a, 0xe0640fff007a7513, 0x393114fd1a6fb285},
+            {0x83e6d251ab828578, 0xc28300a9f6eeb16d, 0x11a0b5b2a315d2ab, 0x8841c361aeb20166},
+            {0xd5193e1208686c9d, 0x2e097318c960d548, 0x78ef7810b38ca24f, 0x02fd645429952e10},
+            {0xac23c22116cbf8a3, 0xece327eceafb90de, 0x359890e7df0917d7, 0x8da8ccf4cbf19aca},
+            {0x8b0da6d4679fe855, 0x61e942ddb7eb3ee0, 0xc9f78957c1debaf9, 0x9d3e2a35dfd9baf1},
+    };
+
+    static_assert(sizeof(table) == compressed_table_size * 4 * sizeof(std::uint64_t), "Table should have 366 elements");
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES) && (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+
+template <bool b> constexpr int cache_holder_impl<b>::min_k;
+template <bool b> constexpr int cache_holder_impl<b>::max_k;
+template <bool b> constexpr int cache_holder_impl<b>::compression_ratio;
+template <bool b> constexpr std::size_t cache_holder_impl<b>::compressed_table_size;
+template <bool b> constexpr std::uint64_t cache_holder_impl<b>::table[][4];
+
+#endif
+
+using cache_holder = cache_holder_impl<true>;
+
+inline cache_entry_type get_cache(int k) noexcept
+{
+    BOOST_CHARCONV_ASSERT(k >= cache_holder::min_k && k <= cache_holder::max_k);
+
+    const auto cache_index = static_cast<std::size_t>(static_cast<std::uint32_t>(k - cache_holder::min_k) /
+                                                      cache_holder::compression_ratio);
+    const auto kb = static_cast<int>(cache_index) * cache_holder::compression_ratio + cache_holder::min_k;
+    const auto offset = k - kb;
+
+    const std::uint64_t* base_cache = cache_holder::table[cache_index];
+    if (offset == 0)
+    {
+        return {(carrier_uint(base_cache[0]) << 64) | base_cache[1], (carrier_uint(base_cache[2]) << 64) | base_cache[3]};
+    }
+
+    const auto alpha = log::floor_log2_pow10(k) - log::floor_log2_pow10(kb) - offset;
+    BOOST_CHARCONV_ASSERT(alpha > 0 && alpha < 64);
+
+    // The 320-bit product of the base and 5^offset, shifted right by alpha
+    const carrier_uint pow5 = compressed_cache_detail::pow5_holder_t::table[offset];
+    const carrier_uint p0 = base_cache[3] * pow5;
+    const carrier_uint p1 = base_cache[2] * pow5 + (p0 >> 64);
+    const carrier_uint p2 = base_cache[1] * pow5 + (p1 >> 64);
+    const carrier_uint p3 = base_cache[0] * pow5 + (p2 >> 64);
+
+    cache_entry_type recovered_cache {(p3 << (64 - alpha)) | (static_cast<std::uint64_t>(p2) >> alpha),
+                                      (carrier_uint(static_cast<std::uint64_t>(p2)) << (128 - alpha)) |
+                                      (((p1 << 64) | static_cast<std::uint64_t>(p0)) >> alpha)};
+
+    ++recovered_cache.low;
+    if (recovered_cache.low == 0)
+    {
+        ++recovered_cache.high;
+    }
+
+    return recovered_cache;
+}
+
+struct uint256
+{
+    carrier_uint high;
+    carrier_uint low;
+};
+
+inline uint256 umul256(carrier_uint x, carrier_uint y) noexcept
+{
+    const auto x0 = static_cast<std::uint64_t>(x);
+    const auto x1 = static_cast<std::uint64_t>(x >> 64);
+    const auto y0 = static_cast<std::uint64_t>(y);
+    const auto y1 = static_cast<std::uint64_t>(y >> 64);
+
+    const carrier_uint p00 = carrier_uint(x0) * y0;
+    const carrier_uint p01 = carrier_uint(x0) * y1;
+    const carrier_uint p10 = carrier_uint(x1) * y0;
+    const carrier_uint p11 = carrier_uint(x1) * y1;
+
+    const carrier_uint middle = (p00 >> 64) + static_cast<std::uint64_t>(p01) + static_cast<std::uint64_t>(p10);
+
+    return {p11 + (p01 >> 64) + (p10 >> 64) + (middle >> 64), (middle << 64) | static_cast<std::uint64_t>(p00)};
+}
+
+// The 384-bit product of u and the cache, of which the upper 128 bits are the integer part
+// and the other 256 bits the fraction
+inline void umul384(carrier_uint u, cache_entry_type const& cache, carrier_uint& integer_part,
+                    carrier_uint& fraction_high, carrier_uint& fraction_low) noexcept
+{
+    const auto high = umul256(u, cache.high);
+    const auto low = umul256(u, cache.low);
+
+    fraction_low = low.low;
+    fraction_high = high.low + low.high;
+    integer_part = high.high + (fraction_high < high.low ? 1U : 0U);
+}
+
+// Whether a product, of an integer below 2^128 and the cache, is too close to an integer for the error of the
+// cache: the fraction is then at most 3 * 2^128 above the exact one out of 2^256
+inline bool is_product_ambiguous(carrier_uint fraction_high) noexcept
+{
+    return (fraction_high >> 2) == 0;
+}
+
+// All of the following report through ambiguous that the product could not be resolved
+inline carrier_uint compute_mul(carrier_uint u, cache_entry_type const& cache, int k,
+                                bool& is_integer, bool& ambiguous) noexcept
+{
+    carrier_uint result;
+    carrier_uint fraction_high;
+    carrier_uint fraction_low;
+    umul384(u, cache, result, fraction_high, fraction_low);
+
+    is_integer = false;
+    if (is_product_ambiguous(fraction_high))
+    {
+        if (k >= min_integer_k && k <= max_integer_k)
+        {
+            is_integer = true;
+        }
+        else
+        {
+            ambiguous = true;
+        }
+    }
+
+    return result;
+}
+
+inline bool compute_mul_parity(carrier_uint two_f, cache_entry_type const& cache, int beta, int k,
+                               bool& is_integer, bool& ambiguous) noexcept
+{
+    carrier_uint integer_part;
+    carrier_uint fraction_high;
+    carrier_uint fraction_low;
+    umul384(two_f, cache, integer_part, fraction_high, fraction_low);
+
+    is_integer = false;
+    if (is_product_ambiguous((fraction_high << beta) | (fraction_low >> (128 - beta))))
+    {
+        if (k >= min_integer_k && k <= max_integer_k)
+        {
+            is_integer = true;
+        }
+        else
+        {
+            ambiguous = true;
+        }
+    }
+
+    return ((fraction_high >> (128 - beta)) & 1) != 0;
+}
+
+constexpr std::uint32_t compute_delta(cache_entry_type const& cache, int beta) noexcept
+{
+    return static_cast<std::uint32_t>(cache.high >> (127 - beta));
+}
+
+// The endpoints of the shorter interval are one part in 2^114 away from y, which with the upper 128 bits of the cache
+// leaves them only 15 bits below the integer part, and some of them are closer than that to an integer.
+// The borrow and carry from the lower 128 bits are kept here so that they are exact
+inline carrier_uint compute_left_endpoint_for_shorter_interval_case(cache_entry_type const& cache, int beta) noexcept
+{
+    const auto high = cache.high >> (significand_bits + 2);
+    const auto low = (cache.low >> (significand_bits + 2)) | (cache.high << (128 - significand_bits - 2));
+
+    return (cache.high - high - (cache.low < low ? 1U : 0U)) >> (128 - significand_bits - 1 - beta);
+}
+
+inline carrier_uint compute_right_endpoint_for_shorter_interval_case(cache_entry_type const& cache, int beta) noexcept
+{
+    const auto high = cache.high >> (significand_bits + 1);
+    const auto low = (cache.low >> (significand_bits + 1)) | (cache.high << (128 - significand_bits - 1));
+
+    return (cache.high + high + (cache.low + low < low ? 1U : 0U)) >> (128 - significand_bits - 1 - beta);
+}
+
+constexpr carrier_uint compute_round_up_for_shorter_interval_case(cache_entry_type const& cache, int beta) noexcept
+{
+    return ((cache.high >> (128 - significand_bits - 2 - beta)) + 1) / 2;
+}
+
+constexpr bool is_left_endpoint_integer_shorter_interval(int exponent) noexcept
+{
+    return exponent >= case_shorter_interval_left_endpoint_lower_threshold &&
+           exponent <= case_shorter_interval_left_endpoint_upper_threshold;
+}
+
+// n / Divisor one 32-bit word at a time, which compilers turn into multiplications
+// where a 128-bit division would be a call to __udivti3
+template <std::uint32_t Divisor>
+inline carrier_uint divide_by(carrier_uint n, std::uint32_t& remainder) noexcept
+{
+    carrier_uint quotient = 0;
+    std::uint64_t r = 0;
+
+    for (int shift = 96; shift >= 0; shift -= 32)
+    {
+        const std::uint64_t current = (r << 32) | static_cast<std::uint32_t>(n >> shift);
+        quotient |= carrier_uint(current / Divisor) << shift;
+        r = current % Divisor;
+    }
+
+    remainder = static_cast<std::uint32_t>(r);
+    return quotient;
+}
+
+constexpr carrier_uint rotr(carrier_uint n, int r) noexcept
+{
+    return (n >> r) | (n << (128 - r));
+}
+
+constexpr carrier_uint pow10(int n) noexcept
+{
+    return n == 0 ? 1 : 10 * pow10(n - 1);
+}
+
+// n is divisible by 10^N if and only if rotr(n * 5^-N, N) <= (2^128 - 1) / 10^N, which is then the quotient
+template <int N>
+inline bool remove_pow10(carrier_uint& n) noexcept
+{
+    constexpr carrier_uint mod_inv_5 = (carrier_uint(UINT64_C(0xcccccccccccccccc)) << 64) | UINT64_C(0xcccccccccccccccd);
+    constexpr carrier_uint mod_inv_25 = mod_inv_5 * mod_inv_5;
+    constexpr carrier_uint mod_inv_625 = mod_inv_25 * mod_inv_25;
+    constexpr carrier_uint mod_inv_5_8 = mod_inv_625 * mod_inv_625;
+    constexpr carrier_uint mod_inv_5_16 = mod_inv_5_8 * mod_inv_5_8;
+
+    constexpr carrier_uint mod_inv = N == 16 ? mod_inv_5_16 :
+                                     N == 8 ? mod_inv_5_8 :
+                                     N == 4 ? mod_inv_625 :
+                                     N == 2 ? mod_inv_25 : mod_inv_5;
+
+    constexpr carrier_uint max_quotient = BOOST_CHARCONV_UINT128_MAX / pow10(N);
+
+    const auto q = rotr(n * mod_inv, N);
+    if (q <= max_quotient)
+    {
+        n = q;
+        return true;
+    }
+
+    return false;
+}
+
+// Remove trailing zeros from n and return the number of zeros removed.
+// Most significands have none, so one zero is tried before the larger steps
+inline int remove_trailing_zeros(carrier_uint& n) noexcept
+{
+    if (n == 0 || !remove_pow10<1>(n))
+    {
+        return 0;
+    }
+
+    int s = 1;
+    while (remove_pow10<16>(n))
+    {
+        s += 16;
+    }
+    if (remove_pow10<8>(n))
+    {
+        s += 8;
+    }
+    if (remove_pow10<4>(n))
+    {
+        s += 4;
+    }
+    if (remove_pow10<2>(n))
+    {
+        s += 2;
+    }
+    if (remove_pow10<1>(n))
+    {
+        s += 1;
+    }
+
+    return s;
+}
+
+struct decimal_fp
+{
+    carrier_uint significand;
+    int exponent;
+};
+
+// Nearest to even: the endpoints of the interval are included when the significand is even
+inline bool compute_nearest_normal(carrier_uint two_fc, int exponent, decimal_fp& ret_value) noexcept
+{
+    const bool include_endpoints = (two_fc % 4) == 0;
+    bool ambiguous = false;
+
+    //////////////////////////////////////////////////////////////////////
+    // Step 1: Schubfach multiplier calculation
+    //////////////////////////////////////////////////////////////////////
+
+    // Compute k and beta.
+    const int minus_k = log::floor_log10_pow2(exponent) - kappa;
+    const auto cache = get_cache(-minus_k);
+    const int beta = exponent + log::floor_log2_pow10(-minus_k);
+
+    // Compute zi and deltai.
+    // 10^kappa <= deltai < 10^(kappa + 1)
+    const auto deltai = compute_delta(cache, beta);
+    bool is_z_integer;
+    const auto zi = compute_mul((two_fc | 1) << beta, cache, -minus_k, is_z_integer, ambiguous);
+
+    //////////////////////////////////////////////////////////////////////
+    // Step 2: Try larger divisor; remove trailing zeros if necessary
+    //////////////////////////////////////////////////////////////////////
+
+    std::uint32_t r;
+    ret_value.significand = divide_by<big_divisor>(zi, r);
+
+    bool small_divisor_case = false;
+
+    if (r < deltai)
+    {
+        // Exclude the right endpoint if necessary.
+        if (r == 0 && is_z_integer && !include_endpoints)
+        {
+            --ret_value.significand;
+            r = big_divisor;
+
+            small_divisor_case = true;
+        }
+    }
+    else if (r > deltai)
+    {
+        small_divisor_case = true;
+    }
+    else
+    {
+        // r == deltai; compare fractional parts.
+        bool x_is_integer;
+        const auto xi_parity = compute_mul_parity(two_fc - 1, cache, beta, -minus_k, x_is_integer, ambiguous);
+
+        if (!(xi_parity || (x_is_integer && include_endpoints)))
+        {
+            small_divisor_case = true;
+        }
+    }
+
+    if (!small_divisor_case)
+    {
+        ret_value.exponent = minus_k + kappa + 1;
+        ret_value.exponent += remove_trailing_zeros(ret_value.significand);
+        return !ambiguous;
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    // Step 3: Find the significand with the smaller divisor
+    //////////////////////////////////////////////////////////////////////
+
+    ret_value.significand *= 10;
+    ret_value.exponent = minus_k + kappa;
+
+    std::uint32_t dist = r - (deltai / 2) + (small_divisor / 2);
+    const bool approx_y_parity = ((dist ^ (small_divisor / 2)) & 1) != 0;
+
+    // Is dist divisible by 10^kappa?
+    const bool divisible_by_small_divisor = dist % small_divisor == 0;
+    dist /= small_divisor;
+
+    // Add dist / 10^kappa to the significand.
+    ret_value.significand += dist;
+
+    if (divisible_by_small_divisor)
+    {
+        // Check z^(f) >= epsilon^(f).
+        // We have either yi == zi - epsiloni or yi == (zi - epsiloni) - 1,
+        // where yi == zi - epsiloni if and only if z^(f) >= epsilon^(f).
+        // Since there are only 2 possibilities, we only need to care about the parity.
+        bool is_y_integer;
+        const auto yi_parity = compute_mul_parity(two_fc, cache, beta, -minus_k, is_y_integer, ambiguous);
+
+        if (yi_parity != approx_y_parity)
+        {
+            --ret_value.significand;
+        }
+        else if (is_y_integer && (ret_value.significand % 2) != 0)
+        {
+            // A tie when y is an integer, which is broken to even
+            --ret_value.significand;
+        }
+    }
+
+    return !ambiguous;
+}
+
+// Both endpoints of the shorter interval are included, its significand being even
+inline void compute_nearest_shorter(int exponent, decimal_fp& ret_value) noexcept
+{
+    // Compute k and beta.
+    const int minus_k = log::floor_log10_pow2_minus_log10_4_over_3(exponent);
+    const int beta = exponent + log::floor_log2_pow10(-minus_k);
+
+    // Compute xi and zi.
+    const auto cache = get_cache(-minus_k);
+
+    auto xi = compute_left_endpoint_for_shorter_interval_case(cache, beta);
+    const auto zi = compute_right_endpoint_for_shorter_interval_case(cache, beta);
+
+    // If the left endpoint is not an integer, increase it.
+    if (!is_left_endpoint_integer_shorter_interval(exponent))
+    {
+        ++xi;
+    }
+
+    // Try bigger divisor.
+    std::uint32_t r;
+    ret_value.significand = divide_by<10>(zi, r);
+
+    // If succeed, remove trailing zeros if necessary and return.
+    if (ret_value.significand * 10 >= xi)
+    {
+        ret_value.exponent = minus_k + 1;
+        ret_value.exponent += remove_trailing_zeros(ret_value.significand);
+        return;
+    }
+
+    // Otherwise, compute the round-up of y.
+    ret_value.significand = compute_round_up_for_shorter_interval_case(cache, beta);
+    ret_value.exponent = minus_k;
+
+    // When tie occurs, choose the even one.
+    if ((ret_value.significand % 2) != 0 &&
+        exponent >= shorter_interval_tie_lower_threshold &&
+        exponent <= shorter_interval_tie_upper_threshold)
+    {
+        --ret_value.significand;
+    }
+    else if (ret_value.significand < xi)
+    {
+        ++ret_value.significand;
+    }
+}
+
+// The shortest decimal that rounds to the finite non-zero binary128 value with these bits, ignoring the sign.
+// Returns false where the product with the cache is ambiguous, see the top of this file
+inline bool to_decimal(carrier_uint bits, decimal_fp& result) noexcept
+{
+    auto two_fc = (bits & ((carrier_uint(1) << significand_bits) - 1)) << 1;
+    auto exponent = static_cast<int>(static_cast<std::uint32_t>(bits >> significand_bits) & ((1U << exponent_bits) - 1U));
+
+    // Is the input a normal number?
+    if (exponent != 0)
+    {
+        exponent += exponent_bias - significand_bits;
+
+        // The smallest normal number has the same spacing on both sides as the subnormals below it,
+        // so it is left to the normal interval case
+        if (two_fc == 0 && exponent != min_exponent - significand_bits)
+        {
+            compute_nearest_shorter(exponent, result);
+            return true;
+        }
+
+        two_fc |= (carrier_uint(1) << (significand_bits + 1));
+    }
+    // Is the input a subnormal number?
+    else
+    {
+        exponent = min_exponent - significand_bits;
+    }
+
+    return compute_nearest_normal(two_fc, exponent, result);
+}
+
+}}}} // Namespaces
+
+#endif // BOOST_CHARCONV_HAS_INT128
+
+#endif // BOOST_CHARCONV_DETAIL_DRAGONBOX_DRAGONBOX_BINARY128_HPP
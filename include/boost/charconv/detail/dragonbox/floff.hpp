@@ -635,12 +635,12 @@ static BOOST_FORCEINLINE bool check_rounding_condition_subsegment_boundary_with_
     std::uint32_t current_digits, UintWithKnownDigits next_subsegment,
     HasFurtherDigits has_further_digits, Args...) noexcept 
 {
-    if (next_subsegment.value > power_of_10[decltype(next_subsegment)::digits] / 2)
+    if (next_subsegment.value > power_of_10_table::power_of_10[decltype(next_subsegment)::digits] / 2)
     {
         return true;
     }
 
-    return next_subsegment.value == power_of_10[decltype(next_subsegment)::digits] / 2 && 
+    return next_subsegment.value == power_of_10_table::power_of_10[decltype(next_subsegment)::digits] / 2 && 
                                     ((current_digits & 1) | has_further_digits) != 0;
 }
 
@@ -650,12 +650,12 @@ static BOOST_FORCEINLINE bool check_rounding_condition_subsegment_boundary_with_
     std::uint32_t current_digits, UintWithKnownDigits next_subsegment,
     HasFurtherDigits has_further_digits, Args... args) noexcept 
 {
-    if (next_subsegment.value > power_of_10[decltype(next_subsegment)::digits] / 2) 
+    if (next_subsegment.value > power_of_10_table::power_of_10[decltype(next_subsegment)::digits] / 2) 
     {
         return true;
     }
 
-    return next_subsegment.value == power_of_10[decltype(next_subsegment)::digits] / 2 &&
+    return next_subsegment.value == power_of_10_table::power_of_10[decltype(next_subsegment)::digits] / 2 &&
                                     ((current_digits & 1) != 0 || has_further_digits(args...));
 }
 
@@ -807,7 +807,7 @@ struct main_cache_full
     template <typename FloatFormat>
     static constexpr typename main_cache_holder::cache_entry_type get_cache(int k) noexcept
     {
-        return main_cache_holder::cache[std::size_t(k - main_cache_holder::min_k)];
+        return main_cache_holder::get(k);
     }
 };
 
@@ -865,7 +865,7 @@ struct main_cache_compressed
         else
         {
             // Just use the full cache for anything other than binary64
-            return main_cache_holder::cache[std::size_t(k - main_cache_holder::min_k)];
+            return main_cache_holder::get(k);
         }
     }
 };
@@ -1027,7 +1027,8 @@ template <bool b> constexpr typename extended_cache_long_impl<b>::multiplier_ind
 
 using extended_cache_long = extended_cache_long_impl<true>;
 
-struct extended_cache_compact 
+template <bool b>
+struct extended_cache_compact_impl
 {
     static constexpr std::size_t max_cache_blocks = 6;
     static constexpr std::size_t cache_bits_unit = 64;
@@ -1096,23 +1097,27 @@ struct extended_cache_compact
         0x61, 0x45, 0x23, 0x41, 0x23, 0x31, 0x12, 0x12, 0x01};
 };
 
-#ifdef BOOST_CXX17_INLINE_VARIABLES
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES) && (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
 
-constexpr std::size_t extended_cache_compact::max_cache_blocks;
-constexpr std::size_t extended_cache_compact::cache_bits_unit;
-constexpr int extended_cache_compact::segment_length;
-constexpr bool extended_cache_compact::constant_block_count;
-constexpr int extended_cache_compact::collapse_factor;
-constexpr int extended_cache_compact::e_min;
-constexpr int extended_cache_compact::k_min;
-constexpr int extended_cache_compact::cache_bit_index_offset_base;
-constexpr int extended_cache_compact::cache_block_count_offset_base;
-constexpr extended_cache_compact::multiplier_index_info extended_cache_compact::multiplier_index_info_table[];
-constexpr std::uint8_t extended_cache_compact::cache_block_counts[];
+template <bool b> constexpr std::size_t extended_cache_compact_impl<b>::max_cache_blocks;
+template <bool b> constexpr std::size_t extended_cache_compact_impl<b>::cache_bits_unit;
+template <bool b> constexpr int extended_cache_compact_impl<b>::segment_length;
+template <bool b> constexpr bool extended_cache_compact_impl<b>::constant_block_count;
+template <bool b> constexpr int extended_cache_compact_impl<b>::collapse_factor;
+template <bool b> constexpr int extended_cache_compact_impl<b>::e_min;
+template <bool b> constexpr int extended_cache_compact_impl<b>::k_min;
+template <bool b> constexpr int extended_cache_compact_impl<b>::cache_bit_index_offset_base;
+template <bool b> constexpr int extended_cache_compact_impl<b>::cache_block_count_offset_base;
+template <bool b> constexpr std::uint64_t extended_cache_compact_impl<b>::cache[];
+template <bool b> constexpr typename extended_cache_compact_impl<b>::multiplier_index_info extended_cache_compact_impl<b>::multiplier_index_info_table[];
+template <bool b> constexpr std::uint8_t extended_cache_compact_impl<b>::cache_block_counts[];
 
 #endif
 
-struct extended_cache_super_compact 
+using extended_cache_compact = extended_cache_compact_impl<true>;
+
+template <bool b>
+struct extended_cache_super_compact_impl
 {
     static constexpr std::size_t max_cache_blocks = 15;
     static constexpr std::size_t cache_bits_unit = 64;
@@ -1159,23 +1164,39 @@ struct extended_cache_super_compact
                                                             0x24, 0x8a, 0x46, 0x62, 0x24, 0x13};
 };
 
-#ifdef BOOST_CXX17_INLINE_VARIABLES
-
-constexpr std::size_t extended_cache_super_compact::max_cache_blocks;
-constexpr std::size_t extended_cache_super_compact::cache_bits_unit;
-constexpr int extended_cache_super_compact::segment_length;
-constexpr bool extended_cache_super_compact::constant_block_count;
-constexpr int extended_cache_super_compact::collapse_factor;
-constexpr int extended_cache_super_compact::e_min;
-constexpr int extended_cache_super_compact::k_min;
-constexpr int extended_cache_super_compact::cache_bit_index_offset_base;
-constexpr int extended_cache_super_compact::cache_block_count_offset_base;
-constexpr std::uint64_t extended_cache_super_compact::cache[];
-constexpr extended_cache_super_compact::multiplier_index_info extended_cache_super_compact::multiplier_index_info_table[];
-constexpr std::uint8_t extended_cache_super_compact::cache_block_counts[];
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES) && (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+
+template <bool b> constexpr std::size_t extended_cache_super_compact_impl<b>::max_cache_blocks;
+template <bool b> constexpr std::size_t extended_cache_super_compact_impl<b>::cache_bits_unit;
+template <bool b> constexpr int extended_cache_super_compact_impl<b>::segment_length;
+template <bool b> constexpr bool extended_cache_super_compact_impl<b>::constant_block_count;
+template <bool b> constexpr int extended_cache_super_compact_impl<b>::collapse_factor;
+template <bool b> constexpr int extended_cache_super_compact_impl<b>::e_min;
+template <bool b> constexpr int extended_cache_super_compact_impl<b>::k_min;
+template <bool b> constexpr int extended_cache_super_compact_impl<b>::cache_bit_index_offset_base;
+template <bool b> constexpr int extended_cache_super_compact_impl<b>::cache_block_count_offset_base;
+template <bool b> constexpr std::uint64_t extended_cache_super_compact_impl<b>::cache[];
+template <bool b> constexpr typename extended_cache_super_compact_impl<b>::multiplier_index_info extended_cache_super_compact_impl<b>::multiplier_index_info_table[];
+template <bool b> constexpr std::uint8_t extended_cache_super_compact_impl<b>::cache_block_counts[];
 
 #endif
 
+using extended_cache_super_compact = extended_cache_super_compact_impl<true>;
+
+// Main and extended caches of floff, selected with BOOST_CHARCONV_CACHE_POLICY and BOOST_CHARCONV_EXTENDED_CACHE_POLICY.
+// Only the segment lengths of extended_cache_long and extended_cache_super_compact are implemented below
+#if BOOST_CHARCONV_CACHE_POLICY == BOOST_CHARCONV_CACHE_POLICY_COMPACT
+using floff_main_cache = main_cache_compressed;
+#else
+using floff_main_cache = main_cache_full;
+#endif
+
+#if BOOST_CHARCONV_EXTENDED_CACHE_POLICY == BOOST_CHARCONV_EXTENDED_CACHE_POLICY_COMPACT
+using floff_extended_cache = extended_cache_super_compact;
+#else
+using floff_extended_cache = extended_cache_long;
+#endif
+
 #ifdef BOOST_MSVC
 # pragma warning(push)
 # pragma warning(disable: 4100) // MSVC 14.0 warning of unused formal parameter is incorrect
@@ -1300,11 +1321,11 @@ bool compute_has_further_digits(unsigned remaining_subsegment_pairs, std::uint64
 # pragma warning(pop)
 #endif
 
-// precision means the number of decimal significand digits minus 1.
+// Prints x in scientific notation, where precision means the number of decimal significand digits minus 1.
+// Fixed and general notation are derived from this output by the caller.
 // Assumes round-to-nearest, tie-to-even rounding.
 template <typename MainCache = main_cache_full, typename ExtendedCache>
-BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int precision, char* first, char* last,
-                                                 boost::charconv::chars_format fmt, bool changed_fmt) noexcept
+BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int precision, char* first, char* last) noexcept
 {
     if (first >= last)
     {
@@ -1314,6 +1335,9 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
     auto buffer_size = static_cast<std::size_t>(last - first);
     auto buffer = first;
 
+    static_assert(ExtendedCache::segment_length == 22 || ExtendedCache::segment_length == 252,
+                  "Phase 2 only handles the segment lengths of extended_cache_long and extended_cache_super_compact");
+
     BOOST_CHARCONV_ASSERT(precision >= 0);
     using namespace detail;
 
@@ -1448,15 +1472,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
     std::uint32_t current_digits {};
     char* const buffer_starting_pos = buffer;
     int decimal_exponent = -k;
-    int remaining_digits;
-    if (fmt == chars_format::scientific)
-    {
-        remaining_digits = precision + 1 + static_cast<int>(std::abs(x) < 1);
-    }
-    else
-    {
-        remaining_digits = precision + 1;
-    }
+    int remaining_digits = precision + 1;
 
     if (buffer_size < static_cast<std::size_t>(remaining_digits))
     {
@@ -1784,15 +1800,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
             const auto initial_digits = static_cast<std::uint32_t>(prod >> 32);
             const auto exp_adjustment = 11 - (initial_digits < 10 ? 1 : 0);
             decimal_exponent += exp_adjustment + remaining_digits_in_the_current_subsegment;
-            if (fmt == chars_format::fixed && decimal_exponent < 0)
-            {
-                remaining_digits += decimal_exponent;
-                remaining_digits -= initial_digits < 10 ? 0 : 1;
-            }
-            else
-            {
-                remaining_digits -= (2 - (initial_digits < 10 ? 1 : 0));
-            }
+            remaining_digits -= (2 - (initial_digits < 10 ? 1 : 0));
 
             buffer -= (initial_digits < 10 ? 1 : 0);
             print_2_digits(initial_digits, buffer);
@@ -2124,11 +2132,11 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
                         BOOST_CHARCONV_ASSERT(digits_in_the_second_segment != 0);
 
                         fixed_point_calculator<ExtendedCache::max_cache_blocks>::discard_upper(
-                            power_of_10[19], blocks, cache_block_count);
+                            power_of_10_table::power_of_10[19], blocks, cache_block_count);
 
                         auto subsegment =
                             fixed_point_calculator<ExtendedCache::max_cache_blocks>::
-                                generate_and_discard_lower(power_of_10[3], blocks,
+                                generate_and_discard_lower(power_of_10_table::power_of_10[3], blocks,
                                                             cache_block_count);
 
                         if (digits_in_the_second_segment == 1)
@@ -2160,7 +2168,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
                             // The number of overlapping digits is in the range 13 ~ 19.
                             const auto subsegment =
                                 fixed_point_calculator<ExtendedCache::max_cache_blocks>::
-                                    generate_and_discard_lower(power_of_10[9], blocks,
+                                    generate_and_discard_lower(power_of_10_table::power_of_10[9], blocks,
                                                                 cache_block_count);
 
                             std::uint64_t prod;
@@ -2189,7 +2197,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
                             // The number of digits in the segment is in the range 10 ~ 16.
                             const auto first_second_subsegments =
                                 fixed_point_calculator<ExtendedCache::max_cache_blocks>::
-                                    generate_and_discard_lower(power_of_10[16], blocks,
+                                    generate_and_discard_lower(power_of_10_table::power_of_10[16], blocks,
                                                                 cache_block_count);
 
                             // The first segment is of 8 digits, and the second segment is of
@@ -2235,11 +2243,11 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
                         // The number of digits in the segment is in the range 17 ~ 22.
                         const auto first_subsegment =
                             fixed_point_calculator<ExtendedCache::max_cache_blocks>::generate(
-                                power_of_10[6], blocks, cache_block_count);
+                                power_of_10_table::power_of_10[6], blocks, cache_block_count);
 
                         const auto second_third_subsegments =
                             fixed_point_calculator<ExtendedCache::max_cache_blocks>::
-                                generate_and_discard_lower(power_of_10[16], blocks,
+                                generate_and_discard_lower(power_of_10_table::power_of_10[16], blocks,
                                                             cache_block_count);
 
                         // ceil(2^(64+14)/10^8) = 3022314549036573
@@ -2318,7 +2326,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
                     if (digits_in_the_second_segment <= 2)
                     {
                         fixed_point_calculator<ExtendedCache::max_cache_blocks>::discard_upper(
-                            power_of_10[19], blocks, cache_block_count);
+                            power_of_10_table::power_of_10[19], blocks, cache_block_count);
 
                         // Get one more bit for potential rounding on the segment boundary.
                         auto subsegment =
@@ -2413,7 +2421,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
 
                         // Get one more bit for potential rounding on the segment boundary.
                         auto segment = fixed_point_calculator<ExtendedCache::max_cache_blocks>::
-                            generate_and_discard_lower(power_of_10[9] << 1, blocks,
+                            generate_and_discard_lower(power_of_10_table::power_of_10[9] << 1, blocks,
                                                         cache_block_count);
 
                         std::uint64_t prod;
@@ -2510,7 +2518,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
                     // Get one more bit for potential rounding condition check.
                     auto first_second_subsegments =
                         fixed_point_calculator<ExtendedCache::max_cache_blocks>::generate(
-                            power_of_10[13] << 1, blocks, cache_block_count);
+                            power_of_10_table::power_of_10[13] << 1, blocks, cache_block_count);
                     
                     bool first_bit_of_third_subsegment = ((first_second_subsegments & 1) != 0);
                     first_second_subsegments >>= 1;
@@ -2845,7 +2853,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
                         // shift the multiplier.
                         auto third_subsegment =
                             fixed_point_calculator<ExtendedCache::max_cache_blocks>::
-                                generate_and_discard_lower(power_of_10[9], blocks,
+                                generate_and_discard_lower(power_of_10_table::power_of_10[9], blocks,
                                                             cache_block_count);
 
                         bool segment_boundary_rounding_bit = ((third_subsegment & 1) != 0);
@@ -2928,20 +2936,20 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
                 while (overlapping_digits >= 18)
                 {
                     fixed_point_calculator<ExtendedCache::max_cache_blocks>::discard_upper(
-                        power_of_10[18], blocks, cache_block_count);
+                        power_of_10_table::power_of_10[18], blocks, cache_block_count);
                     --remaining_subsegment_pairs;
                     overlapping_digits -= 18;
                 }
 
-                auto subsegment_pair = fixed_point_calculator<ExtendedCache::max_cache_blocks>::generate(power_of_10[18] << 1, blocks, cache_block_count);
+                auto subsegment_pair = fixed_point_calculator<ExtendedCache::max_cache_blocks>::generate(power_of_10_table::power_of_10[18] << 1, blocks, cache_block_count);
                 auto subsegment_boundary_rounding_bit = (subsegment_pair & 1) != 0;
                 subsegment_pair >>= 1;
 
                 // Deal with the first subsegment pair.
                 {
                     // Divide it into two 9-digits subsegments.
-                    const auto first_part = static_cast<std::uint32_t>(subsegment_pair / power_of_10[9]);
-                    const auto second_part = static_cast<std::uint32_t>(subsegment_pair - power_of_10[9] * first_part);
+                    const auto first_part = static_cast<std::uint32_t>(subsegment_pair / power_of_10_table::power_of_10[9]);
+                    const auto second_part = static_cast<std::uint32_t>(subsegment_pair - power_of_10_table::power_of_10[9] * first_part);
 
                     auto print_subsegment = [&](std::uint32_t subsegment, int digits_in_the_subsegment)
                     {
@@ -3197,14 +3205,14 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
                 --remaining_subsegment_pairs;
                 for (; remaining_subsegment_pairs > 0; --remaining_subsegment_pairs) 
                 {
-                    subsegment_pair = fixed_point_calculator<ExtendedCache::max_cache_blocks>::generate(power_of_10[18], blocks, cache_block_count);
+                    subsegment_pair = fixed_point_calculator<ExtendedCache::max_cache_blocks>::generate(power_of_10_table::power_of_10[18], blocks, cache_block_count);
 
-                    subsegment_pair += (subsegment_boundary_rounding_bit ? power_of_10[18] : 0);
+                    subsegment_pair += (subsegment_boundary_rounding_bit ? power_of_10_table::power_of_10[18] : 0);
                     subsegment_boundary_rounding_bit = (subsegment_pair & 1) != 0;
                     subsegment_pair >>= 1;
 
-                    const auto first_part = static_cast<std::uint32_t>(subsegment_pair / power_of_10[9]);
-                    const auto second_part = static_cast<std::uint32_t>(subsegment_pair - power_of_10[9] * first_part);
+                    const auto first_part = static_cast<std::uint32_t>(subsegment_pair / power_of_10_table::power_of_10[9]);
+                    const auto second_part = static_cast<std::uint32_t>(subsegment_pair - power_of_10_table::power_of_10[9] * first_part);
 
                     // The first part can be printed without rounding.
                     if (remaining_digits > 9)
@@ -3378,7 +3386,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
                 // When at least two subsegments left.
                 if (remaining_digits > 16) 
                 {
-                    std::uint64_t first_second_subsegments = fixed_point_calculator<ExtendedCache::max_cache_blocks>::generate(power_of_10[16], blocks, cache_block_count);
+                    std::uint64_t first_second_subsegments = fixed_point_calculator<ExtendedCache::max_cache_blocks>::generate(power_of_10_table::power_of_10[16], blocks, cache_block_count);
 
                     const auto first_subsegment =
                         static_cast<std::uint32_t>(boost::charconv::detail::umul128_upper64(first_second_subsegments, UINT64_C(3022314549036573)) >> 14);
@@ -3392,7 +3400,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
                     if (remaining_digits > 22)
                     {
                         const auto third_subsegment = static_cast<std::uint32_t>(
-                            fixed_point_calculator<ExtendedCache::max_cache_blocks>::generate_and_discard_lower(power_of_10[6], blocks,cache_block_count));
+                            fixed_point_calculator<ExtendedCache::max_cache_blocks>::generate_and_discard_lower(power_of_10_table::power_of_10[6], blocks,cache_block_count));
 
                         print_6_digits(third_subsegment, buffer + 16);
                         buffer += 22;
@@ -3405,7 +3413,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
                         remaining_digits -= 16;
 
                         auto third_subsegment = fixed_point_calculator<ExtendedCache::max_cache_blocks>::
-                            generate_and_discard_lower(power_of_10[6] << 1, blocks, cache_block_count);
+                            generate_and_discard_lower(power_of_10_table::power_of_10[6] << 1, blocks, cache_block_count);
 
                         bool segment_boundary_rounding_bit = ((third_subsegment & 1) != 0);
                         third_subsegment >>= 1;
@@ -3484,7 +3492,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
                     // Get one more bit for potential rounding conditions check.
                     auto first_second_subsegments =
                         fixed_point_calculator<ExtendedCache::max_cache_blocks>::
-                            generate_and_discard_lower(power_of_10[16] << 1, blocks, cache_block_count);
+                            generate_and_discard_lower(power_of_10_table::power_of_10[16] << 1, blocks, cache_block_count);
 
                     bool first_bit_of_third_subsegment = ((first_second_subsegments & 1) != 0);
                     first_second_subsegments >>= 1;
@@ -3571,7 +3579,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
                     // Get one more bit for potential rounding conditions check.
                     auto first_subsegment =
                         fixed_point_calculator<ExtendedCache::max_cache_blocks>::
-                            generate_and_discard_lower(power_of_10[8] << 1, blocks, cache_block_count);
+                            generate_and_discard_lower(power_of_10_table::power_of_10[8] << 1, blocks, cache_block_count);
 
                     bool first_bit_of_second_subsegment = ((first_subsegment & 1) != 0);
                     first_subsegment >>= 1;
@@ -3652,10 +3660,10 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
                     if (remaining_digits > 18)
                     {
                         const auto subsegment_pair =
-                            fixed_point_calculator<ExtendedCache::max_cache_blocks>::generate(power_of_10[18], blocks, cache_block_count);
+                            fixed_point_calculator<ExtendedCache::max_cache_blocks>::generate(power_of_10_table::power_of_10[18], blocks, cache_block_count);
 
-                        const auto first_part = static_cast<std::uint32_t>(subsegment_pair / power_of_10[9]);
-                        const auto second_part = static_cast<std::uint32_t>(subsegment_pair - power_of_10[9] * first_part);
+                        const auto first_part = static_cast<std::uint32_t>(subsegment_pair / power_of_10_table::power_of_10[9]);
+                        const auto second_part = static_cast<std::uint32_t>(subsegment_pair - power_of_10_table::power_of_10[9] * first_part);
 
                         print_9_digits(first_part, buffer);
                         print_9_digits(second_part, buffer + 9);
@@ -3667,13 +3675,13 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
                     {
                         auto last_subsegment_pair =
                             fixed_point_calculator<ExtendedCache::max_cache_blocks>::
-                                generate_and_discard_lower(power_of_10[18] << 1, blocks, cache_block_count);
+                                generate_and_discard_lower(power_of_10_table::power_of_10[18] << 1, blocks, cache_block_count);
 
                         const bool subsegment_boundary_rounding_bit = ((last_subsegment_pair & 1) != 0);
                         last_subsegment_pair >>= 1;
 
-                        const auto first_part = static_cast<std::uint32_t>(last_subsegment_pair / power_of_10[9]);
-                        const auto second_part = static_cast<std::uint32_t>(last_subsegment_pair) - power_of_10[9] * first_part;
+                        const auto first_part = static_cast<std::uint32_t>(last_subsegment_pair / power_of_10_table::power_of_10[9]);
+                        const auto second_part = static_cast<std::uint32_t>(last_subsegment_pair) - power_of_10_table::power_of_10[9] * first_part;
 
                         if (remaining_digits <= 9)
                         {
@@ -3827,81 +3835,18 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, const int preci
     /////////////////////////////////////////////////////////////////////////////////////////////////
 
 fill_remaining_digits_with_0s:
-    if (fmt != boost::charconv::chars_format::general)
-    {
-        std::memset(buffer, '0', static_cast<std::size_t>(remaining_digits));
-        buffer += remaining_digits;
-    }
+    std::memset(buffer, '0', static_cast<std::size_t>(remaining_digits));
+    buffer += remaining_digits;
 
 insert_decimal_dot:
-    if (fmt != chars_format::fixed)
-    {
-        buffer_starting_pos[0] = buffer_starting_pos[1];
-        buffer_starting_pos[1] = '.';
-    }
+    buffer_starting_pos[0] = buffer_starting_pos[1];
+    buffer_starting_pos[1] = '.';
 
 print_exponent_and_return:
-
-    if (fmt == chars_format::fixed)
+    // A single digit has no decimal dot
+    if (precision == 0)
     {
-        // In the negative fixed case we have not inserted the decimal dot
-        // so the value will be in the form ex. 01000...
-        //
-        // Need to memset leading zeros equal to a negative exponent
-        if (decimal_exponent < 0)
-        {
-            const auto offset = static_cast<std::size_t>(buffer - buffer_starting_pos);
-            std::size_t additional_zeros = static_cast<std::size_t>(-decimal_exponent) + 1U;
-            std::memmove(&buffer_starting_pos[1 - decimal_exponent], &buffer_starting_pos[1], offset);
-            std::memset(&buffer_starting_pos[0], '0', additional_zeros);
-            buffer_starting_pos[1] = '.';
-            return {first + precision + 3, std::errc()};
-        }
-
-        // In the positive case the precision is still measured after the decimal point
-        // We need to memmove the buffer, insert the decimal point, and then append zeros if applicable
-        std::memmove(&buffer_starting_pos[0], &buffer_starting_pos[1], static_cast<std::size_t>(decimal_exponent) + 1U);
-        buffer_starting_pos[decimal_exponent + 1] = '.';
-        if (current_digits < static_cast<std::uint32_t>(decimal_exponent))
-        {
-            std::memset(buffer, '0', static_cast<std::size_t>(decimal_exponent));
-        }
-
-        auto buffer_end = buffer + decimal_exponent;
-        if (changed_fmt)
-        {
-            --buffer_end;
-            while (*buffer_end == '0')
-            {
-                --buffer_end;
-            }
-            if (*buffer_end != '.')
-            {
-                ++buffer_end;
-            }
-        }
-
-        return {buffer_end, std::errc()};
-    }
-
-    if (fmt == boost::charconv::chars_format::general)
-    {
-        --buffer;
-        while (*buffer == '0')
-        {
-            --buffer;
-        }
-
-        ++buffer;
-
-        // Fixes values without a fraction. Without we would get:
-        //     Val: 2e+38
-        //To chars: 2.e+38
-        //  Printf: 2e+38
-        if (*(buffer - 1) == '.')
-        {
-            --buffer;
-        }
+        buffer = buffer_starting_pos + 1;
     }
 
     if (decimal_exponent >= 0)
@@ -137,7 +137,7 @@ struct uint128
     #endif
 
     #ifdef BOOST_CHARCONV_HAS_FLOAT128
-    explicit operator __float128() const noexcept { return ldexpq(static_cast<__float128>(high), 64) + static_cast<__float128>(low); }
+    explicit operator __float128() const noexcept { return static_cast<__float128>(high) * 18446744073709551616.0Q + static_cast<__float128>(low); }
     #endif
 
     FLOAT_CONVERSION_OPERATOR(float)        // NOLINT
@@ -491,7 +491,7 @@ struct uint128
     #undef INTEGER_BINARY_OPERATOR_EQUALS_RIGHT_SHIFT
 
     // Arithmetic operators (Add, sub, mul, div, mod)
-    inline uint128 &operator+=(std::uint64_t n) noexcept;
+    inline BOOST_CHARCONV_CXX20_CONSTEXPR uint128 &operator+=(std::uint64_t n) noexcept;
 
     BOOST_CHARCONV_CXX14_CONSTEXPR friend uint128 operator+(uint128 lhs, uint128 rhs) noexcept;
 
@@ -618,8 +618,18 @@ BOOST_CHARCONV_CXX14_CONSTEXPR uint128 &uint128::operator^=(uint128 v) noexcept
     return *this;
 }
 
-inline uint128 &uint128::operator+=(std::uint64_t n) noexcept
+inline BOOST_CHARCONV_CXX20_CONSTEXPR uint128 &uint128::operator+=(std::uint64_t n) noexcept
 {
+    #ifdef BOOST_CHARCONV_HAS_CONSTEXPR_FLOAT
+    if (std::is_constant_evaluated())
+    {
+        const auto sum = low + n;
+        high += (sum < low ? 1 : 0);
+        low = sum;
+        return *this;
+    }
+    #endif
+
     #if BOOST_CHARCONV_HAS_BUILTIN(__builtin_addcll)
 
     unsigned long long carry {};
@@ -764,6 +774,19 @@ BOOST_CHARCONV_CXX14_CONSTEXPR void div_impl(uint128 lhs, uint128 rhs, uint128&
 {
     constexpr uint128 one {0, 1};
 
+    // A divisor below 2^32, such as the base of from_chars, takes three 64-bit divisions of 32-bit digits
+    if (rhs.high == 0 && rhs.low != 0 && rhs.low <= UINT32_MAX)
+    {
+        const std::uint64_t d = rhs.low;
+        const std::uint64_t q_high = lhs.high / d;
+        const std::uint64_t middle = ((lhs.high % d) << 32) | (lhs.low >> 32);
+        const std::uint64_t bottom = ((middle % d) << 32) | (lhs.low & UINT32_MAX);
+
+        quotient = uint128 {q_high, ((middle / d) << 32) | (bottom / d)};
+        remainder = bottom % d;
+        return;
+    }
+
     if (rhs > lhs)
     {
         quotient = 0U;
@@ -829,11 +852,18 @@ BOOST_CHARCONV_CXX14_CONSTEXPR uint128 &uint128::operator%=(uint128 v) noexcept
     return *this;
 }
 
-static inline std::uint64_t umul64(std::uint32_t x, std::uint32_t y) noexcept
+static inline BOOST_CHARCONV_CXX20_CONSTEXPR std::uint64_t umul64(std::uint32_t x, std::uint32_t y) noexcept
 {
     // __emulu is not available on ARM https://learn.microsoft.com/en-us/cpp/intrinsics/emul-emulu?view=msvc-170
     #if defined(BOOST_CHARCONV_HAS_MSVC_32BIT_INTRINSICS) && !defined(_M_ARM)
 
+    #ifdef BOOST_CHARCONV_HAS_CONSTEXPR_FLOAT
+    if (std::is_constant_evaluated())
+    {
+        return x * static_cast<std::uint64_t>(y);
+    }
+    #endif
+
     return __emulu(x, y);
 
     #else
@@ -843,8 +873,28 @@ static inline std::uint64_t umul64(std::uint32_t x, std::uint32_t y) noexcept
     #endif
 }
 
+// Get 128-bit result of multiplication of two 64-bit unsigned integers without intrinsics.
+BOOST_CHARCONV_SAFEBUFFERS inline BOOST_CHARCONV_CXX20_CONSTEXPR uint128 umul128_generic(std::uint64_t x, std::uint64_t y) noexcept
+{
+    auto a = static_cast<std::uint32_t>(x >> 32);
+    auto b = static_cast<std::uint32_t>(x);
+    auto c = static_cast<std::uint32_t>(y >> 32);
+    auto d = static_cast<std::uint32_t>(y);
+
+    auto ac = umul64(a, c);
+    auto bc = umul64(b, c);
+    auto ad = umul64(a, d);
+    auto bd = umul64(b, d);
+
+    auto intermediate = (bd >> 32) + static_cast<std::uint32_t>(ad) + static_cast<std::uint32_t>(bc);
+
+    return {ac + (intermediate >> 32) + (ad >> 32) + (bc >> 32),
+            (intermediate << 32) + static_cast<std::uint32_t>(bd)};
+}
+
 // Get 128-bit result of multiplication of two 64-bit unsigned integers.
-BOOST_CHARCONV_SAFEBUFFERS inline uint128 umul128(std::uint64_t x, std::uint64_t y) noexcept 
+// The intrinsics can not be evaluated at compile time, so constant evaluation takes the portable path
+BOOST_CHARCONV_SAFEBUFFERS inline BOOST_CHARCONV_CXX20_CONSTEXPR uint128 umul128(std::uint64_t x, std::uint64_t y) noexcept 
 {
     #if defined(BOOST_CHARCONV_HAS_INT128)
     
@@ -853,6 +903,13 @@ BOOST_CHARCONV_SAFEBUFFERS inline uint128 umul128(std::uint64_t x, std::uint64_t
 
     // _umul128 is x64 only https://learn.microsoft.com/en-us/cpp/intrinsics/umul128?view=msvc-170
     #elif defined(BOOST_CHARCONV_HAS_MSVC_64BIT_INTRINSICS) && !defined(_M_ARM64)
+
+    #ifdef BOOST_CHARCONV_HAS_CONSTEXPR_FLOAT
+    if (std::is_constant_evaluated())
+    {
+        return umul128_generic(x, y);
+    }
+    #endif
     
     unsigned long long high;
     std::uint64_t low = _umul128(x, y, &high);
@@ -861,31 +918,25 @@ BOOST_CHARCONV_SAFEBUFFERS inline uint128 umul128(std::uint64_t x, std::uint64_t
     // https://developer.arm.com/documentation/dui0802/a/A64-General-Instructions/UMULH
     #elif defined(_M_ARM64) && !defined(__MINGW32__)
 
+    #ifdef BOOST_CHARCONV_HAS_CONSTEXPR_FLOAT
+    if (std::is_constant_evaluated())
+    {
+        return umul128_generic(x, y);
+    }
+    #endif
+
     std::uint64_t high = __umulh(x, y);
     std::uint64_t low = x * y;
     return {high, low};
 
     #else
-    
-    auto a = static_cast<std::uint32_t>(x >> 32);
-    auto b = static_cast<std::uint32_t>(x);
-    auto c = static_cast<std::uint32_t>(y >> 32);
-    auto d = static_cast<std::uint32_t>(y);
 
-    auto ac = umul64(a, c);
-    auto bc = umul64(b, c);
-    auto ad = umul64(a, d);
-    auto bd = umul64(b, d);
-
-    auto intermediate = (bd >> 32) + static_cast<std::uint32_t>(ad) + static_cast<std::uint32_t>(bc);
-
-    return {ac + (intermediate >> 32) + (ad >> 32) + (bc >> 32),
-            (intermediate << 32) + static_cast<std::uint32_t>(bd)};
+    return umul128_generic(x, y);
     
     #endif
 }
 
-BOOST_CHARCONV_SAFEBUFFERS inline std::uint64_t umul128_upper64(std::uint64_t x, std::uint64_t y) noexcept
+BOOST_CHARCONV_SAFEBUFFERS inline BOOST_CHARCONV_CXX20_CONSTEXPR std::uint64_t umul128_upper64(std::uint64_t x, std::uint64_t y) noexcept
 {
     #if defined(BOOST_CHARCONV_HAS_INT128)
     
@@ -893,6 +944,13 @@ BOOST_CHARCONV_SAFEBUFFERS inline std::uint64_t umul128_upper64(std::uint64_t x,
     return static_cast<std::uint64_t>(result >> 64);
     
     #elif defined(BOOST_CHARCONV_HAS_MSVC_64BIT_INTRINSICS)
+
+    #ifdef BOOST_CHARCONV_HAS_CONSTEXPR_FLOAT
+    if (std::is_constant_evaluated())
+    {
+        return umul128_generic(x, y).high;
+    }
+    #endif
     
     return __umulh(x, y);
     
@@ -917,7 +975,7 @@ BOOST_CHARCONV_SAFEBUFFERS inline std::uint64_t umul128_upper64(std::uint64_t x,
 
 // Get upper 128-bits of multiplication of a 64-bit unsigned integer and a 128-bit
 // unsigned integer.
-BOOST_CHARCONV_SAFEBUFFERS inline uint128 umul192_upper128(std::uint64_t x, uint128 y) noexcept
+BOOST_CHARCONV_SAFEBUFFERS inline BOOST_CHARCONV_CXX20_CONSTEXPR uint128 umul192_upper128(std::uint64_t x, uint128 y) noexcept
 {
     auto r = umul128(x, y.high);
     r += umul128_upper64(x, y.low);
@@ -926,7 +984,7 @@ BOOST_CHARCONV_SAFEBUFFERS inline uint128 umul192_upper128(std::uint64_t x, uint
 
 // Get upper 64-bits of multiplication of a 32-bit unsigned integer and a 64-bit
 // unsigned integer.
-inline std::uint64_t umul96_upper64(std::uint32_t x, std::uint64_t y) noexcept 
+inline BOOST_CHARCONV_CXX20_CONSTEXPR std::uint64_t umul96_upper64(std::uint32_t x, std::uint64_t y) noexcept 
 {
     #if defined(BOOST_CHARCONV_HAS_INT128) || defined(BOOST_CHARCONV_HAS_MSVC_64BIT_INTRINSICS)
     
@@ -947,7 +1005,7 @@ inline std::uint64_t umul96_upper64(std::uint32_t x, std::uint64_t y) noexcept
 
 // Get lower 128-bits of multiplication of a 64-bit unsigned integer and a 128-bit
 // unsigned integer.
-BOOST_CHARCONV_SAFEBUFFERS inline uint128 umul192_lower128(std::uint64_t x, uint128 y) noexcept
+BOOST_CHARCONV_SAFEBUFFERS inline BOOST_CHARCONV_CXX20_CONSTEXPR uint128 umul192_lower128(std::uint64_t x, uint128 y) noexcept
 {
     auto high = x * y.high;
     auto highlow = umul128(x, y.low);
@@ -956,11 +1014,109 @@ BOOST_CHARCONV_SAFEBUFFERS inline uint128 umul192_lower128(std::uint64_t x, uint
 
 // Get lower 64-bits of multiplication of a 32-bit unsigned integer and a 64-bit
 // unsigned integer.
-inline std::uint64_t umul96_lower64(std::uint32_t x, std::uint64_t y) noexcept 
+inline BOOST_CHARCONV_CXX20_CONSTEXPR std::uint64_t umul96_lower64(std::uint32_t x, std::uint64_t y) noexcept 
 {
     return x * y;
 }
 
+// Get lower 128-bits of multiplication of two 128-bit unsigned integers.
+BOOST_CHARCONV_SAFEBUFFERS inline BOOST_CHARCONV_CXX20_CONSTEXPR uint128 umul256_lower128(uint128 x, uint128 y) noexcept
+{
+    auto r = umul128(x.low, y.low);
+    r.high += x.low * y.high + x.high * y.low;
+    return r;
+}
+
+// Quotients and remainders of 128-bit values by the constants of the decimal conversions without a 128-bit division,
+// which is a bit at a time loop for uint128 and a call to __udivti3 for the built-in type.
+// A divisor is 2^Shift * Odd: the low Shift bits are the remainder by 2^Shift, the remainder by Odd is that of the
+// 64-bit halves since 2^64 mod Odd is a constant, and the quotient by Odd is then exact, which is a multiplication by
+// the inverse of Odd modulo 2^128 (Granlund and Montgomery, "Division by Invariant Integers using Multiplication", section 9)
+template <int Shift, std::uint32_t Odd, std::uint64_t Two_64_Mod_Odd, std::uint64_t Inverse_High, std::uint64_t Inverse_Low>
+BOOST_FORCEINLINE BOOST_CHARCONV_CXX20_CONSTEXPR std::uint32_t div_mod_small_constant(uint128& x) noexcept
+{
+    const auto low_bits = static_cast<std::uint32_t>(x.low & ((UINT64_C(1) << Shift) - 1U));
+    x >>= Shift;
+
+    const std::uint64_t odd_remainder = ((x.high % Odd) * Two_64_Mod_Odd + x.low % Odd) % Odd;
+    x = umul256_lower128(uint128 {x.high - static_cast<std::uint64_t>(x.low < odd_remainder), x.low - odd_remainder}, uint128 {Inverse_High, Inverse_Low});
+
+    return (static_cast<std::uint32_t>(odd_remainder) << Shift) | low_bits;
+}
+
+// Replaces x by x / 5 and returns x % 5
+BOOST_FORCEINLINE BOOST_CHARCONV_CXX20_CONSTEXPR std::uint32_t div_mod_5(uint128& x) noexcept
+{
+    return div_mod_small_constant<0, 5, 1, UINT64_C(0xCCCCCCCCCCCCCCCC), UINT64_C(0xCCCCCCCCCCCCCCCD)>(x);
+}
+
+// Replaces x by x / 10 and returns x % 10
+BOOST_FORCEINLINE BOOST_CHARCONV_CXX20_CONSTEXPR std::uint32_t div_mod_10(uint128& x) noexcept
+{
+    return div_mod_small_constant<1, 5, 1, UINT64_C(0xCCCCCCCCCCCCCCCC), UINT64_C(0xCCCCCCCCCCCCCCCD)>(x);
+}
+
+// Replaces x by x / 10^9 and returns x % 10^9
+BOOST_FORCEINLINE BOOST_CHARCONV_CXX20_CONSTEXPR std::uint32_t div_mod_10_9(uint128& x) noexcept
+{
+    return div_mod_small_constant<9, 1953125, 567241, UINT64_C(0x97157D372FB9787E), UINT64_C(0x8E47CE423A2E9C6D)>(x);
+}
+
+// Replaces the 128-bit value high:low by its quotient by 10^19 and returns the remainder.
+// Dividing by 10^19 is shifting right by 19 and dividing what is left, which is below 2^109, by 5^19.
+// That is a multiplication by the rounded up reciprocal ceil(2^154 / 5^19) which is exact for all 109-bit numbers (Granlund and Montgomery),
+// so no 128-bit division is needed
+BOOST_FORCEINLINE BOOST_CHARCONV_CXX20_CONSTEXPR std::uint64_t divide_by_10_19(std::uint64_t& high, std::uint64_t& low) noexcept
+{
+    constexpr std::uint64_t reciprocal_high = UINT64_C(0x3B07929F6DA5);
+    constexpr std::uint64_t reciprocal_low = UINT64_C(0x58694ACC7A78F41C);
+    constexpr std::uint64_t ten_19 = UINT64_C(10000000000000000000);
+
+    const std::uint64_t shifted_high = high >> 19;
+    const std::uint64_t shifted_low = (high << 45) | (low >> 19);
+
+    uint128 middle = umul128(shifted_high, reciprocal_low);
+    middle += umul128(shifted_low, reciprocal_high);
+    middle += umul128_upper64(shifted_low, reciprocal_low);
+
+    uint128 quotient = umul128(shifted_high, reciprocal_high);
+    quotient += middle.high;
+    quotient >>= 26;
+
+    // The remainder is below 2^64, so the low words are enough to compute it
+    const std::uint64_t remainder = low - quotient.low * ten_19;
+    high = quotient.high;
+    low = quotient.low;
+    return remainder;
+}
+
+// Replaces x by x / 10^19 and returns x % 10^19
+BOOST_FORCEINLINE BOOST_CHARCONV_CXX20_CONSTEXPR std::uint64_t div_mod_10_19(uint128& x) noexcept
+{
+    return divide_by_10_19(x.high, x.low);
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+
+// The same for the built-in type, for which compilers call a 128-bit division function even for constants
+#define BOOST_CHARCONV_BUILTIN_DIV_MOD(name, remainder_type)                                                        \
+BOOST_FORCEINLINE BOOST_CHARCONV_CXX20_CONSTEXPR remainder_type name(boost::uint128_type& x) noexcept              \
+{                                                                                                                   \
+    uint128 v {x};                                                                                                  \
+    const remainder_type r = name(v);                                                                               \
+    x = static_cast<boost::uint128_type>(v);                                                                        \
+    return r;                                                                                                       \
+}
+
+BOOST_CHARCONV_BUILTIN_DIV_MOD(div_mod_5, std::uint32_t)
+BOOST_CHARCONV_BUILTIN_DIV_MOD(div_mod_10, std::uint32_t)
+BOOST_CHARCONV_BUILTIN_DIV_MOD(div_mod_10_9, std::uint32_t)
+BOOST_CHARCONV_BUILTIN_DIV_MOD(div_mod_10_19, std::uint64_t)
+
+#undef BOOST_CHARCONV_BUILTIN_DIV_MOD
+
+#endif // BOOST_CHARCONV_HAS_INT128
+
 }}} // Namespaces
 
 // Non-standard libraries may add specializations for library-provided types
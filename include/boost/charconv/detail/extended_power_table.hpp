@@ -0,0 +1,440 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_EXTENDED_POWER_TABLE_HPP
+#define BOOST_CHARCONV_DETAIL_EXTENDED_POWER_TABLE_HPP
+
+#include <cstdint>
+
+namespace boost { namespace charconv { namespace detail {
+
+/**
+ * 256-bit approximations of the powers of ten used by the Eisel-Lemire algorithm for
+ * the 80-bit and 128-bit floating point formats (see compute_float80.hpp).
+ *
+ * The smallest subnormal binary128 value is 2^-16494 (about 6.5e-4966) and the significand
+ * of the parser has at most 38 digits, so no power below 10^-5005 can give a non-zero result.
+ * Anything above 10^4932 is infinite in both formats.
+ *
+ * Storing all 9938 powers would take more than 300KB, so only every 27th power is stored and the others are
+ * recovered with one multiplication by 5^r (r < 27 fits in 64 bits). Each entry is the normalized significand
+ * floor(10^q * 2^(255 - floor(log2(10^q)))) with the most significant word first.
+ * The recovered values are below the exact significand by less than 3 units in the last place.
+ */
+template <class unused = void>
+struct extended_powers_template
+{
+    static constexpr int smallest_power_of_ten = -5005;
+    static constexpr int largest_power_of_ten = 4932;
+    static constexpr int step = 27;
+    static constexpr int number_of_entries = (largest_power_of_ten - smallest_power_of_ten) / step + 1;
+
+    static constexpr std::uint64_t power_of_five[step] = {
+        UINT64_C(1), UINT64_C(5), UINT64_C(25),
+        UINT64_C(125), UINT64_C(625), UINT64_C(3125),
+        UINT64_C(15625), UINT64_C(78125), UINT64_C(390625),
+        UINT64_C(1953125), UINT64_C(9765625), UINT64_C(48828125),
+        UINT64_C(244140625), UINT64_C(1220703125), UINT64_C(6103515625),
+        UINT64_C(30517578125), UINT64_C(152587890625), UINT64_C(762939453125),
+        UINT64_C(3814697265625), UINT64_C(19073486328125), UINT64_C(95367431640625),
+        UINT64_C(476837158203125), UINT64_C(2384185791015625), UINT64_C(11920928955078125),
+        UINT64_C(59604644775390625), UINT64_C(298023223876953125), UINT64_C(1490116119384765625)
+    };
+
+    static constexpr std::uint64_t power_of_ten_256[number_of_entries * 4] = {
+        UINT64_C(0xd740992314ad6bb8), UINT64_C(0x96c34f43a9faced7), UINT64_C(0xb76974f01fd4d2a5), UINT64_C(0x36551d5caebe5f19), // 1e-5005
+        UINT64_C(0xade123d2571b65ee), UINT64_C(0x1bfbdc809dd6b433), UINT64_C(0x99c287d3782262e2), UINT64_C(0xedea57482a795273), // 1e-4978
+        UINT64_C(0x8c756d9690026f13), UINT64_C(0x8cddd6655427f741), UINT64_C(0xa4839a4902123ba3), UINT64_C(0x4cd703075092b61c), // 1e-4951
+        UINT64_C(0xe2ec5bb124a4ee5a), UINT64_C(0x08c20da46cc907b8), UINT64_C(0xa6ad9fe918aeed7c), UINT64_C(0x1abe3f0978b83a87), // 1e-4924
+        UINT64_C(0xb74ea21ab2946479), UINT64_C(0xbab3a28a6f0a489c), UINT64_C(0x5a7d22b5236bcad4), UINT64_C(0xc09b7fe7c4659d9b), // 1e-4897
+        UINT64_C(0x9413084d8f348794), UINT64_C(0x925af3e6cef5dd98), UINT64_C(0x244977e2d3f77d85), UINT64_C(0x77343f249a702940), // 1e-4870
+        UINT64_C(0xef3a1d2778f63353), UINT64_C(0xb29c910ea124e63d), UINT64_C(0xf42d431253c5c486), UINT64_C(0x5b42291696837bd5), // 1e-4843
+        UINT64_C(0xc13efc51ade7df64), UINT64_C(0xe05fe4207ca3d508), UINT64_C(0x4e3cc383eaa17b7b), UINT64_C(0x0333d510cf27e5a5), // 1e-4816
+        UINT64_C(0x9c1a580c2687c913), UINT64_C(0x32ac28e9d82f8955), UINT64_C(0x0c7359ab6f16eafc), UINT64_C(0x4f0b0a9839303552), // 1e-4789
+        UINT64_C(0xfc32a61159655ab2), UINT64_C(0x38bff09b3d6f48d8), UINT64_C(0xc832da0ac29f1aa2), UINT64_C(0x8e42c81cf0546d16), // 1e-4762
+        UINT64_C(0xcbb94ad34cac4b8b), UINT64_C(0xf7ac3df2f8d2a9da), UINT64_C(0xdf3037bfa11448f9), UINT64_C(0x4ca26954a0d027a1), // 1e-4735
+        UINT64_C(0xa4911810a98cfe08), UINT64_C(0x3897d402e6c26e88), UINT64_C(0xed5014f6e7d3c0ce), UINT64_C(0x59e12946702adb56), // 1e-4708
+        UINT64_C(0x84ef9c723920c754), UINT64_C(0x5168595226582eb2), UINT64_C(0x950850a131146617), UINT64_C(0xf31c1e299634ae5f), // 1e-4681
+        UINT64_C(0xd6c50877206aaf59), UINT64_C(0x03c7047f8a0d30f9), UINT64_C(0xb57d42a3cb6882c4), UINT64_C(0x2295408a0e941887), // 1e-4654
+        UINT64_C(0xad7d5327271a146d), UINT64_C(0x02c036754c3a1df7), UINT64_C(0xd04bfaaf70ecd80e), UINT64_C(0xcaf4bd3667d060fb), // 1e-4627
+        UINT64_C(0x8c24cc4e867eb529), UINT64_C(0xcd77bc4633689770), UINT64_C(0xbec56ff2c1071641), UINT64_C(0xee47fcda0444abbc), // 1e-4600
+        UINT64_C(0xe26a17e73fbc7205), UINT64_C(0xb499658ab5a84046), UINT64_C(0x28c02b6f41dabce0), UINT64_C(0x744d223671928048), // 1e-4573
+        UINT64_C(0xb6e567f9a3167886), UINT64_C(0xe457bf75827b5692), UINT64_C(0xe3252326713fede0), UINT64_C(0x9228854905f4920d), // 1e-4546
+        UINT64_C(0x93be07db04a13f97), UINT64_C(0x542c608c1525e9a6), UINT64_C(0x6e8f5f31c4c815f5), UINT64_C(0xf9867e4d891f9075), // 1e-4519
+        UINT64_C(0xeeb0c9415b412e08), UINT64_C(0xa23f1d392662a809), UINT64_C(0xb738eda2a0950559), UINT64_C(0xc0db3fc65e1ee874), // 1e-4492
+        UINT64_C(0xc0d00d9c2f3a5ec6), UINT64_C(0xa60a3caf9c5492cd), UINT64_C(0x9ac6ece1c1a3197f), UINT64_C(0xba41c88f602c942e), // 1e-4465
+        UINT64_C(0x9bc0bbc0c8052f2c), UINT64_C(0x3e7013bec05ffc21), UINT64_C(0x194d3593e4723db4), UINT64_C(0x1cfb6b3ce3130563), // 1e-4438
+        UINT64_C(0xfba1e005f52e8cf4), UINT64_C(0x57c0c0c5ea4a820e), UINT64_C(0xf5a28c9f7f215628), UINT64_C(0xc9bf1a8b71b1035c), // 1e-4411
+        UINT64_C(0xcb44585821c722ec), UINT64_C(0xec6ec617f2819a18), UINT64_C(0x6489536309952135), UINT64_C(0xe81189ae24fdce12), // 1e-4384
+        UINT64_C(0xa4329ff3dfaa5024), UINT64_C(0xd3d87d88c0ca1310), UINT64_C(0xcde67393e4026c7b), UINT64_C(0x1e4556d5e6193981), // 1e-4357
+        UINT64_C(0x84a34cacfc01d12e), UINT64_C(0xffe4caaa907b2292), UINT64_C(0x9ab22907abaaa9f2), UINT64_C(0xbdbec31707fd227e), // 1e-4330
+        UINT64_C(0xd649beb9d64db88c), UINT64_C(0x5d3bc457c80a031e), UINT64_C(0xed170cfb97f31f9b), UINT64_C(0x02e6a2ac6517c2b8), // 1e-4303
+        UINT64_C(0xad19bbc86aee76e7), UINT64_C(0x30a0831fe1304870), UINT64_C(0x43417ab584d5c595), UINT64_C(0x3e34b2715c21cb6e), // 1e-4276
+        UINT64_C(0x8bd4594f91db7288), UINT64_C(0x0a01eafd1d6cc17e), UINT64_C(0x40a082d518ab3fe0), UINT64_C(0xd7a8fdd032b0455a), // 1e-4249
+        UINT64_C(0xe1e81ee494186984), UINT64_C(0x6f4a6a30fdd6111e), UINT64_C(0x8751a1f693714331), UINT64_C(0x039183f5ed355a78), // 1e-4222
+        UINT64_C(0xb67c6a405978ffb5), UINT64_C(0xf25b5ae38d1a96d1), UINT64_C(0xee6a58595a5fdb3a), UINT64_C(0x27dd10bd84e5be5a), // 1e-4195
+        UINT64_C(0x936938340359e22c), UINT64_C(0xa64ea358dfcf3467), UINT64_C(0x6192c77a2778cd8c), UINT64_C(0x67d54b5e43146e90), // 1e-4168
+        UINT64_C(0xee27c43067e0b31e), UINT64_C(0x522ed8945302acd3), UINT64_C(0xfe4bcc8486b450ef), UINT64_C(0x13e4485a3c7faec9), // 1e-4141
+        UINT64_C(0xc0615e94e7bad6d7), UINT64_C(0xb90686d0c60e1b20), UINT64_C(0x95a5138d85e1b5e1), UINT64_C(0xbd61265f9ade8f44), // 1e-4114
+        UINT64_C(0x9b6752e63cab95ed), UINT64_C(0xa9816751a676397a), UINT64_C(0xeccdcfb68a83ec1b), UINT64_C(0x4338bd91ee2ed9cc), // 1e-4087
+        UINT64_C(0xfb116d15f344b9b0), UINT64_C(0x953d136b9a19cdb5), UINT64_C(0x3cc4fe5541a1306d), UINT64_C(0x3aabf07c983d152a), // 1e-4060
+        UINT64_C(0xcacfa8ff152c233c), UINT64_C(0x404254207f3f4f5c), UINT64_C(0x39c1d81f75f8b317), UINT64_C(0xb22dbabd6ac3b161), // 1e-4033
+        UINT64_C(0xa3d45e11ebbfdd22), UINT64_C(0xabe84d7fea1a94fb), UINT64_C(0xd3e29a4f22b48884), UINT64_C(0x6c0d347e760535eb), // 1e-4006
+        UINT64_C(0x845728b6360b9a74), UINT64_C(0xbe250181ae1a520d), UINT64_C(0x75c1619a24947b52), UINT64_C(0xf11114e3f20632ba), // 1e-3979
+        UINT64_C(0xd5cebbc27e65a603), UINT64_C(0xf81807575fd38f1e), UINT64_C(0x51cb9794eeabc016), UINT64_C(0x59da85a36d8f433c), // 1e-3952
+        UINT64_C(0xacb65d953e3416f2), UINT64_C(0x46a1318f79dfe933), UINT64_C(0x792ad4fe1fe9395b), UINT64_C(0xf69971b1af4c25d2), // 1e-3925
+        UINT64_C(0x8b84147f20284f84), UINT64_C(0x7c72eae77cd5608f), UINT64_C(0x60371cc9b70232c2), UINT64_C(0x6c4b8e31229450a2), // 1e-3898
+        UINT64_C(0xe166707e3498dd40), UINT64_C(0x50d99ebb1f694cee), UINT64_C(0x288e69d832a591fd), UINT64_C(0x63a4a50c7b70a353), // 1e-3871
+        UINT64_C(0xb613a8cc28ca374b), UINT64_C(0x05a503eb272cc542), UINT64_C(0x836fbac287cd7a03), UINT64_C(0xb1a6126d0237f1bd), // 1e-3844
+        UINT64_C(0x9314993c88a15ce7), UINT64_C(0x7a77a235e021f3a1), UINT64_C(0x7cdd929d9e2ba85b), UINT64_C(0x4659b052bd4dd44c), // 1e-3817
+        UINT64_C(0xed9f0dc75de0cd44), UINT64_C(0x8a09f5043b279b1d), UINT64_C(0x4387d5a60e2ac79a), UINT64_C(0x85dcda374ca12df0), // 1e-3790
+        UINT64_C(0xbff2ef1749292865), UINT64_C(0xb293d505b66ebc4e), UINT64_C(0x33bfbc083532baf3), UINT64_C(0xe9d145163e581b74), // 1e-3763
+        UINT64_C(0x9b0e1d5efcf22639), UINT64_C(0xcede6f194474c022), UINT64_C(0x1747a37896c7b291), UINT64_C(0x3fe99ed013129f24), // 1e-3736
+        UINT64_C(0xfa814d119e91ad0b), UINT64_C(0x94db906123225e60), UINT64_C(0x9c5fd0022cae7afb), UINT64_C(0xaebe986274da50cd), // 1e-3709
+        UINT64_C(0xca5b3ca19d34288a), UINT64_C(0xd3f8b6a11bde8906), UINT64_C(0x5a3afebde3e7a5e5), UINT64_C(0x6f3966d9c102a9bd), // 1e-3682
+        UINT64_C(0xa376524bac6471a5), UINT64_C(0xc18284b9beaadbde), UINT64_C(0x4dd6d9b10a7eee52), UINT64_C(0x05a4f0d06a132463), // 1e-3655
+        UINT64_C(0x840b3074c19a94e0), UINT64_C(0x4056bdc43c50b4ec), UINT64_C(0xd70eec1088bcde87), UINT64_C(0xa99c4ff6719f5685), // 1e-3628
+        UINT64_C(0xd553ff6878216d7e), UINT64_C(0x859c3d35d2ebc4ed), UINT64_C(0x7a04b70eaf7f29b7), UINT64_C(0xa57d0a58138f6cd3), // 1e-3601
+        UINT64_C(0xac53386ccf683342), UINT64_C(0x5ca6e44dee8d33ce), UINT64_C(0x762a4f19c2c6dbb1), UINT64_C(0x6d5e42299959c670), // 1e-3574
+        UINT64_C(0x8b33fdc2aeb597bd), UINT64_C(0x88220b9ad7ed40b6), UINT64_C(0x058da952ab40d794), UINT64_C(0x6dcd779b9b0cd751), // 1e-3547
+        UINT64_C(0xe0e50c894cc21dfd), UINT64_C(0x81884dd8cb5eb34a), UINT64_C(0x294d82f85639fb9c), UINT64_C(0x6ddd26ef279b0d05), // 1e-3520
+        UINT64_C(0xb5ab237a780026cf), UINT64_C(0xb488122830b22f41), UINT64_C(0x6cffe2faffdfb62f), UINT64_C(0xe34b0e471219629d), // 1e-3493
+        UINT64_C(0x92c02ad8a1cef60d), UINT64_C(0xa136f1c944446f98), UINT64_C(0x857679af3ee9c2b4), UINT64_C(0x3e407abc8f50af94), // 1e-3466
+        UINT64_C(0xed16a5d91647d82b), UINT64_C(0x5bb8126cf1430f6f), UINT64_C(0x4de36657a3da7e18), UINT64_C(0x087832a148ed0527), // 1e-3439
+        UINT64_C(0xbf84befeda414971), UINT64_C(0x841a8f22aca55cba), UINT64_C(0xb920e80d2c67ca5a), UINT64_C(0xa23d2065f522f5a0), // 1e-3412
+        UINT64_C(0x9ab51b0d924391a3), UINT64_C(0x406f7004039e42ab), UINT64_C(0xe2515cb48f80e562), UINT64_C(0x914a1d676ada1a66), // 1e-3385
+        UINT64_C(0xf9f17fc95d621855), UINT64_C(0xb757828a0a9cb678), UINT64_C(0x2f0e0657f9950663), UINT64_C(0x9a1c7555824c0f89), // 1e-3358
+        UINT64_C(0xc9e7131946576a0e), UINT64_C(0xf86b4f750d5d6094), UINT64_C(0x1ccfe338c55891ea), UINT64_C(0x9bb18b843c01d69d), // 1e-3331
+        UINT64_C(0xa3187c82120dace6), UINT64_C(0x7401c6f091f87727), UINT64_C(0x08251c601e346456), UINT64_C(0x40ed8056af76ac43), // 1e-3304
+        UINT64_C(0x83bf63cf877ab54e), UINT64_C(0xdc109c6f283a3ef0), UINT64_C(0x782c82708af1cbce), UINT64_C(0x048bd6bdbf37e04c), // 1e-3277
+        UINT64_C(0xd4d989833a4270c5), UINT64_C(0x81bc6a3204eb765a), UINT64_C(0xd12b0ba9845a8fd0), UINT64_C(0x0fdc797484cccb3b), // 1e-3250
+        UINT64_C(0xabf04c2e5fdee8e2), UINT64_C(0x9467735ae8a66a70), UINT64_C(0x972a4b0dd4fe9a9f), UINT64_C(0x27a78eac38c29641), // 1e-3223
+        UINT64_C(0x8ae414ffca0b78a6), UINT64_C(0xe037643adf69f154), UINT64_C(0x28092b0160d2da96), UINT64_C(0xa3fdd7e28de58b76), // 1e-3196
+        UINT64_C(0xe063f2db20ae9f98), UINT64_C(0xccb1ccef123f00bd), UINT64_C(0xf93beb7f447e3de0), UINT64_C(0xc3634c7eef9eee84), // 1e-3169
+        UINT64_C(0xb542da28c1ed32d8), UINT64_C(0xf10c71059bef1855), UINT64_C(0xb4c6d9fe94536e23), UINT64_C(0x99d18448e9e2b7d7), // 1e-3142
+        UINT64_C(0x926becec6c45119d), UINT64_C(0x08653838c58a9eb0), UINT64_C(0x643742a067e7d510), UINT64_C(0xb04299b53b3fbed2), // 1e-3115
+        UINT64_C(0xec8e8c38840796e9), UINT64_C(0xb770cee5123a5dd6), UINT64_C(0x8bc30a99c36e5e05), UINT64_C(0xbdd32df8e0f9617c), // 1e-3088
+        UINT64_C(0xbf16ce2736af395a), UINT64_C(0x6ed0995755b03bde), UINT64_C(0xcc971ea625937d0c), UINT64_C(0x92f0060f9365be6b), // 1e-3061
+        UINT64_C(0x9a5c4bd496f45753), UINT64_C(0x3be1d5234b9fdf4d), UINT64_C(0xfe6df49f296a2f72), UINT64_C(0xc925afab924695da), // 1e-3034
+        UINT64_C(0xf962050db155d974), UINT64_C(0x61fecd00e68463a7), UINT64_C(0x7ba40493f8fa747b), UINT64_C(0xf65a9e25ff0fdcaf), // 1e-3007
+        UINT64_C(0xc9732c3fb320c71a), UINT64_C(0xfbedd1f7dcae406d), UINT64_C(0x7ab342913ad88003), UINT64_C(0x2efdce0eed642801), // 1e-2980
+        UINT64_C(0xa2badc961f05be86), UINT64_C(0xd4b6f02d493a81c7), UINT64_C(0xa496473515e55988), UINT64_C(0x0495133b655e8a17), // 1e-2953
+        UINT64_C(0x8373c2ad7edf2a59), UINT64_C(0xfcfb59d62dee0d6d), UINT64_C(0x7f22b760ba1253c2), UINT64_C(0x7d38ca483fb37acf), // 1e-2926
+        UINT64_C(0xd45f59ea52cf1a5e), UINT64_C(0x7da8d742d35eba3a), UINT64_C(0x4950ff1ecf7967f8), UINT64_C(0xeb3caca6d3d68812), // 1e-2899
+        UINT64_C(0xab8d98b943b862a6), UINT64_C(0x876a27a72e171a44), UINT64_C(0xa75aa337c7c5434f), UINT64_C(0xc9267fc73f5c7aae), // 1e-2872
+        UINT64_C(0x8a945a1c0de1451d), UINT64_C(0x60f2841d196ac766), UINT64_C(0x33808da7f3d473ee), UINT64_C(0xff428b06158e3043), // 1e-2845
+        UINT64_C(0xdfe323490d00dbe4), UINT64_C(0xf9b8f0e6ccde36a8), UINT64_C(0x995ead7ef7adab9c), UINT64_C(0x1dbc100e581f60f8), // 1e-2818
+        UINT64_C(0xb4daccb49534b65c), UINT64_C(0x2788f6e2d3549d06), UINT64_C(0xdb9fd135f6202de2), UINT64_C(0x72987efe6529943f), // 1e-2791
+        UINT64_C(0x9217df5c1567fb9d), UINT64_C(0x7022ac7459862eaf), UINT64_C(0x880bccd20d9cd5f2), UINT64_C(0xc81d100744cf76a6), // 1e-2764
+        UINT64_C(0xec06c0b8b3ee52f3), UINT64_C(0x7bc1c3a68f8d0d4b), UINT64_C(0x8009059216f34d22), UINT64_C(0x0bb65b3f6554d858), // 1e-2737
+        UINT64_C(0xbea91c6c0f02fbf3), UINT64_C(0x3fb5d48d6ea56439), UINT64_C(0x8ed1751bee01791e), UINT64_C(0x70146221909faecb), // 1e-2710
+        UINT64_C(0x9a03af96b6390e86), UINT64_C(0x222496be8c2fd150), UINT64_C(0x7e89219a3ea7ee0b), UINT64_C(0x81dd0e4571f989b8), // 1e-2683
+        UINT64_C(0xf8d2dcaf37504b51), UINT64_C(0x9492db3d978aaca8), UINT64_C(0x50d3e92e2e4f8210), UINT64_C(0x946e2f2071475aca), // 1e-2656
+        UINT64_C(0xc8ff87ee9c211b5d), UINT64_C(0xf7e0be0e7d08f371), UINT64_C(0x4756563338091538), UINT64_C(0xd6f08bd0d92b8f00), // 1e-2629
+        UINT64_C(0xa25d7268e7612a4b), UINT64_C(0x85cdea5bf79d4c19), UINT64_C(0x239e79b0ea747c2d), UINT64_C(0xfdb12e3a18617f8a), // 1e-2602
+        UINT64_C(0x83284cf5ad5a17b2), UINT64_C(0x628207e6a2ecff5b), UINT64_C(0x7df4c3da994239ca), UINT64_C(0x74569f2753b7b2e7), // 1e-2575
+        UINT64_C(0xd3e57075670581eb), UINT64_C(0xda84beac12680510), UINT64_C(0x2362cf9a1702089d), UINT64_C(0x95b69ee78076f52f), // 1e-2548
+        UINT64_C(0xab2b1dece1d60ed0), UINT64_C(0xfdb71ed7cd9b8e9f), UINT64_C(0x093f15867b5446d2), UINT64_C(0xe74be30ab7e41369), // 1e-2521
+        UINT64_C(0x8a44ccfd2514bdfe), UINT64_C(0xb927745ecf035059), UINT64_C(0x0a28420f09ceed2c), UINT64_C(0x65ac92f009eb920d), // 1e-2494
+        UINT64_C(0xdf629da886d53da2), UINT64_C(0x41b4f6bbedd87589), UINT64_C(0xd82ac3d90c3da0f0), UINT64_C(0x427f7317bddcda25), // 1e-2467
+        UINT64_C(0xb472fafb943fa28f), UINT64_C(0xd19c70f25ea3841d), UINT64_C(0xb987afdb6c11dd30), UINT64_C(0x14475f6a311e654d), // 1e-2440
+        UINT64_C(0x91c4020bda94b7bb), UINT64_C(0x8bb7fd84a0f9c8d6), UINT64_C(0x39228216f1329f20), UINT64_C(0xa1324d20133fc12d), // 1e-2413
+        UINT64_C(0xeb7f432ccc98039a), UINT64_C(0x178fa7718cd79a3c), UINT64_C(0x75457b71fb996f35), UINT64_C(0x1cc5f894745c948e), // 1e-2386
+        UINT64_C(0xbe3ba9a928a49b7d), UINT64_C(0xd7b135dc9029d2e4), UINT64_C(0xc219dd15bb99d2f9), UINT64_C(0xabcb11eb0fb628f6), // 1e-2359
+        UINT64_C(0x99ab4636ac1cb69a), UINT64_C(0xbca0f10146b4d9a2), UINT64_C(0xd80ba657540f7601), UINT64_C(0x8cd7aaacd2258717), // 1e-2332
+        UINT64_C(0xf844067ea7689f4c), UINT64_C(0x9f52a93384c4e053), UINT64_C(0xd679661b412a5c0f), UINT64_C(0xd8843cc50660bad4), // 1e-2305
+        UINT64_C(0xc88c25ffcfe29a6a), UINT64_C(0xaf1275c913448af0), UINT64_C(0xbdfe5ce0f33acb47), UINT64_C(0xc9ad3a2770cc1959), // 1e-2278
+        UINT64_C(0xa2003ddb90f491b4), UINT64_C(0xc3595d1b8c25698d), UINT64_C(0x3d6c30ece695c354), UINT64_C(0xd2bd0d11b958266c), // 1e-2251
+        UINT64_C(0x82dd028f26d4563a), UINT64_C(0x6b78172159fa0165), UINT64_C(0xfdcea0b8fa132196), UINT64_C(0x1988e8259d238db4), // 1e-2224
+        UINT64_C(0xd36bccfc334e1838), UINT64_C(0x8ae3a86aa9eb109b), UINT64_C(0x34f0e3cf9b1af020), UINT64_C(0x69e83eed846b5b37), // 1e-2197
+        UINT64_C(0xaac8dba8b3cfdaec), UINT64_C(0x5ce2ab3cd3a147da), UINT64_C(0xc67ebde29b7a6a5d), UINT64_C(0xa1df654285998e3e), // 1e-2170
+        UINT64_C(0x89f56d88c9a15fc2), UINT64_C(0x02f9acd410b5c3bb), UINT64_C(0x0f9e1355db78040e), UINT64_C(0xdfed0a7235ced51f), // 1e-2143
+        UINT64_C(0xdee261cf1bb4138b), UINT64_C(0x3b3a270b46e36aaf), UINT64_C(0xb01b9edc96f8df2f), UINT64_C(0x6ccaf1ce4d0e6816), // 1e-2116
+        UINT64_C(0xb40b64db75312553), UINT64_C(0xbbbae7828473dfff), UINT64_C(0x42b463b1e8f134de), UINT64_C(0xc8c5102893ab259c), // 1e-2089
+        UINT64_C(0x917054e00917d62a), UINT64_C(0x856bec6e83976bfe), UINT64_C(0xc155dcba3c8e5b59), UINT64_C(0x22784edafd00e5eb), // 1e-2062
+        UINT64_C(0xeaf813680e5f7e12), UINT64_C(0xd6e078798eef0137), UINT64_C(0x690bf23c9d13417f), UINT64_C(0xad080c95466f29a6), // 1e-2035
+        UINT64_C(0xbdce75ba5dc83189), UINT64_C(0x09de0e5c0a15659b), UINT64_C(0x96e72277e3dcda08), UINT64_C(0xea3067628c6239d0), // 1e-2008
+        UINT64_C(0x99530f9745770cb1), UINT64_C(0x1d21bafbc6bdf274), UINT64_C(0x071757fa70f8ecf6), UINT64_C(0x7582aaaf505f7d2c), // 1e-1981
+        UINT64_C(0xf7b5824cd4da3fa6), UINT64_C(0xcded519287913ab9), UINT64_C(0xdb2850eced681b9c), UINT64_C(0x516a2af60a11b995), // 1e-1954
+        UINT64_C(0xc819064d32dc3280), UINT64_C(0x5004c8187c4dc5bd), UINT64_C(0x51bc6d1770b8b899), UINT64_C(0xf485a2f816b802e7), // 1e-1927
+        UINT64_C(0xa1a33ecf534a8374), UINT64_C(0x370eda2e4518d507), UINT64_C(0x488bbfb8f4b671c6), UINT64_C(0x298dcc1af05f46fa), // 1e-1900
+        UINT64_C(0x8291e3610d8538dc), UINT64_C(0xb6355d435d047d1f), UINT64_C(0xe6b8f367a8215733), UINT64_C(0xbf2dd5924ac726a2), // 1e-1873
+        UINT64_C(0xd2f26f568b2e5aea), UINT64_C(0x742e7ecc2487536b), UINT64_C(0xae554b9889bef25a), UINT64_C(0xb8115efe239e5a90), // 1e-1846
+        UINT64_C(0xaa66d1cc45e975d1), UINT64_C(0x412d3bba910e6288), UINT64_C(0x6d2ef9122930e6f1), UINT64_C(0x28a1d058bb22e41b), // 1e-1819
+        UINT64_C(0x89a63ba4c497b50e), UINT64_C(0x6c83ad1260ff20f4), UINT64_C(0xc098e6ed0bfbd6f6), UINT64_C(0xb62593291c768919), // 1e-1792
+        UINT64_C(0xde626f9271838b72), UINT64_C(0x9845f7c1d9258fb5), UINT64_C(0xa61e2a2de198badf), UINT64_C(0xc3bff2a401102803), // 1e-1765
+        UINT64_C(0xb3a40a3201db561d), UINT64_C(0x3dacbb8ccff07907), UINT64_C(0x8547cba3050a905a), UINT64_C(0x55ac28b61dc84a04), // 1e-1738
+        UINT64_C(0x911cd7bcfe244dc8), UINT64_C(0xde1de1bad23e3145), UINT64_C(0xc75f08e4908f88c4), UINT64_C(0x10324f07f4258392), // 1e-1711
+        UINT64_C(0xea71313dd34fadfd), UINT64_C(0xf60d1acb7b204a8c), UINT64_C(0xb0ff65cac17bd494), UINT64_C(0x3e59ede98a1d7065), // 1e-1684
+        UINT64_C(0xbd61807b9d61f6ac), UINT64_C(0xdc5f294523e7e980), UINT64_C(0xede1fa24b4368569), UINT64_C(0x8bec2789466543c1), // 1e-1657
+        UINT64_C(0x98fb0b9b5fe2e6d5), UINT64_C(0xe731dbb0149142b1), UINT64_C(0x7c43ff512858f6a9), UINT64_C(0x0553952a5849ff5f), // 1e-1630
+        UINT64_C(0xf7274feaadf53ae6), UINT64_C(0xdf142c7d6f088d99), UINT64_C(0x23cd574ab47d548b), UINT64_C(0xb33bd20248fc1a56), // 1e-1603
+        UINT64_C(0xc7a628b0bf64f690), UINT64_C(0xf09266bca93ac229), UINT64_C(0x0b54335acf053f47), UINT64_C(0x385459940b9bc503), // 1e-1576
+        UINT64_C(0xa1467525779950bc), UINT64_C(0x392cd41cf4347a42), UINT64_C(0x5623bbbcbab9fefd), UINT64_C(0x6db3ccf4dd1cd774), // 1e-1549
+        UINT64_C(0x8246ef5291ea561c), UINT64_C(0x5d38aa74d2458e95), UINT64_C(0x892b0995bbac2c36), UINT64_C(0x6eab4b60564b40ba), // 1e-1522
+        UINT64_C(0xd279575c593b8fd7), UINT64_C(0x0b98443b3a71892a), UINT64_C(0xc01565402e69645c), UINT64_C(0x46187c5bb3d52b6b), // 1e-1495
+        UINT64_C(0xaa050037370797d7), UINT64_C(0xb47ae2943d28f38b), UINT64_C(0x05fcc205ef3ddf27), UINT64_C(0x60bb12c9f1b98d00), // 1e-1468
+        UINT64_C(0x89573736ee14ae4d), UINT64_C(0x12c005da94a67ff5), UINT64_C(0xe347987eefbd5a8b), UINT64_C(0xb98b6a48e3daeb45), // 1e-1441
+        UINT64_C(0xdde2c6c84679b56d), UINT64_C(0x1500629c19be6ef3), UINT64_C(0x19222fd0f47d532e), UINT64_C(0x881b2f91f68f0d1d), // 1e-1414
+        UINT64_C(0xb33ceadd17b3e963), UINT64_C(0xa8841ea4f77f5c6d), UINT64_C(0xc8e559168c56d51d), UINT64_C(0x7dac8e9194abe734), // 1e-1387
+        UINT64_C(0x90c98a8726ca5b85), UINT64_C(0xa332c62897ba44ed), UINT64_C(0x77fe33643bfc6866), UINT64_C(0x308c428f5da17316), // 1e-1360
+        UINT64_C(0xe9ea9c818f14d669), UINT64_C(0x99c7c550f656da54), UINT64_C(0xa3174265daf49f0e), UINT64_C(0x6059e17f6fd98f7e), // 1e-1333
+        UINT64_C(0xbcf4c9c8eb1a5921), UINT64_C(0x3a5224e1b922e878), UINT64_C(0xa8469a99501675b7), UINT64_C(0x63a186d2c515e3f1), // 1e-1306
+        UINT64_C(0x98a33a25e9b494b6), UINT64_C(0xd38f79ff460453ea), UINT64_C(0xeab50fb21621d700), UINT64_C(0x6052c899e383ff10), // 1e-1279
+        UINT64_C(0xf6996f293c0eb82e), UINT64_C(0x23597123cfc991fb), UINT64_C(0x1df6972050b0adcf), UINT64_C(0x1ab7f17419c9a772), // 1e-1252
+        UINT64_C(0xc7338d0485a78f81), UINT64_C(0x9ad3f8fd59034f5f), UINT64_C(0x9ae886c3a1b5cb79), UINT64_C(0x6466fc6d7747875b), // 1e-1225
+        UINT64_C(0xa0e9e0bf58b8e865), UINT64_C(0x22f23b41de0b3210), UINT64_C(0x606dfb9b2df4e746), UINT64_C(0x3e91c6d38075aacc), // 1e-1198
+        UINT64_C(0x81fc264af2bf565c), UINT64_C(0x19f0fddc015eb9f3), UINT64_C(0x4179741657c2b589), UINT64_C(0x5e68a82370cf4308), // 1e-1171
+        UINT64_C(0xd20084e59f0d87f5), UINT64_C(0xcccfc0a963738eff), UINT64_C(0x7c5372b59db5875c), UINT64_C(0xc373430b354cc166), // 1e-1144
+        UINT64_C(0xa9a366c938a5512f), UINT64_C(0x78eef13f6e95a459), UINT64_C(0xc97061ca58b48090), UINT64_C(0xe8bf89c10bbae5bf), // 1e-1117
+        UINT64_C(0x890860252d38fe33), UINT64_C(0x32adc85727db52ff), UINT64_C(0x067f2f35c7554e5d), UINT64_C(0x348b5cf6e306c9bf), // 1e-1090
+        UINT64_C(0xdd636746710e8f02), UINT64_C(0xf8ac9335e627b8f8), UINT64_C(0xc8723bda24d57298), UINT64_C(0x7c81c42c0e8a58c1), // 1e-1063
+        UINT64_C(0xb2d606baa7c8ea89), UINT64_C(0x2eb30a609088263e), UINT64_C(0x58c728940f715bb6), UINT64_C(0xec662d05faca7eff), // 1e-1036
+        UINT64_C(0x90766d22ffee6702), UINT64_C(0xf71d6515e9de5944), UINT64_C(0xf8fb277c055696c5), UINT64_C(0x9281ac348e8172bf), // 1e-1009
+        UINT64_C(0xe9645506ceeddb4b), UINT64_C(0xcd31e81906ecdc98), UINT64_C(0xb40604207cfdf235), UINT64_C(0xfb8e868c142ace91), // 1e-982
+        UINT64_C(0xbc88517e5f421a2b), UINT64_C(0x27c0dbeccd75c5ab), UINT64_C(0x72e52cdac4d366e0), UINT64_C(0x0503b950466a82cc), // 1e-955
+        UINT64_C(0x984b9b19e1f045dd), UINT64_C(0x402596199721b820), UINT64_C(0x4bc70aefb308d9aa), UINT64_C(0x7ed7db93bf1b3a6a), // 1e-928
+        UINT64_C(0xf60bdfd9a371747a), UINT64_C(0x20fc81b4879b8bbd), UINT64_C(0x7c43c47e9886e383), UINT64_C(0x5b16081b66e4aa5e), // 1e-901
+        UINT64_C(0xc6c13322ab95b49f), UINT64_C(0xc58758b7d66ea3d5), UINT64_C(0x61a15f9d60c3077e), UINT64_C(0x0b298f36c289c3a5), // 1e-874
+        UINT64_C(0xa08d817e6318b7e5), UINT64_C(0x58fd102c7c3f409b), UINT64_C(0x155c8e25660bc713), UINT64_C(0x93e3b57af7509d97), // 1e-847
+        UINT64_C(0x81b188317cf5c6d9), UINT64_C(0x98dc052405b4298c), UINT64_C(0xb227fa2d83228dac), UINT64_C(0x6ac325dcf0521728), // 1e-820
+        UINT64_C(0xd187f7ca753169ec), UINT64_C(0x2b1f77da6f8c0942), UINT64_C(0x5758232b3e30b6b3), UINT64_C(0x70da84edb9ccb4dc), // 1e-793
+        UINT64_C(0xa94205620ec95e5b), UINT64_C(0xdf005355bebda248), UINT64_C(0xbc2c05711737efa8), UINT64_C(0x854a1a49c54c6425), // 1e-766
+        UINT64_C(0x88b9b65578207b41), UINT64_C(0xd64e8811be4362eb), UINT64_C(0xe31c7b768305ee99), UINT64_C(0x1cd70b71060e98eb), // 1e-739
+        UINT64_C(0xdce450e2dfee1664), UINT64_C(0x8cc9f4e5f06e51ff), UINT64_C(0xeb4f73380d74e5dc), UINT64_C(0x645f79b2a9340cca), // 1e-712
+        UINT64_C(0xb26f5da8b6b57c3c), UINT64_C(0x8d1044ccce623b7d), UINT64_C(0xb6e82246cecf503c), UINT64_C(0xc35309779585ef0a), // 1e-685
+        UINT64_C(0x90237f75163fec72), UINT64_C(0xea869f5035ce6bd8), UINT64_C(0x5e18227476dd8d27), UINT64_C(0xa5543b60d284e1e9), // 1e-658
+        UINT64_C(0xe8de5aa1399d936e), UINT64_C(0xaa07eb4b59458e63), UINT64_C(0x083f2e9bb17b6f99), UINT64_C(0x7cd45f19285c7e99), // 1e-631
+        UINT64_C(0xbc1c177826c6725c), UINT64_C(0x8ab0d993bb75625e), UINT64_C(0x44629202484772c8), UINT64_C(0xc8f92282fc9245df), // 1e-604
+        UINT64_C(0x97f42e5a5840756b), UINT64_C(0xa0d0c0303ce40108), UINT64_C(0xc690741996dea298), UINT64_C(0x3500d543d5e7c28e), // 1e-577
+        UINT64_C(0xf57ea1cd234e48cd), UINT64_C(0x9d378c0cb53dea26), UINT64_C(0x5f5a1a6a7d4009c8), UINT64_C(0x393ab503b95f583c), // 1e-550
+        UINT64_C(0xc64f1ae56cdbab48), UINT64_C(0x149d049bec2a1cea), UINT64_C(0x3d825d3a0723748f), UINT64_C(0x68b1df7a3cd56e4e), // 1e-523
+        UINT64_C(0xa031574414b59218), UINT64_C(0xb5d191c89ea338e4), UINT64_C(0xfb3cc46ca8d60690), UINT64_C(0x4188394cd563be79), // 1e-496
+        UINT64_C(0x816714ed8bacf15a), UINT64_C(0x4bb64866f22e6ec9), UINT64_C(0xa0b0e1d947665b46), UINT64_C(0x292d213b72c4176e), // 1e-469
+        UINT64_C(0xd10fafe30b1c842e), UINT64_C(0xa02fc3073d003b3d), UINT64_C(0xdec674c7aa74b421), UINT64_C(0xf7bce4d640f80a47), // 1e-442
+        UINT64_C(0xa8e0dbe18ffb82cf), UINT64_C(0xa0e25c08b5c189d6), UINT64_C(0x8dbf63ea468c724f), UINT64_C(0x55ea8ffd792576d2), // 1e-415
+        UINT64_C(0x886b39add3d98638), UINT64_C(0x24bf62b68c0069b9), UINT64_C(0x44adce397f5bfb85), UINT64_C(0xcc09a7aa60f8972e), // 1e-388
+        UINT64_C(0xdc65837399ea659c), UINT64_C(0xf10c086169cc2098), UINT64_C(0xb165bd79c751310a), UINT64_C(0x71aa9b4d7c145c5d), // 1e-361
+        UINT64_C(0xb208ef855c969f4f), UINT64_C(0xbdbd2d335e51a935), UINT64_C(0x125e305aa39ec108), UINT64_C(0xeadc16801df141f5), // 1e-334
+        UINT64_C(0x8fd0c16206306bab), UINT64_C(0xa5d3b6d479f8e056), UINT64_C(0x8ca6a79794740162), UINT64_C(0xf786c221a807425e), // 1e-307
+        UINT64_C(0xe858ad248f5c22c9), UINT64_C(0xd1b3400f8f9cff68), UINT64_C(0xf910f9f648232f14), UINT64_C(0x6a40608fe10de7e7), // 1e-280
+        UINT64_C(0xbbb01b9283253ca2), UINT64_C(0x9eb1aaedfb016f16), UINT64_C(0x6e70b9b9889a7f57), UINT64_C(0xcf613f823e7d3c34), // 1e-253
+        UINT64_C(0x979cf3ca6cec5b5a), UINT64_C(0xa705992ceecf9c42), UINT64_C(0xbc2f26a194dd4e37), UINT64_C(0x6dfd6e29b1f45d3b), // 1e-226
+        UINT64_C(0xf4f1b4d515acb93b), UINT64_C(0xee92fb5515482d44), UINT64_C(0x357aa1a42528181e), UINT64_C(0x51cb94130fc82e78), // 1e-199
+        UINT64_C(0xc5dd44271ad3cdba), UINT64_C(0x40eff1e1853f29fd), UINT64_C(0x84597744a189dcf1), UINT64_C(0x89a163429dca4e17), // 1e-172
+        UINT64_C(0x9fd561f1fd0f9bd3), UINT64_C(0xfeb6ea8bedefa633), UINT64_C(0xd655d349b644b8da), UINT64_C(0xbb81385bf1617c1e), // 1e-145
+        UINT64_C(0x811ccc668829b887), UINT64_C(0x0806357d5a3f525f), UINT64_C(0xbc62cbb696057bb4), UINT64_C(0x01d27c0a54c5186f), // 1e-118
+        UINT64_C(0xd097ad07a71f26b2), UINT64_C(0x7e2000a41346a7a7), UINT64_C(0xa4ca04661a16c57f), UINT64_C(0xa48c17d1bcf9d09b), // 1e-91
+        UINT64_C(0xa87fea27a539e9a5), UINT64_C(0x3f2398d747b36224), UINT64_C(0x2a1fee40d90aab31), UINT64_C(0x0e128b5d938cfb3f), // 1e-64
+        UINT64_C(0x881cea14545c7575), UINT64_C(0x7e50d64177da2e54), UINT64_C(0xbbfe6e04db164412), UINT64_C(0x40a4a418449a0bbc), // 1e-37
+        UINT64_C(0xdbe6fecebdedd5be), UINT64_C(0xb573440e5a884d1b), UINT64_C(0x2fbf06fcce912adc), UINT64_C(0xb8d8422ea03cd10a), // 1e-10
+        UINT64_C(0xb1a2bc2ec5000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), // 1e17
+        UINT64_C(0x8f7e32ce7bea5c6f), UINT64_C(0xe4820023a2000000), UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), // 1e44
+        UINT64_C(0xe7d34c64a9c85d44), UINT64_C(0x60dbbca87196b616), UINT64_C(0x18a4bd2168000000), UINT64_C(0x0000000000000000), // 1e71
+        UINT64_C(0xbb445da9ca61281f), UINT64_C(0x2a8a6e45ae8edc97), UINT64_C(0x9c2ea52a04fc967d), UINT64_C(0x8fb4cea990000000), // 1e98
+        UINT64_C(0x9745eb4d50ce6332), UINT64_C(0xf840b7ba963646e0), UINT64_C(0x43cbba5ba0cdaf55), UINT64_C(0x09ffc3e5a10722b6), // 1e125
+        UINT64_C(0xf46518c2ef5b8cd1), UINT64_C(0x7eb258665fc25d69), UINT64_C(0x6c57abeaec94e5af), UINT64_C(0x8f195ffdee2e8e1f), // 1e152
+        UINT64_C(0xc56baec21c7a1916), UINT64_C(0x088aaa1845b8fdd0), UINT64_C(0xd838d493160047e3), UINT64_C(0xb42427a9cb0932d5), // 1e179
+        UINT64_C(0x9f79a169bd203e41), UINT64_C(0x0f0062c6e984d386), UINT64_C(0xbc6e825806b72777), UINT64_C(0xd367e211bd1ee5f3), // 1e206
+        UINT64_C(0x80d2ae83e9ce78f3), UINT64_C(0xc1d72b7c6b426019), UINT64_C(0x482ca8432dc76fc5), UINT64_C(0x6929467c2ba394e0), // 1e233
+        UINT64_C(0xd01fef10a657842c), UINT64_C(0x2d2b7569b0432d85), UINT64_C(0x05ff7caf730b919d), UINT64_C(0xc9f98b4225c36c11), // 1e260
+        UINT64_C(0xa81f301449ee8c70), UINT64_C(0x5c68f256bfff5a74), UINT64_C(0xb4e870990780e79b), UINT64_C(0x918639872807b19a), // 1e287
+        UINT64_C(0x87cec76f1c830548), UINT64_C(0x8f2293910d0b15b5), UINT64_C(0x975dd6cbd4dccd82), UINT64_C(0x8703ddb100e4e859), // 1e314
+        UINT64_C(0xdb68c2ca82ed2a05), UINT64_C(0xa67398db9f6820e1), UINT64_C(0x5750d25a71e7f1c5), UINT64_C(0x5d961fc86f24a66f), // 1e341
+        UINT64_C(0xb13cc3832ef0c9ab), UINT64_C(0x8246fac210f8ffb4), UINT64_C(0xc5b6d4ea231a22a5), UINT64_C(0x77b55c8f56958ddd), // 1e368
+        UINT64_C(0x8f2bd39f334827e8), UINT64_C(0xc5874cc0ec691b9f), UINT64_C(0xe56c781930229735), UINT64_C(0xda7ed3c3cf668a58), // 1e395
+        UINT64_C(0xe74e38357bd931da), UINT64_C(0x89d823f6f183aace), UINT64_C(0xe8e452653cd01f0e), UINT64_C(0x7fcc366790ea7208), // 1e422
+        UINT64_C(0xbad8dd9a66f5f0c8), UINT64_C(0x91e543aa47023945), UINT64_C(0x0b164e53d0b35a03), UINT64_C(0xbf90106cb1d4358c), // 1e449
+        UINT64_C(0x96ef14c6454aa840), UINT64_C(0x4cf76e8df8d89498), UINT64_C(0x45df5607e39c3bbc), UINT64_C(0xdec35376c35edcfe), // 1e476
+        UINT64_C(0xf3d8cd683fe16e54), UINT64_C(0x64fba9447ae230a6), UINT64_C(0xa6df70017dcbd19e), UINT64_C(0xf98579b2012fdc2e), // 1e503
+        UINT64_C(0xc4fa5a90ee5fc27d), UINT64_C(0x0b3a07bb3369ec69), UINT64_C(0xcdaeef4543fe4504), UINT64_C(0x7c4375597a93a439), // 1e530
+        UINT64_C(0x9f1e158d07501f00), UINT64_C(0x67c327b40165db14), UINT64_C(0xf19c1743c60fdfa4), UINT64_C(0x81f4f542e01197e7), // 1e557
+        UINT64_C(0x8088bb2d3612eed0), UINT64_C(0xb404b1aac3b0b1ac), UINT64_C(0x294c110e9db61219), UINT64_C(0x2658425c7bc895cf), // 1e584
+        UINT64_C(0xcfa875d67ca49ad5), UINT64_C(0x7f8cb2e0f3944055), UINT64_C(0xee80a5da1de0ace8), UINT64_C(0x640c6865a2eba623), // 1e611
+        UINT64_C(0xa7bead878be4a024), UINT64_C(0x982ef1559d5cfd95), UINT64_C(0xfe38e7e10baaa1d1), UINT64_C(0x5d34b530c9579d9b), // 1e638
+        UINT64_C(0x8780d1a45dffcd28), UINT64_C(0x8468f120a84864d6), UINT64_C(0xb2cacb833e04d952), UINT64_C(0x4b22bcc9ff17d562), // 1e665
+        UINT64_C(0xdaeacf3d37d9c2e9), UINT64_C(0x39b6094ba67834d0), UINT64_C(0x6fb7ab263a38eb99), UINT64_C(0x4079902811db3a67), // 1e692
+        UINT64_C(0xb0d70560ecc880f0), UINT64_C(0xfda84abbcac8f32b), UINT64_C(0x1ee7c7c81e9c99eb), UINT64_C(0xb597fd80537f3202), // 1e719
+        UINT64_C(0x8ed9a3b8f7cb274d), UINT64_C(0xf59d6cc93b593ba2), UINT64_C(0x53c4f6b4d8d9e898), UINT64_C(0x29487e45dbc01cf4), // 1e746
+        UINT64_C(0xe6c9706b11cf1e22), UINT64_C(0x052307759e8221f2), UINT64_C(0x21972c959320442e), UINT64_C(0xbcbf95e44257f2af), // 1e773
+        UINT64_C(0xba6d9b40d7cc9ecc), UINT64_C(0xdf143bbe46291876), UINT64_C(0xd9f922f5d6b023a3), UINT64_C(0xb7bc579e9a5a1a51), // 1e800
+        UINT64_C(0x969870189c45773a), UINT64_C(0xd38fc935c5b03e69), UINT64_C(0x3b50103a8f89d6e3), UINT64_C(0xc4432db1c330fdec), // 1e827
+        UINT64_C(0xf34cd296b16d95d8), UINT64_C(0x0666243fa37a7224), UINT64_C(0xfcca5bfbeef3e83b), UINT64_C(0x09982a3080481cb0), // 1e854
+        UINT64_C(0xc489476e229ed355), UINT64_C(0x7989eeb43b87fe98), UINT64_C(0x33326c6bf342fe4d), UINT64_C(0x0ee55ae0abd3937c), // 1e881
+        UINT64_C(0x9ec2be3d9f6d1e0c), UINT64_C(0xd3e0a7a1ea113aa9), UINT64_C(0xa253adff2725af36), UINT64_C(0x237a4e8683097247), // 1e908
+        UINT64_C(0x803ef24a007c2042), UINT64_C(0x49002ced7ba39f75), UINT64_C(0xbf95e559d208addb), UINT64_C(0x2373ab0ccffd7c9d), // 1e935
+        UINT64_C(0xcf314131b49924b7), UINT64_C(0xc8cf2273139d62e3), UINT64_C(0xe57a37b9a5d8fc0f), UINT64_C(0x0719abff4e100f44), // 1e962
+        UINT64_C(0xa75e62618b3e080e), UINT64_C(0x6a7d641fdd0d57ff), UINT64_C(0x539db0cf0c133d48), UINT64_C(0x80b821295ed3fb7c), // 1e989
+        UINT64_C(0x8733089a5955b9d5), UINT64_C(0x9221285f3b009255), UINT64_C(0xb9e320a2db7a4bd6), UINT64_C(0x26b61c12ad62a853), // 1e1016
+        UINT64_C(0xda6d23fd4393d91b), UINT64_C(0x0ca211f8f5c4287e), UINT64_C(0x62cffdaf0a5a9271), UINT64_C(0xdfc0b324cb257560), // 1e1043
+        UINT64_C(0xb07181a6643be435), UINT64_C(0x9450f9e7ef8d5c99), UINT64_C(0xb85fd56ff351b054), UINT64_C(0x0cafc375e2ab8ffa), // 1e1070
+        UINT64_C(0x8e87a300a492a7b9), UINT64_C(0x3a1533e3719de6e6), UINT64_C(0x3bd32eaa99cb1aad), UINT64_C(0xecec7f7208466888), // 1e1097
+        UINT64_C(0xe644f4d99125aa28), UINT64_C(0x89bcea6c7f20dd35), UINT64_C(0x169de30352c2b7ee), UINT64_C(0xb7cd8cd1bee13086), // 1e1124
+        UINT64_C(0xba029679b02fccb3), UINT64_C(0xe347123eb4e9c6e8), UINT64_C(0xd82305924eb14b9c), UINT64_C(0x3dfa1599f1d0bbf5), // 1e1151
+        UINT64_C(0x9641fd27b819d563), UINT64_C(0xb4b3e36003417364), UINT64_C(0xf2ba2e131e84bfc8), UINT64_C(0xdf90d619bb06652d), // 1e1178
+        UINT64_C(0xf2c1282008c87b1e), UINT64_C(0xa9a722490271812a), UINT64_C(0x69f6619238c125aa), UINT64_C(0xcfcc4e4122234f50), // 1e1205
+        UINT64_C(0xc418753460cdcca9), UINT64_C(0x7ea30dbd7ea479e3), UINT64_C(0x6eac3085943ccc0f), UINT64_C(0xdd093192ef5508d0), // 1e1232
+        UINT64_C(0x9e679b5d5aa0595d), UINT64_C(0xd2345c3ee031426a), UINT64_C(0x68afbe2458dd5f5a), UINT64_C(0xab88eb1d2195648a), // 1e1259
+        UINT64_C(0xffeaa783d52898ba), UINT64_C(0x3109584912d308b6), UINT64_C(0x3a1117c916e57dc6), UINT64_C(0x643d5ec9dfc596bb), // 1e1286
+        UINT64_C(0xceba50faef6e8f75), UINT64_C(0x6839b135b9fd8f5f), UINT64_C(0xa29bb23b7937fa1b), UINT64_C(0xda6c9e9f9c25ca90), // 1e1313
+        UINT64_C(0xa6fe4e827a68ceda), UINT64_C(0x847adde36b83ed55), UINT64_C(0xf8d7b6b400c559f4), UINT64_C(0x67c6a3fcb95fae61), // 1e1340
+        UINT64_C(0x86e56c375dcf8c5d), UINT64_C(0xf8982043c5f7976a), UINT64_C(0x29d3ddb2d3ff50e4), UINT64_C(0xc7707fe919e124d4), // 1e1367
+        UINT64_C(0xd9efc0e124dcc06c), UINT64_C(0xe8797316fe5abb69), UINT64_C(0xa5501251c93bd304), UINT64_C(0x68c6b2b2c50e8d43), // 1e1394
+        UINT64_C(0xb00c38320e49d28d), UINT64_C(0x467220892a2de083), UINT64_C(0x24dfc7c15085d233), UINT64_C(0x5708b37b2fc099d1), // 1e1421
+        UINT64_C(0x8e35d15b2452f322), UINT64_C(0x648280a4312280e9), UINT64_C(0x102d2e09e1d966ed), UINT64_C(0xb3ddea5adcb2ced4), // 1e1448
+        UINT64_C(0xe5c0c5553884eca7), UINT64_C(0x8226ae89353a2e51), UINT64_C(0x091b9b5922310652), UINT64_C(0x748c39fb4b972fb2), // 1e1475
+        UINT64_C(0xb997cf2197bff43c), UINT64_C(0x8dc36a2313fdd3ce), UINT64_C(0xe43272f436e1b60d), UINT64_C(0x0341b2de46b74a13), // 1e1502
+        UINT64_C(0x95ebbbd70b900d11), UINT64_C(0x982184100472b9d7), UINT64_C(0x8a99ea38affecb74), UINT64_C(0x1104cc1bb69f0326), // 1e1529
+        UINT64_C(0xf235cdd6254490c3), UINT64_C(0xf1dca6bbf183bacf), UINT64_C(0x8e9e7849ab916449), UINT64_C(0x313ed8509219e096), // 1e1556
+        UINT64_C(0xc3a7e3be65f3519f), UINT64_C(0x4fda0b57de29b863), UINT64_C(0x3b378afe877adfe3), UINT64_C(0x9f85600fa8c3b3a0), // 1e1583
+        UINT64_C(0x9e0cacce1f643645), UINT64_C(0x79999d3a10ef2ec8), UINT64_C(0x3f7d6cf87d0e976c), UINT64_C(0x9f51883469a6cf88), // 1e1610
+        UINT64_C(0xff57bef947c5bd86), UINT64_C(0xa0698f4370bc8713), UINT64_C(0xefbabd8152424185), UINT64_C(0xc266f3254960aa76), // 1e1637
+        UINT64_C(0xce43a50ae4f7fb8e), UINT64_C(0x7877892520ee1715), UINT64_C(0x5b1545b7a4a86071), UINT64_C(0x562ca41d21f9f2ce), // 1e1664
+        UINT64_C(0xa69e71ca9e14a5a8), UINT64_C(0x3bcda1ca654faa6b), UINT64_C(0x548a15347815675c), UINT64_C(0x7289e115e50428ba), // 1e1691
+        UINT64_C(0x8697fc61c9775e04), UINT64_C(0xbac531ed37220143), UINT64_C(0x2b662d5045250ff5), UINT64_C(0x820373a3110409c2), // 1e1718
+        UINT64_C(0xd972a5bf72493299), UINT64_C(0xc26d3a2bf51e2455), UINT64_C(0x4dbfb8c7bf6adb9c), UINT64_C(0xe134c3caf61dfa95), // 1e1745
+        UINT64_C(0xafa728e277303902), UINT64_C(0x53577ce73150ed15), UINT64_C(0x405f3cdd58932fc6), UINT64_C(0x9140793cf7bbe0c3), // 1e1772
+        UINT64_C(0x8de42ead714c5e80), UINT64_C(0xb946dd72d21a411c), UINT64_C(0xcb74d00c308a5edc), UINT64_C(0x1faf605843a638a1), // 1e1799
+        UINT64_C(0xe53ce1b25fb31788), UINT64_C(0x355fde18e8448607), UINT64_C(0x731f0b7d820918bd), UINT64_C(0x351eec49f72bc62e), // 1e1826
+        UINT64_C(0xb92d45154a67c1f1), UINT64_C(0x9cea6223c82c6d62), UINT64_C(0x2613f8de7a581324), UINT64_C(0xb95258edae0a5794), // 1e1853
+        UINT64_C(0x9595ac0a19d43faa), UINT64_C(0x0ae2a34be99c8749), UINT64_C(0xaf7473f780f667a5), UINT64_C(0x85e24ecd480ac955), // 1e1880
+        UINT64_C(0xf1aac38b00af082b), UINT64_C(0x34bb923c4cbe7e5c), UINT64_C(0x3832e49648c6b733), UINT64_C(0x48ea8c2db8e431a5), // 1e1907
+        UINT64_C(0xc33792e70479d905), UINT64_C(0xcf187da5e7a0db7f), UINT64_C(0x32b41a256cd3f2f6), UINT64_C(0x28063518fcbc4ff6), // 1e1934
+        UINT64_C(0x9db1f271e57a7086), UINT64_C(0x8c62bfc72f4cab1c), UINT64_C(0xbd331507c0d2eb4a), UINT64_C(0xb125fb6dd6f76127), // 1e1961
+        UINT64_C(0xfec52ac3d3c8cfc1), UINT64_C(0xbd4c24b2c0457430), UINT64_C(0x83c6ba228651e703), UINT64_C(0x81cdeae93a226db2), // 1e1988
+        UINT64_C(0xcdcd3d3a6395431c), UINT64_C(0x591c490fafdf73af), UINT64_C(0x91ff3a8ddbeb1c17), UINT64_C(0xe505d479338fe79d), // 1e2015
+        UINT64_C(0xa63ecc1a4d286923), UINT64_C(0x88b67d00a64f20ba), UINT64_C(0x8ea547dc228cc08a), UINT64_C(0xe659155c0c5cb4d5), // 1e2042
+        UINT64_C(0x864ab900090e2907), UINT64_C(0x381710d14507e218), UINT64_C(0x8551dff765ce4829), UINT64_C(0x2399eaab6486896a), // 1e2069
+        UINT64_C(0xd8f5d26eda33a1ed), UINT64_C(0x30adbb561ac082ed), UINT64_C(0x1ec5ea96e9b2cc89), UINT64_C(0xb945453d92bebfad), // 1e2096
+        UINT64_C(0xaf4253963e610637), UINT64_C(0xde6d3887132604ee), UINT64_C(0xeeda61f46a2c45c3), UINT64_C(0x39fb5e4da16f648f), // 1e2123
+        UINT64_C(0x8d92badc95425d0e), UINT64_C(0xd4b36f9a42106d9c), UINT64_C(0xef68b3fea4a96393), UINT64_C(0x6f24e9f6f0387530), // 1e2150
+        UINT64_C(0xe4b949c577860cb3), UINT64_C(0x9e135fc17876ae84), UINT64_C(0x408965b59dbc94e5), UINT64_C(0xc5a23103fa038ccd), // 1e2177
+        UINT64_C(0xb8c2f83198506f71), UINT64_C(0xce0e32af3d064ff3), UINT64_C(0xc65e680e7dd915fe), UINT64_C(0xd34568562cf74a02), // 1e2204
+        UINT64_C(0x953fcda4766cfd04), UINT64_C(0xa9a635eb25ea4911), UINT64_C(0x42cf03cfaaec9a2e), UINT64_C(0x39ae2496e6112820), // 1e2231
+        UINT64_C(0xf1200910af409e2c), UINT64_C(0xa42cab49e86cc37d), UINT64_C(0x089abd31b2277a44), UINT64_C(0xac782cc6d84ddfc8), // 1e2258
+        UINT64_C(0xc2c78289242365f1), UINT64_C(0xaf9eb0a61316c138), UINT64_C(0x75c3d21566f2cc47), UINT64_C(0x70b6204c5521e84f), // 1e2285
+        UINT64_C(0x9d576c2ab5e22f1f), UINT64_C(0x72be5bae797e96bd), UINT64_C(0xba30c277c2c66b15), UINT64_C(0x98eb18301e287f59), // 1e2312
+        UINT64_C(0xfe32eab310053387), UINT64_C(0x73c87a427943dc4e), UINT64_C(0xa9bd526998e54fca), UINT64_C(0x988eb6047cdb901e), // 1e2339
+        UINT64_C(0xcd571962502607ff), UINT64_C(0xc91845ef8a9cb003), UINT64_C(0xfed6e0dee68b7e85), UINT64_C(0x2e91ab500dcdf6ab), // 1e2366
+        UINT64_C(0xa5df5d51f0b7aca3), UINT64_C(0x20cfdf2b96fa883b), UINT64_C(0x7814960bedd29b30), UINT64_C(0x6d7798b3e386a11d), // 1e2393
+        UINT64_C(0x85fda1f89803563e), UINT64_C(0xddeccfc584c791d6), UINT64_C(0xe2928915f8698fa4), UINT64_C(0x70e1e41e1a732cc8), // 1e2420
+        UINT64_C(0xd87946c622ae93c4), UINT64_C(0xd0107abc3f99157f), UINT64_C(0x4f509493259368ae), UINT64_C(0x109810dd4af1a084), // 1e2447
+        UINT64_C(0xaeddb82c16772464), UINT64_C(0x3214129fdaa531b7), UINT64_C(0x902dd227b9a44ab4), UINT64_C(0xa77b2eae0e79f8d6), // 1e2474
+        UINT64_C(0x8d4175cda97298ae), UINT64_C(0x1c2d0d065c8af261), UINT64_C(0xee88ae028ff65536), UINT64_C(0x2561f5ef9c52d230), // 1e2501
+        UINT64_C(0xe435fd6309d4fb29), UINT64_C(0x2cda83ae165bf80e), UINT64_C(0xde442da4f65a1f9f), UINT64_C(0xd5ae1b791c98df7e), // 1e2528
+        UINT64_C(0xb858e85365d62467), UINT64_C(0xb3511a96bec03c53), UINT64_C(0xcc83b1e48401cf12), UINT64_C(0xdaa1581870d5b72c), // 1e2555
+        UINT64_C(0x94ea2089c531e034), UINT64_C(0xf3ba490004c33efb), UINT64_C(0x179712718f5a8b99), UINT64_C(0x967831edd33fa6d6), // 1e2582
+        UINT64_C(0xf0959e395f8e707c), UINT64_C(0x462712be5eb9e09e), UINT64_C(0x1e14b5916709667c), UINT64_C(0xe3904ce14e2c5e5e), // 1e2609
+        UINT64_C(0xc257b27fc1fd4767), UINT64_C(0x0ef28acd11dda912), UINT64_C(0x9568776c447fcddd), UINT64_C(0x068b70454722c70e), // 1e2636
+        UINT64_C(0x9cfd19daaace1ec6), UINT64_C(0xd56a0d18c92b7ce0), UINT64_C(0xf7eba496d173789b), UINT64_C(0x047bfef9110481f1), // 1e2663
+        UINT64_C(0xfda0fe96af18931b), UINT64_C(0x37f79b926f8b78d3), UINT64_C(0xa3cfd5d8dd20c6d4), UINT64_C(0x2c0554e532c87cfb), // 1e2690
+        UINT64_C(0xcce1395ba5fcc97d), UINT64_C(0x4ba70f9f7a6f1a1e), UINT64_C(0x393778f16649c8e5), UINT64_C(0x1d370b268966a011), // 1e2717
+        UINT64_C(0xa580255203f84b47), UINT64_C(0x3a5828869701a165), UINT64_C(0xa0eaf3f62dc1777c), UINT64_C(0xe1f8b43b08b5d0ef), // 1e2744
+        UINT64_C(0x85b0b732006c4f9c), UINT64_C(0x268fdf8f517bf539), UINT64_C(0x6894855ea80137f9), UINT64_C(0xa3fe180570355390), // 1e2771
+        UINT64_C(0xd7fd029c297702e7), UINT64_C(0x187eda2a22fb395a), UINT64_C(0x09a27f73d55de62f), UINT64_C(0xa998d07ed39927b9), // 1e2798
+        UINT64_C(0xae795682c52b799e), UINT64_C(0xfc3b637c7d1ed5e9), UINT64_C(0x0197262d25363a45), UINT64_C(0xe147f9d3a0f36f7d), // 1e2825
+        UINT64_C(0x8cf05f65d68c0f66), UINT64_C(0xca6e7bcc9e46ba7c), UINT64_C(0x1f557f3c40418eb8), UINT64_C(0x6b191a526c00da0b), // 1e2852
+        UINT64_C(0xe3b2fc5fb96a0457), UINT64_C(0xb53a2b982e0f6760), UINT64_C(0x6e9b3f9f0dd359a2), UINT64_C(0xd775834b1847aa9b), // 1e2879
+        UINT64_C(0xb7ef1557ab7c5e2d), UINT64_C(0x58fc2ebe7cebc9a0), UINT64_C(0x28387b692e76710c), UINT64_C(0xfcbbefb1ef2da876), // 1e2906
+        UINT64_C(0x9494a49dba4231b7), UINT64_C(0xacf11d6be847cc94), UINT64_C(0xd6a9a01625eca232), UINT64_C(0x6f52f02bb60d672d), // 1e2933
+        UINT64_C(0xf00b82d75a7adbc5), UINT64_C(0xb8787d891ab45d5a), UINT64_C(0xa66af5def99ba79b), UINT64_C(0xb5e77e9f6cf3a479), // 1e2960
+        UINT64_C(0xc1e822a5f053df0b), UINT64_C(0x7623d5a5e6f04d44), UINT64_C(0x03aa9d962e9667b4), UINT64_C(0x689b5e24c1044642), // 1e2987
+        UINT64_C(0x9ca2fb63ef9a9216), UINT64_C(0x93f373d3194bd7a2), UINT64_C(0x1c23fe4f8f906fc5), UINT64_C(0x30243a463c20987f), // 1e3014
+        UINT64_C(0xfd0f663e7f5aeaf9), UINT64_C(0x23425b28bbe9371e), UINT64_C(0x3f477bd36e1cdc1b), UINT64_C(0xecc0c92667e8e2d4), // 1e3041
+        UINT64_C(0xcc6b9cff76d20143), UINT64_C(0x93b6b89183a7cd26), UINT64_C(0x0acace34da7bcf3d), UINT64_C(0x6dd5b6fdef61be1c), // 1e3068
+        UINT64_C(0xa52123fb1437ff15), UINT64_C(0x85e9a883d027b193), UINT64_C(0x03e4fdc389e22c2d), UINT64_C(0xb0991635c4532d5e), // 1e3095
+        UINT64_C(0x8563f892dafc1778), UINT64_C(0x1d1ddb29e0b5cd44), UINT64_C(0xb9a348a0e321cfbc), UINT64_C(0x89153ba1db34b353), // 1e3122
+        UINT64_C(0xd78105c7e3e6c9ab), UINT64_C(0x20f6b528ce836d91), UINT64_C(0x0881783a8b133ce1), UINT64_C(0xf5b28034c2ae6cde), // 1e3149
+        UINT64_C(0xae152e792349ee7f), UINT64_C(0xe2cf7498cb3ae42a), UINT64_C(0xed8526767ba690fc), UINT64_C(0x61145a39dfa79dce), // 1e3176
+        UINT64_C(0x8c9f778a54a63601), UINT64_C(0xa7b51094e052446e), UINT64_C(0x143b221c55afefd1), UINT64_C(0x49b24b84b8ac790e), // 1e3203
+        UINT64_C(0xe330469041f3e9b3), UINT64_C(0xc7b80ecfc49147d9), UINT64_C(0x1778f1942858c766), UINT64_C(0x7544486b5d053b1c), // 1e3230
+        UINT64_C(0xb7857f1b75e25e17), UINT64_C(0xe5f0ab9af906f807), UINT64_C(0xad31b7b6dcf433e5), UINT64_C(0x1e0c9e9dc037e5ac), // 1e3257
+        UINT64_C(0x943f59c419fb8f00), UINT64_C(0xb682951fc2bfa35c), UINT64_C(0x0b5f2626222587e3), UINT64_C(0xff8995b293f0a6f9), // 1e3284
+        UINT64_C(0xef81b6bd03266277), UINT64_C(0xc10ba8997903a0b4), UINT64_C(0x78ff0f92a3b5cf89), UINT64_C(0x504ea5c6d7837d15), // 1e3311
+        UINT64_C(0xc178d2d6d6a66edc), UINT64_C(0x39e0cfa68676dcc4), UINT64_C(0xe4d7425afcb19da9), UINT64_C(0xa23328e430bd183f), // 1e3338
+        UINT64_C(0x9c4910a8c0c3a761), UINT64_C(0xd3a885f6336374b0), UINT64_C(0x57c832cca0f090e5), UINT64_C(0xb60acdd0621533c1), // 1e3365
+        UINT64_C(0xfc7e217a6ace9f0f), UINT64_C(0x7119aa2c0c5ee694), UINT64_C(0x192df5f08f7399f1), UINT64_C(0x4b12afaa89fdde70), // 1e3392
+        UINT64_C(0xcbf64426eab747d7), UINT64_C(0xb4393d3ddbb63ef2), UINT64_C(0x4b09f05073187d82), UINT64_C(0x16f8bbf3e72bf133), // 1e3419
+        UINT64_C(0xa4c2592dc0d1fe0e), UINT64_C(0xee7d28284240c246), UINT64_C(0xf52419c08af2d58b), UINT64_C(0xb8920bc9f05e8d47), // 1e3446
+        UINT64_C(0x85176601cefae4b9), UINT64_C(0x9f6a021d765fca1a), UINT64_C(0x2dce225c96f349d7), UINT64_C(0xf8c965561e4d20a8), // 1e3473
+        UINT64_C(0xd70550205ee713ec), UINT64_C(0xd67aeffbfcacc7b9), UINT64_C(0x1581d1cb0bebe3cc), UINT64_C(0x7bdc63772d0e2581), // 1e3500
+        UINT64_C(0xadb13fee1ca67b09), UINT64_C(0xd0207e41af7a1795), UINT64_C(0x4933bbd3490d2b54), UINT64_C(0xff733d72a54cf7a8), // 1e3527
+        UINT64_C(0x8c4ebe206b381fb8), UINT64_C(0x80531ad2cf4ac1a3), UINT64_C(0x35476ab32799b5e7), UINT64_C(0xb7eefe91056dfb51), // 1e3554
+        UINT64_C(0xe2addbc977f7c286), UINT64_C(0xbe1eca4c8d1f3e8e), UINT64_C(0xe257f3dbc7c12acd), UINT64_C(0xe6b4e3d14f7856b6), // 1e3581
+        UINT64_C(0xb71c257be5b79e67), UINT64_C(0x65092dfb9e89b4f0), UINT64_C(0xaa0c5751a5f96cbd), UINT64_C(0x5b563f7172a47d65), // 1e3608
+        UINT64_C(0x93ea3fe0b8f09766), UINT64_C(0x48c1deee9c4a6902), UINT64_C(0x370f00abbaeb58b2), UINT64_C(0x32b4375afb65a92a), // 1e3635
+        UINT64_C(0xeef839bcd6e09c3a), UINT64_C(0xae1bf0f3271a769f), UINT64_C(0x1fa9d444fe07779f), UINT64_C(0x9122577923e01b52), // 1e3662
+        UINT64_C(0xc109c2edb19aede5), UINT64_C(0x3227369929740ff7), UINT64_C(0xce10ac286e95590b), UINT64_C(0x8bf015772b001a82), // 1e3689
+        UINT64_C(0x9bef598b6bdb7432), UINT64_C(0xe6378d5497c61c2d), UINT64_C(0xaea8d278225d7766), UINT64_C(0xe492b7c2488a30df), // 1e3716
+        UINT64_C(0xfbed301a7710991b), UINT64_C(0x1950fe7127df2c37), UINT64_C(0x3195dcdf11d6ddf8), UINT64_C(0x659e2a922ca5786f), // 1e3743
+        UINT64_C(0xcb812eab400a8062), UINT64_C(0xd642dd37d587cf52), UINT64_C(0x59c573b027c3969b), UINT64_C(0xe03f8f4a584dfde9), // 1e3770
+        UINT64_C(0xa463c4cabb249d3b), UINT64_C(0xb18d1901b754e375), UINT64_C(0x63a62f1933292833), UINT64_C(0x7069e7f3fb1801ca), // 1e3797
+        UINT64_C(0x84caff65923dc3cb), UINT64_C(0x9876629e2b8c406a), UINT64_C(0x6ea58fc376fd3380), UINT64_C(0x464bfd6d997a2a77), // 1e3824
+        UINT64_C(0xd689e17cbee2d8c9), UINT64_C(0x2be55caa39a3e6a6), UINT64_C(0x8751ec9c692d4d91), UINT64_C(0x54cf3dfb9bf07967), // 1e3851
+        UINT64_C(0xad4d8ac0b01239df), UINT64_C(0x597b3e09a526ccd7), UINT64_C(0x735cc79714c14956), UINT64_C(0xe5f11cec00015eb2), // 1e3878
+        UINT64_C(0x8bfe330d710faafa), UINT64_C(0x6dd1d01180b2deb4), UINT64_C(0x142ef064e3cead4c), UINT64_C(0xbbbbf6a893259a1c), // 1e3905
+        UINT64_C(0xe22bbbe048c2b9f1), UINT64_C(0xc1be8bc9345928a1), UINT64_C(0xc88a1100702467df), UINT64_C(0xb554729cb8021f5c), // 1e3932
+        UINT64_C(0xb6b308562fb04dd6), UINT64_C(0xe771bc4844ae1177), UINT64_C(0x7d58aa5adf0f6707), UINT64_C(0xdf181fc9895b6baf), // 1e3959
+        UINT64_C(0x939556d77bdf9e66), UINT64_C(0x7944e444f1092562), UINT64_C(0x372f896aaa161f6f), UINT64_C(0x1eb1e54fa9eb96be), // 1e3986
+        UINT64_C(0xee6f0ba96d192e0c), UINT64_C(0x8ca1c95829f0fbf6), UINT64_C(0x85ce5928612d3eff), UINT64_C(0x7c06290b52318de2), // 1e4013
+        UINT64_C(0xc09af2c5d2f1e3f3), UINT64_C(0xc4adef984fca0bea), UINT64_C(0xb70ff460ed2a8978), UINT64_C(0xa81e73a80b123f25), // 1e4040
+        UINT64_C(0x9b95d5ee4f80366d), UINT64_C(0xc8dd55687a68bb70), UINT64_C(0x3666af1cb2f0356b), UINT64_C(0x555464b4f76b344b), // 1e4067
+        UINT64_C(0xfb5c91eec5487022), UINT64_C(0x49572570005f17c5), UINT64_C(0xa09732cfb3973647), UINT64_C(0x81beadce6e02c570), // 1e4094
+        UINT64_C(0xcb0c5c65cb690bdd), UINT64_C(0x384846024d78b972), UINT64_C(0x34fec0895756000e), UINT64_C(0xf7d4c9a5b364b345), // 1e4121
+        UINT64_C(0xa40566b2c686f9aa), UINT64_C(0x63279d34e31319c3), UINT64_C(0x1fcacfd93a8ca649), UINT64_C(0x56d6acc0f4613f44), // 1e4148
+        UINT64_C(0x847ec4a4e91e3c61), UINT64_C(0x6fbbec3af2869ffa), UINT64_C(0x8cd6a2ca83e629aa), UINT64_C(0x796f19a49867941f), // 1e4175
+        UINT64_C(0xd60eb9b43fb95c1d), UINT64_C(0xcb1d3d6f831a106b), UINT64_C(0x51a6a7d21393a927), UINT64_C(0x78ddc142ce171934), // 1e4202
+        UINT64_C(0xacea0ecfef5081bc), UINT64_C(0xa43f8a28ef6774f6), UINT64_C(0x9b10fc0239935107), UINT64_C(0xd50d9f50250cdfd7), // 1e4229
+        UINT64_C(0x8badd636cc48b341), UINT64_C(0x0879b2e5f6ee8b1c), UINT64_C(0xac376f28b45e5acc), UINT64_C(0x5e2075ba289a360b), // 1e4256
+        UINT64_C(0xe1a9e6a9ba5bd520), UINT64_C(0x162db6da3b6be60b), UINT64_C(0xb30b39e77bc25e9b), UINT64_C(0x2fef98a04fe8ebca), // 1e4283
+        UINT64_C(0xb64a27879c79d1c9), UINT64_C(0x322dcaa7586a36ad), UINT64_C(0xb84712f76d3d8e63), UINT64_C(0x6aeb526455d97ae3), // 1e4310
+        UINT64_C(0x93409e8c57a96343), UINT64_C(0xfadf8e2328e42a81), UINT64_C(0xd533b18295269a39), UINT64_C(0x0d0c7da3b9246b50), // 1e4337
+        UINT64_C(0xede62c557750cafe), UINT64_C(0x3e1ef1b82c1675b4), UINT64_C(0x28bb0233c670f4f4), UINT64_C(0xf0ba2242187d1132), // 1e4364
+        UINT64_C(0xc02c623aa17a4c42), UINT64_C(0x3f7213691771e1b5), UINT64_C(0x3605d290cec91119), UINT64_C(0x7b16cee6a79d8c47), // 1e4391
+        UINT64_C(0x9b3c85b3db528b13), UINT64_C(0xfedd2b53c559b585), UINT64_C(0xa20f2962e4e6cb69), UINT64_C(0xcd497a9237e38b9e), // 1e4418
+        UINT64_C(0xfacc46c792189907), UINT64_C(0x808cb24436cad539), UINT64_C(0x394fcff52a56e17a), UINT64_C(0x88898677a75b8094), // 1e4445
+        UINT64_C(0xca97cd2ff7a30392), UINT64_C(0x3c3e17ac3f323525), UINT64_C(0x7192ad9bfe0702d7), UINT64_C(0xb57d4ffd30f712da), // 1e4472
+        UINT64_C(0xa3a73ec6b83ea75e), UINT64_C(0x73b4975fb8f66d1b), UINT64_C(0x5da34fd104d9e574), UINT64_C(0x27c596c9bba5ab6d), // 1e4499
+        UINT64_C(0x8432b5a6a671fc06), UINT64_C(0xeb0ef134ece68a23), UINT64_C(0x529479860b01c926), UINT64_C(0xdae7fe819788dbee), // 1e4526
+        UINT64_C(0xd593d89e34b0b7c7), UINT64_C(0xd2c6168b00379cf1), UINT64_C(0x1d59a8c5b8338427), UINT64_C(0x9d3429d79fcd9230), // 1e4553
+        UINT64_C(0xac86cbfaff0c0533), UINT64_C(0x2fd3859535d87f8e), UINT64_C(0x3bbc4d1339da7c9f), UINT64_C(0xf610d7dece189759), // 1e4580
+        UINT64_C(0x8b5da781f24447f3), UINT64_C(0x98c4c7015c805f49), UINT64_C(0xe1cfdcf944c75881), UINT64_C(0xed7914b94ffffadf), // 1e4607
+        UINT64_C(0xe1285bfaeb75c1a3), UINT64_C(0xf5c0e4be4ecbe788), UINT64_C(0x41506544427a3c84), UINT64_C(0x395e23d50e8db208), // 1e4634
+        UINT64_C(0xb5e182ed88af4f0e), UINT64_C(0x2b326435703ac3b0), UINT64_C(0x1aff0a61b27bdd6d), UINT64_C(0x057b14fdff766372), // 1e4661
+        UINT64_C(0x92ec16e35147cdf7), UINT64_C(0x069884f8d1a19173), UINT64_C(0x0191b10b9b45793d), UINT64_C(0x2b237748e85878b6), // 1e4688
+        UINT64_C(0xed5d9b93c10a3d8c), UINT64_C(0x79cadb9f5c03a4a4), UINT64_C(0x8d2591c0387a7883), UINT64_C(0xd0b39afcb0d72964), // 1e4715
+        UINT64_C(0xbfbe112799057f17), UINT64_C(0x831f74c02d901eb2), UINT64_C(0xd80939dd38954f17), UINT64_C(0x425a15d507d16e77), // 1e4742
+        UINT64_C(0x9ae368be8febaaa6), UINT64_C(0x8bda5b7a0eabc7ef), UINT64_C(0x042e15490765a2d5), UINT64_C(0x06d39a17c9bf7d03), // 1e4769
+        UINT64_C(0xfa3c4e75358ea030), UINT64_C(0x16f849f10aee029a), UINT64_C(0xa1a39dee6e88dea6), UINT64_C(0xb572c5e132717b7c), // 1e4796
+        UINT64_C(0xca2380e345ae7af9), UINT64_C(0x4cc88dbe23aabb68), UINT64_C(0xd988b4293fa0d640), UINT64_C(0x33e84dd0ab058b31), // 1e4823
+        UINT64_C(0xa3494ce77775662a), UINT64_C(0xcf2aca8e1f49b13a), UINT64_C(0xe0640fff007a7513), UINT64_C(0x393114fd1a6fb284), // 1e4850
+        UINT64_C(0x83e6d251ab828578), UINT64_C(0xc28300a9f6eeb16d), UINT64_C(0x11a0b5b2a315d2ab), UINT64_C(0x8841c361aeb20165), // 1e4877
+        UINT64_C(0xd5193e1208686c9d), UINT64_C(0x2e097318c960d548), UINT64_C(0x78ef7810b38ca24f), UINT64_C(0x02fd645429952e0f), // 1e4904
+        UINT64_C(0xac23c22116cbf8a3), UINT64_C(0xece327eceafb90de), UINT64_C(0x359890e7df0917d7), UINT64_C(0x8da8ccf4cbf19ac9)  // 1e4931
+    };
+};
+
+template <class unused>
+constexpr int extended_powers_template<unused>::smallest_power_of_ten;
+
+template <class unused>
+constexpr int extended_powers_template<unused>::largest_power_of_ten;
+
+template <class unused>
+constexpr int extended_powers_template<unused>::step;
+
+template <class unused>
+constexpr int extended_powers_template<unused>::number_of_entries;
+
+template <class unused>
+constexpr std::uint64_t extended_powers_template<unused>::power_of_five[step];
+
+template <class unused>
+constexpr std::uint64_t extended_powers_template<unused>::power_of_ten_256[number_of_entries * 4];
+
+using extended_powers = extended_powers_template<>;
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_EXTENDED_POWER_TABLE_HPP
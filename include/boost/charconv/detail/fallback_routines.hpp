@@ -9,13 +9,23 @@
 #include <boost/charconv/detail/dragonbox/floff.hpp>
 #include <boost/charconv/detail/config.hpp>
 #include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/slow_path_counters.hpp>
+#include <boost/charconv/detail/from_chars_slow_path.hpp>
 #include <boost/charconv/chars_format.hpp>
 #include <system_error>
 #include <type_traits>
+#include <cstring>
+#include <cstdint>
+
+// Conversions through the C library, used for long double formats that are not IEEE 754 and as a reference by the tests.
+// They are not available with BOOST_CHARCONV_FREESTANDING
+#ifndef BOOST_CHARCONV_FREESTANDING
+
 #include <locale>
 #include <clocale>
-#include <cstring>
+#include <cstdlib>
 #include <cstdio>
+#include <cerrno>
 
 namespace boost {
 namespace charconv {
@@ -37,6 +47,9 @@ inline int print_val(char* first, std::size_t size, char* format, T value) noexc
 template <typename T>
 to_chars_result to_chars_printf_impl(char* first, char* last, T value, chars_format fmt, int precision)
 {
+    BOOST_CHARCONV_COUNT_SLOW_PATH(to_chars_printf);
+    BOOST_CHARCONV_SAMPLE_SLOW_PATH_VALUE(to_chars_printf, slow_path_sample_digits<T>(), value);
+
     // v % + . + num_digits(INT_MAX) + specifier + null terminator
     // 1 + 1 + 10 + 1 + 1
     char format[14] {};
@@ -95,6 +108,7 @@ to_chars_result to_chars_printf_impl(char* first, char* last, T value, chars_for
             break;
 
         case boost::charconv::chars_format::scientific:
+        case boost::charconv::chars_format::engineering:
             format[pos] = 'e';
             break;
 
@@ -150,16 +164,122 @@ inline void convert_string_locale(char* buffer) noexcept
     }
 }
 
+// Writes the decimal number at the start of [first, last) to buffer as [sign]0.<digits>e<exponent>.
+// At most max_digits significant digits are kept, and a single trailing 1 records that a non-zero digit was dropped,
+// which rounds the same way as the full number (see slow_path_traits::max_decimal_digits).
+// The buffer must hold max_digits + 32 characters.
+//
+// Returns one past the last character written and sets number_last to one past the end of the number,
+// or returns nullptr if [first, last) does not start with a decimal number.
+inline char* compact_decimal_string(const char* first, const char* last, char* buffer, int max_digits, const char*& number_last) noexcept
+{
+    const char* p = first;
+    char* out = buffer;
+
+    if (p != last && (*p == '-' || *p == '+'))
+    {
+        *out++ = *p++;
+    }
+
+    *out++ = '0';
+    *out++ = '.';
+
+    // The value is 0.<digits> * 10^exponent
+    std::int64_t exponent = 0;
+    int digits = 0;
+    bool any_digit = false;
+    bool dot = false;
+    bool dropped = false;
+
+    for (; p != last; ++p)
+    {
+        if (*p == '.' && !dot)
+        {
+            dot = true;
+            continue;
+        }
+        if (*p < '0' || *p > '9')
+        {
+            break;
+        }
+
+        any_digit = true;
+        if (digits == 0 && *p == '0')
+        {
+            exponent -= static_cast<std::int64_t>(dot);
+            continue;
+        }
+
+        exponent += static_cast<std::int64_t>(!dot);
+        if (digits < max_digits)
+        {
+            *out++ = *p;
+            ++digits;
+        }
+        else if (*p != '0')
+        {
+            dropped = true;
+        }
+    }
+
+    // Also rejects the hexadecimal prefix, inf and nan
+    if (!any_digit || (p != last && (*p == 'x' || *p == 'X')))
+    {
+        return nullptr;
+    }
+
+    if (dropped)
+    {
+        *out++ = '1';
+    }
+    else if (digits == 0)
+    {
+        *out++ = '0';
+    }
+
+    if (p != last && (*p == 'e' || *p == 'E'))
+    {
+        const char* q = p + 1;
+        bool negative_exponent = false;
+        if (q != last && (*q == '-' || *q == '+'))
+        {
+            negative_exponent = *q == '-';
+            ++q;
+        }
+
+        if (q != last && *q >= '0' && *q <= '9')
+        {
+            // Saturates far beyond the range of every type
+            std::int64_t written_exponent = 0;
+            for (; q != last && *q >= '0' && *q <= '9'; ++q)
+            {
+                if (written_exponent < 1000000000)
+                {
+                    written_exponent = written_exponent * 10 + (*q - '0');
+                }
+            }
+
+            exponent += negative_exponent ? -written_exponent : written_exponent;
+            p = q;
+        }
+    }
+
+    *out++ = 'e';
+    out = boost::charconv::detail::to_chars_int(out, out + 24, exponent).ptr;
+    *out = '\0';
+
+    number_last = p;
+    return out;
+}
+
 template <typename T>
-from_chars_result from_chars_strtod_impl(const char* first, const char* last, T& value, char* buffer) noexcept
+from_chars_result from_chars_strtod_buffer(const char* first, const char* last, T& value, char* buffer, const char* buffer_last) noexcept
 {
     // For strto(f/d)
     // Floating point value corresponding to the contents of str on success.
     // If the converted value falls out of range of corresponding return type, range error occurs and HUGE_VAL, HUGE_VALF or HUGE_VALL is returned.
     // If no conversion can be performed, 0 is returned and *str_end is set to str.
 
-    std::memcpy(buffer, first, static_cast<std::size_t>(last - first));
-    buffer[last - first] = '\0';
     convert_string_locale(buffer);
 
     char* str_end;
@@ -226,12 +346,21 @@ from_chars_result from_chars_strtod_impl(const char* first, const char* last, T&
     if (r)
     {
         value = return_value;
-        r = {first + (str_end - buffer), std::errc()};
+        r = {str_end == buffer_last ? last : first + (str_end - buffer), std::errc()};
     }
 
     return r;
 }
 
+template <typename T>
+from_chars_result from_chars_strtod_impl(const char* first, const char* last, T& value, char* buffer) noexcept
+{
+    std::memcpy(buffer, first, static_cast<std::size_t>(last - first));
+    buffer[last - first] = '\0';
+
+    return from_chars_strtod_buffer(first, last, value, buffer, buffer + (last - first));
+}
+
 template <typename T>
 inline from_chars_result from_chars_strtod(const char* first, const char* last, T& value) noexcept
 {
@@ -241,19 +370,18 @@ inline from_chars_result from_chars_strtod(const char* first, const char* last,
         return from_chars_strtod_impl(first, last, value, buffer);
     }
 
-    // If the string to be parsed does not fit into the 1024 byte static buffer than we have to allocate a buffer.
-    // malloc is used here because it does not throw on allocation failure.
-
-    char* buffer = static_cast<char*>(std::malloc(static_cast<std::size_t>(last - first + 1)));
-    if (buffer == nullptr)
+    // Longer strings are copied with only as many significant digits as can change the rounding,
+    // so that nothing is allocated however long the input is
+    constexpr int max_digits = slow_path_traits<T>::max_decimal_digits;
+    char buffer[static_cast<std::size_t>(max_digits) + 32];
+    const char* number_last = nullptr;
+    const char* buffer_last = compact_decimal_string(first, last, buffer, max_digits, number_last);
+    if (buffer_last == nullptr)
     {
-        return {first, std::errc::not_enough_memory};
+        return {first, std::errc::result_out_of_range};
     }
 
-    auto r = from_chars_strtod_impl(first, last, value, buffer);
-    std::free(buffer);
-
-    return r;
+    return from_chars_strtod_buffer(first, number_last, value, buffer, buffer_last);
 }
 
 #ifdef BOOST_MSVC
@@ -268,4 +396,6 @@ inline from_chars_result from_chars_strtod(const char* first, const char* last,
 } //namespace charconv
 } //namespace boost
 
+#endif // BOOST_CHARCONV_FREESTANDING
+
 #endif //BOOST_FALLBACK_ROUTINES_HPP
@@ -82,13 +82,10 @@ uint32_t parse_eight_digits_unrolled(uint64_t val) {
   return uint32_t(val);
 }
 
+// Wider characters are never read eight at a time
+template <typename UC>
 BOOST_FORCEINLINE constexpr
-uint32_t parse_eight_digits_unrolled(const char16_t *)  noexcept  {
-  return 0;
-}
-
-BOOST_FORCEINLINE constexpr
-uint32_t parse_eight_digits_unrolled(const char32_t *)  noexcept  {
+uint32_t parse_eight_digits_unrolled(UC const *)  noexcept  {
   return 0;
 }
 
@@ -102,13 +99,9 @@ BOOST_FORCEINLINE constexpr bool is_made_of_eight_digits_fast(uint64_t val)  noe
   return !((((val + 0x4646464646464646) | (val - 0x3030303030303030)) & 0x8080808080808080));
 }
 
+template <typename UC>
 BOOST_FORCEINLINE constexpr
-bool is_made_of_eight_digits_fast(const char16_t *)  noexcept  {
-  return false;
-}
-
-BOOST_FORCEINLINE constexpr
-bool is_made_of_eight_digits_fast(const char32_t *)  noexcept  {
+bool is_made_of_eight_digits_fast(UC const *)  noexcept  {
   return false;
 }
 
@@ -128,6 +121,8 @@ struct parsed_number_string_t {
   // contains the range of the significant digits
   span<const UC> integer{};  // non-nullable
   span<const UC> fraction{}; // nullable
+  // the group separator when integer contains one, and 0 otherwise
+  UC group_separator{0};
 };
 using byte_span = span<char>;
 using parsed_number_string = parsed_number_string_t<char>;
@@ -138,13 +133,14 @@ BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
 parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, parse_options_t<UC> options) noexcept {
   chars_format const fmt = options.format;
   UC const decimal_point = options.decimal_point;
+  bool const json = options.json;
 
   parsed_number_string_t<UC> answer;
   answer.valid = false;
   answer.too_many_digits = false;
   answer.negative = (*p == UC('-'));
 #ifdef BOOST_CHARCONV_FASTFLOAT_ALLOWS_LEADING_PLUS // disabled by default
-  if ((*p == UC('-')) || (*p == UC('+')))
+  if ((*p == UC('-')) || (!json && *p == UC('+'))) // JSON forbids the leading '+' in any case
 #else
   if (*p == UC('-')) // C++17 20.19.3.(7.1) explicitly forbids '+' sign here
 #endif
@@ -168,9 +164,30 @@ parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, par
         uint64_t(*p - UC('0')); // might overflow, we will handle the overflow later
     ++p;
   }
+  int64_t separator_count = 0;
+  if (options.group_separator != UC(0)) {
+    // a group separator is only part of the number between two digits of the integer part
+    while ((p != pend) && (*p == options.group_separator) && (p != start_digits) && (pend - p > 1) && is_integer(p[1])) {
+      ++p;
+      ++separator_count;
+      while ((p != pend) && is_integer(*p)) {
+        i = 10 * i + uint64_t(*p - UC('0'));
+        ++p;
+      }
+    }
+    if (separator_count != 0) {
+      answer.group_separator = options.group_separator;
+    }
+  }
   UC const * const end_of_integer_part = p;
-  int64_t digit_count = int64_t(end_of_integer_part - start_digits);
-  answer.integer = span<const UC>(start_digits, size_t(digit_count));
+  int64_t digit_count = int64_t(end_of_integer_part - start_digits) - separator_count;
+  answer.integer = span<const UC>(start_digits, size_t(end_of_integer_part - start_digits));
+  if (json) {
+    // JSON needs at least one digit before the point, and no leading zeros
+    if (digit_count == 0 || (*start_digits == UC('0') && digit_count > 1)) {
+      return answer;
+    }
+  }
   int64_t exponent = 0;
   if ((p != pend) && (*p == decimal_point)) {
     ++p;
@@ -191,13 +208,16 @@ parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, par
     exponent = before - p;
     answer.fraction = span<const UC>(before, size_t(p - before));
     digit_count -= exponent;
+    if (json && exponent == 0) { // JSON needs at least one digit after the point
+      return answer;
+    }
   }
   // we must have encountered at least one integer!
   if (digit_count == 0) {
     return answer;
   }
   int64_t exp_number = 0;            // explicit exponential part
-  if ((static_cast<unsigned>(fmt) & static_cast<unsigned>(chars_format::scientific)) && (p != pend) && ((UC('e') == *p) || (UC('E') == *p))) {
+  if ((static_cast<unsigned>(fmt) & static_cast<unsigned>(chars_format::scientific)) && (p != pend) && ((options.exponent == *p) || (options.exponent_other_case == *p))) {
     UC const * location_of_e = p;
     ++p;
     bool neg_exp = false;
@@ -208,7 +228,7 @@ parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, par
       ++p;
     }
     if ((p == pend) || !is_integer(*p)) {
-      if(!(static_cast<unsigned>(fmt) & static_cast<unsigned>(chars_format::fixed))) {
+      if(json || !(static_cast<unsigned>(fmt) & static_cast<unsigned>(chars_format::fixed))) {
         // We are in error.
         return answer;
       }
@@ -247,7 +267,7 @@ parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, par
     // We need to be mindful of the case where we only have zeroes...
     // E.g., 0.000000000...000.
     UC const * start = start_digits;
-    while ((start != pend) && (*start == UC('0') || *start == decimal_point)) {
+    while ((start != pend) && (*start == UC('0') || *start == decimal_point || (separator_count != 0 && *start == answer.group_separator))) {
       if(*start == UC('0')) { digit_count --; }
       start++;
     }
@@ -260,12 +280,20 @@ parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, par
       p = answer.integer.ptr;
       UC const * int_end = p + answer.integer.len();
       constexpr uint64_t minimal_nineteen_digit_integer{1000000000000000000};
+      // the integer span holds digits and the group separator, which is never a digit
       while((i < minimal_nineteen_digit_integer) && (p != int_end)) {
-        i = i * 10 + uint64_t(*p - UC('0'));
+        if (*p != answer.group_separator) {
+          i = i * 10 + uint64_t(*p - UC('0'));
+        }
         ++p;
       }
       if (i >= minimal_nineteen_digit_integer) { // We have a big integers
         exponent = end_of_integer_part - p + exp_number;
+        if (separator_count != 0) {
+          for (UC const * q = p; q != int_end; ++q) {
+            if (*q == answer.group_separator) { --exponent; }
+          }
+        }
       } else { // We have a value with a fractional component.
           p = answer.fraction.ptr;
           UC const * frac_end = p + answer.fraction.len();
@@ -283,6 +311,70 @@ parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, par
   return answer;
 }
 
+// The output of to_chars for a finite value in a decimal format: an optional '-', the digits of the integer part,
+// optionally '.' and the digits of the fraction, and optionally 'e', an optional sign and the digits of the exponent,
+// up to pend. None of it is validated: the characters are taken to be what they have to be where they stand, so any
+// other input gives an unspecified number, but nothing outside of [p, pend) is read.
+// More than 19 significant digits (e.g. fixed output of large or small values) come back as not valid,
+// for the checked scan to parse
+BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+parsed_number_string unchecked_parse_number_string(const char *p, const char *pend) noexcept {
+  parsed_number_string answer;
+  answer.lastmatch = pend;
+  answer.negative = (*p == '-');
+  if (answer.negative) {
+    ++p;
+  }
+
+  const char * const start_digits = p;
+  uint64_t i = 0;
+  while ((p != pend) && is_integer(*p)) {
+    i = 10 * i + uint64_t(*p - '0');
+    ++p;
+  }
+  answer.integer = span<const char>(start_digits, size_t(p - start_digits));
+  int64_t digit_count = int64_t(p - start_digits);
+
+  int64_t exponent = 0;
+  if ((p != pend) && (*p == '.')) {
+    ++p;
+    const char * const before = p;
+    while ((std::distance(p, pend) >= 8) && is_made_of_eight_digits_fast(p)) {
+      i = i * 100000000 + parse_eight_digits_unrolled(p);
+      p += 8;
+    }
+    while ((p != pend) && is_integer(*p)) {
+      i = i * 10 + uint64_t(*p - '0');
+      ++p;
+    }
+    exponent = before - p;
+    answer.fraction = span<const char>(before, size_t(p - before));
+    digit_count -= exponent;
+  }
+
+  if (p != pend) {
+    // The exponent character, then to_chars always writes a sign
+    ++p;
+    const bool neg_exp = (p != pend) && (*p == '-');
+    if ((p != pend) && (*p == '-' || *p == '+')) {
+      ++p;
+    }
+    int64_t exp_number = 0;
+    for (; p != pend; ++p) {
+      if (exp_number < 0x10000000) {
+        exp_number = 10 * exp_number + int64_t(uint8_t(*p - '0'));
+      }
+    }
+    exponent += neg_exp ? -exp_number : exp_number;
+  }
+
+  // Leading zeros of the fixed format count as digits here, the checked scan discounts them
+  answer.valid = digit_count <= 19;
+  answer.exponent = exponent;
+  answer.mantissa = i;
+  return answer;
+}
+
 }}}} // namespace s
 
 #endif
@@ -348,7 +348,7 @@ bool long_mul(stackvec<size>& x, limb_span y) noexcept {
     BOOST_CHARCONV_FASTFLOAT_TRY(small_mul(x, y0));
     for (size_t index = 1; index < y.len(); index++) {
       limb yi = y[index];
-      stackvec<size> zi;
+      stackvec<size> zi {};
       if (yi != 0) {
         // re-use the same buffer throughout
         zi.set_len(0);
@@ -411,17 +411,20 @@ constexpr limb pow5_tables<T>::large_power_of_5[];
 // arithmetic, using simple algorithms since asymptotically
 // faster algorithms are slower for a small number of limbs.
 // all operations assume the big-integer is normalized.
-struct bigint : pow5_tables<> {
+// the capacity defaults to what is needed for double, larger
+// capacities are used by the slow paths of the wider types.
+template <uint16_t size = bigint_limbs>
+struct basic_bigint : pow5_tables<> {
   // storage of the limbs, in little-endian order.
-  stackvec<bigint_limbs> vec;
+  stackvec<size> vec;
 
-  BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20 bigint(): vec() {}
-  bigint(const bigint &) = delete;
-  bigint &operator=(const bigint &) = delete;
-  bigint(bigint &&) = delete;
-  bigint &operator=(bigint &&other) = delete;
+  BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20 basic_bigint(): vec() {}
+  basic_bigint(const basic_bigint &) = delete;
+  basic_bigint &operator=(const basic_bigint &) = delete;
+  basic_bigint(basic_bigint &&) = delete;
+  basic_bigint &operator=(basic_bigint &&other) = delete;
 
-  BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20 bigint(uint64_t value): vec() {
+  BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20 basic_bigint(uint64_t value): vec() {
 #ifdef BOOST_CHARCONV_FASTFLOAT_64BIT_LIMB
     vec.push_unchecked(value);
 #else
@@ -465,7 +468,7 @@ struct bigint : pow5_tables<> {
   // positive, this is larger, otherwise they are equal.
   // the limbs are stored in little-endian order, so we
   // must compare the limbs in ever order.
-  BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20 int compare(const bigint& other) const noexcept {
+  BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20 int compare(const basic_bigint& other) const noexcept {
     if (vec.len() > other.vec.len()) {
       return 1;
     } else if (vec.len() < other.vec.len()) {
@@ -618,6 +621,8 @@ struct bigint : pow5_tables<> {
   }
 };
 
+using bigint = basic_bigint<>;
+
 }}}} // namespace fast_float
 
 #endif
@@ -14,7 +14,6 @@
 #include <cinttypes>
 #include <cmath>
 #include <cstdint>
-#include <cstdlib>
 #include <cstring>
 
 namespace boost { namespace charconv { namespace detail { namespace fast_float {
@@ -26,18 +25,17 @@ namespace boost { namespace charconv { namespace detail { namespace fast_float {
 template <int bit_precision>
 BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
 value128 compute_product_approximation(int64_t q, uint64_t w) {
-  const int index = 2 * int(q - powers::smallest_power_of_five);
   // For small values of q, e.g., q in [0,27], the answer is always exact because
-  // The line value128 firstproduct = full_multiplication(w, power_of_five_128[index]);
+  // The line value128 firstproduct = full_multiplication(w, powers::high(q));
   // gives the exact answer.
-  value128 firstproduct = full_multiplication(w, powers::power_of_five_128[index]);
+  value128 firstproduct = full_multiplication(w, powers::high(q));
   static_assert((bit_precision >= 0) && (bit_precision <= 64), " precision should  be in (0,64]");
   constexpr uint64_t precision_mask = (bit_precision < 64) ?
                (uint64_t(0xFFFFFFFFFFFFFFFF) >> bit_precision)
                : uint64_t(0xFFFFFFFFFFFFFFFF);
   if((firstproduct.high & precision_mask) == precision_mask) { // could further guard with  (lower + w < lower)
     // regarding the second product, we only need secondproduct.high, but our expectation is that the compiler will optimize this extra work away if needed.
-    value128 secondproduct = full_multiplication(w, powers::power_of_five_128[index + 1]);
+    value128 secondproduct = full_multiplication(w, powers::low(q));
     firstproduct.low += secondproduct.high;
     if(secondproduct.high > firstproduct.low) {
       firstproduct.high++;
@@ -96,9 +94,12 @@ adjusted_mantissa compute_error(int64_t q, uint64_t w)  noexcept  {
 // However, in some very rare cases, the computation will fail. In such cases, we
 // return an adjusted_mantissa with a negative power of 2: the caller should recompute
 // in such cases.
+// When order is given, it is set to the sign of w * 10 ** q minus the returned value
+// if the product tells it, and left unchanged otherwise (subnormals, and products too
+// close to the returned value, which include the exact ones).
 template <typename binary>
 BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
-adjusted_mantissa compute_float(int64_t q, uint64_t w)  noexcept  {
+adjusted_mantissa compute_float(int64_t q, uint64_t w, int* order = nullptr)  noexcept  {
   adjusted_mantissa answer;
   if ((w == 0) || (q < binary::smallest_power_of_ten())) {
     answer.power2 = 0;
@@ -176,6 +177,19 @@ adjusted_mantissa compute_float(int64_t q, uint64_t w)  noexcept  {
     }
   }
 
+  if (order != nullptr) {
+    // The product is below w * 10 ** q by less than one unit of product.high, so the bits
+    // dropped from the mantissa tell the side of the rounded value unless they are all ones
+    // when rounding up, or all zeroes when rounding down.
+    const uint64_t dropped_mask = (uint64_t(1) << (upperbit + 64 - binary::mantissa_explicit_bits() - 3)) - 1;
+    const uint64_t dropped = product.high & dropped_mask;
+    if ((answer.mantissa & 1) != 0) {
+      if (dropped != dropped_mask) { *order = -1; }
+    } else if (dropped != 0 || product.low != 0) {
+      *order = 1;
+    }
+  }
+
   answer.mantissa += (answer.mantissa & 1); // round up
   answer.mantissa >>= 1;
   if (answer.mantissa >= (uint64_t(2) << binary::mantissa_explicit_bits())) {
@@ -19,11 +19,19 @@
 namespace boost { namespace charconv { namespace detail { namespace fast_float {
 
 // 1e0 to 1e19
+template <class unused = void>
+struct powers_of_ten_uint64_template {
 constexpr static uint64_t powers_of_ten_uint64[] = {
     1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL,
     1000000000UL, 10000000000UL, 100000000000UL, 1000000000000UL, 10000000000000UL,
     100000000000000UL, 1000000000000000UL, 10000000000000000UL, 100000000000000000UL,
     1000000000000000000UL, 10000000000000000000UL};
+};
+
+template <class unused>
+constexpr uint64_t powers_of_ten_uint64_template<unused>::powers_of_ten_uint64[];
+
+using powers_of_ten_uint64_table = powers_of_ten_uint64_template<>;
 
 // calculate the exponent, in scientific notation, of the number.
 // this algorithm is not even close to optimized, but it has no practical
@@ -201,19 +209,29 @@ bool is_truncated(UC const * first, UC const * last) noexcept {
   }
   return false;
 }
+// the same for digits with a group separator between them
+template <typename UC>
+BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR14
+bool is_truncated(UC const * first, UC const * last, UC group_separator) noexcept {
+  if (group_separator == UC(0)) {
+    return is_truncated(first, last);
+  }
+  for (; first != last; ++first) {
+    if (*first != UC('0') && *first != group_separator) {
+      return true;
+    }
+  }
+  return false;
+}
 template <typename UC>
 BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
 bool is_truncated(span<const UC> s) noexcept {
   return is_truncated(s.ptr, s.ptr + s.len());
 }
 
+template <typename UC>
 BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
-void parse_eight_digits(const char16_t*& , limb& , size_t& , size_t& ) noexcept {
-  // currently unused
-}
-
-BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
-void parse_eight_digits(const char32_t*& , limb& , size_t& , size_t& ) noexcept {
+void parse_eight_digits(UC const *& , limb& , size_t& , size_t& ) noexcept {
   // currently unused
 }
 
@@ -265,23 +283,32 @@ void parse_mantissa(bigint& result, parsed_number_string_t<UC>& num, size_t max_
 #endif
 
   // process all integer digits.
+  // the integer digits can have a group separator between them, which is never a digit
   UC const * p = num.integer.ptr;
   UC const * pend = p + num.integer.len();
+  UC const group_separator = num.group_separator;
   skip_zeros(p, pend);
+  while ((p != pend) && (*p == UC('0') || *p == group_separator)) {
+    ++p;
+  }
   // process all digits, in increments of step per loop
   while (p != pend) {
-    if (std::is_same<UC,char>::value) {
+    if (std::is_same<UC,char>::value && group_separator == UC(0)) {
       while ((std::distance(p, pend) >= 8) && (step - counter >= 8) && (max_digits - digits >= 8)) {
         parse_eight_digits(p, value, counter, digits);
       }
     }
     while (counter < step && p != pend && digits < max_digits) {
+      if (*p == group_separator) {
+        ++p;
+        continue;
+      }
       parse_one_digit(p, value, counter, digits);
     }
     if (digits == max_digits) {
       // add the temporary value, then check if we've truncated any digits
-      add_native(result, limb(powers_of_ten_uint64[counter]), value);
-      bool truncated = is_truncated(p, pend);
+      add_native(result, limb(powers_of_ten_uint64_table::powers_of_ten_uint64[counter]), value);
+      bool truncated = is_truncated(p, pend, group_separator);
       if (num.fraction.ptr != nullptr) {
         truncated |= is_truncated(num.fraction);
       }
@@ -290,7 +317,7 @@ void parse_mantissa(bigint& result, parsed_number_string_t<UC>& num, size_t max_
       }
       return;
     } else {
-      add_native(result, limb(powers_of_ten_uint64[counter]), value);
+      add_native(result, limb(powers_of_ten_uint64_table::powers_of_ten_uint64[counter]), value);
       counter = 0;
       value = 0;
     }
@@ -315,14 +342,14 @@ void parse_mantissa(bigint& result, parsed_number_string_t<UC>& num, size_t max_
       }
       if (digits == max_digits) {
         // add the temporary value, then check if we've truncated any digits
-        add_native(result, limb(powers_of_ten_uint64[counter]), value);
+        add_native(result, limb(powers_of_ten_uint64_table::powers_of_ten_uint64[counter]), value);
         bool truncated = is_truncated(p, pend);
         if (truncated) {
           round_up_bigint(result, digits);
         }
         return;
       } else {
-        add_native(result, limb(powers_of_ten_uint64[counter]), value);
+        add_native(result, limb(powers_of_ten_uint64_table::powers_of_ten_uint64[counter]), value);
         counter = 0;
         value = 0;
       }
@@ -330,7 +357,7 @@ void parse_mantissa(bigint& result, parsed_number_string_t<UC>& num, size_t max_
   }
 
   if (counter != 0) {
-    add_native(result, limb(powers_of_ten_uint64[counter]), value);
+    add_native(result, limb(powers_of_ten_uint64_table::powers_of_ten_uint64[counter]), value);
   }
 }
 
@@ -437,6 +464,37 @@ adjusted_mantissa digit_comp(parsed_number_string_t<UC>& num, adjusted_mantissa
   }
 }
 
+// the sign of the value of the digits minus the positive finite value b, exactly.
+// like in negative_digit_comp, both sides are scaled to integers with the same powers of 5 and 2.
+template <typename T, typename UC>
+inline BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+int compare_digits(parsed_number_string_t<UC>& num, T b) noexcept {
+  int32_t sci_exp = scientific_exponent(num);
+  size_t max_digits = binary_format<T>::max_digits();
+  size_t digits = 0;
+  bigint real_digits;
+  parse_mantissa(real_digits, num, max_digits, digits);
+  int32_t real_exp = sci_exp + 1 - int32_t(digits);
+
+  adjusted_mantissa theor = to_extended(b);
+  bigint theor_digits(theor.mantissa);
+  int32_t theor_exp = theor.power2;
+
+  if (real_exp > 0) {
+    BOOST_CHARCONV_FASTFLOAT_ASSERT(real_digits.pow5(uint32_t(real_exp)));
+  } else if (real_exp < 0) {
+    BOOST_CHARCONV_FASTFLOAT_ASSERT(theor_digits.pow5(uint32_t(-real_exp)));
+  }
+  int32_t pow2_exp = theor_exp - real_exp;
+  if (pow2_exp > 0) {
+    BOOST_CHARCONV_FASTFLOAT_ASSERT(theor_digits.pow2(uint32_t(pow2_exp)));
+  } else if (pow2_exp < 0) {
+    BOOST_CHARCONV_FASTFLOAT_ASSERT(real_digits.pow2(uint32_t(-pow2_exp)));
+  }
+
+  return real_digits.compare(theor_digits);
+}
+
 }}}} // namespace fast_float
 
 #endif
@@ -25,13 +25,28 @@ namespace boost { namespace charconv { namespace detail { namespace fast_float {
 template <typename UC>
 struct parse_options_t {
   constexpr explicit parse_options_t(chars_format fmt = chars_format::general,
-    UC dot = UC('.'))
-    : format(fmt), decimal_point(dot) {}
+    UC dot = UC('.'), bool json_grammar = false, UC exp = UC('e'), UC separator = UC(0),
+    rounding_mode mode = rounding_mode::to_nearest, bool faithful_rounding = false)
+    : format(fmt), decimal_point(dot), json(json_grammar), exponent(exp),
+      exponent_other_case(exp >= UC('a') && exp <= UC('z') ? UC(exp - UC('a') + UC('A')) :
+                          exp >= UC('A') && exp <= UC('Z') ? UC(exp - UC('A') + UC('a')) : exp),
+      group_separator(separator), rounding(mode), faithful(faithful_rounding) {}
 
   /** Which number formats are accepted */
   chars_format format;
   /** The character used as decimal point */
   UC decimal_point;
+  /** Only numbers of the RFC 8259 grammar are accepted: no leading zeros, no infinity or nan, and digits after the point and in the exponent */
+  bool json;
+  /** The character that starts the exponent, accepted in either case when it is a letter */
+  UC exponent;
+  UC exponent_other_case;
+  /** Skipped between two digits of the integer part, unless it is 0 */
+  UC group_separator;
+  /** Direction of rounding of the values that are not exact */
+  rounding_mode rounding;
+  /** Significands of more than 19 digits are rounded from their first 19, within one unit in the last place, instead of exactly */
+  bool faithful;
 };
 using parse_options = parse_options_t<char>;
 
@@ -11,6 +11,7 @@
 #include <boost/charconv/detail/fast_float/ascii_number.hpp>
 #include <boost/charconv/detail/fast_float/decimal_to_binary.hpp>
 #include <boost/charconv/detail/fast_float/digit_comparison.hpp>
+#include <boost/charconv/detail/slow_path_counters.hpp>
 #include <boost/charconv/detail/fast_float/float_common.hpp>
 
 #include <cmath>
@@ -148,41 +149,39 @@ BOOST_FORCEINLINE bool rounds_to_nearest() noexcept {
   #endif
 }
 
-} // namespace detail
+// The sign of w * 10 ** q minus value, the result of Clinger's fast path, whose operands are exact.
+// So is the residual of the multiplication or division, which a fused multiply-add gives.
+inline int clinger_order(uint64_t w, int64_t q, double value) noexcept {
+  const double power = binary_format<double>::exact_power_of_ten(q < 0 ? -q : q);
+  const double residual = q < 0 ? std::fma(-value, power, double(w)) : std::fma(double(w), power, -value);
+  return int(residual > 0) - int(residual < 0);
+}
 
-template<typename T, typename UC>
-BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
-from_chars_result_t<UC> from_chars(UC const * first, UC const * last,
-                             T &value, chars_format fmt /*= chars_format::general*/)  noexcept  {
-  return from_chars_advanced(first, last, value, parse_options_t<UC>{fmt});
+// The operands of float have few enough bits that their products are exact in double
+inline int clinger_order(uint64_t w, int64_t q, float value) noexcept {
+  const double power = double(binary_format<float>::exact_power_of_ten(q < 0 ? -q : q));
+  const double lhs = q < 0 ? double(w) : double(w) * power;
+  const double rhs = q < 0 ? double(value) * power : double(value);
+  return int(lhs > rhs) - int(lhs < rhs);
 }
 
-template<typename T, typename UC>
-BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
-from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
-                                      T &value, parse_options_t<UC> options)  noexcept  {
+// The adjacent value of larger or smaller magnitude on the same side of zero, which the bits are in order of
+template <typename T>
+inline T next_magnitude(T value, bool up) noexcept {
+  typename binary_format<T>::equiv_uint bits;
+  std::memcpy(&bits, &value, sizeof(T));
+  bits = up ? bits + 1 : bits - 1;
+  std::memcpy(&value, &bits, sizeof(T));
+  return value;
+}
 
-  static_assert (std::is_same<T, double>::value || std::is_same<T, float>::value, "only float and double are supported");
-  static_assert (std::is_same<UC, char>::value ||
-                 std::is_same<UC, wchar_t>::value ||
-                 std::is_same<UC, char16_t>::value ||
-                 std::is_same<UC, char32_t>::value , "only char, wchar_t, char16_t and char32_t are supported");
+} // namespace detail
 
+// Rounds a valid parsed number string to T, shared by from_chars_advanced and from_chars_unchecked
+template<typename T, typename UC>
+BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+from_chars_result_t<UC> from_number_string(parsed_number_string_t<UC>& pns, T &value) noexcept {
   from_chars_result_t<UC> answer;
-#ifdef BOOST_CHARCONV_FASTFLOAT_SKIP_WHITE_SPACE  // disabled by default
-  while ((first != last) && fast_float::is_space(uint8_t(*first))) {
-    first++;
-  }
-#endif
-  if (first == last) {
-    answer.ec = std::errc::invalid_argument;
-    answer.ptr = first;
-    return answer;
-  }
-  parsed_number_string_t<UC> pns = parse_number_string<UC>(first, last, options);
-  if (!pns.valid) {
-    return detail::parse_infnan(first, last, value);
-  }
   answer.ec = std::errc(); // be optimistic
   answer.ptr = pns.lastmatch;
   // The implementation of the Clinger's fast path is convoluted because
@@ -233,7 +232,11 @@ from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
   }
   // If we called compute_float<binary_format<T>>(pns.exponent, pns.mantissa) and we have an invalid power (am.power2 < 0),
   // then we need to go the long way around again. This is very uncommon.
-  if(am.power2 < 0) { am = digit_comp<T>(pns, am); }
+  if(am.power2 < 0) {
+    BOOST_CHARCONV_COUNT_SLOW_PATH(from_chars_digit_comparison);
+    BOOST_CHARCONV_SAMPLE_SLOW_PATH_CHARS(from_chars_digit_comparison, binary_format<T>::mantissa_explicit_bits() + 1, pns.integer.ptr, pns.lastmatch);
+    am = digit_comp<T>(pns, am);
+  }
   to_float(pns.negative, am, value);
   // Test for over/underflow.
   if ((pns.mantissa != 0 && am.mantissa == 0 && am.power2 == 0) || am.power2 == binary_format<T>::infinite_power()) {
@@ -242,6 +245,142 @@ from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
   return answer;
 }
 
+// Rounds a valid parsed number string to T within one unit in the last place, without ever comparing the digits
+// as a big integer. Eisel-Lemire rounds every significand of up to 19 digits correctly, so only the digits past
+// the 19th can send from_number_string to digit_comp. Here they are dropped instead: the truncated significand is
+// below the digits by less than one unit of its 19th digit, a relative error under 10^-18, so its correctly rounded
+// value is that of the digits or the one next to it toward zero.
+template<typename T, typename UC>
+BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+from_chars_result_t<UC> from_number_string_faithful(parsed_number_string_t<UC>& pns, T &value) noexcept {
+  pns.too_many_digits = false;
+  return from_number_string(pns, value);
+}
+
+// Rounds a valid parsed number string to T in a directed mode. The value rounded to nearest
+// is moved by one unit in the last place when the digits are on the side of it that the
+// mode rounds away from. In Clinger's range the side is the sign of the exact residual,
+// and otherwise the product of the Eisel-Lemire algorithm tells it unless it is too close
+// to the rounded value, which leaves the comparison of the digits with it as a big integer.
+template<typename T, typename UC>
+inline from_chars_result_t<UC> from_number_string(parsed_number_string_t<UC>& pns, T &value, rounding_mode mode) noexcept {
+  from_chars_result_t<UC> answer;
+  answer.ec = std::errc();
+  answer.ptr = pns.lastmatch;
+
+  T magnitude;
+  int order = 0;
+  if (pns.mantissa == 0) {
+    magnitude = T(0);
+  } else if (binary_format<T>::min_exponent_fast_path() <= pns.exponent && pns.exponent <= binary_format<T>::max_exponent_fast_path() &&
+             !pns.too_many_digits && pns.mantissa <= binary_format<T>::max_mantissa_fast_path() && detail::rounds_to_nearest()) {
+    magnitude = T(pns.mantissa);
+    if (pns.exponent < 0) { magnitude = magnitude / binary_format<T>::exact_power_of_ten(-pns.exponent); }
+    else { magnitude = magnitude * binary_format<T>::exact_power_of_ten(pns.exponent); }
+    order = detail::clinger_order(pns.mantissa, pns.exponent, magnitude);
+  } else {
+    adjusted_mantissa am = compute_float<binary_format<T>>(pns.exponent, pns.mantissa, &order);
+    if (pns.too_many_digits) {
+      // The product is that of the truncated digits
+      order = 0;
+      if (am.power2 >= 0 && am != compute_float<binary_format<T>>(pns.exponent, pns.mantissa + 1)) {
+        am = compute_error<binary_format<T>>(pns.exponent, pns.mantissa);
+      }
+    }
+    if (am.power2 < 0) {
+      BOOST_CHARCONV_COUNT_SLOW_PATH(from_chars_digit_comparison);
+      BOOST_CHARCONV_SAMPLE_SLOW_PATH_CHARS(from_chars_digit_comparison, binary_format<T>::mantissa_explicit_bits() + 1, pns.integer.ptr, pns.lastmatch);
+      am = digit_comp<T>(pns, am);
+    }
+    to_float(false, am, magnitude);
+
+    if (am.power2 == binary_format<T>::infinite_power()) {
+      order = -1;
+    } else if (am.mantissa == 0 && am.power2 == 0) {
+      order = 1;
+    } else if (order == 0) {
+      BOOST_CHARCONV_COUNT_SLOW_PATH(from_chars_digit_comparison);
+      BOOST_CHARCONV_SAMPLE_SLOW_PATH_CHARS(from_chars_digit_comparison, binary_format<T>::mantissa_explicit_bits() + 1, pns.integer.ptr, pns.lastmatch);
+      order = compare_digits<T>(pns, magnitude);
+    }
+  }
+
+  const bool up = boost::charconv::detail::rounds_magnitude_up(mode, pns.negative);
+  if ((order > 0 && up) || (order < 0 && !up)) {
+    magnitude = detail::next_magnitude(magnitude, up);
+  }
+
+  // Out of range when the rounded value is infinite, or zero for digits that are not
+  if (std::isinf(magnitude) || (pns.mantissa != 0 && std::fpclassify(magnitude) == FP_ZERO)) {
+    answer.ec = std::errc::result_out_of_range;
+  }
+  value = pns.negative ? -magnitude : magnitude;
+  return answer;
+}
+
+template<typename T, typename UC>
+BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+from_chars_result_t<UC> from_chars(UC const * first, UC const * last,
+                             T &value, chars_format fmt /*= chars_format::general*/)  noexcept  {
+  return from_chars_advanced(first, last, value, parse_options_t<UC>{fmt});
+}
+
+template<typename T, typename UC>
+BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
+                                      T &value, parse_options_t<UC> options)  noexcept  {
+
+  static_assert (std::is_same<T, double>::value || std::is_same<T, float>::value, "only float and double are supported");
+  static_assert (std::is_same<UC, char>::value ||
+                 std::is_same<UC, wchar_t>::value ||
+                 std::is_same<UC, char16_t>::value ||
+                 std::is_same<UC, char32_t>::value , "only char, wchar_t, char16_t and char32_t are supported");
+
+  from_chars_result_t<UC> answer;
+#ifdef BOOST_CHARCONV_FASTFLOAT_SKIP_WHITE_SPACE  // disabled by default
+  while ((first != last) && fast_float::is_space(uint8_t(*first))) {
+    first++;
+  }
+#endif
+  if (first == last) {
+    answer.ec = std::errc::invalid_argument;
+    answer.ptr = first;
+    return answer;
+  }
+  parsed_number_string_t<UC> pns = parse_number_string<UC>(first, last, options);
+  if (!pns.valid) {
+    if (options.json) { // infinity and nan are not JSON numbers
+      answer.ec = std::errc::invalid_argument;
+      answer.ptr = first;
+      return answer;
+    }
+    return detail::parse_infnan(first, last, value);
+  }
+  if (options.rounding != rounding_mode::to_nearest) {
+    return from_number_string(pns, value, options.rounding);
+  }
+  if (options.faithful) {
+    return from_number_string_faithful(pns, value);
+  }
+  return from_number_string(pns, value);
+}
+
+// The output of to_chars for a finite value, which is parsed without validating it. See unchecked_parse_number_string
+template<typename T>
+BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+from_chars_result_t<char> from_chars_unchecked(const char* first, const char* last, T &value) noexcept {
+  static_assert (std::is_same<T, double>::value || std::is_same<T, float>::value, "only float and double are supported");
+  BOOST_CHARCONV_ASSERT(first < last);
+
+  parsed_number_string pns = unchecked_parse_number_string(first, last);
+  if (!pns.valid) {
+    // More than 19 digits, which the checked scan truncates before rounding
+    pns = parse_number_string<char>(first, last, parse_options_t<char>{chars_format::general});
+    BOOST_CHARCONV_ASSERT(pns.valid && pns.lastmatch == last);
+  }
+  return from_number_string(pns, value);
+}
+
 }}}} // namespace fast_float
 
 #endif
@@ -12,10 +12,10 @@
 #include <boost/charconv/detail/compute_float32.hpp>
 #include <boost/charconv/detail/compute_float64.hpp>
 #include <boost/charconv/detail/bit_layouts.hpp>
-#include <boost/charconv/detail/fallback_routines.hpp>
+#include <boost/charconv/detail/from_chars_slow_path.hpp>
+#include <boost/charconv/detail/from_chars_hex_float.hpp>
 #include <boost/charconv/chars_format.hpp>
 #include <system_error>
-#include <cstdlib>
 #include <cmath>
 
 namespace boost { namespace charconv { namespace detail {
@@ -38,6 +38,11 @@ namespace boost { namespace charconv { namespace detail {
 template <typename T>
 from_chars_result from_chars_float_impl(const char* first, const char* last, T& value, chars_format fmt) noexcept
 {
+    if (fmt == chars_format::hex && !is_non_finite_start(first, last))
+    {
+        return from_chars_hex_float(first, last, value);
+    }
+
     bool sign {};
     std::uint64_t significand {};
     std::int64_t  exponent {};
@@ -119,7 +124,7 @@ from_chars_result from_chars_float_impl(const char* first, const char* last, T&
                 }
                 else
                 {
-                    r = from_chars_strtod(first, r.ptr, value);
+                    r = from_chars_slow_path(first, r.ptr, value, fmt);
                 }
             }
             else BOOST_IF_CONSTEXPR (std::is_same<T, double>::value)
@@ -140,7 +145,7 @@ from_chars_result from_chars_float_impl(const char* first, const char* last, T&
                 }
                 else
                 {
-                    r = from_chars_strtod(first, r.ptr, value);
+                    r = from_chars_slow_path(first, r.ptr, value, fmt);
                 }
             }
             else BOOST_IF_CONSTEXPR (std::is_same<T, long double>::value)
@@ -165,7 +170,7 @@ from_chars_result from_chars_float_impl(const char* first, const char* last, T&
                 }
                 else
                 {
-                    r = from_chars_strtod(first, r.ptr, value);
+                    r = from_chars_slow_path(first, r.ptr, value, fmt);
                 }
             }
         }
@@ -0,0 +1,327 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_FROM_CHARS_HALF_HPP
+#define BOOST_CHARCONV_DETAIL_FROM_CHARS_HALF_HPP
+
+// Direct parsing of the 16-bit binary16 (std::float16_t) and bfloat16 (std::bfloat16_t) formats.
+// Parsing into float and narrowing rounds twice and can be off by one ulp,
+// so the decimal significand is rounded straight to the 16-bit format with Eisel-Lemire,
+// and the rare cases it can not decide go to the exact slow path.
+//
+// The values are stored as their bit patterns so that this also works on compilers without <stdfloat>
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/bit_layouts.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/from_chars_slow_path.hpp>
+#include <boost/charconv/detail/from_chars_hex_float.hpp>
+#include <boost/charconv/detail/fast_float/fast_float.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+
+namespace boost { namespace charconv { namespace detail {
+
+template <>
+struct slow_path_format<binary16_bits>
+{
+    static constexpr int digits = 11;
+    static constexpr int min_exponent = -14;
+    static constexpr int max_exponent = 15;
+};
+
+template <>
+struct slow_path_format<bfloat16_bits>
+{
+    static constexpr int digits = 8;
+    static constexpr int min_exponent = -126;
+    static constexpr int max_exponent = 127;
+};
+
+template <typename T>
+inline void half_assemble(bool negative, std::uint64_t q_lo, std::int32_t biased_exponent, T& value) noexcept
+{
+    constexpr int explicit_bits = slow_path_format<T>::digits - 1;
+    std::uint32_t bits = static_cast<std::uint32_t>(q_lo) & ((UINT32_C(1) << explicit_bits) - 1);
+    bits |= static_cast<std::uint32_t>(biased_exponent) << explicit_bits;
+    bits |= static_cast<std::uint32_t>(negative) << 15;
+    value.bits = static_cast<std::uint16_t>(bits);
+}
+
+inline void slow_path_assemble(bool negative, std::uint64_t, std::uint64_t q_lo, std::int32_t biased_exponent, binary16_bits& value) noexcept
+{
+    half_assemble(negative, q_lo, biased_exponent, value);
+}
+
+inline void slow_path_assemble(bool negative, std::uint64_t, std::uint64_t q_lo, std::int32_t biased_exponent, bfloat16_bits& value) noexcept
+{
+    half_assemble(negative, q_lo, biased_exponent, value);
+}
+
+// Parameters of Eisel-Lemire (see fast_float::binary_format) for the 16-bit formats.
+// Only the powers of ten from smallest_power_of_ten to largest_power_of_ten are ever read from the 128-bit table
+template <typename T>
+struct half_binary_format
+{
+    using format = slow_path_format<T>;
+
+    static constexpr int mantissa_explicit_bits() noexcept { return format::digits - 1; }
+    static constexpr int minimum_exponent() noexcept { return format::min_exponent - 1; }
+    static constexpr int infinite_power() noexcept { return format::max_exponent - format::min_exponent + 2; }
+    static constexpr int smallest_power_of_ten() noexcept { return format::digits == 11 ? -27 : -60; }
+    static constexpr int largest_power_of_ten() noexcept { return format::digits == 11 ? 4 : 38; }
+};
+
+// fast_float::compute_float for the 16-bit formats.
+// The round to even logic of fast_float relies on exact halfway points only occurring for a few powers of ten close to zero.
+// That is not true for binary16 whose subnormals and their halfway points can be written with fewer than 20 digits.
+// Here the product is exact for 0 <= q <= 27, so ties are resolved directly, and for any other power
+// a result whose discarded bits are all zeros or all ones is handed to the slow path by returning an invalid power
+template <typename T>
+fast_float::adjusted_mantissa compute_float_half(std::int64_t q, std::uint64_t w) noexcept
+{
+    using binary = half_binary_format<T>;
+
+    fast_float::adjusted_mantissa answer;
+    if (w == 0 || q < binary::smallest_power_of_ten())
+    {
+        answer.power2 = 0;
+        answer.mantissa = 0;
+        return answer;
+    }
+    if (q > binary::largest_power_of_ten())
+    {
+        answer.power2 = binary::infinite_power();
+        answer.mantissa = 0;
+        return answer;
+    }
+
+    const int lz = fast_float::leading_zeroes(w);
+    w <<= lz;
+
+    const fast_float::value128 product = fast_float::compute_product_approximation<binary::mantissa_explicit_bits() + 3>(q, w);
+    const int upperbit = static_cast<int>(product.high >> 63);
+    int shift = upperbit + 64 - binary::mantissa_explicit_bits() - 3;
+
+    answer.mantissa = product.high >> shift;
+    answer.power2 = static_cast<std::int32_t>(fast_float::detail::power(static_cast<std::int32_t>(q)) + upperbit - lz - binary::minimum_exponent());
+
+    bool subnormal = false;
+    if (answer.power2 <= 0)
+    {
+        const int subnormal_shift = -answer.power2 + 1;
+        if (subnormal_shift + shift >= 64)
+        {
+            answer.power2 = 0;
+            answer.mantissa = 0;
+            return answer;
+        }
+
+        shift += subnormal_shift;
+        answer.mantissa >>= subnormal_shift;
+        subnormal = true;
+    }
+
+    // The lowest bit of mantissa is the round bit and the bits below it have been discarded
+    const std::uint64_t discarded_mask = (UINT64_C(1) << shift) - 1;
+    const std::uint64_t discarded = product.high & discarded_mask;
+    const bool round_bit = (answer.mantissa & 1) != 0;
+
+    if (q >= 0 && q <= 27)
+    {
+        if (round_bit && discarded == 0 && product.low == 0 && (answer.mantissa & 2) == 0)
+        {
+            answer.mantissa &= ~UINT64_C(1);
+        }
+    }
+    else if ((round_bit && discarded == 0) || (!round_bit && discarded == discarded_mask))
+    {
+        answer.power2 = -1;
+        return answer;
+    }
+
+    answer.mantissa += answer.mantissa & 1;
+    answer.mantissa >>= 1;
+
+    if (subnormal)
+    {
+        answer.power2 = answer.mantissa < (UINT64_C(1) << binary::mantissa_explicit_bits()) ? 0 : 1;
+        return answer;
+    }
+
+    if (answer.mantissa >= (UINT64_C(2) << binary::mantissa_explicit_bits()))
+    {
+        answer.mantissa = UINT64_C(1) << binary::mantissa_explicit_bits();
+        ++answer.power2;
+    }
+
+    answer.mantissa &= ~(UINT64_C(1) << binary::mantissa_explicit_bits());
+    if (answer.power2 >= binary::infinite_power())
+    {
+        answer.power2 = binary::infinite_power();
+        answer.mantissa = 0;
+    }
+
+    return answer;
+}
+
+template <typename T>
+inline void half_non_finite(bool negative, bool nan, T& value) noexcept
+{
+    // Quiet NaN sets the top bit of the fraction
+    constexpr int explicit_bits = slow_path_format<T>::digits - 1;
+    const std::uint64_t fraction = nan ? UINT64_C(1) << (explicit_bits - 1) : 0;
+    half_assemble(negative, fraction, half_binary_format<T>::infinite_power(), value);
+}
+
+// Clinger's fast path: a significand and power of ten that are exact doubles give a correctly rounded double quotient.
+// Rounding that double again to 16 bits can only go wrong when it lands exactly on a 16-bit halfway point,
+// because any halfway point between the exact quotient and the double would have been the closer double.
+// Returns false for those ties so that they are decided by Eisel-Lemire instead
+template <typename T>
+inline bool half_from_double(const char* ptr, bool negative, double d, T& value, from_chars_result& r) noexcept
+{
+    using format = slow_path_format<T>;
+    using binary = half_binary_format<T>;
+
+    std::uint64_t bits;
+    std::memcpy(&bits, &d, sizeof(d));
+    const std::uint64_t significand = (bits & ((UINT64_C(1) << 52) - 1)) | (UINT64_C(1) << 52);
+    const int exponent = static_cast<int>(bits >> 52) - 1023;
+
+    if (exponent > format::max_exponent)
+    {
+        half_non_finite(negative, false, value);
+        r = {ptr, std::errc::result_out_of_range};
+        return true;
+    }
+
+    int shift = 53 - format::digits;
+    int biased_exponent = exponent - binary::minimum_exponent();
+    if (exponent < format::min_exponent)
+    {
+        shift += format::min_exponent - exponent;
+        biased_exponent = 0;
+    }
+
+    std::uint64_t mantissa = 0;
+    if (shift <= 53)
+    {
+        const std::uint64_t half_ulp = UINT64_C(1) << (shift - 1);
+        const std::uint64_t remainder = significand & ((half_ulp << 1) - 1);
+        if (remainder == half_ulp)
+        {
+            return false;
+        }
+
+        mantissa = (significand >> shift) + (remainder > half_ulp ? 1 : 0);
+    }
+
+    // Rounding up can carry into the next binade, or from the subnormals into the normals
+    if (biased_exponent == 0)
+    {
+        if (mantissa == 0)
+        {
+            slow_path_zero(negative, value);
+            r = {ptr, std::errc::result_out_of_range};
+            return true;
+        }
+
+        biased_exponent = mantissa >> binary::mantissa_explicit_bits() != 0 ? 1 : 0;
+    }
+    else if (mantissa >> format::digits != 0)
+    {
+        ++biased_exponent;
+        if (biased_exponent >= binary::infinite_power())
+        {
+            half_non_finite(negative, false, value);
+            r = {ptr, std::errc::result_out_of_range};
+            return true;
+        }
+    }
+
+    half_assemble(negative, mantissa, biased_exponent, value);
+    r = {ptr, std::errc()};
+    return true;
+}
+
+template <typename T>
+from_chars_result from_chars_half(const char* first, const char* last, T& value, chars_format fmt) noexcept
+{
+    using binary = half_binary_format<T>;
+
+    if (first >= last)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    const bool non_finite = is_non_finite_start(first, last);
+    if (fmt == chars_format::hex && !non_finite)
+    {
+        return from_chars_hex_float(first, last, value);
+    }
+
+    const auto pns = fast_float::parse_number_string<char>(first, last, fast_float::parse_options_t<char>{fmt});
+    if (!pns.valid)
+    {
+        float f;
+        const auto r = fast_float::detail::parse_infnan(first, last, f);
+        if (r)
+        {
+            half_non_finite(std::signbit(f), std::isnan(f), value);
+        }
+
+        return r;
+    }
+
+    if (pns.mantissa == 0)
+    {
+        slow_path_zero(pns.negative, value);
+        return {pns.lastmatch, std::errc()};
+    }
+
+    using double_format = fast_float::binary_format<double>;
+    if (!pns.too_many_digits && pns.mantissa <= double_format::max_mantissa_fast_path() &&
+        pns.exponent >= double_format::min_exponent_fast_path() && pns.exponent <= double_format::max_exponent_fast_path() &&
+        fast_float::detail::rounds_to_nearest())
+    {
+        double d = static_cast<double>(pns.mantissa);
+        d = pns.exponent < 0 ? d / double_format::exact_power_of_ten(-pns.exponent) : d * double_format::exact_power_of_ten(pns.exponent);
+
+        from_chars_result r;
+        if (half_from_double(pns.lastmatch, pns.negative, d, value, r))
+        {
+            return r;
+        }
+    }
+
+    fast_float::adjusted_mantissa am = compute_float_half<T>(pns.exponent, pns.mantissa);
+
+    // With more than 19 digits the truncated significand must round the same as the next value up
+    if (pns.too_many_digits && am.power2 >= 0 && am != compute_float_half<T>(pns.exponent, pns.mantissa + 1))
+    {
+        am.power2 = -1;
+    }
+
+    if (BOOST_UNLIKELY(am.power2 < 0))
+    {
+        return from_chars_slow_path(first, pns.lastmatch, value, fmt);
+    }
+
+    half_assemble(pns.negative, am.mantissa, am.power2, value);
+
+    if ((pns.mantissa != 0 && am.mantissa == 0 && am.power2 == 0) || am.power2 == binary::infinite_power())
+    {
+        return {pns.lastmatch, std::errc::result_out_of_range};
+    }
+
+    return {pns.lastmatch, std::errc()};
+}
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_FROM_CHARS_HALF_HPP
@@ -0,0 +1,174 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_FROM_CHARS_HEX_FLOAT_HPP
+#define BOOST_CHARCONV_DETAIL_FROM_CHARS_HEX_FLOAT_HPP
+
+// One pass decoder for hexadecimal floating point values (e.g. -1.8p+3 without the 0x prefix).
+// Hex digits map exactly onto the binary significand, so the nibbles are shifted into a 64-bit
+// (or 128-bit for long double and __float128) integer, digits that do not fit only contribute a sticky bit,
+// and the value is rounded once with the binary exponent. No decimal power tables are involved.
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/from_chars_integer_impl.hpp>
+#include <boost/charconv/detail/from_chars_slow_path.hpp>
+#include <system_error>
+#include <cstdint>
+
+namespace boost { namespace charconv { namespace detail {
+
+// Infinity and NaN are spelled the same for every format and are left to the generic parser
+template <typename CharT>
+inline BOOST_CHARCONV_CXX20_CONSTEXPR bool is_non_finite_start(const CharT* first, const CharT* last) noexcept
+{
+    if (first != last && *first == '-')
+    {
+        ++first;
+    }
+
+    return first != last && (*first == 'i' || *first == 'I' || *first == 'n' || *first == 'N');
+}
+
+// Wider characters are read directly, digit_from_char maps everything outside of ASCII to 255
+template <typename T, typename CharT>
+BOOST_CHARCONV_CXX20_CONSTEXPR from_chars_result_t<CharT> from_chars_hex_float(const CharT* first, const CharT* last, T& value, char decimal_point = '.', rounding_mode mode = rounding_mode::to_nearest) noexcept
+{
+    // Enough nibbles for the significand plus a guard and round bit even when the leading nibble is 1
+    constexpr int max_nibbles = slow_path_format<T>::digits + 2 <= 61 ? 16 : 32;
+
+    if (first >= last)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    auto next = first;
+    bool negative = false;
+    if (*next == '-')
+    {
+        negative = true;
+        ++next;
+    }
+
+    std::uint64_t q_hi = 0;
+    std::uint64_t q_lo = 0;
+    int num_nibbles = 0;
+    bool sticky = false;
+    bool has_digits = false;
+    std::int64_t exponent = 0;
+
+    // Integer part with leading zeros skipped
+    for (; next != last; ++next)
+    {
+        const unsigned digit = digit_from_char(*next);
+        if (digit >= 16)
+        {
+            break;
+        }
+
+        has_digits = true;
+        if (num_nibbles < max_nibbles)
+        {
+            if (num_nibbles != 0 || digit != 0)
+            {
+                BOOST_IF_CONSTEXPR (max_nibbles > 16)
+                {
+                    q_hi = (q_hi << 4) | (q_lo >> 60);
+                }
+                q_lo = (q_lo << 4) | digit;
+                ++num_nibbles;
+            }
+        }
+        else
+        {
+            exponent += 4;
+            sticky = sticky || digit != 0;
+        }
+    }
+
+    // Fractional part
+    if (next != last && *next == static_cast<CharT>(decimal_point))
+    {
+        const auto dot = next;
+        for (++next; next != last; ++next)
+        {
+            const unsigned digit = digit_from_char(*next);
+            if (digit >= 16)
+            {
+                break;
+            }
+
+            has_digits = true;
+            if (num_nibbles < max_nibbles)
+            {
+                if (num_nibbles != 0 || digit != 0)
+                {
+                    BOOST_IF_CONSTEXPR (max_nibbles > 16)
+                    {
+                        q_hi = (q_hi << 4) | (q_lo >> 60);
+                    }
+                    q_lo = (q_lo << 4) | digit;
+                    ++num_nibbles;
+                }
+                exponent -= 4;
+            }
+            else
+            {
+                sticky = sticky || digit != 0;
+            }
+        }
+
+        // A lone dot is not a number
+        if (!has_digits)
+        {
+            next = dot;
+        }
+    }
+
+    if (!has_digits)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    // The exponent is optional, and is only consumed if it has at least one digit.
+    // It saturates far outside of the range of every type so the rounding below reports the overflow or underflow
+    if (next != last && (*next == 'p' || *next == 'P'))
+    {
+        auto exp_next = next + 1;
+        bool negative_exponent = false;
+        if (exp_next != last && (*exp_next == '-' || *exp_next == '+'))
+        {
+            negative_exponent = *exp_next == '-';
+            ++exp_next;
+        }
+
+        if (exp_next != last && *exp_next >= '0' && *exp_next <= '9')
+        {
+            std::int64_t explicit_exponent = 0;
+            for (; exp_next != last && *exp_next >= '0' && *exp_next <= '9'; ++exp_next)
+            {
+                if (explicit_exponent < 100000000)
+                {
+                    explicit_exponent = explicit_exponent * 10 + static_cast<std::int64_t>(*exp_next - '0');
+                }
+            }
+
+            exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+            next = exp_next;
+        }
+    }
+
+    if (num_nibbles == 0)
+    {
+        slow_path_zero(negative, value);
+        return {next, std::errc()};
+    }
+
+    const auto r = slow_path_round(nullptr, negative, q_hi, q_lo, sticky, exponent, value, mode);
+    return {next, r.ec};
+}
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_FROM_CHARS_HEX_FLOAT_HPP
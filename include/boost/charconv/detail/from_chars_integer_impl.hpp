@@ -10,42 +10,359 @@
 #include <boost/charconv/detail/from_chars_result.hpp>
 #include <boost/charconv/detail/emulated128.hpp>
 #include <boost/charconv/detail/type_traits.hpp>
+#include <boost/charconv/detail/swar.hpp>
+#include <boost/charconv/detail/bit.hpp>
 #include <boost/charconv/config.hpp>
 #include <boost/config.hpp>
+#include <boost/core/bit.hpp>
 #include <system_error>
 #include <type_traits>
 #include <limits>
-#include <cstdlib>
-#include <cerrno>
+#include <climits>
 #include <cstddef>
 #include <cstdint>
 
 namespace boost { namespace charconv { namespace detail {
 
-static constexpr unsigned char uchar_values[] =
-     {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-      255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-      255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-        0,   1,   2,   3,   4,   5,   6,   7,   8,   9, 255, 255, 255, 255, 255, 255,
-      255,  10,  11,  12,  13,  14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,
-       25,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35, 255, 255, 255, 255, 255,
-      255,  10,  11,  12,  13,  14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,
-       25,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35, 255, 255, 255, 255, 255,
-      255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-      255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-      255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-      255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-      255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-      255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-      255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-      255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255};
-
-static_assert(sizeof(uchar_values) == 256, "uchar_values should represent all 256 values of unsigned char");
+#if (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+template <bool b>
+struct char_values_template
+#else
+struct char_values_table
+#endif
+{
+    static constexpr unsigned char uchar_values[] =
+         {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            0,   1,   2,   3,   4,   5,   6,   7,   8,   9, 255, 255, 255, 255, 255, 255,
+          255,  10,  11,  12,  13,  14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,
+           25,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35, 255, 255, 255, 255, 255,
+          255,  10,  11,  12,  13,  14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,
+           25,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255};
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES) && (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+
+template <bool b> constexpr unsigned char char_values_template<b>::uchar_values[];
+
+#endif
+
+#if (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+
+using char_values_table = char_values_template<true>;
+
+#endif
+
+static_assert(sizeof(char_values_table::uchar_values) == 256, "uchar_values should represent all 256 values of unsigned char");
+
+// The value of uchar_values[c] without the table, for device code.
+// c | 0x20 maps 'A' to 'Z' to 'a' to 'z', and nothing else into that range
+BOOST_CHARCONV_GPU_ENABLED constexpr unsigned char compute_digit_from_char(unsigned char c) noexcept
+{
+    return c >= '0' && c <= '9' ? static_cast<unsigned char>(c - '0') :
+           (c | 0x20U) >= 'a' && (c | 0x20U) <= 'z' ? static_cast<unsigned char>((c | 0x20U) - 'a' + 10) :
+           static_cast<unsigned char>(255);
+}
 
 // Convert characters for 0-9, A-Z, a-z to 0-35. Anything else is 255
-constexpr unsigned char digit_from_char(char val) noexcept
+BOOST_CHARCONV_GPU_ENABLED constexpr unsigned char digit_from_char(char val) noexcept
+{
+    #ifdef BOOST_CHARCONV_DEVICE_COMPILE
+    return compute_digit_from_char(static_cast<unsigned char>(val));
+    #else
+    return char_values_table::uchar_values[static_cast<unsigned char>(val)];
+    #endif
+}
+
+// Wider characters only have digits in the ASCII range, so the same table works after a range check
+template <typename CharT>
+BOOST_CHARCONV_GPU_ENABLED constexpr unsigned char digit_from_char(CharT val) noexcept
 {
-    return uchar_values[static_cast<unsigned char>(val)];
+    return (val >= CharT(0) && val <= CharT(127)) ? digit_from_char(static_cast<char>(val)) : static_cast<unsigned char>(255);
+}
+
+// Parses 8 decimal digits at next into digits, or returns false if they are not all digits.
+// Only char is read with SWAR, wider characters take the loop one character at a time
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE BOOST_CHARCONV_CXX14_CONSTEXPR_NO_INLINE bool parse_eight_digits(const char* next, std::uint32_t& digits) noexcept
+{
+    const std::uint64_t chunk = swar_load8(next);
+    if (!swar_is_eight_digits(chunk))
+    {
+        return false;
+    }
+
+    digits = swar_parse_eight_digits(chunk);
+    return true;
+}
+
+template <typename CharT>
+BOOST_CHARCONV_GPU_ENABLED constexpr bool parse_eight_digits(const CharT*, std::uint32_t&) noexcept
+{
+    return false;
+}
+
+// Bases 2, 8 and 16 need no multiplication: 8 characters at a time are validated and packed into 8, 24 or 32 bits
+// and shifted in. Leading zeros are skipped first, so whether the value fits in Unsigned_Integer follows from the
+// number of significant digits alone. Only char is read with SWAR, wider characters take the loop one at a time
+template <int Bits, typename Unsigned_Integer>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CXX14_CONSTEXPR_NO_INLINE const char* parse_power_of_two(const char* next, const char* last,
+                                                                        Unsigned_Integer& result, bool& overflowed) noexcept
+{
+    using Carrier = typename std::conditional<sizeof(Unsigned_Integer) <= sizeof(std::uint64_t), std::uint64_t, Unsigned_Integer>::type;
+    using digits = swar_power_of_two_digits<Bits>;
+
+    constexpr int width = static_cast<int>(sizeof(Unsigned_Integer) * CHAR_BIT);
+    constexpr std::ptrdiff_t max_digits = (width + Bits - 1) / Bits;
+    constexpr int leading_bits = width % Bits;
+
+    while (last - next >= 8 && swar_load8(next) == UINT64_C(0x3030303030303030))
+    {
+        next += 8;
+    }
+    while (next != last && *next == '0')
+    {
+        ++next;
+    }
+
+    const char* const significant_first = next;
+    Carrier value = 0;
+
+    while (last - next >= 8)
+    {
+        const std::uint64_t chunk = swar_load8(next);
+        const std::uint64_t non_digits = digits::non_digits(chunk);
+        const std::uint32_t packed = swar_pack_digits<Bits>(digits::values(chunk));
+
+        if (non_digits != 0)
+        {
+            // The digits before the first non-digit are the most significant part of packed
+            const int count = detail::countr_zero(non_digits) / 8;
+            if (count != 0)
+            {
+                value = static_cast<Carrier>((value << (count * Bits)) | (packed >> ((8 - count) * Bits)));
+                next += count;
+            }
+            last = next;
+            break;
+        }
+
+        value = static_cast<Carrier>((value << (8 * Bits)) | packed);
+        next += 8;
+    }
+
+    for (; next != last; ++next)
+    {
+        const unsigned char current_digit = digit_from_char(*next);
+        if (current_digit >= (1U << Bits))
+        {
+            break;
+        }
+
+        value = static_cast<Carrier>((value << Bits) | current_digit);
+    }
+
+    const std::ptrdiff_t significant_digits = next - significant_first;
+    if (significant_digits > max_digits ||
+        (significant_digits == max_digits && leading_bits != 0 && (digit_from_char(*significant_first) >> leading_bits) != 0))
+    {
+        overflowed = true;
+    }
+    else
+    {
+        result = static_cast<Unsigned_Integer>(value);
+    }
+
+    return next;
+}
+
+template <typename Unsigned_Integer>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CXX14_CONSTEXPR_NO_INLINE bool parse_power_of_two(const char*& next, const char* last, int base,
+                                                                 Unsigned_Integer& result, bool& overflowed) noexcept
+{
+    switch (base)
+    {
+        case 2:
+            next = parse_power_of_two<1>(next, last, result, overflowed);
+            return true;
+        case 8:
+            next = parse_power_of_two<3>(next, last, result, overflowed);
+            return true;
+        case 16:
+            next = parse_power_of_two<4>(next, last, result, overflowed);
+            return true;
+        default:
+            return false;
+    }
+}
+
+template <typename CharT, typename Unsigned_Integer>
+BOOST_CHARCONV_GPU_ENABLED constexpr bool parse_power_of_two(const CharT*&, const CharT*, int, Unsigned_Integer&, bool&) noexcept
+{
+    return false;
+}
+
+// Whether next is a group separator, which needs a digit on both sides of it
+template <typename CharT, typename Unsigned_Integer>
+BOOST_CHARCONV_GPU_ENABLED constexpr bool is_digit_separator(const CharT* next, const CharT* digits_first, const CharT* last, char separator,
+                                  Unsigned_Integer unsigned_base) noexcept
+{
+    return separator != '\0' && *next == static_cast<CharT>(static_cast<unsigned char>(separator)) &&
+           next != digits_first && last - next > 1 && digit_from_char(next[1]) < unsigned_base;
+}
+
+// Skips the remaining digits of a value that overflowed, so that the end is still the first character after the number.
+// Without separators the decimal digits of char are checked 8 at a time
+template <typename CharT, typename Unsigned_Integer>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CXX14_CONSTEXPR const CharT* skip_digits(const CharT* next, const CharT* digits_first, const CharT* last, char separator,
+                                                                       Unsigned_Integer unsigned_base) noexcept
+{
+    if (separator == '\0' && unsigned_base == 10)
+    {
+        std::uint32_t digits {};
+        while (last - next >= 8 && parse_eight_digits(next, digits))
+        {
+            next += 8;
+        }
+    }
+
+    for (; next != last; ++next)
+    {
+        if (digit_from_char(*next) >= unsigned_base && !is_digit_separator(next, digits_first, last, separator, unsigned_base))
+        {
+            break;
+        }
+    }
+
+    return next;
+}
+
+// Reads up to 19 decimal digits at next into chunk, 8 at a time while they fit, and returns 10^(number of digits read)
+template <typename CharT>
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR std::uint64_t parse_decimal_chunk(const CharT*& next, const CharT* last, std::uint64_t& chunk) noexcept
+{
+    std::uint64_t scale = 1;
+    int digits_read = 0;
+    chunk = 0;
+
+    std::uint32_t digits {};
+    while (digits_read <= 11 && last - next >= 8 && parse_eight_digits(next, digits))
+    {
+        chunk = chunk * UINT64_C(100000000) + digits;
+        scale *= UINT64_C(100000000);
+        digits_read += 8;
+        next += 8;
+    }
+
+    for (; digits_read < 19 && next != last; ++digits_read)
+    {
+        const unsigned char current_digit = digit_from_char(*next);
+        if (current_digit > 9)
+        {
+            break;
+        }
+
+        chunk = chunk * 10 + current_digit;
+        scale *= 10;
+        ++next;
+    }
+
+    return scale;
+}
+
+// Decimal digits of a 128-bit value without separators. After the leading zeros the first 38 significant digits,
+// which always fit, are read as two 64-bit chunks and joined with one 64 x 64 bit multiply-add. Only a 39th digit
+// is checked against max_magnitude, and a 40th always overflows, so the 128-bit arithmetic is not done per digit
+template <typename Unsigned_Integer, typename CharT>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CXX14_CONSTEXPR const CharT* parse_decimal128(const CharT* next, const CharT* last, const CharT* digits_first,
+                                                                       Unsigned_Integer& result, Unsigned_Integer max_magnitude, bool& overflowed) noexcept
+{
+    while (next != last && *next == static_cast<CharT>('0'))
+    {
+        ++next;
+    }
+
+    std::uint64_t high {};
+    const std::uint64_t high_scale = parse_decimal_chunk(next, last, high);
+    result = static_cast<Unsigned_Integer>(high);
+    if (high_scale != UINT64_C(10000000000000000000))
+    {
+        return next;
+    }
+
+    std::uint64_t low {};
+    const std::uint64_t low_scale = parse_decimal_chunk(next, last, low);
+    result = static_cast<Unsigned_Integer>(static_cast<Unsigned_Integer>(high) * static_cast<Unsigned_Integer>(low_scale) +
+                                           static_cast<Unsigned_Integer>(low));
+    if (low_scale != UINT64_C(10000000000000000000) || next == last)
+    {
+        return next;
+    }
+
+    const unsigned char current_digit = digit_from_char(*next);
+    if (current_digit > 9)
+    {
+        return next;
+    }
+
+    // The division is only needed for the rare 39 digit values
+    if (result <= static_cast<Unsigned_Integer>((max_magnitude - current_digit) / static_cast<Unsigned_Integer>(10U)))
+    {
+        result = static_cast<Unsigned_Integer>(result * static_cast<Unsigned_Integer>(10U) + current_digit);
+        ++next;
+        if (next == last || digit_from_char(*next) > 9)
+        {
+            return next;
+        }
+    }
+
+    overflowed = true;
+    return skip_digits(next, digits_first, last, '\0', static_cast<Unsigned_Integer>(10U));
+}
+
+// The base of from_chars with base 0, from a C or C++ prefix at next like strtol: 0x or 0X for 16, 0b or 0B for 2,
+// 0o or 0O and a leading 0 for 8, and 10 without one. Letter prefixes are only skipped when a digit of their base follows,
+// so that "0x" is read as 0 followed by 'x'. The leading 0 of octal is a digit itself and stays
+template <typename CharT>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CXX14_CONSTEXPR int detect_base_prefix(const CharT*& next, const CharT* last) noexcept
+{
+    if (last - next < 2 || *next != '0')
+    {
+        return 10;
+    }
+
+    int base = 8;
+    switch (next[1])
+    {
+        case 'x':
+        case 'X':
+            base = 16;
+            break;
+        case 'b':
+        case 'B':
+            base = 2;
+            break;
+        case 'o':
+        case 'O':
+            break;
+        default:
+            return 8;
+    }
+
+    if (last - next > 2 && digit_from_char(next[2]) < static_cast<unsigned>(base))
+    {
+        next += 2;
+    }
+
+    return base;
 }
 
 #ifdef BOOST_MSVC
@@ -70,21 +387,22 @@ constexpr unsigned char digit_from_char(char val) noexcept
 
 #endif
 
-template <typename Integer, typename Unsigned_Integer>
-BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer_impl(const char* first, const char* last, Integer& value, int base) noexcept
+// A separator other than '\0' is skipped where it stands between two digits, so "1,234,567" is read in one pass.
+// With saturate a value that does not fit is clamped to the limit of Integer on its side instead of being rejected
+template <typename Integer, typename Unsigned_Integer, typename CharT>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CXX14_CONSTEXPR from_chars_result_t<CharT> from_chars_integer_impl(const CharT* first, const CharT* last, Integer& value, int base,
+                                                                          char separator = '\0', bool saturate = false) noexcept
 {
     Unsigned_Integer result = 0;
     Unsigned_Integer overflow_value = 0;
     Unsigned_Integer max_digit = 0;
     
     // Check pre-conditions
-    if (!((first <= last) && (base >= 2 && base <= 36)))
+    if (!((first <= last) && ((base >= 2 && base <= 36) || base == 0)))
     {
         return {first, std::errc::invalid_argument};
     }
 
-    const auto unsigned_base = static_cast<Unsigned_Integer>(base);
-
     // Strip sign if the type is signed
     // Negative sign will be appended at the end of parsing
     BOOST_ATTRIBUTE_UNUSED bool is_negative = false;
@@ -145,34 +463,26 @@ BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer_impl(const char* firs
         }
     }
 
-    #ifdef BOOST_CHARCONV_HAS_INT128
-    BOOST_IF_CONSTEXPR (std::is_same<Integer, boost::int128_type>::value)
-    {
-        overflow_value /= unsigned_base;
-        max_digit %= unsigned_base;
-        #ifndef __GLIBCXX_TYPE_INT_N_0
-        if (base != 10)
-        {
-            // Overflow value would cause INT128_MIN in non-base10 to fail
-            overflow_value *= static_cast<Unsigned_Integer>(2);
-        }
-        #endif
-    }
-    else
-    #endif
-    {
-        overflow_value /= unsigned_base;
-        max_digit %= unsigned_base;
-    }
-
     // If the only character was a sign abort now
     if (next == last)
     {
         return {first, std::errc::invalid_argument};
     }
 
+    // The prefix picks the loop for its base, and the digits after it are read in the same pass
+    if (base == 0)
+    {
+        base = detect_base_prefix(next, last);
+    }
+
+    const auto unsigned_base = static_cast<Unsigned_Integer>(base);
+
+    // The magnitude of the limit on the side of the sign, which a saturated value is clamped to
+    const Unsigned_Integer max_magnitude = overflow_value;
+
     bool overflowed = false;
 
+    const CharT* const digits_first = next;
     const std::ptrdiff_t nc = last - next;
 
     // In non-GNU mode on GCC numeric limits may not be specialized
@@ -184,18 +494,88 @@ BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer_impl(const char* firs
     constexpr std::ptrdiff_t nd = std::numeric_limits<Integer>::digits10;
     #endif
 
+    if (separator == '\0' && parse_power_of_two(next, last, base, result, overflowed))
+    {
+        // The digit count bounds the width of Unsigned_Integer, the sign still bounds a signed Integer.
+        // overflow_value is the largest magnitude here, since it is only divided by the base for the loops below
+        if (!overflowed && result > overflow_value)
+        {
+            overflowed = true;
+        }
+    }
+    else if (sizeof(Unsigned_Integer) == 16 && base == 10 && separator == '\0')
+    {
+        // 128-bit decimals are read in 64-bit chunks, which also saves the 128-bit divisions of the limits below
+        next = parse_decimal128(next, last, digits_first, result, max_magnitude, overflowed);
+    }
+    else
     {
+        #ifdef BOOST_CHARCONV_HAS_INT128
+        BOOST_IF_CONSTEXPR (std::is_same<Integer, boost::int128_type>::value)
+        {
+            overflow_value /= unsigned_base;
+            max_digit %= unsigned_base;
+            #ifndef __GLIBCXX_TYPE_INT_N_0
+            if (base != 10)
+            {
+                // Overflow value would cause INT128_MIN in non-base10 to fail
+                overflow_value *= static_cast<Unsigned_Integer>(2);
+            }
+            #endif
+        }
+        else
+        #endif
+        {
+            overflow_value /= unsigned_base;
+            max_digit %= unsigned_base;
+        }
+
         std::ptrdiff_t i = 0;
 
-        for( ; i < nd && i < nc; ++i )
+        // Base 10 fast path: consume 8 digits at a time while we are still in the region where overflow is impossible
+        if (base == 10)
+        {
+            for ( ; i + 8 <= nd && i + 8 <= nc; i += 8)
+            {
+                std::uint32_t digits {};
+                if (!parse_eight_digits(next, digits))
+                {
+                    break;
+                }
+
+                result = static_cast<Unsigned_Integer>(result * static_cast<Unsigned_Integer>(UINT32_C(100000000)) +
+                                                       static_cast<Unsigned_Integer>(digits));
+                next += 8;
+            }
+        }
+
+        // digits10 only bounds the bases up to 10, in a larger base the digits that cannot overflow are those of
+        // the largest power of the base that is not above the limit
+        std::ptrdiff_t safe_digits = nd;
+        if (base > 10)
         {
-            // overflow is not possible in the first nd characters
+            safe_digits = 0;
+            const Unsigned_Integer power_limit = max_magnitude / unsigned_base;
+            for (Unsigned_Integer power = 1; power <= power_limit; power = static_cast<Unsigned_Integer>(power * unsigned_base))
+            {
+                ++safe_digits;
+            }
+        }
+
+        for( ; i < safe_digits && i < nc; ++i )
+        {
+            // overflow is not possible in the first safe_digits characters
 
             const unsigned char current_digit = digit_from_char(*next);
 
             if (current_digit >= unsigned_base)
             {
-                break;
+                if (!is_digit_separator(next, digits_first, last, separator, unsigned_base))
+                {
+                    break;
+                }
+                ++next;
+                continue;
             }
 
             result = static_cast<Unsigned_Integer>(result * unsigned_base + current_digit);
@@ -208,7 +588,12 @@ BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer_impl(const char* firs
 
             if (current_digit >= unsigned_base)
             {
-                break;
+                if (!is_digit_separator(next, digits_first, last, separator, unsigned_base))
+                {
+                    break;
+                }
+                ++next;
+                continue;
             }
 
             if (result < overflow_value || (result == overflow_value && current_digit <= max_digit))
@@ -217,19 +602,32 @@ BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer_impl(const char* firs
             }
             else
             {
-                // Required to keep updating the value of next, but the result is garbage
+                // The value is out of range whatever follows, so the rest is only skipped to find the end
                 overflowed = true;
+                next = skip_digits(next + 1, digits_first, last, separator, unsigned_base);
+                break;
             }
 
             ++next;
         }
     }
 
+    // At least one digit is required, also after a sign
+    if (next == digits_first)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
     // Return the parsed value, adding the sign back if applicable
-    // If we have overflowed then we do not return the result 
+    // If we have overflowed then we do not return the result, unless it saturates
     if (overflowed)
     {
-        return {next, std::errc::result_out_of_range};
+        if (!saturate)
+        {
+            return {next, std::errc::result_out_of_range};
+        }
+
+        result = max_magnitude;
     }
 
     value = static_cast<Integer>(result);
@@ -254,16 +652,16 @@ BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer_impl(const char* firs
 #endif
 
 // Only from_chars for integer types is constexpr (as of C++23)
-template <typename Integer>
-BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, Integer& value, int base = 10) noexcept
+template <typename Integer, typename CharT>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result_t<CharT> from_chars(const CharT* first, const CharT* last, Integer& value, int base = 10) noexcept
 {
     using Unsigned_Integer = typename std::make_unsigned<Integer>::type;
     return detail::from_chars_integer_impl<Integer, Unsigned_Integer>(first, last, value, base);
 }
 
 #ifdef BOOST_CHARCONV_HAS_INT128
-template <typename Integer>
-BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars128(const char* first, const char* last, Integer& value, int base = 10) noexcept
+template <typename Integer, typename CharT>
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result_t<CharT> from_chars128(const CharT* first, const CharT* last, Integer& value, int base = 10) noexcept
 {
     using Unsigned_Integer = boost::uint128_type;
     return detail::from_chars_integer_impl<Integer, Unsigned_Integer>(first, last, value, base);
@@ -275,6 +673,146 @@ BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars128(const char* first,
     return from_chars_integer_impl<uint128, uint128>(first, last, value, base);
 }
 
+template <typename Integer, typename Unsigned_Integer>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CXX14_CONSTEXPR from_chars_result from_chars_saturating_impl(const char* first, const char* last, Integer& value, int base) noexcept
+{
+    return from_chars_integer_impl<Integer, Unsigned_Integer>(first, last, value, base, '\0', true);
+}
+
+// Number of decimal digits that always fit in Integer, which bounds the length of from_chars_exact
+template <typename Integer>
+struct exact_max_digits
+{
+    #if defined(BOOST_CHARCONV_HAS_INT128) && !defined(__GLIBCXX_TYPE_INT_N_0)
+    static constexpr std::size_t value = std::is_same<Integer, boost::int128_type>::value ? 38 :
+                                         std::is_same<Integer, boost::uint128_type>::value ? 38 :
+                                         static_cast<std::size_t>(std::numeric_limits<Integer>::digits10);
+    #else
+    static constexpr std::size_t value = static_cast<std::size_t>(std::numeric_limits<Integer>::digits10);
+    #endif
+};
+
+// Reads the 8 characters at first, or the Length < 8 characters at first with '0's in front of them
+template <std::size_t Length>
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE BOOST_CHARCONV_CXX14_CONSTEXPR_NO_INLINE std::uint64_t exact_load(const char* first) noexcept
+{
+    BOOST_IF_CONSTEXPR (Length == 8)
+    {
+        return swar_load8(first);
+    }
+
+    std::uint64_t val = UINT64_C(0x3030303030303030) >> ((Length % 8) * 8);
+    for (std::size_t i = 0; i < Length; ++i)
+    {
+        val |= static_cast<std::uint64_t>(static_cast<unsigned char>(first[i])) << ((8 - Length + i) * 8);
+    }
+    return val;
+}
+
+// Exactly N digits: the N % 8 leading ones are padded to a word, then every word is checked with one combined mask
+// and reduced with a multiplication by 10^8 each. Nothing after first + N is read and N digits can not overflow Integer
+template <std::size_t N, typename Integer, typename Unsigned_Integer>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CXX14_CONSTEXPR from_chars_result from_chars_exact_impl(const char* first, Integer& value) noexcept
+{
+    static_assert(N > 0, "At least one digit is required");
+    static_assert(N <= exact_max_digits<Integer>::value, "N digits do not always fit in the integer type");
+
+    using Carrier = typename std::conditional<sizeof(Unsigned_Integer) <= sizeof(std::uint64_t), std::uint64_t, Unsigned_Integer>::type;
+
+    constexpr std::size_t leading = N % 8;
+    std::uint64_t non_digits = 0;
+    Carrier result = 0;
+
+    std::size_t i = 0;
+    BOOST_IF_CONSTEXPR (leading != 0)
+    {
+        const std::uint64_t word = exact_load<leading>(first);
+        non_digits |= swar_non_digits(word);
+        result = swar_parse_eight_digits(word);
+        i = leading;
+    }
+
+    for (; i < N; i += 8)
+    {
+        const std::uint64_t word = exact_load<8>(first + i);
+        non_digits |= swar_non_digits(word);
+        result = static_cast<Carrier>(result * UINT64_C(100000000) + swar_parse_eight_digits(word));
+    }
+
+    if (non_digits != 0)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    value = static_cast<Integer>(result);
+    return {first + N, std::errc()};
+}
+
+// The output of to_chars in base: a '-' for a negative value followed by nothing but digits, and a value that fits.
+// None of it is checked. Base 10 takes the len % 8 leading digits one at a time and then 8 at a time, and bases 2, 8 and 16
+// go through parse_power_of_two. Any other input only gives an unspecified value, nothing outside [first, last) is read
+template <typename Integer, typename Unsigned_Integer>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CXX14_CONSTEXPR from_chars_result from_chars_unchecked_impl(const char* first, const char* last, Integer& value, int base) noexcept
+{
+    BOOST_CHARCONV_ASSERT(first < last && base >= 2 && base <= 36);
+
+    using Carrier = typename std::conditional<sizeof(Unsigned_Integer) <= sizeof(std::uint64_t), std::uint64_t, Unsigned_Integer>::type;
+
+    const char* next = first;
+    bool is_negative = false;
+    BOOST_IF_CONSTEXPR (is_signed<Integer>::value)
+    {
+        if (*next == '-')
+        {
+            is_negative = true;
+            ++next;
+        }
+    }
+    BOOST_CHARCONV_ASSERT(next != last);
+
+    Carrier result = 0;
+    Unsigned_Integer power_of_two_result = 0;
+    bool overflowed = false;
+
+    if (base == 10)
+    {
+        for (std::ptrdiff_t leading = (last - next) % 8; leading != 0; --leading, ++next)
+        {
+            BOOST_CHARCONV_ASSERT(*next >= '0' && *next <= '9');
+            result = static_cast<Carrier>(result * 10U + static_cast<unsigned char>(*next - '0'));
+        }
+
+        for (; next != last; next += 8)
+        {
+            const std::uint64_t word = swar_load8(next);
+            BOOST_CHARCONV_ASSERT(swar_is_eight_digits(word));
+            result = static_cast<Carrier>(result * UINT64_C(100000000) + swar_parse_eight_digits(word));
+        }
+    }
+    else if (parse_power_of_two(next, last, base, power_of_two_result, overflowed))
+    {
+        BOOST_CHARCONV_ASSERT(next == last && !overflowed);
+        result = static_cast<Carrier>(power_of_two_result);
+    }
+    else
+    {
+        const auto unsigned_base = static_cast<unsigned>(base);
+        for (; next != last; ++next)
+        {
+            BOOST_CHARCONV_ASSERT(digit_from_char(*next) < unsigned_base);
+            result = static_cast<Carrier>(result * unsigned_base + digit_from_char(*next));
+        }
+    }
+
+    if (is_negative)
+    {
+        result = static_cast<Carrier>(static_cast<Carrier>(0U) - result);
+    }
+
+    value = static_cast<Integer>(result);
+    return {last, std::errc()};
+}
+
 }}} // Namespaces
 
 #endif // BOOST_CHARCONV_DETAIL_FROM_CHARS_INTEGER_IMPL_HPP
@@ -5,7 +5,10 @@
 #ifndef BOOST_CHARCONV_DETAIL_FROM_CHARS_RESULT_HPP
 #define BOOST_CHARCONV_DETAIL_FROM_CHARS_RESULT_HPP
 
+#include <boost/charconv/detail/config.hpp>
 #include <system_error>
+#include <cstddef>
+#include <cstdint>
 
 namespace boost { namespace charconv {
 
@@ -22,20 +25,109 @@ struct from_chars_result_t
     // ERANGE = result_out_of_range
     std::errc ec;
 
-    friend constexpr bool operator==(const from_chars_result_t<UC>& lhs, const from_chars_result_t<UC>& rhs) noexcept
+    BOOST_CHARCONV_GPU_ENABLED friend constexpr bool operator==(const from_chars_result_t<UC>& lhs, const from_chars_result_t<UC>& rhs) noexcept
     {
         return lhs.ptr == rhs.ptr && lhs.ec == rhs.ec;
     }
 
-    friend constexpr bool operator!=(const from_chars_result_t<UC>& lhs, const from_chars_result_t<UC>& rhs) noexcept
+    BOOST_CHARCONV_GPU_ENABLED friend constexpr bool operator!=(const from_chars_result_t<UC>& lhs, const from_chars_result_t<UC>& rhs) noexcept
     {
         return !(lhs == rhs); // NOLINT : Expression can not be simplified since this is the definition
     }
 
-    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+    BOOST_CHARCONV_GPU_ENABLED constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
 };
 using from_chars_result = from_chars_result_t<char>;
 
+// Result of the from_chars overloads that return the value instead of writing it through a reference.
+// On failure value is T{}, unless from_chars with a reference would have written it (e.g. ±0 or ±HUGE_VAL for floats)
+template <typename T>
+struct from_chars_value
+{
+    T value;
+    const char* ptr;
+    std::errc ec;
+
+    BOOST_CHARCONV_GPU_ENABLED friend constexpr bool operator==(const from_chars_value<T>& lhs, const from_chars_value<T>& rhs) noexcept
+    {
+        return lhs.value == rhs.value && lhs.ptr == rhs.ptr && lhs.ec == rhs.ec;
+    }
+
+    BOOST_CHARCONV_GPU_ENABLED friend constexpr bool operator!=(const from_chars_value<T>& lhs, const from_chars_value<T>& rhs) noexcept
+    {
+        return !(lhs == rhs); // NOLINT : Expression can not be simplified since this is the definition
+    }
+
+    BOOST_CHARCONV_GPU_ENABLED constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
+// Result of parsing a sequence of delimited values with from_chars_many
+struct from_chars_many_result
+{
+    // On success points at the first character of the next unparsed field (or last),
+    // and on failure at the first character of the field that could not be parsed
+    const char* ptr;
+
+    // Error from the first field that could not be parsed, or 0 if none
+    std::errc ec;
+
+    // Number of values successfully written to the output
+    std::size_t count;
+
+    friend constexpr bool operator==(const from_chars_many_result& lhs, const from_chars_many_result& rhs) noexcept
+    {
+        return lhs.ptr == rhs.ptr && lhs.ec == rhs.ec && lhs.count == rhs.count;
+    }
+
+    friend constexpr bool operator!=(const from_chars_many_result& lhs, const from_chars_many_result& rhs) noexcept
+    {
+        return !(lhs == rhs); // NOLINT : Expression can not be simplified since this is the definition
+    }
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
+// What from_chars_classify found the number to be
+enum class number_kind : unsigned
+{
+    none,
+    integer,
+    floating
+};
+
+// Result of classifying a number with from_chars_classify
+struct from_chars_classify_result
+{
+    const char* ptr;
+    std::errc ec;
+    number_kind kind;
+
+    // Bits of the smallest signed integer type that holds an integer: 8, 16, 32, 64 or 128, and 0 otherwise
+    int integer_bits;
+
+    // Whether the number read as a float has the same shortest representation as read as a double
+    bool float_exact;
+
+    // The value of an integer of at most 64 bits
+    std::int64_t integer;
+
+    // The value of every number, integers included, as a double
+    double real;
+
+    friend constexpr bool operator==(const from_chars_classify_result& lhs, const from_chars_classify_result& rhs) noexcept
+    {
+        return lhs.ptr == rhs.ptr && lhs.ec == rhs.ec && lhs.kind == rhs.kind && lhs.integer_bits == rhs.integer_bits &&
+               lhs.float_exact == rhs.float_exact && lhs.integer == rhs.integer && lhs.real == rhs.real;
+    }
+
+    friend constexpr bool operator!=(const from_chars_classify_result& lhs, const from_chars_classify_result& rhs) noexcept
+    {
+        return !(lhs == rhs); // NOLINT : Expression can not be simplified since this is the definition
+    }
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
 }} // Namespaces
 
 #endif // BOOST_CHARCONV_DETAIL_FROM_CHARS_RESULT_HPP
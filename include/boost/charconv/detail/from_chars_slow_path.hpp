@@ -0,0 +1,754 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_FROM_CHARS_SLOW_PATH_HPP
+#define BOOST_CHARCONV_DETAIL_FROM_CHARS_SLOW_PATH_HPP
+
+// Correctly rounded conversion of a validated decimal or hexadecimal string for the cases
+// the fast paths (compute_float32/64/80/128) can not handle.
+//
+// The significant digits are read into a big integer M, and the value is M * 10^E (or M * 2^E for hex).
+// We form X / D = M * 5^E * 2^s or M * 2^s / 5^-E with s chosen so that the integer quotient Q has
+// two or three bits more than the significand of the target type, which together with whether the
+// remainder is zero is all that is needed to round to nearest even.
+// The quotient is found with schoolbook long division (Knuth Vol. 2, 4.3.1, Algorithm D).
+//
+// Everything happens in fixed size stack buffers, so there is no allocation and no dependence on the locale.
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/bit_layouts.hpp>
+#include <boost/charconv/detail/emulated128.hpp>
+#include <boost/charconv/detail/fast_float/bigint.hpp>
+#include <boost/charconv/detail/slow_path_counters.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <type_traits>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost { namespace charconv { namespace detail {
+
+// Describes the binary format of T
+// digits: precision in bits including the hidden (or explicit) integer bit
+// min_exponent / max_exponent: exponents of the smallest and largest normal values
+template <typename T>
+struct slow_path_format
+{
+    static constexpr int digits = std::numeric_limits<T>::digits;
+    static constexpr int min_exponent = std::numeric_limits<T>::min_exponent - 1;
+    static constexpr int max_exponent = std::numeric_limits<T>::max_exponent - 1;
+};
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+template <>
+struct slow_path_format<__float128>
+{
+    static constexpr int digits = 113;
+    static constexpr int min_exponent = -16382;
+    static constexpr int max_exponent = 16383;
+};
+#endif
+
+template <typename T>
+struct slow_path_traits : slow_path_format<T>
+{
+    using format = slow_path_format<T>;
+
+    // floor(x * log10(2)), exact for 0 <= x <= 2^20 which covers every exponent we need
+    static constexpr int floor_log10_pow2(int x) noexcept
+    {
+        return static_cast<int>((static_cast<std::int64_t>(x) * INT64_C(1292913986)) >> 32);
+    }
+
+    // The value is smaller than half of the smallest subnormal if it is
+    // less than 10^min_decimal_exponent (and then it always rounds to zero)
+    static constexpr int min_decimal_exponent = -(floor_log10_pow2(format::digits - format::min_exponent) + 1);
+
+    // The value is larger than the largest finite value if it is at least 10^max_decimal_exponent
+    static constexpr int max_decimal_exponent = floor_log10_pow2(format::max_exponent + 1) + 1;
+
+    // The number of significant decimal digits of the longest halfway point between two values
+    // (e.g. 767 for double), plus some slack. Digits beyond this only matter if they are non-zero,
+    // which is recorded with a single trailing 1
+    static constexpr int max_decimal_digits = (format::digits - format::min_exponent) - floor_log10_pow2(format::digits - format::min_exponent) +
+                                              floor_log10_pow2(format::digits) + 4;
+
+    // Enough hexadecimal digits for the significand, a guard and a round bit
+    static constexpr int max_hex_digits = format::digits / 4 + 3;
+
+    // Large enough for both the digits (log2(10) bits each) and 5^-E (log2(5) bits per power),
+    // plus the shift applied before dividing
+    static constexpr std::size_t bigint_bits = static_cast<std::size_t>(max_decimal_digits + 2) * 3322 / 1000 + 320;
+    static constexpr std::uint16_t bigint_limbs = static_cast<std::uint16_t>(bigint_bits / fast_float::limb_bits + 1);
+
+    static_assert(static_cast<std::size_t>(max_decimal_digits + 2 - min_decimal_exponent) * 2322 / 1000 + 256 < bigint_bits,
+                  "The big integer must be large enough to hold 5^-E");
+};
+
+using slow_path_limb = fast_float::limb;
+
+// Computes (hi * B + lo) / d and the remainder where B is 2^limb_bits. Requires hi < d
+inline slow_path_limb slow_path_divrem(slow_path_limb hi, slow_path_limb lo, slow_path_limb d, slow_path_limb& rem) noexcept
+{
+    #ifdef BOOST_CHARCONV_FASTFLOAT_64BIT_LIMB
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    const auto num = (static_cast<boost::uint128_type>(hi) << 64) | lo;
+    rem = static_cast<slow_path_limb>(num % d);
+    return static_cast<slow_path_limb>(num / d);
+    #else
+    const uint128 num {hi, lo};
+    const uint128 q = num / uint128(d);
+    rem = (num - q * uint128(d)).low;
+    return q.low;
+    #endif
+
+    #else
+
+    const std::uint64_t num = (static_cast<std::uint64_t>(hi) << 32) | lo;
+    rem = static_cast<slow_path_limb>(num % d);
+    return static_cast<slow_path_limb>(num / d);
+
+    #endif
+}
+
+inline slow_path_limb slow_path_sub(slow_path_limb x, slow_path_limb y, slow_path_limb& borrow) noexcept
+{
+    const slow_path_limb t = x - y;
+    const slow_path_limb b1 = static_cast<slow_path_limb>(x < y);
+    const slow_path_limb r = t - borrow;
+    const slow_path_limb b2 = static_cast<slow_path_limb>(t < borrow);
+    borrow = b1 | b2;
+    return r;
+}
+
+// Divides u by v (normalized so that the top bit of its top limb is set) leaving the remainder in u.
+// The quotient must fit into 128 bits and is returned in q_hi and q_lo
+template <std::uint16_t size>
+bool slow_path_divide(fast_float::stackvec<size>& u, const fast_float::stackvec<size>& v,
+                      std::uint64_t& q_hi, std::uint64_t& q_lo) noexcept
+{
+    constexpr std::size_t max_quotient_limbs = 128 / fast_float::limb_bits;
+    slow_path_limb q[max_quotient_limbs] {};
+
+    const std::size_t n = v.len();
+    if (u.len() < n)
+    {
+        q_hi = 0;
+        q_lo = 0;
+        return true;
+    }
+
+    const std::size_t m = u.len() - n;
+    if (!u.try_push(0))
+    {
+        return false;
+    }
+
+    const slow_path_limb v_top = v[n - 1];
+    const slow_path_limb v_next = n >= 2 ? v[n - 2] : 0;
+
+    for (std::size_t j = m + 1; j-- > 0;)
+    {
+        // Estimate the next quotient limb from the top limbs, it is at most 2 too large
+        slow_path_limb qhat;
+        slow_path_limb rhat;
+        bool rhat_overflow = false;
+
+        if (u[j + n] >= v_top)
+        {
+            qhat = static_cast<slow_path_limb>(~static_cast<slow_path_limb>(0));
+            rhat = u[j + n - 1] + v_top;
+            rhat_overflow = rhat < v_top;
+        }
+        else
+        {
+            qhat = slow_path_divrem(u[j + n], u[j + n - 1], v_top, rhat);
+        }
+
+        if (n >= 2)
+        {
+            while (!rhat_overflow)
+            {
+                slow_path_limb p_hi = 0;
+                const slow_path_limb p_lo = fast_float::scalar_mul(qhat, v_next, p_hi);
+                if (p_hi > rhat || (p_hi == rhat && p_lo > u[j + n - 2]))
+                {
+                    --qhat;
+                    rhat += v_top;
+                    rhat_overflow = rhat < v_top;
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+
+        // u[j .. j + n] -= qhat * v
+        slow_path_limb carry = 0;
+        slow_path_limb borrow = 0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const slow_path_limb product = fast_float::scalar_mul(qhat, v[i], carry);
+            u[i + j] = slow_path_sub(u[i + j], product, borrow);
+        }
+        u[j + n] = slow_path_sub(u[j + n], carry, borrow);
+
+        // The estimate was one too large so add v back
+        if (borrow != 0)
+        {
+            --qhat;
+            bool add_carry = false;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                bool c1 = false;
+                bool c2 = false;
+                slow_path_limb sum = fast_float::scalar_add(u[i + j], v[i], c1);
+                sum = fast_float::scalar_add(sum, static_cast<slow_path_limb>(add_carry), c2);
+                u[i + j] = sum;
+                add_carry = c1 || c2;
+            }
+            u[j + n] += static_cast<slow_path_limb>(add_carry);
+        }
+
+        if (j < max_quotient_limbs)
+        {
+            q[j] = qhat;
+        }
+        else if (qhat != 0)
+        {
+            return false;
+        }
+    }
+
+    #ifdef BOOST_CHARCONV_FASTFLOAT_64BIT_LIMB
+    q_lo = q[0];
+    q_hi = q[1];
+    #else
+    q_lo = (static_cast<std::uint64_t>(q[1]) << 32) | q[0];
+    q_hi = (static_cast<std::uint64_t>(q[3]) << 32) | q[2];
+    #endif
+
+    u.normalize();
+    return true;
+}
+
+// Stores the rounded significand q (with the integer bit set for normal values) and
+// biased exponent (0 for subnormals) into T
+template <typename T, typename std::enable_if<slow_path_format<T>::digits == 24, bool>::type = true>
+inline BOOST_CHARCONV_CXX20_CONSTEXPR void slow_path_assemble(bool negative, std::uint64_t, std::uint64_t q_lo, std::int32_t biased_exponent, T& value) noexcept
+{
+    static_assert(sizeof(T) == sizeof(std::uint32_t), "Unsupported float layout");
+    std::uint32_t bits = static_cast<std::uint32_t>(q_lo) & ((UINT32_C(1) << 23) - 1);
+    bits |= static_cast<std::uint32_t>(biased_exponent) << 23;
+    bits |= static_cast<std::uint32_t>(negative) << 31;
+
+    #ifdef BOOST_CHARCONV_HAS_CONSTEXPR_FLOAT
+    if (std::is_constant_evaluated())
+    {
+        value = std::bit_cast<T>(bits);
+        return;
+    }
+    #endif
+
+    std::memcpy(&value, &bits, sizeof(bits));
+}
+
+template <typename T, typename std::enable_if<slow_path_format<T>::digits == 53, bool>::type = true>
+inline BOOST_CHARCONV_CXX20_CONSTEXPR void slow_path_assemble(bool negative, std::uint64_t, std::uint64_t q_lo, std::int32_t biased_exponent, T& value) noexcept
+{
+    static_assert(sizeof(T) == sizeof(std::uint64_t), "Unsupported double layout");
+    std::uint64_t bits = q_lo & ((UINT64_C(1) << 52) - 1);
+    bits |= static_cast<std::uint64_t>(biased_exponent) << 52;
+    bits |= static_cast<std::uint64_t>(negative) << 63;
+
+    #ifdef BOOST_CHARCONV_HAS_CONSTEXPR_FLOAT
+    if (std::is_constant_evaluated())
+    {
+        value = std::bit_cast<T>(bits);
+        return;
+    }
+    #endif
+
+    std::memcpy(&value, &bits, sizeof(bits));
+}
+
+#if BOOST_CHARCONV_LDBL_BITS == 80
+template <typename T, typename std::enable_if<slow_path_format<T>::digits == 64, bool>::type = true>
+inline void slow_path_assemble(bool negative, std::uint64_t, std::uint64_t q_lo, std::int32_t biased_exponent, T& value) noexcept
+{
+    IEEEl2bits bits {};
+    #if BOOST_CHARCONV_ENDIAN_LITTLE_BYTE
+    bits.mantissa_l = q_lo;
+    #else
+    bits.mantissa_h = q_lo;
+    #endif
+    bits.exponent = static_cast<std::uint32_t>(biased_exponent) & UINT32_C(0x7FFF);
+    bits.sign = static_cast<std::uint32_t>(negative);
+    std::memcpy(&value, &bits, sizeof(T));
+}
+#endif
+
+template <typename T, typename std::enable_if<slow_path_format<T>::digits == 113, bool>::type = true>
+inline void slow_path_assemble(bool negative, std::uint64_t q_hi, std::uint64_t q_lo, std::int32_t biased_exponent, T& value) noexcept
+{
+    // long double with 113 digits has the same layout as IEEEbinary128
+    static_assert(sizeof(T) == sizeof(IEEEbinary128), "Unsupported binary128 layout");
+    IEEEbinary128 bits {};
+    bits.mantissa_l = q_lo;
+    bits.mantissa_h = q_hi & ((UINT64_C(1) << 48) - 1);
+    bits.exponent = static_cast<std::uint32_t>(biased_exponent) & UINT32_C(0x7FFF);
+    bits.sign = static_cast<std::uint32_t>(negative);
+    std::memcpy(&value, &bits, sizeof(T));
+}
+
+// numeric_limits is not specialized for __float128 in all modes so infinity is built from its bits
+template <typename T>
+inline BOOST_CHARCONV_CXX20_CONSTEXPR void slow_path_infinity(bool negative, T& value) noexcept
+{
+    using format = slow_path_format<T>;
+    constexpr int p = format::digits;
+
+    // Integer bit only, which is explicit in the 80-bit format
+    const std::uint64_t q_hi = p > 64 ? UINT64_C(1) << ((p - 65) % 64) : 0;
+    const std::uint64_t q_lo = p <= 64 ? UINT64_C(1) << ((p - 1) % 64) : 0;
+    slow_path_assemble(negative, q_hi, q_lo, format::max_exponent - format::min_exponent + 2, value);
+}
+
+template <typename T>
+inline BOOST_CHARCONV_CXX20_CONSTEXPR void slow_path_zero(bool negative, T& value) noexcept
+{
+    slow_path_assemble(negative, 0, 0, 0, value);
+}
+
+// Bit length of the 128-bit value hi:lo
+inline BOOST_CHARCONV_CXX20_CONSTEXPR int slow_path_bit_length(std::uint64_t hi, std::uint64_t lo) noexcept
+{
+    if (hi != 0)
+    {
+        return 128 - fast_float::leading_zeroes(hi);
+    }
+
+    return lo == 0 ? 0 : 64 - fast_float::leading_zeroes(lo);
+}
+
+// Rounds Q (with sticky if the remainder of the division was non-zero) to the target type
+// where the real value is (Q + fraction) * 2^binary_exponent
+template <typename T>
+BOOST_CHARCONV_CXX20_CONSTEXPR from_chars_result slow_path_round(const char* ptr, bool negative, std::uint64_t q_hi, std::uint64_t q_lo, bool sticky,
+                                  std::int64_t binary_exponent, T& value, rounding_mode mode = rounding_mode::to_nearest) noexcept
+{
+    using format = slow_path_format<T>;
+    constexpr int p = format::digits;
+
+    const int length = slow_path_bit_length(q_hi, q_lo);
+
+    // Exponent of the leading bit
+    const std::int64_t e = length - 1 + binary_exponent;
+
+    if (e > format::max_exponent)
+    {
+        if (mode != rounding_mode::to_nearest && !rounds_magnitude_up(mode, negative))
+        {
+            // The largest finite value, with all p bits set
+            const std::uint64_t max_hi = p > 64 ? (UINT64_C(1) << ((p - 64) % 64)) - 1 : 0;
+            const std::uint64_t max_lo = p >= 64 ? ~UINT64_C(0) : (UINT64_C(1) << (p % 64)) - 1;
+            slow_path_assemble(negative, max_hi, max_lo, format::max_exponent - format::min_exponent + 1, value);
+            return {ptr, std::errc()};
+        }
+
+        slow_path_infinity(negative, value);
+        return {ptr, std::errc::result_out_of_range};
+    }
+
+    // Number of bits to drop so that the result has p bits, or fewer for subnormals
+    std::int64_t shift = length - p;
+    std::int32_t biased_exponent = static_cast<std::int32_t>(e - format::min_exponent + 1);
+    if (e < format::min_exponent)
+    {
+        shift += format::min_exponent - e;
+        biased_exponent = 0;
+    }
+
+    // Round to nearest with ties to even, or in the direction of mode
+    std::uint64_t r_hi = q_hi;
+    std::uint64_t r_lo = q_lo;
+    if (shift > 0)
+    {
+        bool round_bit = false;
+        if (shift <= 128)
+        {
+            const auto round_position = static_cast<int>(shift - 1);
+            round_bit = round_position >= 64 ? ((q_hi >> (round_position - 64)) & 1U) != 0 : ((q_lo >> round_position) & 1U) != 0;
+
+            // Anything below the round bit is sticky
+            if (round_position >= 64)
+            {
+                sticky = sticky || q_lo != 0 || (q_hi & ((UINT64_C(1) << (round_position - 64)) - 1)) != 0;
+            }
+            else
+            {
+                sticky = sticky || (q_lo & ((UINT64_C(1) << round_position) - 1)) != 0;
+            }
+        }
+        else
+        {
+            sticky = sticky || q_hi != 0 || q_lo != 0;
+        }
+
+        if (shift >= 128)
+        {
+            r_hi = 0;
+            r_lo = 0;
+        }
+        else if (shift >= 64)
+        {
+            r_lo = q_hi >> (shift - 64);
+            r_hi = 0;
+        }
+        else
+        {
+            r_lo = (q_lo >> shift) | (q_hi << (64 - shift));
+            r_hi = q_hi >> shift;
+        }
+
+        const bool round_up = mode == rounding_mode::to_nearest ? round_bit && (sticky || (r_lo & 1U) != 0) :
+                                                                  (round_bit || sticky) && rounds_magnitude_up(mode, negative);
+        if (round_up)
+        {
+            ++r_lo;
+            if (r_lo == 0)
+            {
+                ++r_hi;
+            }
+        }
+    }
+    else
+    {
+        // Exact
+        const auto left_shift = static_cast<int>(-shift);
+        if (left_shift >= 64)
+        {
+            r_hi = q_lo << (left_shift - 64);
+            r_lo = 0;
+        }
+        else if (left_shift > 0)
+        {
+            r_hi = (q_hi << left_shift) | (q_lo >> (64 - left_shift));
+            r_lo = q_lo << left_shift;
+        }
+    }
+
+    const int rounded_length = slow_path_bit_length(r_hi, r_lo);
+
+    if (biased_exponent == 0)
+    {
+        if (rounded_length == 0)
+        {
+            slow_path_zero(negative, value);
+            return {ptr, std::errc::result_out_of_range};
+        }
+
+        // Rounded up to the smallest normal value
+        if (rounded_length == p)
+        {
+            biased_exponent = 1;
+        }
+    }
+    else if (rounded_length > p)
+    {
+        // Rounding carried into a new bit
+        r_lo = (r_lo >> 1) | (r_hi << 63);
+        r_hi >>= 1;
+        ++biased_exponent;
+
+        if (biased_exponent > format::max_exponent - format::min_exponent + 1)
+        {
+            slow_path_infinity(negative, value);
+            return {ptr, std::errc::result_out_of_range};
+        }
+    }
+
+    slow_path_assemble(negative, r_hi, r_lo, biased_exponent, value);
+    return {ptr, std::errc()};
+}
+
+inline slow_path_limb slow_path_pow_base(bool hex, int count) noexcept
+{
+    if (hex)
+    {
+        return static_cast<slow_path_limb>(static_cast<slow_path_limb>(1) << (4 * count));
+    }
+
+    slow_path_limb result = 1;
+    for (int i = 0; i < count; ++i)
+    {
+        result *= 10;
+    }
+
+    return result;
+}
+
+inline unsigned slow_path_digit_value(char c) noexcept
+{
+    if (c >= '0' && c <= '9')
+    {
+        return static_cast<unsigned>(c - '0');
+    }
+    if (c >= 'a' && c <= 'f')
+    {
+        return static_cast<unsigned>(c - 'a' + 10);
+    }
+    if (c >= 'A' && c <= 'F')
+    {
+        return static_cast<unsigned>(c - 'A' + 10);
+    }
+
+    return 16;
+}
+
+// [first, last) must hold a finite number that has already been validated by the parser for fmt,
+// e.g. -1.234e+56 or for hex 1.8p-3
+template <typename T>
+from_chars_result from_chars_slow_path(const char* first, const char* last, T& value, chars_format fmt) noexcept
+{
+    BOOST_CHARCONV_COUNT_SLOW_PATH(from_chars_slow_path);
+    BOOST_CHARCONV_SAMPLE_SLOW_PATH_CHARS(from_chars_slow_path, slow_path_format<T>::digits, first, last);
+
+    using traits = slow_path_traits<T>;
+    using big_type = fast_float::basic_bigint<traits::bigint_limbs>;
+
+    const bool hex = fmt == chars_format::hex;
+    const unsigned base = hex ? 16U : 10U;
+    const int max_digits = hex ? traits::max_hex_digits : traits::max_decimal_digits;
+
+    // Number of digits that fit in a limb at a time
+    #ifdef BOOST_CHARCONV_FASTFLOAT_64BIT_LIMB
+    const int chunk_digits = hex ? 15 : 19;
+    #else
+    const int chunk_digits = hex ? 7 : 9;
+    #endif
+
+    // Each digit scales the exponent by 10 or 2^4
+    const int digit_exponent = hex ? 4 : 1;
+
+    auto next = first;
+    bool negative = false;
+    if (next != last && *next == '-')
+    {
+        negative = true;
+        ++next;
+    }
+
+    big_type significand;
+    slow_path_limb chunk = 0;
+    int chunk_length = 0;
+    int num_digits = 0;
+    bool truncated_non_zero = false;
+    std::int64_t exponent = 0;
+
+    const auto add_digit = [&](unsigned digit) noexcept
+    {
+        chunk = static_cast<slow_path_limb>(chunk * base + digit);
+        ++chunk_length;
+        ++num_digits;
+        if (chunk_length == chunk_digits)
+        {
+            significand.mul(slow_path_pow_base(hex, chunk_length));
+            significand.add(chunk);
+            chunk = 0;
+            chunk_length = 0;
+        }
+    };
+
+    // Integer part
+    for (; next != last; ++next)
+    {
+        const unsigned digit = slow_path_digit_value(*next);
+        if (digit >= base)
+        {
+            break;
+        }
+
+        if (num_digits == 0 && digit == 0)
+        {
+            continue;
+        }
+
+        if (num_digits < max_digits)
+        {
+            add_digit(digit);
+        }
+        else
+        {
+            exponent += digit_exponent;
+            truncated_non_zero = truncated_non_zero || digit != 0;
+        }
+    }
+
+    // Fractional part
+    if (next != last && *next == '.')
+    {
+        for (++next; next != last; ++next)
+        {
+            const unsigned digit = slow_path_digit_value(*next);
+            if (digit >= base)
+            {
+                break;
+            }
+
+            if (num_digits == 0 && digit == 0)
+            {
+                exponent -= digit_exponent;
+                continue;
+            }
+
+            if (num_digits < max_digits)
+            {
+                add_digit(digit);
+                exponent -= digit_exponent;
+            }
+            else
+            {
+                truncated_non_zero = truncated_non_zero || digit != 0;
+            }
+        }
+    }
+
+    // Record that there were more non-zero digits with a trailing 1 in the next position
+    if (truncated_non_zero)
+    {
+        add_digit(1);
+        exponent -= digit_exponent;
+    }
+
+    if (chunk_length != 0)
+    {
+        significand.mul(slow_path_pow_base(hex, chunk_length));
+        significand.add(chunk);
+    }
+
+    // Exponent part, saturating well outside of the range of any type
+    const char exp_char = hex ? 'p' : 'e';
+    const char capital_exp_char = hex ? 'P' : 'E';
+    if (next != last && (*next == exp_char || *next == capital_exp_char))
+    {
+        auto exp_next = next + 1;
+        bool negative_exponent = false;
+        if (exp_next != last && (*exp_next == '-' || *exp_next == '+'))
+        {
+            negative_exponent = *exp_next == '-';
+            ++exp_next;
+        }
+
+        if (exp_next != last && *exp_next >= '0' && *exp_next <= '9')
+        {
+            std::int64_t explicit_exponent = 0;
+            for (; exp_next != last && *exp_next >= '0' && *exp_next <= '9'; ++exp_next)
+            {
+                if (explicit_exponent < 100000000)
+                {
+                    explicit_exponent = explicit_exponent * 10 + (*exp_next - '0');
+                }
+            }
+
+            exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+            next = exp_next;
+        }
+    }
+
+    if (num_digits == 0)
+    {
+        slow_path_zero(negative, value);
+        return {next, std::errc()};
+    }
+
+    // Values that are certainly out of range
+    if (!hex)
+    {
+        if (num_digits - 1 + exponent >= traits::max_decimal_exponent)
+        {
+            slow_path_infinity(negative, value);
+            return {next, std::errc::result_out_of_range};
+        }
+        if (num_digits + exponent <= traits::min_decimal_exponent)
+        {
+            slow_path_zero(negative, value);
+            return {next, std::errc::result_out_of_range};
+        }
+    }
+    else
+    {
+        const std::int64_t leading_bit = significand.bit_length() - 1 + exponent;
+        if (leading_bit > traits::max_exponent)
+        {
+            slow_path_infinity(negative, value);
+            return {next, std::errc::result_out_of_range};
+        }
+        if (leading_bit < traits::min_exponent - traits::digits - 1)
+        {
+            slow_path_zero(negative, value);
+            return {next, std::errc::result_out_of_range};
+        }
+    }
+
+    // value = significand / divisor * 2^binary_exponent
+    big_type divisor(1);
+    std::int64_t binary_exponent = exponent;
+    if (!hex)
+    {
+        if (exponent >= 0)
+        {
+            if (!significand.pow5(static_cast<std::uint32_t>(exponent)))
+            {
+                return {first, std::errc::not_supported};
+            }
+        }
+        else
+        {
+            if (!divisor.pow5(static_cast<std::uint32_t>(-exponent)))
+            {
+                return {first, std::errc::not_supported};
+            }
+        }
+    }
+
+    // Scale so that the quotient has digits + 2 or digits + 3 bits, and normalize the divisor for Algorithm D
+    const std::int64_t shift = traits::digits + 2 - (significand.bit_length() - divisor.bit_length());
+    binary_exponent -= shift;
+
+    bool scaled = true;
+    if (shift > 0)
+    {
+        scaled = significand.shl(static_cast<std::size_t>(shift));
+    }
+    else if (shift < 0)
+    {
+        scaled = divisor.shl(static_cast<std::size_t>(-shift));
+    }
+
+    const int normalize = divisor.ctlz();
+    if (normalize != 0)
+    {
+        scaled = scaled && significand.shl(static_cast<std::size_t>(normalize)) && divisor.shl(static_cast<std::size_t>(normalize));
+    }
+
+    std::uint64_t q_hi = 0;
+    std::uint64_t q_lo = 0;
+    if (!scaled || !slow_path_divide(significand.vec, divisor.vec, q_hi, q_lo))
+    {
+        return {first, std::errc::not_supported};
+    }
+
+    const bool sticky = !significand.vec.is_empty();
+    return slow_path_round(next, negative, q_hi, q_lo, sticky, binary_exponent, value);
+}
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_FROM_CHARS_SLOW_PATH_HPP
@@ -0,0 +1,295 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_IMPL_CPU_FEATURES_IPP
+#define BOOST_CHARCONV_DETAIL_IMPL_CPU_FEATURES_IPP
+
+// Compiled into the library by src/cpu_features.cpp, or included by <boost/charconv/detail/cpu_features.hpp> with BOOST_CHARCONV_HEADER_ONLY
+
+#include <boost/charconv/detail/cpu_features.hpp>
+#include <boost/core/bit.hpp>
+#include <atomic>
+#include <cstdint>
+
+#ifdef BOOST_CHARCONV_HAS_RUNTIME_DISPATCH
+
+#include <immintrin.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#  include <intrin.h>
+#  define BOOST_CHARCONV_TARGET_AVX2
+#  define BOOST_CHARCONV_TARGET_AVX512BW
+#  define BOOST_CHARCONV_TARGET_F16C
+#else
+#  include <cpuid.h>
+#  define BOOST_CHARCONV_TARGET_AVX2 __attribute__((target("avx2")))
+#  define BOOST_CHARCONV_TARGET_AVX512BW __attribute__((target("avx512f,avx512bw")))
+#  define BOOST_CHARCONV_TARGET_F16C __attribute__((target("avx,f16c")))
+#endif
+
+namespace boost { namespace charconv { namespace detail { namespace cpu {
+
+// eax, ebx, ecx and edx of cpuid with leaf and subleaf, or zeros for a leaf the CPU does not have
+inline void cpuid(std::uint32_t leaf, std::uint32_t subleaf, std::uint32_t (&regs)[4]) noexcept
+{
+    #if defined(_MSC_VER) && !defined(__clang__)
+
+    int info[4] {};
+    __cpuid(info, 0);
+    if (static_cast<std::uint32_t>(info[0]) >= leaf)
+    {
+        __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+    }
+    else
+    {
+        info[0] = info[1] = info[2] = info[3] = 0;
+    }
+
+    for (int i = 0; i < 4; ++i)
+    {
+        regs[i] = static_cast<std::uint32_t>(info[i]);
+    }
+
+    #else
+
+    if (!__get_cpuid_count(leaf, subleaf, &regs[0], &regs[1], &regs[2], &regs[3]))
+    {
+        regs[0] = regs[1] = regs[2] = regs[3] = 0;
+    }
+
+    #endif
+}
+
+// The register state that the operating system saves, which has to include the vector registers of a kernel
+inline std::uint64_t xgetbv0() noexcept
+{
+    #if defined(_MSC_VER) && !defined(__clang__)
+    return _xgetbv(0);
+    #else
+    std::uint32_t eax {};
+    std::uint32_t edx {};
+    __asm__ ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<std::uint64_t>(edx) << 32) | eax;
+    #endif
+}
+
+inline cpu_features detect() noexcept
+{
+    cpu_features features {};
+
+    std::uint32_t leaf1[4];
+    cpuid(1, 0, leaf1);
+
+    // OSXSAVE and AVX
+    const std::uint32_t osxsave_avx = (UINT32_C(1) << 27) | (UINT32_C(1) << 28);
+    if ((leaf1[2] & osxsave_avx) != osxsave_avx)
+    {
+        return features;
+    }
+
+    const std::uint64_t xcr0 = xgetbv0();
+    const bool os_ymm = (xcr0 & 0x6) == 0x6;      // XMM and YMM
+    const bool os_zmm = (xcr0 & 0xE6) == 0xE6;    // and the opmask and ZMM registers
+
+    std::uint32_t leaf7[4];
+    cpuid(7, 0, leaf7);
+
+    features.avx2 = os_ymm && (leaf7[1] & (UINT32_C(1) << 5)) != 0;
+    features.f16c = os_ymm && (leaf1[2] & (UINT32_C(1) << 29)) != 0;
+    features.avx512bw = os_zmm && (leaf7[1] & (UINT32_C(1) << 16)) != 0 && (leaf7[1] & (UINT32_C(1) << 30)) != 0;
+
+    return features;
+}
+
+// The kernels test a byte x as a digit with (x - '0') as unsigned <= 9, and as a hex letter with ((x | 0x20) - 'a') <= 5
+
+BOOST_CHARCONV_TARGET_AVX2 inline const char* skip_digits_avx2(const char* first, const char* last, bool hex) noexcept
+{
+    const __m256i zero_char = _mm256_set1_epi8('0');
+    const __m256i nine = _mm256_set1_epi8(9);
+    const __m256i case_bit = _mm256_set1_epi8(0x20);
+    const __m256i a_char = _mm256_set1_epi8('a');
+    const __m256i five = _mm256_set1_epi8(5);
+
+    while (last - first >= 32)
+    {
+        const __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        const __m256i offset = _mm256_sub_epi8(chars, zero_char);
+        __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, nine), offset);
+
+        if (hex)
+        {
+            const __m256i letter_offset = _mm256_sub_epi8(_mm256_or_si256(chars, case_bit), a_char);
+            is_digit = _mm256_or_si256(is_digit, _mm256_cmpeq_epi8(_mm256_min_epu8(letter_offset, five), letter_offset));
+        }
+
+        const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(is_digit));
+        if (mask != UINT32_MAX)
+        {
+            return first + boost::core::countr_zero(~mask);
+        }
+
+        first += 32;
+    }
+
+    return first;
+}
+
+BOOST_CHARCONV_TARGET_AVX512BW inline const char* skip_digits_avx512bw(const char* first, const char* last, bool hex) noexcept
+{
+    const __m512i zero_char = _mm512_set1_epi8('0');
+    const __m512i nine = _mm512_set1_epi8(9);
+    const __m512i case_bit = _mm512_set1_epi8(0x20);
+    const __m512i a_char = _mm512_set1_epi8('a');
+    const __m512i five = _mm512_set1_epi8(5);
+
+    while (last - first >= 64)
+    {
+        const __m512i chars = _mm512_loadu_si512(first);
+        std::uint64_t mask = _mm512_cmple_epu8_mask(_mm512_sub_epi8(chars, zero_char), nine);
+
+        if (hex)
+        {
+            mask |= _mm512_cmple_epu8_mask(_mm512_sub_epi8(_mm512_or_si512(chars, case_bit), a_char), five);
+        }
+
+        if (mask != UINT64_MAX)
+        {
+            return first + boost::core::countr_zero(~mask);
+        }
+
+        first += 64;
+    }
+
+    return first;
+}
+
+inline const char* skip_digits_none(const char* first, const char*, bool) noexcept
+{
+    return first;
+}
+
+using skip_digits_kernel = const char* (*)(const char*, const char*, bool);
+
+inline skip_digits_kernel select_skip_digits() noexcept
+{
+    const cpu_features features = host_cpu_features();
+
+    if (features.avx512bw)
+    {
+        return skip_digits_avx512bw;
+    }
+    if (features.avx2)
+    {
+        return skip_digits_avx2;
+    }
+
+    return skip_digits_none;
+}
+
+BOOST_CHARCONV_TARGET_F16C inline std::size_t widen_binary16_f16c(const std::uint16_t* bits, std::size_t n, float* out) noexcept
+{
+    const __m128i exponent_mask = _mm_set1_epi16(0x7C00);
+
+    std::size_t i = 0;
+    for (; n - i >= 8; i += 8)
+    {
+        const __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bits + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(halves, exponent_mask), exponent_mask)) != 0)
+        {
+            break;
+        }
+
+        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(halves));
+    }
+
+    return i;
+}
+
+inline std::size_t widen_binary16_none(const std::uint16_t*, std::size_t, float*) noexcept
+{
+    return 0;
+}
+
+using widen_binary16_kernel = std::size_t (*)(const std::uint16_t*, std::size_t, float*);
+
+inline widen_binary16_kernel select_widen_binary16() noexcept
+{
+    return host_cpu_features().f16c ? widen_binary16_f16c : widen_binary16_none;
+}
+
+}}}} // Namespaces
+
+// The results are cached in atomics rather than in local statics, whose guard takes a global lock while the first
+// thread initializes them. Threads that race on the first call detect the same features and store the same values
+
+BOOST_CHARCONV_HEADER_ONLY_INLINE boost::charconv::detail::cpu_features boost::charconv::detail::host_cpu_features() noexcept
+{
+    constexpr unsigned detected = 1U;
+    constexpr unsigned has_avx2 = 2U;
+    constexpr unsigned has_avx512bw = 4U;
+    constexpr unsigned has_f16c = 8U;
+
+    static std::atomic<unsigned> cached {0U};
+    auto bits = cached.load(std::memory_order_relaxed);
+    if (BOOST_UNLIKELY(bits == 0U))
+    {
+        const auto features = cpu::detect();
+        bits = detected | (features.avx2 ? has_avx2 : 0U) | (features.avx512bw ? has_avx512bw : 0U) | (features.f16c ? has_f16c : 0U);
+        cached.store(bits, std::memory_order_relaxed);
+    }
+
+    return cpu_features {(bits & has_avx2) != 0U, (bits & has_avx512bw) != 0U, (bits & has_f16c) != 0U};
+}
+
+BOOST_CHARCONV_HEADER_ONLY_INLINE const char* boost::charconv::detail::skip_long_digit_run(const char* first, const char* last, bool hex) noexcept
+{
+    static std::atomic<cpu::skip_digits_kernel> cached {nullptr};
+    auto kernel = cached.load(std::memory_order_relaxed);
+    if (BOOST_UNLIKELY(kernel == nullptr))
+    {
+        kernel = cpu::select_skip_digits();
+        cached.store(kernel, std::memory_order_relaxed);
+    }
+
+    return kernel(first, last, hex);
+}
+
+BOOST_CHARCONV_HEADER_ONLY_INLINE std::size_t boost::charconv::detail::widen_binary16_blocks(const std::uint16_t* bits, std::size_t n, float* out) noexcept
+{
+    static std::atomic<cpu::widen_binary16_kernel> cached {nullptr};
+    auto kernel = cached.load(std::memory_order_relaxed);
+    if (BOOST_UNLIKELY(kernel == nullptr))
+    {
+        kernel = cpu::select_widen_binary16();
+        cached.store(kernel, std::memory_order_relaxed);
+    }
+
+    return kernel(bits, n, out);
+}
+
+#undef BOOST_CHARCONV_TARGET_AVX2
+#undef BOOST_CHARCONV_TARGET_AVX512BW
+#undef BOOST_CHARCONV_TARGET_F16C
+
+#else
+
+BOOST_CHARCONV_HEADER_ONLY_INLINE boost::charconv::detail::cpu_features boost::charconv::detail::host_cpu_features() noexcept
+{
+    return cpu_features {};
+}
+
+BOOST_CHARCONV_HEADER_ONLY_INLINE const char* boost::charconv::detail::skip_long_digit_run(const char* first, const char*, bool) noexcept
+{
+    return first;
+}
+
+BOOST_CHARCONV_HEADER_ONLY_INLINE std::size_t boost::charconv::detail::widen_binary16_blocks(const std::uint16_t*, std::size_t, float*) noexcept
+{
+    return 0;
+}
+
+#endif // BOOST_CHARCONV_HAS_RUNTIME_DISPATCH
+
+#endif // BOOST_CHARCONV_DETAIL_IMPL_CPU_FEATURES_IPP
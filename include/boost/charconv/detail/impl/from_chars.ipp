@@ -0,0 +1,1397 @@
+// Copyright 2022 Peter Dimov
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_IMPL_FROM_CHARS_IPP
+#define BOOST_CHARCONV_DETAIL_IMPL_FROM_CHARS_IPP
+
+// Definitions of the floating point from_chars overloads.
+// Compiled into the library by src/from_chars.cpp, or included by <boost/charconv/from_chars.hpp> with BOOST_CHARCONV_HEADER_ONLY
+
+#include <boost/charconv/detail/from_chars_float_impl.hpp>
+#include <boost/charconv/detail/fast_float/fast_float.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/detail/bit_layouts.hpp>
+#include <boost/charconv/detail/generate_nan.hpp>
+#include <boost/charconv/detail/from_chars_half.hpp>
+#include <boost/charconv/detail/dragonbox/dragonbox.hpp>
+#include <system_error>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <limits>
+
+#if BOOST_CHARCONV_LDBL_BITS > 64
+#  include <boost/charconv/detail/compute_float80.hpp>
+#  include <boost/charconv/detail/emulated128.hpp>
+#endif
+
+#if defined(__GNUC__) && __GNUC__ < 5
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+#endif
+
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char* first, const char* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    if (fmt != boost::charconv::chars_format::hex)
+    {
+        return boost::charconv::detail::fast_float::from_chars(first, last, value, fmt);
+    }
+    return boost::charconv::detail::from_chars_float_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char* first, const char* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    if (fmt != boost::charconv::chars_format::hex)
+    {
+        return boost::charconv::detail::fast_float::from_chars(first, last, value, fmt);
+    }
+    return boost::charconv::detail::from_chars_float_impl(first, last, value, fmt);
+}
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char* first, const char* last, __float128& value, boost::charconv::chars_format fmt) noexcept
+{
+    if (fmt == boost::charconv::chars_format::hex && !boost::charconv::detail::is_non_finite_start(first, last))
+    {
+        return boost::charconv::detail::from_chars_hex_float(first, last, value);
+    }
+
+    bool sign {};
+    std::int64_t exponent {};
+
+    #if defined(BOOST_CHARCONV_HAS_INT128) && ((defined(__clang_major__) && __clang_major__ > 12 ) || \
+        (defined(BOOST_GCC) && BOOST_GCC > 100000))
+
+    boost::uint128_type significand {};
+
+    #else
+    boost::charconv::detail::uint128 significand {};
+    #endif
+
+    auto r = boost::charconv::detail::parser(first, last, sign, significand, exponent, fmt);
+    if (r.ec == std::errc::value_too_large)
+    {
+        r.ec = std::errc();
+
+        #if BOOST_CHARCONV_HAS_BUILTIN(__builtin_inf)
+        value = sign ? -static_cast<__float128>(__builtin_inf()) : static_cast<__float128>(__builtin_inf());
+        #else // Conversion from HUGE_VALL should work
+        value = sign ? -static_cast<__float128>(HUGE_VALL) : static_cast<__float128>(HUGE_VALL);
+        #endif
+
+        return r;
+    }
+    else if (r.ec == std::errc::not_supported)
+    {
+        r.ec = std::errc();
+        if (significand == 0)
+        {
+            #if BOOST_CHARCONV_HAS_BUILTIN(__builtin_nanq)
+            value = sign ? -static_cast<__float128>(__builtin_nanq("")) : static_cast<__float128>(__builtin_nanq(""));
+            #elif BOOST_CHARCONV_HAS_BUILTIN(__nanq)
+            value = sign ? -static_cast<__float128>(__nanq("")) : static_cast<__float128>(__nanq(""));
+            #else
+            value = boost::charconv::detail::nanq();
+            value = sign ? -value : value;
+            #endif
+        }
+        else
+        {
+            #if BOOST_CHARCONV_HAS_BUILTIN(__builtin_nansq)
+            value = sign ? -static_cast<__float128>(__builtin_nansq("")) : static_cast<__float128>(__builtin_nansq(""));
+            #elif BOOST_CHARCONV_HAS_BUILTIN(__nansq)
+            value = sign ? -static_cast<__float128>(__nansq("")) : static_cast<__float128>(__nansq(""));
+            #else
+            value = boost::charconv::detail::nans();
+            value = sign ? -value : value;
+            #endif
+        }
+
+        return r;
+    }
+    else if (r.ec != std::errc())
+    {
+        return r;
+    }
+    else if (significand == 0)
+    {
+        value = sign ? -0.0Q : 0.0Q;
+        return r;
+    }
+
+    std::errc success {};
+    auto return_val = boost::charconv::detail::compute_float128(exponent, significand, sign, success);
+    r.ec = static_cast<std::errc>(success);
+
+    if (r.ec == std::errc() || r.ec == std::errc::result_out_of_range)
+    {
+        value = return_val;
+    }
+    else if (r.ec == std::errc::not_supported)
+    {
+        // Correctly rounded fallback for everything the fast path can not represent exactly
+        r = boost::charconv::detail::from_chars_slow_path(first, r.ptr, value, fmt);
+    }
+
+    return r;
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char* first, const char* last, std::float16_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    static_assert(sizeof(std::float16_t) == sizeof(std::uint16_t), "std::float16_t must be IEEE 754 binary16");
+
+    boost::charconv::detail::binary16_bits bits;
+    const auto r = boost::charconv::detail::from_chars_half(first, last, bits, fmt);
+    if (r.ec == std::errc() || r.ec == std::errc::result_out_of_range)
+    {
+        std::memcpy(&value, &bits.bits, sizeof(std::float16_t));
+    }
+    return r;
+}
+#endif
+
+#if defined(BOOST_CHARCONV_HAS_FLOAT32) || defined(BOOST_CHARCONV_HAS_FLOAT64)
+namespace boost { namespace charconv { namespace detail {
+
+// std::float32_t and std::float64_t have the layout of float and double, so the engine for those parses the value
+// and its bits are copied out once. Both parsers only store a value on success or result_out_of_range, and the
+// strict overloads only keep it on success, which replaces the copy in of the old value and the temporary of
+// from_chars_strict_impl
+template <bool Strict, typename Float, typename T>
+inline boost::charconv::from_chars_result from_chars_same_layout(const char* first, const char* last, T& value, boost::charconv::chars_format fmt) noexcept
+{
+    static_assert(sizeof(Float) == sizeof(T), "The layout of the standard type has to be the same as the extended type");
+
+    Float f;
+    const auto r = fmt != boost::charconv::chars_format::hex ? boost::charconv::detail::fast_float::from_chars(first, last, f, fmt) :
+                                                               boost::charconv::detail::from_chars_float_impl(first, last, f, fmt);
+
+    if (r.ec == std::errc() || (!Strict && r.ec == std::errc::result_out_of_range))
+    {
+        std::memcpy(&value, &f, sizeof(T));
+    }
+
+    return r;
+}
+
+}}} // Namespaces
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT32
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char* first, const char* last, std::float32_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    static_assert(std::numeric_limits<std::float32_t>::digits == FLT_MANT_DIG &&
+                  std::numeric_limits<std::float32_t>::min_exponent == FLT_MIN_EXP,
+                  "float and std::float32_t are not the same layout like they should be");
+
+    return boost::charconv::detail::from_chars_same_layout<false, float>(first, last, value, fmt);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT64
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char* first, const char* last, std::float64_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    static_assert(std::numeric_limits<std::float64_t>::digits == DBL_MANT_DIG &&
+                  std::numeric_limits<std::float64_t>::min_exponent == DBL_MIN_EXP,
+                  "double and std::float64_t are not the same layout like they should be");
+
+    return boost::charconv::detail::from_chars_same_layout<false, double>(first, last, value, fmt);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char* first, const char* last, std::bfloat16_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    static_assert(sizeof(std::bfloat16_t) == sizeof(std::uint16_t), "std::bfloat16_t must be bfloat16");
+
+    boost::charconv::detail::bfloat16_bits bits;
+    const auto r = boost::charconv::detail::from_chars_half(first, last, bits, fmt);
+    if (r.ec == std::errc() || r.ec == std::errc::result_out_of_range)
+    {
+        std::memcpy(&value, &bits.bits, sizeof(std::bfloat16_t));
+    }
+    return r;
+}
+#endif
+
+#if BOOST_CHARCONV_LDBL_BITS == 64 || defined(BOOST_MSVC)
+
+// Since long double is just a double we use the double implementation and cast into value
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char* first, const char* last, long double& value, boost::charconv::chars_format fmt) noexcept
+{
+    static_assert(sizeof(double) == sizeof(long double), "64 bit long double detected, but the size is incorrect");
+    
+    double d;
+    std::memcpy(&d, &value, sizeof(double));
+    const auto r = boost::charconv::from_chars_erange(first, last, d, fmt);
+    std::memcpy(&value, &d, sizeof(long double));
+
+    return r;
+}
+
+#else
+
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char* first, const char* last, long double& value, boost::charconv::chars_format fmt) noexcept
+{
+    static_assert(std::numeric_limits<long double>::is_iec559, "Long double must be IEEE 754 compliant");
+
+    if (fmt == boost::charconv::chars_format::hex && !boost::charconv::detail::is_non_finite_start(first, last))
+    {
+        return boost::charconv::detail::from_chars_hex_float(first, last, value);
+    }
+
+    bool sign {};
+    std::int64_t exponent {};
+
+    #if defined(BOOST_CHARCONV_HAS_INT128) && ((defined(__clang_major__) && __clang_major__ > 12 ) || \
+        (defined(BOOST_GCC) && BOOST_GCC > 100000))
+
+    boost::uint128_type significand {};
+
+    #else
+    boost::charconv::detail::uint128 significand {};
+    #endif
+
+    auto r = boost::charconv::detail::parser(first, last, sign, significand, exponent, fmt);
+    if (r.ec == std::errc::value_too_large)
+    {
+        r.ec = std::errc();
+        value = sign ? -std::numeric_limits<long double>::infinity() : std::numeric_limits<long double>::infinity();
+        return r;
+    }
+    else if (r.ec == std::errc::not_supported)
+    {
+        r.ec = std::errc();
+        if (significand == 0)
+        {
+            value = sign ? -std::numeric_limits<long double>::quiet_NaN() : std::numeric_limits<long double>::quiet_NaN();
+        }
+        else
+        {
+            value = sign ? -std::numeric_limits<long double>::signaling_NaN() : std::numeric_limits<long double>::signaling_NaN();
+        }
+
+        return r;
+    }
+    else if (r.ec != std::errc())
+    {
+        return r;
+    }
+    else if (significand == 0)
+    {
+        value = sign ? -0.0L : 0.0L;
+        return r;
+    }
+
+    std::errc success {};
+    auto return_val = boost::charconv::detail::compute_float80<long double>(exponent, significand, sign, success);
+    r.ec = success;
+
+    if (r.ec == std::errc() || r.ec == std::errc::result_out_of_range)
+    {
+        value = return_val;
+    }
+    else if (r.ec == std::errc::not_supported)
+    {
+        // Correctly rounded fallback for everything the fast path can not represent exactly
+        r = boost::charconv::detail::from_chars_slow_path(first, r.ptr, value, fmt);
+    }
+
+    return r;
+}
+
+#if defined(BOOST_CHARCONV_HAS_STDFLOAT128) && defined(BOOST_CHARCONV_HAS_FLOAT128)
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char* first, const char* last, std::float128_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    static_assert(sizeof(__float128) == sizeof(std::float128_t));
+
+    __float128 q;
+    std::memcpy(&q, &value, sizeof(__float128));
+    const auto r = boost::charconv::from_chars_erange(first, last, q, fmt);
+    std::memcpy(&value, &q, sizeof(std::float128_t));
+
+    return r;
+}
+#endif
+
+#endif // long double implementations
+
+// String view overloads
+
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(boost::core::string_view sv, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::from_chars_erange(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(boost::core::string_view sv, double & value, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::from_chars_erange(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(boost::core::string_view sv, long double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::from_chars_erange(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(boost::core::string_view sv, __float128& value, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::from_chars_erange(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+#endif
+
+// <stdfloat> types
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(boost::core::string_view sv, std::float16_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::from_chars_erange(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+#endif
+#ifdef BOOST_CHARCONV_HAS_FLOAT32
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(boost::core::string_view sv, std::float32_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::from_chars_same_layout<false, float>(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+#endif
+#ifdef BOOST_CHARCONV_HAS_FLOAT64
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(boost::core::string_view sv, std::float64_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::from_chars_same_layout<false, double>(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+#endif
+#if defined(BOOST_CHARCONV_HAS_STDFLOAT128) && defined(BOOST_CHARCONV_HAS_FLOAT128)
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(boost::core::string_view sv, std::float128_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::from_chars_erange(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+#endif
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+boost::charconv::from_chars_result boost::charconv::from_chars_erange(boost::core::string_view sv, std::bfloat16_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::from_chars_erange(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+#endif
+
+namespace boost { namespace charconv { namespace detail {
+
+// Adheres to the STL strictly as opposed to fixing the ERANGE problem (which pre-review was the library default behavior)
+template <typename T>
+boost::charconv::from_chars_result from_chars_strict_impl(const char *first, const char *last, T &value, boost::charconv::chars_format fmt) noexcept
+{
+    T temp_value;
+    const auto r = boost::charconv::from_chars_erange(first, last, temp_value, fmt);
+
+    if (r)
+    {
+        value = temp_value;
+    }
+
+    return r;
+}
+
+}}} // Namespaces
+
+boost::charconv::from_chars_result boost::charconv::from_chars(const char* first, const char* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_strict_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars(const char* first, const char* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_strict_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars(const char* first, const char* last, long double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_strict_impl(first, last, value, fmt);
+}
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+boost::charconv::from_chars_result boost::charconv::from_chars(const char* first, const char* last, __float128& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_strict_impl(first, last, value, fmt);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+boost::charconv::from_chars_result boost::charconv::from_chars(const char* first, const char* last, std::float16_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_strict_impl(first, last, value, fmt);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT32
+boost::charconv::from_chars_result boost::charconv::from_chars(const char* first, const char* last, std::float32_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_same_layout<true, float>(first, last, value, fmt);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT64
+boost::charconv::from_chars_result boost::charconv::from_chars(const char* first, const char* last, std::float64_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_same_layout<true, double>(first, last, value, fmt);
+}
+#endif
+
+#if defined(BOOST_CHARCONV_HAS_STDFLOAT128) && defined(BOOST_CHARCONV_HAS_FLOAT128)
+boost::charconv::from_chars_result boost::charconv::from_chars(const char* first, const char* last, std::float128_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_strict_impl(first, last, value, fmt);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+boost::charconv::from_chars_result boost::charconv::from_chars(const char* first, const char* last, std::bfloat16_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_strict_impl(first, last, value, fmt);
+}
+#endif
+
+boost::charconv::from_chars_result boost::charconv::from_chars(boost::core::string_view sv, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_strict_impl(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars(boost::core::string_view sv, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_strict_impl(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars(boost::core::string_view sv, long double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_strict_impl(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+boost::charconv::from_chars_result boost::charconv::from_chars(boost::core::string_view sv, __float128& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_strict_impl(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+boost::charconv::from_chars_result boost::charconv::from_chars(boost::core::string_view sv, std::float16_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_strict_impl(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT32
+boost::charconv::from_chars_result boost::charconv::from_chars(boost::core::string_view sv, std::float32_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_same_layout<true, float>(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT64
+boost::charconv::from_chars_result boost::charconv::from_chars(boost::core::string_view sv, std::float64_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_same_layout<true, double>(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+#endif
+
+#if defined(BOOST_CHARCONV_HAS_STDFLOAT128) && defined(BOOST_CHARCONV_HAS_FLOAT128)
+boost::charconv::from_chars_result boost::charconv::from_chars(boost::core::string_view sv, std::float128_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_strict_impl(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+boost::charconv::from_chars_result boost::charconv::from_chars(boost::core::string_view sv, std::bfloat16_t& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_strict_impl(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+#endif
+
+namespace boost { namespace charconv { namespace detail {
+
+// The hexadecimal digits are read directly from the wide characters. Only infinity and NaN go to the generic parser, which
+// reads at most "-nan(s", so a few leading characters are narrowed for it
+template <typename T, typename UC>
+boost::charconv::from_chars_result_t<UC> from_chars_wide_hex(const UC* first, const UC* last, T& value) noexcept
+{
+    T temp_value;
+    if (!is_non_finite_start(first, last))
+    {
+        const auto r = from_chars_hex_float(first, last, temp_value);
+        if (r)
+        {
+            value = temp_value;
+        }
+
+        return r;
+    }
+
+    char buffer[8] {};
+    std::size_t length = 0;
+    while (length < sizeof(buffer) && first + length != last && first[length] >= UC(0) && first[length] <= UC(127))
+    {
+        buffer[length] = static_cast<char>(first[length]);
+        ++length;
+    }
+
+    const auto r = boost::charconv::from_chars(buffer, buffer + length, temp_value, boost::charconv::chars_format::hex);
+    if (r)
+    {
+        value = temp_value;
+    }
+
+    return {first + (r.ptr - buffer), r.ec};
+}
+
+template <typename T, typename UC>
+boost::charconv::from_chars_result_t<UC> from_chars_wide_impl(const UC* first, const UC* last, T& value, boost::charconv::chars_format fmt) noexcept
+{
+    if (BOOST_UNLIKELY(fmt == boost::charconv::chars_format::hex))
+    {
+        return from_chars_wide_hex(first, last, value);
+    }
+
+    T temp_value;
+    const auto r = boost::charconv::detail::fast_float::from_chars(first, last, temp_value, fmt);
+
+    if (r)
+    {
+        value = temp_value;
+    }
+
+    return r;
+}
+
+}}} // Namespaces
+
+boost::charconv::from_chars_result_t<wchar_t> boost::charconv::from_chars(const wchar_t* first, const wchar_t* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_wide_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<wchar_t> boost::charconv::from_chars(const wchar_t* first, const wchar_t* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_wide_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<char16_t> boost::charconv::from_chars(const char16_t* first, const char16_t* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_wide_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<char16_t> boost::charconv::from_chars(const char16_t* first, const char16_t* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_wide_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<char32_t> boost::charconv::from_chars(const char32_t* first, const char32_t* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_wide_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<char32_t> boost::charconv::from_chars(const char32_t* first, const char32_t* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_wide_impl(first, last, value, fmt);
+}
+
+namespace boost { namespace charconv { namespace detail {
+
+template <typename T>
+boost::charconv::from_chars_result from_chars_options_impl(const char* first, const char* last, T& value,
+                                                           boost::charconv::chars_format fmt, boost::charconv::chars_format_options options) noexcept
+{
+    if (!boost::charconv::detail::is_valid_format_options(options))
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    T temp_value;
+    boost::charconv::from_chars_result r;
+    if (fmt != boost::charconv::chars_format::hex)
+    {
+        const boost::charconv::detail::fast_float::parse_options_t<char> parse_options {fmt, options.decimal_point, false, options.exponent,
+                                                                                               options.group_separator};
+        r = boost::charconv::detail::fast_float::from_chars_advanced(first, last, temp_value, parse_options);
+    }
+    else if (!boost::charconv::detail::is_non_finite_start(first, last))
+    {
+        r = boost::charconv::detail::from_chars_hex_float(first, last, temp_value, options.decimal_point);
+    }
+    else
+    {
+        r = boost::charconv::detail::from_chars_float_impl(first, last, temp_value, fmt);
+    }
+
+    if (r)
+    {
+        value = temp_value;
+    }
+
+    return r;
+}
+
+}}} // Namespaces
+
+boost::charconv::from_chars_result boost::charconv::from_chars(const char* first, const char* last, float& value,
+                                                               boost::charconv::chars_format fmt, boost::charconv::chars_format_options options) noexcept
+{
+    return detail::from_chars_options_impl(first, last, value, fmt, options);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars(const char* first, const char* last, double& value,
+                                                               boost::charconv::chars_format fmt, boost::charconv::chars_format_options options) noexcept
+{
+    return detail::from_chars_options_impl(first, last, value, fmt, options);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars(boost::core::string_view sv, float& value,
+                                                               boost::charconv::chars_format fmt, boost::charconv::chars_format_options options) noexcept
+{
+    return detail::from_chars_options_impl(sv.data(), sv.data() + sv.size(), value, fmt, options);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars(boost::core::string_view sv, double& value,
+                                                               boost::charconv::chars_format fmt, boost::charconv::chars_format_options options) noexcept
+{
+    return detail::from_chars_options_impl(sv.data(), sv.data() + sv.size(), value, fmt, options);
+}
+
+namespace boost { namespace charconv { namespace detail {
+
+template <typename T>
+boost::charconv::from_chars_result from_chars_rounding_impl(const char* first, const char* last, T& value,
+                                                            boost::charconv::chars_format fmt, boost::charconv::rounding_mode mode) noexcept
+{
+    T temp_value;
+    boost::charconv::from_chars_result r;
+    if (fmt != boost::charconv::chars_format::hex)
+    {
+        const boost::charconv::detail::fast_float::parse_options_t<char> parse_options {fmt, '.', false, 'e', '\0', mode};
+        r = boost::charconv::detail::fast_float::from_chars_advanced(first, last, temp_value, parse_options);
+    }
+    else if (!boost::charconv::detail::is_non_finite_start(first, last))
+    {
+        r = boost::charconv::detail::from_chars_hex_float(first, last, temp_value, '.', mode);
+    }
+    else
+    {
+        r = boost::charconv::detail::from_chars_float_impl(first, last, temp_value, fmt);
+    }
+
+    if (r)
+    {
+        value = temp_value;
+    }
+
+    return r;
+}
+
+}}} // Namespaces
+
+boost::charconv::from_chars_result boost::charconv::from_chars(const char* first, const char* last, float& value,
+                                                               boost::charconv::chars_format fmt, boost::charconv::rounding_mode mode) noexcept
+{
+    return detail::from_chars_rounding_impl(first, last, value, fmt, mode);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars(const char* first, const char* last, double& value,
+                                                               boost::charconv::chars_format fmt, boost::charconv::rounding_mode mode) noexcept
+{
+    return detail::from_chars_rounding_impl(first, last, value, fmt, mode);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars(boost::core::string_view sv, float& value,
+                                                               boost::charconv::chars_format fmt, boost::charconv::rounding_mode mode) noexcept
+{
+    return detail::from_chars_rounding_impl(sv.data(), sv.data() + sv.size(), value, fmt, mode);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars(boost::core::string_view sv, double& value,
+                                                               boost::charconv::chars_format fmt, boost::charconv::rounding_mode mode) noexcept
+{
+    return detail::from_chars_rounding_impl(sv.data(), sv.data() + sv.size(), value, fmt, mode);
+}
+
+namespace boost { namespace charconv { namespace detail {
+
+template <typename T>
+boost::charconv::from_chars_result json_from_chars_impl(const char* first, const char* last, T& value) noexcept
+{
+    // The grammar is checked in the same pass over the digits that converts them
+    constexpr boost::charconv::detail::fast_float::parse_options_t<char> options {boost::charconv::chars_format::general, '.', true};
+
+    T temp_value;
+    const auto r = boost::charconv::detail::fast_float::from_chars_advanced(first, last, temp_value, options);
+
+    if (r)
+    {
+        value = temp_value;
+    }
+
+    return r;
+}
+
+}}} // Namespaces
+
+boost::charconv::from_chars_result boost::charconv::json_from_chars(const char* first, const char* last, float& value) noexcept
+{
+    return detail::json_from_chars_impl(first, last, value);
+}
+
+boost::charconv::from_chars_result boost::charconv::json_from_chars(const char* first, const char* last, double& value) noexcept
+{
+    return detail::json_from_chars_impl(first, last, value);
+}
+
+boost::charconv::from_chars_result boost::charconv::json_from_chars(boost::core::string_view sv, float& value) noexcept
+{
+    return detail::json_from_chars_impl(sv.data(), sv.data() + sv.size(), value);
+}
+
+boost::charconv::from_chars_result boost::charconv::json_from_chars(boost::core::string_view sv, double& value) noexcept
+{
+    return detail::json_from_chars_impl(sv.data(), sv.data() + sv.size(), value);
+}
+
+namespace boost { namespace charconv { namespace detail {
+
+template <typename T>
+boost::charconv::from_chars_result from_chars_unchecked_impl(const char* first, const char* last, T& value) noexcept
+{
+    T temp_value;
+    const auto r = boost::charconv::detail::fast_float::from_chars_unchecked(first, last, temp_value);
+
+    if (r)
+    {
+        value = temp_value;
+    }
+
+    return r;
+}
+
+}}} // Namespaces
+
+boost::charconv::from_chars_result boost::charconv::from_chars_unchecked(const char* first, const char* last, float& value) noexcept
+{
+    return detail::from_chars_unchecked_impl(first, last, value);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_unchecked(const char* first, const char* last, double& value) noexcept
+{
+    return detail::from_chars_unchecked_impl(first, last, value);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_unchecked(boost::core::string_view sv, float& value) noexcept
+{
+    return detail::from_chars_unchecked_impl(sv.data(), sv.data() + sv.size(), value);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_unchecked(boost::core::string_view sv, double& value) noexcept
+{
+    return detail::from_chars_unchecked_impl(sv.data(), sv.data() + sv.size(), value);
+}
+
+namespace boost { namespace charconv { namespace detail {
+
+template <typename T>
+boost::charconv::from_chars_result from_chars_faithful_impl(const char* first, const char* last, T& value, boost::charconv::chars_format fmt) noexcept
+{
+    T temp_value;
+    boost::charconv::from_chars_result r;
+    if (fmt != boost::charconv::chars_format::hex)
+    {
+        const boost::charconv::detail::fast_float::parse_options_t<char> parse_options {fmt, '.', false, 'e', '\0',
+                                                                                               boost::charconv::rounding_mode::to_nearest, true};
+        r = boost::charconv::detail::fast_float::from_chars_advanced(first, last, temp_value, parse_options);
+    }
+    else
+    {
+        // Hexadecimal digits are shifted into the significand and rounded once, which is already bounded
+        r = boost::charconv::detail::from_chars_float_impl(first, last, temp_value, fmt);
+    }
+
+    if (r)
+    {
+        value = temp_value;
+    }
+
+    return r;
+}
+
+}}} // Namespaces
+
+boost::charconv::from_chars_result boost::charconv::from_chars_faithful(const char* first, const char* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_faithful_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_faithful(const char* first, const char* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_faithful_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_faithful(boost::core::string_view sv, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_faithful_impl(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_faithful(boost::core::string_view sv, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_faithful_impl(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+
+namespace boost { namespace charconv { namespace detail {
+
+// fast_float only reads digits when Eisel-Lemire can not decide, so the significand is written out for that case and the rest of
+// the parsed number string is filled in the way the parser would for "<significand>e<exponent>". A twentieth digit is dropped from
+// the mantissa and marked as too many digits, like the parser does for long inputs
+template <typename T>
+std::errc from_decimal_impl(std::uint64_t significand, std::int32_t exponent, bool is_negative, T& value) noexcept
+{
+    if (significand == 0)
+    {
+        value = is_negative ? -T(0) : T(0);
+        return std::errc();
+    }
+
+    char digits[20];
+    char* digits_first = digits + sizeof(digits);
+    for (std::uint64_t rest = significand; rest != 0; rest /= 10U)
+    {
+        *--digits_first = static_cast<char>('0' + static_cast<int>(rest % 10U));
+    }
+    const auto num_digits = static_cast<std::size_t>(digits + sizeof(digits) - digits_first);
+
+    boost::charconv::detail::fast_float::parsed_number_string pns;
+    pns.valid = true;
+    pns.negative = is_negative;
+    pns.lastmatch = digits + sizeof(digits);
+    pns.integer = boost::charconv::detail::fast_float::span<const char>(digits_first, num_digits);
+    pns.mantissa = significand;
+    pns.exponent = exponent;
+
+    constexpr std::uint64_t max_mantissa = UINT64_C(10000000000000000000);
+    if (significand >= max_mantissa)
+    {
+        pns.too_many_digits = true;
+        pns.mantissa = significand / 10U;
+        ++pns.exponent;
+    }
+
+    T temp_value;
+    const auto r = boost::charconv::detail::fast_float::from_number_string(pns, temp_value);
+    if (r.ec == std::errc())
+    {
+        value = temp_value;
+    }
+
+    return r.ec;
+}
+
+}}} // Namespaces
+
+std::errc boost::charconv::from_decimal(std::uint64_t significand, std::int32_t exponent, bool is_negative, float& value) noexcept
+{
+    return detail::from_decimal_impl(significand, exponent, is_negative, value);
+}
+
+std::errc boost::charconv::from_decimal(std::uint64_t significand, std::int32_t exponent, bool is_negative, double& value) noexcept
+{
+    return detail::from_decimal_impl(significand, exponent, is_negative, value);
+}
+
+namespace boost { namespace charconv { namespace detail {
+
+template <typename T>
+boost::charconv::from_chars_many_result from_chars_many_impl(const char* first, const char* last, T* out, std::size_t n,
+                                                             char delimiter, boost::charconv::chars_format fmt) noexcept
+{
+    // Options are set up once for the whole buffer rather than once per field
+    const boost::charconv::detail::fast_float::parse_options_t<char> options {fmt};
+    const bool is_hex = fmt == boost::charconv::chars_format::hex;
+
+    boost::charconv::from_chars_many_result result {first, std::errc(), 0};
+
+    while (result.count < n && first != last)
+    {
+        T temp_value;
+        const auto r = BOOST_LIKELY(!is_hex) ? boost::charconv::detail::fast_float::from_chars_advanced(first, last, temp_value, options) :
+                                               boost::charconv::detail::from_chars_float_impl(first, last, temp_value, fmt);
+        if (BOOST_UNLIKELY(!r))
+        {
+            result.ec = r.ec;
+            return result;
+        }
+
+        out[result.count++] = temp_value;
+        first = r.ptr;
+        if (first != last)
+        {
+            if (BOOST_UNLIKELY(*first != delimiter))
+            {
+                result.ptr = first;
+                result.ec = std::errc::invalid_argument;
+                return result;
+            }
+            ++first;
+        }
+        result.ptr = first;
+    }
+
+    return result;
+}
+
+}}} // Namespaces
+
+boost::charconv::from_chars_many_result boost::charconv::from_chars_many(const char* first, const char* last, float* out, std::size_t n, char delimiter, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_many_impl(first, last, out, n, delimiter, fmt);
+}
+
+boost::charconv::from_chars_many_result boost::charconv::from_chars_many(const char* first, const char* last, double* out, std::size_t n, char delimiter, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_many_impl(first, last, out, n, delimiter, fmt);
+}
+
+boost::charconv::from_chars_many_result boost::charconv::from_chars_many(boost::core::string_view sv, float* out, std::size_t n, char delimiter, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_many_impl(sv.data(), sv.data() + sv.size(), out, n, delimiter, fmt);
+}
+
+boost::charconv::from_chars_many_result boost::charconv::from_chars_many(boost::core::string_view sv, double* out, std::size_t n, char delimiter, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_many_impl(sv.data(), sv.data() + sv.size(), out, n, delimiter, fmt);
+}
+
+#if defined(BOOST_CHARCONV_HAS_FLOAT16) || defined(BOOST_CHARCONV_HAS_BRAINFLOAT16)
+
+namespace boost { namespace charconv { namespace detail {
+
+// The same loop as from_chars_many_impl, with every value rounded straight to its bit pattern by from_chars_half
+template <typename T, typename Half>
+boost::charconv::from_chars_many_result from_chars_many_half(const char* first, const char* last, Half* out, std::size_t n,
+                                                             char delimiter, boost::charconv::chars_format fmt) noexcept
+{
+    static_assert(sizeof(Half) == sizeof(std::uint16_t), "The 16-bit types have to be their bit patterns");
+
+    boost::charconv::from_chars_many_result result {first, std::errc(), 0};
+
+    while (result.count < n && first != last)
+    {
+        T bits;
+        const auto r = boost::charconv::detail::from_chars_half(first, last, bits, fmt);
+        if (BOOST_UNLIKELY(!r))
+        {
+            result.ec = r.ec;
+            return result;
+        }
+
+        std::memcpy(out + result.count++, &bits.bits, sizeof(Half));
+        first = r.ptr;
+        if (first != last)
+        {
+            if (BOOST_UNLIKELY(*first != delimiter))
+            {
+                result.ptr = first;
+                result.ec = std::errc::invalid_argument;
+                return result;
+            }
+            ++first;
+        }
+        result.ptr = first;
+    }
+
+    return result;
+}
+
+}}} // Namespaces
+
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+boost::charconv::from_chars_many_result boost::charconv::from_chars_many(const char* first, const char* last, std::float16_t* out, std::size_t n, char delimiter, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_many_half<detail::binary16_bits>(first, last, out, n, delimiter, fmt);
+}
+
+boost::charconv::from_chars_many_result boost::charconv::from_chars_many(boost::core::string_view sv, std::float16_t* out, std::size_t n, char delimiter, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_many_half<detail::binary16_bits>(sv.data(), sv.data() + sv.size(), out, n, delimiter, fmt);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+boost::charconv::from_chars_many_result boost::charconv::from_chars_many(const char* first, const char* last, std::bfloat16_t* out, std::size_t n, char delimiter, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_many_half<detail::bfloat16_bits>(first, last, out, n, delimiter, fmt);
+}
+
+boost::charconv::from_chars_many_result boost::charconv::from_chars_many(boost::core::string_view sv, std::bfloat16_t* out, std::size_t n, char delimiter, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::from_chars_many_half<detail::bfloat16_bits>(sv.data(), sv.data() + sv.size(), out, n, delimiter, fmt);
+}
+#endif
+
+namespace boost { namespace charconv { namespace detail {
+
+// The end of the number at first as parse_number_string finds it, or nullptr if there is none. This is the same
+// grammar, but digits are only skipped, 16 at a time by find_digit_run_end, and nothing is accumulated
+inline const char* validate_decimal_number(const char* first, const char* last, boost::charconv::chars_format fmt) noexcept
+{
+    const bool scientific = (static_cast<unsigned>(fmt) & static_cast<unsigned>(boost::charconv::chars_format::scientific)) != 0;
+    const bool fixed = (static_cast<unsigned>(fmt) & static_cast<unsigned>(boost::charconv::chars_format::fixed)) != 0;
+
+    const char* p = first;
+    if (*p == '-')
+    {
+        ++p;
+    }
+
+    const char* digits_end = find_digit_run_end(p, last, false);
+    auto digit_count = digits_end - p;
+    p = digits_end;
+    if (p != last && *p == '.')
+    {
+        ++p;
+        digits_end = find_digit_run_end(p, last, false);
+        digit_count += digits_end - p;
+        p = digits_end;
+    }
+
+    if (digit_count == 0)
+    {
+        // Infinity and nan are only letters, so looking for them is cheap
+        double unused;
+        const auto r = fast_float::detail::parse_infnan(first, last, unused);
+        return r ? r.ptr : nullptr;
+    }
+
+    if (scientific && p != last && (*p == 'e' || *p == 'E'))
+    {
+        const char* location_of_e = p;
+        ++p;
+        if (p != last && (*p == '-' || *p == '+'))
+        {
+            ++p;
+        }
+
+        digits_end = find_digit_run_end(p, last, false);
+        if (digits_end == p)
+        {
+            if (!fixed)
+            {
+                return nullptr;
+            }
+
+            // A general number ends before an 'e' without an exponent
+            return location_of_e;
+        }
+
+        return digits_end;
+    }
+
+    return scientific && !fixed ? nullptr : p;
+}
+
+// Hexadecimal significands are converted with shifts, so there is no expensive step to skip and the number is parsed.
+// Values out of range are still well formed
+inline const char* validate_hex_number(const char* first, const char* last) noexcept
+{
+    double unused;
+    const auto r = boost::charconv::detail::from_chars_float_impl(first, last, unused, boost::charconv::chars_format::hex);
+    return r.ec == std::errc::invalid_argument ? nullptr : r.ptr;
+}
+
+// One bit per character of a block of 64, for the characters of numbers without an exponent
+struct number_block_masks
+{
+    std::uint64_t digits;
+    std::uint64_t dots;
+    std::uint64_t minus_signs;
+    std::uint64_t delimiters;
+};
+
+#ifndef BOOST_CHARCONV_HAS_SSE2
+
+// 0x80 in every byte of chunk that is c
+BOOST_FORCEINLINE std::uint64_t swar_bytes_equal(std::uint64_t chunk, char c) noexcept
+{
+    const std::uint64_t x = chunk ^ (UINT64_C(0x0101010101010101) * static_cast<unsigned char>(c));
+    return ~(((x & UINT64_C(0x7F7F7F7F7F7F7F7F)) + UINT64_C(0x7F7F7F7F7F7F7F7F)) | x | UINT64_C(0x7F7F7F7F7F7F7F7F));
+}
+
+// Bit i is the high bit of byte i
+BOOST_FORCEINLINE std::uint64_t swar_high_bits(std::uint64_t bytes) noexcept
+{
+    return ((bytes >> 7) * UINT64_C(0x0102040810204080)) >> 56;
+}
+
+#endif
+
+inline number_block_masks classify_number_block(const char* first, char delimiter) noexcept
+{
+    number_block_masks masks {0, 0, 0, 0};
+
+    #ifdef BOOST_CHARCONV_HAS_SSE2
+
+    const __m128i zero_char = _mm_set1_epi8('0');
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i dot = _mm_set1_epi8('.');
+    const __m128i minus = _mm_set1_epi8('-');
+    const __m128i delimiter_char = _mm_set1_epi8(delimiter);
+
+    for (int i = 0; i < 64; i += 16)
+    {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+        const __m128i offset = _mm_sub_epi8(chars, zero_char);
+        masks.digits |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(offset, nine), offset)))) << i;
+        masks.dots |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, dot)))) << i;
+        masks.minus_signs |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, minus)))) << i;
+        masks.delimiters |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, delimiter_char)))) << i;
+    }
+
+    #else
+
+    for (int i = 0; i < 64; i += 8)
+    {
+        // Exact for every byte, since no carry can cross from one byte into the next
+        const std::uint64_t chunk = swar_load8(first + i);
+        const std::uint64_t low_bits = chunk & UINT64_C(0x7F7F7F7F7F7F7F7F);
+        const std::uint64_t at_least_zero = low_bits + UINT64_C(0x5050505050505050);
+        const std::uint64_t above_nine = low_bits + UINT64_C(0x4646464646464646);
+        masks.digits |= swar_high_bits(at_least_zero & ~above_nine & ~chunk & UINT64_C(0x8080808080808080)) << i;
+        masks.dots |= swar_high_bits(swar_bytes_equal(chunk, '.')) << i;
+        masks.minus_signs |= swar_high_bits(swar_bytes_equal(chunk, '-')) << i;
+        masks.delimiters |= swar_high_bits(swar_bytes_equal(chunk, delimiter)) << i;
+    }
+
+    #endif
+
+    return masks;
+}
+
+// Checks the numbers that end with a delimiter in the 64 characters at first from one classification of them.
+// A number of only digits, at most one dot and a leading minus sign is checked with a few bit operations, and the
+// others (exponents, infinity, nan and everything invalid) go to validate_decimal_number. Returns the start of the
+// first number that was not checked, or nullptr with first set to the start of an invalid number
+inline const char* validate_number_block(const char*& first, char delimiter, boost::charconv::chars_format fmt, std::size_t& count) noexcept
+{
+    const auto masks = classify_number_block(first, delimiter);
+    const std::uint64_t others = ~(masks.digits | masks.dots | masks.minus_signs | masks.delimiters);
+    std::uint64_t delimiters = masks.delimiters;
+    int start = 0;
+    while (delimiters != 0)
+    {
+        const int end = boost::core::countr_zero(delimiters);
+        delimiters &= delimiters - 1;
+
+        const std::uint64_t number = (UINT64_C(1) << end) - (UINT64_C(1) << start);
+        const std::uint64_t dots = masks.dots & number;
+        const bool simple = (others & number) == 0;
+        if (BOOST_LIKELY(simple && (masks.digits & number) != 0 && (dots & (dots - 1)) == 0 &&
+                         (masks.minus_signs & number & ~(UINT64_C(1) << start)) == 0))
+        {
+            ++count;
+        }
+        else
+        {
+            // A number of the simple characters that does not pass is invalid in every format
+            if (simple || validate_decimal_number(first + start, first + end, fmt) != first + end)
+            {
+                first += start;
+                return nullptr;
+            }
+
+            ++count;
+        }
+
+        start = end + 1;
+    }
+
+    return first + start;
+}
+
+inline boost::charconv::from_chars_many_result validate_numbers_impl(const char* first, const char* last, char delimiter,
+                                                                    boost::charconv::chars_format fmt) noexcept
+{
+    const bool is_hex = fmt == boost::charconv::chars_format::hex;
+    boost::charconv::from_chars_many_result result {first, std::errc(), 0};
+
+    // Numbers without an exponent are checked 64 characters at a time, which needs a delimiter that they do not contain
+    // and a format where they are valid
+    const bool use_blocks = (static_cast<unsigned>(fmt) & static_cast<unsigned>(boost::charconv::chars_format::fixed)) != 0 &&
+                            !is_integer_char(delimiter) && delimiter != '.' && delimiter != '-';
+    // The same loop as from_chars_many: a delimiter at last ends the buffer, and any other character after a number fails
+    while (first != last)
+    {
+        if (use_blocks && last - first >= 64)
+        {
+            const char* next = validate_number_block(first, delimiter, fmt, result.count);
+            if (BOOST_UNLIKELY(next == nullptr))
+            {
+                result.ptr = first;
+                result.ec = std::errc::invalid_argument;
+                return result;
+            }
+
+            // A number longer than the block is checked on its own below
+            if (BOOST_LIKELY(next != first))
+            {
+                first = next;
+                continue;
+            }
+        }
+
+        const char* const end = BOOST_LIKELY(!is_hex) ? validate_decimal_number(first, last, fmt) : validate_hex_number(first, last);
+        if (BOOST_UNLIKELY(end == nullptr || (end != last && *end != delimiter)))
+        {
+            result.ptr = first;
+            result.ec = std::errc::invalid_argument;
+            return result;
+        }
+
+        ++result.count;
+        first = end == last ? last : end + 1;
+    }
+
+    result.ptr = last;
+    return result;
+}
+
+}}} // Namespaces
+
+boost::charconv::from_chars_many_result boost::charconv::validate_numbers(const char* first, const char* last, char delimiter, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::validate_numbers_impl(first, last, delimiter, fmt);
+}
+
+boost::charconv::from_chars_many_result boost::charconv::validate_numbers(boost::core::string_view sv, char delimiter, boost::charconv::chars_format fmt) noexcept
+{
+    return detail::validate_numbers_impl(sv.data(), sv.data() + sv.size(), delimiter, fmt);
+}
+
+namespace boost { namespace charconv { namespace detail {
+
+// The number needs no more digits as a float than as a double, e.g. 0.1 and 16777216 but not 0.3333333333 or 16777217
+inline bool classify_float_exact(float f, double d) noexcept
+{
+    if (d == 0 || !std::isfinite(d))
+    {
+        return std::isnan(d) ? std::isnan(f) : static_cast<double>(f) == d;
+    }
+    if (f == 0 || !std::isfinite(f))
+    {
+        return false;
+    }
+
+    const auto f_decimal = boost::charconv::detail::to_decimal(f);
+    const auto d_decimal = boost::charconv::detail::to_decimal(d);
+    return f_decimal.significand == d_decimal.significand && f_decimal.exponent == d_decimal.exponent;
+}
+
+inline int classify_integer_bits(std::int64_t value) noexcept
+{
+    if (value >= INT8_MIN && value <= INT8_MAX)
+    {
+        return 8;
+    }
+    if (value >= INT16_MIN && value <= INT16_MAX)
+    {
+        return 16;
+    }
+    if (value >= INT32_MIN && value <= INT32_MAX)
+    {
+        return 32;
+    }
+    return 64;
+}
+
+inline boost::charconv::from_chars_classify_result from_chars_classify_impl(const char* first, const char* last) noexcept
+{
+    boost::charconv::from_chars_classify_result result {first, std::errc(), boost::charconv::number_kind::none, 0, false, 0, 0.0};
+    if (first == last)
+    {
+        result.ec = std::errc::invalid_argument;
+        return result;
+    }
+
+    // The characters are scanned once, and the digits that were found are rounded to both types
+    auto pns = boost::charconv::detail::fast_float::parse_number_string(first, last, boost::charconv::detail::fast_float::parse_options_t<char> {boost::charconv::chars_format::general});
+    if (!pns.valid)
+    {
+        const auto r = boost::charconv::detail::fast_float::detail::parse_infnan(first, last, result.real);
+        result.ptr = r.ptr;
+        result.ec = r.ec;
+        if (r)
+        {
+            result.kind = boost::charconv::number_kind::floating;
+            result.float_exact = true;
+        }
+        return result;
+    }
+
+    auto float_pns = pns;
+    float f {};
+    const auto r_float = boost::charconv::detail::fast_float::from_number_string(float_pns, f);
+    const auto r = boost::charconv::detail::fast_float::from_number_string(pns, result.real);
+    if (!r)
+    {
+        result.ec = r.ec;
+        result.real = 0;
+        return result;
+    }
+
+    result.ptr = r.ptr;
+    result.kind = boost::charconv::number_kind::floating;
+    result.float_exact = r_float && classify_float_exact(f, result.real);
+
+    // Integers are only digits after an optional sign
+    const char* const digits = pns.integer.ptr;
+    const char* const digits_end = digits + pns.integer.len();
+    if (digits == digits_end || digits_end != r.ptr)
+    {
+        return result;
+    }
+
+    // All of the digits of up to 19 digit integers are in the mantissa
+    constexpr std::uint64_t int64_limit = UINT64_C(1) << 63;
+    const std::uint64_t mantissa = pns.mantissa;
+    if (!pns.too_many_digits && (mantissa < int64_limit || (pns.negative && mantissa == int64_limit)))
+    {
+        result.integer = pns.negative ? static_cast<std::int64_t>(~mantissa + 1U) : static_cast<std::int64_t>(mantissa);
+        result.integer_bits = classify_integer_bits(result.integer);
+        result.kind = boost::charconv::number_kind::integer;
+        return result;
+    }
+
+    uint128 value;
+    const auto r_integer = from_chars128(digits, digits_end, value);
+    if (r_integer && (value.high < int64_limit || (pns.negative && value.high == int64_limit && value.low == 0)))
+    {
+        result.integer_bits = 128;
+        result.kind = boost::charconv::number_kind::integer;
+    }
+
+    return result;
+}
+
+}}} // Namespaces
+
+boost::charconv::from_chars_classify_result boost::charconv::from_chars_classify(const char* first, const char* last) noexcept
+{
+    return detail::from_chars_classify_impl(first, last);
+}
+
+boost::charconv::from_chars_classify_result boost::charconv::from_chars_classify(boost::core::string_view sv) noexcept
+{
+    return detail::from_chars_classify_impl(sv.data(), sv.data() + sv.size());
+}
+
+#if defined(__GNUC__) && __GNUC__ < 5
+# pragma GCC diagnostic pop
+#endif
+
+#endif // BOOST_CHARCONV_DETAIL_IMPL_FROM_CHARS_IPP
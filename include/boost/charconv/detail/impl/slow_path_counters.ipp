@@ -0,0 +1,154 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_IMPL_SLOW_PATH_COUNTERS_IPP
+#define BOOST_CHARCONV_DETAIL_IMPL_SLOW_PATH_COUNTERS_IPP
+
+// Compiled into the library by src/slow_path_counters.cpp, or included by <boost/charconv/slow_path_counters.hpp> with BOOST_CHARCONV_HEADER_ONLY
+
+#include <boost/charconv/detail/slow_path_counters.hpp>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef BOOST_CHARCONV_ENABLE_SLOW_PATH_COUNTERS
+
+boost::charconv::slow_path_counters& boost::charconv::detail::thread_slow_path_counters() noexcept
+{
+    static thread_local slow_path_counters counters {};
+    return counters;
+}
+
+bool boost::charconv::slow_path_counters_enabled() noexcept
+{
+    return true;
+}
+
+boost::charconv::slow_path_counters boost::charconv::get_slow_path_counters() noexcept
+{
+    return detail::thread_slow_path_counters();
+}
+
+void boost::charconv::reset_slow_path_counters() noexcept
+{
+    detail::thread_slow_path_counters() = slow_path_counters {};
+}
+
+#else
+
+bool boost::charconv::slow_path_counters_enabled() noexcept
+{
+    return false;
+}
+
+boost::charconv::slow_path_counters boost::charconv::get_slow_path_counters() noexcept
+{
+    return slow_path_counters {};
+}
+
+void boost::charconv::reset_slow_path_counters() noexcept
+{
+}
+
+#endif
+
+#ifdef BOOST_CHARCONV_ENABLE_SLOW_PATH_SAMPLES
+
+namespace boost { namespace charconv { namespace detail {
+
+// Only the owning thread pushes and drains, so the ring buffer needs no atomics.
+// pushed - drained is the number of samples held, and the slot of sample i is i % capacity
+struct slow_path_sample_ring
+{
+    static constexpr std::size_t capacity = 64;
+
+    std::uint64_t pushed;
+    std::uint64_t drained;
+    std::uint64_t dropped;
+    slow_path_sample samples[capacity];
+};
+
+inline slow_path_sample_ring& thread_slow_path_samples() noexcept
+{
+    static thread_local slow_path_sample_ring ring {};
+    return ring;
+}
+
+}}} // Namespaces
+
+boost::charconv::slow_path_sample& boost::charconv::detail::next_slow_path_sample() noexcept
+{
+    slow_path_sample_ring& ring = thread_slow_path_samples();
+    if (ring.pushed - ring.drained == slow_path_sample_ring::capacity)
+    {
+        ++ring.drained;
+        ++ring.dropped;
+    }
+
+    return ring.samples[ring.pushed++ % slow_path_sample_ring::capacity];
+}
+
+std::size_t boost::charconv::slow_path_samples_capacity() noexcept
+{
+    return detail::slow_path_sample_ring::capacity;
+}
+
+bool boost::charconv::slow_path_samples_enabled() noexcept
+{
+    return true;
+}
+
+std::size_t boost::charconv::drain_slow_path_samples(slow_path_sample* first, std::size_t count) noexcept
+{
+    detail::slow_path_sample_ring& ring = detail::thread_slow_path_samples();
+
+    std::size_t n = 0;
+    while (n != count && ring.drained != ring.pushed)
+    {
+        first[n++] = ring.samples[ring.drained++ % detail::slow_path_sample_ring::capacity];
+    }
+
+    return n;
+}
+
+std::uint64_t boost::charconv::dropped_slow_path_samples() noexcept
+{
+    return detail::thread_slow_path_samples().dropped;
+}
+
+void boost::charconv::clear_slow_path_samples() noexcept
+{
+    detail::slow_path_sample_ring& ring = detail::thread_slow_path_samples();
+    ring.drained = ring.pushed;
+    ring.dropped = 0;
+}
+
+#else
+
+std::size_t boost::charconv::slow_path_samples_capacity() noexcept
+{
+    return 0;
+}
+
+bool boost::charconv::slow_path_samples_enabled() noexcept
+{
+    return false;
+}
+
+std::size_t boost::charconv::drain_slow_path_samples(slow_path_sample*, std::size_t) noexcept
+{
+    return 0;
+}
+
+std::uint64_t boost::charconv::dropped_slow_path_samples() noexcept
+{
+    return 0;
+}
+
+void boost::charconv::clear_slow_path_samples() noexcept
+{
+}
+
+#endif
+
+#endif // BOOST_CHARCONV_DETAIL_IMPL_SLOW_PATH_COUNTERS_IPP
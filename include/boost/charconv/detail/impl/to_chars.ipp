@@ -0,0 +1,1485 @@
+// Copyright 2020-2023 Junekey Jeon
+// Copyright 2022 Peter Dimov
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_IMPL_TO_CHARS_IPP
+#define BOOST_CHARCONV_DETAIL_IMPL_TO_CHARS_IPP
+
+// Definitions of the floating point to_chars overloads.
+// Compiled into the library by src/to_chars.cpp, or included by <boost/charconv/to_chars.hpp> with BOOST_CHARCONV_HEADER_ONLY
+
+#include <boost/charconv/detail/to_chars_float_impl.hpp>
+#include <boost/charconv/detail/to_chars_half.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/limits.hpp>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+namespace boost { namespace charconv { namespace detail { namespace to_chars_detail {
+
+#ifdef BOOST_MSVC
+# pragma warning(push)
+# pragma warning(disable: 4127) // Conditional expression is constant (e.g. BOOST_IF_CONSTEXPR statements)
+#endif
+
+    // These "//"'s are to prevent clang-format to ruin this nice alignment.
+    // Thanks to reddit user u/mcmcc:
+    // https://www.reddit.com/r/cpp/comments/so3wx9/dragonbox_110_is_released_a_fast_floattostring/hw8z26r/?context=3
+    static constexpr char radix_100_head_table[] = {
+        '0', '.', '1', '.', '2', '.', '3', '.', '4', '.', //
+        '5', '.', '6', '.', '7', '.', '8', '.', '9', '.', //
+        '1', '.', '1', '.', '1', '.', '1', '.', '1', '.', //
+        '1', '.', '1', '.', '1', '.', '1', '.', '1', '.', //
+        '2', '.', '2', '.', '2', '.', '2', '.', '2', '.', //
+        '2', '.', '2', '.', '2', '.', '2', '.', '2', '.', //
+        '3', '.', '3', '.', '3', '.', '3', '.', '3', '.', //
+        '3', '.', '3', '.', '3', '.', '3', '.', '3', '.', //
+        '4', '.', '4', '.', '4', '.', '4', '.', '4', '.', //
+        '4', '.', '4', '.', '4', '.', '4', '.', '4', '.', //
+        '5', '.', '5', '.', '5', '.', '5', '.', '5', '.', //
+        '5', '.', '5', '.', '5', '.', '5', '.', '5', '.', //
+        '6', '.', '6', '.', '6', '.', '6', '.', '6', '.', //
+        '6', '.', '6', '.', '6', '.', '6', '.', '6', '.', //
+        '7', '.', '7', '.', '7', '.', '7', '.', '7', '.', //
+        '7', '.', '7', '.', '7', '.', '7', '.', '7', '.', //
+        '8', '.', '8', '.', '8', '.', '8', '.', '8', '.', //
+        '8', '.', '8', '.', '8', '.', '8', '.', '8', '.', //
+        '9', '.', '9', '.', '9', '.', '9', '.', '9', '.', //
+        '9', '.', '9', '.', '9', '.', '9', '.', '9', '.'  //
+    };
+
+    inline void print_1_digit(std::uint32_t n, char* buffer) noexcept
+    {
+        *buffer = char('0' + n);
+    }
+
+    inline void print_2_digits(std::uint32_t n, char* buffer) noexcept
+    {
+        std::memcpy(buffer, digit_tables::radix_table + n * 2, 2);
+    }
+
+    // These digit generation routines are inspired by James Anhalt's itoa algorithm:
+    // https://github.com/jeaiii/itoa
+    // The main idea is for given n, find y such that floor(10^k * y / 2^32) = n holds,
+    // where k is an appropriate integer depending on the length of n.
+    // For example, if n = 1234567, we set k = 6. In this case, we have
+    // floor(y / 2^32) = 1,
+    // floor(10^2 * ((10^0 * y) mod 2^32) / 2^32) = 23,
+    // floor(10^2 * ((10^2 * y) mod 2^32) / 2^32) = 45, and
+    // floor(10^2 * ((10^4 * y) mod 2^32) / 2^32) = 67.
+    // See https://jk-jeon.github.io/posts/2022/02/jeaiii-algorithm/ for more explanation.
+
+    BOOST_FORCEINLINE void print_9_digits(std::uint32_t s32, int& exponent,
+                                                char*& buffer) noexcept 
+    {
+        // -- IEEE-754 binary32
+        // Since we do not cut trailing zeros in advance, s32 must be of 6~9 digits
+        // unless the original input was subnormal.
+        // In particular, when it is of 9 digits it shouldn't have any trailing zeros.
+        // -- IEEE-754 binary64
+        // In this case, s32 must be of 7~9 digits unless the input is subnormal,
+        // and it shouldn't have any trailing zeros if it is of 9 digits.
+        if (s32 >= 100000000)
+        {
+            // 9 digits.
+            // 1441151882 = ceil(2^57 / 1'0000'0000) + 1
+            auto prod = s32 * std::uint64_t(1441151882);
+            prod >>= 25;
+            std::memcpy(buffer, radix_100_head_table + std::uint32_t(prod >> 32) * 2, 2);
+
+            prod = std::uint32_t(prod) * std::uint64_t(100);
+            print_2_digits(std::uint32_t(prod >> 32), buffer + 2);
+            prod = std::uint32_t(prod) * std::uint64_t(100);
+            print_2_digits(std::uint32_t(prod >> 32), buffer + 4);
+            prod = std::uint32_t(prod) * std::uint64_t(100);
+            print_2_digits(std::uint32_t(prod >> 32), buffer + 6);
+            prod = std::uint32_t(prod) * std::uint64_t(100);
+            print_2_digits(std::uint32_t(prod >> 32), buffer + 8);
+
+            exponent += 8;
+            buffer += 10;
+        }
+        else if (s32 >= 1000000) 
+        {
+            // 7 or 8 digits.
+            // 281474978 = ceil(2^48 / 100'0000) + 1
+            auto prod = s32 * std::uint64_t(281474978);
+            prod >>= 16;
+            const auto head_digits = std::uint32_t(prod >> 32);
+            // If s32 is of 8 digits, increase the exponent by 7.
+            // Otherwise, increase it by 6.
+            exponent += static_cast<int>(6 + unsigned(head_digits >= 10));
+
+            // Write the first digit and the decimal point.
+            std::memcpy(buffer, radix_100_head_table + head_digits * 2, 2);
+            // This third character may be overwritten later, but we don't care.
+            buffer[2] = digit_tables::radix_table[head_digits * 2 + 1];
+
+            // Remaining 6 digits are all zero?
+            if (std::uint32_t(prod) <= std::uint32_t((std::uint64_t(1) << 32) / 1000000)) 
+            {
+                // The number of characters actually need to be written is:
+                //   1, if only the first digit is nonzero, which means that either s32 is of 7
+                //   digits or it is of 8 digits but the second digit is zero, or
+                //   3, otherwise.
+                // Note that buffer[2] is never '0' if s32 is of 7 digits, because the input is
+                // never zero.
+                buffer += (1 + (unsigned(head_digits >= 10) & unsigned(buffer[2] > '0')) * 2);
+            }
+            else 
+            {
+                // At least one of the remaining 6 digits are nonzero.
+                // After this adjustment, now the first destination becomes buffer + 2.
+                buffer += unsigned(head_digits >= 10);
+
+                // Obtain the next two digits.
+                prod = std::uint32_t(prod) * std::uint64_t(100);
+                print_2_digits(std::uint32_t(prod >> 32), buffer + 2);
+
+                // Remaining 4 digits are all zero?
+                if (std::uint32_t(prod) <= std::uint32_t((std::uint64_t(1) << 32) / 10000)) 
+                {
+                    buffer += (3 + unsigned(buffer[3] > '0'));
+                }
+                else 
+                {
+                    // At least one of the remaining 4 digits are nonzero.
+
+                    // Obtain the next two digits.
+                    prod = std::uint32_t(prod) * std::uint64_t(100);
+                    print_2_digits(std::uint32_t(prod >> 32), buffer + 4);
+
+                    // Remaining 2 digits are all zero?
+                    if (std::uint32_t(prod) <= std::uint32_t((std::uint64_t(1) << 32) / 100))
+                    {
+                        buffer += (5 + unsigned(buffer[5] > '0'));
+                    }
+                    else 
+                    {
+                        // Obtain the last two digits.
+                        prod = std::uint32_t(prod) * std::uint64_t(100);
+                        print_2_digits(std::uint32_t(prod >> 32), buffer + 6);
+
+                        buffer += (7 + unsigned(buffer[7] > '0'));
+                    }
+                }
+            }
+        }
+        else if (s32 >= 10000)
+        {
+            // 5 or 6 digits.
+            // 429497 = ceil(2^32 / 1'0000)
+            auto prod = s32 * std::uint64_t(429497);
+            const auto head_digits = std::uint32_t(prod >> 32);
+
+            // If s32 is of 6 digits, increase the exponent by 5.
+            // Otherwise, increase it by 4.
+            exponent += static_cast<int>(4 + unsigned(head_digits >= 10));
+
+            // Write the first digit and the decimal point.
+            std::memcpy(buffer, radix_100_head_table + head_digits * 2, 2);
+            // This third character may be overwritten later but we don't care.
+            buffer[2] = digit_tables::radix_table[head_digits * 2 + 1];
+
+            // Remaining 4 digits are all zero?
+            if (std::uint32_t(prod) <= std::uint32_t((std::uint64_t(1) << 32) / 10000)) 
+            {
+                // The number of characters actually written is 1 or 3, similarly to the case of
+                // 7 or 8 digits.
+                buffer += (1 + (unsigned(head_digits >= 10) & unsigned(buffer[2] > '0')) * 2);
+            }
+            else 
+            {
+                // At least one of the remaining 4 digits are nonzero.
+                // After this adjustment, now the first destination becomes buffer + 2.
+                buffer += unsigned(head_digits >= 10);
+
+                // Obtain the next two digits.
+                prod = std::uint32_t(prod) * std::uint64_t(100);
+                print_2_digits(std::uint32_t(prod >> 32), buffer + 2);
+
+                // Remaining 2 digits are all zero?
+                if (std::uint32_t(prod) <= std::uint32_t((std::uint64_t(1) << 32) / 100))
+                {
+                    buffer += (3 + unsigned(buffer[3] > '0'));
+                }
+                else
+                {
+                    // Obtain the last two digits.
+                    prod = std::uint32_t(prod) * std::uint64_t(100);
+                    print_2_digits(std::uint32_t(prod >> 32), buffer + 4);
+
+                    buffer += (5 + unsigned(buffer[5] > '0'));
+                }
+            }
+        }
+        else if (s32 >= 100)
+        {
+            // 3 or 4 digits.
+            // 42949673 = ceil(2^32 / 100)
+            auto prod = s32 * std::uint64_t(42949673);
+            const auto head_digits = std::uint32_t(prod >> 32);
+
+            // If s32 is of 4 digits, increase the exponent by 3.
+            // Otherwise, increase it by 2.
+            exponent += (2 + int(head_digits >= 10));
+
+            // Write the first digit and the decimal point.
+            std::memcpy(buffer, radix_100_head_table + head_digits * 2, 2);
+            // This third character may be overwritten later but we don't care.
+            buffer[2] = digit_tables::radix_table[head_digits * 2 + 1];
+
+            // Remaining 2 digits are all zero?
+            if (std::uint32_t(prod) <= std::uint32_t((std::uint64_t(1) << 32) / 100))
+            {
+                // The number of characters actually written is 1 or 3, similarly to the case of
+                // 7 or 8 digits.
+                buffer += (1 + (unsigned(head_digits >= 10) & unsigned(buffer[2] > '0')) * 2);
+            }
+            else
+            {
+                // At least one of the remaining 2 digits are nonzero.
+                // After this adjustment, now the first destination becomes buffer + 2.
+                buffer += unsigned(head_digits >= 10);
+
+                // Obtain the last two digits.
+                prod = std::uint32_t(prod) * std::uint64_t(100);
+                print_2_digits(std::uint32_t(prod >> 32), buffer + 2);
+
+                buffer += (3 + unsigned(buffer[3] > '0'));
+            }
+        }
+        else
+        {
+            // 1 or 2 digits.
+            // If s32 is of 2 digits, increase the exponent by 1.
+            exponent += int(s32 >= 10);
+
+            // Write the first digit and the decimal point.
+            std::memcpy(buffer, radix_100_head_table + s32 * 2, 2);
+            // This third character may be overwritten later but we don't care.
+            buffer[2] = digit_tables::radix_table[s32 * 2 + 1];
+
+            // The number of characters actually written is 1 or 3, similarly to the case of
+            // 7 or 8 digits.
+            buffer += (1 + (unsigned(s32 >= 10) & unsigned(buffer[2] > '0')) * 2);
+        }
+    }
+
+    // The digit printers below write up to two characters past the digits, which the exponent then overwrites.
+    // With a buffer that might be too small the output goes to a local buffer first and is copied if it fits,
+    // so that exactly enough room is enough and nothing is written past last
+    inline to_chars_result dragon_box_copy_chars(const char* buffer, to_chars_result r, char* first, char* last) noexcept
+    {
+        const std::ptrdiff_t length = r.ptr - buffer;
+        if (length > last - first)
+        {
+            return {last, std::errc::result_out_of_range};
+        }
+
+        std::memcpy(first, buffer, static_cast<std::size_t>(length));
+        return {first + length, std::errc()};
+    }
+
+    template <>
+    BOOST_CHARCONV_HEADER_ONLY_INLINE to_chars_result dragon_box_print_chars<float, dragonbox_float_traits<float>>(std::uint32_t s32, int exponent, char* first, char* last, chars_format fmt,
+                                                                                                    chars_format_options options) noexcept
+    {
+        // 9 digits, '.', "e-" and 2 exponent digits
+        constexpr std::ptrdiff_t max_length = 14;
+        if (last - first < max_length)
+        {
+            char local[max_length];
+            return dragon_box_copy_chars(local, dragon_box_print_chars<float, dragonbox_float_traits<float>>(s32, exponent, local, local + max_length, fmt, options),
+                                         first, last);
+        }
+
+        auto buffer = first;
+
+        // Print significand.
+        print_9_digits(s32, exponent, buffer);
+
+        // The digit tables always put '.' after the first digit. With a single digit it is overwritten by the exponent or left past the end
+        first[1] = options.decimal_point;
+
+        // Print exponent and return
+        if (exponent < 0)
+        {
+            buffer[0] = options.exponent;
+            buffer[1] = '-';
+            buffer += 2;
+            exponent = -exponent;
+        }
+        else if (exponent == 0)
+        {
+            if (fmt == chars_format::scientific)
+            {
+                std::memcpy(buffer, "e+00", 4);
+                buffer[0] = options.exponent;
+                buffer += 4;
+            }
+
+            return {buffer, std::errc()};
+        }
+        else 
+        {
+            buffer[0] = options.exponent;
+            buffer[1] = '+';
+            buffer += 2;
+        }
+
+        print_2_digits(std::uint32_t(exponent), buffer);
+        buffer += 2;
+
+        return {buffer, std::errc()};
+    }
+
+    template <>
+    BOOST_CHARCONV_HEADER_ONLY_INLINE to_chars_result dragon_box_print_chars<double, dragonbox_float_traits<double>>(const std::uint64_t significand, int exponent, char* first, char* last, chars_format fmt,
+                                                                                                      chars_format_options options) noexcept
+    {
+        // 17 digits, '.', "e-" and 3 exponent digits
+        constexpr std::ptrdiff_t max_length = 23;
+        if (last - first < max_length)
+        {
+            char local[max_length];
+            return dragon_box_copy_chars(local, dragon_box_print_chars<double, dragonbox_float_traits<double>>(significand, exponent, local, local + max_length, fmt, options),
+                                         first, last);
+        }
+
+        auto buffer = first;
+
+        // Print significand by decomposing it into a 9-digit block and a 8-digit block.
+        std::uint32_t first_block;
+        std::uint32_t second_block {};
+        bool no_second_block;
+
+        if (significand >= 100000000)
+        {
+            first_block = std::uint32_t(significand / 100000000);
+            second_block = std::uint32_t(significand) - first_block * 100000000;
+            exponent += 8;
+            no_second_block = (second_block == 0);
+        }
+        else
+        {
+            first_block = std::uint32_t(significand);
+            no_second_block = true;
+        }
+
+        if (no_second_block)
+        {
+            print_9_digits(first_block, exponent, buffer);
+        }
+        else
+        {
+            // We proceed similarly to print_9_digits(), but since we do not need to remove
+            // trailing zeros, the procedure is a bit simpler.
+            if (first_block >= 100000000)
+            {
+                // The input is of 17 digits, thus there should be no trailing zero at all.
+                // The first block is of 9 digits.
+                // 1441151882 = ceil(2^57 / 1'0000'0000) + 1
+                auto prod = first_block * std::uint64_t(1441151882);
+                prod >>= 25;
+                std::memcpy(buffer, radix_100_head_table + std::uint32_t(prod >> 32) * 2, 2);
+                prod = std::uint32_t(prod) * std::uint64_t(100);
+                print_2_digits(std::uint32_t(prod >> 32), buffer + 2);
+                prod = std::uint32_t(prod) * std::uint64_t(100);
+                print_2_digits(std::uint32_t(prod >> 32), buffer + 4);
+                prod = std::uint32_t(prod) * std::uint64_t(100);
+                print_2_digits(std::uint32_t(prod >> 32), buffer + 6);
+                prod = std::uint32_t(prod) * std::uint64_t(100);
+                print_2_digits(std::uint32_t(prod >> 32), buffer + 8);
+
+                // The second block is of 8 digits.
+                // 281474978 = ceil(2^48 / 100'0000) + 1
+                prod = second_block * std::uint64_t(281474978);
+                prod >>= 16;
+                prod += 1;
+                print_2_digits(std::uint32_t(prod >> 32), buffer + 10);
+                prod = std::uint32_t(prod) * std::uint64_t(100);
+                print_2_digits(std::uint32_t(prod >> 32), buffer + 12);
+                prod = std::uint32_t(prod) * std::uint64_t(100);
+                print_2_digits(std::uint32_t(prod >> 32), buffer + 14);
+                prod = std::uint32_t(prod) * std::uint64_t(100);
+                print_2_digits(std::uint32_t(prod >> 32), buffer + 16);
+
+                exponent += 8;
+                buffer += 18;
+            }
+            else
+            {
+                if (first_block >= 1000000)
+                {
+                    // 7 or 8 digits.
+                    // 281474978 = ceil(2^48 / 100'0000) + 1
+                    auto prod = first_block * std::uint64_t(281474978);
+                    prod >>= 16;
+                    const auto head_digits = std::uint32_t(prod >> 32);
+
+                    std::memcpy(buffer, radix_100_head_table + head_digits * 2, 2);
+                    buffer[2] = digit_tables::radix_table[head_digits * 2 + 1];
+
+                    exponent += static_cast<int>(6 + unsigned(head_digits >= 10));
+                    buffer += unsigned(head_digits >= 10);
+
+                    // Print remaining 6 digits.
+                    prod = std::uint32_t(prod) * std::uint64_t(100);
+                    print_2_digits(std::uint32_t(prod >> 32), buffer + 2);
+                    prod = std::uint32_t(prod) * std::uint64_t(100);
+                    print_2_digits(std::uint32_t(prod >> 32), buffer + 4);
+                    prod = std::uint32_t(prod) * std::uint64_t(100);
+                    print_2_digits(std::uint32_t(prod >> 32), buffer + 6);
+
+                    buffer += 8;
+                }
+                else if (first_block >= 10000)
+                {
+                    // 5 or 6 digits.
+                    // 429497 = ceil(2^32 / 1'0000)
+                    auto prod = first_block * std::uint64_t(429497);
+                    const auto head_digits = std::uint32_t(prod >> 32);
+
+                    std::memcpy(buffer, radix_100_head_table + head_digits * 2, 2);
+                    buffer[2] = digit_tables::radix_table[head_digits * 2 + 1];
+
+                    exponent += static_cast<int>(4 + unsigned(head_digits >= 10));
+                    buffer += unsigned(head_digits >= 10);
+
+                    // Print remaining 4 digits.
+                    prod = std::uint32_t(prod) * std::uint64_t(100);
+                    print_2_digits(std::uint32_t(prod >> 32), buffer + 2);
+                    prod = std::uint32_t(prod) * std::uint64_t(100);
+                    print_2_digits(std::uint32_t(prod >> 32), buffer + 4);
+
+                    buffer += 6;
+                }
+                else if (first_block >= 100)
+                {
+                    // 3 or 4 digits.
+                    // 42949673 = ceil(2^32 / 100)
+                    auto prod = first_block * std::uint64_t(42949673);
+                    const auto head_digits = std::uint32_t(prod >> 32);
+
+                    std::memcpy(buffer, radix_100_head_table + head_digits * 2, 2);
+                    buffer[2] = digit_tables::radix_table[head_digits * 2 + 1];
+
+                    exponent += static_cast<int>(2 + unsigned(head_digits >= 10));
+                    buffer += unsigned(head_digits >= 10);
+
+                    // Print remaining 2 digits.
+                    prod = std::uint32_t(prod) * std::uint64_t(100);
+                    print_2_digits(std::uint32_t(prod >> 32), buffer + 2);
+
+                    buffer += 4;
+                }
+                else
+                {
+                    // 1 or 2 digits.
+                    std::memcpy(buffer, radix_100_head_table + first_block * 2, 2);
+                    buffer[2] = digit_tables::radix_table[first_block * 2 + 1];
+
+                    exponent += (first_block >= 10);
+                    buffer += (2 + unsigned(first_block >= 10));
+                }
+
+                // Next, print the second block.
+                // The second block is of 8 digits, but we may have trailing zeros.
+                // 281474978 = ceil(2^48 / 100'0000) + 1
+                auto prod = second_block * std::uint64_t(281474978);
+                prod >>= 16;
+                prod += 1;
+                print_2_digits(std::uint32_t(prod >> 32), buffer);
+
+                // Remaining 6 digits are all zero?
+                if (std::uint32_t(prod) <= std::uint32_t((std::uint64_t(1) << 32) / 1000000))
+                {
+                    buffer += (1 + unsigned(buffer[1] > '0'));
+                }
+                else
+                {
+                    // Obtain the next two digits.
+                    prod = std::uint32_t(prod) * std::uint64_t(100);
+                    print_2_digits(std::uint32_t(prod >> 32), buffer + 2);
+
+                    // Remaining 4 digits are all zero?
+                    if (std::uint32_t(prod) <= std::uint32_t((std::uint64_t(1) << 32) / 10000)) 
+                    {
+                        buffer += (3 + unsigned(buffer[3] > '0'));
+                    }
+                    else
+                    {
+                        // Obtain the next two digits.
+                        prod = std::uint32_t(prod) * std::uint64_t(100);
+                        print_2_digits(std::uint32_t(prod >> 32), buffer + 4);
+
+                        // Remaining 2 digits are all zero?
+                        if (std::uint32_t(prod) <= std::uint32_t((std::uint64_t(1) << 32) / 100)) 
+                        {
+                            buffer += (5 + unsigned(buffer[5] > '0'));
+                        }
+                        else 
+                        {
+                            // Obtain the last two digits.
+                            prod = std::uint32_t(prod) * std::uint64_t(100);
+                            print_2_digits(std::uint32_t(prod >> 32), buffer + 6);
+                            buffer += (7 + unsigned(buffer[7] > '0'));
+                        }
+                    }
+                }
+            }
+        }
+
+        // As with float the '.' of the digit tables is always right after the first digit
+        first[1] = options.decimal_point;
+
+        if (exponent < 0)
+        {
+            buffer[0] = options.exponent;
+            buffer[1] = '-';
+            buffer += 2;
+            exponent = -exponent;
+        }
+        else if (exponent == 0)
+        {
+            if (fmt == chars_format::scientific)
+            {
+                std::memcpy(buffer, "e+00", 4);
+                buffer[0] = options.exponent;
+                buffer += 4;
+            }
+
+            return {buffer, std::errc()};
+        }
+        else
+        {
+            buffer[0] = options.exponent;
+            buffer[1] = '+';
+            buffer += 2;
+        }
+
+        if (exponent >= 100) 
+        {
+            // d1 = exponent / 10; d2 = exponent % 10;
+            // 6554 = ceil(2^16 / 10)
+            auto prod = std::uint32_t(exponent) * std::uint32_t(6554);
+            auto d1 = prod >> 16;
+            prod = std::uint16_t(prod) * std::uint32_t(5); // * 10
+            auto d2 = prod >> 15;                          // >> 16
+            print_2_digits(d1, buffer);
+            print_1_digit(d2, buffer + 2);
+            buffer += 3;
+        }
+        else
+        {
+            print_2_digits(static_cast<std::uint32_t>(exponent), buffer);
+            buffer += 2;
+        }
+
+        return {buffer, std::errc()};
+    }
+
+#ifdef BOOST_MSVC
+# pragma warning(pop)
+#endif
+
+}}}} // Namespaces
+
+boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, float value,
+                                                           boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return boost::charconv::detail::to_chars_float_impl(first, last, value, fmt, precision);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, double value,
+                                                           boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return boost::charconv::detail::to_chars_float_impl(first, last, value, fmt, precision);
+}
+
+namespace boost { namespace charconv { namespace detail {
+
+// Spreads the integer digits of the number in [first, r.ptr) to make room for a separator between every three of them.
+// Only those digits and what follows them are moved, from the back so that nothing is read after it has been overwritten
+inline boost::charconv::to_chars_result insert_group_separators(char* first, char* last, boost::charconv::to_chars_result r,
+                                                                char separator) noexcept
+{
+    char* const digits_first = first + static_cast<int>(*first == '-');
+    char* digits_last = digits_first;
+    while (digits_last != r.ptr && *digits_last >= '0' && *digits_last <= '9')
+    {
+        ++digits_last;
+    }
+
+    const auto digits = digits_last - digits_first;
+    const auto separators = digits > 0 ? (digits - 1) / 3 : 0;
+    if (separators == 0)
+    {
+        return r;
+    }
+    if (separators > last - r.ptr)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    std::memmove(digits_last + separators, digits_last, static_cast<std::size_t>(r.ptr - digits_last));
+
+    char* next = digits_last + separators;
+    while (digits_last - digits_first > 3)
+    {
+        next -= 3;
+        digits_last -= 3;
+        std::memmove(next, digits_last, 3);
+        *--next = separator;
+    }
+
+    return {r.ptr + separators, std::errc()};
+}
+
+template <typename T>
+boost::charconv::to_chars_result to_chars_options_impl(char* first, char* last, T value, boost::charconv::chars_format fmt, int precision,
+                                                       boost::charconv::chars_format_options options) noexcept
+{
+    if (!boost::charconv::detail::is_valid_format_options(options))
+    {
+        return {last, std::errc::invalid_argument};
+    }
+
+    const auto r = boost::charconv::detail::to_chars_float_impl(first, last, value, fmt, precision, options);
+    if (options.group_separator == '\0' || fmt == boost::charconv::chars_format::hex || !r)
+    {
+        return r;
+    }
+
+    return boost::charconv::detail::insert_group_separators(first, last, r, options.group_separator);
+}
+
+}}} // Namespaces
+
+boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, float value, boost::charconv::chars_format fmt,
+                                                           boost::charconv::chars_format_options options) noexcept
+{
+    return boost::charconv::detail::to_chars_options_impl(first, last, value, fmt, -1, options);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, double value, boost::charconv::chars_format fmt,
+                                                           boost::charconv::chars_format_options options) noexcept
+{
+    return boost::charconv::detail::to_chars_options_impl(first, last, value, fmt, -1, options);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, float value, boost::charconv::chars_format fmt,
+                                                           int precision, boost::charconv::chars_format_options options) noexcept
+{
+    return boost::charconv::detail::to_chars_options_impl(first, last, value, fmt, precision, options);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, double value, boost::charconv::chars_format fmt,
+                                                           int precision, boost::charconv::chars_format_options options) noexcept
+{
+    return boost::charconv::detail::to_chars_options_impl(first, last, value, fmt, precision, options);
+}
+
+namespace boost { namespace charconv { namespace detail {
+
+template <typename T>
+boost::charconv::to_chars_result to_chars_rounding_impl(char* first, char* last, T value, boost::charconv::chars_format fmt, int precision,
+                                                        boost::charconv::rounding_mode mode) noexcept
+{
+    if (mode != boost::charconv::rounding_mode::to_nearest && (fmt == boost::charconv::chars_format::hex || precision < 0))
+    {
+        return {last, std::errc::invalid_argument};
+    }
+
+    return boost::charconv::detail::to_chars_float_impl(first, last, value, fmt, precision, boost::charconv::chars_format_options(), mode);
+}
+
+}}} // Namespaces
+
+boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, float value, boost::charconv::chars_format fmt,
+                                                           int precision, boost::charconv::rounding_mode mode) noexcept
+{
+    return boost::charconv::detail::to_chars_rounding_impl(first, last, value, fmt, precision, mode);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, double value, boost::charconv::chars_format fmt,
+                                                           int precision, boost::charconv::rounding_mode mode) noexcept
+{
+    return boost::charconv::detail::to_chars_rounding_impl(first, last, value, fmt, precision, mode);
+}
+
+std::size_t boost::charconv::to_chars_length(float value, boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return boost::charconv::detail::to_chars_float_length(value, fmt, precision);
+}
+
+std::size_t boost::charconv::to_chars_length(double value, boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return boost::charconv::detail::to_chars_float_length(value, fmt, precision);
+}
+
+namespace boost { namespace charconv { namespace detail {
+
+template <typename T>
+boost::charconv::to_chars_result json_to_chars_impl(char* first, char* last, T value) noexcept
+{
+    // The shortest representation is always a JSON number: no leading zeros, digits on both sides of the point, and a signed exponent
+    if (BOOST_LIKELY(std::isfinite(value)))
+    {
+        return boost::charconv::detail::to_chars_float_impl(first, last, value, boost::charconv::chars_format::general, -1);
+    }
+
+    constexpr char null_str[] = "null";
+    constexpr auto null_length = sizeof(null_str) - 1;
+    if (last - first < static_cast<std::ptrdiff_t>(null_length))
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    std::memcpy(first, null_str, null_length);
+    return {first + null_length, std::errc()};
+}
+
+}}} // Namespaces
+
+boost::charconv::to_chars_result boost::charconv::json_to_chars(char* first, char* last, float value) noexcept
+{
+    return boost::charconv::detail::json_to_chars_impl(first, last, value);
+}
+
+boost::charconv::to_chars_result boost::charconv::json_to_chars(char* first, char* last, double value) noexcept
+{
+    return boost::charconv::detail::json_to_chars_impl(first, last, value);
+}
+
+namespace boost { namespace charconv { namespace detail {
+
+// The values whose shortest general or scientific representation to_chars_float_impl prints with dragonbox_to_chars:
+// finite and nonzero ones, and in general notation only those outside of the range that it prints as an integer
+template <typename T>
+inline bool shortest_uses_dragonbox(T value, boost::charconv::chars_format fmt) noexcept
+{
+    using Unsigned_Integer = typename std::conditional<std::is_same<T, double>::value, std::uint64_t, std::uint32_t>::type;
+    constexpr auto max_value = static_cast<T>((std::numeric_limits<Unsigned_Integer>::max)());
+
+    const auto abs_value = std::abs(value);
+    if (!(abs_value > 0 && abs_value <= (std::numeric_limits<T>::max)()))
+    {
+        return false;
+    }
+
+    return fmt == boost::charconv::chars_format::scientific || abs_value < 1 || abs_value >= max_value;
+}
+
+// The shortest representations of a block of values. Dragonbox runs for the whole block before anything is printed:
+// the conversions of different values do not depend on each other, so the multiplications and cache loads of one
+// value overlap those of the next, instead of each waiting behind the printing of the value before it
+template <typename T>
+boost::charconv::to_chars_many_result to_chars_many_shortest(char* first, char* last, const T* values, std::size_t n, char delimiter,
+                                                             boost::charconv::chars_format fmt, bool unchecked) noexcept
+{
+    using traits = dragonbox_float_traits<T>;
+    using carrier_uint = typename traits::carrier_uint;
+
+    constexpr std::size_t block_size = 8;
+    constexpr auto max_chars = static_cast<std::size_t>(boost::charconv::limits<T>::max_chars);
+
+    boost::charconv::to_chars_many_result result {first, std::errc(), 0};
+
+    carrier_uint significands[block_size] {};
+    int exponents[block_size] {};
+    bool uses_dragonbox[block_size] {};
+
+    while (result.count < n)
+    {
+        const T* const block = values + result.count;
+        const std::size_t block_count = (std::min)(block_size, n - result.count);
+
+        for (std::size_t i = 0; i < block_count; ++i)
+        {
+            uses_dragonbox[i] = shortest_uses_dragonbox(block[i], fmt);
+            if (uses_dragonbox[i])
+            {
+                const dragonbox_float_bits<T, traits> br(block[i]);
+                const auto exponent_bits = br.extract_exponent_bits();
+                const auto decimal = to_decimal<T, traits>(br.remove_exponent_bits(exponent_bits), exponent_bits,
+                                                           policy::sign::ignore, policy::trailing_zero::ignore);
+                significands[i] = decimal.significand;
+                exponents[i] = decimal.exponent;
+            }
+        }
+
+        for (std::size_t i = 0; i < block_count; ++i)
+        {
+            char* value_first = result.ptr;
+            if (result.count != 0)
+            {
+                if (BOOST_UNLIKELY(value_first >= last))
+                {
+                    result.ec = std::errc::result_out_of_range;
+                    return result;
+                }
+                *value_first++ = delimiter;
+            }
+
+            char* const value_last = unchecked ? value_first + max_chars : last;
+            to_chars_result r {last, std::errc::result_out_of_range};
+            if (!uses_dragonbox[i])
+            {
+                r = boost::charconv::detail::to_chars_float_impl(value_first, value_last, block[i], fmt);
+            }
+            else if (value_first < value_last)
+            {
+                // The sign of random data is unpredictable, so it is written without a branch
+                *value_first = '-';
+                value_first += static_cast<int>(std::signbit(block[i]));
+                r = to_chars_detail::dragon_box_print_chars<T, traits>(significands[i], exponents[i], value_first, value_last, fmt, chars_format_options());
+            }
+
+            if (BOOST_UNLIKELY(!r))
+            {
+                result.ec = r.ec;
+                return result;
+            }
+
+            result.ptr = r.ptr;
+            ++result.count;
+        }
+    }
+
+    return result;
+}
+
+template <typename T>
+boost::charconv::to_chars_many_result to_chars_many_impl(char* first, char* last, const T* values, std::size_t n, char delimiter,
+                                                         boost::charconv::chars_format fmt, int precision) noexcept
+{
+    // The shortest general or scientific representation of every value fits into max_chars characters,
+    // so when the whole batch fits in the worst case the buffer is checked once here instead of against last for every value.
+    // Shortest fixed output of large or small values can be much longer and is always checked
+    constexpr auto max_chars = static_cast<std::size_t>(boost::charconv::limits<T>::max_chars);
+    const bool shortest = precision == -1 && (fmt == boost::charconv::chars_format::general || fmt == boost::charconv::chars_format::scientific);
+    const bool unchecked = shortest && first <= last && static_cast<std::size_t>(last - first) / (max_chars + 1) >= n;
+
+    if (shortest)
+    {
+        return to_chars_many_shortest(first, last, values, n, delimiter, fmt, unchecked);
+    }
+
+    boost::charconv::to_chars_many_result result {first, std::errc(), 0};
+
+    while (result.count < n)
+    {
+        char* value_first = result.ptr;
+        if (result.count != 0)
+        {
+            if (BOOST_UNLIKELY(value_first >= last))
+            {
+                result.ec = std::errc::result_out_of_range;
+                return result;
+            }
+            *value_first++ = delimiter;
+        }
+
+        char* const value_last = unchecked ? value_first + max_chars : last;
+        const auto r = boost::charconv::detail::to_chars_float_impl(value_first, value_last, values[result.count], fmt, precision);
+        if (BOOST_UNLIKELY(!r))
+        {
+            result.ec = r.ec;
+            return result;
+        }
+
+        result.ptr = r.ptr;
+        ++result.count;
+    }
+
+    return result;
+}
+
+}}} // Namespaces
+
+boost::charconv::to_chars_many_result boost::charconv::to_chars_many(char* first, char* last, const float* values, std::size_t n, char delimiter,
+                                                                     boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return detail::to_chars_many_impl(first, last, values, n, delimiter, fmt, precision);
+}
+
+boost::charconv::to_chars_many_result boost::charconv::to_chars_many(char* first, char* last, const double* values, std::size_t n, char delimiter,
+                                                                     boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return detail::to_chars_many_impl(first, last, values, n, delimiter, fmt, precision);
+}
+
+namespace boost { namespace charconv { namespace detail {
+
+// The shortest representation, unless it has more than max_digits significant digits and is then rounded to max_digits.
+// Rounding the Dragonbox decimal d gives the same digits as rounding the exact value v: a midpoint between two numbers
+// of max_digits digits that lay strictly between v and d would also read back as v, and would be either shorter than d,
+// or as long and closer to v, where Dragonbox picks the closest of the shortest such numbers. The only exception is d
+// being a midpoint itself, which is left to the exact digits of the precision path.
+// In the common case that the shortest representation fits it is printed from the same decimal, so Dragonbox runs once
+template <typename T>
+boost::charconv::to_chars_result to_chars_max_digits_impl(char* first, char* last, T value, int max_digits,
+                                                          boost::charconv::chars_format fmt) noexcept
+{
+    using traits = dragonbox_float_traits<T>;
+    using carrier_uint = typename traits::carrier_uint;
+
+    if (max_digits < 1 || (fmt != boost::charconv::chars_format::general && fmt != boost::charconv::chars_format::scientific))
+    {
+        return {last, std::errc::invalid_argument};
+    }
+
+    // Zero and the values that are not finite have no digits to round
+    const auto abs_value = std::abs(value);
+    if (!(abs_value > 0 && abs_value <= (std::numeric_limits<T>::max)()))
+    {
+        return boost::charconv::detail::to_chars_float_impl(first, last, value, fmt);
+    }
+    if (first >= last)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    const auto decimal = boost::charconv::detail::to_decimal(value);
+    const int shortest_digits = num_digits(decimal.significand);
+
+    if (shortest_digits <= max_digits)
+    {
+        if (!shortest_uses_dragonbox(value, fmt))
+        {
+            constexpr auto max_fractional_value = std::is_same<T, double>::value ? static_cast<T>(1e16) : static_cast<T>(1e7);
+            if (abs_value < max_fractional_value)
+            {
+                return boost::charconv::detail::to_chars_fixed_impl(first, last, value, decimal, '.');
+            }
+
+            if (decimal.is_negative)
+            {
+                *first++ = '-';
+            }
+            return boost::charconv::detail::to_chars_integer_impl(first, last, static_cast<std::uint64_t>(abs_value));
+        }
+
+        if (decimal.is_negative)
+        {
+            *first++ = '-';
+        }
+        return to_chars_detail::dragon_box_print_chars<T, traits>(decimal.significand, decimal.exponent, first, last, fmt, chars_format_options());
+    }
+
+    const int dropped_digits = shortest_digits - max_digits;
+    carrier_uint divisor = 1;
+    for (int i = 0; i < dropped_digits; ++i)
+    {
+        divisor *= 10U;
+    }
+
+    auto significand = decimal.significand / divisor;
+    const auto remainder = decimal.significand % divisor;
+    if (remainder * 2U == divisor)
+    {
+        const int precision = fmt == boost::charconv::chars_format::general ? max_digits : max_digits - 1;
+        return boost::charconv::detail::to_chars_float_impl(first, last, value, fmt, precision);
+    }
+    significand += static_cast<carrier_uint>(remainder * 2U > divisor);
+
+    // Rounding up 99...9 carries into one more digit, which is a zero that is dropped again
+    char digits[24];
+    const int printed_digits = static_cast<int>(to_chars_integer_impl(digits, digits + sizeof(digits), significand).ptr - digits);
+    const int decimal_exponent = decimal.exponent + dropped_digits + printed_digits - 1;
+
+    if (fmt == boost::charconv::chars_format::general)
+    {
+        int digit_count = max_digits;
+        while (digit_count > 1 && digits[digit_count - 1] == '0')
+        {
+            --digit_count;
+        }
+        return print_general_precision(first, last, decimal.is_negative, digits, digit_count, decimal_exponent, max_digits, chars_format_options());
+    }
+
+    // Scientific notation keeps all of the digits, as with a precision of max_digits - 1
+    const auto abs_exponent = static_cast<std::uint32_t>(decimal_exponent < 0 ? -decimal_exponent : decimal_exponent);
+    const std::ptrdiff_t total_length = static_cast<std::ptrdiff_t>(decimal.is_negative) + max_digits + (max_digits > 1 ? 1 : 0) + 2 + (abs_exponent < 100 ? 2 : 3);
+    if (total_length > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (decimal.is_negative)
+    {
+        *first++ = '-';
+    }
+    *first++ = digits[0];
+    if (max_digits > 1)
+    {
+        *first++ = '.';
+        std::memcpy(first, digits + 1, static_cast<std::size_t>(max_digits - 1));
+        first += max_digits - 1;
+    }
+    *first++ = 'e';
+    *first++ = decimal_exponent < 0 ? '-' : '+';
+    if (abs_exponent < 10)
+    {
+        *first++ = '0';
+    }
+    return to_chars_integer_impl(first, last, abs_exponent);
+}
+
+}}} // Namespaces
+
+boost::charconv::to_chars_result boost::charconv::to_chars_max_digits(char* first, char* last, float value, int max_digits,
+                                                                      boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::to_chars_max_digits_impl(first, last, value, max_digits, fmt);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars_max_digits(char* first, char* last, double value, int max_digits,
+                                                                      boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::to_chars_max_digits_impl(first, last, value, max_digits, fmt);
+}
+
+namespace boost { namespace charconv { namespace detail {
+
+template <typename T>
+boost::charconv::to_decimal_result to_decimal_impl(T value) noexcept
+{
+    if (!std::isfinite(value))
+    {
+        return {0, 0, false, std::errc::invalid_argument};
+    }
+
+    if (std::fpclassify(value) == FP_ZERO)
+    {
+        return {0, 0, static_cast<bool>(std::signbit(value)), std::errc()};
+    }
+
+    const auto decimal = boost::charconv::detail::to_decimal(value);
+    return {decimal.significand, decimal.exponent, decimal.is_negative, std::errc()};
+}
+
+}}} // Namespaces
+
+boost::charconv::to_decimal_result boost::charconv::to_decimal(float value) noexcept
+{
+    return boost::charconv::detail::to_decimal_impl(value);
+}
+
+boost::charconv::to_decimal_result boost::charconv::to_decimal(double value) noexcept
+{
+    return boost::charconv::detail::to_decimal_impl(value);
+}
+
+namespace boost { namespace charconv { namespace detail {
+
+template <typename T>
+boost::charconv::to_chars_result to_chars_si_impl(char* first, char* last, T value, int precision) noexcept
+{
+    if (first >= last)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (!std::isfinite(value))
+    {
+        return boost::charconv::detail::dragonbox_to_chars(value, first, last, boost::charconv::chars_format::general);
+    }
+
+    if (precision < 0)
+    {
+        return boost::charconv::detail::to_chars_engineering_shortest(first, last, value, true, boost::charconv::chars_format_options());
+    }
+
+    // Widening a float to double is exact
+    return boost::charconv::detail::to_chars_engineering_precision(first, last, static_cast<double>(value), precision, true);
+}
+
+}}} // Namespaces
+
+boost::charconv::to_chars_result boost::charconv::to_chars_si(char* first, char* last, float value, int precision) noexcept
+{
+    return boost::charconv::detail::to_chars_si_impl(first, last, value, precision);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars_si(char* first, char* last, double value, int precision) noexcept
+{
+    return boost::charconv::detail::to_chars_si_impl(first, last, value, precision);
+}
+
+#if BOOST_CHARCONV_LDBL_BITS == 64 || defined(BOOST_MSVC)
+
+boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, long double value,
+                                                           boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return boost::charconv::detail::to_chars_float_impl(first, last, static_cast<double>(value), fmt, precision);
+}
+
+#elif (BOOST_CHARCONV_LDBL_BITS == 80 || BOOST_CHARCONV_LDBL_BITS == 128)
+
+boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, long double value,
+                                                           boost::charconv::chars_format fmt, int precision) noexcept
+{
+    static_assert(std::numeric_limits<long double>::is_iec559, "Long double must be IEEE 754 compliant");
+
+    const auto classification = std::fpclassify(value);
+    #if BOOST_CHARCONV_LDBL_BITS == 128
+    if (classification == FP_NAN || classification == FP_INFINITE)
+    {
+        return boost::charconv::detail::to_chars_nonfinite(first, last, value, classification);
+    }
+    #else
+    if (classification == FP_NAN || classification == FP_INFINITE)
+    {
+        const auto fd128 = boost::charconv::detail::ryu::long_double_to_fd128(value);
+        const auto num_chars = boost::charconv::detail::ryu::generic_to_chars(fd128, first, last - first, fmt, precision);
+
+        if (num_chars > 0)
+        {
+            return { first + num_chars, std::errc() };
+        }
+        else
+        {
+            return {last, std::errc::result_out_of_range};
+        }
+    }
+    #endif
+
+    if (precision >= 0 && fmt != boost::charconv::chars_format::hex)
+    {
+        return boost::charconv::detail::to_chars_precision_impl(first, last, value, fmt, precision);
+    }
+
+    // Sanity check our bounds
+    const std::ptrdiff_t buffer_size = last - first;
+    auto real_precision = boost::charconv::detail::get_real_precision<long double>(precision);
+    if (buffer_size < real_precision || first > last)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (fmt == boost::charconv::chars_format::general || fmt == boost::charconv::chars_format::scientific)
+    {
+        const auto fd128 = boost::charconv::detail::ryu::long_double_to_fd128(value);
+        const auto num_chars = boost::charconv::detail::ryu::generic_to_chars(fd128, first, last - first, fmt, precision);
+
+        if (num_chars > 0)
+        {
+            return { first + num_chars, std::errc() };
+        }
+    }
+    else if (fmt == boost::charconv::chars_format::hex)
+    {
+        return boost::charconv::detail::to_chars_hex(first, last, value, precision);
+    }
+    else if (fmt == boost::charconv::chars_format::engineering)
+    {
+        const auto fd128 = boost::charconv::detail::ryu::long_double_to_fd128(value);
+        return boost::charconv::detail::to_chars_engineering_shortest(first, last, fd128.sign, fd128.mantissa, fd128.exponent,
+                                                                      false, boost::charconv::chars_format_options());
+    }
+    else if (fmt == boost::charconv::chars_format::fixed)
+    {
+        const auto fd128 = boost::charconv::detail::ryu::long_double_to_fd128(value);
+        const auto num_chars = boost::charconv::detail::ryu::generic_to_chars_fixed(fd128, first, last - first, precision);
+
+        if (num_chars > 0)
+        {
+            return { first + num_chars, std::errc() };
+        }
+    }
+
+    // The shortest representation only fails when the buffer is too small
+    return {last, std::errc::result_out_of_range};
+}
+
+#else
+
+boost::charconv::to_chars_result boost::charconv::to_chars( char* first, char* last, long double value,
+                                                            boost::charconv::chars_format fmt, int precision) noexcept
+{
+    if (std::isnan(value))
+    {
+        bool is_negative = false;
+        if (std::signbit(value))
+        {
+            is_negative = true;
+            *first++ = '-';
+        }
+
+        if (issignaling(value))
+        {
+            std::memcpy(first, "nan(snan)", 9);
+            return { first + 9 + static_cast<int>(is_negative), std::errc() };
+        }
+        else
+        {
+            if (is_negative)
+            {
+                std::memcpy(first, "nan(ind)", 8);
+                return { first + 9, std::errc() };
+            }
+            else
+            {
+                std::memcpy(first, "nan", 3);
+                return { first + 3, std::errc() };
+            }
+        }
+    }
+
+    // A long double of this layout (e.g. IBM double-double) is the sum of two doubles. With a precision, or in hex, the output
+    // is that of the exact value, so a sum that is a double itself, or that fits into the significand of __float128,
+    // is printed by the native writers of that type. Only the shortest representation and wider sums use printf
+    if (std::isfinite(value) && (precision >= 0 || fmt == boost::charconv::chars_format::hex))
+    {
+        const auto high = static_cast<double>(value);
+        const auto low = static_cast<double>(value - static_cast<long double>(high));
+        if (low == 0)
+        {
+            return boost::charconv::detail::to_chars_float_impl(first, last, high, fmt, precision);
+        }
+
+        #ifdef BOOST_CHARCONV_HAS_FLOAT128
+        // The difference of the rounded sum and high is exact, so it is low only when the sum was not rounded
+        const auto sum = static_cast<__float128>(high) + static_cast<__float128>(low);
+        if (sum - static_cast<__float128>(high) == static_cast<__float128>(low))
+        {
+            return boost::charconv::to_chars(first, last, sum, fmt, precision);
+        }
+        #endif
+    }
+
+    // printf has no engineering notation
+    if (fmt == boost::charconv::chars_format::engineering)
+    {
+        return {last, std::errc::not_supported};
+    }
+
+    #ifdef BOOST_CHARCONV_NO_LOCALE
+    // printf is not available, or would read the locale
+    static_cast<void>(fmt);
+    static_cast<void>(precision);
+    return {last, std::errc::not_supported};
+    #else
+    // Fallback to printf
+    return boost::charconv::detail::to_chars_printf_impl(first, last, value, fmt, precision);
+    #endif
+}
+
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+
+boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, __float128 value, boost::charconv::chars_format fmt, int precision) noexcept
+{
+    // Sanity check our bounds
+    if (first >= last)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    #ifdef BOOST_CHARCONV_FREESTANDING
+    if (__builtin_isnan(value))
+    {
+        return boost::charconv::detail::to_chars_nonfinite(first, last, value, FP_NAN);
+    }
+    else if (__builtin_isinf(value))
+    #else
+    if (isnanq(value))
+    {
+        return boost::charconv::detail::to_chars_nonfinite(first, last, value, FP_NAN);
+    }
+    else if (isinfq(value))
+    #endif
+    {
+        return boost::charconv::detail::to_chars_nonfinite(first, last, value, FP_INFINITE);
+    }
+
+    if (precision >= 0 && fmt != boost::charconv::chars_format::hex)
+    {
+        return boost::charconv::detail::to_chars_precision_impl(first, last, value, fmt, precision);
+    }
+
+    // Sanity check our bounds
+    const std::ptrdiff_t buffer_size = last - first;
+    auto real_precision = boost::charconv::detail::get_real_precision<__float128>(precision);
+    if (buffer_size < real_precision || first > last)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if ((fmt == boost::charconv::chars_format::general || fmt == boost::charconv::chars_format::scientific))
+    {
+        const auto fd128 = boost::charconv::detail::ryu::float128_to_fd128(value);
+        const auto num_chars = boost::charconv::detail::ryu::generic_to_chars(fd128, first, last - first, fmt, precision);
+
+        if (num_chars > 0)
+        {
+            return { first + num_chars, std::errc() };
+        }
+    }
+    else if (fmt == boost::charconv::chars_format::hex)
+    {
+        return boost::charconv::detail::to_chars_hex(first, last, value, precision);
+    }
+    else if (fmt == boost::charconv::chars_format::engineering)
+    {
+        const auto fd128 = boost::charconv::detail::ryu::float128_to_fd128(value);
+        return boost::charconv::detail::to_chars_engineering_shortest(first, last, fd128.sign, fd128.mantissa, fd128.exponent,
+                                                                      false, boost::charconv::chars_format_options());
+    }
+    else if (fmt == boost::charconv::chars_format::fixed)
+    {
+        const auto fd128 = boost::charconv::detail::ryu::float128_to_fd128(value);
+        const auto num_chars = boost::charconv::detail::ryu::generic_to_chars_fixed(fd128, first, last - first, precision);
+
+        if (num_chars > 0)
+        {
+            return { first + num_chars, std::errc() };
+        }
+    }
+
+    // The shortest representation only fails when the buffer is too small
+    return {last, std::errc::result_out_of_range};
+}
+
+#endif
+
+#if defined(BOOST_CHARCONV_HAS_FLOAT16) || defined(BOOST_CHARCONV_HAS_BRAINFLOAT16)
+
+namespace boost { namespace charconv { namespace detail {
+
+// The values are copied a block at a time into their bit patterns. The shortest representation is printed from them,
+// and every other output is that of float, so the whole block is widened first and printed by the float engine
+template <typename T, typename Half>
+boost::charconv::to_chars_many_result to_chars_many_half(char* first, char* last, const Half* values, std::size_t n, char delimiter,
+                                                         boost::charconv::chars_format fmt, int precision) noexcept
+{
+    static_assert(sizeof(Half) == sizeof(std::uint16_t), "The 16-bit types have to be their bit patterns");
+
+    constexpr std::size_t block_size = 16;
+    const bool widen = precision >= 0 || fmt == boost::charconv::chars_format::hex;
+
+    boost::charconv::to_chars_many_result result {first, std::errc(), 0};
+
+    std::uint16_t bits[block_size];
+    float widened[block_size];
+
+    while (result.count < n)
+    {
+        const std::size_t block_count = (std::min)(block_size, n - result.count);
+        std::memcpy(bits, values + result.count, block_count * sizeof(std::uint16_t));
+        if (widen)
+        {
+            half_to_float(bits, block_count, widened, T {});
+        }
+
+        for (std::size_t i = 0; i < block_count; ++i)
+        {
+            char* value_first = result.ptr;
+            if (result.count != 0)
+            {
+                if (BOOST_UNLIKELY(value_first >= last))
+                {
+                    result.ec = std::errc::result_out_of_range;
+                    return result;
+                }
+                *value_first++ = delimiter;
+            }
+
+            const auto r = widen ? boost::charconv::detail::to_chars_float_impl(value_first, last, widened[i], fmt, precision) :
+                                   boost::charconv::detail::to_chars_half(value_first, last, T {bits[i]}, fmt, precision);
+            if (BOOST_UNLIKELY(!r))
+            {
+                result.ec = r.ec;
+                return result;
+            }
+
+            result.ptr = r.ptr;
+            ++result.count;
+        }
+    }
+
+    return result;
+}
+
+}}} // Namespaces
+
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+boost::charconv::to_chars_many_result boost::charconv::to_chars_many(char* first, char* last, const std::float16_t* values, std::size_t n, char delimiter,
+                                                                     boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return detail::to_chars_many_half<detail::binary16_bits>(first, last, values, n, delimiter, fmt, precision);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+boost::charconv::to_chars_many_result boost::charconv::to_chars_many(char* first, char* last, const std::bfloat16_t* values, std::size_t n, char delimiter,
+                                                                     boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return detail::to_chars_many_half<detail::bfloat16_bits>(first, last, values, n, delimiter, fmt, precision);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, std::float16_t value,
+                                                           boost::charconv::chars_format fmt, int precision) noexcept
+{
+    boost::charconv::detail::binary16_bits bits;
+    std::memcpy(&bits.bits, &value, sizeof(value));
+    return boost::charconv::detail::to_chars_half(first, last, bits, fmt, precision);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT32
+boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, std::float32_t value,
+                                                           boost::charconv::chars_format fmt, int precision) noexcept
+{
+    static_assert(std::numeric_limits<std::float32_t>::digits == FLT_MANT_DIG &&
+                  std::numeric_limits<std::float32_t>::min_exponent == FLT_MIN_EXP,
+                  "float and std::float32_t are not the same layout like they should be");
+
+    return boost::charconv::detail::to_chars_float_impl(first, last, static_cast<float>(value), fmt, precision);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT64
+boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, std::float64_t value,
+                                                           boost::charconv::chars_format fmt, int precision) noexcept
+{
+    static_assert(std::numeric_limits<std::float64_t>::digits == DBL_MANT_DIG &&
+                  std::numeric_limits<std::float64_t>::min_exponent == DBL_MIN_EXP,
+                  "double and std::float64_t are not the same layout like they should be");
+    
+    return boost::charconv::detail::to_chars_float_impl(first, last, static_cast<double>(value), fmt, precision);
+}
+#endif
+
+#if defined(BOOST_CHARCONV_HAS_STDFLOAT128) && defined(BOOST_CHARCONV_HAS_FLOAT128)
+boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, std::float128_t value,
+                                                           boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return boost::charconv::to_chars(first, last, static_cast<__float128>(value), fmt, precision);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, std::bfloat16_t value,
+                                                           boost::charconv::chars_format fmt, int precision) noexcept
+{
+    boost::charconv::detail::bfloat16_bits bits;
+    std::memcpy(&bits.bits, &value, sizeof(value));
+    return boost::charconv::detail::to_chars_half(first, last, bits, fmt, precision);
+}
+#endif
+
+#endif // BOOST_CHARCONV_DETAIL_IMPL_TO_CHARS_IPP
@@ -5,269 +5,165 @@
 #ifndef BOOST_CHARCONV_DETAIL_INTEGER_SEARCH_TREES_HPP
 #define BOOST_CHARCONV_DETAIL_INTEGER_SEARCH_TREES_HPP
 
-// https://stackoverflow.com/questions/1489830/efficient-way-to-determine-number-of-digits-in-an-integer?page=1&tab=scoredesc#tab-top
-// https://graphics.stanford.edu/~seander/bithacks.html
+// The number of decimal digits of x without a branch: the bit width w of x gives t = floor(w * log10(2)), computed as
+// (w * 1233) >> 12, and x has t digits if it is below 10^t and t + 1 otherwise. This holds for every width up to 128.
+// See: Hacker's Delight, 2nd edition, section 11-4
+// https://graphics.stanford.edu/~seander/bithacks.html#IntegerLog10
 
 #include <boost/charconv/detail/config.hpp>
 #include <boost/charconv/detail/emulated128.hpp>
+#include <boost/charconv/detail/bit.hpp>
+#include <boost/core/bit.hpp>
+#include <type_traits>
 #include <limits>
-#include <array>
 #include <cstdint>
 
 namespace boost { namespace charconv { namespace detail {
 
-// Generic solution
-template <typename T>
-BOOST_CHARCONV_CXX14_CONSTEXPR int num_digits(T x) noexcept
+#if (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+template <bool b>
+struct num_digits_tables_template
+#else
+struct num_digits_tables
+#endif
 {
-    int digits = 0;
+    static constexpr std::uint32_t powers_of_10_32[] = {
+        UINT32_C(1), UINT32_C(10), UINT32_C(100), UINT32_C(1000), UINT32_C(10000), UINT32_C(100000), UINT32_C(1000000), UINT32_C(10000000), UINT32_C(100000000), UINT32_C(1000000000)
+    };
+
+    static constexpr std::uint64_t powers_of_10_64[] = {
+        UINT64_C(1), UINT64_C(10), UINT64_C(100), UINT64_C(1000), UINT64_C(10000), UINT64_C(100000), UINT64_C(1000000),
+        UINT64_C(10000000), UINT64_C(100000000), UINT64_C(1000000000), UINT64_C(10000000000), UINT64_C(100000000000), UINT64_C(1000000000000), UINT64_C(10000000000000),
+        UINT64_C(100000000000000), UINT64_C(1000000000000000), UINT64_C(10000000000000000), UINT64_C(100000000000000000), UINT64_C(1000000000000000000), UINT64_C(10000000000000000000)
+    };
+
+    static constexpr uint128 powers_of_10_128[] = {
+        uint128 {UINT64_C(0), UINT64_C(1)},
+        uint128 {UINT64_C(0), UINT64_C(10)},
+        uint128 {UINT64_C(0), UINT64_C(100)},
+        uint128 {UINT64_C(0), UINT64_C(1000)},
+        uint128 {UINT64_C(0), UINT64_C(10000)},
+        uint128 {UINT64_C(0), UINT64_C(100000)},
+        uint128 {UINT64_C(0), UINT64_C(1000000)},
+        uint128 {UINT64_C(0), UINT64_C(10000000)},
+        uint128 {UINT64_C(0), UINT64_C(100000000)},
+        uint128 {UINT64_C(0), UINT64_C(1000000000)},
+        uint128 {UINT64_C(0), UINT64_C(10000000000)},
+        uint128 {UINT64_C(0), UINT64_C(100000000000)},
+        uint128 {UINT64_C(0), UINT64_C(1000000000000)},
+        uint128 {UINT64_C(0), UINT64_C(10000000000000)},
+        uint128 {UINT64_C(0), UINT64_C(100000000000000)},
+        uint128 {UINT64_C(0), UINT64_C(1000000000000000)},
+        uint128 {UINT64_C(0), UINT64_C(10000000000000000)},
+        uint128 {UINT64_C(0), UINT64_C(100000000000000000)},
+        uint128 {UINT64_C(0), UINT64_C(1000000000000000000)},
+        uint128 {UINT64_C(0), UINT64_C(10000000000000000000)},
+        uint128 {UINT64_C(5), UINT64_C(7766279631452241920)},
+        uint128 {UINT64_C(54), UINT64_C(3875820019684212736)},
+        uint128 {UINT64_C(542), UINT64_C(1864712049423024128)},
+        uint128 {UINT64_C(5421), UINT64_C(200376420520689664)},
+        uint128 {UINT64_C(54210), UINT64_C(2003764205206896640)},
+        uint128 {UINT64_C(542101), UINT64_C(1590897978359414784)},
+        uint128 {UINT64_C(5421010), UINT64_C(15908979783594147840)},
+        uint128 {UINT64_C(54210108), UINT64_C(11515845246265065472)},
+        uint128 {UINT64_C(542101086), UINT64_C(4477988020393345024)},
+        uint128 {UINT64_C(5421010862), UINT64_C(7886392056514347008)},
+        uint128 {UINT64_C(54210108624), UINT64_C(5076944270305263616)},
+        uint128 {UINT64_C(542101086242), UINT64_C(13875954555633532928)},
+        uint128 {UINT64_C(5421010862427), UINT64_C(9632337040368467968)},
+        uint128 {UINT64_C(54210108624275), UINT64_C(4089650035136921600)},
+        uint128 {UINT64_C(542101086242752), UINT64_C(4003012203950112768)},
+        uint128 {UINT64_C(5421010862427522), UINT64_C(3136633892082024448)},
+        uint128 {UINT64_C(54210108624275221), UINT64_C(12919594847110692864)},
+        uint128 {UINT64_C(542101086242752217), UINT64_C(68739955140067328)},
+        uint128 {UINT64_C(5421010862427522170), UINT64_C(687399551400673280)}
+    };
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES) && (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+
+template <bool b> constexpr std::uint32_t num_digits_tables_template<b>::powers_of_10_32[];
+template <bool b> constexpr std::uint64_t num_digits_tables_template<b>::powers_of_10_64[];
+template <bool b> constexpr uint128 num_digits_tables_template<b>::powers_of_10_128[];
 
-    while (x)
-    {
-        x /= 10;
-        ++digits;
-    }
+#endif
 
-    return digits;
-}
+#if (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
 
-template <>
-BOOST_CHARCONV_CXX14_CONSTEXPR int num_digits(std::uint32_t x) noexcept
-{
-    if (x >= UINT32_C(10000))
-    {
-        if (x >= UINT32_C(10000000))
-        {
-            if (x >= UINT32_C(100000000))
-            {
-                if (x >= UINT32_C(1000000000))
-                {
-                    return 10;
-                }
-                return 9;
-            }
-            return 8;
-        }
+using num_digits_tables = num_digits_tables_template<true>;
 
-        else if (x >= UINT32_C(100000))
-        {
-            if (x >= UINT32_C(1000000))
-            {
-                return 7;
-            }
-            return 6;
-        }
-        return 5;
-    }
-    else if (x >= UINT32_C(100))
-    {
-        if (x >= UINT32_C(1000))
-        {
-            return 4;
-        }
-        return 3;
-    }
-    else if (x >= UINT32_C(10))
+#endif
+
+// 0 has one digit
+// Device code cannot access the host tables, and multiplies out the power of ten instead
+template <typename Unsigned_Integer>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CXX14_CONSTEXPR Unsigned_Integer power_of_10(int t) noexcept
+{
+    Unsigned_Integer power = 1;
+    for (int i = 0; i < t; ++i)
     {
-        return 2;
+        power *= 10U;
     }
-
-    return 1;
+    return power;
 }
 
-template <>
-BOOST_CHARCONV_CXX14_CONSTEXPR int num_digits(std::uint64_t x) noexcept
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CXX14_CONSTEXPR int num_digits(std::uint32_t x) noexcept
 {
-    if (x >= UINT64_C(10000000000))
-    {
-        if (x >= UINT64_C(100000000000000))
-        {
-            if (x >= UINT64_C(10000000000000000))
-            {
-                if (x >= UINT64_C(100000000000000000)) 
-                {
-                    if (x >= UINT64_C(1000000000000000000))
-                    {
-                        if (x >= UINT64_C(10000000000000000000))
-                        {
-                            return 20;
-                        }
-                        return 19;
-                    }
-                    return 18;
-                }
-                return 17;
-            }
-            else if (x >= UINT64_C(1000000000000000))
-            {
-                return 16;
-            }
-            return 15;
-        } 
-        if (x >= UINT64_C(1000000000000))
-        {
-            if (x >= UINT64_C(10000000000000))
-            {
-                return 14;
-            }
-            return 13;
-        }
-        if (x >= UINT64_C(100000000000))
-        {
-            return 12;
-        }
-        return 11;
-    }
-    else if (x >= UINT64_C(100000))
-    {
-        if (x >= UINT64_C(10000000))
-        {
-            if (x >= UINT64_C(100000000))
-            {
-                if (x >= UINT64_C(1000000000))
-                {
-                    return 10;
-                }
-                return 9;
-            }
-            return 8;
-        }
-        if (x >= UINT64_C(1000000))
-        {
-            return 7;
-        }
-        return 6;
-    }
-    if (x >= UINT64_C(100))
-    {
-        if (x >= UINT64_C(1000))
-        {
-            if (x >= UINT64_C(10000))
-            {
-                return 5;
-            }
-            return 4;
-        }
-        return 3;
-    }
-    if (x >= UINT64_C(10))
-    {
-        return 2;
-    }
-    return 1;
+    x |= 1U;
+    const int t = ((32 - detail::countl_zero(x)) * 1233) >> 12;
+
+    #ifdef BOOST_CHARCONV_DEVICE_COMPILE
+    return t + static_cast<int>(x >= power_of_10<std::uint32_t>(t));
+    #else
+    return t + static_cast<int>(x >= num_digits_tables::powers_of_10_32[t]);
+    #endif
 }
 
-#ifdef BOOST_MSVC
-# pragma warning(push)
-# pragma warning(disable: 4307) // MSVC 14.1 warns of intergral constant overflow
-#endif
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CXX14_CONSTEXPR int num_digits(std::uint64_t x) noexcept
+{
+    x |= 1U;
+    const int t = ((64 - detail::countl_zero(x)) * 1233) >> 12;
+
+    #ifdef BOOST_CHARCONV_DEVICE_COMPILE
+    return t + static_cast<int>(x >= power_of_10<std::uint64_t>(t));
+    #else
+    return t + static_cast<int>(x >= num_digits_tables::powers_of_10_64[t]);
+    #endif
+}
 
 BOOST_CHARCONV_CXX14_CONSTEXPR int num_digits(uint128 x) noexcept
 {
-    if (x.high == 0)
-    {
-        return num_digits(x.low);
-    }
-
-    BOOST_CHARCONV_CXX14_CONSTEXPR_NO_INLINE uint128 digits_39 = static_cast<uint128>(UINT64_C(10000000000000000000)) *
-                                                                 static_cast<uint128>(UINT64_C(10000000000000000000));
-    uint128 current_power_of_10 = digits_39;
+    x.low |= 1U;
 
-    for (int i = 39; i > 0; --i)
-    {
-        if (x >= current_power_of_10)
-        {
-            return i;
-        }
-
-        current_power_of_10 /= 10U;
-    }
-
-    return 1;
+    // A conditional move rather than a branch with optimization
+    const int width = x.high != 0 ? 128 - boost::core::countl_zero(x.high) : 64 - boost::core::countl_zero(x.low);
+    const int t = (width * 1233) >> 12;
+    return t + static_cast<int>(x >= num_digits_tables::powers_of_10_128[t]);
 }
 
-#ifdef BOOST_MSVC
-# pragma warning(pop)
-#endif
-
 #ifdef BOOST_CHARCONV_HAS_INT128
-static constexpr std::array<std::uint64_t, 20> powers_of_10 =
-{{
-    UINT64_C(1), UINT64_C(10), UINT64_C(100), UINT64_C(1000), UINT64_C(10000), UINT64_C(100000), UINT64_C(1000000), 
-    UINT64_C(10000000), UINT64_C(100000000), UINT64_C(1000000000), UINT64_C(10000000000), UINT64_C(100000000000), 
-    UINT64_C(1000000000000), UINT64_C(10000000000000), UINT64_C(100000000000000), UINT64_C(1000000000000000), 
-    UINT64_C(10000000000000000), UINT64_C(100000000000000000), UINT64_C(1000000000000000000), UINT64_C(10000000000000000000)
-}};
-
-// Assume that if someone is using 128 bit ints they are favoring the top end of the range
-// Max value is 340,282,366,920,938,463,463,374,607,431,768,211,455 (39 digits)
 BOOST_CHARCONV_CXX14_CONSTEXPR int num_digits(boost::uint128_type x) noexcept
 {
-    // There is no literal for boost::uint128_type, so we need to calculate them using the max value of the
-    // std::uint64_t powers of 10
-    constexpr boost::uint128_type digits_39 = static_cast<boost::uint128_type>(UINT64_C(10000000000000000000)) * 
-                                              static_cast<boost::uint128_type>(UINT64_C(10000000000000000000));
+    return num_digits(uint128 {static_cast<std::uint64_t>(x >> 64), static_cast<std::uint64_t>(x)});
+}
+#endif
 
-    constexpr boost::uint128_type digits_38 = digits_39 / 10;
-    constexpr boost::uint128_type digits_37 = digits_38 / 10;
-    constexpr boost::uint128_type digits_36 = digits_37 / 10;
-    constexpr boost::uint128_type digits_35 = digits_36 / 10;
-    constexpr boost::uint128_type digits_34 = digits_35 / 10;
-    constexpr boost::uint128_type digits_33 = digits_34 / 10;
-    constexpr boost::uint128_type digits_32 = digits_33 / 10;
-    constexpr boost::uint128_type digits_31 = digits_32 / 10;
-    constexpr boost::uint128_type digits_30 = digits_31 / 10;
-    constexpr boost::uint128_type digits_29 = digits_30 / 10;
-    constexpr boost::uint128_type digits_28 = digits_29 / 10;
-    constexpr boost::uint128_type digits_27 = digits_28 / 10;
-    constexpr boost::uint128_type digits_26 = digits_27 / 10;
-    constexpr boost::uint128_type digits_25 = digits_26 / 10;
-    constexpr boost::uint128_type digits_24 = digits_25 / 10;
-    constexpr boost::uint128_type digits_23 = digits_24 / 10;
-    constexpr boost::uint128_type digits_22 = digits_23 / 10;
-    constexpr boost::uint128_type digits_21 = digits_22 / 10;
+// The other integer types by the version of their width, and signed types by their magnitude
+template <typename T>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CXX14_CONSTEXPR int num_digits(T x) noexcept
+{
+    static_assert(std::numeric_limits<T>::is_integer && sizeof(T) <= sizeof(std::uint64_t), "num_digits needs an integer type of up to 64 bits");
 
-    return (x >= digits_39) ? 39 :
-           (x >= digits_38) ? 38 :
-           (x >= digits_37) ? 37 :
-           (x >= digits_36) ? 36 :
-           (x >= digits_35) ? 35 :
-           (x >= digits_34) ? 34 :
-           (x >= digits_33) ? 33 :
-           (x >= digits_32) ? 32 :
-           (x >= digits_31) ? 31 :
-           (x >= digits_30) ? 30 :
-           (x >= digits_29) ? 29 :
-           (x >= digits_28) ? 28 :
-           (x >= digits_27) ? 27 :
-           (x >= digits_26) ? 26 :
-           (x >= digits_25) ? 25 :
-           (x >= digits_24) ? 24 :
-           (x >= digits_23) ? 23 :
-           (x >= digits_22) ? 22 :
-           (x >= digits_21) ? 21 :
-           (x >= powers_of_10[19]) ? 20 :
-           (x >= powers_of_10[18]) ? 19 :
-           (x >= powers_of_10[17]) ? 18 :
-           (x >= powers_of_10[16]) ? 17 :
-           (x >= powers_of_10[15]) ? 16 :
-           (x >= powers_of_10[14]) ? 15 :
-           (x >= powers_of_10[13]) ? 14 :
-           (x >= powers_of_10[12]) ? 13 :
-           (x >= powers_of_10[11]) ? 12 :
-           (x >= powers_of_10[10]) ? 11 :
-           (x >= powers_of_10[9])  ? 10 :
-           (x >= powers_of_10[8])  ?  9 :
-           (x >= powers_of_10[7])  ?  8 :
-           (x >= powers_of_10[6])  ?  7 :
-           (x >= powers_of_10[5])  ?  6 :
-           (x >= powers_of_10[4])  ?  5 :
-           (x >= powers_of_10[3])  ?  4 :
-           (x >= powers_of_10[2])  ?  3 :
-           (x >= powers_of_10[1])  ?  2 :
-           (x >= powers_of_10[0])  ?  1 : 0;
+    using unsigned_type = typename std::conditional<(sizeof(T) <= sizeof(std::uint32_t)), std::uint32_t, std::uint64_t>::type;
+
+    auto value = static_cast<unsigned_type>(x);
+    if (std::numeric_limits<T>::is_signed && x < static_cast<T>(0))
+    {
+        value = static_cast<unsigned_type>(0U - value);
+    }
+
+    return num_digits(value);
 }
-#endif
 
 }}} // Namespace boost::charconv::detail
 
@@ -29,7 +29,7 @@ namespace boost { namespace charconv { namespace detail {
 
 #define BOOST_CHARCONV_CONSTEXPR constexpr
 
-constexpr char* memcpy(char* dest, const char* src, std::size_t count)
+BOOST_CHARCONV_GPU_ENABLED constexpr char* memcpy(char* dest, const char* src, std::size_t count)
 {
     if (BOOST_CHARCONV_IS_CONSTANT_EVALUATED(count))
     {
@@ -62,7 +62,7 @@ constexpr char* memcpy(char* dest, const char* src, std::size_t count)
 
 #define BOOST_CHARCONV_CONSTEXPR inline
 
-inline void* memcpy(void* dest, const void* src, std::size_t count)
+BOOST_CHARCONV_GPU_ENABLED inline void* memcpy(void* dest, const void* src, std::size_t count)
 {
     return std::memcpy(dest, src, count);
 }
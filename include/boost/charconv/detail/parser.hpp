@@ -9,12 +9,14 @@
 #include <boost/charconv/detail/from_chars_result.hpp>
 #include <boost/charconv/detail/from_chars_integer_impl.hpp>
 #include <boost/charconv/detail/integer_search_trees.hpp>
+#include <boost/charconv/detail/swar.hpp>
+#include <boost/charconv/detail/cpu_features.hpp>
 #include <boost/charconv/limits.hpp>
 #include <boost/charconv/chars_format.hpp>
+#include <boost/core/bit.hpp>
 #include <system_error>
 #include <type_traits>
 #include <limits>
-#include <cerrno>
 #include <cstdint>
 #include <cstring>
 
@@ -45,6 +47,111 @@ inline bool is_delimiter(char c, chars_format fmt) noexcept
     return !is_hex_char(c) && c != 'p' && c != 'P';
 }
 
+// Returns a pointer to the first character in [first, last) that is not a digit ([0-9] or [0-9a-fA-F] for hex)
+// Scans 16 characters per step with SSE2 or NEON, 8 per step with SWAR for decimal,
+// and finishes the tail one character at a time. With runtime dispatch a run of more than 32 digits goes on with
+// the AVX2 or AVX-512 kernel of the host, so that numbers of usual lengths do not pay for the call
+inline const char* find_digit_run_end(const char* first, const char* last, bool hex) noexcept
+{
+    #if defined(BOOST_CHARCONV_HAS_SSE2)
+
+    const __m128i zero_char = _mm_set1_epi8('0');
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i case_bit = _mm_set1_epi8(0x20);
+    const __m128i a_char = _mm_set1_epi8('a');
+    const __m128i five = _mm_set1_epi8(5);
+
+    #ifdef BOOST_CHARCONV_HAS_RUNTIME_DISPATCH
+    int blocks = 0;
+    #endif
+
+    while (last - first >= 16)
+    {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+
+        // A byte x is a digit if (x - '0') as unsigned is <= 9, which is tested as min(x - '0', 9) == x - '0'
+        const __m128i offset = _mm_sub_epi8(chars, zero_char);
+        __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(offset, nine), offset);
+
+        if (hex)
+        {
+            const __m128i letter_offset = _mm_sub_epi8(_mm_or_si128(chars, case_bit), a_char);
+            is_digit = _mm_or_si128(is_digit, _mm_cmpeq_epi8(_mm_min_epu8(letter_offset, five), letter_offset));
+        }
+
+        const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(is_digit));
+        if (mask != UINT32_C(0xFFFF))
+        {
+            return first + boost::core::countr_zero(~mask);
+        }
+
+        first += 16;
+
+        #ifdef BOOST_CHARCONV_HAS_RUNTIME_DISPATCH
+        if (++blocks == 2 && last - first >= 64)
+        {
+            first = skip_long_digit_run(first, last, hex);
+        }
+        #endif
+    }
+
+    #elif defined(BOOST_CHARCONV_HAS_NEON)
+
+    const uint8x16_t zero_char = vdupq_n_u8('0');
+    const uint8x16_t nine = vdupq_n_u8(9);
+    const uint8x16_t case_bit = vdupq_n_u8(0x20);
+    const uint8x16_t a_char = vdupq_n_u8('a');
+    const uint8x16_t five = vdupq_n_u8(5);
+
+    while (last - first >= 16)
+    {
+        const uint8x16_t chars = vld1q_u8(reinterpret_cast<const std::uint8_t*>(first));
+        uint8x16_t is_digit = vcleq_u8(vsubq_u8(chars, zero_char), nine);
+
+        if (hex)
+        {
+            is_digit = vorrq_u8(is_digit, vcleq_u8(vsubq_u8(vorrq_u8(chars, case_bit), a_char), five));
+        }
+
+        // Narrow each byte of the comparison to 4 bits so the whole result fits in 64 bits
+        const std::uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(is_digit), 4)), 0);
+        if (mask != UINT64_MAX)
+        {
+            return first + boost::core::countr_zero(~mask) / 4;
+        }
+
+        first += 16;
+    }
+
+    #else
+
+    if (!hex)
+    {
+        while (last - first >= 8)
+        {
+            // The lowest flagged byte is exact since no carry or borrow can come from the digits before it
+            const std::uint64_t chunk = swar_load8(first);
+            const std::uint64_t non_digits = ((chunk + UINT64_C(0x4646464646464646)) | (chunk - UINT64_C(0x3030303030303030))) & UINT64_C(0x8080808080808080);
+            if (non_digits != 0)
+            {
+                return first + boost::core::countr_zero(non_digits) / 8;
+            }
+
+            first += 8;
+        }
+    }
+
+    #endif
+
+    const auto char_validation_func = hex ? is_hex_char : is_integer_char;
+    while (first != last && char_validation_func(*first))
+    {
+        ++first;
+    }
+
+    return first;
+}
+
 inline from_chars_result from_chars_dispatch(const char* first, const char* last, std::uint64_t& value, int base) noexcept
 {
     return boost::charconv::detail::from_chars(first, last, value, base);
@@ -179,12 +286,20 @@ inline from_chars_result parser(const char* first, const char* last, bool& sign,
     const auto char_validation_func = (fmt != boost::charconv::chars_format::hex) ? is_integer_char : is_hex_char;
     const int base = (fmt != boost::charconv::chars_format::hex) ? 10 : 16;
 
-    while (next != last && char_validation_func(*next) && i < significand_buffer_size)
+    const bool is_hex = fmt == boost::charconv::chars_format::hex;
+
+    // Find the end of the integer digits in one pass and then copy the span
+    std::size_t run_length = static_cast<std::size_t>(find_digit_run_end(next, last, is_hex) - next);
+    if (run_length > significand_buffer_size - i)
+    {
+        run_length = significand_buffer_size - i;
+    }
+    if (run_length != 0)
     {
         all_zeros = false;
-        significand_buffer[i] = *next;
-        ++next;
-        ++i;
+        std::memcpy(significand_buffer + i, next, run_length);
+        next += run_length;
+        i += run_length;
     }
 
     bool fractional = false;
@@ -238,11 +353,16 @@ inline from_chars_result parser(const char* first, const char* last, bool& sign,
             }
         }
 
-        while (next != last && char_validation_func(*next) && i < significand_buffer_size)
+        run_length = static_cast<std::size_t>(find_digit_run_end(next, last, is_hex) - next);
+        if (run_length > significand_buffer_size - i)
         {
-            significand_buffer[i] = *next;
-            ++next;
-            ++i;
+            run_length = significand_buffer_size - i;
+        }
+        if (run_length != 0)
+        {
+            std::memcpy(significand_buffer + i, next, run_length);
+            next += run_length;
+            i += run_length;
         }
     }
     
@@ -250,18 +370,16 @@ inline from_chars_result parser(const char* first, const char* last, bool& sign,
     {
         // We can not process any more significant figures into the significand so skip to the end
         // or the exponent part and capture the additional orders of magnitude for the exponent
-        bool found_dot = false;
+        const auto run_end = find_digit_run_end(next, last, is_hex);
+        if (!fractional)
+        {
+            extra_zeros += static_cast<Integer>(run_end - next);
+        }
+        next = run_end;
+
         while (next != last && (char_validation_func(*next) || *next == '.'))
         {
             ++next;
-            if (!fractional && !found_dot)
-            {
-                ++extra_zeros;
-            }
-            if (next != last && *next == '.')
-            {
-                found_dot = true;
-            }
         }
     }
 
@@ -397,7 +515,7 @@ inline from_chars_result parser(const char* first, const char* last, bool& sign,
     {
         if (fractional)
         {
-            exponent = static_cast<Integer>(dot_position - significand_digits);
+            exponent = static_cast<Integer>(dot_position - significand_digits) + leading_zero_powers;
         }
         else
         {
@@ -497,21 +497,20 @@ static BOOST_CXX14_CONSTEXPR void generic_computeInvPow5(const uint32_t i, uint6
     }
 }
 
-static BOOST_CXX14_CONSTEXPR uint32_t pow5Factor(unsigned_128_type value) noexcept
+static BOOST_CHARCONV_CXX20_CONSTEXPR uint32_t pow5Factor(unsigned_128_type value) noexcept
 {
     for (uint32_t count = 0; value > 0; ++count)
     {
-        if (value % 5 != 0)
+        if (div_mod_5(value) != 0)
         {
             return count;
         }
-        value /= 5;
     }
     return 0;
 }
 
 // Returns true if value is divisible by 5^p.
-static BOOST_CHARCONV_CXX14_CONSTEXPR bool multipleOfPowerOf5(const unsigned_128_type value, const uint32_t p) noexcept
+static BOOST_CHARCONV_CXX20_CONSTEXPR bool multipleOfPowerOf5(const unsigned_128_type value, const uint32_t p) noexcept
 {
     // I tried a case distinction on p, but there was no performance difference.
     return pow5Factor(value) >= p;
@@ -10,13 +10,16 @@
 #include <boost/charconv/detail/integer_search_trees.hpp>
 #include <boost/charconv/detail/config.hpp>
 #include <boost/charconv/detail/bit_layouts.hpp>
+#include <boost/charconv/detail/dragonbox/dragonbox_binary128.hpp>
 #include <boost/charconv/to_chars.hpp>
 #include <cinttypes>
-#include <cstdio>
+#include <limits>
 #include <cstdint>
 
 #ifdef BOOST_CHARCONV_DEBUG
 #  include <iostream>
+#  include <cstdio>
+#  include <cstdlib>
 #endif
 
 namespace boost { namespace charconv { namespace detail { namespace ryu {
@@ -149,7 +152,8 @@ static inline struct floating_decimal_128 generic_binary_to_decimal(
         if (q <= 55)
         {
             // Only one of mp, mv, and mm can be a multiple of 5, if any.
-            if (mv % 5 == 0)
+            unsigned_128_type mv_div_5 = mv;
+            if (div_mod_5(mv_div_5) == 0)
             {
                 vrIsTrailingZeros = multipleOfPowerOf5(mv, q - 1);
             }
@@ -230,14 +234,24 @@ static inline struct floating_decimal_128 generic_binary_to_decimal(
     uint8_t lastRemovedDigit = 0;
     unsigned_128_type output;
 
-    while (vp / 10 > vm / 10)
+    // The quotients by 10 use div_mod_10 instead of a 128-bit division
+    for (;;)
     {
-        vmIsTrailingZeros &= vm % 10 == 0;
+        unsigned_128_type vp_div_10 = vp;
+        div_mod_10(vp_div_10);
+        unsigned_128_type vm_div_10 = vm;
+        const uint32_t vm_mod_10 = div_mod_10(vm_div_10);
+
+        if (vp_div_10 <= vm_div_10)
+        {
+            break;
+        }
+
+        vmIsTrailingZeros &= vm_mod_10 == 0;
         vrIsTrailingZeros &= lastRemovedDigit == 0;
-        lastRemovedDigit = static_cast<uint8_t>(vr % 10);
-        vr /= 10;
-        vp /= 10;
-        vm /= 10;
+        lastRemovedDigit = static_cast<uint8_t>(div_mod_10(vr));
+        vp = vp_div_10;
+        vm = vm_div_10;
         ++removed;
     }
 
@@ -248,13 +262,18 @@ static inline struct floating_decimal_128 generic_binary_to_decimal(
 
     if (vmIsTrailingZeros)
     {
-        while (vm % 10 == 0)
+        for (;;)
         {
+            unsigned_128_type vm_div_10 = vm;
+            if (div_mod_10(vm_div_10) != 0)
+            {
+                break;
+            }
+
             vrIsTrailingZeros &= lastRemovedDigit == 0;
-            lastRemovedDigit = static_cast<uint8_t>(vr % 10);
-            vr /= 10;
-            vp /= 10;
-            vm /= 10;
+            lastRemovedDigit = static_cast<uint8_t>(div_mod_10(vr));
+            div_mod_10(vp);
+            vm = vm_div_10;
             ++removed;
         }
     }
@@ -264,7 +283,7 @@ static inline struct floating_decimal_128 generic_binary_to_decimal(
     printf("vr is trailing zeros=%s\n", vrIsTrailingZeros ? "true" : "false");
     #endif
 
-    if (vrIsTrailingZeros && (lastRemovedDigit == 5) && (vr % 2 == 0))
+    if (vrIsTrailingZeros && (lastRemovedDigit == 5) && (static_cast<uint64_t>(vr) % 2 == 0))
     {
         // Round even if the exact numbers is .....50..0.
         lastRemovedDigit = 4;
@@ -487,14 +506,13 @@ static inline int generic_to_chars(const struct floating_decimal_128 v, char* re
         return -2; // Something has gone horribly wrong
     }
 
-    for (uint32_t i = 0; i < olength - 1; ++i)
+    // The digits are written one place to the right in base 10^19 limbs, and the first is then moved in front of the point
+    const auto r = to_chars_128integer_impl(result + index + 1, result + result_size, output);
+    if (r.ec != std::errc())
     {
-        const auto c = static_cast<uint32_t>(output % 10);
-        output /= 10;
-        result[index + olength - i] = static_cast<char>('0' + c);
+        return -static_cast<int>(r.ec);
     }
-    BOOST_CHARCONV_ASSERT(output < 10);
-    result[index] = static_cast<char>('0' + static_cast<uint32_t>(output % 10)); // output should be < 10 by now.
+    result[index] = result[index + 1];
 
     // Print decimal point if needed.
     if (olength > 1)
@@ -609,6 +627,28 @@ static inline struct floating_decimal_128 double_to_fd128(double d) noexcept
     return generic_binary_to_decimal(bits, 52, 11, false);
 }
 
+#ifdef BOOST_CHARCONV_HAS_INT128
+
+// The shortest representation of IEEE 754 binary128 comes from Dragonbox, which leaves zeros, non-finite values,
+// and the products with its cache that it can not resolve to the generic algorithm
+static inline struct floating_decimal_128 binary128_to_fd128(const unsigned_128_type bits) noexcept
+{
+    const auto magnitude = bits & ((one << 127) - 1);
+    if (magnitude != 0 && static_cast<uint32_t>(magnitude >> 112) != 0x7FFFU)
+    {
+        dragonbox_binary128::decimal_fp result;
+        if (dragonbox_binary128::to_decimal(magnitude, result))
+        {
+            struct floating_decimal_128 fd {result.significand, static_cast<int32_t>(result.exponent), (bits >> 127) != 0};
+            return fd;
+        }
+    }
+
+    return generic_binary_to_decimal(bits, 112, 15, false);
+}
+
+#endif
+
 #if BOOST_CHARCONV_LDBL_BITS == 80
 
 static inline struct floating_decimal_128 long_double_to_fd128(long double d) noexcept
@@ -641,11 +681,7 @@ static inline struct floating_decimal_128 long_double_to_fd128(long double d) no
     std::memcpy(&bits, &d, sizeof(long double));
 
     #if LDBL_MANT_DIG == 113 // binary128 (e.g. ARM, S390X, PPC64LE)
-    # ifdef __PPC64__
-        return generic_binary_to_decimal(bits, 112, 15, false);
-    # else
-        return generic_binary_to_decimal(bits, 112, 15, true);
-    # endif
+    return binary128_to_fd128(bits);
     #elif LDBL_MANT_DIG == 106 // ibm128 (e.g. PowerPC)
     return generic_binary_to_decimal(bits, 105, 11, true);
     #endif
@@ -660,13 +696,15 @@ static inline struct floating_decimal_128 float128_to_fd128(__float128 d) noexce
     #ifdef BOOST_CHARCONV_HAS_INT128
     unsigned_128_type bits = 0;
     std::memcpy(&bits, &d, sizeof(__float128));
+
+    return binary128_to_fd128(bits);
     #else
     trivial_uint128 trivial_bits;
     std::memcpy(&trivial_bits, &d, sizeof(__float128));
     unsigned_128_type bits {trivial_bits};
-    #endif
 
     return generic_binary_to_decimal(bits, 112, 15, false);
+    #endif
 }
 
 #endif
@@ -678,13 +716,15 @@ static inline struct floating_decimal_128 stdfloat128_to_fd128(std::float128_t d
     #ifdef BOOST_CHARCONV_HAS_INT128
     unsigned_128_type bits = 0;
     std::memcpy(&bits, &d, sizeof(std::float128_t));
+
+    return binary128_to_fd128(bits);
     #else
     trivial_uint128 trivial_bits;
     std::memcpy(&trivial_bits, &d, sizeof(std::float128_t));
     unsigned_128_type bits {trivial_bits};
-    #endif
 
     return generic_binary_to_decimal(bits, 112, 15, false);
+    #endif
 }
 
 #endif
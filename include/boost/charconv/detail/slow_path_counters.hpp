@@ -0,0 +1,94 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_SLOW_PATH_COUNTERS_HPP
+#define BOOST_CHARCONV_DETAIL_SLOW_PATH_COUNTERS_HPP
+
+// BOOST_CHARCONV_COUNT_SLOW_PATH(counter) marks a branch into one of the slow paths.
+// It only appears on those branches, so the fast paths are the same with and without the counters.
+// Each thread has its own counters, so counting needs no atomics.
+//
+// BOOST_CHARCONV_SAMPLE_SLOW_PATH_CHARS(path, digits, first, last) and BOOST_CHARCONV_SAMPLE_SLOW_PATH_VALUE(path, digits, value)
+// sit next to them, and copy the input of the conversion into the ring buffer of the calling thread
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/slow_path_counters.hpp>
+#include <limits>
+#include <cstring>
+#include <cstddef>
+
+#if defined(BOOST_CHARCONV_ENABLE_SLOW_PATH_COUNTERS) || defined(BOOST_CHARCONV_ENABLE_SLOW_PATH_SAMPLES)
+#  ifdef BOOST_NO_CXX11_THREAD_LOCAL
+#    error "BOOST_CHARCONV_ENABLE_SLOW_PATH_COUNTERS and BOOST_CHARCONV_ENABLE_SLOW_PATH_SAMPLES require thread_local"
+#  endif
+#endif
+
+#ifdef BOOST_CHARCONV_ENABLE_SLOW_PATH_COUNTERS
+#  define BOOST_CHARCONV_COUNT_SLOW_PATH(counter) (++boost::charconv::detail::thread_slow_path_counters().counter)
+#else
+#  define BOOST_CHARCONV_COUNT_SLOW_PATH(counter) static_cast<void>(0)
+#endif
+
+#ifdef BOOST_CHARCONV_ENABLE_SLOW_PATH_SAMPLES
+
+namespace boost { namespace charconv { namespace detail {
+
+// Binary digits of the types that to_chars samples, which numeric_limits does not know for __float128
+template <typename T>
+constexpr int slow_path_sample_digits() noexcept
+{
+    return std::numeric_limits<T>::digits;
+}
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+template <>
+constexpr int slow_path_sample_digits<__float128>() noexcept
+{
+    return 113;
+}
+#endif
+
+// The characters of a number are ASCII, so a wider character type only needs its low byte
+template <typename UC>
+inline void sample_slow_path_chars(slow_path path, int digits, const UC* first, const UC* last) noexcept
+{
+    slow_path_sample& sample = next_slow_path_sample();
+    const auto input_size = static_cast<std::size_t>(last - first);
+    const std::size_t size = input_size < slow_path_sample_max_size ? input_size : slow_path_sample_max_size;
+
+    sample.path = path;
+    sample.digits = digits;
+    sample.input_size = input_size;
+    sample.size = size;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        sample.data[i] = static_cast<unsigned char>(first[i]);
+    }
+}
+
+template <typename T>
+inline void sample_slow_path_value(slow_path path, int digits, T value) noexcept
+{
+    static_assert(sizeof(T) <= slow_path_sample_max_size, "The value has to fit in a sample");
+
+    slow_path_sample& sample = next_slow_path_sample();
+    sample.path = path;
+    sample.digits = digits;
+    sample.input_size = sizeof(T);
+    sample.size = sizeof(T);
+    std::memcpy(sample.data, &value, sizeof(T));
+}
+
+}}} // Namespaces
+
+#  define BOOST_CHARCONV_SAMPLE_SLOW_PATH_CHARS(path, digits, first, last) \
+    boost::charconv::detail::sample_slow_path_chars(boost::charconv::slow_path::path, digits, first, last)
+#  define BOOST_CHARCONV_SAMPLE_SLOW_PATH_VALUE(path, digits, value) \
+    boost::charconv::detail::sample_slow_path_value(boost::charconv::slow_path::path, digits, value)
+#else
+#  define BOOST_CHARCONV_SAMPLE_SLOW_PATH_CHARS(path, digits, first, last) static_cast<void>(0)
+#  define BOOST_CHARCONV_SAMPLE_SLOW_PATH_VALUE(path, digits, value) static_cast<void>(0)
+#endif
+
+#endif // BOOST_CHARCONV_DETAIL_SLOW_PATH_COUNTERS_HPP
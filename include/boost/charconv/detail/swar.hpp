@@ -0,0 +1,159 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_SWAR_HPP
+#define BOOST_CHARCONV_DETAIL_SWAR_HPP
+
+// SIMD within a register helpers for processing eight ASCII characters at a time
+// The loaded word always has the first character in the lowest byte regardless of platform endianness
+
+#include <boost/charconv/detail/config.hpp>
+#include <cstring>
+#include <cstdint>
+
+namespace boost { namespace charconv { namespace detail {
+
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE BOOST_CHARCONV_CXX14_CONSTEXPR_NO_INLINE std::uint64_t swar_byteswap(std::uint64_t val) noexcept
+{
+    return (val & UINT64_C(0xFF00000000000000)) >> 56
+         | (val & UINT64_C(0x00FF000000000000)) >> 40
+         | (val & UINT64_C(0x0000FF0000000000)) >> 24
+         | (val & UINT64_C(0x000000FF00000000)) >> 8
+         | (val & UINT64_C(0x00000000FF000000)) << 8
+         | (val & UINT64_C(0x0000000000FF0000)) << 24
+         | (val & UINT64_C(0x000000000000FF00)) << 40
+         | (val & UINT64_C(0x00000000000000FF)) << 56;
+}
+
+// Reads 8 characters starting at chars. The caller guarantees that 8 characters are available
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE BOOST_CHARCONV_CXX14_CONSTEXPR_NO_INLINE std::uint64_t swar_load8(const char* chars) noexcept
+{
+    #ifndef BOOST_CHARCONV_NO_CONSTEXPR_DETECTION
+    if (!BOOST_CHARCONV_IS_CONSTANT_EVALUATED(chars))
+    {
+        std::uint64_t val {};
+        std::memcpy(&val, chars, sizeof(val));
+
+        #if BOOST_CHARCONV_ENDIAN_BIG_BYTE
+        val = swar_byteswap(val);
+        #endif
+
+        return val;
+    }
+    #endif
+
+    std::uint64_t val = 0;
+    for (int i = 0; i < 8; ++i)
+    {
+        val |= static_cast<std::uint64_t>(static_cast<unsigned char>(chars[i])) << (i * 8);
+    }
+
+    return val;
+}
+
+// The high bit of every byte that is not in the range ['0', '9'].
+// The masks of several words can be or'ed together and tested once
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE constexpr std::uint64_t swar_non_digits(std::uint64_t val) noexcept
+{
+    return ((val + UINT64_C(0x4646464646464646)) | (val - UINT64_C(0x3030303030303030))) & UINT64_C(0x8080808080808080);
+}
+
+// True if all 8 bytes are in the range ['0', '9']
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE constexpr bool swar_is_eight_digits(std::uint64_t val) noexcept
+{
+    return swar_non_digits(val) == 0;
+}
+
+// Converts 8 ASCII digits to their value
+// See: http://govnokod.ru/13461 and https://lemire.me/blog/2022/01/21/swar-explained-parsing-eight-digits/
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE BOOST_CHARCONV_CXX14_CONSTEXPR_NO_INLINE std::uint32_t swar_parse_eight_digits(std::uint64_t val) noexcept
+{
+    constexpr std::uint64_t mask = UINT64_C(0x000000FF000000FF);
+    constexpr std::uint64_t mul1 = UINT64_C(0x000F424000000064); // 100 + (1000000ULL << 32)
+    constexpr std::uint64_t mul2 = UINT64_C(0x0000271000000001); // 1 + (10000ULL << 32)
+
+    val -= UINT64_C(0x3030303030303030);
+    val = (val * 10) + (val >> 8);
+    val = (((val & mask) * mul1) + (((val >> 16) & mask) * mul2)) >> 32;
+
+    return static_cast<std::uint32_t>(val);
+}
+
+// The high bit of every byte in the range [lo, hi] for lo > 0 and hi < 0x80. Unlike swar_non_digits no carry or borrow
+// crosses from one byte to the next, so the result is exact in every byte and two ranges can be combined
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE constexpr std::uint64_t swar_bytes_in_range(std::uint64_t val, unsigned lo, unsigned hi) noexcept
+{
+    return ((val & UINT64_C(0x7F7F7F7F7F7F7F7F)) + UINT64_C(0x0101010101010101) * (0x80U - lo)) &
+          ~((val & UINT64_C(0x7F7F7F7F7F7F7F7F)) + UINT64_C(0x0101010101010101) * (0x7FU - hi)) &
+          ~val & UINT64_C(0x8080808080808080);
+}
+
+// Digits of the bases 2^Bits for Bits = 1, 3 and 4: the high bit of every byte that is not one of them,
+// and the value of every byte that is one, in the low Bits bits of the byte
+template <int Bits>
+struct swar_power_of_two_digits;
+
+template <>
+struct swar_power_of_two_digits<1>
+{
+    BOOST_CHARCONV_GPU_ENABLED static constexpr std::uint64_t non_digits(std::uint64_t val) noexcept
+    {
+        return ~swar_bytes_in_range(val, '0', '1') & UINT64_C(0x8080808080808080);
+    }
+
+    BOOST_CHARCONV_GPU_ENABLED static constexpr std::uint64_t values(std::uint64_t val) noexcept
+    {
+        return val & UINT64_C(0x0101010101010101);
+    }
+};
+
+template <>
+struct swar_power_of_two_digits<3>
+{
+    BOOST_CHARCONV_GPU_ENABLED static constexpr std::uint64_t non_digits(std::uint64_t val) noexcept
+    {
+        return ~swar_bytes_in_range(val, '0', '7') & UINT64_C(0x8080808080808080);
+    }
+
+    BOOST_CHARCONV_GPU_ENABLED static constexpr std::uint64_t values(std::uint64_t val) noexcept
+    {
+        return val & UINT64_C(0x0707070707070707);
+    }
+};
+
+// Setting 0x20 makes the upper case letters lower case. A letter is worth its low nibble plus 9
+template <>
+struct swar_power_of_two_digits<4>
+{
+    BOOST_CHARCONV_GPU_ENABLED static constexpr std::uint64_t letters(std::uint64_t val) noexcept
+    {
+        return swar_bytes_in_range(val | UINT64_C(0x2020202020202020), 'a', 'f');
+    }
+
+    BOOST_CHARCONV_GPU_ENABLED static constexpr std::uint64_t non_digits(std::uint64_t val) noexcept
+    {
+        return ~(swar_bytes_in_range(val, '0', '9') | letters(val)) & UINT64_C(0x8080808080808080);
+    }
+
+    BOOST_CHARCONV_GPU_ENABLED static constexpr std::uint64_t values(std::uint64_t val) noexcept
+    {
+        return ((val & UINT64_C(0x0F0F0F0F0F0F0F0F)) + (letters(val) >> 7) * 9U) & UINT64_C(0x0F0F0F0F0F0F0F0F);
+    }
+};
+
+// Joins the Bits bit values of 8 bytes into one number of 8 * Bits bits, the first byte the most significant.
+// Each step joins neighbouring groups of 1, 2 and then 4 values
+template <int Bits>
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE BOOST_CHARCONV_CXX14_CONSTEXPR_NO_INLINE std::uint32_t swar_pack_digits(std::uint64_t val) noexcept
+{
+    val = ((val << Bits) | (val >> 8)) & (UINT64_C(0x0001000100010001) * ((UINT64_C(1) << (2 * Bits)) - 1U));
+    val = ((val << (2 * Bits)) | (val >> 16)) & (UINT64_C(0x0000000100000001) * ((UINT64_C(1) << (4 * Bits)) - 1U));
+    val = ((val << (4 * Bits)) | (val >> 32)) & (UINT64_MAX >> (64 - 8 * Bits));
+
+    return static_cast<std::uint32_t>(val);
+}
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_SWAR_HPP
@@ -0,0 +1,75 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_THREAD_EXECUTOR_HPP
+#define BOOST_CHARCONV_DETAIL_THREAD_EXECUTOR_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstddef>
+
+namespace boost { namespace charconv {
+
+// Runs task(0) ... task(num_tasks - 1) on a set of std::threads and returns once all have completed.
+// Tasks are claimed dynamically so threads that finish early pick up the remaining chunks.
+//
+// Any executor passed to parallel_from_chars or parallel_to_chars must provide the same call operator
+class thread_executor
+{
+public:
+    explicit thread_executor(unsigned num_threads = std::thread::hardware_concurrency()) noexcept
+        : num_threads_ {num_threads == 0 ? 1U : num_threads}
+    {}
+
+    template <typename Task>
+    void operator()(std::size_t num_tasks, const Task& task) const noexcept
+    {
+        std::atomic<std::size_t> next_task {0};
+        const auto worker = [&]() noexcept
+        {
+            for (std::size_t i = next_task++; i < num_tasks; i = next_task++)
+            {
+                task(i);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        const std::size_t num_workers = (std::min)(static_cast<std::size_t>(num_threads_), num_tasks);
+
+        #ifndef BOOST_NO_EXCEPTIONS
+        try
+        {
+        #endif
+            threads.reserve(num_workers);
+            for (std::size_t i = 1; i < num_workers; ++i)
+            {
+                threads.emplace_back(worker);
+            }
+        #ifndef BOOST_NO_EXCEPTIONS
+        }
+        catch (...) // NOLINT : If we can't get more threads the calling thread processes the remaining tasks
+        {
+        }
+        #endif
+
+        worker();
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    unsigned concurrency() const noexcept { return num_threads_; }
+
+private:
+    unsigned num_threads_;
+};
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_THREAD_EXECUTOR_HPP
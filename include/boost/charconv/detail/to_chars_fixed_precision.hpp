@@ -0,0 +1,920 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_TO_CHARS_FIXED_PRECISION_HPP
+#define BOOST_CHARCONV_DETAIL_TO_CHARS_FIXED_PRECISION_HPP
+
+// Exact decimal output of a binary floating point value with a given precision (printf's %.*f and %.*e) in one correctly rounded pass.
+// Every finite value is exactly m * 2^e, so its integer part is m << e or m >> -e, and its fraction F / 2^-e has at most -e decimal digits.
+// The fraction is kept in 64-bit words with the binary point above the top word, and each multiplication by 10^k
+// carries the next k digits out of the top. Whatever is left after the last digit decides the rounding
+// (to nearest, ties to even), so the value is never rounded twice
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/detail/to_chars_integer_impl.hpp>
+#include <boost/charconv/detail/integer_search_trees.hpp>
+#include <boost/charconv/detail/emulated128.hpp>
+#include <boost/charconv/detail/bit_layouts.hpp>
+#include <boost/charconv/detail/bit.hpp>
+#include <boost/charconv/detail/slow_path_counters.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+#ifdef BOOST_CHARCONV_THREAD_LOCAL_SCRATCH
+#  ifdef BOOST_NO_CXX11_THREAD_LOCAL
+#    error "BOOST_CHARCONV_THREAD_LOCAL_SCRATCH requires thread_local"
+#  endif
+#endif
+
+namespace boost { namespace charconv { namespace detail {
+
+#ifdef BOOST_CHARCONV_THREAD_LOCAL_SCRATCH
+
+// Intermediate array Id of the exact path. There is one of each per thread, and none of them is used twice
+// at the same time (the functions that use them do not call themselves), so every call reuses the same memory
+template <typename T, std::size_t N, int Id>
+inline T (&thread_scratch() noexcept)[N]
+{
+    static thread_local T scratch[N];
+    return scratch;
+}
+
+#  define BOOST_CHARCONV_SCRATCH_ARRAY(T, name, N, Id) T (&name)[N] = boost::charconv::detail::thread_scratch<T, N, Id>()
+#else
+#  define BOOST_CHARCONV_SCRATCH_ARRAY(T, name, N, Id) T name[N]
+#endif
+
+// Ids of the arrays declared with BOOST_CHARCONV_SCRATCH_ARRAY
+enum scratch_id : int
+{
+    scratch_integer_pieces,
+    scratch_integer_groups,
+    scratch_fraction_words,
+    scratch_scientific_digits,
+    scratch_general_digits
+};
+
+// Sizes for the exact path of each binary format.
+// words holds both the largest integer part and the fraction of the smallest subnormal in 64-bit words,
+// and every significant digit past max_significant_digits is a zero
+struct fixed_precision_binary64
+{
+    // 2^1024 needs 16 words, and the fraction of the smallest subnormal needs 1074 bits
+    static constexpr std::size_t words = 17;
+
+    // A double has at most 767 significant digits
+    static constexpr int max_significant_digits = 780;
+};
+
+struct fixed_precision_binary128
+{
+    // 2^16384 needs 256 words, and the fraction of the smallest binary128 subnormal needs 16494 bits.
+    // This also covers the 80-bit long double
+    static constexpr std::size_t words = 258;
+
+    // binary128 has at most 11563 significant digits
+    static constexpr int max_significant_digits = 11600;
+};
+
+template <typename T>
+struct fixed_precision_format;
+
+template <>
+struct fixed_precision_format<double>
+{
+    using type = fixed_precision_binary64;
+};
+
+#if BOOST_CHARCONV_LDBL_BITS == 80 || BOOST_CHARCONV_LDBL_BITS == 128
+template <>
+struct fixed_precision_format<long double>
+{
+    using type = fixed_precision_binary128;
+};
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+template <>
+struct fixed_precision_format<__float128>
+{
+    using type = fixed_precision_binary128;
+};
+#endif
+
+// A finite value as the integer significand high * 2^64 + low times 2^exponent
+struct fixed_precision_value
+{
+    std::uint64_t high;
+    std::uint64_t low;
+    int exponent;
+    bool is_negative;
+};
+
+inline fixed_precision_value fixed_precision_decompose(double value) noexcept
+{
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(value));
+
+    fixed_precision_value result {0, bits & ((UINT64_C(1) << 52) - 1), -1074, (bits >> 63) != 0};
+    const auto biased_exponent = static_cast<int>((bits >> 52) & 0x7FF);
+    if (biased_exponent != 0)
+    {
+        result.low |= UINT64_C(1) << 52;
+        result.exponent = biased_exponent - 1075;
+    }
+
+    return result;
+}
+
+// binary32 with 23 stored significand bits and an implicit leading bit
+inline fixed_precision_value fixed_precision_decompose(float value) noexcept
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(value));
+
+    fixed_precision_value result {0, bits & ((UINT32_C(1) << 23) - 1), -149, (bits >> 31) != 0};
+    const auto biased_exponent = static_cast<int>((bits >> 23) & 0xFF);
+    if (biased_exponent != 0)
+    {
+        result.low |= UINT64_C(1) << 23;
+        result.exponent = biased_exponent - 150;
+    }
+
+    return result;
+}
+
+// Splits the 16 bytes of an 80-bit or 128-bit value into its low and high 64 bits
+template <typename T>
+inline void fixed_precision_load_128(T value, std::uint64_t& high, std::uint64_t& low) noexcept
+{
+    std::uint64_t words[2] {};
+    std::memcpy(words, &value, sizeof(value) < sizeof(words) ? sizeof(value) : sizeof(words));
+
+    #if BOOST_CHARCONV_ENDIAN_LITTLE_BYTE
+    low = words[0];
+    high = words[1];
+    #else
+    high = words[0];
+    low = words[1];
+    #endif
+}
+
+// binary128 with 112 stored significand bits and an implicit leading bit
+template <typename T>
+inline fixed_precision_value fixed_precision_decompose_binary128(T value) noexcept
+{
+    std::uint64_t high;
+    std::uint64_t low;
+    fixed_precision_load_128(value, high, low);
+
+    fixed_precision_value result {high & ((UINT64_C(1) << 48) - 1), low, -16494, (high >> 63) != 0};
+    const auto biased_exponent = static_cast<int>((high >> 48) & 0x7FFF);
+    if (biased_exponent != 0)
+    {
+        result.high |= UINT64_C(1) << 48;
+        result.exponent = biased_exponent - 16495;
+    }
+
+    return result;
+}
+
+#if BOOST_CHARCONV_LDBL_BITS == 80
+
+// The 80-bit format stores the leading bit explicitly, so only the exponent differs for subnormals
+inline fixed_precision_value fixed_precision_decompose(long double value) noexcept
+{
+    std::uint64_t high;
+    std::uint64_t low;
+    fixed_precision_load_128(value, high, low);
+
+    const auto biased_exponent = static_cast<int>(high & 0x7FFF);
+    return {0, low, (biased_exponent == 0 ? 1 : biased_exponent) - 16446, (high & 0x8000) != 0};
+}
+
+#elif BOOST_CHARCONV_LDBL_BITS == 128
+
+inline fixed_precision_value fixed_precision_decompose(long double value) noexcept
+{
+    return fixed_precision_decompose_binary128(value);
+}
+
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+
+inline fixed_precision_value fixed_precision_decompose(__float128 value) noexcept
+{
+    return fixed_precision_decompose_binary128(value);
+}
+
+#endif
+
+BOOST_CHARCONV_CXX14_CONSTEXPR std::uint64_t fixed_precision_pow10(int n) noexcept
+{
+    std::uint64_t result = 1;
+    for (int i = 0; i < n; ++i)
+    {
+        result *= 10;
+    }
+
+    return result;
+}
+
+// Writes exactly count digits of value < 10^count including any leading zeros
+inline void fixed_precision_write_digits(std::uint64_t value, int count, char* buffer) noexcept
+{
+    if (count > 16)
+    {
+        const std::uint64_t sixteen_digits = UINT64_C(10000000000000000);
+        write_sixteen_digits(value % sixteen_digits, buffer + count - 16);
+        value /= sixteen_digits;
+        count -= 16;
+    }
+
+    while (count >= 2)
+    {
+        count -= 2;
+        std::memcpy(buffer + count, digit_tables::radix_table + static_cast<std::size_t>(value % 100) * 2, 2);
+        value /= 100;
+    }
+
+    if (count == 1)
+    {
+        *buffer = static_cast<char>('0' + value);
+    }
+}
+
+// Prints (high * 2^64 + low) * 2^e for values which do not fit into 64 bits. Repeated division by 10^9 splits
+// the integer into 9 digit groups, which are written most significant first
+template <typename Format>
+inline to_chars_result fixed_precision_write_large_integer(char* first, char* last, std::uint64_t high, std::uint64_t low, int e) noexcept
+{
+    // 32-bit pieces, least significant first, so each step of the division fits into 64 bits
+    BOOST_CHARCONV_SCRATCH_ARRAY(std::uint32_t, pieces, Format::words * 2 + 5, scratch_integer_pieces);
+    const int shift = e % 32;
+    std::size_t count = static_cast<std::size_t>(e / 32);
+    std::memset(pieces, 0, count * sizeof(std::uint32_t));
+    const std::uint64_t shifted_low = low << shift;
+    const std::uint64_t shifted_middle = shift == 0 ? high : (high << shift) | (low >> (64 - shift));
+    const std::uint64_t shifted_high = shift == 0 ? 0 : high >> (64 - shift);
+    pieces[count++] = static_cast<std::uint32_t>(shifted_low);
+    pieces[count++] = static_cast<std::uint32_t>(shifted_low >> 32);
+    pieces[count++] = static_cast<std::uint32_t>(shifted_middle);
+    pieces[count++] = static_cast<std::uint32_t>(shifted_middle >> 32);
+    pieces[count++] = static_cast<std::uint32_t>(shifted_high);
+    while (pieces[count - 1] == 0)
+    {
+        --count;
+    }
+
+    // Every 64-bit word adds at most 20 digits
+    BOOST_CHARCONV_SCRATCH_ARRAY(std::uint32_t, groups, Format::words * 20 / 9 + 2, scratch_integer_groups);
+    std::size_t num_groups = 0;
+    while (count != 0)
+    {
+        std::uint64_t remainder = 0;
+        for (std::size_t i = count; i-- > 0;)
+        {
+            const std::uint64_t current = (remainder << 32) | pieces[i];
+            pieces[i] = static_cast<std::uint32_t>(current / 1000000000U);
+            remainder = current % 1000000000U;
+        }
+
+        groups[num_groups++] = static_cast<std::uint32_t>(remainder);
+        while (count != 0 && pieces[count - 1] == 0)
+        {
+            --count;
+        }
+    }
+
+    const int leading_digits = num_digits(groups[num_groups - 1]);
+    if (leading_digits + static_cast<std::ptrdiff_t>(num_groups - 1) * 9 > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    fixed_precision_write_digits(groups[num_groups - 1], leading_digits, first);
+    first += leading_digits;
+    for (std::size_t i = num_groups - 1; i-- > 0;)
+    {
+        fixed_precision_write_digits(groups[i], 9, first);
+        first += 9;
+    }
+
+    return {first, std::errc()};
+}
+
+// Prints (high * 2^64 + low) * 2^e for e >= 0
+template <typename Format>
+inline to_chars_result fixed_precision_write_integer(char* first, char* last, std::uint64_t high, std::uint64_t low, int e) noexcept
+{
+    if (high == 0 && (e == 0 || (e < 64 && (low >> (64 - e)) == 0)))
+    {
+        return to_chars_integer_impl(first, last, low << e);
+    }
+
+    return fixed_precision_write_large_integer<Format>(first, last, high, low, e);
+}
+
+// Adds one to the last digit in [first, last), skipping the decimal point.
+// Returns true if the carry runs out of the leading digit (e.g. 9.99 -> 0.00)
+inline bool fixed_precision_round_up(char* first, char* last) noexcept
+{
+    while (last != first)
+    {
+        --last;
+        if (*last == '.')
+        {
+            continue;
+        }
+
+        if (*last != '9')
+        {
+            ++*last;
+            return false;
+        }
+
+        *last = '0';
+    }
+
+    return true;
+}
+
+// The fraction of (high * 2^64 + low) / 2^s as a multiword numerator with the binary point above the top word
+template <typename Format>
+class fixed_precision_fraction
+{
+private:
+    BOOST_CHARCONV_SCRATCH_ARRAY(std::uint64_t, words_, Format::words, scratch_fraction_words);
+    std::size_t size_;
+
+    // The lowest words become zero as the factors of 2 in 10^k shift the fraction up
+    std::size_t lowest_ = 0;
+
+public:
+    fixed_precision_fraction(std::uint64_t high, std::uint64_t low, int s) noexcept
+        : size_ {static_cast<std::size_t>((s + 63) / 64)}
+    {
+        // Bits at or above size_ * 64 belong to the integer part
+        const int shift = static_cast<int>(size_ * 64) - s;
+        const std::uint64_t shifted[3] = {low << shift,
+                                          shift == 0 ? high : (high << shift) | (low >> (64 - shift)),
+                                          shift == 0 ? 0 : high >> (64 - shift)};
+
+        std::memset(words_, 0, size_ * sizeof(std::uint64_t));
+        for (std::size_t i = 0; i < 3 && i < size_; ++i)
+        {
+            words_[i] = shifted[i];
+        }
+
+        while (lowest_ < size_ && words_[lowest_] == 0)
+        {
+            ++lowest_;
+        }
+    }
+
+    // Multiplies by 10^count <= 10^19 and returns the integer part, which are the next count digits
+    std::uint64_t next_digits(int count) noexcept
+    {
+        const std::uint64_t multiplier = fixed_precision_pow10(count);
+
+        std::uint64_t carry = 0;
+        for (std::size_t i = lowest_; i < size_; ++i)
+        {
+            const uint128 product = umul128(words_[i], multiplier);
+            words_[i] = product.low + carry;
+            carry = product.high + static_cast<std::uint64_t>(words_[i] < carry);
+        }
+
+        while (lowest_ < size_ && words_[lowest_] == 0)
+        {
+            ++lowest_;
+        }
+
+        return carry;
+    }
+
+    bool is_zero() const noexcept
+    {
+        return lowest_ == size_;
+    }
+
+    // Returns less than, equal to, or greater than zero when the fraction is below, at, or above one half
+    int compare_half() const noexcept
+    {
+        const std::uint64_t top = words_[size_ - 1];
+        const std::uint64_t half = UINT64_C(1) << 63;
+        if (top != half)
+        {
+            return top < half ? -1 : 1;
+        }
+
+        return lowest_ + 1 < size_ ? 1 : 0;
+    }
+};
+
+// The integer part of (high * 2^64 + low) / 2^s for 0 < s
+inline void fixed_precision_integer_part(std::uint64_t high, std::uint64_t low, int s, std::uint64_t& integer_high, std::uint64_t& integer_low) noexcept
+{
+    if (s >= 128)
+    {
+        integer_high = 0;
+        integer_low = 0;
+    }
+    else if (s >= 64)
+    {
+        integer_high = 0;
+        integer_low = high >> (s - 64);
+    }
+    else
+    {
+        integer_high = high >> s;
+        integer_low = (low >> s) | (high << (64 - s));
+    }
+}
+
+template <typename Format>
+inline to_chars_result to_chars_fixed_precision_impl(char* first, char* last, const fixed_precision_value& value, int precision,
+                                                     rounding_mode mode = rounding_mode::to_nearest) noexcept
+{
+    const std::ptrdiff_t fraction_length = precision == 0 ? 0 : static_cast<std::ptrdiff_t>(precision) + 1;
+    char* const digits_first = first + static_cast<std::ptrdiff_t>(value.is_negative);
+    if (digits_first >= last)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (value.is_negative)
+    {
+        *first = '-';
+    }
+
+    // Integral values have no digits after the decimal point, and no rounding
+    if (value.exponent >= 0 || (value.high == 0 && value.low == 0))
+    {
+        auto r = fixed_precision_write_integer<Format>(digits_first, last, value.high, value.low, value.exponent < 0 ? 0 : value.exponent);
+        if (!r || fraction_length > last - r.ptr)
+        {
+            return {last, std::errc::result_out_of_range};
+        }
+
+        if (precision != 0)
+        {
+            *r.ptr++ = '.';
+            std::memset(r.ptr, '0', static_cast<std::size_t>(precision));
+            r.ptr += precision;
+        }
+
+        return r;
+    }
+
+    const int s = -value.exponent;
+    std::uint64_t integer_high;
+    std::uint64_t integer_low;
+    fixed_precision_integer_part(value.high, value.low, s, integer_high, integer_low);
+    fixed_precision_fraction<Format> fraction(value.high, value.low, s);
+
+    auto r = fixed_precision_write_integer<Format>(digits_first, last, integer_high, integer_low, 0);
+    if (!r || fraction_length > last - r.ptr)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    char* ptr = r.ptr;
+    if (precision != 0)
+    {
+        *ptr++ = '.';
+
+        // Digits past the s-th are all zeros
+        int remaining = precision < s ? precision : s;
+        std::memset(ptr + remaining, '0', static_cast<std::size_t>(precision - remaining));
+
+        while (remaining != 0)
+        {
+            const int count = remaining < 19 ? remaining : 19;
+            fixed_precision_write_digits(fraction.next_digits(count), count, ptr);
+            ptr += count;
+            remaining -= count;
+        }
+
+        ptr = r.ptr + 1 + precision;
+    }
+
+    // The fraction is only non-zero at a tie if every digit was generated, so ptr[-1] is the last one
+    bool round_up;
+    if (mode == rounding_mode::to_nearest)
+    {
+        const int half = fraction.compare_half();
+        round_up = half > 0 || (half == 0 && ((ptr[-1] - '0') & 1) != 0);
+    }
+    else
+    {
+        round_up = !fraction.is_zero() && rounds_magnitude_up(mode, value.is_negative);
+    }
+
+    if (round_up && fixed_precision_round_up(digits_first, ptr))
+    {
+        if (ptr >= last)
+        {
+            return {last, std::errc::result_out_of_range};
+        }
+
+        std::memmove(digits_first + 1, digits_first, static_cast<std::size_t>(ptr - digits_first));
+        *digits_first = '1';
+        ++ptr;
+    }
+
+    return {ptr, std::errc()};
+}
+
+template <typename T>
+inline to_chars_result to_chars_fixed_precision(char* first, char* last, T value, int precision, rounding_mode mode = rounding_mode::to_nearest) noexcept
+{
+    return to_chars_fixed_precision_impl<typename fixed_precision_format<T>::type>(first, last, fixed_precision_decompose(value), precision, mode);
+}
+
+// Rounds the digits of a value whose fraction fits into one word by the part of it after them, which compares to half
+// the unit of the last digit as remainder does to half, and prints them with precision digits after the point
+template <typename Integer>
+inline to_chars_result fixed_precision_write_rounded(char* first, char* last, bool is_negative, Integer integer_digits,
+                                                     std::uint64_t fraction_digits, int precision, std::uint64_t remainder,
+                                                     std::uint64_t half, rounding_mode mode) noexcept
+{
+    const std::uint64_t last_digit = precision == 0 ? static_cast<std::uint64_t>(integer_digits) : fraction_digits;
+    const bool round_up = mode == rounding_mode::to_nearest ? remainder > half || (remainder == half && (last_digit & 1) != 0) :
+                                                              remainder != 0 && rounds_magnitude_up(mode, is_negative);
+    if (round_up)
+    {
+        if (++fraction_digits == num_digits_tables::powers_of_10_64[precision])
+        {
+            fraction_digits = 0;
+            ++integer_digits;
+        }
+    }
+
+    char* const digits_first = first + static_cast<std::ptrdiff_t>(is_negative);
+    if (digits_first >= last)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (is_negative)
+    {
+        *first = '-';
+    }
+
+    auto r = to_chars_integer_impl(digits_first, last, integer_digits);
+    if (!r || (precision != 0 && precision + 1 > last - r.ptr))
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (precision != 0)
+    {
+        *r.ptr++ = '.';
+        fixed_precision_write_digits(fraction_digits, precision, r.ptr);
+        r.ptr += precision;
+    }
+
+    return r;
+}
+
+template <>
+inline to_chars_result to_chars_fixed_precision<double>(char* first, char* last, double value, int precision, rounding_mode mode) noexcept
+{
+    const auto decomposed = fixed_precision_decompose(value);
+    const int s = -decomposed.exponent;
+
+    // Prices and metrics: the fraction fits into one word and all digits come from a single multiplication
+    if (s > 0 && s < 64 && precision <= 19)
+    {
+        const std::uint64_t m = decomposed.low;
+        const uint128 product = umul128(m << (64 - s), num_digits_tables::powers_of_10_64[precision]);
+        return fixed_precision_write_rounded(first, last, decomposed.is_negative, m >> s, product.high, precision,
+                                             product.low, UINT64_C(1) << 63, mode);
+    }
+
+    return to_chars_fixed_precision_impl<fixed_precision_binary64>(first, last, decomposed, precision, mode);
+}
+
+// binary32 has a 24-bit significand. When the fraction times 10^precision still fits into 64 bits, e.g. readings printed
+// with a few decimals, the digits and the remainder that rounds them come from one 64-bit multiplication.
+// Everything else is printed as the double of the same value, which is exact
+template <>
+inline to_chars_result to_chars_fixed_precision<float>(char* first, char* last, float value, int precision, rounding_mode mode) noexcept
+{
+    const auto decomposed = fixed_precision_decompose(value);
+    const int s = -decomposed.exponent;
+
+    // 10^precision < 2^(4 * precision), and the fraction is below 2^s
+    if (s > 0 && precision <= 15 && s + 4 * precision <= 64 && s < 64)
+    {
+        const auto m = static_cast<std::uint32_t>(decomposed.low);
+        const std::uint64_t mask = (UINT64_C(1) << s) - 1;
+        const std::uint64_t product = (decomposed.low & mask) * num_digits_tables::powers_of_10_64[precision];
+        return fixed_precision_write_rounded(first, last, decomposed.is_negative, s < 32 ? m >> s : UINT32_C(0), product >> s,
+                                             precision, product & mask, UINT64_C(1) << (s - 1), mode);
+    }
+
+    return to_chars_fixed_precision<double>(first, last, static_cast<double>(value), precision, mode);
+}
+
+// Scientific notation with precision digits after the decimal point.
+// The significant digits are generated exactly until one more than needed, and the rest only decides if anything non-zero follows
+template <typename Format>
+inline to_chars_result to_chars_scientific_exact_impl(char* first, char* last, const fixed_precision_value& value, int precision,
+                                                     rounding_mode mode = rounding_mode::to_nearest) noexcept
+{
+    constexpr int max_significant_digits = Format::max_significant_digits;
+    const int printed_digits = precision < max_significant_digits ? precision + 1 : max_significant_digits;
+
+    // The integer part has fewer digits than the limit, and the fraction adds at most one chunk past the rounding digit
+    BOOST_CHARCONV_SCRATCH_ARRAY(char, digits, static_cast<std::size_t>(max_significant_digits) + 20U, scratch_scientific_digits);
+    int digit_count = 0;
+    int decimal_exponent = 0;
+    bool sticky = false;
+
+    if (value.high != 0 || value.low != 0)
+    {
+        const int s = value.exponent < 0 ? -value.exponent : 0;
+        if (s < 128)
+        {
+            std::uint64_t integer_high = value.high;
+            std::uint64_t integer_low = value.low;
+            if (s != 0)
+            {
+                fixed_precision_integer_part(value.high, value.low, s, integer_high, integer_low);
+            }
+
+            const auto r = fixed_precision_write_integer<Format>(digits, digits + sizeof(digits), integer_high, integer_low,
+                                                                 value.exponent > 0 ? value.exponent : 0);
+            if (*digits != '0')
+            {
+                digit_count = static_cast<int>(r.ptr - digits);
+                decimal_exponent = digit_count - 1;
+            }
+        }
+
+        if (s != 0)
+        {
+            fixed_precision_fraction<Format> fraction(value.high, value.low, s);
+
+            // Leading zeros of a value below one are skipped 19 at a time
+            if (digit_count == 0)
+            {
+                decimal_exponent = -1;
+                std::uint64_t chunk = fraction.next_digits(19);
+                while (chunk == 0)
+                {
+                    decimal_exponent -= 19;
+                    chunk = fraction.next_digits(19);
+                }
+
+                digit_count = num_digits(chunk);
+                decimal_exponent -= 19 - digit_count;
+                fixed_precision_write_digits(chunk, digit_count, digits);
+            }
+
+            while (digit_count <= printed_digits && !fraction.is_zero())
+            {
+                fixed_precision_write_digits(fraction.next_digits(19), 19, digits + digit_count);
+                digit_count += 19;
+            }
+
+            sticky = !fraction.is_zero();
+        }
+    }
+    else
+    {
+        digits[0] = '0';
+        digit_count = 1;
+    }
+
+    // Round to nearest with ties to even on the first discarded digit, or in the direction of mode if any is non-zero
+    if (digit_count > printed_digits)
+    {
+        const char rounding_digit = digits[printed_digits];
+        for (int i = printed_digits + 1; i < digit_count && !sticky; ++i)
+        {
+            sticky = digits[i] != '0';
+        }
+
+        digit_count = printed_digits;
+        const bool round_up = mode == rounding_mode::to_nearest ?
+                              rounding_digit > '5' || (rounding_digit == '5' && (sticky || ((digits[printed_digits - 1] - '0') & 1) != 0)) :
+                              (rounding_digit != '0' || sticky) && rounds_magnitude_up(mode, value.is_negative);
+        if (round_up)
+        {
+            if (fixed_precision_round_up(digits, digits + digit_count))
+            {
+                digits[0] = '1';
+                ++decimal_exponent;
+            }
+        }
+    }
+
+    // printf writes at least two exponent digits
+    const int abs_exponent = decimal_exponent < 0 ? -decimal_exponent : decimal_exponent;
+    const int exponent_digits = abs_exponent < 10 ? 2 : num_digits(static_cast<std::uint32_t>(abs_exponent));
+    const std::ptrdiff_t total_length = static_cast<std::ptrdiff_t>(value.is_negative) + 1 +
+                                        (precision != 0 ? static_cast<std::ptrdiff_t>(precision) + 1 : 0) + 2 + exponent_digits;
+    if (total_length > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (value.is_negative)
+    {
+        *first++ = '-';
+    }
+
+    *first++ = digits[0];
+    if (precision != 0)
+    {
+        *first++ = '.';
+        const auto copied = static_cast<std::size_t>(digit_count - 1);
+        std::memcpy(first, digits + 1, copied);
+        std::memset(first + copied, '0', static_cast<std::size_t>(precision) - copied);
+        first += precision;
+    }
+
+    *first++ = 'e';
+    *first++ = decimal_exponent < 0 ? '-' : '+';
+    fixed_precision_write_digits(static_cast<std::uint64_t>(abs_exponent), exponent_digits, first);
+
+    return {first + exponent_digits, std::errc()};
+}
+
+// Where the part of a quotient after its integer digits is relative to one half
+enum class fixed_precision_remainder
+{
+    zero,
+    below_half,
+    half,
+    above_half
+};
+
+// The integer part q of m * 2^e * 10^n with the position of the rest, if it follows from 64-bit integer
+// arithmetic on the 24 bit significand m: m * 10^n shifted by e, or m * 2^e divided by 10^-n
+inline bool scientific_binary32_quotient(std::uint64_t m, int e, int n, std::uint64_t& q, fixed_precision_remainder& remainder) noexcept
+{
+    std::uint64_t numerator = m;
+    std::uint64_t divisor = 1;
+    if (n >= 0)
+    {
+        // 10^12 * 2^24 < 2^64
+        if (n > 12)
+        {
+            return false;
+        }
+        numerator *= num_digits_tables::powers_of_10_64[n];
+    }
+    else
+    {
+        if (n < -19)
+        {
+            return false;
+        }
+        divisor = num_digits_tables::powers_of_10_64[-n];
+    }
+
+    std::uint64_t r;
+    std::uint64_t half;
+    if (e >= 0)
+    {
+        if (e > 63 || (numerator >> (63 - e)) != 0)
+        {
+            return false;
+        }
+        numerator <<= e;
+        q = numerator / divisor;
+        r = numerator % divisor;
+        half = divisor - r;
+    }
+    else if (n >= 0)
+    {
+        // A power of two divisor is a shift
+        if (-e > 63)
+        {
+            return false;
+        }
+        q = numerator >> -e;
+        r = numerator & ((UINT64_C(1) << -e) - 1);
+        half = UINT64_C(1) << (-e - 1);
+    }
+    else
+    {
+        if ((divisor >> (63 + e)) != 0)
+        {
+            return false;
+        }
+        divisor <<= -e;
+        q = numerator / divisor;
+        r = numerator % divisor;
+        half = divisor - r;
+    }
+
+    // After a division half is the distance of r to the divisor, which r equals at one half
+    remainder = r == 0 ? fixed_precision_remainder::zero :
+                r < half ? fixed_precision_remainder::below_half :
+                r == half ? fixed_precision_remainder::half : fixed_precision_remainder::above_half;
+    return true;
+}
+
+// Scientific notation of a binary32 value with precision digits after the point from 64-bit integer arithmetic.
+// The decimal exponent k of the first digit is the estimate from the binary exponent or one more, so the value times
+// 10^(precision - k) is an integer of precision + 1 digits and a rest that rounds it. This covers the normal values
+// in about [1e-8, 1e19] with the usual precisions. Everything else, and zero, is printed as the double of the same value
+inline bool to_chars_scientific_binary32(char* first, char* last, float value, int precision, rounding_mode mode,
+                                         to_chars_result& result) noexcept
+{
+    const auto decomposed = fixed_precision_decompose(value);
+    if (decomposed.low == 0 || precision > 17)
+    {
+        return false;
+    }
+
+    const int significant_digits = precision + 1;
+    const int binary_exponent = decomposed.exponent + 63 - countl_zero(decomposed.low);
+
+    // floor(binary_exponent * log10(2)) for |binary_exponent| < 1700
+    int decimal_exponent = (binary_exponent * 315653) >> 20;
+
+    std::uint64_t q;
+    auto remainder = fixed_precision_remainder::zero;
+    if (!scientific_binary32_quotient(decomposed.low, decomposed.exponent, significant_digits - 1 - decimal_exponent, q, remainder))
+    {
+        return false;
+    }
+    if (q >= num_digits_tables::powers_of_10_64[significant_digits])
+    {
+        // The estimate was one too low, so there is one more digit, which joins the rest
+        const auto dropped_digit = static_cast<unsigned>(q % 10);
+        q /= 10;
+        ++decimal_exponent;
+        const bool sticky = remainder != fixed_precision_remainder::zero;
+        remainder = dropped_digit > 5 || (dropped_digit == 5 && sticky) ? fixed_precision_remainder::above_half :
+                    dropped_digit == 5 ? fixed_precision_remainder::half :
+                    dropped_digit != 0 || sticky ? fixed_precision_remainder::below_half : fixed_precision_remainder::zero;
+    }
+
+    const bool round_up = mode == rounding_mode::to_nearest ?
+                          remainder == fixed_precision_remainder::above_half || (remainder == fixed_precision_remainder::half && (q & 1) != 0) :
+                          remainder != fixed_precision_remainder::zero && rounds_magnitude_up(mode, decomposed.is_negative);
+    if (round_up && ++q == num_digits_tables::powers_of_10_64[significant_digits])
+    {
+        q = num_digits_tables::powers_of_10_64[precision];
+        ++decimal_exponent;
+    }
+
+    // The decimal exponent of a normal binary32 value always has two digits
+    const std::ptrdiff_t total_length = static_cast<std::ptrdiff_t>(decomposed.is_negative) + 1 +
+                                        (precision != 0 ? static_cast<std::ptrdiff_t>(precision) + 1 : 0) + 4;
+    if (total_length > last - first)
+    {
+        result = {last, std::errc::result_out_of_range};
+        return true;
+    }
+
+    if (decomposed.is_negative)
+    {
+        *first++ = '-';
+    }
+
+    if (precision != 0)
+    {
+        // The digits are written one place to the right, and the first one is moved in front of the point
+        fixed_precision_write_digits(q, significant_digits, first + 1);
+        first[0] = first[1];
+        first[1] = '.';
+        first += significant_digits + 1;
+    }
+    else
+    {
+        *first++ = static_cast<char>('0' + q);
+    }
+
+    *first++ = 'e';
+    *first++ = decimal_exponent < 0 ? '-' : '+';
+    fixed_precision_write_digits(static_cast<std::uint64_t>(decimal_exponent < 0 ? -decimal_exponent : decimal_exponent), 2, first);
+
+    result = {first + 2, std::errc()};
+    return true;
+}
+
+template <typename T>
+inline to_chars_result to_chars_scientific_exact(char* first, char* last, T value, int precision, rounding_mode mode = rounding_mode::to_nearest) noexcept
+{
+    BOOST_CHARCONV_COUNT_SLOW_PATH(to_chars_exact);
+    BOOST_CHARCONV_SAMPLE_SLOW_PATH_VALUE(to_chars_exact, slow_path_sample_digits<T>(), value);
+    return to_chars_scientific_exact_impl<typename fixed_precision_format<T>::type>(first, last, fixed_precision_decompose(value), precision, mode);
+}
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_TO_CHARS_FIXED_PRECISION_HPP
@@ -0,0 +1,1272 @@
+// Copyright 2022 Peter Dimov
+// Copyright 2023 Matt Borland
+// Copyright 2023 Junekey Jeon
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_TO_CHARS_FLOAT_IMPL_HPP
+#define BOOST_CHARCONV_DETAIL_TO_CHARS_FLOAT_IMPL_HPP
+
+#include <boost/charconv/detail/apply_sign.hpp>
+#include <boost/charconv/detail/integer_search_trees.hpp>
+#include <boost/charconv/detail/memcpy.hpp>
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/dragonbox/floff.hpp>
+#include <boost/charconv/detail/bit_layouts.hpp>
+#include <boost/charconv/detail/dragonbox/dragonbox.hpp>
+#include <boost/charconv/detail/to_chars_integer_impl.hpp>
+#include <boost/charconv/detail/to_chars_fixed_precision.hpp>
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/detail/emulated128.hpp>
+#include <boost/charconv/detail/fallback_routines.hpp>
+#include <boost/charconv/detail/buffer_sizing.hpp>
+#include <boost/charconv/detail/slow_path_counters.hpp>
+#include <boost/charconv/config.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <type_traits>
+#include <array>
+#include <limits>
+#include <utility>
+#include <cstring>
+#include <cstdint>
+#include <climits>
+#include <cmath>
+
+#ifdef BOOST_CHARCONV_DEBUG_FIXED
+#include <iomanip>
+#include <iostream>
+#endif
+
+#if (BOOST_CHARCONV_LDBL_BITS == 80 || BOOST_CHARCONV_LDBL_BITS == 128) || defined(BOOST_CHARCONV_HAS_FLOAT128)
+#  include <boost/charconv/detail/ryu/ryu_generic_128.hpp>
+#  include <boost/charconv/detail/issignaling.hpp>
+#endif
+
+namespace boost {
+namespace charconv {
+namespace detail {
+
+template <typename Real>
+inline to_chars_result to_chars_nonfinite(char* first, char* last, Real value, int classification) noexcept;
+
+#if BOOST_CHARCONV_LDBL_BITS == 128 || defined(BOOST_CHARCONV_HAS_STDFLOAT128)
+
+template <typename Real>
+inline to_chars_result to_chars_nonfinite(char* first, char* last, Real value, int classification) noexcept
+{
+    std::ptrdiff_t offset {};
+    std::ptrdiff_t buffer_size = last - first;
+
+    if (classification == FP_NAN)
+    {
+        bool is_negative = false;
+        const bool is_signaling = issignaling(value);
+
+        if (std::signbit(value))
+        {
+            is_negative = true;
+            *first++ = '-';
+        }
+
+        if (is_signaling && buffer_size >= (9 + static_cast<int>(is_negative)))
+        {
+            std::memcpy(first, "nan(snan)", 9);
+            offset = 9 + static_cast<int>(is_negative);
+        }
+        else if (is_negative && buffer_size >= 9)
+        {
+            std::memcpy(first, "nan(ind)", 8);
+            offset = 8;
+        }
+        else if (!is_negative && !is_signaling && buffer_size >= 3)
+        {
+            std::memcpy(first, "nan", 3);
+            offset = 3;
+        }
+        else
+        {
+            // Avoid buffer overflow
+            return { first, std::errc::result_out_of_range };
+        }
+
+    }
+    else if (classification == FP_INFINITE)
+    {
+        auto sign_bit_value = std::signbit(value);
+        if (sign_bit_value && buffer_size >= 4)
+        {
+            std::memcpy(first, "-inf", 4);
+            offset = 4;
+        }
+        else if (!sign_bit_value && buffer_size >= 3)
+        {
+            std::memcpy(first, "inf", 3);
+            offset = 3;
+        }
+        else
+        {
+            // Avoid buffer overflow
+            return { first, std::errc::result_out_of_range };
+        }
+    }
+    else
+    {
+        BOOST_UNREACHABLE_RETURN(first);
+    }
+
+    return { first + offset, std::errc() };
+}
+
+#endif // BOOST_CHARCONV_LDBL_BITS == 128
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+
+// GCC-5 evaluates the following specialization for other types
+#if defined(__GNUC__) && __GNUC__ == 5
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wfloat-conversion"
+#endif
+
+template <>
+inline to_chars_result to_chars_nonfinite<__float128>(char* first, char* last, __float128 value, int classification) noexcept
+{
+    std::ptrdiff_t offset {};
+    std::ptrdiff_t buffer_size = last - first;
+
+    IEEEbinary128 bits;
+    std::memcpy(&bits, &value, sizeof(value));
+    const bool is_negative = bits.sign;
+
+    if (classification == FP_NAN)
+    {
+        const bool is_signaling = issignaling(value);
+
+        if (is_negative)
+        {
+            *first++ = '-';
+        }
+
+        if (is_signaling && buffer_size >= (9 + static_cast<int>(is_negative)))
+        {
+            std::memcpy(first, "nan(snan)", 9);
+            offset = 9 + static_cast<int>(is_negative);
+        }
+        else if (is_negative && buffer_size >= 9)
+        {
+            std::memcpy(first, "nan(ind)", 8);
+            offset = 8;
+        }
+        else if (!is_negative && !is_signaling && buffer_size >= 3)
+        {
+            std::memcpy(first, "nan", 3);
+            offset = 3;
+        }
+        else
+        {
+            // Avoid buffer overflow
+            return { first, std::errc::result_out_of_range };
+        }
+
+    }
+    else if (classification == FP_INFINITE)
+    {
+        if (is_negative && buffer_size >= 4)
+        {
+            std::memcpy(first, "-inf", 4);
+            offset = 4;
+        }
+        else if (!is_negative && buffer_size >= 3)
+        {
+            std::memcpy(first, "inf", 3);
+            offset = 3;
+        }
+        else
+        {
+            // Avoid buffer overflow
+            return { first, std::errc::result_out_of_range };
+        }
+    }
+    else
+    {
+        BOOST_UNREACHABLE_RETURN(first);
+    }
+
+    return { first + offset, std::errc() };
+}
+
+#if defined(__GNUC__) && __GNUC__ == 5
+# pragma GCC diagnostic pop
+#endif
+
+#endif // BOOST_CHARCONV_HAS_FLOAT128
+
+template <typename Unsigned_Integer, typename Real, typename std::enable_if<!std::is_same<Unsigned_Integer, uint128>::value, bool>::type = true>
+Unsigned_Integer convert_value(Real value) noexcept
+{
+    Unsigned_Integer temp;
+    std::memcpy(&temp, &value, sizeof(Real));
+    return temp;
+}
+
+template <typename Unsigned_Integer, typename Real, typename std::enable_if<std::is_same<Unsigned_Integer, uint128>::value, bool>::type = true>
+Unsigned_Integer convert_value(Real value) noexcept
+{
+    trivial_uint128 trivial_bits; // NOLINT : Does not need to be init since we memcpy the next step
+    std::memcpy(&trivial_bits, &value, sizeof(Real));
+    Unsigned_Integer temp {trivial_bits};
+    return temp;
+}
+#ifdef BOOST_MSVC
+# pragma warning(push)
+# pragma warning(disable: 4127) // Conditional expression is constant (BOOST_IF_CONSTEXPR in pre-C++17 modes)
+#endif
+
+template <typename Real, typename Unsigned_Integer>
+inline std::uint64_t extract_exp(Real, Unsigned_Integer uint_value, int significand_bits) noexcept
+{
+    // Shift out the sign bit as well, otherwise negative subnormals would be taken for normal values
+    return static_cast<std::uint64_t>(static_cast<Unsigned_Integer>(uint_value << 1) >> (significand_bits + 1));
+}
+
+#if BOOST_CHARCONV_LDBL_BITS == 80
+
+// In the 80-bit long double case we need to ignore the pad on top of the high bits
+// and the 64-bits of significand in the low bits
+// This is easiest to accomplish with a mask rather than all kinds of shifting
+template <>
+inline std::uint64_t extract_exp<long double, uint128>(long double, uint128 uint_value, int) noexcept
+{
+
+    constexpr auto exp_mask = uint128{UINT64_C(0x7FFF), UINT64_C(0)};
+    auto exponent = uint_value & exp_mask;
+    return exponent.high;
+}
+
+#endif
+
+template <typename Real>
+to_chars_result to_chars_hex(char* first, char* last, Real value, int precision, char decimal_point = '.') noexcept
+{
+    // Sanity check our bounds
+    const std::ptrdiff_t buffer_size = last - first;
+    auto real_precision = get_real_precision<Real>(precision);
+
+    if (precision != -1)
+    {
+        real_precision = precision;
+    }
+
+    if (buffer_size < real_precision || first > last)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    // Extract the significand and the exponent
+    using type_layout = typename std::conditional<std::is_same<Real, float>::value, ieee754_binary32,
+            typename std::conditional<std::is_same<Real, double>::value, ieee754_binary64,
+                    #ifdef BOOST_CHARCONV_HAS_FLOAT128
+                    typename std::conditional<std::is_same<Real, __float128>::value || BOOST_CHARCONV_LDBL_BITS == 128, ieee754_binary128, ieee754_binary80>::type
+                    #elif BOOST_CHARCONV_LDBL_BITS == 128
+                    ieee754_binary128
+                    #elif BOOST_CHARCONV_LDBL_BITS == 80
+                    ieee754_binary80
+                    #else
+                    ieee754_binary64
+                    #endif
+            >::type>::type;
+
+    using Unsigned_Integer = typename std::conditional<std::is_same<Real, float>::value, std::uint32_t,
+            typename std::conditional<std::is_same<Real, double>::value, std::uint64_t, uint128>::type>::type;
+
+
+    Unsigned_Integer uint_value {convert_value<Unsigned_Integer>(value)};
+
+    const Unsigned_Integer denorm_mask = (Unsigned_Integer(1) << (type_layout::significand_bits)) - 1;
+    const Unsigned_Integer significand = uint_value & denorm_mask;
+    std::uint64_t exponent = extract_exp(value, uint_value, type_layout::significand_bits);
+
+    BOOST_IF_CONSTEXPR (!(std::is_same<Real, float>::value || std::is_same<Real, double>::value
+                        #if BOOST_CHARCONV_LDBL_BITS == 80
+                        || std::is_same<Real, long double>::value
+                        #endif
+                        ))
+    {
+        exponent += 2;
+    }
+
+    // Align the significand to the hexit boundaries (i.e. divisible by 4)
+    constexpr auto hex_precision = std::is_same<Real, float>::value ? 6 :
+                                      std::is_same<Real, double>::value ? 13
+                                      #if BOOST_CHARCONV_LDBL_BITS == 80
+                                      : std::is_same<Real, long double>::value ? 15
+                                      #endif
+                                      : 28;
+
+    constexpr auto nibble_bits = CHAR_BIT / 2;
+    constexpr auto hex_bits = hex_precision * nibble_bits;
+    const Unsigned_Integer hex_mask = (static_cast<Unsigned_Integer>(1) << hex_bits) - 1;
+
+    Unsigned_Integer aligned_significand;
+    BOOST_IF_CONSTEXPR (std::is_same<Real, float>::value)
+    {
+        aligned_significand = significand << 1;
+    }
+    else
+    {
+        aligned_significand = significand;
+    }
+
+    // Adjust the exponent based on the bias as described in IEEE 754
+    std::int64_t unbiased_exponent;
+    if (exponent == 0 && significand != 0)
+    {
+        // Subnormal value since we already handled zero
+        unbiased_exponent = 1 + type_layout::exponent_bias;
+    }
+    else
+    {
+        aligned_significand |= static_cast<Unsigned_Integer>(1) << hex_bits;
+        unbiased_exponent = static_cast<std::int64_t>(exponent) + type_layout::exponent_bias;
+    }
+
+    // Bounds check the exponent
+    BOOST_IF_CONSTEXPR (std::is_same<Real, float>::value)
+    {
+        if (unbiased_exponent > 127)
+        {
+            unbiased_exponent -= 256;
+        }
+    }
+    else BOOST_IF_CONSTEXPR (std::is_same<Real, double>::value)
+    {
+        if (unbiased_exponent > 1023)
+        {
+            unbiased_exponent -= 2048;
+        }
+    }
+    else BOOST_IF_CONSTEXPR (std::is_same<Real, long double>::value)
+    {
+        #if BOOST_CHARCONV_LDBL_BITS == 80
+        while (unbiased_exponent > 16383)
+        {
+            unbiased_exponent -= 32768;
+        }
+        unbiased_exponent -= 3;
+        #else
+        while (unbiased_exponent > 16383)
+        {
+            unbiased_exponent -= 32768;
+        }
+        #endif
+    }
+    else
+    {
+        while (unbiased_exponent > 16383)
+        {
+            unbiased_exponent -= 32768;
+        }
+    }
+
+    const std::uint32_t abs_unbiased_exponent = unbiased_exponent < 0 ? static_cast<std::uint32_t>(-unbiased_exponent) :
+                                                static_cast<std::uint32_t>(unbiased_exponent);
+
+    // Bounds check
+    const std::ptrdiff_t total_length = total_buffer_length(real_precision, abs_unbiased_exponent, (value < 0));
+    if (total_length > buffer_size)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    // Round if required
+    if (real_precision < hex_precision)
+    {
+        const int lost_bits = (hex_precision - real_precision) * nibble_bits;
+        const Unsigned_Integer lsb_bit = aligned_significand;
+        const Unsigned_Integer round_bit = aligned_significand << 1;
+        const Unsigned_Integer tail_bit = round_bit - 1;
+        const Unsigned_Integer round = round_bit & (tail_bit | lsb_bit) & (static_cast<Unsigned_Integer>(1) << lost_bits);
+        aligned_significand += round;
+    }
+
+    // Print the sign
+    if (value < 0)
+    {
+        *first++ = '-';
+    }
+
+    // Print the integral part
+    #if BOOST_CHARCONV_LDBL_BITS == 80
+    std::uint32_t leading_nibble;
+    BOOST_IF_CONSTEXPR (std::is_same<Real, long double>::value)
+    {
+        leading_nibble = static_cast<std::uint32_t>(significand >> hex_bits);
+    }
+    else
+    {
+        leading_nibble = static_cast<std::uint32_t>(aligned_significand >> hex_bits);
+    }
+    #else
+    const auto leading_nibble = static_cast<std::uint32_t>(aligned_significand >> hex_bits);
+    #endif
+
+    BOOST_CHARCONV_ASSERT(leading_nibble < 16);
+    *first++ = digit_tables::digit_table[leading_nibble];
+    
+    aligned_significand &= hex_mask;
+
+    // Print the fractional part
+    if (real_precision > 0)
+    {
+        *first++ = decimal_point;
+        std::int32_t remaining_bits = hex_bits;
+
+        while (true)
+        {
+            remaining_bits -= nibble_bits;
+            const auto current_nibble = static_cast<std::uint32_t>(aligned_significand >> remaining_bits);
+            *first++ = digit_tables::digit_table[current_nibble];
+
+            --real_precision;
+            if (real_precision == 0)
+            {
+                break;
+            }
+            else if (remaining_bits == 0)
+            {
+                // Do not print trailing zeros with unspecified precision
+                if (precision != -1)
+                {
+                    std::memset(first, '0', static_cast<std::size_t>(real_precision));
+                    first += real_precision;
+                }
+                break;
+            }
+
+            // Mask away the hexit we just printed
+            aligned_significand &= (static_cast<Unsigned_Integer>(1) << remaining_bits) - 1;
+        }
+    }
+
+    // Remove any trailing zeros if the precision was unspecified
+    if (precision == -1)
+    {
+        --first;
+        while (*first == '0')
+        {
+            --first;
+        }
+        ++first;
+    }
+
+    // Print the exponent
+    *first++ = 'p';
+    if (unbiased_exponent < 0)
+    {
+        *first++ = '-';
+    }
+    else
+    {
+        *first++ = '+';
+    }
+
+    return to_chars_int(first, last, abs_unbiased_exponent);
+}
+
+#ifdef BOOST_MSVC
+# pragma warning(pop)
+#endif
+
+// Shortest representation in fixed notation for values in [1, 1e16), from the Dragonbox decimal of value
+template <typename Real, typename Decimal>
+to_chars_result to_chars_fixed_impl(char* first, char* last, Real value, const Decimal& value_struct, char decimal_point) noexcept
+{
+    auto abs_value = std::abs(value);
+    int num_dig = num_digits(value_struct.significand);
+
+    // The sign, then the digits followed by the zeros of an integer, the digits with '.' among them,
+    // or "0." with the zeros and digits of the fraction
+    const int integer_digits = num_dig + value_struct.exponent;
+    const std::ptrdiff_t total_length = static_cast<std::ptrdiff_t>(value_struct.is_negative) +
+                                        (value_struct.exponent >= 0 ? integer_digits :
+                                         integer_digits > 0 ? num_dig + 1 : 2 - value_struct.exponent);
+    if (first > last || total_length > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (value_struct.is_negative)
+    {
+        *first++ = '-';
+    }
+
+    auto r = to_chars_integer_impl(first, last, value_struct.significand);
+    if (r.ec != std::errc())
+    {
+        return r;
+    }
+
+    // Bounds check
+    if (abs_value >= 1)
+    {
+        if (value_struct.exponent < 0)
+        {
+            std::memmove(r.ptr + value_struct.exponent + 1, r.ptr + value_struct.exponent,
+                         static_cast<std::size_t>(-value_struct.exponent));
+            r.ptr[value_struct.exponent] = decimal_point;
+            ++r.ptr;
+        }
+
+        // Shortest integral values below 1e16 are exact, so the positive exponent is the number of trailing zeros
+        if (value_struct.exponent > 0)
+        {
+            std::memset(r.ptr, '0', static_cast<std::size_t>(value_struct.exponent));
+            r.ptr += value_struct.exponent;
+        }
+    }
+    else
+    {
+        #ifdef BOOST_CHARCONV_DEBUG_FIXED
+        std::cerr << std::setprecision(std::numeric_limits<Real>::digits10) << "Value: " << value
+                  << "\n  Buf: " << first
+                  << "\n  sig: " << value_struct.significand
+                  << "\n  exp: " << value_struct.exponent << std::endl;
+        #endif
+
+        const auto offset_bytes = static_cast<std::size_t>(-value_struct.exponent - num_dig);
+
+        std::memmove(first + 2 + static_cast<std::size_t>(value_struct.is_negative) + offset_bytes,
+                     first + static_cast<std::size_t>(value_struct.is_negative),
+                     static_cast<std::size_t>(-value_struct.exponent) - offset_bytes);
+
+        first[static_cast<std::size_t>(value_struct.is_negative)] = '0';
+        first[static_cast<std::size_t>(value_struct.is_negative) + 1U] = decimal_point;
+        first += 2;
+        r.ptr += 2;
+
+        while (num_dig < -value_struct.exponent)
+        {
+            *first++ = '0';
+            ++num_dig;
+            ++r.ptr;
+        }
+    }
+
+    return { r.ptr, std::errc() };
+}
+
+template <typename Real>
+to_chars_result to_chars_fixed_impl(char* first, char* last, Real value, char decimal_point = '.') noexcept
+{
+    return to_chars_fixed_impl(first, last, value, boost::charconv::detail::to_decimal(value), decimal_point);
+}
+
+// Shortest representation in fixed notation for the nonzero values below 1 or at least max_value: the Dragonbox digits
+// followed by the zeros up to the decimal point, or "0." and the zeros before the digits. Like the long double printer
+// the digits are those of the shortest representation, not the exact value. The length follows from the decimal exponent,
+// so nothing is written to a buffer that is too small, and the zeros, up to several hundred of them, are filled in one go
+template <typename Decimal>
+to_chars_result to_chars_fixed_shortest(char* first, char* last, const Decimal& value_struct, char decimal_point) noexcept
+{
+    const int num_dig = num_digits(value_struct.significand);
+    const int exponent = value_struct.exponent;
+    BOOST_CHARCONV_ASSERT(exponent >= 0 || -exponent >= num_dig);
+
+    const std::ptrdiff_t total_length = static_cast<std::ptrdiff_t>(value_struct.is_negative) +
+                                        (exponent >= 0 ? num_dig + exponent : 2 - exponent);
+    if (total_length > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (value_struct.is_negative)
+    {
+        *first++ = '-';
+    }
+
+    if (exponent >= 0)
+    {
+        first = to_chars_integer_impl(first, last, value_struct.significand).ptr;
+        std::memset(first, '0', static_cast<std::size_t>(exponent));
+        return {first + exponent, std::errc()};
+    }
+
+    const auto leading_zeros = static_cast<std::size_t>(-exponent - num_dig);
+    *first++ = '0';
+    *first++ = decimal_point;
+    std::memset(first, '0', leading_zeros);
+    return to_chars_integer_impl(first + leading_zeros, last, value_struct.significand);
+}
+
+// printf's %.*e. floff is fast and correct for normal values with the precisions that matter in practice,
+// and everything else goes to the exact multiword path. floff only rounds to nearest, so the directed modes do too
+inline to_chars_result to_chars_scientific_precision(char* first, char* last, double value, int precision,
+                                                     rounding_mode mode = rounding_mode::to_nearest) noexcept
+{
+    constexpr int max_floff_precision = 17;
+    if (precision > max_floff_precision || std::fpclassify(value) == FP_SUBNORMAL || mode != rounding_mode::to_nearest)
+    {
+        return to_chars_scientific_exact(first, last, value, precision, mode);
+    }
+
+    BOOST_CHARCONV_COUNT_SLOW_PATH(to_chars_floff);
+    BOOST_CHARCONV_SAMPLE_SLOW_PATH_VALUE(to_chars_floff, slow_path_sample_digits<double>(), value);
+
+    // floff only checks the buffer for the digits, so a buffer that might be too small
+    // for the exponent is handled by printing into a local buffer first
+    constexpr std::ptrdiff_t max_length = max_floff_precision + 8;
+    if (last - first >= max_length)
+    {
+        return floff<floff_main_cache, floff_extended_cache>(value, precision, first, last);
+    }
+
+    char buffer[max_length];
+    const auto r = floff<floff_main_cache, floff_extended_cache>(value, precision, buffer, buffer + sizeof(buffer));
+    const auto length = r.ptr - buffer;
+    if (length > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    std::memcpy(first, buffer, static_cast<std::size_t>(length));
+    return {first + length, std::errc()};
+}
+
+// A binary32 value with a precision that its own integer path can not print goes through the double path
+inline to_chars_result to_chars_scientific_precision(char* first, char* last, float value, int precision,
+                                                     rounding_mode mode = rounding_mode::to_nearest) noexcept
+{
+    to_chars_result r;
+    if (to_chars_scientific_binary32(first, last, value, precision, mode, r))
+    {
+        return r;
+    }
+
+    return to_chars_scientific_precision(first, last, static_cast<double>(value), precision, mode);
+}
+
+// Types without a floff path always use the exact multiword path
+template <typename T>
+inline to_chars_result to_chars_scientific_precision(char* first, char* last, T value, int precision,
+                                                     rounding_mode mode = rounding_mode::to_nearest) noexcept
+{
+    return to_chars_scientific_exact(first, last, value, precision, mode);
+}
+
+// Writes the significant digits [digits, digits + num_digits), without trailing zeros, of a value whose first digit
+// has the decimal exponent decimal_exponent the way printf's %.*g does with significant_digits as precision
+inline to_chars_result print_general_precision(char* first, char* last, bool is_negative, const char* digits, int num_digits,
+                                               int decimal_exponent, int significant_digits, chars_format_options options) noexcept
+{
+    // The exponent has a sign and at least two digits
+    const auto abs_exponent = static_cast<std::uint32_t>(decimal_exponent < 0 ? -decimal_exponent : decimal_exponent);
+    const int exponent_digits = abs_exponent < 100 ? 2 : abs_exponent < 1000 ? 3 : 4;
+
+    const std::ptrdiff_t sign_length = is_negative ? 1 : 0;
+    std::ptrdiff_t total_length;
+    const bool use_scientific = decimal_exponent < -4 || decimal_exponent >= significant_digits;
+    if (use_scientific)
+    {
+        total_length = sign_length + num_digits + (num_digits > 1 ? 1 : 0) + 2 + exponent_digits;
+    }
+    else if (decimal_exponent < 0)
+    {
+        total_length = sign_length + 1 - decimal_exponent + num_digits;
+    }
+    else
+    {
+        const int integer_digits = decimal_exponent + 1;
+        total_length = sign_length + (num_digits > integer_digits ? num_digits + 1 : integer_digits);
+    }
+
+    if (total_length > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (is_negative)
+    {
+        *first++ = '-';
+    }
+
+    if (use_scientific)
+    {
+        *first++ = digits[0];
+        if (num_digits > 1)
+        {
+            *first++ = options.decimal_point;
+            std::memcpy(first, digits + 1, static_cast<std::size_t>(num_digits - 1));
+            first += num_digits - 1;
+        }
+
+        *first++ = options.exponent;
+        *first++ = decimal_exponent < 0 ? '-' : '+';
+        if (abs_exponent < 10)
+        {
+            *first++ = '0';
+        }
+        return to_chars_integer_impl(first, last, abs_exponent);
+    }
+    else if (decimal_exponent < 0)
+    {
+        const auto leading_zeros = static_cast<std::size_t>(-decimal_exponent - 1);
+        *first++ = '0';
+        *first++ = options.decimal_point;
+        std::memset(first, '0', leading_zeros);
+        first += leading_zeros;
+        std::memcpy(first, digits, static_cast<std::size_t>(num_digits));
+        first += num_digits;
+    }
+    else
+    {
+        const int integer_digits = decimal_exponent + 1;
+        if (num_digits > integer_digits)
+        {
+            std::memcpy(first, digits, static_cast<std::size_t>(integer_digits));
+            first += integer_digits;
+            *first++ = options.decimal_point;
+            std::memcpy(first, digits + integer_digits, static_cast<std::size_t>(num_digits - integer_digits));
+            first += num_digits - integer_digits;
+        }
+        else
+        {
+            std::memcpy(first, digits, static_cast<std::size_t>(num_digits));
+            std::memset(first + num_digits, '0', static_cast<std::size_t>(integer_digits - num_digits));
+            first += integer_digits;
+        }
+    }
+
+    return {first, std::errc()};
+}
+
+// The significant digits of a value printed in scientific notation with a precision, and the decimal exponent of the first one
+struct scientific_digits
+{
+    char* digits;
+    int num_digits;
+    int decimal_exponent;
+    bool is_negative;
+};
+
+// Prints value with significant_digits digits in scientific notation into buffer, which has room for them with the sign,
+// the dot and the exponent, and moves the digits together over the dot. Called with the exponent character 'e'
+template <typename T>
+inline scientific_digits to_scientific_digits(char* buffer, std::size_t buffer_size, T value, int significant_digits,
+                                              rounding_mode mode) noexcept
+{
+    const auto r = to_chars_scientific_precision(buffer, buffer + buffer_size, value, significant_digits - 1, mode);
+    char* const digits_first = buffer + static_cast<std::ptrdiff_t>(buffer[0] == '-');
+
+    const char* exponent = digits_first;
+    while (*exponent != 'e')
+    {
+        ++exponent;
+    }
+
+    int decimal_exponent = 0;
+    for (const char* ptr = exponent + 2; ptr != r.ptr; ++ptr)
+    {
+        decimal_exponent = decimal_exponent * 10 + (*ptr - '0');
+    }
+    if (exponent[1] == '-')
+    {
+        decimal_exponent = -decimal_exponent;
+    }
+
+    int num_digits = 0;
+    for (const char* ptr = digits_first; ptr != exponent; ++ptr)
+    {
+        if (*ptr != '.')
+        {
+            digits_first[num_digits++] = *ptr;
+        }
+    }
+
+    return {digits_first, num_digits, decimal_exponent, digits_first != buffer};
+}
+
+// printf's %.*g. The precision is the number of significant digits P, which are printed in scientific notation first.
+// With the decimal exponent X the result stays scientific when X < -4 or X >= P, and is written in fixed notation otherwise.
+// Either way trailing zeros of the fraction are removed
+template <typename T>
+inline to_chars_result to_chars_general_precision(char* first, char* last, T value, int precision,
+                                                  chars_format_options options = chars_format_options(),
+                                                  rounding_mode mode = rounding_mode::to_nearest) noexcept
+{
+    constexpr int max_significant_digits = fixed_precision_format<T>::type::max_significant_digits;
+    int significant_digits = precision == 0 ? 1 : precision;
+
+    // The decimal exponent has fewer digits than the limit, so fixed notation is always picked for larger precisions
+    // and the trailing zeros that make up the difference would be removed anyway
+    if (significant_digits > max_significant_digits)
+    {
+        significant_digits = max_significant_digits;
+    }
+
+    // Sign, digits, dot and the exponent
+    BOOST_CHARCONV_SCRATCH_ARRAY(char, buffer, static_cast<std::size_t>(max_significant_digits) + 10U, scratch_general_digits);
+    auto d = to_scientific_digits(buffer, sizeof(buffer), value, significant_digits, mode);
+    while (d.num_digits > 1 && d.digits[d.num_digits - 1] == '0')
+    {
+        --d.num_digits;
+    }
+
+    return print_general_precision(first, last, d.is_negative, d.digits, d.num_digits, d.decimal_exponent, significant_digits, options);
+}
+
+// Decimal exponents of the first and the last SI prefix
+constexpr int min_si_exponent = -30;
+constexpr int max_si_exponent = 30;
+
+// The SI prefix of the power of 1000 10^exponent, with micro as U+00B5 in UTF-8
+inline const char* si_prefix(int exponent) noexcept
+{
+    static constexpr const char* prefixes[] = {
+        "q", "r", "y", "z", "a", "f", "p", "n", "\xC2\xB5", "m", "", "k", "M", "G", "T", "P", "E", "Z", "Y", "R", "Q"
+    };
+    return prefixes[(exponent - min_si_exponent) / 3];
+}
+
+// The exponent of engineering notation, the largest multiple of 3 that is not above the decimal exponent of the first digit
+constexpr int engineering_exponent(int decimal_exponent) noexcept
+{
+    return decimal_exponent - (decimal_exponent % 3 + 3) % 3;
+}
+
+// Number of characters of a value in engineering notation. significant_digits is at least 1 and can be more than
+// the digits that are known, and all the integer digits are written even when it is less
+inline std::ptrdiff_t engineering_length(bool is_negative, int decimal_exponent, std::ptrdiff_t significant_digits, bool si) noexcept
+{
+    const int exponent = engineering_exponent(decimal_exponent);
+    const int integer_digits = decimal_exponent - exponent + 1;
+    const std::ptrdiff_t written_digits = significant_digits > integer_digits ? significant_digits : integer_digits;
+
+    std::ptrdiff_t length = static_cast<std::ptrdiff_t>(is_negative) + written_digits + (written_digits > integer_digits ? 1 : 0);
+    if (si && exponent >= min_si_exponent && exponent <= max_si_exponent)
+    {
+        return length + static_cast<std::ptrdiff_t>(std::strlen(si_prefix(exponent)));
+    }
+
+    // The exponent has a sign and at least two digits
+    const auto abs_exponent = static_cast<std::uint32_t>(exponent < 0 ? -exponent : exponent);
+    return length + 2 + (abs_exponent < 100 ? 2 : abs_exponent < 1000 ? 3 : 4);
+}
+
+// Writes the significant digits [digits, digits + num_digits) of a value whose first digit has the decimal exponent
+// decimal_exponent in scientific notation with one to three integer digits and an exponent that is a multiple of 3,
+// or with an SI prefix in place of the exponent when si is set and there is one. The digits are padded with zeros
+// up to significant_digits
+inline to_chars_result print_engineering(char* first, char* last, bool is_negative, const char* digits, int num_digits,
+                                         int decimal_exponent, std::ptrdiff_t significant_digits, bool si,
+                                         chars_format_options options) noexcept
+{
+    if (engineering_length(is_negative, decimal_exponent, significant_digits, si) > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    const int exponent = engineering_exponent(decimal_exponent);
+    const int integer_digits = decimal_exponent - exponent + 1;
+
+    if (is_negative)
+    {
+        *first++ = '-';
+    }
+
+    // The integer digits, of which the ones past the known digits are zeros
+    const int known_integer_digits = num_digits < integer_digits ? num_digits : integer_digits;
+    std::memcpy(first, digits, static_cast<std::size_t>(known_integer_digits));
+    std::memset(first + known_integer_digits, '0', static_cast<std::size_t>(integer_digits - known_integer_digits));
+    first += integer_digits;
+
+    if (significant_digits > integer_digits)
+    {
+        *first++ = options.decimal_point;
+        const int known_fraction_digits = num_digits - known_integer_digits;
+        std::memcpy(first, digits + known_integer_digits, static_cast<std::size_t>(known_fraction_digits));
+        std::memset(first + known_fraction_digits, '0', static_cast<std::size_t>(significant_digits - num_digits));
+        first += significant_digits - integer_digits;
+    }
+
+    if (si && exponent >= min_si_exponent && exponent <= max_si_exponent)
+    {
+        const char* const prefix = si_prefix(exponent);
+        const std::size_t prefix_length = std::strlen(prefix);
+        std::memcpy(first, prefix, prefix_length);
+        return {first + prefix_length, std::errc()};
+    }
+
+    const auto abs_exponent = static_cast<std::uint32_t>(exponent < 0 ? -exponent : exponent);
+    *first++ = options.exponent;
+    *first++ = exponent < 0 ? '-' : '+';
+    if (abs_exponent < 10)
+    {
+        *first++ = '0';
+    }
+    return to_chars_integer_impl(first, last, abs_exponent);
+}
+
+// The shortest representation in engineering notation from the decimal significand and exponent of Dragonbox or ryu
+template <typename Unsigned_Integer>
+inline to_chars_result to_chars_engineering_shortest(char* first, char* last, bool is_negative, Unsigned_Integer significand,
+                                                     int exponent, bool si, chars_format_options options) noexcept
+{
+    char digits[48];
+    const auto r = to_chars_128integer_impl(digits, digits + sizeof(digits), significand);
+    int num_digits = static_cast<int>(r.ptr - digits);
+    while (num_digits > 1 && digits[num_digits - 1] == '0')
+    {
+        --num_digits;
+        ++exponent;
+    }
+
+    // Zero, whatever exponent it comes with
+    if (digits[0] == '0')
+    {
+        exponent = 0;
+    }
+
+    return print_engineering(first, last, is_negative, digits, num_digits, exponent + num_digits - 1, num_digits, si, options);
+}
+
+template <typename Real>
+inline to_chars_result to_chars_engineering_shortest(char* first, char* last, Real value, bool si, chars_format_options options) noexcept
+{
+    if (std::fpclassify(value) == FP_ZERO)
+    {
+        return to_chars_engineering_shortest(first, last, static_cast<bool>(std::signbit(value)), 0U, 0, si, options);
+    }
+
+    const auto decimal = boost::charconv::detail::to_decimal(value);
+    return to_chars_engineering_shortest(first, last, decimal.is_negative, decimal.significand, decimal.exponent, si, options);
+}
+
+// Engineering notation with precision digits after the first one like scientific notation, of which the ones
+// past the exact decimal expansion are zeros that are only counted
+template <typename T>
+inline to_chars_result to_chars_engineering_precision(char* first, char* last, T value, int precision, bool si,
+                                                      chars_format_options options = chars_format_options(),
+                                                      rounding_mode mode = rounding_mode::to_nearest) noexcept
+{
+    constexpr int max_significant_digits = fixed_precision_format<T>::type::max_significant_digits;
+    const int significant_digits = precision >= max_significant_digits ? max_significant_digits : precision + 1;
+
+    BOOST_CHARCONV_SCRATCH_ARRAY(char, buffer, static_cast<std::size_t>(max_significant_digits) + 10U, scratch_general_digits);
+    const auto d = to_scientific_digits(buffer, sizeof(buffer), value, significant_digits, mode);
+
+    return print_engineering(first, last, d.is_negative, d.digits, d.num_digits, d.decimal_exponent,
+                             static_cast<std::ptrdiff_t>(precision) + 1, si, options);
+}
+
+// Finite values with a specified precision in fixed or scientific notation.
+// Both write exactly precision digits after the point, so both characters of options are at known
+// places of the output and replaced there without looking at the digits
+template <typename T>
+inline to_chars_result to_chars_fixed_or_scientific_precision(char* first, char* last, T value, chars_format fmt, int precision,
+                                                              chars_format_options options, rounding_mode mode) noexcept
+{
+    if (fmt == boost::charconv::chars_format::fixed)
+    {
+        const auto r = to_chars_fixed_precision(first, last, value, precision, mode);
+        if (r && precision > 0)
+        {
+            r.ptr[-precision - 1] = options.decimal_point;
+        }
+        return r;
+    }
+
+    const auto r = to_chars_scientific_precision(first, last, value, precision, mode);
+    if (r)
+    {
+        char* const digits_first = first + static_cast<std::ptrdiff_t>(*first == '-');
+        if (precision > 0)
+        {
+            digits_first[1] = options.decimal_point;
+        }
+        digits_first[precision > 0 ? precision + 2 : 1] = options.exponent;
+    }
+    return r;
+}
+
+// Finite values with a specified precision in fixed, scientific, or general notation
+template <typename T>
+inline to_chars_result to_chars_precision_impl(char* first, char* last, T value, chars_format fmt, int precision,
+                                               chars_format_options options = chars_format_options(),
+                                               rounding_mode mode = rounding_mode::to_nearest) noexcept
+{
+    if (fmt == boost::charconv::chars_format::fixed || fmt == boost::charconv::chars_format::scientific)
+    {
+        return to_chars_fixed_or_scientific_precision(first, last, value, fmt, precision, options, mode);
+    }
+    else if (fmt == boost::charconv::chars_format::engineering)
+    {
+        return to_chars_engineering_precision(first, last, value, precision, false, options, mode);
+    }
+
+    return to_chars_general_precision(first, last, value, precision, options, mode);
+}
+
+template <typename Real>
+to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_format fmt = chars_format::general, int precision = -1,
+                                    chars_format_options options = chars_format_options(),
+                                    rounding_mode mode = rounding_mode::to_nearest) noexcept
+{
+    using Unsigned_Integer = typename std::conditional<std::is_same<Real, double>::value, std::uint64_t, std::uint32_t>::type;
+
+    // Sanity check our bounds
+    if (first >= last)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    auto abs_value = std::abs(value);
+    constexpr auto max_fractional_value = std::is_same<Real, double>::value ? static_cast<Real>(1e16) : static_cast<Real>(1e7);
+    constexpr auto max_value = static_cast<Real>((std::numeric_limits<Unsigned_Integer>::max)());
+
+    // Unspecified precision so we always go with the shortest representation
+    if (precision < 0)
+    {
+        if (fmt == boost::charconv::chars_format::general || fmt == boost::charconv::chars_format::fixed)
+        {
+            if (abs_value >= 1 && abs_value < max_fractional_value)
+            {
+                return to_chars_fixed_impl(first, last, value, options.decimal_point);
+            }
+            else if (abs_value >= max_fractional_value && abs_value < max_value)
+            {
+                if (value < 0)
+                {
+                    *first++ = '-';
+                }
+                return to_chars_integer_impl(first, last, static_cast<std::uint64_t>(abs_value));
+            }
+            else if (fmt == boost::charconv::chars_format::fixed && std::isfinite(value) && abs_value != 0)
+            {
+                return to_chars_fixed_shortest(first, last, boost::charconv::detail::to_decimal(value), options.decimal_point);
+            }
+            else
+            {
+                return boost::charconv::detail::dragonbox_to_chars(value, first, last, fmt, options);
+            }
+        }
+        else if (fmt == boost::charconv::chars_format::scientific)
+        {
+            return boost::charconv::detail::dragonbox_to_chars(value, first, last, fmt, options);
+        }
+        else if (fmt == boost::charconv::chars_format::engineering)
+        {
+            if (!std::isfinite(value))
+            {
+                return boost::charconv::detail::dragonbox_to_chars(value, first, last, chars_format::general);
+            }
+
+            return to_chars_engineering_shortest(first, last, value, false, options);
+        }
+    }
+    else
+    {
+        if (fmt != boost::charconv::chars_format::hex)
+        {
+            // Widening a float to double is exact, which is also what printf gets
+            const auto double_value = static_cast<double>(value);
+            if (!std::isfinite(double_value))
+            {
+                return boost::charconv::detail::dragonbox_to_chars(value, first, last, chars_format::general);
+            }
+
+            // float has its own fixed and scientific paths with 64-bit arithmetic, which fall back to the double ones
+            if (fmt == boost::charconv::chars_format::fixed || fmt == boost::charconv::chars_format::scientific)
+            {
+                return boost::charconv::detail::to_chars_fixed_or_scientific_precision(first, last, value, fmt, precision, options, mode);
+            }
+
+            return boost::charconv::detail::to_chars_precision_impl(first, last, double_value, fmt, precision, options, mode);
+        }
+    }
+
+    const int classification = std::fpclassify(value);
+    switch (classification)
+    {
+        case FP_INFINITE:
+        case FP_NAN:
+            // The dragonbox impl will return the correct type of NaN
+            return boost::charconv::detail::dragonbox_to_chars(value, first, last, chars_format::general);
+        case FP_ZERO:
+            if (std::signbit(value))
+            {
+                *first++ = '-';
+            }
+            if (last - first < 4)
+            {
+                return {last, std::errc::result_out_of_range};
+            }
+            std::memcpy(first, "0p+0", 4); // NOLINT : No null terminator is purposeful
+            return {first + 4, std::errc()};
+        default:
+            // Do nothing
+            (void)precision;
+    }
+
+    // Hex handles both cases already
+    return boost::charconv::detail::to_chars_hex(first, last, value, precision, options.decimal_point);
+}
+
+// The exact binary fraction of a double has at most 1074 decimal places and its integer part at most 309 digits
+constexpr int max_fixed_precision = 1074;
+constexpr std::size_t max_printed_length = static_cast<std::size_t>(max_fixed_precision) + 330U;
+
+// Length of the output of to_chars_float_impl found by printing it into a local buffer.
+// Digits past max_precision are always zeros, so only that many are printed and the rest are counted
+template <typename Real>
+std::size_t to_chars_printed_length(Real value, chars_format fmt, int precision, int max_precision) noexcept
+{
+    const int printed_precision = precision > max_precision ? max_precision : precision;
+
+    char buffer[max_printed_length];
+    const auto r = to_chars_float_impl(buffer, buffer + sizeof(buffer), value, fmt, printed_precision);
+    BOOST_CHARCONV_ASSERT(r.ec == std::errc());
+
+    return static_cast<std::size_t>(r.ptr - buffer) + static_cast<std::size_t>(precision - printed_precision);
+}
+
+// Length of the output of to_chars_float_impl with the same arguments, following the same dispatch.
+// The shortest representation only needs the Dragonbox decimal significand and exponent, and with a precision it only
+// takes the decimal exponent, which is known without printing except close to a power of 10 where rounding can carry into it
+template <typename Real>
+std::size_t to_chars_float_length(Real value, chars_format fmt = chars_format::general, int precision = -1) noexcept
+{
+    using Unsigned_Integer = typename std::conditional<std::is_same<Real, double>::value, std::uint64_t, std::uint32_t>::type;
+
+    constexpr auto max_fractional_value = std::is_same<Real, double>::value ? static_cast<Real>(1e16) : static_cast<Real>(1e7);
+    constexpr auto max_value = static_cast<Real>((std::numeric_limits<Unsigned_Integer>::max)());
+    constexpr int max_int = (std::numeric_limits<int>::max)();
+
+    const auto abs_value = std::abs(value);
+    const auto sign_length = static_cast<std::size_t>(std::signbit(value));
+
+    // inf and the nan variants ignore the format and the precision
+    if (!std::isfinite(value))
+    {
+        return to_chars_printed_length(value, chars_format::general, -1, max_int);
+    }
+
+    if (precision < 0)
+    {
+        if (fmt == chars_format::general || fmt == chars_format::fixed || fmt == chars_format::scientific)
+        {
+            if (abs_value == 0)
+            {
+                return sign_length + (fmt == chars_format::scientific ? 5U : 1U);
+            }
+
+            if (fmt != chars_format::scientific && abs_value >= max_fractional_value && abs_value < max_value)
+            {
+                return sign_length + decimal_length(static_cast<std::uint64_t>(abs_value));
+            }
+
+            const auto decimal = boost::charconv::detail::to_decimal(value);
+            const int num_dig = num_digits(decimal.significand);
+
+            if (fmt != chars_format::scientific && abs_value >= 1 && abs_value < max_fractional_value)
+            {
+                // The digits with a dot inside, or followed by the trailing zeros of an integer
+                return sign_length + static_cast<std::size_t>(num_dig) +
+                       static_cast<std::size_t>(decimal.exponent < 0 ? 1 : decimal.exponent);
+            }
+
+            if (fmt == chars_format::fixed)
+            {
+                // The digits and the zeros up to the point, or "0." and the zeros before the digits
+                return sign_length + static_cast<std::size_t>(decimal.exponent >= 0 ? num_dig + decimal.exponent : 2 - decimal.exponent);
+            }
+
+            // d.ddd followed by the exponent, which is left out when it is zero outside of scientific format
+            const int scientific_exponent = decimal.exponent + num_dig - 1;
+            std::size_t length = sign_length + static_cast<std::size_t>(num_dig) + (num_dig > 1 ? 1U : 0U);
+            if (scientific_exponent != 0 || fmt == chars_format::scientific)
+            {
+                length += (scientific_exponent >= 100 || scientific_exponent <= -100) ? 5U : 4U;
+            }
+
+            return length;
+        }
+        else if (fmt == chars_format::engineering)
+        {
+            if (abs_value == 0)
+            {
+                return static_cast<std::size_t>(engineering_length(std::signbit(value), 0, 1, false));
+            }
+
+            const auto decimal = boost::charconv::detail::to_decimal(value);
+            const int num_dig = num_digits(decimal.significand);
+            return static_cast<std::size_t>(engineering_length(decimal.is_negative, decimal.exponent + num_dig - 1, num_dig, false));
+        }
+    }
+    else if (fmt != chars_format::hex)
+    {
+        const auto double_value = static_cast<double>(value);
+        const auto abs_double_value = std::abs(double_value);
+        const std::size_t fraction_length = precision == 0 ? 0U : static_cast<std::size_t>(precision) + 1U;
+
+        if (fmt == chars_format::fixed)
+        {
+            if (abs_double_value < 1)
+            {
+                return sign_length + 1U + fraction_length;
+            }
+
+            // Rounding only adds an integer digit when the integer part is all nines
+            if (abs_double_value < 1e19)
+            {
+                const auto integer_part = static_cast<std::uint64_t>(abs_double_value);
+                const auto integer_digits = decimal_length(integer_part);
+                if (decimal_length(integer_part + 1) == integer_digits)
+                {
+                    return sign_length + integer_digits + fraction_length;
+                }
+            }
+
+            return to_chars_printed_length(double_value, fmt, precision, max_fixed_precision);
+        }
+        else if (fmt == chars_format::scientific)
+        {
+            // d.ddd and "e+" followed by two or three exponent digits.
+            // With the margins around 1e-100 and 1e100 rounding can not change the number of exponent digits
+            std::size_t exponent_length;
+            if (abs_double_value == 0 || (abs_double_value >= 1.1e-99 && abs_double_value < 9e99))
+            {
+                exponent_length = 2;
+            }
+            else if (abs_double_value < 9e-101 || abs_double_value >= 1.1e100)
+            {
+                exponent_length = 3;
+            }
+            else
+            {
+                constexpr int max_scientific_precision = fixed_precision_format<double>::type::max_significant_digits - 1;
+                return to_chars_printed_length(double_value, fmt, precision, max_scientific_precision);
+            }
+
+            return sign_length + 1U + fraction_length + 2U + exponent_length;
+        }
+
+        else if (fmt == chars_format::engineering)
+        {
+            constexpr int max_engineering_precision = fixed_precision_format<double>::type::max_significant_digits - 1;
+            return to_chars_printed_length(double_value, fmt, precision, max_engineering_precision);
+        }
+
+        // General format removes trailing zeros and limits the number of significant digits itself
+        return to_chars_printed_length(double_value, fmt, precision, max_int);
+    }
+
+    // Hex digits past those of the significand are zeros, except for zero which is always 0p+0
+    constexpr int hex_precision = std::is_same<Real, double>::value ? 13 : 6;
+    return to_chars_printed_length(value, fmt, precision, abs_value == 0 ? max_int : hex_precision);
+}
+
+} // namespace detail
+} // namespace charconv
+} // namespace detail
+
+#endif //BOOST_CHARCONV_DETAIL_TO_CHARS_FLOAT_IMPL_HPP
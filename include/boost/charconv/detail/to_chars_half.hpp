@@ -0,0 +1,272 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_TO_CHARS_HALF_HPP
+#define BOOST_CHARCONV_DETAIL_TO_CHARS_HALF_HPP
+
+// Shortest round trip output of the 16-bit binary16 (std::float16_t) and bfloat16 (std::bfloat16_t) formats.
+// The shortest representation of the value widened to float is usually far longer than needed (0.1f16 would print as 9.9975586e-02),
+// so Dragonbox is run on the 16-bit formats themselves with the binary32 cache and 32-bit arithmetic.
+// The output follows the same rules as float otherwise.
+//
+// The values are stored as their bit patterns so that this also works on compilers without <stdfloat>
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/bit_layouts.hpp>
+#include <boost/charconv/detail/cpu_features.hpp>
+#include <boost/charconv/detail/dragonbox/dragonbox.hpp>
+#include <boost/charconv/detail/integer_search_trees.hpp>
+#include <boost/charconv/detail/to_chars_integer_impl.hpp>
+#include <boost/charconv/detail/to_chars_float_impl.hpp>
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace boost { namespace charconv { namespace detail {
+
+// Same as dragonbox_float_traits, except that the 16-bit pattern is held in a 32-bit carrier.
+// Shifting left does not drop the sign bit, so it is masked off instead
+template <typename T>
+struct dragonbox_half_traits
+{
+    using type = T;
+    using format = typename std::conditional<std::is_same<T, binary16_bits>::value, ieee754_binary16, ieee754_bfloat16>::type;
+    using carrier_uint = std::uint32_t;
+    static constexpr int carrier_bits = 32;
+
+    static T carrier_to_float(carrier_uint u) noexcept
+    {
+        return T {static_cast<std::uint16_t>(u)};
+    }
+
+    static carrier_uint float_to_carrier(T x) noexcept
+    {
+        return x.bits;
+    }
+
+    static constexpr unsigned extract_exponent_bits(carrier_uint u) noexcept
+    {
+        return static_cast<unsigned>(u >> format::significand_bits) & ((static_cast<unsigned int>(1) << format::exponent_bits) - 1);
+    }
+
+    static constexpr carrier_uint extract_significand_bits(carrier_uint u) noexcept
+    {
+        return carrier_uint(u & carrier_uint((carrier_uint(1) << format::significand_bits) - 1));
+    }
+
+    static constexpr carrier_uint remove_exponent_bits(carrier_uint u, unsigned int exponent_bits) noexcept
+    {
+        return u ^ (carrier_uint(exponent_bits) << format::significand_bits);
+    }
+
+    static constexpr carrier_uint remove_sign_bit_and_shift(carrier_uint u) noexcept
+    {
+        return carrier_uint(u << 1) & UINT32_C(0xFFFF);
+    }
+
+    static constexpr int exponent_bias = format::exponent_bias;
+
+    static constexpr int binary_exponent(unsigned exponent_bits) noexcept
+    {
+        return static_cast<int>(exponent_bits == 0 ? format::min_exponent : int(exponent_bits) + format::exponent_bias);
+    }
+
+    static constexpr carrier_uint binary_significand(carrier_uint significand_bits, unsigned exponent_bits) noexcept
+    {
+        return exponent_bits == 0 ? significand_bits : significand_bits | (carrier_uint(1) << format::significand_bits);
+    }
+
+    static constexpr bool is_nonzero(carrier_uint u) noexcept
+    {
+        return (u & UINT32_C(0x7FFF)) != 0;
+    }
+
+    static constexpr bool is_positive(carrier_uint u) noexcept
+    {
+        return u < UINT32_C(0x8000);
+    }
+
+    static constexpr bool is_negative(carrier_uint u) noexcept
+    {
+        return !is_positive(u);
+    }
+
+    static constexpr bool is_finite(unsigned exponent_bits) noexcept
+    {
+        return exponent_bits != ((1u << format::exponent_bits) - 1);
+    }
+
+    static constexpr bool has_all_zero_significand_bits(carrier_uint u) noexcept
+    {
+        return (u & UINT32_C(0x7FFF)) == 0;
+    }
+
+    static constexpr bool has_even_significand_bits(carrier_uint u) noexcept
+    {
+        return u % 2 == 0;
+    }
+};
+
+// Widening to float is exact
+inline float half_to_float(binary16_bits value) noexcept
+{
+    const std::uint32_t sign = static_cast<std::uint32_t>(value.bits & 0x8000U) << 16;
+    const std::uint32_t exponent = (value.bits >> 10) & 0x1FU;
+    const std::uint32_t fraction = value.bits & 0x3FFU;
+
+    float result;
+    if (exponent == 0)
+    {
+        // Subnormals are multiples of 2^-24
+        result = static_cast<float>(fraction) * 5.9604644775390625e-8F;
+        return sign != 0 ? -result : result;
+    }
+
+    const std::uint32_t bits = sign | (exponent == 0x1FU ? UINT32_C(0x7F800000) : (exponent + 112) << 23) | (fraction << 13);
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+inline float half_to_float(bfloat16_bits value) noexcept
+{
+    const std::uint32_t bits = static_cast<std::uint32_t>(value.bits) << 16;
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+// Widens n values at once for to_chars_many. F16C and NEON convert blocks of binary16 values that hold no infinity or NaN,
+// which they would quiet, and the other values are widened one at a time
+inline void half_to_float(const std::uint16_t* bits, std::size_t n, float* out, binary16_bits) noexcept
+{
+    std::size_t i = 0;
+    while (i < n)
+    {
+        i += widen_binary16_blocks(bits + i, n - i, out + i);
+
+        #if defined(BOOST_CHARCONV_HAS_NEON) && !defined(_MSC_VER)
+        for (; n - i >= 4; i += 4)
+        {
+            const uint16x4_t halves = vld1_u16(bits + i);
+            if (vmaxv_u16(vand_u16(halves, vdup_n_u16(0x7C00))) == 0x7C00)
+            {
+                break;
+            }
+
+            vst1q_f32(out + i, vcvt_f32_f16(vreinterpret_f16_u16(halves)));
+        }
+        #endif
+
+        const std::size_t block_last = n - i < 8 ? n : i + 8;
+        for (; i < block_last; ++i)
+        {
+            out[i] = half_to_float(binary16_bits {bits[i]});
+        }
+    }
+}
+
+// bfloat16 is the upper half of a float, so the loop is vectorized by the compiler
+inline void half_to_float(const std::uint16_t* bits, std::size_t n, float* out, bfloat16_bits) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const std::uint32_t wide = static_cast<std::uint32_t>(bits[i]) << 16;
+        std::memcpy(out + i, &wide, sizeof(float));
+    }
+}
+
+template <typename T>
+to_chars_result to_chars_half(char* first, char* last, T value, chars_format fmt = chars_format::general, int precision = -1) noexcept
+{
+    using traits = dragonbox_half_traits<T>;
+    using format = typename traits::format;
+
+    const auto br = dragonbox_float_bits<T, traits>(value);
+    const auto exponent_bits = br.extract_exponent_bits();
+
+    // Widening is exact, so the float overload already gives the right output for everything but the shortest representation
+    if (precision >= 0 || fmt == chars_format::hex || !br.is_finite(exponent_bits) || !br.is_nonzero())
+    {
+        return boost::charconv::to_chars(first, last, half_to_float(value), fmt, precision);
+    }
+
+    if (first >= last)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    const auto s = br.remove_exponent_bits(exponent_bits);
+    if (s.is_negative())
+    {
+        *first++ = '-';
+    }
+
+    // Like float, values from 1 up to 2^32 are printed without an exponent in general and fixed format,
+    // integers exactly and the others with the shortest fraction
+    const int binary_exponent = br.binary_exponent(exponent_bits);
+    if (fmt != chars_format::scientific && exponent_bits != 0 && binary_exponent >= 0 && binary_exponent < 32)
+    {
+        const std::uint64_t significand = br.binary_significand();
+        const int fraction_bits = format::significand_bits - binary_exponent;
+        if (fraction_bits <= 0)
+        {
+            return to_chars_integer_impl(first, last, significand << -fraction_bits);
+        }
+        if ((significand & ((UINT64_C(1) << fraction_bits) - 1)) == 0)
+        {
+            return to_chars_integer_impl(first, last, significand >> fraction_bits);
+        }
+
+        // Shortest representations of values that are not integers always have a negative exponent
+        const auto decimal = to_decimal<T, traits>(s, exponent_bits, policy::sign::ignore, policy::trailing_zero::remove);
+        const int num_dig = num_digits(decimal.significand);
+        BOOST_CHARCONV_ASSERT(-decimal.exponent > 0 && num_dig > -decimal.exponent);
+
+        if (last - first < num_dig + 1)
+        {
+            return {last, std::errc::result_out_of_range};
+        }
+
+        auto r = to_chars_integer_impl(first, last, decimal.significand);
+        std::memmove(r.ptr + decimal.exponent + 1, r.ptr + decimal.exponent, static_cast<std::size_t>(-decimal.exponent));
+        r.ptr[decimal.exponent] = '.';
+        ++r.ptr;
+        return r;
+    }
+
+    auto decimal = to_decimal<T, traits>(s, exponent_bits, policy::sign::ignore, policy::trailing_zero::ignore);
+
+    // Dragonbox picks the candidate with the largest exponent. The only value of both formats for which one with as many
+    // digits and a smaller exponent is closer is the smallest bfloat16 subnormal 2^-133 = 9.18e-41, which would print as 1e-40
+    if (std::is_same<T, bfloat16_bits>::value && (value.bits & 0x7FFFU) == 1)
+    {
+        decimal.significand = 9;
+        decimal.exponent = -41;
+    }
+
+    // Like float, the values below 1 or from 2^32 are written out in full with zeros in fixed format.
+    // The sign is already written, and the trailing zeros of the significand would end up after the decimal point
+    if (fmt == chars_format::fixed)
+    {
+        while (decimal.significand % 10 == 0)
+        {
+            decimal.significand /= 10;
+            ++decimal.exponent;
+        }
+
+        using decimal_type = decimal_fp<typename decltype(decimal)::carrier_uint, true, false>;
+        return to_chars_fixed_shortest(first, last, decimal_type {decimal.significand, decimal.exponent, false}, '.');
+    }
+
+    return to_chars_detail::dragon_box_print_chars<float, dragonbox_float_traits<float>>(decimal.significand, decimal.exponent, first, last, fmt, chars_format_options());
+}
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_TO_CHARS_HALF_HPP
@@ -13,6 +13,9 @@
 #include <boost/charconv/detail/integer_search_trees.hpp>
 #include <boost/charconv/detail/emulated128.hpp>
 #include <boost/charconv/detail/apply_sign.hpp>
+#include <boost/charconv/detail/swar.hpp>
+#include <boost/charconv/detail/bit.hpp>
+#include <boost/core/bit.hpp>
 #include <limits>
 #include <system_error>
 #include <type_traits>
@@ -20,8 +23,6 @@
 #include <limits>
 #include <utility>
 #include <cstring>
-#include <cstdio>
-#include <cerrno>
 #include <cstdint>
 #include <climits>
 #include <cmath>
@@ -29,46 +30,152 @@
 namespace boost { namespace charconv { namespace detail {
 
 
-static constexpr char radix_table[] = {
-        '0', '0', '0', '1', '0', '2', '0', '3', '0', '4',
-        '0', '5', '0', '6', '0', '7', '0', '8', '0', '9',
-        '1', '0', '1', '1', '1', '2', '1', '3', '1', '4',
-        '1', '5', '1', '6', '1', '7', '1', '8', '1', '9',
-        '2', '0', '2', '1', '2', '2', '2', '3', '2', '4',
-        '2', '5', '2', '6', '2', '7', '2', '8', '2', '9',
-        '3', '0', '3', '1', '3', '2', '3', '3', '3', '4',
-        '3', '5', '3', '6', '3', '7', '3', '8', '3', '9',
-        '4', '0', '4', '1', '4', '2', '4', '3', '4', '4',
-        '4', '5', '4', '6', '4', '7', '4', '8', '4', '9',
-        '5', '0', '5', '1', '5', '2', '5', '3', '5', '4',
-        '5', '5', '5', '6', '5', '7', '5', '8', '5', '9',
-        '6', '0', '6', '1', '6', '2', '6', '3', '6', '4',
-        '6', '5', '6', '6', '6', '7', '6', '8', '6', '9',
-        '7', '0', '7', '1', '7', '2', '7', '3', '7', '4',
-        '7', '5', '7', '6', '7', '7', '7', '8', '7', '9',
-        '8', '0', '8', '1', '8', '2', '8', '3', '8', '4',
-        '8', '5', '8', '6', '8', '7', '8', '8', '8', '9',
-        '9', '0', '9', '1', '9', '2', '9', '3', '9', '4',
-        '9', '5', '9', '6', '9', '7', '9', '8', '9', '9'
-};
+// The two digit pairs of 00 to 99, and the digits of the bases up to 36
+#if (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+template <bool b>
+struct digit_tables_template
+#else
+struct digit_tables
+#endif
+{
+    static constexpr char radix_table[] = {
+            '0', '0', '0', '1', '0', '2', '0', '3', '0', '4',
+            '0', '5', '0', '6', '0', '7', '0', '8', '0', '9',
+            '1', '0', '1', '1', '1', '2', '1', '3', '1', '4',
+            '1', '5', '1', '6', '1', '7', '1', '8', '1', '9',
+            '2', '0', '2', '1', '2', '2', '2', '3', '2', '4',
+            '2', '5', '2', '6', '2', '7', '2', '8', '2', '9',
+            '3', '0', '3', '1', '3', '2', '3', '3', '3', '4',
+            '3', '5', '3', '6', '3', '7', '3', '8', '3', '9',
+            '4', '0', '4', '1', '4', '2', '4', '3', '4', '4',
+            '4', '5', '4', '6', '4', '7', '4', '8', '4', '9',
+            '5', '0', '5', '1', '5', '2', '5', '3', '5', '4',
+            '5', '5', '5', '6', '5', '7', '5', '8', '5', '9',
+            '6', '0', '6', '1', '6', '2', '6', '3', '6', '4',
+            '6', '5', '6', '6', '6', '7', '6', '8', '6', '9',
+            '7', '0', '7', '1', '7', '2', '7', '3', '7', '4',
+            '7', '5', '7', '6', '7', '7', '7', '8', '7', '9',
+            '8', '0', '8', '1', '8', '2', '8', '3', '8', '4',
+            '8', '5', '8', '6', '8', '7', '8', '8', '8', '9',
+            '9', '0', '9', '1', '9', '2', '9', '3', '9', '4',
+            '9', '5', '9', '6', '9', '7', '9', '8', '9', '9'
+    };
+
+    static constexpr char digit_table[] = {
+            '0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
+            'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j',
+            'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't',
+            'u', 'v', 'w', 'x', 'y', 'z'
+    };
+
+    #if BOOST_CHARCONV_SMALL_INTEGER_LIMIT > 0
+
+    // The values below BOOST_CHARCONV_SMALL_INTEGER_LIMIT with leading zeros to 4 digits, "0000" "0001" ... "9999",
+    // followed by 3 characters so that 4 bytes can be read from the first significant digit of every value
+    #define BOOST_CHARCONV_DIGITS_1(p) p "0" p "1" p "2" p "3" p "4" p "5" p "6" p "7" p "8" p "9"
+    #define BOOST_CHARCONV_DIGITS_2(p) BOOST_CHARCONV_DIGITS_1(p "0") BOOST_CHARCONV_DIGITS_1(p "1") BOOST_CHARCONV_DIGITS_1(p "2") \
+        BOOST_CHARCONV_DIGITS_1(p "3") BOOST_CHARCONV_DIGITS_1(p "4") BOOST_CHARCONV_DIGITS_1(p "5") BOOST_CHARCONV_DIGITS_1(p "6") \
+        BOOST_CHARCONV_DIGITS_1(p "7") BOOST_CHARCONV_DIGITS_1(p "8") BOOST_CHARCONV_DIGITS_1(p "9")
+    #define BOOST_CHARCONV_DIGITS_3(p) BOOST_CHARCONV_DIGITS_2(p "0") BOOST_CHARCONV_DIGITS_2(p "1") BOOST_CHARCONV_DIGITS_2(p "2") \
+        BOOST_CHARCONV_DIGITS_2(p "3") BOOST_CHARCONV_DIGITS_2(p "4") BOOST_CHARCONV_DIGITS_2(p "5") BOOST_CHARCONV_DIGITS_2(p "6") \
+        BOOST_CHARCONV_DIGITS_2(p "7") BOOST_CHARCONV_DIGITS_2(p "8") BOOST_CHARCONV_DIGITS_2(p "9")
+    #define BOOST_CHARCONV_DIGITS_4(p) BOOST_CHARCONV_DIGITS_3(p "0") BOOST_CHARCONV_DIGITS_3(p "1") BOOST_CHARCONV_DIGITS_3(p "2") \
+        BOOST_CHARCONV_DIGITS_3(p "3") BOOST_CHARCONV_DIGITS_3(p "4") BOOST_CHARCONV_DIGITS_3(p "5") BOOST_CHARCONV_DIGITS_3(p "6") \
+        BOOST_CHARCONV_DIGITS_3(p "7") BOOST_CHARCONV_DIGITS_3(p "8") BOOST_CHARCONV_DIGITS_3(p "9")
+
+    static constexpr char small_integer_table[] =
+    #if BOOST_CHARCONV_SMALL_INTEGER_LIMIT == 10000
+        BOOST_CHARCONV_DIGITS_4("")
+    #elif BOOST_CHARCONV_SMALL_INTEGER_LIMIT == 1000
+        BOOST_CHARCONV_DIGITS_3("0")
+    #elif BOOST_CHARCONV_SMALL_INTEGER_LIMIT == 100
+        BOOST_CHARCONV_DIGITS_2("00")
+    #else
+        BOOST_CHARCONV_DIGITS_1("000")
+    #endif
+        "000";
+
+    #undef BOOST_CHARCONV_DIGITS_4
+    #undef BOOST_CHARCONV_DIGITS_3
+    #undef BOOST_CHARCONV_DIGITS_2
+    #undef BOOST_CHARCONV_DIGITS_1
 
-static constexpr char digit_table[] = {
-        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
-        'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j',
-        'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't',
-        'u', 'v', 'w', 'x', 'y', 'z'
+    #endif
 };
 
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES) && (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+
+template <bool b> constexpr char digit_tables_template<b>::radix_table[];
+template <bool b> constexpr char digit_tables_template<b>::digit_table[];
+#if BOOST_CHARCONV_SMALL_INTEGER_LIMIT > 0
+template <bool b> constexpr char digit_tables_template<b>::small_integer_table[];
+#endif
+
+#endif
+
+#if (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+
+using digit_tables = digit_tables_template<true>;
+
+#endif
+
+// Device code reads the digits from string literals in constant memory, since it cannot access the host tables
+BOOST_CHARCONV_GPU_ENABLED constexpr const char* radix_table() noexcept
+{
+    #ifdef BOOST_CHARCONV_DEVICE_COMPILE
+    return "00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+    #else
+    return digit_tables::radix_table;
+    #endif
+}
+
+BOOST_CHARCONV_GPU_ENABLED constexpr const char* digit_table() noexcept
+{
+    #ifdef BOOST_CHARCONV_DEVICE_COMPILE
+    return "0123456789abcdefghijklmnopqrstuvwxyz";
+    #else
+    return digit_tables::digit_table;
+    #endif
+}
+
+#if BOOST_CHARCONV_SMALL_INTEGER_LIMIT > 0 && !defined(BOOST_CHARCONV_DEVICE_COMPILE)
+
+static_assert(sizeof(digit_tables::small_integer_table) == BOOST_CHARCONV_SMALL_INTEGER_LIMIT * 4 + 4, "One entry of 4 digits per value");
+
+// Writes the digits of value < BOOST_CHARCONV_SMALL_INTEGER_LIMIT. A whole entry is one 4 byte copy, and 2 or 3 digits
+// are two overlapping 2 byte copies, so that nothing after the last digit is written
+BOOST_CHARCONV_CONSTEXPR char* write_small_integer(char* first, std::uint32_t value, int digits) noexcept
+{
+    const char* entry = digit_tables::small_integer_table + value * 4U + static_cast<unsigned>(4 - digits);
+    if (digits == 4)
+    {
+        boost::charconv::detail::memcpy(first, entry, 4);
+    }
+    else if (digits >= 2)
+    {
+        boost::charconv::detail::memcpy(first, entry, 2);
+        boost::charconv::detail::memcpy(first + digits - 2, entry + digits - 2, 2);
+    }
+    else
+    {
+        *first = *entry;
+    }
+
+    return first + digits;
+}
+
+#endif
+
 // See: https://jk-jeon.github.io/posts/2022/02/jeaiii-algorithm/
 // https://arxiv.org/abs/2101.11408
-BOOST_CHARCONV_CONSTEXPR char* decompose32(std::uint32_t value, char* buffer) noexcept
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR char* decompose32(std::uint32_t value, char* buffer) noexcept
 {
     constexpr auto mask = (std::uint64_t(1) << 57) - 1;
     auto y = value * std::uint64_t(1441151881);
 
     for (std::size_t i {}; i < 10; i += 2)
     {
-        boost::charconv::detail::memcpy(buffer + i, radix_table + static_cast<std::size_t>(y >> 57) * 2, 2);
+        boost::charconv::detail::memcpy(buffer + i, radix_table() + static_cast<std::size_t>(y >> 57) * 2, 2);
         y &= mask;
         y *= 100;
     }
@@ -76,13 +183,216 @@ BOOST_CHARCONV_CONSTEXPR char* decompose32(std::uint32_t value, char* buffer) no
     return buffer + 10;
 }
 
+#if defined(BOOST_CHARCONV_HAS_SSE2)
+
+// Splits value < 10^8 into its 8 decimal digits, one per 16-bit lane with the most significant digit first.
+// abcdefgh is split into abcd and efgh with a multiply by the reciprocal of 10^4, both are broadcast to four lanes
+// and divided by 10^3, 10^2, 10^1 and 10^0 with two multiply high steps, and the tens of each quotient are subtracted.
+// See: http://0x80.pl/articles/sse-itoa.html
+BOOST_FORCEINLINE __m128i sse2_eight_digits(std::uint32_t value) noexcept
+{
+    const __m128i div_10000 = _mm_set1_epi32(static_cast<int>(UINT32_C(0xD1B71759)));
+    const __m128i ten_thousand = _mm_set1_epi32(10000);
+    const __m128i div_powers = _mm_setr_epi16(8389, 5243, 13108, INT16_MIN, 8389, 5243, 13108, INT16_MIN);
+    const __m128i shift_powers = _mm_setr_epi16(1 << 7, 1 << 11, 1 << 13, INT16_MIN, 1 << 7, 1 << 11, 1 << 13, INT16_MIN);
+
+    const __m128i abcdefgh = _mm_cvtsi32_si128(static_cast<int>(value));
+    const __m128i abcd = _mm_srli_epi64(_mm_mul_epu32(abcdefgh, div_10000), 45);
+    const __m128i efgh = _mm_sub_epi32(abcdefgh, _mm_mul_epu32(abcd, ten_thousand));
+
+    // [abcd * 4, abcd * 4, abcd * 4, abcd * 4, efgh * 4, efgh * 4, efgh * 4, efgh * 4]
+    const __m128i pair = _mm_slli_epi64(_mm_unpacklo_epi16(abcd, efgh), 2);
+    const __m128i broadcast = _mm_unpacklo_epi32(_mm_unpacklo_epi16(pair, pair), _mm_unpacklo_epi16(pair, pair));
+
+    // [a, ab, abc, abcd, e, ef, efg, efgh]
+    const __m128i quotients = _mm_mulhi_epu16(_mm_mulhi_epu16(broadcast, div_powers), shift_powers);
+
+    // [a, b, c, d, e, f, g, h]
+    const __m128i tens = _mm_slli_epi64(_mm_mullo_epi16(quotients, _mm_set1_epi16(10)), 16);
+    return _mm_sub_epi16(quotients, tens);
+}
+
+// Writes the 16 digits of value < 10^16 including any leading zeros
+BOOST_FORCEINLINE void write_sixteen_digits(std::uint64_t value, char* buffer) noexcept
+{
+    const auto high = static_cast<std::uint32_t>(value / UINT64_C(100000000));
+    const auto low = static_cast<std::uint32_t>(value % UINT64_C(100000000));
+
+    const __m128i digits = _mm_packus_epi16(sse2_eight_digits(high), sse2_eight_digits(low));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(buffer), _mm_add_epi8(digits, _mm_set1_epi8('0')));
+}
+
+#else
+
+// Splits value < 10^8 into its 8 ASCII digits with the most significant digit in the lowest byte.
+// The same divide and subtract is done on two 4-digit lanes, then on four 2-digit lanes
+// using multiplications by the reciprocals of 100 and 10 that are exact in that range
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE std::uint64_t swar_eight_digits(std::uint32_t value) noexcept
+{
+    std::uint64_t lanes = (value / 10000) | (static_cast<std::uint64_t>(value % 10000) << 32);
+
+    std::uint64_t quotients = ((lanes * 10486) >> 20) & UINT64_C(0x0000007F0000007F);
+    lanes = quotients | ((lanes - quotients * 100) << 16);
+
+    quotients = ((lanes * 103) >> 10) & UINT64_C(0x000F000F000F000F);
+    lanes = quotients | ((lanes - quotients * 10) << 8);
+
+    return lanes + UINT64_C(0x3030303030303030);
+}
+
+// Writes the 16 digits of value < 10^16 including any leading zeros
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE void write_sixteen_digits(std::uint64_t value, char* buffer) noexcept
+{
+    std::uint64_t high = swar_eight_digits(static_cast<std::uint32_t>(value / UINT64_C(100000000)));
+    std::uint64_t low = swar_eight_digits(static_cast<std::uint32_t>(value % UINT64_C(100000000)));
+
+    #if BOOST_CHARCONV_ENDIAN_BIG_BYTE
+    high = swar_byteswap(high);
+    low = swar_byteswap(low);
+    #endif
+
+    std::memcpy(buffer, &high, sizeof(high));
+    std::memcpy(buffer + 8, &low, sizeof(low));
+}
+
+#endif
+
+// Writes all 19 digits of value < 10^19 including any leading zeros
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE void write_nineteen_digits(std::uint64_t value, char* buffer) noexcept
+{
+    const auto leading = static_cast<std::uint32_t>(value / UINT64_C(10000000000000000));
+    buffer[0] = static_cast<char>('0' + leading / 100);
+    std::memcpy(buffer + 1, radix_table() + (leading % 100) * 2, 2);
+    write_sixteen_digits(value % UINT64_C(10000000000000000), buffer + 3);
+}
+
+// Spreads the 8 nibbles of value to one byte each, the most significant in the lowest byte,
+// by moving the upper half of every group below the lower half three times
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE BOOST_CHARCONV_CXX14_CONSTEXPR_NO_INLINE std::uint64_t swar_spread_nibbles(std::uint32_t value) noexcept
+{
+    std::uint64_t val = value;
+    val = ((val >> 16) | (val << 32)) & UINT64_C(0x0000FFFF0000FFFF);
+    val = ((val >> 8) | (val << 16)) & UINT64_C(0x00FF00FF00FF00FF);
+    val = ((val >> 4) | (val << 8)) & UINT64_C(0x0F0F0F0F0F0F0F0F);
+    return val;
+}
+
+// Adds '0' to every nibble, and the distance from '9' + 1 to 'a' or 'A' to those of 10 and above
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE BOOST_CHARCONV_CXX14_CONSTEXPR_NO_INLINE std::uint64_t swar_nibbles_to_hex(std::uint64_t nibbles, bool uppercase) noexcept
+{
+    const std::uint64_t letters = ((nibbles + UINT64_C(0x0606060606060606)) >> 4) & UINT64_C(0x0101010101010101);
+    return nibbles + UINT64_C(0x3030303030303030) + letters * (uppercase ? 7U : 39U);
+}
+
+// The 8 bits of value as '0' and '1', the most significant in the lowest byte
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE constexpr std::uint64_t swar_eight_binary_digits(std::uint8_t value) noexcept
+{
+    return (((value * UINT64_C(0x8040201008040201)) >> 7) & UINT64_C(0x0101010101010101)) + UINT64_C(0x3030303030303030);
+}
+
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE void store_swar_word(std::uint64_t val, char* buffer) noexcept
+{
+    #if BOOST_CHARCONV_ENDIAN_BIG_BYTE
+    val = swar_byteswap(val);
+    #endif
+
+    std::memcpy(buffer, &val, sizeof(val));
+}
+
+#if defined(BOOST_CHARCONV_HAS_SSE2)
+
+// Writes the 16 hex digits of value including any leading zeros. The bytes are reversed, so that the
+// most significant comes first, and the high and low nibble of each are interleaved into 16 lanes
+BOOST_FORCEINLINE void write_sixteen_hex_digits(std::uint64_t value, char* buffer, bool uppercase) noexcept
+{
+    const std::uint64_t reversed = swar_byteswap(value);
+    const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&reversed));
+    const __m128i low_nibble = _mm_set1_epi8(0x0F);
+
+    const __m128i nibbles = _mm_unpacklo_epi8(_mm_and_si128(_mm_srli_epi16(bytes, 4), low_nibble), _mm_and_si128(bytes, low_nibble));
+    const __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8(uppercase ? 7 : 39));
+    const __m128i chars = _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(buffer), chars);
+}
+
+#else
+
+// Writes the 16 hex digits of value including any leading zeros
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE void write_sixteen_hex_digits(std::uint64_t value, char* buffer, bool uppercase) noexcept
+{
+    store_swar_word(swar_nibbles_to_hex(swar_spread_nibbles(static_cast<std::uint32_t>(value >> 32)), uppercase), buffer);
+    store_swar_word(swar_nibbles_to_hex(swar_spread_nibbles(static_cast<std::uint32_t>(value)), uppercase), buffer + 8);
+}
+
+#endif
+
+// Copies 0 < count <= 16 characters with two fixed size copies that overlap, instead of a call to memcpy with a variable count
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE void copy_short(char* dest, const char* src, int count) noexcept
+{
+    if (count >= 8)
+    {
+        std::memcpy(dest, src, 8);
+        std::memcpy(dest + count - 8, src + count - 8, 8);
+    }
+    else if (count >= 4)
+    {
+        std::memcpy(dest, src, 4);
+        std::memcpy(dest + count - 4, src + count - 4, 4);
+    }
+    else if (count >= 2)
+    {
+        std::memcpy(dest, src, 2);
+        std::memcpy(dest + count - 2, src + count - 2, 2);
+    }
+    else
+    {
+        *dest = *src;
+    }
+}
+
+// Writes the last digits <= 16 hex digits of value. A full word goes straight to buffer, anything shorter through a local one
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE void write_hex_digits(std::uint64_t value, int digits, char* buffer, bool uppercase) noexcept
+{
+    if (digits == 16)
+    {
+        write_sixteen_hex_digits(value, buffer, uppercase);
+        return;
+    }
+
+    char chars[16];
+    write_sixteen_hex_digits(value, chars, uppercase);
+    copy_short(buffer, chars + (16 - digits), digits);
+}
+
+// Writes the last digits <= 64 binary digits of value, eight from every byte
+BOOST_CHARCONV_GPU_ENABLED BOOST_FORCEINLINE void write_binary_digits(std::uint64_t value, int digits, char* buffer) noexcept
+{
+    const int leading = digits % 8;
+    if (leading != 0)
+    {
+        char chars[8];
+        store_swar_word(swar_eight_binary_digits(static_cast<std::uint8_t>(value >> (digits - leading))), chars);
+        copy_short(buffer, chars + (8 - leading), leading);
+        buffer += leading;
+        digits -= leading;
+    }
+
+    while (digits != 0)
+    {
+        digits -= 8;
+        store_swar_word(swar_eight_binary_digits(static_cast<std::uint8_t>(value >> digits)), buffer);
+        buffer += 8;
+    }
+}
+
 #ifdef BOOST_MSVC
 # pragma warning(push)
 # pragma warning(disable: 4127 4146)
 #endif
 
 template <typename Integer>
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char* last, Integer value) noexcept
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char* last, Integer value) noexcept
 {
     using Unsigned_Integer = typename std::make_unsigned<Integer>::type;
     Unsigned_Integer unsigned_value {};
@@ -115,6 +425,25 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
         unsigned_value = static_cast<Unsigned_Integer>(value);
     }
 
+    #if BOOST_CHARCONV_SMALL_INTEGER_LIMIT > 0 && !defined(BOOST_CHARCONV_DEVICE_COMPILE)
+    if (static_cast<std::uint64_t>(unsigned_value) < BOOST_CHARCONV_SMALL_INTEGER_LIMIT)
+    {
+        const auto small_value = static_cast<std::uint32_t>(unsigned_value);
+        const int digits = 1 + static_cast<int>(small_value >= 10U) + static_cast<int>(small_value >= 100U) + static_cast<int>(small_value >= 1000U);
+        if (static_cast<std::ptrdiff_t>(is_negative) + digits > user_buffer_size)
+        {
+            return {last, std::errc::result_out_of_range};
+        }
+
+        if (is_negative)
+        {
+            *first++ = '-';
+        }
+
+        return {write_small_integer(first, small_value, digits), std::errc()};
+    }
+    #endif
+
     // If the type is less than 32 bits we can use this without change
     // If the type is greater than 32 bits we use a binary search tree to figure out how many digits
     // are present and then decompose the value into two (or more) std::uint32_t of known length so that we
@@ -128,7 +457,7 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
         const auto converted_value = static_cast<std::uint32_t>(unsigned_value);
         converted_value_digits = num_digits(converted_value);
 
-        if (converted_value_digits > user_buffer_size)
+        if (static_cast<std::ptrdiff_t>(is_negative) + converted_value_digits > user_buffer_size)
         {
             return {last, std::errc::result_out_of_range};
         }
@@ -149,7 +478,7 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
         auto converted_value = static_cast<std::uint64_t>(unsigned_value);
         converted_value_digits = num_digits(converted_value);
 
-        if (converted_value_digits > user_buffer_size)
+        if (static_cast<std::ptrdiff_t>(is_negative) + converted_value_digits > user_buffer_size)
         {
             return {last, std::errc::result_out_of_range};
         }
@@ -159,6 +488,29 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
             *first++ = '-';
         }
 
+        #ifndef BOOST_CHARCONV_NO_CONSTEXPR_DETECTION
+        if (!BOOST_CHARCONV_IS_CONSTANT_EVALUATED(converted_value))
+        {
+            // Up to 16 digits at once with any leading digits above them written from the table
+            if (converted_value_digits <= 16)
+            {
+                char digits[16] {};
+                write_sixteen_digits(converted_value, digits);
+                std::memcpy(first, digits + (sizeof(digits) - static_cast<unsigned>(converted_value_digits)),
+                            static_cast<std::size_t>(converted_value_digits));
+            }
+            else
+            {
+                const int leading_digits = converted_value_digits - 16;
+                decompose32(static_cast<std::uint32_t>(converted_value / UINT64_C(10000000000000000)), buffer);
+                std::memcpy(first, buffer + (sizeof(buffer) - static_cast<unsigned>(leading_digits)), static_cast<std::size_t>(leading_digits));
+                write_sixteen_digits(converted_value % UINT64_C(10000000000000000), first + leading_digits);
+            }
+
+            return {first + converted_value_digits, std::errc()};
+        }
+        #endif
+
         // Only store 9 digits in each to avoid overflow
         if (num_digits(converted_value) <= 18)
         {
@@ -189,7 +541,7 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
                 boost::charconv::detail::memcpy(first + 8, buffer + 1, sizeof(buffer) - 1);
 
                 // Always prints 2 digits last
-                boost::charconv::detail::memcpy(first + 17, radix_table + z * 2, 2);
+                boost::charconv::detail::memcpy(first + 17, radix_table() + z * 2, 2);
             }
             else // 20
             {
@@ -200,7 +552,7 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
                 boost::charconv::detail::memcpy(first + 9, buffer + 1, sizeof(buffer) - 1);
 
                 // Always prints 2 digits last
-                boost::charconv::detail::memcpy(first + 18, radix_table + z * 2, 2);
+                boost::charconv::detail::memcpy(first + 18, radix_table() + z * 2, 2);
             }
         }
     }
@@ -254,9 +606,75 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_128integer_impl(char* first, c
 
     auto converted_value = static_cast<Unsigned_Integer>(unsigned_value);
 
+    // If the value fits into 64 bits use the other method of processing
+    if (converted_value <= (std::numeric_limits<std::uint64_t>::max)())
+    {
+        if (is_negative)
+        {
+            if (user_buffer_size < 1)
+            {
+                return {last, std::errc::result_out_of_range};
+            }
+            *first++ = '-';
+        }
+
+        return to_chars_integer_impl(first, last, static_cast<std::uint64_t>(converted_value));
+    }
+
+    // Split into base 10^19 limbs: the leading one, which is at most 3 if there are three of them, and one or two of 19 digits.
+    // The leading limb is written with the 64-bit method
+    if (!BOOST_CHARCONV_IS_CONSTANT_EVALUATED(value))
+    {
+        constexpr std::uint64_t ten_19 = UINT64_C(10000000000000000000);
+
+        auto high = static_cast<std::uint64_t>(converted_value >> 64);
+        auto low = static_cast<std::uint64_t>(converted_value);
+        std::uint64_t limbs[2] {};
+        int num_limbs = 1;
+
+        limbs[0] = divide_by_10_19(high, low);
+        if (high != 0 || low >= ten_19)
+        {
+            // The quotient is below 2^65, so it is at most 3 * 10^19 plus a remainder
+            std::uint64_t leading = 0;
+            while (high != 0 || low >= ten_19)
+            {
+                high -= static_cast<std::uint64_t>(low < ten_19);
+                low -= ten_19;
+                ++leading;
+            }
+
+            limbs[1] = low;
+            low = leading;
+            num_limbs = 2;
+        }
+
+        const int leading_digits = num_digits(low);
+        const int total_digits = leading_digits + 19 * num_limbs;
+        if (static_cast<std::ptrdiff_t>(is_negative) + total_digits > user_buffer_size)
+        {
+            return {last, std::errc::result_out_of_range};
+        }
+
+        if (is_negative)
+        {
+            *first++ = '-';
+        }
+
+        first = to_chars_integer_impl(first, first + leading_digits, low).ptr;
+        while (num_limbs > 0)
+        {
+            --num_limbs;
+            write_nineteen_digits(limbs[num_limbs], first);
+            first += 19;
+        }
+
+        return {first, std::errc()};
+    }
+
     const int converted_value_digits = num_digits(converted_value);
 
-    if (converted_value_digits > user_buffer_size)
+    if (static_cast<std::ptrdiff_t>(is_negative) + converted_value_digits > user_buffer_size)
     {
         return {last, std::errc::result_out_of_range};
     }
@@ -266,12 +684,6 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_128integer_impl(char* first, c
         *first++ = '-';
     }
 
-    // If the value fits into 64 bits use the other method of processing
-    if (converted_value < (std::numeric_limits<std::uint64_t>::max)())
-    {
-        return to_chars_integer_impl(first, last, static_cast<std::uint64_t>(value));
-    }
-
     constexpr std::uint32_t ten_9 = UINT32_C(1000000000);
     char buffer[5][10] {};
     int num_chars[5] {};
@@ -309,32 +721,154 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_128integer_impl(char* first, c
 # pragma clang diagnostic ignored "-Wconversion"
 #endif
 
+BOOST_CHARCONV_GPU_ENABLED constexpr std::uint64_t high_word(std::uint64_t) noexcept
+{
+    return 0;
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+constexpr std::uint64_t high_word(boost::uint128_type value) noexcept
+{
+    return static_cast<std::uint64_t>(value >> 64);
+}
+#endif
+
+// Base 2 (Bits = 1) and 16 (Bits = 4) with the length known from the bit width of value, so that the digits are
+// written to their place in the output: at least min_digits of them with zeros in front, after the sign and the
+// prefix "0x" or "0X" for hex. Every 64 bits are written at once with SSE2 or SWAR, unless evaluated at compile time
+template <int Bits, typename Integer, typename Unsigned_Integer>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_power_of_two_impl(char* first, char* last, Integer value, int min_digits,
+                                                                    bool uppercase, bool prefix) noexcept
+{
+    static_assert(Bits == 1 || Bits == 4, "Only bases 2 and 16");
+
+    if (first > last || min_digits < 0)
+    {
+        return {last, std::errc::invalid_argument};
+    }
+
+    using Carrier = typename std::conditional<sizeof(Unsigned_Integer) <= sizeof(std::uint64_t), std::uint64_t, Unsigned_Integer>::type;
+
+    bool is_negative = false;
+    auto unsigned_value = static_cast<Carrier>(static_cast<Unsigned_Integer>(value));
+    BOOST_IF_CONSTEXPR (detail::is_signed<Integer>::value)
+    {
+        if (value < 0)
+        {
+            is_negative = true;
+            unsigned_value = static_cast<Carrier>(static_cast<Unsigned_Integer>(detail::apply_sign(value)));
+        }
+    }
+
+    // 0 has one digit
+    const std::uint64_t high = high_word(unsigned_value);
+    const auto low = static_cast<std::uint64_t>(unsigned_value);
+    const int width = high != 0 ? 128 - detail::countl_zero(high) : 64 - detail::countl_zero(low | 1U);
+    const int value_digits = (width + Bits - 1) / Bits;
+    const int digits = value_digits > min_digits ? value_digits : min_digits;
+
+    const std::ptrdiff_t length = static_cast<std::ptrdiff_t>(is_negative) + (prefix ? 2 : 0) + digits;
+    if (length > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    char* next = first;
+    if (is_negative)
+    {
+        *next++ = '-';
+    }
+    if (prefix)
+    {
+        *next++ = '0';
+        *next++ = uppercase ? 'X' : 'x';
+    }
+    for (int i = value_digits; i < digits; ++i)
+    {
+        *next++ = '0';
+    }
+
+    #ifndef BOOST_CHARCONV_NO_CONSTEXPR_DETECTION
+    if (!BOOST_CHARCONV_IS_CONSTANT_EVALUATED(value))
+    {
+        constexpr int word_digits = 64 / Bits;
+        int remaining = value_digits;
+        if (remaining > word_digits)
+        {
+            BOOST_IF_CONSTEXPR (Bits == 4)
+            {
+                write_hex_digits(high, remaining - word_digits, next, uppercase);
+            }
+            else
+            {
+                write_binary_digits(high, remaining - word_digits, next);
+            }
+            next += remaining - word_digits;
+            remaining = word_digits;
+        }
+
+        BOOST_IF_CONSTEXPR (Bits == 4)
+        {
+            write_hex_digits(low, remaining, next, uppercase);
+        }
+        else
+        {
+            write_binary_digits(low, remaining, next);
+        }
+
+        return {first + length, std::errc()};
+    }
+    #endif
+
+    const char* const letters = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+    for (int i = value_digits; i-- > 0; )
+    {
+        next[i] = letters[static_cast<std::size_t>(unsigned_value & ((1U << Bits) - 1U))];
+        unsigned_value >>= Bits;
+    }
+
+    return {first + length, std::errc()};
+}
+
 // All other bases
 // Use a simple lookup table to put together the Integer in character form
 template <typename Integer, typename Unsigned_Integer>
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char* last, Integer value, int base) noexcept
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char* last, Integer value, int base) noexcept
 {
-    const std::ptrdiff_t output_length = last - first;
-
     if (!((first <= last) && (base >= 2 && base <= 36)))
     {
         return {last, std::errc::invalid_argument};
     }
 
+    if (base == 16)
+    {
+        return to_chars_power_of_two_impl<4, Integer, Unsigned_Integer>(first, last, value, 0, false, false);
+    }
+    if (base == 2)
+    {
+        return to_chars_power_of_two_impl<1, Integer, Unsigned_Integer>(first, last, value, 0, false, false);
+    }
+
     if (value == 0)
     {
+        if (first == last)
+        {
+            return {last, std::errc::result_out_of_range};
+        }
+
         *first++ = '0';
         return {first, std::errc()};
     }
 
     Unsigned_Integer unsigned_value {};
     const auto unsigned_base = static_cast<Unsigned_Integer>(base);
+    bool is_negative = false;
 
-    BOOST_IF_CONSTEXPR (std::is_signed<Integer>::value)
+    BOOST_IF_CONSTEXPR (detail::is_signed<Integer>::value)
     {
         if (value < 0)
         {
-            *first++ = '-';
+            is_negative = true;
             unsigned_value = static_cast<Unsigned_Integer>(detail::apply_sign(value));
         }
         else
@@ -383,7 +917,7 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
         case 16:
             while (unsigned_value != 0)
             {
-                *end-- = digit_table[unsigned_value & 15U]; // 1<<4 - 1
+                *end-- = digit_table()[unsigned_value & 15U]; // 1<<4 - 1
                 unsigned_value >>= static_cast<Unsigned_Integer>(4);
             }
             break;
@@ -391,7 +925,7 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
         case 32:
             while (unsigned_value != 0)
             {
-                *end-- = digit_table[unsigned_value & 31U]; // 1<<5 - 1
+                *end-- = digit_table()[unsigned_value & 31U]; // 1<<5 - 1
                 unsigned_value >>= static_cast<Unsigned_Integer>(5);
             }
             break;
@@ -399,7 +933,7 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
         default:
             while (unsigned_value != 0)
             {
-                *end-- = digit_table[unsigned_value % unsigned_base];
+                *end-- = digit_table()[unsigned_value % unsigned_base];
                 unsigned_value /= unsigned_base;
             }
             break;
@@ -407,29 +941,103 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
 
     const std::ptrdiff_t num_chars = buffer_end - end - 1;
 
-    if (num_chars > output_length)
+    if (static_cast<std::ptrdiff_t>(is_negative) + num_chars > last - first)
     {
         return {last, std::errc::result_out_of_range};
     }
 
+    if (is_negative)
+    {
+        *first++ = '-';
+    }
+
     boost::charconv::detail::memcpy(first, buffer + (buffer_size - static_cast<unsigned long>(num_chars)),
                                     static_cast<std::size_t>(num_chars));
 
     return {first + num_chars, std::errc()};
 }
 
-#if defined(__GNUC__) && __GNUC__ >= 5
-# pragma GCC diagnostic pop
-#elif defined(__clang__)
-# pragma clang diagnostic pop
-#endif
+// The number of digits in base that fit in 32 bits, and base to the power of it
+BOOST_CHARCONV_GPU_ENABLED constexpr int base_chunk_digits(std::uint64_t base, std::uint64_t power = 1, int digits = 0) noexcept
+{
+    return power * base > UINT32_MAX ? digits : base_chunk_digits(base, power * base, digits + 1);
+}
 
-#ifdef BOOST_MSVC
-# pragma warning(pop)
-#endif
+BOOST_CHARCONV_GPU_ENABLED constexpr std::uint32_t base_chunk_power(std::uint64_t base, int digits) noexcept
+{
+    return digits == 0 ? 1U : static_cast<std::uint32_t>(base * base_chunk_power(base, digits - 1));
+}
+
+// All other bases with Base known at compile time, so that the divisions by it are multiplications and shifts.
+// Wider values are split into chunks of Base^chunk_digits with one division each, which are then written with
+// 32-bit arithmetic: for 64-bit values that is one wide division per 6 digits in base 36 instead of one per digit,
+// and for 128-bit ones, where the division is a call into the runtime library, one per 12 or more digits
+template <unsigned Base, typename Integer, typename Unsigned_Integer>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char* last, Integer value) noexcept
+{
+    static_assert(Base >= 2 && Base <= 36, "Base has to be between 2 and 36");
+
+    if (first > last)
+    {
+        return {last, std::errc::invalid_argument};
+    }
+
+    using Carrier = typename std::conditional<sizeof(Unsigned_Integer) <= sizeof(std::uint64_t), std::uint64_t, Unsigned_Integer>::type;
+    constexpr int chunk_digits = base_chunk_digits(Base);
+    constexpr std::uint32_t chunk_power = base_chunk_power(Base, chunk_digits);
+
+    bool is_negative = false;
+    auto unsigned_value = static_cast<Carrier>(static_cast<Unsigned_Integer>(value));
+    BOOST_IF_CONSTEXPR (detail::is_signed<Integer>::value)
+    {
+        if (value < 0)
+        {
+            is_negative = true;
+            unsigned_value = static_cast<Carrier>(static_cast<Unsigned_Integer>(detail::apply_sign(value)));
+        }
+    }
+
+    constexpr auto buffer_size = sizeof(Unsigned_Integer) * CHAR_BIT;
+    char buffer[buffer_size] {};
+    char* const buffer_end = buffer + buffer_size;
+    char* end = buffer_end;
+
+    while (unsigned_value > UINT32_MAX)
+    {
+        auto chunk = static_cast<std::uint32_t>(unsigned_value % chunk_power);
+        unsigned_value /= chunk_power;
+        for (int i = 0; i < chunk_digits; ++i)
+        {
+            *--end = digit_table()[chunk % Base];
+            chunk /= Base;
+        }
+    }
+
+    // 0 has one digit
+    auto small_value = static_cast<std::uint32_t>(unsigned_value);
+    do
+    {
+        *--end = digit_table()[small_value % Base];
+        small_value /= Base;
+    } while (small_value != 0);
+
+    const std::ptrdiff_t num_chars = buffer_end - end;
+    if (static_cast<std::ptrdiff_t>(is_negative) + num_chars > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (is_negative)
+    {
+        *first++ = '-';
+    }
+    boost::charconv::detail::memcpy(first, end, static_cast<std::size_t>(num_chars));
+
+    return {first + num_chars, std::errc()};
+}
 
 template <typename Integer>
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_int(char* first, char* last, Integer value, int base = 10) noexcept
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_int(char* first, char* last, Integer value, int base = 10) noexcept
 {
     using Unsigned_Integer = typename std::make_unsigned<Integer>::type;
     if (base == 10)
@@ -453,6 +1061,247 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars128(char* first, char* last, In
 }
 #endif
 
+// Number of characters to_chars writes for value, or 0 for an invalid base.
+// Base 10 uses the search trees, which count 0 as the one digit to_chars writes for it
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CXX14_CONSTEXPR std::size_t decimal_length(std::uint32_t value) noexcept
+{
+    return static_cast<std::size_t>(num_digits(value));
+}
+
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CXX14_CONSTEXPR std::size_t decimal_length(std::uint64_t value) noexcept
+{
+    return static_cast<std::size_t>(num_digits(value));
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+BOOST_CHARCONV_CXX14_CONSTEXPR std::size_t decimal_length(boost::uint128_type value) noexcept
+{
+    // This search tree has no branch for 0
+    return value == 0 ? 1U : static_cast<std::size_t>(num_digits(value));
+}
+#endif
+
+template <typename Integer, typename Unsigned_Integer = detail::make_unsigned_t<Integer>>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CXX14_CONSTEXPR std::size_t to_chars_length_impl(Integer value, int base = 10) noexcept
+{
+    if (!((base >= 2) && (base <= 36)))
+    {
+        return 0;
+    }
+
+    std::size_t length = 0;
+    auto unsigned_value = static_cast<Unsigned_Integer>(value);
+    BOOST_IF_CONSTEXPR (detail::is_signed<Integer>::value)
+    {
+        if (value < 0)
+        {
+            ++length;
+            unsigned_value = static_cast<Unsigned_Integer>(detail::apply_sign(value));
+        }
+    }
+
+    if (base == 10)
+    {
+        using Carrier = typename std::conditional<sizeof(Unsigned_Integer) <= sizeof(std::uint32_t), std::uint32_t,
+                        typename std::conditional<sizeof(Unsigned_Integer) <= sizeof(std::uint64_t), std::uint64_t,
+                        Unsigned_Integer>::type>::type;
+
+        return length + decimal_length(static_cast<Carrier>(unsigned_value));
+    }
+
+    const auto unsigned_base = static_cast<Unsigned_Integer>(base);
+    do
+    {
+        ++length;
+        unsigned_value /= unsigned_base;
+    } while (unsigned_value != 0);
+
+    return length;
+}
+
+// Writes value right aligned in exactly width characters with fill in front of it.
+// The digits are stored two at a time from the end of the field, so their number is never computed.
+// With a fill of '0' the sign goes first ("-0042" like %05d) and the field is filled with the digits themselves,
+// those above value being "00" from radix_table, which makes the number of stores depend on the width only
+template <typename Integer, typename Unsigned_Integer = detail::make_unsigned_t<Integer>>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_fixed_width_impl(char* first, char* last, Integer value, int width, char fill) noexcept
+{
+    if (first > last || width < 0)
+    {
+        return {last, std::errc::invalid_argument};
+    }
+    if (width > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    using Carrier = typename std::conditional<sizeof(Unsigned_Integer) <= sizeof(std::uint32_t), std::uint32_t,
+                    typename std::conditional<sizeof(Unsigned_Integer) <= sizeof(std::uint64_t), std::uint64_t,
+                    Unsigned_Integer>::type>::type;
+
+    bool is_negative = false;
+    auto unsigned_value = static_cast<Carrier>(static_cast<Unsigned_Integer>(value));
+    BOOST_IF_CONSTEXPR (detail::is_signed<Integer>::value)
+    {
+        if (value < 0)
+        {
+            is_negative = true;
+            unsigned_value = static_cast<Carrier>(static_cast<Unsigned_Integer>(detail::apply_sign(value)));
+        }
+    }
+
+    char* const field_last = first + width;
+    char* next = field_last;
+
+    if (fill == '0')
+    {
+        // There is at least one digit, even for 0
+        char* const digits_first = first + static_cast<int>(is_negative);
+        if (digits_first >= field_last)
+        {
+            return {last, std::errc::result_out_of_range};
+        }
+
+        while (next - digits_first >= 2)
+        {
+            next -= 2;
+            boost::charconv::detail::memcpy(next, radix_table() + static_cast<std::size_t>(unsigned_value % 100U) * 2, 2);
+            unsigned_value /= 100U;
+        }
+        if (next != digits_first)
+        {
+            *--next = static_cast<char>('0' + static_cast<int>(unsigned_value % 10U));
+            unsigned_value /= 10U;
+        }
+
+        if (unsigned_value != 0)
+        {
+            return {last, std::errc::result_out_of_range};
+        }
+        if (is_negative)
+        {
+            *first = '-';
+        }
+
+        return {field_last, std::errc()};
+    }
+
+    while (unsigned_value >= 100U)
+    {
+        if (next - first < 2)
+        {
+            return {last, std::errc::result_out_of_range};
+        }
+        next -= 2;
+        boost::charconv::detail::memcpy(next, radix_table() + static_cast<std::size_t>(unsigned_value % 100U) * 2, 2);
+        unsigned_value /= 100U;
+    }
+
+    const std::ptrdiff_t leading_chars = (unsigned_value >= 10U ? 2 : 1) + static_cast<int>(is_negative);
+    if (next - first < leading_chars)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (unsigned_value >= 10U)
+    {
+        next -= 2;
+        boost::charconv::detail::memcpy(next, radix_table() + static_cast<std::size_t>(unsigned_value) * 2, 2);
+    }
+    else
+    {
+        *--next = static_cast<char>('0' + static_cast<int>(unsigned_value));
+    }
+    if (is_negative)
+    {
+        *--next = '-';
+    }
+
+    while (next != first)
+    {
+        *--next = fill;
+    }
+
+    return {field_last, std::errc()};
+}
+
+// Writes value in base 10 with separator between every three digits ("1,234,567").
+// The length is known from the number of digits, so the groups are stored from the end of the output as they are produced
+template <typename Integer, typename Unsigned_Integer = detail::make_unsigned_t<Integer>>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_grouped_impl(char* first, char* last, Integer value, char separator) noexcept
+{
+    if (first > last)
+    {
+        return {last, std::errc::invalid_argument};
+    }
+
+    using Carrier = typename std::conditional<sizeof(Unsigned_Integer) <= sizeof(std::uint32_t), std::uint32_t,
+                    typename std::conditional<sizeof(Unsigned_Integer) <= sizeof(std::uint64_t), std::uint64_t,
+                    Unsigned_Integer>::type>::type;
+
+    bool is_negative = false;
+    auto unsigned_value = static_cast<Carrier>(static_cast<Unsigned_Integer>(value));
+    BOOST_IF_CONSTEXPR (detail::is_signed<Integer>::value)
+    {
+        if (value < 0)
+        {
+            is_negative = true;
+            unsigned_value = static_cast<Carrier>(static_cast<Unsigned_Integer>(detail::apply_sign(value)));
+        }
+    }
+
+    const auto digits = static_cast<std::ptrdiff_t>(decimal_length(unsigned_value));
+    const std::ptrdiff_t length = static_cast<std::ptrdiff_t>(is_negative) + digits + (digits - 1) / 3;
+    if (length > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    char* next = first + length;
+    while (unsigned_value >= 1000U)
+    {
+        const auto group = static_cast<std::size_t>(unsigned_value % 1000U);
+        unsigned_value /= 1000U;
+        next -= 3;
+        *next = static_cast<char>('0' + group / 100U);
+        boost::charconv::detail::memcpy(next + 1, radix_table() + (group % 100U) * 2, 2);
+        *--next = separator;
+    }
+
+    const auto leading = static_cast<std::size_t>(unsigned_value);
+    if (leading >= 100U)
+    {
+        next -= 3;
+        *next = static_cast<char>('0' + leading / 100U);
+        boost::charconv::detail::memcpy(next + 1, radix_table() + (leading % 100U) * 2, 2);
+    }
+    else if (leading >= 10U)
+    {
+        next -= 2;
+        boost::charconv::detail::memcpy(next, radix_table() + leading * 2, 2);
+    }
+    else
+    {
+        *--next = static_cast<char>('0' + leading);
+    }
+    if (is_negative)
+    {
+        *--next = '-';
+    }
+
+    return {first + length, std::errc()};
+}
+
+#if defined(__GNUC__) && __GNUC__ >= 5
+# pragma GCC diagnostic pop
+#elif defined(__clang__)
+# pragma clang diagnostic pop
+#endif
+
+#ifdef BOOST_MSVC
+# pragma warning(pop)
+#endif
+
 }}} // Namespaces
 
 #endif //BOOST_CHARCONV_DETAIL_TO_CHARS_INTEGER_IMPL_HPP
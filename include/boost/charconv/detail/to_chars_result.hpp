@@ -5,23 +5,75 @@
 #ifndef BOOST_CHARCONV_DETAIL_TO_CHARS_RESULT_HPP
 #define BOOST_CHARCONV_DETAIL_TO_CHARS_RESULT_HPP
 
+#include <boost/charconv/detail/config.hpp>
 #include <system_error>
+#include <cstddef>
+#include <cstdint>
 
 // 22.13.2, Primitive numerical output conversion
 
 namespace boost { namespace charconv {
 
-struct to_chars_result
+template <typename UC>
+struct to_chars_result_t
 {
-    char *ptr;
+    UC *ptr;
     std::errc ec;
 
-    constexpr friend bool operator==(const to_chars_result &lhs, const to_chars_result &rhs) noexcept
+    BOOST_CHARCONV_GPU_ENABLED constexpr friend bool operator==(const to_chars_result_t<UC> &lhs, const to_chars_result_t<UC> &rhs) noexcept
     {
         return lhs.ptr == rhs.ptr && lhs.ec == rhs.ec;
     }
 
-    constexpr friend bool operator!=(const to_chars_result &lhs, const to_chars_result &rhs) noexcept
+    BOOST_CHARCONV_GPU_ENABLED constexpr friend bool operator!=(const to_chars_result_t<UC> &lhs, const to_chars_result_t<UC> &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    BOOST_CHARCONV_GPU_ENABLED constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+using to_chars_result = to_chars_result_t<char>;
+
+struct to_chars_many_result
+{
+    // One past the end of the last value written. A delimiter is only written in front of the next value
+    char* ptr;
+
+    // Error from the first value that did not fit into the buffer, or 0 if none
+    std::errc ec;
+
+    // Number of values written to the buffer
+    std::size_t count;
+
+    constexpr friend bool operator==(const to_chars_many_result& lhs, const to_chars_many_result& rhs) noexcept
+    {
+        return lhs.ptr == rhs.ptr && lhs.ec == rhs.ec && lhs.count == rhs.count;
+    }
+
+    constexpr friend bool operator!=(const to_chars_many_result& lhs, const to_chars_many_result& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
+struct to_decimal_result
+{
+    // The value is (is_negative ? -1 : 1) * significand * 10^exponent, with no trailing zeros in the significand
+    std::uint64_t significand;
+    std::int32_t exponent;
+    bool is_negative;
+
+    // std::errc::invalid_argument for infinity and nan, which leave the other members zero
+    std::errc ec;
+
+    constexpr friend bool operator==(const to_decimal_result& lhs, const to_decimal_result& rhs) noexcept
+    {
+        return lhs.significand == rhs.significand && lhs.exponent == rhs.exponent && lhs.is_negative == rhs.is_negative && lhs.ec == rhs.ec;
+    }
+
+    constexpr friend bool operator!=(const to_decimal_result& lhs, const to_decimal_result& rhs) noexcept
     {
         return !(lhs == rhs);
     }
@@ -6,6 +6,7 @@
 #define BOOST_CHARCONV_DETAIL_TYPE_TRAITS_HPP
 
 #include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/emulated128.hpp>
 #include <type_traits>
 
 namespace boost { namespace charconv { namespace detail {
@@ -62,6 +63,40 @@ struct make_signed<boost::uint128_type> { using type = boost::int128_type; };
 
 #endif
 
+// Character types other than char that from_chars and to_chars accept
+template <typename T>
+struct is_extended_char : std::false_type {};
+
+template <>
+struct is_extended_char<wchar_t> : std::true_type {};
+
+template <>
+struct is_extended_char<char16_t> : std::true_type {};
+
+template <>
+struct is_extended_char<char32_t> : std::true_type {};
+
+#ifdef BOOST_CHARCONV_HAS_CHAR8_T
+
+template <>
+struct is_extended_char<char8_t> : std::true_type {};
+
+#endif
+
+// Integer value types of from_chars and to_chars: all integer types except bool and the character types other than char
+template <typename T>
+struct is_charconv_integer : std::integral_constant<bool, std::is_integral<T>::value && !std::is_same<T, bool>::value && !is_extended_char<T>::value> {};
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+
+template <>
+struct is_charconv_integer<boost::int128_type> : std::true_type {};
+
+template <>
+struct is_charconv_integer<boost::uint128_type> : std::true_type {};
+
+#endif
+
 }}} // Namespaces
 
 #endif //BOOST_CHARCONV_DETAIL_TYPE_TRAITS_HPP
@@ -0,0 +1,163 @@
+// Copyright 2022 Peter Dimov
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_EXTENDED_FLOAT_HPP_INCLUDED
+#define BOOST_CHARCONV_EXTENDED_FLOAT_HPP_INCLUDED
+
+// to_chars and from_chars for __float128 and the <stdfloat> types where the compiler has them, compiled into the library.
+// They take the same arguments and follow the same rules as the overloads for float and double in <boost/charconv/float.hpp>
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/config.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+
+namespace boost { namespace charconv {
+
+//----------------------------------------------------------------------------------------------------------------------
+// to_chars
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, __float128 value,
+                                             chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, std::float16_t value, 
+                                             chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_FLOAT32
+BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, std::float32_t value, 
+                                             chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_FLOAT64
+BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, std::float64_t value, 
+                                             chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
+#endif
+#if defined(BOOST_CHARCONV_HAS_STDFLOAT128) && defined(BOOST_CHARCONV_HAS_FLOAT128)
+BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, std::float128_t value,
+                                             chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, std::bfloat16_t value, 
+                                             chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
+#endif
+
+// to_chars_many for arrays of 16-bit values, see <boost/charconv/float.hpp>. The shortest representation is that of the 16-bit format.
+// With a precision or in hex the output is that of the value widened to float, and blocks of values are widened at once
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+BOOST_CHARCONV_DECL to_chars_many_result to_chars_many(char* first, char* last, const std::float16_t* values, std::size_t n, char delimiter,
+                                                       chars_format fmt = chars_format::general, int precision = -1) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+BOOST_CHARCONV_DECL to_chars_many_result to_chars_many(char* first, char* last, const std::bfloat16_t* values, std::size_t n, char delimiter,
+                                                       chars_format fmt = chars_format::general, int precision = -1) noexcept;
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+// from_chars
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+BOOST_CHARCONV_DECL from_chars_result from_chars_erange(const char* first, const char* last, __float128& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+BOOST_CHARCONV_DECL from_chars_result from_chars_erange(const char* first, const char* last, std::float16_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_FLOAT32
+BOOST_CHARCONV_DECL from_chars_result from_chars_erange(const char* first, const char* last, std::float32_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_FLOAT64
+BOOST_CHARCONV_DECL from_chars_result from_chars_erange(const char* first, const char* last, std::float64_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#if defined(BOOST_CHARCONV_HAS_STDFLOAT128) && defined(BOOST_CHARCONV_HAS_FLOAT128)
+BOOST_CHARCONV_DECL from_chars_result from_chars_erange(const char* first, const char* last, std::float128_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+BOOST_CHARCONV_DECL from_chars_result from_chars_erange(const char* first, const char* last, std::bfloat16_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+BOOST_CHARCONV_DECL from_chars_result from_chars_erange(boost::core::string_view sv, __float128& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+BOOST_CHARCONV_DECL from_chars_result from_chars_erange(boost::core::string_view sv, std::float16_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_FLOAT32
+BOOST_CHARCONV_DECL from_chars_result from_chars_erange(boost::core::string_view sv, std::float32_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_FLOAT64
+BOOST_CHARCONV_DECL from_chars_result from_chars_erange(boost::core::string_view sv, std::float64_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#if defined(BOOST_CHARCONV_HAS_STDFLOAT128) && defined(BOOST_CHARCONV_HAS_FLOAT128)
+BOOST_CHARCONV_DECL from_chars_result from_chars_erange(boost::core::string_view sv, std::float128_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+BOOST_CHARCONV_DECL from_chars_result from_chars_erange(boost::core::string_view sv, std::bfloat16_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, __float128& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, std::float16_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_FLOAT32
+BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, std::float32_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_FLOAT64
+BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, std::float64_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#if defined(BOOST_CHARCONV_HAS_STDFLOAT128) && defined(BOOST_CHARCONV_HAS_FLOAT128)
+BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, std::float128_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, std::bfloat16_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, __float128& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, std::float16_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_FLOAT32
+BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, std::float32_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_FLOAT64
+BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, std::float64_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#if defined(BOOST_CHARCONV_HAS_STDFLOAT128) && defined(BOOST_CHARCONV_HAS_FLOAT128)
+BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, std::float128_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, std::bfloat16_t& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+
+
+// from_chars_many for arrays of 16-bit values, see <boost/charconv/float.hpp>. Each value is rounded straight from its digits,
+// the same as from_chars
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+BOOST_CHARCONV_DECL from_chars_many_result from_chars_many(const char* first, const char* last, std::float16_t* out, std::size_t n, char delimiter, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_many_result from_chars_many(boost::core::string_view sv, std::float16_t* out, std::size_t n, char delimiter, chars_format fmt = chars_format::general) noexcept;
+#endif
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+BOOST_CHARCONV_DECL from_chars_many_result from_chars_many(const char* first, const char* last, std::bfloat16_t* out, std::size_t n, char delimiter, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_many_result from_chars_many(boost::core::string_view sv, std::bfloat16_t* out, std::size_t n, char delimiter, chars_format fmt = chars_format::general) noexcept;
+#endif
+
+}} // Namespaces
+
+#ifdef BOOST_CHARCONV_HEADER_ONLY
+#  include <boost/charconv/float.hpp>
+#endif
+
+#endif // BOOST_CHARCONV_EXTENDED_FLOAT_HPP_INCLUDED
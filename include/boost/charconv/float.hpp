@@ -0,0 +1,239 @@
+// Copyright 2022 Peter Dimov
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_FLOAT_HPP_INCLUDED
+#define BOOST_CHARCONV_FLOAT_HPP_INCLUDED
+
+// to_chars and from_chars for float, double and long double. They are compiled into the library, so only these
+// declarations are parsed. With BOOST_CHARCONV_HEADER_ONLY the definitions of the engines are included here instead
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
+#include <boost/charconv/detail/bit_layouts.hpp>
+#include <boost/charconv/config.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <system_error>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost { namespace charconv {
+
+//----------------------------------------------------------------------------------------------------------------------
+// to_chars
+//----------------------------------------------------------------------------------------------------------------------
+
+BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, float value,
+                                             chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, double value, 
+                                             chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, long double value,
+                                             chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
+
+// Writes the decimal point and exponent character of options instead of '.' and 'e', as the digits are printed.
+// The output has the same length as above. Options that could be read as part of a number return std::errc::invalid_argument
+BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, float value, chars_format fmt, chars_format_options options) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, double value, chars_format fmt, chars_format_options options) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, float value, chars_format fmt, int precision, chars_format_options options) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, double value, chars_format fmt, int precision, chars_format_options options) noexcept;
+
+// Rounds the digits that the precision leaves out in the direction of mode instead of to nearest, like printf does in the matching
+// rounding mode of the floating point environment, which itself is never used. Hexadecimal output and the shortest representation
+// (a negative precision) are only written to nearest, and return std::errc::invalid_argument for the other modes
+BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, float value, chars_format fmt, int precision, rounding_mode mode) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, double value, chars_format fmt, int precision, rounding_mode mode) noexcept;
+
+// Number of characters to_chars writes for value with the same format and precision, without writing them.
+// The shortest representation is sized from the Dragonbox decimal significand and exponent alone
+BOOST_CHARCONV_DECL std::size_t to_chars_length(float value, chars_format fmt = chars_format::general, int precision = -1) noexcept;
+BOOST_CHARCONV_DECL std::size_t to_chars_length(double value, chars_format fmt = chars_format::general, int precision = -1) noexcept;
+
+// Writes value as a number of the JSON (RFC 8259) grammar: the shortest representation, as by to_chars with chars_format::general.
+// JSON has no infinity or nan, so non-finite values are written as null
+BOOST_CHARCONV_DECL to_chars_result json_to_chars(char* first, char* last, float value) noexcept;
+BOOST_CHARCONV_DECL to_chars_result json_to_chars(char* first, char* last, double value) noexcept;
+
+// Writes the shortest representation of value, as by to_chars with fmt, when it has at most max_digits significant digits.
+// Longer ones are correctly rounded to max_digits digits instead, the same as to_chars with a precision of max_digits
+// in general notation, or of max_digits - 1 in scientific notation. Other formats, or max_digits < 1, return std::errc::invalid_argument
+BOOST_CHARCONV_DECL to_chars_result to_chars_max_digits(char* first, char* last, float value, int max_digits,
+                                                        chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars_max_digits(char* first, char* last, double value, int max_digits,
+                                                        chars_format fmt = chars_format::general) noexcept;
+
+// The shortest decimal representation of value as integers instead of text: the Dragonbox significand and exponent that
+// to_chars prints. Zero is a significand and exponent of 0 with the sign of value. from_decimal converts the result back to value
+BOOST_CHARCONV_DECL to_decimal_result to_decimal(float value) noexcept;
+BOOST_CHARCONV_DECL to_decimal_result to_decimal(double value) noexcept;
+
+// Writes value in engineering notation with the exponent replaced by its SI prefix, like 4.7k or 12.5n.
+// The shortest representation is written for a negative precision, and precision digits after the first one otherwise.
+// Exponents past the prefixes, from quecto (10^-30) to quetta (10^30), are written as by chars_format::engineering.
+// Micro is written as U+00B5 in UTF-8, which takes two characters
+BOOST_CHARCONV_DECL to_chars_result to_chars_si(char* first, char* last, float value, int precision = -1) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars_si(char* first, char* last, double value, int precision = -1) noexcept;
+
+// Writes the n values of values separated by a single delimiter character into [first, last).
+// Each value is formatted as by to_chars above. If the buffer runs out the values that fit are kept,
+// count says how many there are, and ptr points one past the end of the last of them
+
+BOOST_CHARCONV_DECL to_chars_many_result to_chars_many(char* first, char* last, const float* values, std::size_t n, char delimiter,
+                                                       chars_format fmt = chars_format::general, int precision = -1) noexcept;
+BOOST_CHARCONV_DECL to_chars_many_result to_chars_many(char* first, char* last, const double* values, std::size_t n, char delimiter,
+                                                       chars_format fmt = chars_format::general, int precision = -1) noexcept;
+
+//----------------------------------------------------------------------------------------------------------------------
+// from_chars
+//----------------------------------------------------------------------------------------------------------------------
+
+BOOST_CHARCONV_DECL from_chars_result from_chars_erange(const char* first, const char* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_erange(const char* first, const char* last, double& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_erange(const char* first, const char* last, long double& value, chars_format fmt = chars_format::general) noexcept;
+
+BOOST_CHARCONV_DECL from_chars_result from_chars_erange(boost::core::string_view sv, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_erange(boost::core::string_view sv, double& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_erange(boost::core::string_view sv, long double& value, chars_format fmt = chars_format::general) noexcept;
+
+// The following adhere to the standard library definition with std::errc::result_out_of_range
+// Returns value unmodified
+// See: https://github.com/cppalliance/charconv/issues/110
+
+BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, double& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, long double& value, chars_format fmt = chars_format::general) noexcept;
+
+BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, double& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, long double& value, chars_format fmt = chars_format::general) noexcept;
+
+// parse<Real>(first, last) returns the value with ptr and ec, see the integer overloads
+template <typename Real, typename std::enable_if<std::is_floating_point<Real>::value, bool>::type = true>
+inline from_chars_value<Real> parse(const char* first, const char* last, chars_format fmt = chars_format::general) noexcept
+{
+    Real value {};
+    const auto r = boost::charconv::from_chars(first, last, value, fmt);
+    return {value, r.ptr, r.ec};
+}
+
+template <typename Real, typename std::enable_if<std::is_floating_point<Real>::value, bool>::type = true>
+inline from_chars_value<Real> parse(boost::core::string_view sv, chars_format fmt = chars_format::general) noexcept
+{
+    return boost::charconv::parse<Real>(sv.data(), sv.data() + sv.size(), fmt);
+}
+
+// Other character types. fast_float and the hexadecimal parser read wchar_t, char16_t and char32_t directly.
+// Since UTF-8 code units are char, char8_t input is parsed as char with all the types and formats above
+
+BOOST_CHARCONV_DECL from_chars_result_t<wchar_t> from_chars(const wchar_t* first, const wchar_t* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<wchar_t> from_chars(const wchar_t* first, const wchar_t* last, double& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<char16_t> from_chars(const char16_t* first, const char16_t* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<char16_t> from_chars(const char16_t* first, const char16_t* last, double& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<char32_t> from_chars(const char32_t* first, const char32_t* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<char32_t> from_chars(const char32_t* first, const char32_t* last, double& value, chars_format fmt = chars_format::general) noexcept;
+
+#ifdef BOOST_CHARCONV_HAS_CHAR8_T
+template <typename Real, typename std::enable_if<std::is_floating_point<Real>::value, bool>::type = true>
+from_chars_result_t<char8_t> from_chars(const char8_t* first, const char8_t* last, Real& value, chars_format fmt = chars_format::general) noexcept
+{
+    const auto narrow_first = reinterpret_cast<const char*>(first);
+    const auto r = boost::charconv::from_chars(narrow_first, reinterpret_cast<const char*>(last), value, fmt);
+    return {first + (r.ptr - narrow_first), r.ec};
+}
+#endif
+
+// Parses with the decimal point and exponent character of options instead of '.' and 'e'.
+// Both are checked where fast_float (or the hexadecimal parser) reads them, and the C locale is never consulted.
+// Options that could be read as part of a number return std::errc::invalid_argument with ptr == first
+
+BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, float& value, chars_format fmt, chars_format_options options) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, double& value, chars_format fmt, chars_format_options options) noexcept;
+
+BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, float& value, chars_format fmt, chars_format_options options) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, double& value, chars_format fmt, chars_format_options options) noexcept;
+
+// Rounds the value in the direction of mode instead of to nearest, whatever the rounding mode of the floating point environment.
+// A value that rounds to infinity, or to zero while the digits are not all zeros, returns std::errc::result_out_of_range,
+// so a value too large for the type gives the largest finite one toward zero. value is only written on success
+
+BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, float& value, chars_format fmt, rounding_mode mode) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, double& value, chars_format fmt, rounding_mode mode) noexcept;
+
+BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, float& value, chars_format fmt, rounding_mode mode) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, double& value, chars_format fmt, rounding_mode mode) noexcept;
+
+// Parses a number of the JSON (RFC 8259) grammar, which is validated while it is converted.
+// Unlike chars_format::general there are no leading zeros, infinity or nan, and the point and the exponent must be followed by digits.
+// Input that breaks the grammar returns std::errc::invalid_argument with ptr == first. Otherwise the rules of from_chars above apply
+
+BOOST_CHARCONV_DECL from_chars_result json_from_chars(const char* first, const char* last, float& value) noexcept;
+BOOST_CHARCONV_DECL from_chars_result json_from_chars(const char* first, const char* last, double& value) noexcept;
+
+BOOST_CHARCONV_DECL from_chars_result json_from_chars(boost::core::string_view sv, float& value) noexcept;
+BOOST_CHARCONV_DECL from_chars_result json_from_chars(boost::core::string_view sv, double& value) noexcept;
+
+// Parses the output of to_chars for a finite value in a decimal format, which is trusted to be well formed.
+// [first, last) must be exactly one such number: infinity, nan and a leading '+' are not probed for, and the syntax
+// is not validated (debug builds assert the preconditions). Otherwise the rules of from_chars above apply
+
+BOOST_CHARCONV_DECL from_chars_result from_chars_unchecked(const char* first, const char* last, float& value) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_unchecked(const char* first, const char* last, double& value) noexcept;
+
+BOOST_CHARCONV_DECL from_chars_result from_chars_unchecked(boost::core::string_view sv, float& value) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_unchecked(boost::core::string_view sv, double& value) noexcept;
+
+// Parses like from_chars, but within one unit in the last place of the digits instead of correctly rounded, so that
+// no input takes the big integer comparison. The time of a call is bounded by a constant plus the scan of its characters.
+// Significands of up to 19 digits, and hexadecimal ones, are still rounded to nearest, and longer ones from their first 19 digits
+
+BOOST_CHARCONV_DECL from_chars_result from_chars_faithful(const char* first, const char* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_faithful(const char* first, const char* last, double& value, chars_format fmt = chars_format::general) noexcept;
+
+BOOST_CHARCONV_DECL from_chars_result from_chars_faithful(boost::core::string_view sv, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_faithful(boost::core::string_view sv, double& value, chars_format fmt = chars_format::general) noexcept;
+
+// Converts the decimal (is_negative ? -1 : 1) * significand * 10^exponent to the nearest value, the same one as from_chars
+// gives for its digits, without any text. Values too large or too small for the type return std::errc::result_out_of_range,
+// and value is only written on success
+BOOST_CHARCONV_DECL std::errc from_decimal(std::uint64_t significand, std::int32_t exponent, bool is_negative, float& value) noexcept;
+BOOST_CHARCONV_DECL std::errc from_decimal(std::uint64_t significand, std::int32_t exponent, bool is_negative, double& value) noexcept;
+
+// Parses up to n values separated by a single delimiter character into out.
+// Parsing stops at last, after the n-th value, or at the first field that fails to parse.
+// Values follow the same rules as from_chars above (the output is unmodified on error)
+
+BOOST_CHARCONV_DECL from_chars_many_result from_chars_many(const char* first, const char* last, float* out, std::size_t n, char delimiter, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_many_result from_chars_many(const char* first, const char* last, double* out, std::size_t n, char delimiter, chars_format fmt = chars_format::general) noexcept;
+
+BOOST_CHARCONV_DECL from_chars_many_result from_chars_many(boost::core::string_view sv, float* out, std::size_t n, char delimiter, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_many_result from_chars_many(boost::core::string_view sv, double* out, std::size_t n, char delimiter, chars_format fmt = chars_format::general) noexcept;
+
+// Checks that [first, last) is a sequence of numbers separated by a single delimiter character, which from_chars_many
+// would parse with fmt, without converting them. Only the syntax is checked, so values out of the range of every type
+// are valid. On failure ptr is the first character of the first invalid field and ec is std::errc::invalid_argument.
+// count is the number of valid fields before it
+
+BOOST_CHARCONV_DECL from_chars_many_result validate_numbers(const char* first, const char* last, char delimiter, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_many_result validate_numbers(boost::core::string_view sv, char delimiter, chars_format fmt = chars_format::general) noexcept;
+
+// Finds in one scan whether [first, last) starts with an integer (only digits after an optional '-'),
+// a floating point number of chars_format::general, or neither, and converts it at the same time.
+// Integers too large for 128 bits are floating. Errors are those of from_chars, with kind == number_kind::none
+
+BOOST_CHARCONV_DECL from_chars_classify_result from_chars_classify(const char* first, const char* last) noexcept;
+BOOST_CHARCONV_DECL from_chars_classify_result from_chars_classify(boost::core::string_view sv) noexcept;
+
+}} // Namespaces
+
+#ifdef BOOST_CHARCONV_HEADER_ONLY
+// The definitions of the extended types are in the same files
+#  include <boost/charconv/extended_float.hpp>
+#  include <boost/charconv/detail/impl/from_chars.ipp>
+#  include <boost/charconv/detail/impl/to_chars.ipp>
+#endif
+
+#endif // BOOST_CHARCONV_FLOAT_HPP_INCLUDED
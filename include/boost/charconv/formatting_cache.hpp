@@ -0,0 +1,146 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_FORMATTING_CACHE_HPP
+#define BOOST_CHARCONV_FORMATTING_CACHE_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <type_traits>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost { namespace charconv {
+
+struct formatting_cache_stats
+{
+    // Calls that copied the characters of a cached entry
+    std::uint64_t hits;
+
+    // Calls that went to to_chars
+    std::uint64_t misses;
+};
+
+// A direct mapped cache of the output of to_chars for columns that repeat the same few values, e.g. 0, 1, 0.5 or 100.
+// The entry of a value is picked by its bit pattern, and it holds the characters of the last value with the same
+// format and precision that was written there. A hit copies them instead of running the conversion, and a miss calls
+// to_chars and keeps its output if it is at most max_entry_length characters long.
+//
+// The cache belongs to one thread at a time. It takes Entries * 64 bytes, and Entries has to be a power of two
+template <typename Real, std::size_t Entries = 256>
+class formatting_cache
+{
+    static_assert(std::is_same<Real, float>::value || std::is_same<Real, double>::value, "Real has to be float or double");
+    static_assert(Entries != 0 && (Entries & (Entries - 1)) == 0, "Entries has to be a power of two");
+
+    using bits_type = typename std::conditional<std::is_same<Real, double>::value, std::uint64_t, std::uint32_t>::type;
+
+    // One entry per cache line, and the entries start on one, so that a lookup touches a single cache line
+    struct entry
+    {
+        std::uint64_t bits;
+        std::int32_t precision;
+        unsigned char fmt;
+
+        // 0 for an empty entry, since to_chars writes at least one character
+        unsigned char length;
+        char chars[50];
+    };
+
+    static_assert(sizeof(entry) == BOOST_CHARCONV_CACHE_LINE_SIZE, "An entry should fill a cache line");
+
+public:
+    // Longest output that is kept. The shortest representation of every value fits
+    static constexpr std::size_t max_entry_length = sizeof(entry::chars);
+
+    formatting_cache() noexcept
+    {
+        clear();
+    }
+
+    // Writes the same characters as to_chars(first, last, value, fmt, precision). A hit only needs room for them
+    to_chars_result to_chars(char* first, char* last, Real value, chars_format fmt = chars_format::general, int precision = -1) noexcept
+    {
+        bits_type value_bits;
+        std::memcpy(&value_bits, &value, sizeof(value));
+
+        entry& e = entries_[index(value_bits, fmt, precision)];
+        if (e.length != 0 && e.bits == value_bits && e.precision == precision && e.fmt == static_cast<unsigned char>(fmt))
+        {
+            ++stats_.hits;
+
+            // Copying all of the characters of the entry is a few fixed size moves
+            const std::ptrdiff_t room = last - first;
+            if (room >= static_cast<std::ptrdiff_t>(max_entry_length))
+            {
+                std::memcpy(first, e.chars, max_entry_length);
+            }
+            else if (room >= static_cast<std::ptrdiff_t>(e.length))
+            {
+                std::memcpy(first, e.chars, e.length);
+            }
+            else
+            {
+                return {last, std::errc::result_out_of_range};
+            }
+
+            return {first + e.length, std::errc()};
+        }
+
+        ++stats_.misses;
+        const auto r = boost::charconv::to_chars(first, last, value, fmt, precision);
+        const auto length = static_cast<std::size_t>(r.ptr - first);
+        if (r && length <= max_entry_length)
+        {
+            e.bits = value_bits;
+            e.precision = precision;
+            e.fmt = static_cast<unsigned char>(fmt);
+            e.length = static_cast<unsigned char>(length);
+            std::memcpy(e.chars, first, length);
+        }
+
+        return r;
+    }
+
+    formatting_cache_stats stats() const noexcept { return stats_; }
+
+    void reset_stats() noexcept { stats_ = formatting_cache_stats {0, 0}; }
+
+    // Empties every entry and resets the statistics
+    void clear() noexcept
+    {
+        for (auto& e : entries_)
+        {
+            e.length = 0;
+        }
+        reset_stats();
+    }
+
+private:
+    // Fibonacci hashing of the bits with the format and precision mixed in, so that the same value in two
+    // formats gets two entries. Short values like 0.5 or 100 only have bits in the exponent and the top of the
+    // significand, so the high half is folded into the low half first, where the multiplication spreads it
+    static std::size_t index(bits_type value_bits, chars_format fmt, int precision) noexcept
+    {
+        constexpr int index_bits = index_width(Entries);
+        std::uint64_t key = static_cast<std::uint64_t>(value_bits);
+        key ^= key >> (sizeof(bits_type) * 4);
+        key ^= (static_cast<std::uint64_t>(static_cast<std::uint32_t>(precision)) << 8) ^ static_cast<std::uint64_t>(fmt);
+        return index_bits == 0 ? 0 : static_cast<std::size_t>((key * UINT64_C(0x9E3779B97F4A7C15)) >> (64 - index_bits));
+    }
+
+    static constexpr int index_width(std::size_t n) noexcept
+    {
+        return n <= 1 ? 0 : 1 + index_width(n / 2);
+    }
+
+    BOOST_CHARCONV_CACHE_LINE_ALIGNED entry entries_[Entries] {};
+    formatting_cache_stats stats_ {0, 0};
+};
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_FORMATTING_CACHE_HPP
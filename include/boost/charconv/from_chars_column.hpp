@@ -0,0 +1,122 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_FROM_CHARS_COLUMN_HPP
+#define BOOST_CHARCONV_FROM_CHARS_COLUMN_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost { namespace charconv {
+
+struct from_chars_column_result
+{
+    // Number of values that are null in the output, those null in the input included
+    std::size_t null_count;
+
+    // Error from the first value that could not be parsed, or 0 if none. Nulls in the input are not errors
+    std::errc ec;
+
+    friend constexpr bool operator==(const from_chars_column_result& lhs, const from_chars_column_result& rhs) noexcept
+    {
+        return lhs.null_count == rhs.null_count && lhs.ec == rhs.ec;
+    }
+
+    friend constexpr bool operator!=(const from_chars_column_result& lhs, const from_chars_column_result& rhs) noexcept
+    {
+        return !(lhs == rhs); // NOLINT : Expression can not be simplified since this is the definition
+    }
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
+namespace detail {
+
+// Bit i of an Arrow validity bitmap is bit i % 8 of byte i / 8
+constexpr bool column_is_valid(const std::uint8_t* validity, std::size_t i) noexcept
+{
+    return validity == nullptr || ((validity[i / 8] >> (i % 8)) & 1U) != 0;
+}
+
+template <typename T, typename Offset, typename Parse>
+from_chars_column_result from_chars_column_impl(const Offset* offsets, const char* data, std::size_t n, T* values,
+                                                std::uint8_t* validity, const std::uint8_t* input_validity, const Parse& parse) noexcept
+{
+    from_chars_column_result result {0, std::errc()};
+
+    // The bits of every 8 values are collected and stored once, instead of updating the bitmap per value
+    std::uint8_t bits = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        bool valid = false;
+        if (column_is_valid(input_validity, i))
+        {
+            const char* first = data + offsets[i];
+            const char* last = data + offsets[i + 1];
+
+            // The whole string has to be the number, anything after it is an error as well
+            const auto r = parse(first, last, values[i]);
+            valid = r.ec == std::errc() && r.ptr == last;
+            if (!valid && result.ec == std::errc())
+            {
+                result.ec = r.ec == std::errc() ? std::errc::invalid_argument : r.ec;
+            }
+        }
+
+        if (!valid)
+        {
+            // Arrow leaves the value of a null undefined, it is zeroed so that the buffer is deterministic
+            values[i] = T{};
+            ++result.null_count;
+        }
+
+        bits = static_cast<std::uint8_t>(bits | (static_cast<unsigned>(valid) << (i % 8)));
+        if (i % 8 == 7)
+        {
+            validity[i / 8] = bits;
+            bits = 0;
+        }
+    }
+
+    // The bits after the last value in the final byte are zero
+    if (n % 8 != 0)
+    {
+        validity[n / 8] = bits;
+    }
+
+    return result;
+}
+
+} // namespace detail
+
+// Parses the n strings of an Arrow string (Offset is std::int32_t) or large string (std::int64_t) column:
+// value i is data[offsets[i], offsets[i + 1]). Each one is written to values[i] and its bit in the validity bitmap,
+// which must have room for (n + 7) / 8 bytes, is set. A string that is not a number from start to end,
+// or null in input_validity (nullptr if there are no nulls), gives a null instead of stopping the parse
+template <typename Real, typename Offset, typename std::enable_if<std::is_floating_point<Real>::value, bool>::type = true>
+from_chars_column_result from_chars_column(const Offset* offsets, const char* data, std::size_t n, Real* values, std::uint8_t* validity,
+                                           chars_format fmt = chars_format::general, const std::uint8_t* input_validity = nullptr) noexcept
+{
+    return detail::from_chars_column_impl(offsets, data, n, values, validity, input_validity,
+                                          [fmt](const char* first, const char* last, Real& value) noexcept { return boost::charconv::from_chars(first, last, value, fmt); });
+}
+
+template <typename Integer, typename Offset, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+from_chars_column_result from_chars_column(const Offset* offsets, const char* data, std::size_t n, Integer* values, std::uint8_t* validity,
+                                           int base = 10, const std::uint8_t* input_validity = nullptr) noexcept
+{
+    using Unsigned_Integer = detail::make_unsigned_t<Integer>;
+    return detail::from_chars_column_impl(offsets, data, n, values, validity, input_validity,
+                                          [base](const char* first, const char* last, Integer& value) noexcept { return detail::from_chars_integer_impl<Integer, Unsigned_Integer>(first, last, value, base); });
+}
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_FROM_CHARS_COLUMN_HPP
@@ -0,0 +1,183 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_FROM_CHARS_LINES_HPP
+#define BOOST_CHARCONV_FROM_CHARS_LINES_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/detail/from_chars_integer_impl.hpp>
+#include <boost/charconv/detail/swar.hpp>
+#include <boost/core/bit.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <system_error>
+#include <type_traits>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost { namespace charconv {
+
+namespace detail {
+
+// Bit i is set when chars[i] is '\n', for the 64 characters from chars
+inline std::uint64_t newline_mask64(const char* chars) noexcept
+{
+    #if defined(BOOST_CHARCONV_HAS_SSE2)
+
+    const __m128i newline = _mm_set1_epi8('\n');
+    std::uint64_t mask = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + 16 * i));
+        const auto block_mask = static_cast<std::uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline))));
+        mask |= block_mask << (16 * i);
+    }
+    return mask;
+
+    #elif defined(BOOST_CHARCONV_HAS_NEON)
+
+    // Each matching byte keeps the bit of its position within 8, and three pairwise additions pack them
+    static constexpr std::uint8_t bits[16] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+                                              0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+    const uint8x16_t bit_mask = vld1q_u8(bits);
+    const uint8x16_t newline = vdupq_n_u8('\n');
+    const auto match = [&](int i) noexcept {
+        return vandq_u8(vceqq_u8(vld1q_u8(reinterpret_cast<const std::uint8_t*>(chars + 16 * i)), newline), bit_mask);
+    };
+
+    uint8x16_t sum = vpaddq_u8(vpaddq_u8(match(0), match(1)), vpaddq_u8(match(2), match(3)));
+    sum = vpaddq_u8(sum, sum);
+    return vgetq_lane_u64(vreinterpretq_u64_u8(sum), 0);
+
+    #else
+
+    // A byte of x is zero exactly where the character is '\n'. The top bits of the zero bytes
+    // are then moved next to each other by the multiplication, which has no carries
+    std::uint64_t mask = 0;
+    for (int i = 0; i < 8; ++i)
+    {
+        const std::uint64_t x = swar_load8(chars + 8 * i) ^ UINT64_C(0x0A0A0A0A0A0A0A0A);
+        const std::uint64_t zeros = ~(((x & UINT64_C(0x7F7F7F7F7F7F7F7F)) + UINT64_C(0x7F7F7F7F7F7F7F7F)) | x) & UINT64_C(0x8080808080808080);
+        mask |= (((zeros >> 7) * UINT64_C(0x0102040810204080)) >> 56) << (8 * i);
+    }
+    return mask;
+
+    #endif
+}
+
+template <typename T, typename Parse>
+from_chars_many_result from_chars_lines_impl(const char* first, const char* last, T* out, std::size_t cap, const Parse& parse) noexcept
+{
+    from_chars_many_result result {first, std::errc(), 0};
+    if (cap == 0)
+    {
+        return result;
+    }
+
+    // Parses [line_first, line_last), where line_last is the '\n' or last. Returns false once the parse has to stop
+    const char* line_first = first;
+    const auto parse_line = [&](const char* line_last) noexcept {
+        const char* value_last = line_last != line_first && line_last[-1] == '\r' ? line_last - 1 : line_last;
+
+        T value {};
+        auto r = parse(line_first, value_last, value);
+        if (r && r.ptr != value_last)
+        {
+            r.ec = std::errc::invalid_argument;
+        }
+        if (!r)
+        {
+            result.ptr = line_first;
+            result.ec = r.ec;
+            return false;
+        }
+
+        out[result.count++] = value;
+        line_first = line_last == last ? last : line_last + 1;
+        result.ptr = line_first;
+        return result.count < cap;
+    };
+
+    // The line ends of a block of 64 characters are found at once, and the lines that end in it are parsed
+    // while it is still in the cache. Most lines of IDs are far shorter than a block
+    const char* block = first;
+    while (last - block >= 64)
+    {
+        std::uint64_t mask = newline_mask64(block);
+        while (mask != 0)
+        {
+            const char* line_last = block + boost::core::countr_zero(mask);
+            mask &= mask - 1;
+            if (!parse_line(line_last))
+            {
+                return result;
+            }
+        }
+        block += 64;
+    }
+
+    while (block != last)
+    {
+        const auto newline = static_cast<const char*>(std::memchr(block, '\n', static_cast<std::size_t>(last - block)));
+        if (newline == nullptr)
+        {
+            break;
+        }
+        if (!parse_line(newline))
+        {
+            return result;
+        }
+        block = newline + 1;
+    }
+
+    // A final line without '\n'. Input that ends with '\n' has no empty line after it
+    if (line_first != last)
+    {
+        parse_line(last);
+    }
+
+    return result;
+}
+
+} // namespace detail
+
+// Parses one value per line of [first, last) into out, up to cap values: base 10 integers, or floating point values in fmt.
+// A line is a value only if it is the whole number, optionally followed by '\r'.
+// On success ptr is the start of the first line that has not been parsed (last once every line has been),
+// and count is the number of values written. On failure ptr points at the line that could not be parsed,
+// and count, the number of lines before it, is its index
+template <typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+from_chars_many_result from_chars_lines(const char* first, const char* last, Integer* out, std::size_t cap) noexcept
+{
+    using Unsigned_Integer = detail::make_unsigned_t<Integer>;
+    return detail::from_chars_lines_impl(first, last, out, cap,
+                                         [](const char* line_first, const char* line_last, Integer& value) noexcept { return detail::from_chars_integer_impl<Integer, Unsigned_Integer>(line_first, line_last, value, 10); });
+}
+
+template <typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+from_chars_many_result from_chars_lines(boost::core::string_view sv, Integer* out, std::size_t cap) noexcept
+{
+    return boost::charconv::from_chars_lines(sv.data(), sv.data() + sv.size(), out, cap);
+}
+
+template <typename Real, typename std::enable_if<std::is_floating_point<Real>::value, bool>::type = true>
+from_chars_many_result from_chars_lines(const char* first, const char* last, Real* out, std::size_t cap, chars_format fmt = chars_format::general) noexcept
+{
+    return detail::from_chars_lines_impl(first, last, out, cap,
+                                         [fmt](const char* line_first, const char* line_last, Real& value) noexcept { return boost::charconv::from_chars(line_first, line_last, value, fmt); });
+}
+
+template <typename Real, typename std::enable_if<std::is_floating_point<Real>::value, bool>::type = true>
+from_chars_many_result from_chars_lines(boost::core::string_view sv, Real* out, std::size_t cap, chars_format fmt = chars_format::general) noexcept
+{
+    return boost::charconv::from_chars_lines(sv.data(), sv.data() + sv.size(), out, cap, fmt);
+}
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_FROM_CHARS_LINES_HPP
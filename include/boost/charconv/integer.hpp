@@ -0,0 +1,429 @@
+// Copyright 2022 Peter Dimov
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_INTEGER_HPP_INCLUDED
+#define BOOST_CHARCONV_INTEGER_HPP_INCLUDED
+
+// to_chars and from_chars for the integer types, which are all inline. Nothing of the floating point
+// engines is included, so a translation unit that only converts integers does not parse them
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/to_chars_integer_impl.hpp>
+#include <boost/charconv/detail/from_chars_integer_impl.hpp>
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
+#include <boost/charconv/config.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <system_error>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost { namespace charconv {
+
+//----------------------------------------------------------------------------------------------------------------------
+// to_chars
+//----------------------------------------------------------------------------------------------------------------------
+
+// integer overloads
+BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, bool value, int base) noexcept = delete;
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, char value, int base = 10) noexcept
+{
+    return detail::to_chars_int(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, signed char value, int base = 10) noexcept
+{
+    return detail::to_chars_int(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, unsigned char value, int base = 10) noexcept
+{
+    return detail::to_chars_int(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, short value, int base = 10) noexcept
+{
+    return detail::to_chars_int(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, unsigned short value, int base = 10) noexcept
+{
+    return detail::to_chars_int(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, int value, int base = 10) noexcept
+{
+    return detail::to_chars_int(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, unsigned int value, int base = 10) noexcept
+{
+    return detail::to_chars_int(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, long value, int base = 10) noexcept
+{
+    return detail::to_chars_int(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, unsigned long value, int base = 10) noexcept
+{
+    return detail::to_chars_int(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, long long value, int base = 10) noexcept
+{
+    return detail::to_chars_int(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, unsigned long long value, int base = 10) noexcept
+{
+    return detail::to_chars_int(first, last, value, base);
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, boost::int128_type value, int base = 10) noexcept
+{
+    return detail::to_chars128(first, last, value, base);
+}
+BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, boost::uint128_type value, int base = 10) noexcept
+{
+    return detail::to_chars128(first, last, value, base);
+}
+#endif
+
+// Writes value in base 10 right aligned in exactly width characters with fill in front of it, like "%09u" with the default fill.
+// With a fill of '0' the sign comes first ("-0042"). If value needs more than width characters ec is std::errc::result_out_of_range
+template <typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_fixed_width(char* first, char* last, Integer value, int width, char fill = '0') noexcept
+{
+    return detail::to_chars_fixed_width_impl(first, last, value, width, fill);
+}
+
+// The same with the width known at compile time, so that the stores of the digits can be unrolled
+template <int Width, typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_fixed_width(char* first, char* last, Integer value, char fill = '0') noexcept
+{
+    static_assert(Width >= 0, "The width of the field can not be negative");
+    return detail::to_chars_fixed_width_impl(first, last, value, Width, fill);
+}
+
+// The same as to_chars(first, last, value, Base) with the base known at compile time, so that the divisions by it
+// are multiplications and shifts. Bases 2, 10 and 16 have their own algorithms, which this selects directly
+template <int Base, typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, Integer value) noexcept
+{
+    static_assert(Base >= 2 && Base <= 36, "Base has to be between 2 and 36");
+
+    using Unsigned_Integer = detail::make_unsigned_t<Integer>;
+    BOOST_IF_CONSTEXPR (Base == 10 || Base == 2 || Base == 16)
+    {
+        return to_chars(first, last, value, Base);
+    }
+    else
+    {
+        return detail::to_chars_integer_impl<static_cast<unsigned>(Base), Integer, Unsigned_Integer>(first, last, value);
+    }
+}
+
+// Writes value in base 16 with at least min_digits digits, zeros in front of those of value, like "%.8x" for 8.
+// The letters are upper case with uppercase, and prefix writes "0x" ("0X") after the sign and before the digits
+template <typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_hex(char* first, char* last, Integer value, int min_digits = 0,
+                                                      bool uppercase = false, bool prefix = false) noexcept
+{
+    using Unsigned_Integer = detail::make_unsigned_t<Integer>;
+    return detail::to_chars_power_of_two_impl<4, Integer, Unsigned_Integer>(first, last, value, min_digits, uppercase, prefix);
+}
+
+// Writes value in base 10 with options.group_separator between every three digits, or like to_chars(first, last, value)
+// when it is '\0'. Options that from_chars could not read back give std::errc::invalid_argument
+template <typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, Integer value, chars_format_options options) noexcept
+{
+    if (!detail::is_valid_format_options(options))
+    {
+        return {last, std::errc::invalid_argument};
+    }
+    if (options.group_separator == '\0')
+    {
+        return to_chars(first, last, value, 10);
+    }
+
+    return detail::to_chars_grouped_impl(first, last, value, options.group_separator);
+}
+
+// Number of characters the matching to_chars overload writes for value, without writing them.
+// For an invalid base the result is 0
+BOOST_CHARCONV_CONSTEXPR std::size_t to_chars_length(bool value, int base) noexcept = delete;
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR std::size_t to_chars_length(char value, int base = 10) noexcept
+{
+    return detail::to_chars_length_impl(value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR std::size_t to_chars_length(signed char value, int base = 10) noexcept
+{
+    return detail::to_chars_length_impl(value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR std::size_t to_chars_length(unsigned char value, int base = 10) noexcept
+{
+    return detail::to_chars_length_impl(value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR std::size_t to_chars_length(short value, int base = 10) noexcept
+{
+    return detail::to_chars_length_impl(value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR std::size_t to_chars_length(unsigned short value, int base = 10) noexcept
+{
+    return detail::to_chars_length_impl(value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR std::size_t to_chars_length(int value, int base = 10) noexcept
+{
+    return detail::to_chars_length_impl(value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR std::size_t to_chars_length(unsigned int value, int base = 10) noexcept
+{
+    return detail::to_chars_length_impl(value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR std::size_t to_chars_length(long value, int base = 10) noexcept
+{
+    return detail::to_chars_length_impl(value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR std::size_t to_chars_length(unsigned long value, int base = 10) noexcept
+{
+    return detail::to_chars_length_impl(value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR std::size_t to_chars_length(long long value, int base = 10) noexcept
+{
+    return detail::to_chars_length_impl(value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_CONSTEXPR std::size_t to_chars_length(unsigned long long value, int base = 10) noexcept
+{
+    return detail::to_chars_length_impl(value, base);
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+BOOST_CHARCONV_CONSTEXPR std::size_t to_chars_length(boost::int128_type value, int base = 10) noexcept
+{
+    return detail::to_chars_length_impl(value, base);
+}
+BOOST_CHARCONV_CONSTEXPR std::size_t to_chars_length(boost::uint128_type value, int base = 10) noexcept
+{
+    return detail::to_chars_length_impl(value, base);
+}
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+// from_chars
+//----------------------------------------------------------------------------------------------------------------------
+
+// integer overloads
+// A base of 0 takes the base from a prefix like strtol: 0x or 0X for 16, 0b or 0B for 2, 0o, 0O or a leading 0 for 8,
+// and 10 otherwise. The prefix comes after the minus sign and is skipped only when a digit of its base follows it
+
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, bool& value, int base = 10) noexcept = delete;
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, char& value, int base = 10) noexcept
+{
+    return detail::from_chars(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, signed char& value, int base = 10) noexcept
+{
+    return detail::from_chars(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, unsigned char& value, int base = 10) noexcept
+{
+    return detail::from_chars(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, short& value, int base = 10) noexcept
+{
+    return detail::from_chars(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, unsigned short& value, int base = 10) noexcept
+{
+    return detail::from_chars(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, int& value, int base = 10) noexcept
+{
+    return detail::from_chars(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, unsigned int& value, int base = 10) noexcept
+{
+    return detail::from_chars(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, long& value, int base = 10) noexcept
+{
+    return detail::from_chars(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, unsigned long& value, int base = 10) noexcept
+{
+    return detail::from_chars(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, long long& value, int base = 10) noexcept
+{
+    return detail::from_chars(first, last, value, base);
+}
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, unsigned long long& value, int base = 10) noexcept
+{
+    return detail::from_chars(first, last, value, base);
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, boost::int128_type& value, int base = 10) noexcept
+{
+    return detail::from_chars128(first, last, value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, boost::uint128_type& value, int base = 10) noexcept
+{
+    return detail::from_chars128(first, last, value, base);
+}
+#endif
+
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(boost::core::string_view sv, bool& value, int base = 10) noexcept = delete;
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(boost::core::string_view sv, char& value, int base = 10) noexcept
+{
+    return detail::from_chars(sv.data(), sv.data() + sv.size(), value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(boost::core::string_view sv, signed char& value, int base = 10) noexcept
+{
+    return detail::from_chars(sv.data(), sv.data() + sv.size(), value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(boost::core::string_view sv, unsigned char& value, int base = 10) noexcept
+{
+    return detail::from_chars(sv.data(), sv.data() + sv.size(), value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(boost::core::string_view sv, short& value, int base = 10) noexcept
+{
+    return detail::from_chars(sv.data(), sv.data() + sv.size(), value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(boost::core::string_view sv, unsigned short& value, int base = 10) noexcept
+{
+    return detail::from_chars(sv.data(), sv.data() + sv.size(), value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(boost::core::string_view sv, int& value, int base = 10) noexcept
+{
+    return detail::from_chars(sv.data(), sv.data() + sv.size(), value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(boost::core::string_view sv, unsigned int& value, int base = 10) noexcept
+{
+    return detail::from_chars(sv.data(), sv.data() + sv.size(), value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(boost::core::string_view sv, long& value, int base = 10) noexcept
+{
+    return detail::from_chars(sv.data(), sv.data() + sv.size(), value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(boost::core::string_view sv, unsigned long& value, int base = 10) noexcept
+{
+    return detail::from_chars(sv.data(), sv.data() + sv.size(), value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(boost::core::string_view sv, long long& value, int base = 10) noexcept
+{
+    return detail::from_chars(sv.data(), sv.data() + sv.size(), value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(boost::core::string_view sv, unsigned long long& value, int base = 10) noexcept
+{
+    return detail::from_chars(sv.data(), sv.data() + sv.size(), value, base);
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(boost::core::string_view sv, boost::int128_type& value, int base = 10) noexcept
+{
+    return detail::from_chars128(sv.data(), sv.data() + sv.size(), value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(boost::core::string_view sv, boost::uint128_type& value, int base = 10) noexcept
+{
+    return detail::from_chars128(sv.data(), sv.data() + sv.size(), value, base);
+}
+#endif
+
+// Other character types: wchar_t, char16_t, char32_t and char8_t.
+// The integer parser is a template on the character type, so nothing is narrowed or copied
+template <typename CharT, typename Integer, typename std::enable_if<detail::is_extended_char<CharT>::value && detail::is_charconv_integer<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result_t<CharT> from_chars(const CharT* first, const CharT* last, Integer& value, int base = 10) noexcept
+{
+    using Unsigned_Integer = detail::make_unsigned_t<Integer>;
+    return detail::from_chars_integer_impl<Integer, Unsigned_Integer>(first, last, value, base);
+}
+
+// from_chars<Integer>(first, last, value) with the type given explicitly, as the documentation spells the overloads
+// above, picks the same parser
+template <typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, Integer& value, int base = 10) noexcept
+{
+    return detail::from_chars_integer_impl<Integer, detail::make_unsigned_t<Integer>>(first, last, value, base);
+}
+template <typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(boost::core::string_view sv, Integer& value, int base = 10) noexcept
+{
+    return boost::charconv::from_chars<Integer>(sv.data(), sv.data() + sv.size(), value, base);
+}
+
+// parse<Integer>(first, last) returns the value with ptr and ec, so that it does not have to go through memory that
+// the compiler can not prove to be distinct from [first, last)
+template <typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_value<Integer> parse(const char* first, const char* last, int base = 10) noexcept
+{
+    Integer value {};
+    const auto r = detail::from_chars_integer_impl<Integer, detail::make_unsigned_t<Integer>>(first, last, value, base);
+    return {value, r.ptr, r.ec};
+}
+
+template <typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_value<Integer> parse(boost::core::string_view sv, int base = 10) noexcept
+{
+    return boost::charconv::parse<Integer>(sv.data(), sv.data() + sv.size(), base);
+}
+
+// Base 10 with options.group_separator skipped between two digits ("1,234,567"), or from_chars(first, last, value)
+// when it is '\0'. Options that could be read as part of a number give std::errc::invalid_argument
+template <typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, Integer& value, chars_format_options options) noexcept
+{
+    if (!detail::is_valid_format_options(options))
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    using Unsigned_Integer = detail::make_unsigned_t<Integer>;
+    return detail::from_chars_integer_impl<Integer, Unsigned_Integer>(first, last, value, 10, options.group_separator);
+}
+template <typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(boost::core::string_view sv, Integer& value, chars_format_options options) noexcept
+{
+    return boost::charconv::from_chars(sv.data(), sv.data() + sv.size(), value, options);
+}
+
+// Parses exactly N decimal digits starting at first, like the numeric fields of fixed width protocols.
+// There is no sign and no last: the caller guarantees that N characters are readable, and nothing after them is read.
+// If one of them is not a digit ec is std::errc::invalid_argument, ptr is first and value is not modified
+template <std::size_t N, typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars_exact(const char* first, Integer& value) noexcept
+{
+    return detail::from_chars_exact_impl<N, Integer, detail::make_unsigned_t<Integer>>(first, value);
+}
+
+// Parses the output of to_chars for Integer in base, which is trusted to be well formed: [first, last) is a '-' for a
+// negative value followed by nothing but digits, and the value fits. Neither the base, the sign, the digits nor overflow are
+// checked (debug builds assert them), so ptr is always last and ec is never set. Other input gives an unspecified value
+template <typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars_unchecked(const char* first, const char* last, Integer& value, int base = 10) noexcept
+{
+    return detail::from_chars_unchecked_impl<Integer, detail::make_unsigned_t<Integer>>(first, last, value, base);
+}
+
+template <typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars_unchecked(boost::core::string_view sv, Integer& value, int base = 10) noexcept
+{
+    return boost::charconv::from_chars_unchecked(sv.data(), sv.data() + sv.size(), value, base);
+}
+
+// The same as from_chars, except that a value that does not fit in Integer is clamped to its max or min instead of
+// returning std::errc::result_out_of_range. ptr is the end of the digits and ec is not set for it, in the same single pass
+template <typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GPU_ENABLED BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars_saturating(const char* first, const char* last, Integer& value, int base = 10) noexcept
+{
+    return detail::from_chars_saturating_impl<Integer, detail::make_unsigned_t<Integer>>(first, last, value, base);
+}
+
+template <typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars_saturating(boost::core::string_view sv, Integer& value, int base = 10) noexcept
+{
+    return boost::charconv::from_chars_saturating(sv.data(), sv.data() + sv.size(), value, base);
+}
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_INTEGER_HPP_INCLUDED
@@ -0,0 +1,333 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_MAPPED_LOADER_HPP
+#define BOOST_CHARCONV_MAPPED_LOADER_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/from_chars_lines.hpp>
+#include <boost/charconv/parallel_from_chars.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/detail/thread_executor.hpp>
+#include <algorithm>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+#include <cstddef>
+
+#if defined(_WIN32)
+#  include <windows.h>
+#  define BOOST_CHARCONV_HAS_MAPPED_FILE
+#elif defined(__unix__) || defined(__APPLE__)
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <fcntl.h>
+#  include <unistd.h>
+#  include <cerrno>
+#  define BOOST_CHARCONV_HAS_MAPPED_FILE
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_MAPPED_FILE
+
+namespace boost { namespace charconv {
+
+// A file mapped read only into memory. The characters are read straight from the page cache,
+// without copying them into a buffer first
+class mapped_file
+{
+public:
+    mapped_file() noexcept = default;
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    mapped_file(mapped_file&& other) noexcept
+        : data_ {other.data_}, size_ {other.size_}
+    {
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+
+    mapped_file& operator=(mapped_file&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            data_ = other.data_;
+            size_ = other.size_;
+            other.data_ = nullptr;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    ~mapped_file() { close(); }
+
+    // Maps the whole file, and asks the kernel to read it ahead in order. An empty file maps to no characters
+    std::errc open(const char* path) noexcept
+    {
+        close();
+
+        #if defined(_WIN32)
+
+        const HANDLE file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return last_error();
+        }
+
+        LARGE_INTEGER file_size;
+        if (!::GetFileSizeEx(file, &file_size))
+        {
+            const auto ec = last_error();
+            ::CloseHandle(file);
+            return ec;
+        }
+
+        std::errc ec {};
+        if (file_size.QuadPart != 0)
+        {
+            const HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping == nullptr)
+            {
+                ec = last_error();
+            }
+            else
+            {
+                data_ = static_cast<const char*>(::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                ec = data_ == nullptr ? last_error() : std::errc();
+                size_ = data_ == nullptr ? 0 : static_cast<std::size_t>(file_size.QuadPart);
+                ::CloseHandle(mapping);
+            }
+        }
+        ::CloseHandle(file);
+        return ec;
+
+        #else
+
+        const int fd = ::open(path, O_RDONLY);
+        if (fd == -1)
+        {
+            return static_cast<std::errc>(errno);
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) == -1)
+        {
+            const auto ec = static_cast<std::errc>(errno);
+            ::close(fd);
+            return ec;
+        }
+
+        std::errc ec {};
+        if (st.st_size != 0)
+        {
+            const auto size = static_cast<std::size_t>(st.st_size);
+            void* const mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED)
+            {
+                ec = static_cast<std::errc>(errno);
+            }
+            else
+            {
+                // Both are hints, the mapping works the same when the kernel ignores them
+                ::madvise(mapping, size, MADV_SEQUENTIAL);
+                ::madvise(mapping, size, MADV_WILLNEED);
+                data_ = static_cast<const char*>(mapping);
+                size_ = size;
+            }
+        }
+        ::close(fd);
+        return ec;
+
+        #endif
+    }
+
+    void close() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            #if defined(_WIN32)
+            ::UnmapViewOfFile(data_);
+            #else
+            ::munmap(const_cast<char*>(data_), size_);
+            #endif
+        }
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    const char* data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+
+private:
+    #if defined(_WIN32)
+    static std::errc last_error() noexcept
+    {
+        switch (::GetLastError())
+        {
+            case ERROR_FILE_NOT_FOUND:
+            case ERROR_PATH_NOT_FOUND:
+                return std::errc::no_such_file_or_directory;
+            case ERROR_ACCESS_DENIED:
+                return std::errc::permission_denied;
+            case ERROR_NOT_ENOUGH_MEMORY:
+                return std::errc::not_enough_memory;
+            default:
+                return std::errc::io_error;
+        }
+    }
+    #endif
+
+    const char* data_ {nullptr};
+    std::size_t size_ {0};
+};
+
+struct mapped_load_result
+{
+    // Error from opening the file, or from the first line that could not be parsed, or 0 if none
+    std::errc ec;
+
+    // Number of values in the output, which are the values of the lines before the one that could not be parsed
+    std::size_t count;
+
+    // Offset in the file of the line that could not be parsed, or the size of the file
+    std::size_t offset;
+
+    friend constexpr bool operator==(const mapped_load_result& lhs, const mapped_load_result& rhs) noexcept
+    {
+        return lhs.ec == rhs.ec && lhs.count == rhs.count && lhs.offset == rhs.offset;
+    }
+
+    friend constexpr bool operator!=(const mapped_load_result& lhs, const mapped_load_result& rhs) noexcept
+    {
+        return !(lhs == rhs); // NOLINT : Expression can not be simplified since this is the definition
+    }
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
+namespace detail {
+
+// Chunks are multiples of a huge page, so that no two threads fault in the same page of the mapping
+// except the one that a line crosses at a boundary
+constexpr std::size_t mapped_chunk_alignment = std::size_t(2) << 20;
+
+template <typename T, typename Executor, typename Parse>
+mapped_load_result load_mapped_impl(const char* path, std::vector<T>& values, Executor&& executor, std::size_t num_chunks, const Parse& parse)
+{
+    values.clear();
+
+    mapped_file file;
+    const auto open_ec = file.open(path);
+    if (open_ec != std::errc())
+    {
+        return {open_ec, 0, 0};
+    }
+
+    const char* const first = file.data();
+    const char* const last = first + file.size();
+    if (first == last)
+    {
+        return {std::errc(), 0, 0};
+    }
+
+    const auto size = file.size();
+    num_chunks = (std::max)(std::size_t(1), num_chunks);
+    const auto chunk_size = ((size / num_chunks) / mapped_chunk_alignment + 1) * mapped_chunk_alignment;
+
+    std::vector<parallel_chunk> chunks;
+    chunks.reserve(size / chunk_size + 1);
+    for (const char* chunk_first = first; chunk_first != last;)
+    {
+        const auto remaining = static_cast<std::size_t>(last - chunk_first);
+        const char* chunk_last = remaining <= chunk_size ? last : next_field_boundary(first + (static_cast<std::size_t>(chunk_first - first) / chunk_size + 1) * chunk_size, last, '\n');
+        chunks.push_back({chunk_first, chunk_last, 0, 0, {chunk_first, std::errc(), 0}});
+        chunk_first = chunk_last;
+    }
+
+    // First pass counts the lines so that every chunk knows where its values go
+    executor(chunks.size(), [&](std::size_t i) noexcept
+    {
+        auto& chunk = chunks[i];
+        chunk.num_values = static_cast<std::size_t>(std::count(chunk.first, chunk.last, '\n'));
+        if (chunk.last == last && *(last - 1) != '\n')
+        {
+            ++chunk.num_values;
+        }
+    });
+
+    std::size_t total = 0;
+    for (auto& chunk : chunks)
+    {
+        chunk.offset = total;
+        total += chunk.num_values;
+    }
+    values.resize(total);
+
+    // Second pass parses each chunk straight from the mapping into its slice of the output
+    T* const out = values.data();
+    executor(chunks.size(), [&](std::size_t i) noexcept
+    {
+        auto& chunk = chunks[i];
+        chunk.result = parse(chunk.first, chunk.last, out + chunk.offset, chunk.num_values);
+    });
+
+    for (const auto& chunk : chunks)
+    {
+        if (!chunk.result)
+        {
+            const auto count = chunk.offset + chunk.result.count;
+            values.resize(count);
+            return {chunk.result.ec, count, static_cast<std::size_t>(chunk.result.ptr - first)};
+        }
+    }
+
+    return {std::errc(), total, size};
+}
+
+inline std::size_t default_mapped_chunks(const thread_executor& executor) noexcept
+{
+    // More chunks than threads so that the work balances when a part of the file is still being read from disk
+    return static_cast<std::size_t>(executor.concurrency()) * 4;
+}
+
+} // namespace detail
+
+// Maps the file at path and parses one value per line into values, in parallel with the executor.
+// A line is parsed like from_chars_lines: base 10 integers, or floating point values in fmt.
+// values holds the values of the whole file, or on failure those of the lines before the first one that could not be parsed
+template <typename Integer, typename Executor, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+mapped_load_result load_mapped(const char* path, std::vector<Integer>& values, Executor&& executor, std::size_t num_chunks)
+{
+    return detail::load_mapped_impl(path, values, executor, num_chunks,
+                                    [](const char* first, const char* last, Integer* out, std::size_t cap) noexcept { return from_chars_lines(first, last, out, cap); });
+}
+
+template <typename Integer, typename std::enable_if<detail::is_charconv_integer<Integer>::value, bool>::type = true>
+mapped_load_result load_mapped(const char* path, std::vector<Integer>& values)
+{
+    const thread_executor executor;
+    return boost::charconv::load_mapped(path, values, executor, detail::default_mapped_chunks(executor));
+}
+
+template <typename Real, typename Executor, typename std::enable_if<std::is_floating_point<Real>::value, bool>::type = true>
+mapped_load_result load_mapped(const char* path, std::vector<Real>& values, Executor&& executor, std::size_t num_chunks, chars_format fmt = chars_format::general)
+{
+    return detail::load_mapped_impl(path, values, executor, num_chunks,
+                                    [fmt](const char* first, const char* last, Real* out, std::size_t cap) noexcept { return from_chars_lines(first, last, out, cap, fmt); });
+}
+
+template <typename Real, typename std::enable_if<std::is_floating_point<Real>::value, bool>::type = true>
+mapped_load_result load_mapped(const char* path, std::vector<Real>& values, chars_format fmt = chars_format::general)
+{
+    const thread_executor executor;
+    return boost::charconv::load_mapped(path, values, executor, detail::default_mapped_chunks(executor), fmt);
+}
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_HAS_MAPPED_FILE
+
+#endif // BOOST_CHARCONV_MAPPED_LOADER_HPP
@@ -0,0 +1,217 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_NUMBER_STREAM_HPP
+#define BOOST_CHARCONV_NUMBER_STREAM_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <system_error>
+#include <type_traits>
+#include <cstring>
+#include <cstddef>
+
+namespace boost { namespace charconv {
+
+struct number_stream_result
+{
+    // The same error codes as from_chars, std::errc::invalid_argument when a value is followed by characters
+    // that are not part of it, and std::errc::value_too_large when a value split between pieces is longer than max_token_length
+    std::errc ec;
+
+    // Every value of the piece has been read, the next piece can be fed
+    bool need_more_input;
+
+    // Every value of the last piece has been read
+    bool end_of_input;
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{} && !need_more_input && !end_of_input; }
+};
+
+// Reads a sequence of values of type T separated by a delimiter or white space out of input that arrives in pieces,
+// e.g. the buffers filled by the reads of an asynchronous socket.
+//
+// The reader never waits for input. next reports need_more_input once the piece has been used up,
+// the caller reads the next piece however it likes (e.g. co_await async_read_some) and feeds it.
+// Values that end within a piece are parsed in place. Only a value that is split between two pieces is kept,
+// so the buffer of a piece can be reused as soon as need_more_input has been reported
+template <typename T>
+class number_stream
+{
+public:
+    // Longest value that can be split between pieces
+    static constexpr std::size_t max_token_length = 256;
+
+    template <typename U = T, typename std::enable_if<!std::is_floating_point<U>::value, bool>::type = true>
+    explicit number_stream(char delimiter = ',', int base = 10) noexcept
+        : delimiter_ {delimiter}, base_ {base}
+    {}
+
+    template <typename U = T, typename std::enable_if<std::is_floating_point<U>::value, bool>::type = true>
+    explicit number_stream(char delimiter = ',', chars_format fmt = chars_format::general) noexcept
+        : delimiter_ {delimiter}, fmt_ {fmt}
+    {}
+
+    // The piece is used until next reports need_more_input. The last piece of the input is marked with last_piece,
+    // at which point the value that it ends with is complete
+    void feed(const char* first, const char* last, bool last_piece = false) noexcept
+    {
+        first_ = first;
+        last_ = last;
+        last_piece_ = last_piece;
+    }
+
+    void feed(boost::core::string_view sv, bool last_piece = false) noexcept
+    {
+        feed(sv.data(), sv.data() + sv.size(), last_piece);
+    }
+
+    // Reads the next value. value is only modified when a value has been read successfully.
+    // After an error the offending value is skipped, and the next call goes on with the one after it
+    number_stream_result next(T& value) noexcept
+    {
+        for (;;)
+        {
+            if (size_ == 0 && !skipping_)
+            {
+                while (first_ != last_ && is_separator(*first_))
+                {
+                    ++first_;
+                }
+            }
+
+            const char* token_end = first_;
+            while (token_end != last_ && !is_separator(*token_end))
+            {
+                ++token_end;
+            }
+
+            // The piece ends within a value, which goes on in the next piece
+            if (token_end == last_ && !last_piece_)
+            {
+                return keep(first_, last_);
+            }
+
+            // The rest of a value that has already been reported as too long
+            if (skipping_)
+            {
+                skipping_ = false;
+                first_ = token_end;
+                continue;
+            }
+
+            if (size_ == 0 && first_ == token_end)
+            {
+                return {std::errc(), false, true};
+            }
+
+            const char* const token_first = first_;
+            first_ = token_end;
+            if (size_ == 0)
+            {
+                return parse_token(token_first, token_end, value);
+            }
+
+            const auto length = static_cast<std::size_t>(token_end - token_first);
+            if (length > max_token_length - size_)
+            {
+                size_ = 0;
+                return {std::errc::value_too_large, false, false};
+            }
+
+            std::memcpy(buffer_ + size_, token_first, length);
+            const auto token_length = size_ + length;
+            size_ = 0;
+            return parse_token(buffer_, buffer_ + token_length, value);
+        }
+    }
+
+    // Throws away the piece and the characters kept from the earlier pieces
+    void reset() noexcept
+    {
+        first_ = nullptr;
+        last_ = nullptr;
+        last_piece_ = false;
+        skipping_ = false;
+        size_ = 0;
+    }
+
+    // Number of characters kept from the earlier pieces
+    std::size_t pending() const noexcept { return size_; }
+
+private:
+    bool is_separator(char c) const noexcept
+    {
+        return c == delimiter_ || c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    }
+
+    number_stream_result keep(const char* first, const char* last) noexcept
+    {
+        first_ = last;
+        if (skipping_)
+        {
+            return {std::errc(), true, false};
+        }
+
+        const auto length = static_cast<std::size_t>(last - first);
+        if (length > max_token_length - size_)
+        {
+            // The error is reported once, and the characters up to the end of the value are skipped
+            size_ = 0;
+            skipping_ = true;
+            return {std::errc::value_too_large, false, false};
+        }
+
+        std::memcpy(buffer_ + size_, first, length);
+        size_ += length;
+        return {std::errc(), true, false};
+    }
+
+    // The whole token has to be the value, wherever the pieces were split
+    number_stream_result parse_token(const char* first, const char* last, T& value) const noexcept
+    {
+        T temp_value {};
+        const auto r = parse_value(first, last, temp_value);
+        if (!r)
+        {
+            return {r.ec, false, false};
+        }
+        if (r.ptr != last)
+        {
+            return {std::errc::invalid_argument, false, false};
+        }
+
+        value = temp_value;
+        return {std::errc(), false, false};
+    }
+
+    template <typename U = T, typename std::enable_if<!std::is_floating_point<U>::value, bool>::type = true>
+    from_chars_result parse_value(const char* first, const char* last, U& value) const noexcept
+    {
+        return boost::charconv::from_chars(first, last, value, base_);
+    }
+
+    template <typename U = T, typename std::enable_if<std::is_floating_point<U>::value, bool>::type = true>
+    from_chars_result parse_value(const char* first, const char* last, U& value) const noexcept
+    {
+        return boost::charconv::from_chars(first, last, value, fmt_);
+    }
+
+    const char* first_ {nullptr};
+    const char* last_ {nullptr};
+    bool last_piece_ {false};
+    bool skipping_ {false};
+    char delimiter_ {','};
+    int base_ {10};
+    chars_format fmt_ {chars_format::general};
+    std::size_t size_ {};
+    char buffer_[max_token_length];
+};
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_NUMBER_STREAM_HPP
@@ -0,0 +1,139 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_PARALLEL_FROM_CHARS_HPP
+#define BOOST_CHARCONV_PARALLEL_FROM_CHARS_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/detail/thread_executor.hpp>
+#include <algorithm>
+#include <vector>
+#include <cstring>
+#include <cstddef>
+
+namespace boost { namespace charconv {
+
+namespace detail {
+
+struct parallel_chunk
+{
+    const char* first;
+    const char* last;
+    std::size_t num_values;
+    std::size_t offset;
+    from_chars_many_result result;
+};
+
+// Moves a chunk boundary forward so that it lies just after a delimiter
+inline const char* next_field_boundary(const char* pos, const char* last, char delimiter) noexcept
+{
+    const auto found = static_cast<const char*>(std::memchr(pos, delimiter, static_cast<std::size_t>(last - pos)));
+    return found != nullptr ? found + 1 : last;
+}
+
+template <typename T, typename Executor>
+from_chars_many_result parallel_from_chars_impl(const char* first, const char* last, T* out, std::size_t n, char delimiter,
+                                                Executor&& executor, std::size_t num_chunks, chars_format fmt)
+{
+    if (first >= last || n == 0)
+    {
+        return {first, std::errc(), 0};
+    }
+
+    // Split the input into chunks that start at the beginning of a field
+    const auto size = static_cast<std::size_t>(last - first);
+    num_chunks = (std::max)(std::size_t(1), (std::min)(num_chunks, size));
+
+    std::vector<parallel_chunk> chunks;
+    chunks.reserve(num_chunks);
+    const char* chunk_first = first;
+    for (std::size_t i = 1; i <= num_chunks && chunk_first != last; ++i)
+    {
+        const char* chunk_last = i == num_chunks ? last : next_field_boundary((std::max)(chunk_first, first + size / num_chunks * i), last, delimiter);
+        chunks.push_back({chunk_first, chunk_last, 0, 0, {chunk_first, std::errc(), 0}});
+        chunk_first = chunk_last;
+    }
+
+    // First pass counts the values in each chunk so that every chunk knows where its output starts
+    executor(chunks.size(), [&](std::size_t i) noexcept
+    {
+        auto& chunk = chunks[i];
+        chunk.num_values = static_cast<std::size_t>(std::count(chunk.first, chunk.last, delimiter));
+        if (chunk.last == last && *(last - 1) != delimiter)
+        {
+            ++chunk.num_values;
+        }
+    });
+
+    std::size_t offset = 0;
+    for (auto& chunk : chunks)
+    {
+        chunk.offset = offset;
+        offset += chunk.num_values;
+    }
+
+    // Second pass parses each chunk into its slice of the output
+    executor(chunks.size(), [&](std::size_t i) noexcept
+    {
+        auto& chunk = chunks[i];
+        if (chunk.offset < n)
+        {
+            chunk.result = from_chars_many(chunk.first, chunk.last, out + chunk.offset, (std::min)(chunk.num_values, n - chunk.offset), delimiter, fmt);
+        }
+    });
+
+    // Report the first error in input order, or the total of all chunks
+    from_chars_many_result result {first, std::errc(), 0};
+    for (const auto& chunk : chunks)
+    {
+        if (chunk.offset >= n)
+        {
+            break;
+        }
+
+        result.ptr = chunk.result.ptr;
+        result.count = chunk.offset + chunk.result.count;
+        if (!chunk.result)
+        {
+            result.ec = chunk.result.ec;
+            break;
+        }
+    }
+
+    return result;
+}
+
+} // namespace detail
+
+// Parses up to n delimited values from [first, last) into out using the executor.
+// The input is split into num_chunks pieces at delimiter boundaries, each piece is counted and then parsed in parallel.
+// The result is the same as calling from_chars_many on the whole range, except that when an error occurs
+// values from fields after the failing field may also have been written to out
+template <typename T, typename Executor>
+from_chars_many_result parallel_from_chars(const char* first, const char* last, T* out, std::size_t n, char delimiter,
+                                           Executor&& executor, std::size_t num_chunks, chars_format fmt = chars_format::general)
+{
+    return detail::parallel_from_chars_impl(first, last, out, n, delimiter, executor, num_chunks, fmt);
+}
+
+// Uses a thread_executor with one thread per hardware thread, and chunks of at least 64KiB
+template <typename T>
+from_chars_many_result parallel_from_chars(const char* first, const char* last, T* out, std::size_t n, char delimiter,
+                                           chars_format fmt = chars_format::general)
+{
+    constexpr std::size_t min_chunk_size = 65536;
+    const thread_executor executor;
+
+    // More chunks than threads so that the work balances when the fields are of uneven length
+    const auto num_chunks = (std::min)(static_cast<std::size_t>(executor.concurrency()) * 4,
+                                       static_cast<std::size_t>(last - first) / min_chunk_size + 1);
+
+    return detail::parallel_from_chars_impl(first, last, out, n, delimiter, executor, num_chunks, fmt);
+}
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_PARALLEL_FROM_CHARS_HPP
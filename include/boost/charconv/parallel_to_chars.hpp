@@ -0,0 +1,214 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_PARALLEL_TO_CHARS_HPP
+#define BOOST_CHARCONV_PARALLEL_TO_CHARS_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/thread_executor.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/limits.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+#include <cstring>
+#include <cstddef>
+
+namespace boost { namespace charconv {
+
+namespace detail {
+
+struct parallel_to_chars_chunk
+{
+    std::size_t first_value;
+    std::size_t num_values;
+
+    // Characters of the values and of the delimiter in front of each of them, except the first value of the array
+    std::size_t length;
+    std::size_t offset;
+};
+
+// Writes value into [first, last) if its characters fit.
+// The shortest representation asks for limits<T>::max_chars of space even when it is shorter,
+// so a value close to last is formatted into a local buffer first
+template <typename T, typename Format>
+to_chars_result parallel_format_value(char* first, char* last, T value, const Format& format) noexcept
+{
+    const auto r = format(first, last, value);
+    if (BOOST_LIKELY(r.ec == std::errc()) || last - first >= limits<T>::max_chars)
+    {
+        return r;
+    }
+
+    char buffer[limits<T>::max_chars];
+    const auto local = format(buffer, buffer + sizeof(buffer), value);
+    const auto length = local.ptr - buffer;
+    if (!local || length > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    std::memcpy(first, buffer, static_cast<std::size_t>(length));
+    return {first + length, std::errc()};
+}
+
+template <typename T, typename Executor, typename Length, typename Format>
+to_chars_many_result parallel_to_chars_impl(char* first, char* last, const T* values, std::size_t n, char delimiter,
+                                            Executor&& executor, std::size_t num_chunks, const Length& length, const Format& format)
+{
+    if (n == 0)
+    {
+        return {first, std::errc(), 0};
+    }
+
+    // Split the values into chunks of the same size
+    num_chunks = (std::max)(std::size_t(1), (std::min)(num_chunks, n));
+
+    std::vector<parallel_to_chars_chunk> chunks(num_chunks);
+    for (std::size_t i = 0; i < num_chunks; ++i)
+    {
+        chunks[i].first_value = n / num_chunks * i + (std::min)(i, n % num_chunks);
+        chunks[i].num_values = n / num_chunks + (i < n % num_chunks ? 1U : 0U);
+    }
+
+    // First pass sizes every value without writing it
+    executor(chunks.size(), [&](std::size_t i) noexcept
+    {
+        auto& chunk = chunks[i];
+        std::size_t chunk_length = chunk.num_values - (chunk.first_value == 0 ? 1U : 0U);
+        for (std::size_t j = chunk.first_value; j < chunk.first_value + chunk.num_values; ++j)
+        {
+            chunk_length += length(values[j]);
+        }
+        chunk.length = chunk_length;
+    });
+
+    // A prefix sum over the lengths gives the position of every chunk in the output,
+    // and the chunks that fit into the buffer
+    const std::size_t size = first < last ? static_cast<std::size_t>(last - first) : 0U;
+    std::size_t offset = 0;
+    std::size_t num_fitting = chunks.size();
+    for (std::size_t i = 0; i < chunks.size(); ++i)
+    {
+        chunks[i].offset = offset;
+        offset += chunks[i].length;
+        if (offset > size && num_fitting == chunks.size())
+        {
+            num_fitting = i;
+        }
+    }
+
+    // Second pass formats each chunk straight into its slice of the buffer
+    executor(num_fitting, [&](std::size_t i) noexcept
+    {
+        const auto& chunk = chunks[i];
+        char* ptr = first + chunk.offset;
+        char* const chunk_last = ptr + chunk.length;
+
+        for (std::size_t j = chunk.first_value; j < chunk.first_value + chunk.num_values; ++j)
+        {
+            if (j != 0)
+            {
+                *ptr++ = delimiter;
+            }
+
+            const auto r = parallel_format_value(ptr, chunk_last, values[j], format);
+            BOOST_CHARCONV_ASSERT(r);
+            ptr = r.ptr;
+        }
+
+        BOOST_CHARCONV_ASSERT(ptr == chunk_last);
+    });
+
+    if (num_fitting == chunks.size())
+    {
+        return {first + offset, std::errc(), n};
+    }
+
+    // The values of the chunk that does not fit are written up to the first one that does not fit either
+    const auto& chunk = chunks[num_fitting];
+    to_chars_many_result result {first + chunk.offset, std::errc(), chunk.first_value};
+    for (std::size_t j = chunk.first_value; j < chunk.first_value + chunk.num_values; ++j)
+    {
+        char* value_first = result.ptr;
+        if (j != 0)
+        {
+            if (value_first >= last)
+            {
+                result.ec = std::errc::result_out_of_range;
+                return result;
+            }
+            *value_first++ = delimiter;
+        }
+
+        const auto r = parallel_format_value(value_first, last, values[j], format);
+        if (!r)
+        {
+            result.ec = r.ec;
+            return result;
+        }
+
+        result.ptr = r.ptr;
+        ++result.count;
+    }
+
+    // LCOV_EXCL_START : The chunk has been sized larger than the buffer
+    result.ec = std::errc::result_out_of_range;
+    return result;
+    // LCOV_EXCL_STOP
+}
+
+template <typename Executor>
+std::size_t default_to_chars_chunks(const Executor& executor, std::size_t n) noexcept
+{
+    // More chunks than threads so that the work balances when the values are of uneven length,
+    // and enough values in each chunk that sizing them takes longer than starting the task
+    constexpr std::size_t min_chunk_values = 8192;
+    return (std::min)(static_cast<std::size_t>(executor.concurrency()) * 4, n / min_chunk_values + 1);
+}
+
+} // namespace detail
+
+// Writes the n values separated by delimiter into [first, last) using the executor.
+// The values are split into num_chunks pieces. The length of every piece is computed in parallel,
+// a prefix sum gives its position in the output, and then all of the pieces are formatted in parallel.
+// The characters are the same as those of to_chars_many on the whole array, and count is the number of values that fit
+template <typename Real, typename Executor, typename std::enable_if<std::is_same<Real, float>::value || std::is_same<Real, double>::value, bool>::type = true>
+to_chars_many_result parallel_to_chars(char* first, char* last, const Real* values, std::size_t n, char delimiter,
+                                       Executor&& executor, std::size_t num_chunks, chars_format fmt = chars_format::general, int precision = -1)
+{
+    return detail::parallel_to_chars_impl(first, last, values, n, delimiter, executor, num_chunks,
+                                          [=](Real value) noexcept { return to_chars_length(value, fmt, precision); },
+                                          [=](char* value_first, char* value_last, Real value) noexcept { return to_chars(value_first, value_last, value, fmt, precision); });
+}
+
+template <typename Integer, typename Executor, typename std::enable_if<std::is_integral<Integer>::value && !std::is_same<Integer, bool>::value, bool>::type = true>
+to_chars_many_result parallel_to_chars(char* first, char* last, const Integer* values, std::size_t n, char delimiter,
+                                       Executor&& executor, std::size_t num_chunks, int base = 10)
+{
+    return detail::parallel_to_chars_impl(first, last, values, n, delimiter, executor, num_chunks,
+                                          [=](Integer value) noexcept { return to_chars_length(value, base); },
+                                          [=](char* value_first, char* value_last, Integer value) noexcept { return to_chars(value_first, value_last, value, base); });
+}
+
+// Uses a thread_executor with one thread per hardware thread, and chunks of at least 8192 values
+template <typename Real, typename std::enable_if<std::is_same<Real, float>::value || std::is_same<Real, double>::value, bool>::type = true>
+to_chars_many_result parallel_to_chars(char* first, char* last, const Real* values, std::size_t n, char delimiter,
+                                       chars_format fmt = chars_format::general, int precision = -1)
+{
+    const thread_executor executor;
+    return parallel_to_chars(first, last, values, n, delimiter, executor, detail::default_to_chars_chunks(executor, n), fmt, precision);
+}
+
+template <typename Integer, typename std::enable_if<std::is_integral<Integer>::value && !std::is_same<Integer, bool>::value, bool>::type = true>
+to_chars_many_result parallel_to_chars(char* first, char* last, const Integer* values, std::size_t n, char delimiter, int base = 10)
+{
+    const thread_executor executor;
+    return parallel_to_chars(first, last, values, n, delimiter, executor, detail::default_to_chars_chunks(executor, n), base);
+}
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_PARALLEL_TO_CHARS_HPP
@@ -0,0 +1,401 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_RESUMABLE_FROM_CHARS_HPP
+#define BOOST_CHARCONV_RESUMABLE_FROM_CHARS_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <system_error>
+#include <type_traits>
+#include <cstring>
+#include <cstddef>
+
+namespace boost { namespace charconv {
+
+namespace detail {
+
+// Follows the grammar of from_chars character by character to find out whether a number that reaches the end
+// of the input could go on in the next piece. The state is kept between pieces
+class number_prefix_scanner
+{
+public:
+    // Integers in the given base
+    explicit number_prefix_scanner(int base, bool is_signed) noexcept
+        : base_ {base}, is_integer_ {true}, is_signed_ {is_signed}
+    {}
+
+    explicit number_prefix_scanner(chars_format fmt) noexcept
+        : fmt_ {fmt}
+    {}
+
+    // Returns the first character that can not belong to the number, or last if all of them do
+    const char* scan(const char* first, const char* last) noexcept
+    {
+        for (; first != last; ++first)
+        {
+            if (!next(*first))
+            {
+                state_ = state::done;
+                return first;
+            }
+        }
+
+        return last;
+    }
+
+    // True if the characters scanned so far are the start (or all) of a number
+    // that more characters could still make longer
+    bool can_continue() const noexcept
+    {
+        return state_ != state::done && state_ != state::complete;
+    }
+
+    void reset() noexcept
+    {
+        state_ = state::start;
+        matched_ = 0;
+    }
+
+private:
+    enum class state : unsigned char
+    {
+        start,
+        sign,
+        integer,
+        leading_dot,
+        fraction,
+        exponent,
+        exponent_sign,
+        exponent_digits,
+        infinity,
+        nan,
+        nan_payload,
+        complete,
+        done
+    };
+
+    static char to_lower(char c) noexcept
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    static bool is_decimal_digit(char c) noexcept
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    bool is_digit(char c) const noexcept
+    {
+        if (is_integer_)
+        {
+            const char lower = to_lower(c);
+            const int digit = is_decimal_digit(c) ? c - '0' : (lower >= 'a' && lower <= 'z') ? lower - 'a' + 10 : 36;
+            return digit < base_;
+        }
+
+        if (fmt_ == chars_format::hex)
+        {
+            const char lower = to_lower(c);
+            return is_decimal_digit(c) || (lower >= 'a' && lower <= 'f');
+        }
+
+        return is_decimal_digit(c);
+    }
+
+    bool is_exponent(char c) const noexcept
+    {
+        if (fmt_ == chars_format::hex)
+        {
+            return c == 'p' || c == 'P';
+        }
+
+        return fmt_ != chars_format::fixed && (c == 'e' || c == 'E');
+    }
+
+    // Advances the state by one character, or returns false if c can not be part of the number
+    bool next(char c) noexcept
+    {
+        constexpr char infinity_str[] = "infinity";
+        constexpr char nan_str[] = "nan";
+
+        switch (state_)
+        {
+            case state::start:
+                if (c == '-' && (!is_integer_ || is_signed_))
+                {
+                    state_ = state::sign;
+                    return true;
+                }
+                BOOST_FALLTHROUGH;
+
+            case state::sign:
+                if (is_digit(c))
+                {
+                    state_ = state::integer;
+                }
+                else if (is_integer_)
+                {
+                    return false;
+                }
+                else if (c == '.')
+                {
+                    state_ = state::leading_dot;
+                }
+                else if (to_lower(c) == 'i')
+                {
+                    state_ = state::infinity;
+                    matched_ = 1;
+                }
+                else if (to_lower(c) == 'n')
+                {
+                    state_ = state::nan;
+                    matched_ = 1;
+                }
+                else
+                {
+                    return false;
+                }
+                return true;
+
+            case state::integer:
+                if (is_digit(c))
+                {
+                    return true;
+                }
+                if (is_integer_)
+                {
+                    return false;
+                }
+                if (c == '.')
+                {
+                    state_ = state::fraction;
+                    return true;
+                }
+                BOOST_FALLTHROUGH;
+
+            case state::fraction:
+                if (is_digit(c))
+                {
+                    return true;
+                }
+                if (is_exponent(c))
+                {
+                    state_ = state::exponent;
+                    return true;
+                }
+                return false;
+
+            case state::leading_dot:
+                if (is_digit(c))
+                {
+                    state_ = state::fraction;
+                    return true;
+                }
+                return false;
+
+            case state::exponent:
+                if (c == '+' || c == '-')
+                {
+                    state_ = state::exponent_sign;
+                    return true;
+                }
+                BOOST_FALLTHROUGH;
+
+            case state::exponent_sign:
+            case state::exponent_digits:
+                if (is_decimal_digit(c))
+                {
+                    state_ = state::exponent_digits;
+                    return true;
+                }
+                return false;
+
+            // "inf" is a number by itself, but could still be the start of "infinity"
+            case state::infinity:
+                if (to_lower(c) != infinity_str[matched_])
+                {
+                    return false;
+                }
+                if (++matched_ == sizeof(infinity_str) - 1)
+                {
+                    state_ = state::complete;
+                }
+                return true;
+
+            case state::nan:
+                if (matched_ == sizeof(nan_str) - 1)
+                {
+                    if (c != '(')
+                    {
+                        return false;
+                    }
+                    state_ = state::nan_payload;
+                    return true;
+                }
+                if (to_lower(c) != nan_str[matched_])
+                {
+                    return false;
+                }
+                ++matched_;
+                return true;
+
+            case state::nan_payload:
+                if (c == ')')
+                {
+                    state_ = state::complete;
+                    return true;
+                }
+                return is_decimal_digit(c) || (to_lower(c) >= 'a' && to_lower(c) <= 'z') || c == '_';
+
+            default:
+                return false;
+        }
+    }
+
+    state state_ {state::start};
+    std::size_t matched_ {};
+    int base_ {10};
+    chars_format fmt_ {chars_format::general};
+    bool is_integer_ {false};
+    bool is_signed_ {false};
+};
+
+} // namespace detail
+
+struct resumable_from_chars_result
+{
+    // Points into the piece passed to the last call: one past the end of the value,
+    // or to the first character when the value ended within the characters kept from the earlier pieces
+    const char* ptr;
+
+    // The same error codes as from_chars, and std::errc::value_too_large
+    // when a number that is split between pieces is longer than max_token_length
+    std::errc ec;
+
+    // The piece ended within a number, which has been kept and continues with the next piece
+    bool need_more_input;
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{} && !need_more_input; }
+};
+
+// Parses one value of type T out of input that arrives in several pieces, e.g. TCP segments or the two halves of a wrapped ring buffer.
+//
+// As long as a number ends within the piece it is parsed in place with from_chars, and nothing is copied.
+// When a piece ends in the middle of a number, or where the number could still go on (e.g. "12" or "1e"), those characters are kept,
+// need_more_input is reported, and parsing picks up with the next piece.
+// The last piece of the input is marked with last_piece, after which the number ends with the input
+template <typename T>
+class resumable_from_chars
+{
+public:
+    // Longest number that can be split between pieces
+    static constexpr std::size_t max_token_length = 256;
+
+    template <typename U = T, typename std::enable_if<!std::is_floating_point<U>::value, bool>::type = true>
+    explicit resumable_from_chars(int base = 10) noexcept
+        : scanner_ {base, detail::is_signed<T>::value}, base_ {base}
+    {}
+
+    template <typename U = T, typename std::enable_if<std::is_floating_point<U>::value, bool>::type = true>
+    explicit resumable_from_chars(chars_format fmt = chars_format::general) noexcept
+        : scanner_ {fmt}, fmt_ {fmt}
+    {}
+
+    // Parses the number that starts at first, or continues the one kept from the earlier pieces.
+    // value is only modified when a number has been parsed successfully
+    resumable_from_chars_result parse(const char* first, const char* last, T& value, bool last_piece = false) noexcept
+    {
+        const char* const token_end = scanner_.scan(first, last);
+        const bool need_more_input = token_end == last && !last_piece && scanner_.can_continue();
+
+        if (size_ == 0)
+        {
+            if (!need_more_input)
+            {
+                const auto r = parse_value(first, last, value);
+                reset();
+                return {r.ptr, r.ec, false};
+            }
+
+            return keep(first, last);
+        }
+
+        if (need_more_input)
+        {
+            return keep(first, last);
+        }
+
+        // Everything from token_end on is not part of the number
+        const auto length = static_cast<std::size_t>(token_end - first);
+        if (length > max_token_length - size_)
+        {
+            reset();
+            return {first, std::errc::value_too_large, false};
+        }
+
+        std::memcpy(buffer_ + size_, first, length);
+        const std::size_t kept = size_;
+        const auto r = parse_value(buffer_, buffer_ + size_ + length, value);
+        reset();
+
+        const auto used = static_cast<std::size_t>(r.ptr - buffer_);
+        return {used > kept ? first + (used - kept) : first, r.ec, false};
+    }
+
+    resumable_from_chars_result parse(boost::core::string_view sv, T& value, bool last_piece = false) noexcept
+    {
+        return parse(sv.data(), sv.data() + sv.size(), value, last_piece);
+    }
+
+    // Throws away the characters kept from the earlier pieces
+    void reset() noexcept
+    {
+        size_ = 0;
+        scanner_.reset();
+    }
+
+    // Number of characters kept from the earlier pieces
+    std::size_t pending() const noexcept { return size_; }
+
+private:
+    resumable_from_chars_result keep(const char* first, const char* last) noexcept
+    {
+        const auto length = static_cast<std::size_t>(last - first);
+        if (length > max_token_length - size_)
+        {
+            reset();
+            return {first, std::errc::value_too_large, false};
+        }
+
+        std::memcpy(buffer_ + size_, first, length);
+        size_ += length;
+        return {last, std::errc(), true};
+    }
+
+    template <typename U = T, typename std::enable_if<!std::is_floating_point<U>::value, bool>::type = true>
+    from_chars_result parse_value(const char* first, const char* last, U& value) const noexcept
+    {
+        return boost::charconv::from_chars(first, last, value, base_);
+    }
+
+    template <typename U = T, typename std::enable_if<std::is_floating_point<U>::value, bool>::type = true>
+    from_chars_result parse_value(const char* first, const char* last, U& value) const noexcept
+    {
+        return boost::charconv::from_chars(first, last, value, fmt_);
+    }
+
+    detail::number_prefix_scanner scanner_;
+    int base_ {10};
+    chars_format fmt_ {chars_format::general};
+    std::size_t size_ {};
+    char buffer_[max_token_length];
+};
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_RESUMABLE_FROM_CHARS_HPP
@@ -0,0 +1,116 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_SLOW_PATH_COUNTERS_HPP
+#define BOOST_CHARCONV_SLOW_PATH_COUNTERS_HPP
+
+#include <boost/charconv/config.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost { namespace charconv {
+
+// Number of times the calling thread took each of the slower routes of the floating point conversions.
+// The library only counts them when it is built with BOOST_CHARCONV_ENABLE_SLOW_PATH_COUNTERS,
+// otherwise every counter stays zero
+struct slow_path_counters
+{
+    // from_chars: compute_float32/64/80/128 could not round the value, so the big integer fallback was used
+    std::uint64_t from_chars_slow_path;
+
+    // from_chars: the fast_float path had to compare the digits with a big integer to round
+    std::uint64_t from_chars_digit_comparison;
+
+    // to_chars: the value was written with snprintf
+    std::uint64_t to_chars_printf;
+
+    // to_chars with a precision: the digits were generated by floff
+    std::uint64_t to_chars_floff;
+
+    // to_chars with a precision: the digits were generated by the exact multiword path
+    std::uint64_t to_chars_exact;
+};
+
+// Whether the library counts the slow paths
+BOOST_CHARCONV_DECL bool slow_path_counters_enabled() noexcept;
+
+// The counters of the calling thread
+BOOST_CHARCONV_DECL slow_path_counters get_slow_path_counters() noexcept;
+
+// Sets the counters of the calling thread to zero
+BOOST_CHARCONV_DECL void reset_slow_path_counters() noexcept;
+
+// The slow path that a sample was taken on, one per counter
+enum class slow_path : unsigned char
+{
+    from_chars_slow_path,
+    from_chars_digit_comparison,
+    to_chars_printf,
+    to_chars_floff,
+    to_chars_exact
+};
+
+// Longest prefix of the input that a sample keeps
+constexpr std::size_t slow_path_sample_max_size = 64;
+
+// The input of a conversion that took a slow path. The library only takes them when it is built with
+// BOOST_CHARCONV_ENABLE_SLOW_PATH_SAMPLES, and each thread keeps its last samples in a ring buffer
+struct slow_path_sample
+{
+    slow_path path;
+
+    // Binary digits of the floating point type, e.g. 53 for double
+    int digits;
+
+    // from_chars: the number of characters of the number, starting at the first significant digit for the digit comparison.
+    // to_chars: the size of the value
+    std::size_t input_size;
+
+    // Number of bytes of data, at most slow_path_sample_max_size
+    std::size_t size;
+
+    // from_chars: the first characters of the number.
+    // to_chars: the object representation of the value, in the byte order of the platform
+    unsigned char data[slow_path_sample_max_size];
+};
+
+// Number of samples that each thread keeps before the oldest are overwritten
+BOOST_CHARCONV_DECL std::size_t slow_path_samples_capacity() noexcept;
+
+// Whether the library takes the samples
+BOOST_CHARCONV_DECL bool slow_path_samples_enabled() noexcept;
+
+// Moves at most count of the oldest samples of the calling thread to first, and returns how many were moved
+BOOST_CHARCONV_DECL std::size_t drain_slow_path_samples(slow_path_sample* first, std::size_t count) noexcept;
+
+// Number of samples of the calling thread that were overwritten before they were drained
+BOOST_CHARCONV_DECL std::uint64_t dropped_slow_path_samples() noexcept;
+
+// Discards the samples of the calling thread and sets its number of dropped samples to zero
+BOOST_CHARCONV_DECL void clear_slow_path_samples() noexcept;
+
+namespace detail {
+
+#ifdef BOOST_CHARCONV_ENABLE_SLOW_PATH_COUNTERS
+
+BOOST_CHARCONV_DECL slow_path_counters& thread_slow_path_counters() noexcept;
+
+#endif
+
+#ifdef BOOST_CHARCONV_ENABLE_SLOW_PATH_SAMPLES
+
+// The slot of the next sample of the calling thread, which overwrites the oldest one when the buffer is full
+BOOST_CHARCONV_DECL slow_path_sample& next_slow_path_sample() noexcept;
+
+#endif
+
+} // Namespace detail
+
+}} // Namespaces
+
+#ifdef BOOST_CHARCONV_HEADER_ONLY
+#  include <boost/charconv/detail/impl/slow_path_counters.ipp>
+#endif
+
+#endif // BOOST_CHARCONV_SLOW_PATH_COUNTERS_HPP
@@ -0,0 +1,168 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_STATIC_FORMAT_HPP
+#define BOOST_CHARCONV_STATIC_FORMAT_HPP
+
+// to_chars and from_chars for float and double with the format, and for to_chars the precision, as template arguments
+// for call sites that always use the same ones. Only the engine for them is instantiated in the caller and the
+// dispatch of to_chars_float_impl is resolved at compile time: a precision goes straight to the fixed precision printer,
+// floff or the general and engineering printers, and the short fractions of the fixed precision printer write a
+// constant number of digits. from_chars runs the fast_float scanner with the format known, so the branches on it fold away.
+// Hexadecimal output and the shortest fixed and general output forward to the compiled library
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/detail/to_chars_float_impl.hpp>
+#include <boost/charconv/detail/fast_float/fast_float.hpp>
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <type_traits>
+#include <cmath>
+
+namespace boost { namespace charconv {
+
+namespace detail {
+
+template <typename T>
+struct is_static_format_float : std::integral_constant<bool, std::is_same<T, float>::value || std::is_same<T, double>::value> {};
+
+constexpr bool is_valid_static_format(chars_format fmt) noexcept
+{
+    return fmt == chars_format::general || fmt == chars_format::fixed || fmt == chars_format::scientific ||
+           fmt == chars_format::hex || fmt == chars_format::engineering;
+}
+
+#ifdef BOOST_MSVC
+# pragma warning(push)
+# pragma warning(disable: 4127) // Conditional expression is constant (BOOST_IF_CONSTEXPR in pre-C++17 modes)
+#endif
+
+// The branches of to_chars_precision_impl for a finite value. Like to_chars_float_impl, a float has its own fixed and
+// scientific paths and is widened to double for the others
+template <chars_format Fmt, int Precision, typename Real>
+BOOST_FORCEINLINE to_chars_result to_chars_static_precision(char* first, char* last, Real value) noexcept
+{
+    BOOST_IF_CONSTEXPR (Fmt == chars_format::fixed)
+    {
+        return to_chars_fixed_precision(first, last, value, Precision);
+    }
+    else BOOST_IF_CONSTEXPR (Fmt == chars_format::scientific)
+    {
+        return to_chars_scientific_precision(first, last, value, Precision);
+    }
+    else BOOST_IF_CONSTEXPR (Fmt == chars_format::engineering)
+    {
+        return to_chars_engineering_precision(first, last, static_cast<double>(value), Precision, false);
+    }
+    else
+    {
+        return to_chars_general_precision(first, last, static_cast<double>(value), Precision);
+    }
+}
+
+template <chars_format Fmt, int Precision, typename Real>
+BOOST_FORCEINLINE to_chars_result to_chars_static_impl(char* first, char* last, Real value) noexcept
+{
+    static_assert(is_valid_static_format(Fmt), "Fmt has to be one of the values of chars_format");
+
+    BOOST_IF_CONSTEXPR (Fmt == chars_format::hex || (Precision < 0 && Fmt != chars_format::scientific))
+    {
+        return boost::charconv::to_chars(first, last, value, Fmt, Precision);
+    }
+    else
+    {
+        if (first >= last)
+        {
+            return {last, std::errc::result_out_of_range};
+        }
+
+        // Dragonbox writes the shortest scientific output of every value, including zero and the non-finite ones
+        BOOST_IF_CONSTEXPR (Precision < 0)
+        {
+            return dragonbox_to_chars(value, first, last, Fmt);
+        }
+        else
+        {
+            if (!std::isfinite(value))
+            {
+                return dragonbox_to_chars(value, first, last, chars_format::general);
+            }
+
+            return to_chars_static_precision<Fmt, (Precision < 0 ? 0 : Precision)>(first, last, value);
+        }
+    }
+}
+
+// The same as from_chars_strict_impl with fast_float::from_chars_advanced inlined for a constant format
+template <chars_format Fmt, typename Real>
+BOOST_FORCEINLINE from_chars_result from_chars_static_impl(const char* first, const char* last, Real& value) noexcept
+{
+    static_assert(is_valid_static_format(Fmt), "Fmt has to be one of the values of chars_format");
+
+    BOOST_IF_CONSTEXPR (Fmt == chars_format::hex)
+    {
+        return boost::charconv::from_chars(first, last, value, Fmt);
+    }
+    else
+    {
+        if (first == last)
+        {
+            return {first, std::errc::invalid_argument};
+        }
+
+        Real temp_value;
+        from_chars_result r;
+        auto pns = fast_float::parse_number_string<char>(first, last, fast_float::parse_options_t<char>{Fmt});
+        if (pns.valid)
+        {
+            r = fast_float::from_number_string(pns, temp_value);
+        }
+        else
+        {
+            r = fast_float::detail::parse_infnan(first, last, temp_value);
+        }
+
+        if (r)
+        {
+            value = temp_value;
+        }
+
+        return r;
+    }
+}
+
+#ifdef BOOST_MSVC
+# pragma warning(pop)
+#endif
+
+} // namespace detail
+
+// to_chars<chars_format::fixed, 2>(first, last, value) gives the same result as to_chars(first, last, value, chars_format::fixed, 2).
+// A negative Precision is the shortest representation, as with to_chars(first, last, value, Fmt)
+template <chars_format Fmt, int Precision = -1, typename Real, typename std::enable_if<detail::is_static_format_float<Real>::value, bool>::type = true>
+BOOST_FORCEINLINE to_chars_result to_chars(char* first, char* last, Real value) noexcept
+{
+    return detail::to_chars_static_impl<Fmt, Precision>(first, last, value);
+}
+
+// from_chars<chars_format::general>(first, last, value) gives the same result as from_chars(first, last, value, chars_format::general)
+template <chars_format Fmt, typename Real, typename std::enable_if<detail::is_static_format_float<Real>::value, bool>::type = true>
+BOOST_FORCEINLINE from_chars_result from_chars(const char* first, const char* last, Real& value) noexcept
+{
+    return detail::from_chars_static_impl<Fmt>(first, last, value);
+}
+
+template <chars_format Fmt, typename Real, typename std::enable_if<detail::is_static_format_float<Real>::value, bool>::type = true>
+BOOST_FORCEINLINE from_chars_result from_chars(boost::core::string_view sv, Real& value) noexcept
+{
+    return detail::from_chars_static_impl<Fmt>(sv.data(), sv.data() + sv.size(), value);
+}
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_STATIC_FORMAT_HPP
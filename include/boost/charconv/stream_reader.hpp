@@ -0,0 +1,215 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_STREAM_READER_HPP
+#define BOOST_CHARCONV_STREAM_READER_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/from_chars_integer_impl.hpp>
+#include <boost/charconv/detail/fast_float/fast_float.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost { namespace charconv {
+
+// Destination of one column of delimited text
+// A default constructed (or nullptr) column is skipped without being parsed
+class stream_column
+{
+public:
+    constexpr stream_column() noexcept = default;
+    constexpr stream_column(std::nullptr_t) noexcept {} // NOLINT : Implicit conversion is intended
+    constexpr stream_column(std::int64_t* data) noexcept : type_ {column_type::int64}, int64_data_ {data} {} // NOLINT
+    constexpr stream_column(double* data) noexcept : type_ {column_type::float64}, float64_data_ {data} {} // NOLINT
+    constexpr stream_column(float* data) noexcept : type_ {column_type::float32}, float32_data_ {data} {} // NOLINT
+
+private:
+    friend class stream_reader;
+
+    enum class column_type : unsigned char
+    {
+        skip,
+        int64,
+        float64,
+        float32
+    };
+
+    column_type type_ {column_type::skip};
+    std::int64_t* int64_data_ {nullptr};
+    double* float64_data_ {nullptr};
+    float* float32_data_ {nullptr};
+};
+
+struct stream_reader_result
+{
+    // Points to the first character that has not been consumed.
+    // On success this is the start of the first incomplete row (or last),
+    // and on failure the start of the field that could not be parsed
+    const char* ptr;
+
+    // 0 on success. Otherwise the error from parsing the field,
+    // std::errc::invalid_argument for a malformed row (e.g. missing or extra fields),
+    // or std::errc::value_too_large when max_rows rows have already been stored
+    std::errc ec;
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
+// Parses delimited text row by row directly into typed column arrays.
+//
+// The input may be supplied in chunks. Only complete rows (terminated by the row delimiter) are consumed,
+// and the unconsumed tail of a chunk (result.ptr to last) must be passed again at the start of the next chunk.
+// The reader itself never allocates or copies the input.
+class stream_reader
+{
+public:
+    stream_reader(const stream_column* columns, std::size_t num_columns, std::size_t max_rows,
+                  char field_delimiter = ',', char row_delimiter = '\n', chars_format fmt = chars_format::general) noexcept
+        : columns_ {columns}, num_columns_ {num_columns}, max_rows_ {max_rows},
+          field_delimiter_ {field_delimiter}, row_delimiter_ {row_delimiter}, fmt_ {fmt}
+    {}
+
+    // Parses all complete rows in [first, last).
+    // If final_chunk is true the remaining characters after the last row delimiter are parsed as the final row
+    stream_reader_result feed(const char* first, const char* last, bool final_chunk = false) noexcept
+    {
+        while (first != last)
+        {
+            const auto row_end = static_cast<const char*>(std::memchr(first, row_delimiter_, static_cast<std::size_t>(last - first)));
+            if (row_end == nullptr && !final_chunk)
+            {
+                return {first, std::errc()};
+            }
+
+            const char* const row_last = row_end != nullptr ? row_end : last;
+            const char* const next_row = row_end != nullptr ? row_end + 1 : last;
+
+            // Skips blank lines
+            if (row_last == first || (row_delimiter_ == '\n' && row_last - first == 1 && *first == '\r'))
+            {
+                first = next_row;
+                continue;
+            }
+
+            if (rows_ == max_rows_)
+            {
+                return {first, std::errc::value_too_large};
+            }
+
+            const auto r = parse_row(first, row_last);
+            if (!r)
+            {
+                return {r.ptr, r.ec};
+            }
+
+            ++rows_;
+            first = next_row;
+        }
+
+        return {first, std::errc()};
+    }
+
+    stream_reader_result feed(boost::core::string_view sv, bool final_chunk = false) noexcept
+    {
+        return feed(sv.data(), sv.data() + sv.size(), final_chunk);
+    }
+
+    // Number of rows stored in the column arrays
+    std::size_t rows() const noexcept { return rows_; }
+
+    // Starts storing rows at index 0 again (e.g. after the column arrays have been drained)
+    void reset() noexcept { rows_ = 0; }
+
+private:
+    from_chars_result parse_row(const char* first, const char* last) noexcept
+    {
+        // Allow CRLF line endings
+        if (row_delimiter_ == '\n' && *(last - 1) == '\r')
+        {
+            --last;
+        }
+
+        for (std::size_t i = 0; i < num_columns_; ++i)
+        {
+            const auto r = parse_field(columns_[i], first, last);
+            if (!r)
+            {
+                return r;
+            }
+
+            first = r.ptr;
+            if (i + 1 != num_columns_)
+            {
+                if (first == last || *first != field_delimiter_)
+                {
+                    return {first, std::errc::invalid_argument};
+                }
+                ++first;
+            }
+        }
+
+        if (first != last)
+        {
+            return {first, std::errc::invalid_argument};
+        }
+
+        return {first, std::errc()};
+    }
+
+    from_chars_result parse_field(const stream_column& column, const char* first, const char* last) const noexcept
+    {
+        switch (column.type_)
+        {
+            case stream_column::column_type::int64:
+                return detail::from_chars(first, last, column.int64_data_[rows_]);
+
+            case stream_column::column_type::float64:
+                return parse_float(first, last, column.float64_data_[rows_]);
+
+            case stream_column::column_type::float32:
+                return parse_float(first, last, column.float32_data_[rows_]);
+
+            default:
+            {
+                const auto field_end = static_cast<const char*>(std::memchr(first, field_delimiter_, static_cast<std::size_t>(last - first)));
+                return {field_end != nullptr ? field_end : last, std::errc()};
+            }
+        }
+    }
+
+    template <typename T>
+    from_chars_result parse_float(const char* first, const char* last, T& value) const noexcept
+    {
+        if (BOOST_UNLIKELY(fmt_ == chars_format::hex))
+        {
+            return boost::charconv::from_chars(first, last, value, fmt_);
+        }
+
+        // Match from_chars and leave the value unmodified on error
+        T temp;
+        const auto r = detail::fast_float::from_chars(first, last, temp, fmt_);
+        if (r)
+        {
+            value = temp;
+        }
+
+        return r;
+    }
+
+    const stream_column* columns_;
+    std::size_t num_columns_;
+    std::size_t max_rows_;
+    std::size_t rows_ {};
+    char field_delimiter_;
+    char row_delimiter_;
+    chars_format fmt_;
+};
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_STREAM_READER_HPP
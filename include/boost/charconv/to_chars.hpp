@@ -7,108 +7,78 @@
 #ifndef BOOST_CHARCONV_TO_CHARS_HPP_INCLUDED
 #define BOOST_CHARCONV_TO_CHARS_HPP_INCLUDED
 
-#include <boost/charconv/detail/to_chars_integer_impl.hpp>
+#include <boost/charconv/integer.hpp>
+#include <boost/charconv/float.hpp>
+#include <boost/charconv/extended_float.hpp>
 #include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
 #include <boost/charconv/config.hpp>
 #include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <type_traits>
+#include <cstddef>
+
+// All of the to_chars overloads. <boost/charconv/integer.hpp>, <boost/charconv/float.hpp> and
+// <boost/charconv/extended_float.hpp> have those for the integer and floating point types alone
 
 namespace boost {
 namespace charconv {
 
-// integer overloads
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, bool value, int base) noexcept = delete;
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, char value, int base = 10) noexcept
-{
-    return detail::to_chars_int(first, last, value, base);
-}
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, signed char value, int base = 10) noexcept
-{
-    return detail::to_chars_int(first, last, value, base);
-}
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, unsigned char value, int base = 10) noexcept
-{
-    return detail::to_chars_int(first, last, value, base);
-}
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, short value, int base = 10) noexcept
-{
-    return detail::to_chars_int(first, last, value, base);
-}
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, unsigned short value, int base = 10) noexcept
-{
-    return detail::to_chars_int(first, last, value, base);
-}
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, int value, int base = 10) noexcept
-{
-    return detail::to_chars_int(first, last, value, base);
-}
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, unsigned int value, int base = 10) noexcept
-{
-    return detail::to_chars_int(first, last, value, base);
-}
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, long value, int base = 10) noexcept
-{
-    return detail::to_chars_int(first, last, value, base);
-}
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, unsigned long value, int base = 10) noexcept
-{
-    return detail::to_chars_int(first, last, value, base);
-}
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, long long value, int base = 10) noexcept
-{
-    return detail::to_chars_int(first, last, value, base);
-}
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, unsigned long long value, int base = 10) noexcept
+//----------------------------------------------------------------------------------------------------------------------
+// Other character types: wchar_t, char16_t, char32_t and char8_t
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+// Formats as char into the last (last - first) bytes of the output with format, and widens the characters in place from the front.
+// The i-th narrow character is at byte (last - first) * (sizeof(CharT) - 1) + i, at or after the end of the first i wide characters,
+// so every character is read before anything is written over it, and no other buffer is needed
+template <typename CharT, typename Format>
+to_chars_result_t<CharT> to_chars_widen(CharT* first, CharT* last, Format format) noexcept
 {
-    return detail::to_chars_int(first, last, value, base);
+    if (first > last)
+    {
+        return {last, std::errc::invalid_argument};
+    }
+
+    char* const narrow_last = reinterpret_cast<char*>(last);
+    char* const narrow_first = narrow_last - (last - first);
+    const auto r = format(narrow_first, narrow_last);
+    if (!r)
+    {
+        return {last, r.ec};
+    }
+
+    const std::ptrdiff_t length = r.ptr - narrow_first;
+    for (std::ptrdiff_t i = 0; i < length; ++i)
+    {
+        const char c = narrow_first[i];
+        first[i] = static_cast<CharT>(static_cast<unsigned char>(c));
+    }
+
+    return {first + length, std::errc()};
 }
 
-#ifdef BOOST_CHARCONV_HAS_INT128
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, boost::int128_type value, int base = 10) noexcept
+} // namespace detail
+
+// The characters are the same as the char overloads write
+template <typename CharT, typename Integer, typename std::enable_if<detail::is_extended_char<CharT>::value && detail::is_charconv_integer<Integer>::value, bool>::type = true>
+to_chars_result_t<CharT> to_chars(CharT* first, CharT* last, Integer value, int base = 10) noexcept
 {
-    return detail::to_chars128(first, last, value, base);
+    return detail::to_chars_widen(first, last, [value, base](char* narrow_first, char* narrow_last) noexcept
+    {
+        return boost::charconv::to_chars(narrow_first, narrow_last, value, base);
+    });
 }
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, boost::uint128_type value, int base = 10) noexcept
+
+template <typename CharT, typename Real, typename std::enable_if<detail::is_extended_char<CharT>::value && std::is_floating_point<Real>::value, bool>::type = true>
+to_chars_result_t<CharT> to_chars(CharT* first, CharT* last, Real value, chars_format fmt = chars_format::general, int precision = -1) noexcept
 {
-    return detail::to_chars128(first, last, value, base);
+    return detail::to_chars_widen(first, last, [value, fmt, precision](char* narrow_first, char* narrow_last) noexcept
+    {
+        return boost::charconv::to_chars(narrow_first, narrow_last, value, fmt, precision);
+    });
 }
-#endif
-
-//----------------------------------------------------------------------------------------------------------------------
-// Floating Point
-//----------------------------------------------------------------------------------------------------------------------
-
-BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, float value,
-                                             chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
-BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, double value, 
-                                             chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
-BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, long double value,
-                                             chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
-
-#ifdef BOOST_CHARCONV_HAS_FLOAT128
-BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, __float128 value,
-                                             chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
-#endif
-
-#ifdef BOOST_CHARCONV_HAS_FLOAT16
-BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, std::float16_t value, 
-                                             chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
-#endif
-#ifdef BOOST_CHARCONV_HAS_FLOAT32
-BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, std::float32_t value, 
-                                             chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
-#endif
-#ifdef BOOST_CHARCONV_HAS_FLOAT64
-BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, std::float64_t value, 
-                                             chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
-#endif
-#if defined(BOOST_CHARCONV_HAS_STDFLOAT128) && defined(BOOST_CHARCONV_HAS_FLOAT128)
-BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, std::float128_t value,
-                                             chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
-#endif
-#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
-BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, std::bfloat16_t value, 
-                                             chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
-#endif
 
 } // namespace charconv
 } // namespace boost
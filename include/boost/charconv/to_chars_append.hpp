@@ -0,0 +1,96 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_TO_CHARS_APPEND_HPP
+#define BOOST_CHARCONV_TO_CHARS_APPEND_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/limits.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <type_traits>
+#include <cstddef>
+
+namespace boost { namespace charconv {
+
+// Customization point for the output of to_chars_append.
+//
+// prepare(sink, n) makes room for n characters after the current contents and returns a pointer to the first of them,
+// and commit(sink, end) keeps the characters up to end and drops the rest of the room that was made.
+// The primary template works with every contiguous container of char with size, resize and data, like std::string and std::vector<char>.
+// Other sinks (e.g. arena backed buffers) specialize sink_traits
+template <typename Sink, typename = void>
+struct sink_traits
+{
+    static char* prepare(Sink& sink, std::size_t n)
+    {
+        const std::size_t size = sink.size();
+        sink.resize(size + n);
+        return &sink[0] + size;
+    }
+
+    static void commit(Sink& sink, char* end)
+    {
+        sink.resize(static_cast<std::size_t>(end - &sink[0]));
+    }
+};
+
+namespace detail {
+
+// Formats into room for length characters in the tail of sink with format, and commits what has been written.
+// On failure nothing is appended
+template <typename Sink, typename Format>
+to_chars_result append_in_place(Sink& sink, std::size_t length, Format format)
+{
+    char* const first = sink_traits<Sink>::prepare(sink, length);
+    const auto r = format(first, first + length);
+    sink_traits<Sink>::commit(sink, r ? r.ptr : first);
+    return r;
+}
+
+} // namespace detail
+
+// Appends value to sink as to_chars with the same arguments would write it.
+// On success ptr points one past the appended characters inside the sink. On failure nothing is appended.
+// The integer overloads make room for exactly the number of characters that are written
+template <typename Sink, typename Integer, typename std::enable_if<!std::is_floating_point<Integer>::value, bool>::type = true>
+to_chars_result to_chars_append(Sink& sink, Integer value, int base = 10)
+{
+    const std::size_t length = boost::charconv::to_chars_length(value, base);
+    if (length == 0)
+    {
+        return {nullptr, std::errc::invalid_argument};
+    }
+
+    return detail::append_in_place(sink, length, [value, base](char* first, char* last) noexcept
+    {
+        return boost::charconv::to_chars(first, last, value, base);
+    });
+}
+
+// The shortest general and scientific representation never needs more than limits<T>::max_chars characters, so that much room is made
+// without looking at the value. Fixed format and a precision can be much longer and are sized with to_chars_length.
+// to_chars checks for max_chars characters of room even when it writes less, so the room is never smaller
+template <typename Sink, typename Real, typename std::enable_if<std::is_same<Real, float>::value || std::is_same<Real, double>::value, bool>::type = true>
+to_chars_result to_chars_append(Sink& sink, Real value, chars_format fmt = chars_format::general, int precision = -1)
+{
+    constexpr auto max_chars = static_cast<std::size_t>(limits<Real>::max_chars);
+    const bool shortest = precision < 0 && (fmt == chars_format::general || fmt == chars_format::scientific);
+
+    std::size_t length = max_chars;
+    if (!shortest)
+    {
+        const std::size_t exact_length = boost::charconv::to_chars_length(value, fmt, precision);
+        length = exact_length > max_chars ? exact_length : max_chars;
+    }
+
+    return detail::append_in_place(sink, length, [value, fmt, precision](char* first, char* last) noexcept
+    {
+        return boost::charconv::to_chars(first, last, value, fmt, precision);
+    });
+}
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_TO_CHARS_APPEND_HPP
@@ -0,0 +1,246 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/canonicalize.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <string>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+
+static std::mt19937_64 rng(42);
+
+void test_valid(const std::string& str, const std::string& expected, chars_format fmt = chars_format::general)
+{
+    char buffer[256];
+    const auto r = boost::charconv::canonicalize_number(str.data(), str.data() + str.size(), buffer, buffer + sizeof(buffer), fmt);
+    if (!BOOST_TEST(r) || !BOOST_TEST(r.in_ptr == str.data() + str.size()) || !BOOST_TEST_EQ(std::string(buffer, r.out_ptr), expected))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+
+    char sv_buffer[256];
+    const auto sv_r = boost::charconv::canonicalize_number(boost::core::string_view(str), sv_buffer, sv_buffer + sizeof(sv_buffer), fmt);
+    BOOST_TEST(sv_r.in_ptr == r.in_ptr);
+    BOOST_TEST_EQ(std::string(sv_buffer, sv_r.out_ptr), std::string(buffer, r.out_ptr));
+
+    // Exactly the length of the output fits, and one less does not
+    const auto length = static_cast<std::size_t>(r.out_ptr - buffer);
+    std::string exact(length, ' ');
+    BOOST_TEST(boost::charconv::canonicalize_number(str.data(), str.data() + str.size(), &exact[0], &exact[0] + length, fmt));
+    BOOST_TEST_EQ(exact, expected);
+    const auto short_r = boost::charconv::canonicalize_number(str.data(), str.data() + str.size(), &exact[0], &exact[0] + length - 1, fmt);
+    BOOST_TEST(short_r.ec == std::errc::result_out_of_range);
+}
+
+void test_exact()
+{
+    test_valid("001.500E+01", "15");
+    test_valid("15", "15");
+    test_valid("-15.000", "-15");
+    test_valid("1.5e3", "1500");
+    test_valid("000.125", "0.125");
+    test_valid(".5", "0.5");
+    test_valid("5.", "5");
+    test_valid("0.001", "0.001");
+    test_valid("0.0001", "1e-04");
+    test_valid("1e20", "1e+20");
+    test_valid("10000", "10000");
+    test_valid("100000", "1e+05");
+    test_valid("12e-1000", "1.2e-999");
+    test_valid("1.25E+400", "1.25e+400");
+
+    // Zeros keep their sign, like to_chars
+    test_valid("0", "0");
+    test_valid("-0.000", "-0");
+    test_valid("0e5", "0");
+    test_valid("000.000e-7", "0");
+    test_valid("0", "0e+00", chars_format::scientific);
+    test_valid("-0", "-0", chars_format::fixed);
+
+    // Every digit is kept, beyond what any floating point type has
+    test_valid("123456789012345678901234567890", "123456789012345678901234567890");
+    test_valid("1.000000000000000000000000000001", "1.000000000000000000000000000001");
+    test_valid("0.000000000000000000000000000000123456789012345678901234500e10", "1.234567890123456789012345e-21");
+    test_valid("12345678901234567890123.4567890000e-3", "12345678901234567890.123456789");
+    test_valid("1234567890123456789000000000000000000000000000000000.0", "1.234567890123456789e+51");
+
+    test_valid("001.500E+01", "15", chars_format::fixed);
+    test_valid("001.500E+01", "1.5e+01", chars_format::scientific);
+    test_valid("1e20", "100000000000000000000", chars_format::fixed);
+    test_valid("0.0001", "0.0001", chars_format::fixed);
+    test_valid("123.456", "1.23456e+02", chars_format::scientific);
+    test_valid("-7", "-7e+00", chars_format::scientific);
+    test_valid("12345678901234567890123", "1.2345678901234567890123e+22", chars_format::scientific);
+
+    // Nothing to go through a floating point type with, so they are written as by to_chars
+    test_valid("inf", "inf");
+    test_valid("-INFINITY", "-inf");
+    test_valid("nan", "nan");
+}
+
+void test_errors()
+{
+    char buffer[64];
+    const auto test = [&](const char* str, std::errc ec, std::size_t in_length, chars_format fmt)
+    {
+        const auto r = boost::charconv::canonicalize_number(str, str + std::strlen(str), buffer, buffer + sizeof(buffer), fmt);
+        if (!BOOST_TEST(r.ec == ec) || !BOOST_TEST_EQ(r.in_ptr - str, static_cast<std::ptrdiff_t>(in_length)))
+        {
+            std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+        }
+        BOOST_TEST(r.out_ptr == buffer);
+    };
+
+    test("", std::errc::invalid_argument, 0, chars_format::general);
+    test("abc", std::errc::invalid_argument, 0, chars_format::general);
+    test("+1", std::errc::invalid_argument, 0, chars_format::general);
+    test("-", std::errc::invalid_argument, 0, chars_format::general);
+    test(".", std::errc::invalid_argument, 0, chars_format::general);
+    test("e5", std::errc::invalid_argument, 0, chars_format::general);
+    test("1.5", std::errc::invalid_argument, 0, chars_format::hex);
+
+    // The number ends where from_chars would end it
+    const auto test_end = [&](const char* str, std::size_t in_length, const char* expected)
+    {
+        const auto r = boost::charconv::canonicalize_number(str, str + std::strlen(str), buffer, buffer + sizeof(buffer));
+        BOOST_TEST(r);
+        BOOST_TEST_EQ(r.in_ptr - str, static_cast<std::ptrdiff_t>(in_length));
+        BOOST_TEST_EQ(std::string(buffer, r.out_ptr), std::string(expected));
+    };
+
+    test_end("1.5,2", 3, "1.5");
+    test_end("1.5e", 3, "1.5");
+    test_end("1.5e+", 3, "1.5");
+    test_end("2e4x", 3, "20000");
+    test_end("0.00 ", 4, "0");
+    test_end("0e", 1, "0");
+}
+
+// A decimal of digits with a decimal point somewhere, padding zeros on either side, and an exponent in one of the spellings
+std::string random_decimal()
+{
+    std::string str;
+    if (rng() % 2 == 0)
+    {
+        str.push_back('-');
+    }
+    str.append(rng() % 3, '0');
+
+    const auto num_digits = static_cast<std::size_t>(1 + rng() % 25);
+    const auto dot = static_cast<std::size_t>(rng() % (num_digits + 2));
+    for (std::size_t i = 0; i < num_digits; ++i)
+    {
+        if (i == dot)
+        {
+            str.push_back('.');
+        }
+        // Mostly short significands with zeros at the end, which is what the fast path takes
+        const bool zero = i > 6 && rng() % 4 != 0;
+        str.push_back(zero ? '0' : static_cast<char>('0' + rng() % 10));
+    }
+
+    switch (rng() % 5)
+    {
+        case 0:
+            break;
+        case 1:
+            str += 'e';
+            str += std::to_string(static_cast<int>(rng() % 80) - 40);
+            break;
+        case 2:
+            str += "E+" + std::to_string(rng() % 400);
+            break;
+        case 3:
+            str += "e-0" + std::to_string(rng() % 400);
+            break;
+        default:
+            str += 'e';
+            str += std::to_string(static_cast<int>(rng() % 40) - 20);
+            break;
+    }
+
+    return str;
+}
+
+// With a type the output is that of from_chars followed by to_chars
+template <typename T>
+void test_round_trip(const std::string& str, chars_format fmt)
+{
+    char expected[2048];
+    T value {};
+    const auto fr = boost::charconv::from_chars(str.data(), str.data() + str.size(), value);
+    const auto tr = boost::charconv::to_chars(expected, expected + sizeof(expected), value, fmt);
+
+    char buffer[2048];
+    const auto r = boost::charconv::canonicalize_number<T>(str.data(), str.data() + str.size(), buffer, buffer + sizeof(buffer), fmt);
+    BOOST_TEST(r.ec == fr.ec);
+    BOOST_TEST(r.in_ptr == fr.ptr);
+    if (fr && !BOOST_TEST_EQ(std::string(buffer, r.out_ptr), std::string(expected, tr.ptr)))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+void test_random()
+{
+    const chars_format formats[] = {chars_format::general, chars_format::fixed, chars_format::scientific, chars_format::hex};
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const std::string str = random_decimal();
+        for (const auto fmt : formats)
+        {
+            test_round_trip<double>(str, fmt);
+            test_round_trip<float>(str, fmt);
+        }
+
+        // The exact form has the same value, and is its own canonical form
+        char buffer[1024];
+        const auto r = boost::charconv::canonicalize_number(str.data(), str.data() + str.size(), buffer, buffer + sizeof(buffer));
+        BOOST_TEST(r);
+        BOOST_TEST(r.in_ptr == str.data() + str.size());
+
+        double expected {};
+        double value {};
+        const auto expected_r = boost::charconv::from_chars(str.data(), str.data() + str.size(), expected);
+        const auto value_r = boost::charconv::from_chars(buffer, r.out_ptr, value);
+        BOOST_TEST(expected_r.ec == value_r.ec);
+        if (expected_r && !BOOST_TEST_EQ(value, expected))
+        {
+            std::cerr << "Input: " << str << "\nOutput: " << std::string(buffer, r.out_ptr) << std::endl; // LCOV_EXCL_LINE
+        }
+
+        char again[1024];
+        const auto again_r = boost::charconv::canonicalize_number(buffer, r.out_ptr, again, again + sizeof(again));
+        BOOST_TEST(again_r.in_ptr == r.out_ptr);
+        BOOST_TEST_EQ(std::string(again, again_r.out_ptr), std::string(buffer, r.out_ptr));
+    }
+
+    for (const char* str : {"inf", "-inf", "nan", "-nan", "nan(snan)", "1e400", "-1e-400", "1e39", "1e-50", "3.4028235e38", "1.17549435e-38",
+                            "1e16", "12345678901234567", "18446744073709551616", "4294967296", "1e7", "0", "-0.0", "abc", "+1",
+                            "5.", "-.5e3", "1e", "1e+", "1.5E-", "00.e1", "1e99999999999999999999", "1e-99999999999999999999",
+                            "123456789012345.6", "0.000001", "999999999999999e293", "1e-306", "1e-307"})
+    {
+        for (const auto fmt : formats)
+        {
+            test_round_trip<double>(str, fmt);
+            test_round_trip<float>(str, fmt);
+        }
+    }
+}
+
+int main()
+{
+    test_exact();
+    test_errors();
+    test_random();
+
+    return boost::report_errors();
+}
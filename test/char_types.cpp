@@ -0,0 +1,298 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <string>
+#include <limits>
+#include <type_traits>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+
+static std::mt19937_64 rng(42);
+
+template <typename CharT>
+std::basic_string<CharT> widen(const std::string& str)
+{
+    std::basic_string<CharT> wide;
+    for (const char c : str)
+    {
+        wide.push_back(static_cast<CharT>(static_cast<unsigned char>(c)));
+    }
+    return wide;
+}
+
+// Parsing the wide string has to give the same value, error and end as parsing the same characters as char
+template <typename CharT, typename T, typename Arg>
+void test_parse(const std::string& str, Arg arg)
+{
+    T expected = T(42);
+    const auto expected_r = boost::charconv::from_chars(str.data(), str.data() + str.size(), expected, arg);
+
+    const auto wide = widen<CharT>(str);
+    T value = T(42);
+    const auto r = boost::charconv::from_chars(wide.data(), wide.data() + wide.size(), value, arg);
+
+    if (!BOOST_TEST(r.ec == expected_r.ec) || !BOOST_TEST_EQ(r.ptr - wide.data(), expected_r.ptr - str.data()) ||
+        !BOOST_TEST(value == expected || (value != value && expected != expected)))
+    {
+        std::cerr << "Input: " << str << "\nSize of character: " << sizeof(CharT) << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+// Formatting has to write the same characters as the char overloads
+template <typename CharT, typename T, typename... Args>
+std::string test_format_only(T value, Args... args)
+{
+    char expected[1024];
+    const auto expected_r = boost::charconv::to_chars(expected, expected + sizeof(expected), value, args...);
+    BOOST_TEST(expected_r);
+    const std::string expected_str(expected, expected_r.ptr);
+
+    CharT buffer[1024];
+    const auto r = boost::charconv::to_chars(buffer, buffer + 1024, value, args...);
+    BOOST_TEST(r);
+    BOOST_TEST((std::basic_string<CharT>(buffer, r.ptr) == widen<CharT>(expected_str)));
+
+    // Exactly enough room
+    const auto length = static_cast<std::ptrdiff_t>(expected_str.size());
+    CharT exact[1024];
+    const auto exact_r = boost::charconv::to_chars(exact, exact + length, value, args...);
+    BOOST_TEST(exact_r.ec == boost::charconv::to_chars(expected, expected + length, value, args...).ec);
+    if (exact_r)
+    {
+        BOOST_TEST((std::basic_string<CharT>(exact, exact_r.ptr) == widen<CharT>(expected_str)));
+    }
+
+    // Too small
+    if (length > 1)
+    {
+        const auto small_r = boost::charconv::to_chars(exact, exact + 1, value, args...);
+        BOOST_TEST(small_r.ec == std::errc::result_out_of_range);
+        BOOST_TEST(small_r.ptr == exact + 1);
+    }
+
+    return expected_str;
+}
+
+// and what is written parses back the same way as with char
+template <typename CharT, typename T, typename Arg, typename... Args>
+void test_format(T value, Arg arg, Args... args)
+{
+    test_parse<CharT, T>(test_format_only<CharT>(value, arg, args...), arg);
+}
+
+template <typename CharT, typename T>
+void test_integer()
+{
+    std::uniform_int_distribution<T> dist((std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+    for (int i = 0; i < 1000; ++i)
+    {
+        const T value = dist(rng);
+        for (const int base : {2, 10, 16, 36})
+        {
+            test_format<CharT>(value, base);
+        }
+    }
+
+    test_format<CharT>((std::numeric_limits<T>::min)(), 10);
+    test_format<CharT>((std::numeric_limits<T>::max)(), 2);
+    test_format<CharT>(T(0), 10);
+
+    for (const auto str : {"", "-", "+1", " 1", "x", "12,3", "ff", "FFz", "-0", "99999999999999999999999999999999999999999"})
+    {
+        test_parse<CharT, T>(str, 10);
+        test_parse<CharT, T>(str, 16);
+    }
+
+    // Characters outside of ASCII are never digits, even those that are a digit plus a multiple of 256
+    BOOST_IF_CONSTEXPR (sizeof(CharT) > 1)
+    {
+        const std::basic_string<CharT> wide {CharT('1'), CharT('2'), static_cast<CharT>(static_cast<unsigned>('3') + 256U)};
+        T value {};
+        const auto r = boost::charconv::from_chars(wide.data(), wide.data() + wide.size(), value);
+        BOOST_TEST(r);
+        BOOST_TEST(r.ptr == wide.data() + 2);
+        BOOST_TEST_EQ(value, T(12));
+    }
+
+    // Invalid base
+    CharT buffer[8];
+    const auto to_r = boost::charconv::to_chars(buffer, buffer + 8, T(1), 1);
+    BOOST_TEST(to_r.ec == std::errc::invalid_argument);
+}
+
+// The values just outside of the range of T in every base are out of range, and do not wrap into it
+template <typename CharT, typename T>
+void test_overflow()
+{
+    for (int base = 2; base <= 36; ++base)
+    {
+        for (const long long limit : {static_cast<long long>((std::numeric_limits<T>::max)()), static_cast<long long>((std::numeric_limits<T>::min)())})
+        {
+            if (limit == 0)
+            {
+                continue;
+            }
+
+            char buffer[128];
+            auto to_r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), limit, base);
+            const auto in_range = widen<CharT>(std::string(buffer, to_r.ptr));
+            to_r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), limit < 0 ? limit - 1 : limit + 1, base);
+            const auto out_of_range = widen<CharT>(std::string(buffer, to_r.ptr));
+
+            T value {};
+            auto r = boost::charconv::from_chars(in_range.data(), in_range.data() + in_range.size(), value, base);
+            BOOST_TEST(r);
+            BOOST_TEST_EQ(static_cast<long long>(value), limit);
+
+            value = T(42);
+            r = boost::charconv::from_chars(out_of_range.data(), out_of_range.data() + out_of_range.size(), value, base);
+            if (!BOOST_TEST(r.ec == std::errc::result_out_of_range) || !BOOST_TEST(r.ptr == out_of_range.data() + out_of_range.size()))
+            {
+                std::cerr << "Base: " << base << "\nSize of character: " << sizeof(CharT) << std::endl; // LCOV_EXCL_LINE
+            }
+            BOOST_TEST_EQ(value, T(42));
+        }
+    }
+
+    // 0x97 is 151
+    const auto wide = widen<CharT>("97");
+    signed char value = 42;
+    const auto r = boost::charconv::from_chars(wide.data(), wide.data() + wide.size(), value, 16);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(value, 42);
+}
+
+template <typename CharT, typename T>
+void test_float()
+{
+    using bits_type = typename std::conditional<sizeof(T) == sizeof(std::uint64_t), std::uint64_t, std::uint32_t>::type;
+    std::uniform_int_distribution<std::uint64_t> bits_dist;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        const auto bits = static_cast<bits_type>(bits_dist(rng));
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        test_format<CharT>(value, chars_format::general);
+        for (const auto fmt : {chars_format::general, chars_format::scientific, chars_format::fixed, chars_format::hex})
+        {
+            test_format<CharT>(value, fmt);
+            test_format<CharT>(value, fmt, 5);
+        }
+    }
+
+    test_format<CharT>((std::numeric_limits<T>::max)(), chars_format::fixed, 50);
+
+    for (const auto str : {"", "-", "+1", ".5", "1.", "1e", "1e+5", "1E-5x", "inf", "-infinity", "nan", "nan(snan)", "1e400", "-1e-400",
+                           "1.7976931348623157e308", "4.9406564584124654e-324", "123456789012345678901234567890", "0.000000000000000000000001"})
+    {
+        for (const auto fmt : {chars_format::general, chars_format::scientific, chars_format::fixed, chars_format::hex})
+        {
+            test_parse<CharT, T>(str, fmt);
+        }
+    }
+
+    for (const auto str : {"1.8p+3", "-a.bp-2", "1p", "ffp-1000", "1.fffffffffffffffffffffp0"})
+    {
+        test_parse<CharT, T>(str, chars_format::hex);
+    }
+
+    // Characters outside of ASCII end the number
+    BOOST_IF_CONSTEXPR (sizeof(CharT) > 1)
+    {
+        const std::basic_string<CharT> wide {CharT('1'), CharT('.'), CharT('5'), static_cast<CharT>(static_cast<unsigned>('5') + 256U)};
+        T value {};
+        auto r = boost::charconv::from_chars(wide.data(), wide.data() + wide.size(), value);
+        BOOST_TEST(r);
+        BOOST_TEST(r.ptr == wide.data() + 3);
+        BOOST_TEST_EQ(value, T(1.5));
+
+        r = boost::charconv::from_chars(wide.data(), wide.data() + wide.size(), value, chars_format::hex);
+        BOOST_TEST(r);
+        BOOST_TEST(r.ptr == wide.data() + 3);
+        BOOST_TEST_EQ(value, T(1.3125));
+    }
+}
+
+// Hexadecimal input of any length is read from the wide characters, and gives the same result as char
+template <typename CharT, typename T>
+void test_long_hex()
+{
+    for (const std::string& str : {"1." + std::string(2000, '0') + "p0,", std::string(1500, '0') + "1.8p-1",
+                                   "1." + std::string(1100, '0') + "1p+3", "-" + std::string(1024, '0') + "ap0",
+                                   "1" + std::string(1100, '0') + "p0", std::string("nan(snan)"), std::string("-infinity")})
+    {
+        test_parse<CharT, T>(str, chars_format::hex);
+    }
+
+    const auto wide = widen<CharT>("1." + std::string(2000, '0') + "p0,");
+    T value = T(42);
+    const auto r = boost::charconv::from_chars(wide.data(), wide.data() + wide.size(), value, chars_format::hex);
+    BOOST_TEST(r);
+    BOOST_TEST(r.ptr == wide.data() + wide.size() - 1);
+    BOOST_TEST_EQ(value, T(1));
+
+    // Characters outside of ASCII end the number instead of being taken for the digit of their low byte
+    std::basic_string<CharT> non_ascii = widen<CharT>("1.8p0");
+    non_ascii.insert(non_ascii.begin() + 2, static_cast<CharT>(0x131));
+    const auto nr = boost::charconv::from_chars(non_ascii.data(), non_ascii.data() + non_ascii.size(), value, chars_format::hex);
+    BOOST_TEST(nr);
+    BOOST_TEST(nr.ptr == non_ascii.data() + 2);
+    BOOST_TEST_EQ(value, T(1));
+}
+
+template <typename CharT>
+void test_char_type()
+{
+    test_integer<CharT, int>();
+    test_integer<CharT, unsigned>();
+    test_integer<CharT, long long>();
+    test_integer<CharT, unsigned long long>();
+    test_integer<CharT, short>();
+
+    test_overflow<CharT, signed char>();
+    test_overflow<CharT, unsigned char>();
+    test_overflow<CharT, short>();
+    test_overflow<CharT, unsigned short>();
+    test_overflow<CharT, int>();
+    test_overflow<CharT, unsigned>();
+
+    test_float<CharT, float>();
+    test_float<CharT, double>();
+}
+
+int main()
+{
+    test_char_type<wchar_t>();
+    test_char_type<char16_t>();
+    test_char_type<char32_t>();
+
+    test_long_hex<wchar_t, double>();
+    test_long_hex<char16_t, float>();
+    test_long_hex<char32_t, double>();
+
+    #ifdef BOOST_CHARCONV_HAS_CHAR8_T
+    test_char_type<char8_t>();
+    test_format<char8_t>(1.5L, chars_format::general);
+
+    const std::u8string long_hex = u8"1." + std::u8string(2000, u8'0') + u8"p0";
+    double value {};
+    const auto r = boost::charconv::from_chars(long_hex.data(), long_hex.data() + long_hex.size(), value, chars_format::hex);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(value, 1.0);
+    #endif
+
+    // Long double and other floating point types are formatted with every character type
+    test_format_only<wchar_t>(1.5L, chars_format::scientific, 30);
+
+    return boost::report_errors();
+}
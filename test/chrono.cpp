@@ -0,0 +1,227 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// to_chars and from_chars of system_clock time points as ISO 8601 timestamps and nanoseconds since the epoch, and of durations
+
+#include <boost/charconv/chrono.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <algorithm>
+#include <random>
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::timestamp_format;
+using std::chrono::system_clock;
+
+template <typename Duration>
+using sys_time = std::chrono::time_point<system_clock, Duration>;
+
+static std::mt19937_64 rng(42);
+
+// 0000-01-01T00:00:00Z and 9999-12-31T23:59:59Z
+constexpr std::int64_t min_seconds = INT64_C(-62167219200);
+constexpr std::int64_t max_seconds = INT64_C(253402300799);
+
+template <typename Duration>
+std::string format(sys_time<Duration> value, timestamp_format fmt = timestamp_format::iso8601)
+{
+    char buffer[64] {};
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt);
+    BOOST_TEST(r);
+    return std::string(buffer, r.ptr);
+}
+
+template <typename Duration>
+void parse_test(const std::string& str, std::int64_t expected_ticks)
+{
+    sys_time<Duration> value {};
+    const auto r = boost::charconv::from_chars(str.data(), str.data() + str.size(), value);
+    if (!BOOST_TEST(r) || !BOOST_TEST(r.ptr == str.data() + str.size()) || !BOOST_TEST_EQ(value.time_since_epoch().count(), expected_ticks))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename Duration>
+void invalid_test(const std::string& str, std::errc expected = std::errc::invalid_argument)
+{
+    const sys_time<Duration> original {Duration(1)};
+    auto value = original;
+    const auto r = boost::charconv::from_chars(str.data(), str.data() + str.size(), value);
+    if (!BOOST_TEST(r.ec == expected) || !BOOST_TEST(value == original))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+void known_values()
+{
+    using std::chrono::seconds;
+    using std::chrono::milliseconds;
+    using std::chrono::microseconds;
+    using std::chrono::nanoseconds;
+    using std::chrono::minutes;
+    using centiseconds = std::chrono::duration<std::int64_t, std::centi>;
+    using half_seconds = std::chrono::duration<std::int64_t, std::ratio<1, 2>>;
+
+    BOOST_TEST_EQ(format(sys_time<seconds>(seconds(0))), "1970-01-01T00:00:00Z");
+    BOOST_TEST_EQ(format(sys_time<seconds>(seconds(951782400))), "2000-02-29T00:00:00Z");
+    BOOST_TEST_EQ(format(sys_time<seconds>(seconds(-1))), "1969-12-31T23:59:59Z");
+    BOOST_TEST_EQ(format(sys_time<seconds>(seconds(min_seconds))), "0000-01-01T00:00:00Z");
+    BOOST_TEST_EQ(format(sys_time<seconds>(seconds(max_seconds))), "9999-12-31T23:59:59Z");
+    BOOST_TEST_EQ(format(sys_time<minutes>(minutes(1))), "1970-01-01T00:01:00Z");
+
+    BOOST_TEST_EQ(format(sys_time<milliseconds>(milliseconds(1234))), "1970-01-01T00:00:01.234Z");
+    BOOST_TEST_EQ(format(sys_time<milliseconds>(milliseconds(-1))), "1969-12-31T23:59:59.999Z");
+    BOOST_TEST_EQ(format(sys_time<microseconds>(microseconds(1700000000000001))), "2023-11-14T22:13:20.000001Z");
+    BOOST_TEST_EQ(format(sys_time<nanoseconds>(nanoseconds(INT64_C(1700000000123456789)))), "2023-11-14T22:13:20.123456789Z");
+    BOOST_TEST_EQ(format(sys_time<centiseconds>(centiseconds(5))), "1970-01-01T00:00:00.05Z");
+    BOOST_TEST_EQ(format(sys_time<half_seconds>(half_seconds(3))), "1970-01-01T00:00:01.500000000Z");
+
+    BOOST_TEST_EQ(format(sys_time<milliseconds>(milliseconds(1234)), timestamp_format::epoch_nanoseconds), "1234000000");
+    BOOST_TEST_EQ(format(sys_time<nanoseconds>(nanoseconds(-5)), timestamp_format::epoch_nanoseconds), "-5");
+
+    parse_test<seconds>("1970-01-01T00:00:00Z", 0);
+    parse_test<seconds>("2000-02-29t00:00:00z", 951782400);
+    parse_test<seconds>("2000-02-29 00:00:00Z", 951782400);
+    parse_test<seconds>("1969-12-31T23:59:59.999999999999Z", -1);
+    parse_test<seconds>("2000-02-29T01:30:00+01:30", 951782400);
+    parse_test<seconds>("2000-02-28T22:00:00-02:00", 951782400);
+    parse_test<minutes>("1970-01-01T00:01:59Z", 1);
+    parse_test<minutes>("1969-12-31T23:59:01Z", -1);
+    parse_test<milliseconds>("1970-01-01T00:00:01.2Z", 1200);
+    parse_test<milliseconds>("1970-01-01T00:00:01,2345Z", 1234);
+    parse_test<milliseconds>("1969-12-31T23:59:59.9999Z", -1);
+    parse_test<nanoseconds>("2023-11-14T22:13:20.123456789Z", INT64_C(1700000000123456789));
+    parse_test<nanoseconds>("2023-11-14T22:13:20.12345678Z", INT64_C(1700000000123456780));
+    parse_test<centiseconds>("1970-01-01T00:00:00.059Z", 5);
+    parse_test<half_seconds>("1970-01-01T00:00:01.7Z", 3);
+
+    invalid_test<seconds>("");
+    invalid_test<seconds>("1970-01-01T00:00:00");
+    invalid_test<seconds>("1970-01-01X00:00:00Z");
+    invalid_test<seconds>("1970/01/01T00:00:00Z");
+    invalid_test<seconds>("1970-01-01T00-00:00Z");
+    invalid_test<seconds>("1970-01-01T00:00:0aZ");
+    invalid_test<seconds>("197a-01-01T00:00:00Z");
+    invalid_test<seconds>("1970-00-01T00:00:00Z");
+    invalid_test<seconds>("1970-13-01T00:00:00Z");
+    invalid_test<seconds>("1970-01-00T00:00:00Z");
+    invalid_test<seconds>("1970-01-32T00:00:00Z");
+    invalid_test<seconds>("1970-04-31T00:00:00Z");
+    invalid_test<seconds>("1900-02-29T00:00:00Z");
+    invalid_test<seconds>("1970-01-01T24:00:00Z");
+    invalid_test<seconds>("1970-01-01T00:60:00Z");
+    invalid_test<seconds>("1970-01-01T00:00:60Z");
+    invalid_test<seconds>("1970-01-01T00:00:00.Z");
+    invalid_test<seconds>("1970-01-01T00:00:00+0100");
+    invalid_test<seconds>("1970-01-01T00:00:00+24:00");
+
+    // Nanoseconds in 64 bits end in 2262
+    invalid_test<nanoseconds>("2263-01-01T00:00:00Z", std::errc::result_out_of_range);
+    invalid_test<nanoseconds>("1677-01-01T00:00:00Z", std::errc::result_out_of_range);
+
+    // The first character after the timestamp is not consumed
+    const std::string with_suffix = "1970-01-01T00:00:01Z,next";
+    sys_time<seconds> value {};
+    const auto r = boost::charconv::from_chars(with_suffix.data(), with_suffix.data() + with_suffix.size(), value);
+    BOOST_TEST(r && r.ptr == with_suffix.data() + 20 && value.time_since_epoch().count() == 1);
+}
+
+void out_of_range()
+{
+    using std::chrono::seconds;
+    using std::chrono::hours;
+
+    char buffer[64];
+    const sys_time<seconds> before {seconds(min_seconds - 1)};
+    BOOST_TEST(boost::charconv::to_chars(buffer, buffer + sizeof(buffer), before).ec == std::errc::value_too_large);
+    const sys_time<seconds> after {seconds(max_seconds + 1)};
+    BOOST_TEST(boost::charconv::to_chars(buffer, buffer + sizeof(buffer), after).ec == std::errc::value_too_large);
+    const sys_time<hours> far {hours(INT64_MAX / 100)};
+    BOOST_TEST(boost::charconv::to_chars(buffer, buffer + sizeof(buffer), far).ec == std::errc::value_too_large);
+    BOOST_TEST(boost::charconv::to_chars(buffer, buffer + sizeof(buffer), far, timestamp_format::epoch_nanoseconds).ec == std::errc::value_too_large);
+
+    // Exactly the length of the timestamp, and one short of it, without writing past the end
+    const sys_time<std::chrono::milliseconds> value {std::chrono::milliseconds(1234)};
+    std::memset(buffer, 'x', sizeof(buffer));
+    auto r = boost::charconv::to_chars(buffer, buffer + 24, value);
+    BOOST_TEST(r && r.ptr == buffer + 24 && buffer[24] == 'x');
+    r = boost::charconv::to_chars(buffer, buffer + 23, value);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+}
+
+void durations()
+{
+    char buffer[64] {};
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), std::chrono::milliseconds(-42));
+    BOOST_TEST(r && std::string(buffer, r.ptr) == "-42000000");
+
+    std::chrono::microseconds us {};
+    const std::string str = "1999";
+    const auto fr = boost::charconv::from_chars(str.data(), str.data() + str.size(), us);
+    BOOST_TEST(fr && us.count() == 1);
+
+    std::chrono::seconds s {};
+    BOOST_TEST(boost::charconv::from_chars(boost::core::string_view("-1"), s) && s.count() == -1);
+    BOOST_TEST(boost::charconv::from_chars(boost::core::string_view("x"), s).ec == std::errc::invalid_argument);
+
+    // Picoseconds of 64 bits do not hold every nanosecond count
+    std::chrono::duration<std::int64_t, std::pico> ps {};
+    BOOST_TEST(boost::charconv::from_chars(boost::core::string_view("9223372036854775807"), ps).ec == std::errc::result_out_of_range);
+    BOOST_TEST(boost::charconv::from_chars(boost::core::string_view("-3"), ps) && ps.count() == -3000);
+}
+
+// Every timestamp from the year 0 to 9999 is read back as written, as is its number of nanoseconds where it fits
+template <typename Duration>
+void roundtrip_test()
+{
+    using traits = boost::charconv::detail::chrono_duration_traits<typename Duration::rep, typename Duration::period>;
+    std::uniform_int_distribution<std::int64_t> dist((std::max)(min_seconds, traits::min_ticks / traits::ticks_per_second + 1),
+                                                     (std::min)(max_seconds, traits::max_ticks / traits::ticks_per_second - 1));
+    std::uniform_int_distribution<std::int64_t> fraction(0, traits::ticks_per_second - 1);
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const std::int64_t seconds = dist(rng);
+        const std::int64_t ticks = seconds * traits::ticks_per_second + fraction(rng);
+
+        const sys_time<Duration> value {Duration(ticks)};
+        const auto str = format(value);
+        parse_test<Duration>(str, ticks);
+
+        // Every field against the civil date of the seconds
+        const auto date = boost::charconv::detail::civil_from_days(boost::charconv::detail::floor_div(seconds, 86400));
+        BOOST_TEST_EQ(std::stoi(str.substr(0, 4)), date.year);
+        BOOST_TEST_EQ(static_cast<unsigned>(std::stoi(str.substr(5, 2))), date.month);
+        BOOST_TEST_EQ(static_cast<unsigned>(std::stoi(str.substr(8, 2))), date.day);
+
+        std::int64_t nanoseconds {};
+        if (boost::charconv::detail::ticks_to_nanoseconds<typename Duration::rep, typename Duration::period>(ticks, nanoseconds))
+        {
+            const auto epoch = format(value, timestamp_format::epoch_nanoseconds);
+            sys_time<Duration> parsed {};
+            const auto r = boost::charconv::from_chars(epoch.data(), epoch.data() + epoch.size(), parsed, timestamp_format::epoch_nanoseconds);
+            BOOST_TEST(r && parsed == value);
+        }
+    }
+}
+
+int main()
+{
+    known_values();
+    out_of_range();
+    durations();
+
+    roundtrip_test<std::chrono::seconds>();
+    roundtrip_test<std::chrono::milliseconds>();
+    roundtrip_test<std::chrono::microseconds>();
+    roundtrip_test<std::chrono::nanoseconds>();
+
+    return boost::report_errors();
+}
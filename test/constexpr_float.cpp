@@ -0,0 +1,234 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/constexpr_float.hpp>
+
+#ifdef BOOST_CHARCONV_HAS_CONSTEXPR_FLOAT
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <limits>
+#include <iomanip>
+#include <iostream>
+#include <array>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+
+constexpr char table_text[] = "1 2.5 1e-05 0.1 1e+23";
+
+// A table parsed at compile time
+constexpr std::array<double, 5> parse_table()
+{
+    std::array<double, 5> table {};
+    const char* first = table_text;
+    const char* last = table_text + sizeof(table_text) - 1;
+    for (auto& value : table)
+    {
+        first = boost::charconv::from_chars_constexpr(first, last, value).ptr + 1;
+    }
+
+    return table;
+}
+
+constexpr auto table = parse_table();
+static_assert(table[0] == 1 && table[1] == 2.5 && table[2] == 1e-5 && table[3] == 0.1 && table[4] == 1e23, "Wrong table");
+
+template <typename T>
+constexpr bool prints(T value, const char* expected, chars_format fmt = chars_format::general)
+{
+    char buffer[64] {};
+    const auto r = boost::charconv::to_chars_constexpr(buffer, buffer + sizeof(buffer), value, fmt);
+    if (!r)
+    {
+        return false;
+    }
+
+    for (const char* c = buffer; c != r.ptr; ++c, ++expected)
+    {
+        if (*c != *expected)
+        {
+            return false;
+        }
+    }
+
+    return *expected == '\0';
+}
+
+template <typename T>
+constexpr bool parses(const char* str, T expected, chars_format fmt = chars_format::general)
+{
+    const char* last = str;
+    while (*last != '\0')
+    {
+        ++last;
+    }
+
+    T value {};
+    const auto r = boost::charconv::from_chars_constexpr(str, last, value, fmt);
+    return r && r.ptr == last && value == expected;
+}
+
+static_assert(prints(1.0, "1"), "1");
+static_assert(prints(0.1, "1e-01"), "0.1");
+static_assert(prints(0.3, "3e-01"), "0.3");
+static_assert(prints(1234.5, "1234.5"), "1234.5");
+static_assert(prints(-1234.5, "-1234.5"), "-1234.5");
+static_assert(prints(1e15, "1000000000000000"), "1e15");
+static_assert(prints(1e17, "100000000000000000"), "1e17");
+static_assert(prints(1e23, "1e+23"), "1e23");
+static_assert(prints(0.000125, "0.000125", chars_format::fixed), "0.000125 fixed");
+static_assert(prints(-1e23, "-100000000000000000000000", chars_format::fixed), "-1e23 fixed");
+static_assert(prints(1234.5, "1.2345e+03", chars_format::scientific), "1234.5 scientific");
+static_assert(prints(1.0, "1e+00", chars_format::scientific), "1 scientific");
+static_assert(prints(5e-324, "5e-324"), "Smallest subnormal");
+static_assert(prints((std::numeric_limits<double>::max)(), "1.7976931348623157e+308"), "Max");
+static_assert(prints(0.0, "0"), "Zero");
+static_assert(prints(-0.0, "-0"), "Negative zero");
+static_assert(prints(0.0, "0e+00", chars_format::scientific), "Zero scientific");
+static_assert(prints(std::numeric_limits<double>::infinity(), "inf"), "Infinity");
+static_assert(prints(-std::numeric_limits<double>::infinity(), "-inf"), "Negative infinity");
+static_assert(prints(std::numeric_limits<double>::quiet_NaN(), "nan"), "NaN");
+static_assert(prints(1.0, "1.p+0", chars_format::hex), "1 hex");
+static_assert(prints(0.1, "1.999999999999ap-4", chars_format::hex), "0.1 hex");
+static_assert(prints(5e-324, "0.0000000000001p-1022", chars_format::hex), "Subnormal hex");
+static_assert(prints(-0.0, "-0p+0", chars_format::hex), "Negative zero hex");
+static_assert(prints(-5e-324, "-0.0000000000001p-1022", chars_format::hex), "Negative subnormal hex");
+
+static_assert(prints(0.1F, "1e-01"), "0.1f");
+static_assert(prints(3.14159F, "3.14159"), "3.14159f");
+static_assert(prints(16777216.0F, "16777216"), "2^24");
+static_assert(prints(0.1F, "1.99999ap-4", chars_format::hex), "0.1f hex");
+static_assert(prints(1e-45F, "1e-45"), "Smallest float subnormal");
+
+static_assert(parses("1e-05", 1e-5), "1e-05");
+static_assert(parses("2.2250738585072011e-308", 2.2250738585072011e-308), "Slow path");
+static_assert(parses("-0", -0.0), "-0");
+static_assert(parses("1.8p+3", 12.0, chars_format::hex), "Hex");
+static_assert(parses("0.0000000000001p-1022", 5e-324, chars_format::hex), "Hex subnormal");
+static_assert(parses("1.5", 1.5F), "1.5f");
+static_assert(parses("1.99999ap-4", 0.1F, chars_format::hex), "Hex float");
+static_assert(parses("inf", std::numeric_limits<double>::infinity(), chars_format::hex), "Hex infinity");
+
+constexpr double unchanged()
+{
+    double value = 42;
+    const char str[] = "1e400";
+    const auto r = boost::charconv::from_chars_constexpr(str, str + sizeof(str) - 1, value);
+    return r.ec == std::errc::result_out_of_range ? value : 0;
+}
+
+static_assert(unchanged() == 42, "The value must not be modified on error");
+
+constexpr bool small_buffer()
+{
+    char buffer[4] {};
+    return boost::charconv::to_chars_constexpr(buffer, buffer + sizeof(buffer), 1234.5).ec == std::errc::result_out_of_range &&
+           boost::charconv::to_chars_constexpr(buffer, buffer, 1.0).ec == std::errc::result_out_of_range;
+}
+
+static_assert(small_buffer(), "Small buffer");
+
+static std::mt19937_64 rng(42);
+
+// The constant evaluated implementation has to give the same result as the library for every value, format and buffer size,
+// and neither of them may write past the end of the buffer
+template <typename T, typename Unsigned_Integer>
+void test_same_output(Unsigned_Integer bits)
+{
+    T value;
+    std::memcpy(&value, &bits, sizeof(value));
+
+    for (const auto fmt : {chars_format::general, chars_format::scientific, chars_format::fixed, chars_format::hex})
+    {
+        for (std::ptrdiff_t size = 0; size <= 32; ++size)
+        {
+            char expected[64];
+            char buffer[64];
+            std::memset(expected, 'x', sizeof(expected));
+            std::memset(buffer, 'x', sizeof(buffer));
+            const auto r1 = boost::charconv::to_chars(expected, expected + size, value, fmt);
+            const auto r2 = boost::charconv::detail::constexpr_float::to_chars_shortest(buffer, buffer + size, value, fmt);
+            const std::string untouched(sizeof(expected) - static_cast<std::size_t>(size), 'x');
+
+            const bool expected_in_bounds = BOOST_TEST_EQ(std::string(expected + size, expected + sizeof(expected)), untouched);
+            const bool buffer_in_bounds = BOOST_TEST_EQ(std::string(buffer + size, buffer + sizeof(buffer)), untouched);
+
+            if (!expected_in_bounds || !buffer_in_bounds || !BOOST_TEST(r1.ec == r2.ec) ||
+                (r1 && !BOOST_TEST_EQ(std::string(expected, r1.ptr), std::string(buffer, r2.ptr))))
+            {
+                // LCOV_EXCL_START
+                std::cerr << std::setprecision(std::numeric_limits<T>::max_digits10) << "Value: " << value
+                          << "\nFormat: " << static_cast<int>(fmt) << "\nBuffer size: " << size << std::endl;
+                // LCOV_EXCL_STOP
+            }
+        }
+    }
+}
+
+template <typename T, typename Unsigned_Integer>
+void test_random()
+{
+    std::uniform_int_distribution<Unsigned_Integer> bits_dist(0, (std::numeric_limits<Unsigned_Integer>::max)());
+    for (int i = 0; i < 20000; ++i)
+    {
+        test_same_output<T>(bits_dist(rng));
+    }
+
+    // Values in the fixed and integer ranges
+    std::uniform_real_distribution<T> value_dist(1, std::is_same<T, float>::value ? static_cast<T>(1e10) : static_cast<T>(1e20));
+    for (int i = 0; i < 20000; ++i)
+    {
+        const T value = value_dist(rng);
+        Unsigned_Integer bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        test_same_output<T>(bits);
+    }
+
+    for (const T value : {T(0), -T(0), T(1), T(10), T(1e7), T(1e15), T(1e16), T(4294967296.0),
+                          std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+                          std::numeric_limits<T>::quiet_NaN(), -std::numeric_limits<T>::quiet_NaN(),
+                          std::numeric_limits<T>::signaling_NaN(), std::numeric_limits<T>::denorm_min(),
+                          (std::numeric_limits<T>::max)(), (std::numeric_limits<T>::min)()})
+    {
+        Unsigned_Integer bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        test_same_output<T>(bits);
+    }
+}
+
+void test_runtime_forwarding()
+{
+    char buffer[64];
+    auto r = boost::charconv::to_chars_constexpr(buffer, buffer + sizeof(buffer), 0.1);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1e-01");
+
+    double value = 0;
+    const char str[] = "1.8p+3";
+    const auto r2 = boost::charconv::from_chars_constexpr(str, str + sizeof(str) - 1, value, chars_format::hex);
+    BOOST_TEST(r2);
+    BOOST_TEST_EQ(value, 12.0);
+}
+
+int main()
+{
+    test_random<float, std::uint32_t>();
+    test_random<double, std::uint64_t>();
+    test_runtime_forwarding();
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,151 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The kernels selected at run time must agree with a scan one character at a time
+
+#include <boost/charconv.hpp>
+#include <boost/charconv/detail/cpu_features.hpp>
+#include <boost/charconv/detail/parser.hpp>
+#include <boost/charconv/detail/to_chars_half.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+
+static bool is_digit(char c, bool hex)
+{
+    return (c >= '0' && c <= '9') || (hex && ((c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F')));
+}
+
+void test_skip_long_digit_run()
+{
+    const char terminators[] = {'.', 'e', 'p', 'g', 'G', '/', ':', '@', '`', '\0', ' ', '\x80', '\xB0', '\xFF'};
+    const std::string hex_digits = "0123456789abcdefABCDEF";
+
+    for (std::size_t len = 0; len <= 300; ++len)
+    {
+        for (const char terminator : terminators)
+        {
+            for (const bool hex : {false, true})
+            {
+                std::string str;
+                for (std::size_t i = 0; i < len; ++i)
+                {
+                    str.push_back(hex ? hex_digits[i % hex_digits.size()] : static_cast<char>('0' + i % 10));
+                }
+                str.push_back(terminator);
+                str.append(70, hex ? 'A' : '1');
+
+                const std::size_t end = is_digit(terminator, hex) ? str.size() : len;
+                const char* first = str.data();
+
+                // Never past the end of the run, and only over digits
+                const char* skipped = boost::charconv::detail::skip_long_digit_run(first, first + str.size(), hex);
+                BOOST_TEST(skipped >= first && skipped <= first + end);
+
+                // Where it stops, find_digit_run_end finds the rest
+                BOOST_TEST(boost::charconv::detail::find_digit_run_end(skipped, first + str.size(), hex) == first + end);
+                BOOST_TEST(boost::charconv::detail::find_digit_run_end(first, first + str.size(), hex) == first + end);
+
+                // A run that reaches last
+                skipped = boost::charconv::detail::skip_long_digit_run(first, first + len, hex);
+                BOOST_TEST(skipped >= first && skipped <= first + len);
+                BOOST_TEST(boost::charconv::detail::find_digit_run_end(first, first + len, hex) == first + len);
+            }
+        }
+    }
+}
+
+// Long significands through the parser of the library, which is where the kernels are used
+void test_long_significands()
+{
+    for (std::size_t len = 1; len <= 1200; len += 7)
+    {
+        std::string str = "1";
+        str.append(len, '0');
+        str += ".5e-";
+        str += std::to_string(len);
+        str += "x";
+
+        double value {};
+        const auto r = boost::charconv::from_chars(str.data(), str.data() + str.size(), value);
+        BOOST_TEST(r.ec == std::errc());
+        BOOST_TEST(r.ptr == str.data() + str.size() - 1);
+        BOOST_TEST_EQ(value, std::strtod(str.c_str(), nullptr));
+
+        std::string hex = "1";
+        hex.append(len, 'A');
+        hex += "p-";
+        hex += std::to_string(4 * len);
+
+        const auto rh = boost::charconv::from_chars(hex.data(), hex.data() + hex.size(), value, boost::charconv::chars_format::hex);
+        BOOST_TEST(rh.ec == std::errc());
+        BOOST_TEST(rh.ptr == hex.data() + hex.size());
+        BOOST_TEST_EQ(value, std::strtod(("0x" + hex).c_str(), nullptr));
+    }
+}
+
+// Every binary16 bit pattern, with an infinity or NaN placed in every block at every offset
+void test_widen_binary16()
+{
+    std::vector<std::uint16_t> bits(65536);
+    for (std::size_t i = 0; i < bits.size(); ++i)
+    {
+        bits[i] = static_cast<std::uint16_t>(i * 40503U);
+    }
+
+    std::vector<float> widened(bits.size());
+    std::size_t i = 0;
+    while (i < bits.size())
+    {
+        const std::size_t done = boost::charconv::detail::widen_binary16_blocks(bits.data() + i, bits.size() - i, widened.data() + i);
+        BOOST_TEST_EQ(done % 8, 0U);
+        for (std::size_t j = i; j < i + done; ++j)
+        {
+            const float expected = boost::charconv::detail::half_to_float(boost::charconv::detail::binary16_bits {bits[j]});
+            BOOST_TEST(std::memcmp(&widened[j], &expected, sizeof(float)) == 0);
+            BOOST_TEST((bits[j] & 0x7C00U) != 0x7C00U);
+        }
+
+        // With F16C it stops at a block holding an infinity or NaN, or one too short, and without it at once
+        i += done;
+        if (i < bits.size() && boost::charconv::detail::host_cpu_features().f16c)
+        {
+            bool special = bits.size() - i < 8;
+            for (std::size_t j = i; j < bits.size() && j < i + 8; ++j)
+            {
+                special = special || (bits[j] & 0x7C00U) == 0x7C00U;
+            }
+            BOOST_TEST(special);
+        }
+        ++i;
+    }
+
+    // The batch overload of half_to_float widens every value exactly
+    boost::charconv::detail::half_to_float(bits.data(), bits.size(), widened.data(), boost::charconv::detail::binary16_bits {});
+    for (std::size_t j = 0; j < bits.size(); ++j)
+    {
+        const float expected = boost::charconv::detail::half_to_float(boost::charconv::detail::binary16_bits {bits[j]});
+        BOOST_TEST(std::memcmp(&widened[j], &expected, sizeof(float)) == 0);
+    }
+}
+
+int main()
+{
+    const auto features = boost::charconv::detail::host_cpu_features();
+    std::cerr << "AVX2: " << features.avx2 << ", AVX-512BW: " << features.avx512bw << ", F16C: " << features.f16c << std::endl;
+
+    #if defined(BOOST_CHARCONV_HAS_RUNTIME_DISPATCH) && defined(__GNUC__)
+    BOOST_TEST_EQ(features.avx2, __builtin_cpu_supports("avx2") != 0);
+    BOOST_TEST_EQ(features.f16c, __builtin_cpu_supports("f16c") != 0);
+    #endif
+
+    test_skip_long_digit_run();
+    test_long_significands();
+    test_widen_binary16();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,265 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/decimal.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <string>
+#include <limits>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::decimal_rounding;
+
+static std::mt19937_64 rng(42);
+
+template <typename T>
+void test_valid(const std::string& str, int scale, T expected, decimal_rounding rounding = decimal_rounding::reject)
+{
+    T mantissa = 42;
+    const auto r = boost::charconv::from_chars_decimal(str.data(), str.data() + str.size(), mantissa, scale, rounding);
+    if (!BOOST_TEST(r) || !BOOST_TEST(r.ptr == str.data() + str.size()) || !BOOST_TEST(mantissa == expected))
+    {
+        std::cerr << "Input: " << str << "\nScale: " << scale << std::endl; // LCOV_EXCL_LINE
+    }
+
+    T sv_mantissa = 42;
+    const auto sv_r = boost::charconv::from_chars_decimal(boost::core::string_view(str), sv_mantissa, scale, rounding);
+    BOOST_TEST(sv_r.ptr == r.ptr);
+    BOOST_TEST(sv_mantissa == mantissa);
+}
+
+template <typename T>
+void test_error(const std::string& str, int scale, std::errc ec, std::size_t expected_length, decimal_rounding rounding = decimal_rounding::reject)
+{
+    T mantissa = 42;
+    const auto r = boost::charconv::from_chars_decimal(str.data(), str.data() + str.size(), mantissa, scale, rounding);
+    if (!BOOST_TEST(r.ec == ec) || !BOOST_TEST_EQ(r.ptr - str.data(), static_cast<std::ptrdiff_t>(expected_length)))
+    {
+        std::cerr << "Input: " << str << "\nScale: " << scale << std::endl; // LCOV_EXCL_LINE
+    }
+    if (ec != std::errc())
+    {
+        BOOST_TEST(mantissa == 42);
+    }
+}
+
+template <typename T>
+void test_parse()
+{
+    test_valid<T>("12345.6789", 4, 123456789);
+    test_valid<T>("12345.6789", 6, 12345678900);
+    test_valid<T>("-12345.6789", 4, -123456789);
+    test_valid<T>("12345", 2, 1234500);
+    test_valid<T>("12345.00", 0, 12345);
+    test_valid<T>("1.5e3", 0, 1500);
+    test_valid<T>("1.5e-3", 4, 15);
+    test_valid<T>("-0.00001", 5, -1);
+    test_valid<T>(".25", 2, 25);
+    test_valid<T>("12300", -2, 123);
+    test_valid<T>("0", 10, 0);
+    test_valid<T>("-0.000", 2, 0);
+    test_valid<T>("0e999999", 2, 0);
+
+    // Trailing zeros past the scale are exact, even past the digits the parser keeps
+    test_valid<T>("1.50000000000000000000000000000000000000000000000000", 1, 15);
+    test_valid<T>("1234567890123456789000000000000000000000000", -24, 1234567890123456789);
+
+    // Excess digits
+    test_error<T>("1.239", 2, std::errc::result_out_of_range, 5);
+    test_error<T>("1.2300000000000000000000000000000000000000001", 2, std::errc::result_out_of_range, 45);
+    test_error<T>("0.001", 2, std::errc::result_out_of_range, 5);
+    test_error<T>("5", -1, std::errc::result_out_of_range, 1);
+    test_error<T>("1e-100", 2, std::errc::result_out_of_range, 6);
+    test_valid<T>("1.239", 2, 123, decimal_rounding::toward_zero);
+    test_valid<T>("-1.239", 2, -123, decimal_rounding::toward_zero);
+    test_valid<T>("1.239", 2, 124, decimal_rounding::to_nearest);
+    test_valid<T>("-1.239", 2, -124, decimal_rounding::to_nearest);
+    test_valid<T>("1.235", 2, 124, decimal_rounding::to_nearest);
+    test_valid<T>("-1.235", 2, -124, decimal_rounding::to_nearest);
+    test_valid<T>("1.2349999999999999999999999999", 2, 123, decimal_rounding::to_nearest);
+    test_valid<T>("0.004", 2, 0, decimal_rounding::to_nearest);
+    test_valid<T>("0.005", 2, 1, decimal_rounding::to_nearest);
+    test_valid<T>("1e-100", 2, 0, decimal_rounding::to_nearest);
+
+    // The number ends where chars_format::general does
+    test_error<T>("1.5,", 1, std::errc(), 3);
+    test_error<T>("0,5", 1, std::errc(), 1);
+    test_error<T>("0.000;", 1, std::errc(), 5);
+    test_error<T>("1.2.3", 1, std::errc(), 3);
+    test_error<T>("5e", 0, std::errc(), 1);
+    test_error<T>("5e+", 0, std::errc(), 1);
+    test_error<T>("5E-x", 0, std::errc(), 1);
+    test_error<T>("0e", 0, std::errc(), 1);
+    test_error<T>("0e5,", 0, std::errc(), 3);
+    test_error<T>("0.00e-5,", 0, std::errc(), 7);
+
+    // Not decimal numbers
+    for (const auto str : {"", "-", "+1", "-+1", ".", "-.", ".e5", "e5", "x", "inf", "-infinity", "nan", "nan(snan)"})
+    {
+        test_error<T>(str, 2, std::errc::invalid_argument, 0);
+    }
+
+    // Overflow
+    const T max = (std::numeric_limits<T>::max)();
+    const T min = (std::numeric_limits<T>::min)();
+    char buffer[64];
+    auto to_r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), max);
+    const std::string max_str(buffer, to_r.ptr);
+    to_r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), min);
+    const std::string min_str(buffer, to_r.ptr);
+
+    test_valid<T>(max_str, 0, max);
+    test_valid<T>(min_str, 0, min);
+    test_valid<T>(max_str.substr(0, max_str.size() - 1) + "." + max_str.back(), 1, max);
+    test_valid<T>(min_str.substr(0, min_str.size() - 1) + "." + min_str.back(), 1, min);
+    test_error<T>(max_str, 1, std::errc::result_out_of_range, max_str.size());
+    test_error<T>(min_str, 1, std::errc::result_out_of_range, min_str.size());
+    test_error<T>(max_str + ".5", 0, std::errc::result_out_of_range, max_str.size() + 2, decimal_rounding::to_nearest);
+    test_error<T>(min_str + ".5", 0, std::errc::result_out_of_range, min_str.size() + 2, decimal_rounding::to_nearest);
+    test_valid<T>(max_str + ".5", 0, max, decimal_rounding::toward_zero);
+    test_valid<T>(min_str + ".5", 0, min, decimal_rounding::toward_zero);
+    test_error<T>("1e100", 0, std::errc::result_out_of_range, 5);
+    test_error<T>("1", 100, std::errc::result_out_of_range, 1);
+    test_error<T>(std::string(100, '9'), 0, std::errc::result_out_of_range, 100);
+
+    // Large magnitude negative scales
+    test_valid<T>("1e30", -30, 1);
+    test_valid<T>("2.5", (std::numeric_limits<int>::min)() + 1, 0, decimal_rounding::to_nearest);
+    test_error<T>("2.5", (std::numeric_limits<int>::max)(), std::errc::result_out_of_range, 3);
+}
+
+template <typename T>
+void test_format(T mantissa, int scale, int min_frac_digits, const std::string& expected)
+{
+    char buffer[128];
+    const auto r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), mantissa, scale, min_frac_digits);
+    if (!BOOST_TEST(r) || !BOOST_TEST_EQ(std::string(buffer, r.ptr), expected))
+    {
+        std::cerr << "Scale: " << scale << "\nMinimum fraction digits: " << min_frac_digits << std::endl; // LCOV_EXCL_LINE
+    }
+
+    // Exactly enough room, and one less
+    const auto length = static_cast<std::ptrdiff_t>(expected.size());
+    BOOST_TEST(boost::charconv::to_chars_decimal(buffer, buffer + length, mantissa, scale, min_frac_digits));
+    const auto small_r = boost::charconv::to_chars_decimal(buffer, buffer + length - 1, mantissa, scale, min_frac_digits);
+    BOOST_TEST(small_r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(small_r.ptr == buffer + length - 1);
+}
+
+template <typename T>
+void test_to_chars()
+{
+    test_format<T>(123456789, 4, 0, "12345.6789");
+    test_format<T>(-123456789, 4, 0, "-12345.6789");
+    test_format<T>(150, 2, 0, "1.5");
+    test_format<T>(150, 2, 2, "1.50");
+    test_format<T>(150, 2, 4, "1.5000");
+    test_format<T>(100, 2, 0, "1");
+    test_format<T>(100, 2, 1, "1.0");
+    test_format<T>(5, 3, 0, "0.005");
+    test_format<T>(-5, 3, 0, "-0.005");
+    test_format<T>(50, 3, 0, "0.05");
+    test_format<T>(0, 2, 0, "0");
+    test_format<T>(0, 2, 2, "0.00");
+    test_format<T>(0, -3, 0, "0");
+    test_format<T>(123, 0, 0, "123");
+    test_format<T>(123, 0, 2, "123.00");
+    test_format<T>(123, -2, 0, "12300");
+    test_format<T>(-123, -2, 1, "-12300.0");
+    test_format<T>(1, 40, 0, "0.0000000000000000000000000000000000000001");
+    test_format<T>((std::numeric_limits<T>::min)(), 5, 0, boost::charconv::limits<T>::max_chars10 > 20 ?
+                   "-1701411834604692317316873037158841.05728" : "-92233720368547.75808");
+
+    char buffer[16];
+    auto r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), T(1), 1, -1);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), T(1), (std::numeric_limits<int>::min)(), 0);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), T(1), 0, (std::numeric_limits<int>::max)());
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+}
+
+// Literals and the other integer types pick the same formatter, also where __int128 exists
+void test_to_chars_types()
+{
+    char buffer[64];
+    auto r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), 150, 2);
+    BOOST_TEST(r && std::string(buffer, r.ptr) == "1.5");
+    r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), -5LL, 3);
+    BOOST_TEST(r && std::string(buffer, r.ptr) == "-0.005");
+    r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), static_cast<short>(-1234), 2, 3);
+    BOOST_TEST(r && std::string(buffer, r.ptr) == "-12.340");
+    r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), 150U, 2, 2);
+    BOOST_TEST(r && std::string(buffer, r.ptr) == "1.50");
+    r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), UINT64_MAX, 4);
+    BOOST_TEST(r && std::string(buffer, r.ptr) == "1844674407370955.1615");
+    r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), (std::numeric_limits<int>::min)(), 0);
+    BOOST_TEST(r && std::string(buffer, r.ptr) == "-2147483648");
+}
+
+// Random mantissas printed with the point at scale are what to_chars_decimal writes, and parse back to themselves
+void test_roundtrip()
+{
+    std::uniform_int_distribution<std::int64_t> dist((std::numeric_limits<std::int64_t>::min)(), (std::numeric_limits<std::int64_t>::max)());
+    std::uniform_int_distribution<int> scale_dist(0, 25);
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        const std::int64_t value = dist(rng) >> (i % 64);
+        const int scale = scale_dist(rng);
+
+        char buffer[64];
+        const auto to_r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value);
+        std::string digits(buffer, to_r.ptr);
+        const bool negative = digits.front() == '-';
+        if (negative)
+        {
+            digits.erase(0, 1);
+        }
+        if (digits.size() <= static_cast<std::size_t>(scale))
+        {
+            digits.insert(0, static_cast<std::size_t>(scale) - digits.size() + 1, '0');
+        }
+        if (scale > 0)
+        {
+            digits.insert(digits.size() - static_cast<std::size_t>(scale), 1, '.');
+        }
+        if (negative)
+        {
+            digits.insert(0, 1, '-');
+        }
+
+        char decimal[64];
+        const auto decimal_r = boost::charconv::to_chars_decimal(decimal, decimal + sizeof(decimal), value, scale, scale);
+        BOOST_TEST(decimal_r);
+        BOOST_TEST_EQ(std::string(decimal, decimal_r.ptr), digits);
+
+        test_valid<std::int64_t>(digits, scale, value);
+        test_valid<std::int64_t>(digits + (scale > 0 ? "00" : ".00"), scale, value);
+        test_valid<std::int64_t>(digits + "e0", scale, value);
+    }
+}
+
+int main()
+{
+    test_parse<std::int64_t>();
+    test_to_chars<std::int64_t>();
+    test_to_chars_types();
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    test_parse<boost::int128_type>();
+    test_to_chars<boost::int128_type>();
+
+    // A mantissa that needs more than 64 bits
+    test_valid<boost::int128_type>("12345678901234567890.123456789", 9, static_cast<boost::int128_type>(UINT64_C(12345678901234567890)) * 1000000000 + 123456789);
+    #endif
+
+    test_roundtrip();
+
+    return boost::report_errors();
+}
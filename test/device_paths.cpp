@@ -0,0 +1,144 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// The integer conversions compiled the way device code is (no SIMD, no host tables) must give the same results as the host
+
+#ifndef BOOST_CHARCONV_HEADER_ONLY
+#  define BOOST_CHARCONV_HEADER_ONLY
+#endif
+#ifndef BOOST_CHARCONV_DEVICE_COMPILE
+#  define BOOST_CHARCONV_DEVICE_COMPILE
+#endif
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <type_traits>
+#include <random>
+#include <string>
+#include <limits>
+#include <cstdint>
+
+#if defined(BOOST_CHARCONV_HAS_SSE2) || defined(BOOST_CHARCONV_HAS_NEON) || defined(BOOST_CHARCONV_HAS_RUNTIME_DISPATCH)
+#  error "Device code has no SIMD paths"
+#endif
+
+static std::mt19937_64 rng(42);
+
+// Digits one at a time from the end, independent of every table and SWAR path
+template <typename T>
+std::string reference_to_chars(T value, int base)
+{
+    using Unsigned = typename std::make_unsigned<T>::type;
+
+    auto unsigned_value = static_cast<Unsigned>(value);
+    if (value < 0)
+    {
+        unsigned_value = static_cast<Unsigned>(0U - unsigned_value);
+    }
+
+    std::string digits;
+    do
+    {
+        digits.insert(digits.begin(), "0123456789abcdefghijklmnopqrstuvwxyz"[unsigned_value % static_cast<Unsigned>(base)]);
+        unsigned_value = static_cast<Unsigned>(unsigned_value / static_cast<Unsigned>(base));
+    } while (unsigned_value != 0);
+
+    return value < 0 ? "-" + digits : digits;
+}
+
+template <typename T>
+void test_value(T value)
+{
+    char buffer[128];
+    for (int base = 2; base <= 36; ++base)
+    {
+        const std::string expected = reference_to_chars(value, base);
+
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, base);
+        BOOST_TEST(r);
+        BOOST_TEST_EQ(std::string(buffer, r.ptr), expected);
+        BOOST_TEST_EQ(boost::charconv::to_chars_length(value, base), expected.size());
+
+        T parsed {};
+        const auto r2 = boost::charconv::from_chars(buffer, r.ptr, parsed, base);
+        BOOST_TEST(r2 && r2.ptr == r.ptr);
+        BOOST_TEST_EQ(parsed, value);
+
+        // Upper case letters read back the same through the computed digit values
+        std::string upper = expected;
+        for (auto& c : upper)
+        {
+            c = c >= 'a' && c <= 'z' ? static_cast<char>(c - 'a' + 'A') : c;
+        }
+        parsed = T {};
+        BOOST_TEST(boost::charconv::from_chars(upper.data(), upper.data() + upper.size(), parsed, base));
+        BOOST_TEST_EQ(parsed, value);
+    }
+
+    // Base 16 through the SWAR word path, with 20 digits so that there are zeros in front
+    std::string expected = reference_to_chars(value, 16);
+    const bool is_negative = expected[0] == '-';
+    expected = std::string(is_negative ? "-" : "") + std::string(20 - (expected.size() - is_negative), '0') + expected.substr(is_negative);
+
+    const auto r = boost::charconv::to_chars_hex(buffer, buffer + sizeof(buffer), value, 20);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), expected);
+}
+
+template <typename T>
+void test_type()
+{
+    using Unsigned = typename std::make_unsigned<T>::type;
+    constexpr int bits = std::numeric_limits<Unsigned>::digits;
+
+    test_value(T(0));
+    test_value((std::numeric_limits<T>::max)());
+    test_value((std::numeric_limits<T>::min)());
+
+    for (int width = 1; width <= bits; ++width)
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            test_value(static_cast<T>(static_cast<Unsigned>(rng() >> (64 - width))));
+        }
+    }
+}
+
+void test_invalid_characters()
+{
+    // Every character that is not a digit in base 36 stops the parse
+    for (int c = 0; c < 256; ++c)
+    {
+        const char str[] = {static_cast<char>(c), '1'};
+        const bool is_digit = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+
+        int value = -1;
+        const auto r = boost::charconv::from_chars(str, str + sizeof(str), value, 36);
+        if (is_digit)
+        {
+            BOOST_TEST(r && r.ptr == str + 2);
+        }
+        else if (c != '-')
+        {
+            BOOST_TEST(r.ec == std::errc::invalid_argument);
+        }
+    }
+}
+
+int main()
+{
+    test_type<signed char>();
+    test_type<unsigned char>();
+    test_type<short>();
+    test_type<unsigned short>();
+    test_type<int>();
+    test_type<unsigned>();
+    test_type<long>();
+    test_type<unsigned long>();
+    test_type<long long>();
+    test_type<unsigned long long>();
+
+    test_invalid_characters();
+
+    return boost::report_errors();
+}
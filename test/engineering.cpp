@@ -0,0 +1,233 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <limits>
+#include <iomanip>
+#include <iostream>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+
+static std::mt19937_64 rng(42);
+
+// Moves the point of scientific notation to the right until the exponent is a multiple of 3,
+// and replaces the exponent with its SI prefix when one is asked for and there is one
+std::string engineering_from_scientific(const std::string& scientific, bool si)
+{
+    const auto exponent_pos = scientific.find('e');
+    if (exponent_pos == std::string::npos)
+    {
+        return scientific;
+    }
+
+    const bool is_negative = scientific[0] == '-';
+    std::string digits;
+    for (std::size_t i = is_negative ? 1 : 0; i < exponent_pos; ++i)
+    {
+        if (scientific[i] != '.')
+        {
+            digits += scientific[i];
+        }
+    }
+
+    const int decimal_exponent = std::stoi(scientific.substr(exponent_pos + 1));
+    const int remainder = ((decimal_exponent % 3) + 3) % 3;
+    const int exponent = decimal_exponent - remainder;
+    const auto integer_digits = static_cast<std::size_t>(remainder + 1);
+    if (digits.size() < integer_digits)
+    {
+        digits.append(integer_digits - digits.size(), '0');
+    }
+
+    std::string result = is_negative ? "-" : "";
+    result += digits.substr(0, integer_digits);
+    if (digits.size() > integer_digits)
+    {
+        result += '.';
+        result += digits.substr(integer_digits);
+    }
+
+    static const char* const prefixes[] = {"q", "r", "y", "z", "a", "f", "p", "n", "\xC2\xB5", "m", "",
+                                           "k", "M", "G", "T", "P", "E", "Z", "Y", "R", "Q"};
+    if (si && exponent >= -30 && exponent <= 30)
+    {
+        return result + prefixes[(exponent + 30) / 3];
+    }
+
+    const int abs_exponent = exponent < 0 ? -exponent : exponent;
+    result += exponent < 0 ? "e-" : "e+";
+    if (abs_exponent < 10)
+    {
+        result += '0';
+    }
+    return result + std::to_string(abs_exponent);
+}
+
+template <typename T>
+std::string scientific_string(T value, int precision)
+{
+    char buffer[1024];
+    const auto r = precision < 0 ? boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, chars_format::scientific) :
+                                   boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, chars_format::scientific, precision);
+    BOOST_TEST(r);
+    return std::string(buffer, r.ptr);
+}
+
+template <typename T>
+void test_value(T value)
+{
+    for (const int precision : {-1, 0, 1, 2, 3, 5, 9, 17, 40})
+    {
+        const std::string scientific = scientific_string(value, precision);
+
+        char buffer[1024];
+        const auto r = precision < 0 ? boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, chars_format::engineering) :
+                                       boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, chars_format::engineering, precision);
+        BOOST_TEST(r);
+        if (!BOOST_TEST_EQ(std::string(buffer, r.ptr), engineering_from_scientific(scientific, false)))
+        {
+            // LCOV_EXCL_START
+            std::cerr << std::setprecision(std::numeric_limits<T>::max_digits10) << "Value: " << value
+                      << "\nPrecision: " << precision << std::endl;
+            // LCOV_EXCL_STOP
+        }
+
+        const auto length = r.ptr - buffer;
+        BOOST_TEST_EQ(boost::charconv::to_chars_length(value, chars_format::engineering, precision), static_cast<std::size_t>(length));
+
+        const auto shorter = boost::charconv::to_chars(buffer, buffer + length - 1, value, chars_format::engineering, precision);
+        BOOST_TEST(shorter.ec == std::errc::result_out_of_range);
+
+        const auto si = boost::charconv::to_chars_si(buffer, buffer + sizeof(buffer), value, precision);
+        BOOST_TEST(si);
+        BOOST_TEST_EQ(std::string(buffer, si.ptr), engineering_from_scientific(scientific, true));
+
+        const auto si_shorter = boost::charconv::to_chars_si(buffer, buffer + (si.ptr - buffer) - 1, value, precision);
+        BOOST_TEST(si_shorter.ec == std::errc::result_out_of_range);
+    }
+
+    // The shortest representation parses back to the same value
+    if (std::isfinite(value))
+    {
+        char buffer[64];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, chars_format::engineering);
+        T parsed {};
+        const auto pr = boost::charconv::from_chars(buffer, r.ptr, parsed, chars_format::engineering);
+        BOOST_TEST(pr && pr.ptr == r.ptr);
+        BOOST_TEST(std::signbit(parsed) == std::signbit(value));
+        BOOST_TEST(parsed == value);
+    }
+}
+
+template <typename T, typename Bits>
+void test_random_bits()
+{
+    for (int i = 0; i < 5000; ++i)
+    {
+        const auto bits = static_cast<Bits>(rng());
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+        test_value(value);
+    }
+}
+
+// Values around the SI prefixes, where the exponent changes
+template <typename T>
+void test_powers_of_ten()
+{
+    for (int exponent = std::numeric_limits<T>::min_exponent10; exponent < std::numeric_limits<T>::max_exponent10; ++exponent)
+    {
+        const auto power = static_cast<T>(std::pow(10.0, exponent));
+        test_value(power);
+        test_value(-power * T(4.7));
+        test_value(std::nextafter(power, T(0)));
+    }
+}
+
+template <typename T>
+void test_spot()
+{
+    for (const T value : {T(0), -T(0), T(1), T(-1), T(999.5), T(1000), T(0.001), T(123456),
+                          (std::numeric_limits<T>::max)(), (std::numeric_limits<T>::min)(), std::numeric_limits<T>::denorm_min(),
+                          std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::quiet_NaN()})
+    {
+        test_value(value);
+    }
+}
+
+template <typename T>
+std::string engineering(T value, int precision = -1)
+{
+    char buffer[64];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, chars_format::engineering, precision);
+    BOOST_TEST(r);
+    return std::string(buffer, r.ptr);
+}
+
+template <typename T>
+std::string si(T value, int precision = -1)
+{
+    char buffer[64];
+    const auto r = boost::charconv::to_chars_si(buffer, buffer + sizeof(buffer), value, precision);
+    BOOST_TEST(r);
+    return std::string(buffer, r.ptr);
+}
+
+int main()
+{
+    test_random_bits<double, std::uint64_t>();
+    test_random_bits<float, std::uint32_t>();
+    test_powers_of_ten<double>();
+    test_powers_of_ten<float>();
+    test_spot<double>();
+    test_spot<float>();
+
+    BOOST_TEST_EQ(engineering(12345.0), "12.345e+03");
+    BOOST_TEST_EQ(engineering(0.00047), "470e-06");
+    BOOST_TEST_EQ(engineering(-1e-300), "-1e-300");
+    BOOST_TEST_EQ(engineering(0.0), "0e+00");
+    BOOST_TEST_EQ(engineering(123.0, 0), "100e+00");
+    BOOST_TEST_EQ(engineering(1.0 / 3, 4), "333.33e-03");
+    BOOST_TEST_EQ(engineering(1e21f), "1e+21");
+
+    BOOST_TEST_EQ(si(4700.0), "4.7k");
+    BOOST_TEST_EQ(si(1.5e-6), "1.5\xC2\xB5");
+    BOOST_TEST_EQ(si(-0.25), "-250m");
+    BOOST_TEST_EQ(si(999.0), "999");
+    BOOST_TEST_EQ(si(1e30), "1Q");
+    BOOST_TEST_EQ(si(1e33), "1e+33");
+    BOOST_TEST_EQ(si(1e-31), "100e-33");
+    BOOST_TEST_EQ(si(2.0 / 3, 2), "667m");
+    BOOST_TEST_EQ(si(12.5e-9f, 3), "12.50n");
+
+    // The punctuation and the group separator, which never has more than three integer digits to separate
+    char buffer[64];
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 12345.5, chars_format::engineering, 5,
+                                       boost::charconv::chars_format_options(',', 'E', '\''));
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "12,3455E+03");
+
+    // Values with the standard conversion, and rounded in a direction
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 2.0 / 3, chars_format::engineering, 2, boost::charconv::rounding_mode::toward_zero);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "666e-03");
+    r = boost::charconv::to_chars(buffer, buffer, 1.0, chars_format::engineering);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    r = boost::charconv::to_chars_si(buffer, buffer, 1.0);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+
+    // Long double has its own shortest representation
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 12345.0L, chars_format::engineering);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "12.345e+03");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 0.0L, chars_format::engineering);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "0e+00");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), -1e-10L, chars_format::engineering, 3);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "-100.0e-12");
+
+    return boost::report_errors();
+}
@@ -0,0 +1,217 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <string>
+#include <limits>
+#include <type_traits>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+using boost::charconv::chars_format_options;
+
+static std::mt19937_64 rng(42);
+
+// The same string with the punctuation of options
+std::string punctuate(std::string str, chars_format_options options, chars_format fmt)
+{
+    for (auto& c : str)
+    {
+        if (c == '.')
+        {
+            c = options.decimal_point;
+        }
+        else if (c == 'e' && fmt != chars_format::hex)
+        {
+            c = options.exponent;
+        }
+    }
+    return str;
+}
+
+// Formatting with options writes what to_chars writes with the punctuation swapped, and parses back to the same value
+template <typename T, typename... Args>
+void test_value(T value, chars_format_options options, chars_format fmt, Args... args)
+{
+    char expected[1200];
+    const auto expected_r = boost::charconv::to_chars(expected, expected + sizeof(expected), value, fmt, args...);
+    BOOST_TEST(expected_r);
+    const std::string expected_str = punctuate(std::string(expected, expected_r.ptr), options, fmt);
+
+    char buffer[1200];
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt, args..., options);
+    BOOST_TEST(r);
+    const std::string str(buffer, r.ptr);
+    if (!BOOST_TEST_EQ(str, expected_str))
+    {
+        std::cerr << "Decimal point: " << options.decimal_point << "\nExponent: " << options.exponent << std::endl; // LCOV_EXCL_LINE
+    }
+
+    T roundtrip = T(42);
+    const auto from_r = boost::charconv::from_chars(str.data(), str.data() + str.size(), roundtrip, fmt, options);
+    T parsed = T(42);
+    const auto parsed_r = boost::charconv::from_chars(expected, expected_r.ptr, parsed, fmt);
+    BOOST_TEST(from_r.ec == parsed_r.ec);
+    BOOST_TEST_EQ(from_r.ptr - str.data(), parsed_r.ptr - expected);
+    BOOST_TEST(roundtrip == parsed || (roundtrip != roundtrip && parsed != parsed));
+
+    // Too small buffers fail the same way
+    const auto length = static_cast<std::ptrdiff_t>(str.size());
+    r = boost::charconv::to_chars(buffer, buffer + length - 1, value, fmt, args..., options);
+    BOOST_TEST(r.ec == boost::charconv::to_chars(expected, expected + length - 1, value, fmt, args...).ec);
+}
+
+template <typename T>
+void test_roundtrip()
+{
+    using bits_type = typename std::conditional<sizeof(T) == sizeof(std::uint64_t), std::uint64_t, std::uint32_t>::type;
+    std::uniform_int_distribution<std::uint64_t> bits_dist;
+
+    for (const auto options : {chars_format_options(), chars_format_options(','), chars_format_options(',', 'E'),
+                               chars_format_options('_', 'd'), chars_format_options('.', 'x')})
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            const auto bits = static_cast<bits_type>(bits_dist(rng));
+            T value;
+            std::memcpy(&value, &bits, sizeof(value));
+
+            for (const auto fmt : {chars_format::general, chars_format::scientific, chars_format::fixed, chars_format::hex})
+            {
+                test_value(value, options, fmt);
+                test_value(value, options, fmt, 0);
+                test_value(value, options, fmt, 3);
+                test_value(value, options, fmt, 17);
+            }
+        }
+
+        for (const T value : {T(0), -T(0), T(1), T(-1.5), T(0.1), T(123456), T(1e-5), T(1e10), T(1e20),
+                              (std::numeric_limits<T>::max)(), (std::numeric_limits<T>::min)(), std::numeric_limits<T>::denorm_min(),
+                              std::numeric_limits<T>::infinity(), std::numeric_limits<T>::quiet_NaN()})
+        {
+            for (const auto fmt : {chars_format::general, chars_format::scientific, chars_format::fixed, chars_format::hex})
+            {
+                test_value(value, options, fmt);
+                test_value(value, options, fmt, 0);
+                test_value(value, options, fmt, 6);
+                test_value(value, options, fmt, 50);
+            }
+        }
+    }
+}
+
+template <typename T>
+void test_parse(const std::string& str, chars_format_options options, chars_format fmt, T expected, std::size_t expected_length)
+{
+    T value = T(42);
+    const auto r = boost::charconv::from_chars(str.data(), str.data() + str.size(), value, fmt, options);
+    if (!BOOST_TEST(r) || !BOOST_TEST_EQ(r.ptr - str.data(), static_cast<std::ptrdiff_t>(expected_length)) || !BOOST_TEST_EQ(value, expected))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+
+    T sv_value = T(42);
+    const auto sv_r = boost::charconv::from_chars(boost::core::string_view(str), sv_value, fmt, options);
+    BOOST_TEST(sv_r.ptr == r.ptr);
+    BOOST_TEST_EQ(sv_value, value);
+}
+
+template <typename T>
+void test_from_chars()
+{
+    const chars_format_options comma(',');
+    test_parse<T>("1,5", comma, chars_format::general, T(1.5), 3);
+    test_parse<T>("-0,25e2", comma, chars_format::general, T(-25), 7);
+    test_parse<T>("1,5E-1", comma, chars_format::scientific, T(0.15), 6);
+    test_parse<T>("12,75", comma, chars_format::fixed, T(12.75), 5);
+    test_parse<T>("1,8p+1", comma, chars_format::hex, T(3), 6);
+
+    // The usual decimal point ends the number
+    test_parse<T>("1.5", comma, chars_format::general, T(1), 1);
+    test_parse<T>("1,5;2,5", comma, chars_format::general, T(1.5), 3);
+    test_parse<T>("1.8p+1", comma, chars_format::hex, T(1), 1);
+
+    // Letters are accepted as exponent character in either case, and nothing else starts the exponent
+    const chars_format_options fortran('.', 'd');
+    test_parse<T>("1.5d3", fortran, chars_format::general, T(1500), 5);
+    test_parse<T>("1.5D-3", fortran, chars_format::general, T(0.0015), 6);
+    test_parse<T>("1.5e3", fortran, chars_format::general, T(1.5), 3);
+    test_parse<T>("2^4", chars_format_options('.', '^'), chars_format::general, T(20000), 3);
+
+    // Non-finite values do not use either character
+    test_parse<T>("inf", comma, chars_format::general, std::numeric_limits<T>::infinity(), 3);
+    test_parse<T>("-inf", fortran, chars_format::general, -std::numeric_limits<T>::infinity(), 4);
+
+    // Out of range values keep the value
+    T value = T(42);
+    const std::string huge = "1d400";
+    auto r = boost::charconv::from_chars(huge.data(), huge.data() + huge.size(), value, chars_format::general, fortran);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(r.ptr == huge.data() + huge.size());
+    BOOST_TEST_EQ(value, T(42));
+
+    const std::string invalid = ",5";
+    r = boost::charconv::from_chars(invalid.data(), invalid.data() + invalid.size(), value, chars_format::general, chars_format_options());
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(value, T(42));
+}
+
+// Options that could be read as part of a number are rejected by both directions
+template <typename T>
+void test_invalid_options()
+{
+    const std::string str = "1.5";
+    for (const auto options : {chars_format_options('5'), chars_format_options('+'), chars_format_options('-'), chars_format_options('a'),
+                               chars_format_options('P'), chars_format_options(',', ','), chars_format_options('.', '1'),
+                               chars_format_options('.', '-'), chars_format_options('x', 'X')})
+    {
+        T value = T(42);
+        const auto from_r = boost::charconv::from_chars(str.data(), str.data() + str.size(), value, chars_format::general, options);
+        BOOST_TEST(from_r.ec == std::errc::invalid_argument);
+        BOOST_TEST(from_r.ptr == str.data());
+        BOOST_TEST_EQ(value, T(42));
+
+        char buffer[64];
+        auto to_r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), T(1.5), chars_format::general, options);
+        BOOST_TEST(to_r.ec == std::errc::invalid_argument);
+        to_r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), T(1.5), chars_format::fixed, 2, options);
+        BOOST_TEST(to_r.ec == std::errc::invalid_argument);
+    }
+}
+
+int main()
+{
+    test_roundtrip<float>();
+    test_roundtrip<double>();
+
+    test_from_chars<float>();
+    test_from_chars<double>();
+
+    test_invalid_options<float>();
+    test_invalid_options<double>();
+
+    // A fixed set of outputs
+    char buffer[64];
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 1234.5, chars_format::general, chars_format_options(','));
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1234,5");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 1.25e-20, chars_format::general, chars_format_options(',', 'E'));
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1,25E-20");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 0.1F, chars_format::fixed, 3, chars_format_options(','));
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "0,100");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 1000.0, chars_format::scientific, 2, chars_format_options('.', 'd'));
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1.00d+03");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 0.0001234, chars_format::general, 2, chars_format_options(','));
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "0,00012");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 1.5, chars_format::hex, chars_format_options(','));
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1,8p+0");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 0.0, chars_format::scientific, chars_format_options(',', 'E'));
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "0E+00");
+
+    return boost::report_errors();
+}
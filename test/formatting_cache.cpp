@@ -0,0 +1,140 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// formatting_cache writes the same characters as to_chars, whether the value was in the cache or not
+
+#include <boost/charconv/formatting_cache.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <string>
+#include <limits>
+#include <iomanip>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+
+static std::mt19937_64 rng(42);
+
+static_assert(alignof(boost::charconv::formatting_cache<double>) == 64, "The entries should start on a cache line");
+
+template <typename Cache, typename T>
+void test_value(Cache& cache, T value, chars_format fmt, int precision, std::ptrdiff_t size = 128)
+{
+    char expected[128];
+    char buffer[128];
+    const auto r1 = boost::charconv::to_chars(expected, expected + size, value, fmt, precision);
+    const auto r2 = cache.to_chars(buffer, buffer + size, value, fmt, precision);
+    if (!BOOST_TEST(r1.ec == r2.ec) || (r1 && !BOOST_TEST_EQ(std::string(expected, r1.ptr), std::string(buffer, r2.ptr))))
+    {
+        // LCOV_EXCL_START
+        std::cerr << std::setprecision(std::numeric_limits<T>::max_digits10) << "Value: " << value
+                  << "\nFormat: " << static_cast<int>(fmt) << "\nPrecision: " << precision << "\nSize: " << size << std::endl;
+        // LCOV_EXCL_STOP
+    }
+}
+
+// A column with a few distinct values, written twice in every format so that the second pass hits
+template <typename T, typename Bits>
+void test_repeated()
+{
+    boost::charconv::formatting_cache<T> cache;
+    const T values[] = {T(0), -T(0), T(1), T(0.5), T(100), T(-2.25), T(0.1), T(1e10), (std::numeric_limits<T>::max)(),
+                        std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::infinity(), std::numeric_limits<T>::quiet_NaN()};
+
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (const T value : values)
+        {
+            for (const chars_format fmt : {chars_format::general, chars_format::fixed, chars_format::scientific, chars_format::hex})
+            {
+                for (const int precision : {-1, 0, 2, 6, 17})
+                {
+                    test_value(cache, value, fmt, precision);
+                }
+            }
+        }
+    }
+
+    // Only outputs that do not fit into an entry, e.g. the fixed format of max, miss in the second pass
+    const auto s = cache.stats();
+    BOOST_TEST(s.hits > 0);
+    BOOST_TEST(s.hits + s.misses == 2 * sizeof(values) / sizeof(values[0]) * 4 * 5);
+
+    // Random values, some of which share an entry with one of the above
+    for (int i = 0; i < 20000; ++i)
+    {
+        const auto bits = static_cast<Bits>(rng());
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+        test_value(cache, value, chars_format::general, -1);
+        test_value(cache, values[rng() % (sizeof(values) / sizeof(values[0]))], chars_format::fixed, 2);
+    }
+}
+
+template <typename T>
+void test_stats()
+{
+    boost::charconv::formatting_cache<T, 16> cache;
+    char buffer[64];
+    for (const T value : {T(0.5), T(100), T(0.5), T(0.5), T(100)})
+    {
+        BOOST_TEST(cache.to_chars(buffer, buffer + sizeof(buffer), value, chars_format::fixed, 2));
+    }
+
+    auto s = cache.stats();
+    BOOST_TEST_EQ(s.hits, 3U);
+    BOOST_TEST_EQ(s.misses, 2U);
+
+    // The same value in another format or precision is another entry
+    auto r = cache.to_chars(buffer, buffer + sizeof(buffer), T(0.5), chars_format::fixed, 3);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "0.500");
+    r = cache.to_chars(buffer, buffer + sizeof(buffer), T(0.5), chars_format::scientific, 2);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "5.00e-01");
+    BOOST_TEST_EQ(cache.stats().misses, 4U);
+
+    cache.reset_stats();
+    s = cache.stats();
+    BOOST_TEST_EQ(s.hits, 0U);
+    BOOST_TEST_EQ(s.misses, 0U);
+    r = cache.to_chars(buffer, buffer + sizeof(buffer), T(100), chars_format::fixed, 2);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "100.00");
+    BOOST_TEST_EQ(cache.stats().hits, 1U);
+
+    cache.clear();
+    r = cache.to_chars(buffer, buffer + sizeof(buffer), T(100), chars_format::fixed, 2);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "100.00");
+    BOOST_TEST_EQ(cache.stats().hits, 0U);
+    BOOST_TEST_EQ(cache.stats().misses, 1U);
+
+    // A hit needs room for its characters only, and fails like to_chars without it
+    for (const std::ptrdiff_t size : {std::ptrdiff_t(0), std::ptrdiff_t(5), std::ptrdiff_t(6), std::ptrdiff_t(7), std::ptrdiff_t(49), std::ptrdiff_t(50)})
+    {
+        test_value(cache, T(100), chars_format::fixed, 2, size);
+    }
+    BOOST_TEST_EQ(cache.stats().hits, 6U);
+
+    // A single entry holds one value at a time
+    boost::charconv::formatting_cache<T, 1> single;
+    for (const T value : {T(1), T(2), T(1), T(1)})
+    {
+        test_value(single, value, chars_format::general, -1);
+    }
+    BOOST_TEST_EQ(single.stats().hits, 1U);
+    BOOST_TEST_EQ(single.stats().misses, 3U);
+}
+
+int main()
+{
+    test_repeated<double, std::uint64_t>();
+    test_repeated<float, std::uint32_t>();
+
+    test_stats<double>();
+    test_stats<float>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,93 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Every conversion has to work without the C library fallbacks
+
+#ifndef BOOST_CHARCONV_HEADER_ONLY
+#  define BOOST_CHARCONV_HEADER_ONLY
+#endif
+#ifndef BOOST_CHARCONV_FREESTANDING
+#  define BOOST_CHARCONV_FREESTANDING
+#endif
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <cstring>
+#include <cstdint>
+
+#ifdef BOOST_CHARCONV_HAS_RUNTIME_DISPATCH
+#  error "BOOST_CHARCONV_FREESTANDING uses the kernels selected at compile time"
+#endif
+
+static std::mt19937_64 rng(42);
+
+template <typename T>
+void test_roundtrip(T value)
+{
+    char buffer[1024];
+
+    for (const auto fmt : {boost::charconv::chars_format::general, boost::charconv::chars_format::scientific,
+                           boost::charconv::chars_format::fixed, boost::charconv::chars_format::hex})
+    {
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt);
+        BOOST_TEST(r);
+
+        // The shortest fixed representation can be in scientific notation
+        T parsed {};
+        const auto parse_fmt = fmt == boost::charconv::chars_format::hex ? fmt : boost::charconv::chars_format::general;
+        const auto r2 = boost::charconv::from_chars(buffer, r.ptr, parsed, parse_fmt);
+        BOOST_TEST(r2);
+        BOOST_TEST(r2.ptr == r.ptr);
+        BOOST_TEST(parsed == value);
+    }
+}
+
+template <typename T>
+void test_integer(T value)
+{
+    char buffer[256];
+    for (const int base : {2, 10, 16, 36})
+    {
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, base);
+        BOOST_TEST(r);
+
+        T parsed {};
+        BOOST_TEST(boost::charconv::from_chars(buffer, r.ptr, parsed, base));
+        BOOST_TEST(parsed == value);
+    }
+}
+
+int main()
+{
+    for (int i = 0; i < 1000; ++i)
+    {
+        const auto bits = rng();
+
+        float f;
+        const auto bits32 = static_cast<std::uint32_t>(bits) & UINT32_C(0x7F7FFFFF);
+        std::memcpy(&f, &bits32, sizeof(f));
+        test_roundtrip(f);
+
+        double d;
+        const auto bits64 = bits & UINT64_C(0x7FEFFFFFFFFFFFFF);
+        std::memcpy(&d, &bits64, sizeof(d));
+        test_roundtrip(d);
+        test_roundtrip(static_cast<long double>(d));
+
+        #ifdef BOOST_CHARCONV_HAS_FLOAT128
+        test_roundtrip(static_cast<__float128>(d));
+        #endif
+
+        test_integer(static_cast<std::int32_t>(bits));
+        test_integer(bits);
+    }
+
+    // Long significands take the big integer path
+    const char str[] = "1.00000000000000011102230246251565404236316680908203125000000000000000000000000000000001";
+    double value = 0;
+    BOOST_TEST(boost::charconv::from_chars(str, str + sizeof(str) - 1, value));
+    BOOST_TEST_EQ(value, 1.0000000000000002);
+
+    return boost::report_errors();
+}
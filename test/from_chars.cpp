@@ -12,6 +12,9 @@
 #include <cstdint>
 #include <cerrno>
 #include <utility>
+#include <string>
+#include <random>
+#include <iostream>
 
 #ifdef BOOST_CHARCONV_HAS_INT128
 template <typename T>
@@ -70,6 +73,80 @@ void test_128bit_overflow<boost::uint128_type>()
     BOOST_TEST(r2.ec == std::errc::invalid_argument);
 }
 
+// Every length from 1 to 39 digits, which are read in chunks of 19, with leading zeros and a character after the digits
+template <typename T>
+void test_128bit_chunks()
+{
+    std::mt19937_64 rng(42);
+    for (int bits = 1; bits <= 128; ++bits)
+    {
+        for (int i = 0; i < 200; ++i)
+        {
+            auto u = static_cast<boost::uint128_type>((static_cast<boost::uint128_type>(rng()) << 64) | rng());
+            u >>= 128 - bits;
+            auto expected = static_cast<T>(u);
+            BOOST_IF_CONSTEXPR (std::is_same<T, boost::int128_type>::value)
+            {
+                if (rng() % 2 == 0)
+                {
+                    expected = static_cast<T>(-static_cast<boost::uint128_type>(expected));
+                }
+            }
+
+            char buffer[128] {};
+            auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), expected);
+            std::string str(buffer, r.ptr);
+            const std::string padded = (str[0] == '-' ? "-" + std::string(30, '0') + str.substr(1) : std::string(30, '0') + str) + "x";
+
+            for (const std::string& input : {str, padded})
+            {
+                T value = 0;
+                auto fr = boost::charconv::from_chars(input.data(), input.data() + input.size(), value);
+                const auto digits_last = input.data() + input.size() - (input.back() == 'x' ? 1 : 0);
+                if (!BOOST_TEST(fr.ec == std::errc()) || !BOOST_TEST(fr.ptr == digits_last) || !BOOST_TEST(value == expected))
+                {
+                    std::cerr << "Input: " << input << std::endl; // LCOV_EXCL_LINE
+                }
+            }
+        }
+    }
+
+    // 38 digits always fit, 40 significant digits never do, and the end of an overflow is after all of its digits
+    const std::string forty = "1000000000000000000000000000000000000000;";
+    T value = 1000;
+    auto r = boost::charconv::from_chars(forty.data(), forty.data() + forty.size(), value);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range && r.ptr == forty.data() + 40 && value == 1000);
+
+    const std::string zeros = std::string(100, '0');
+    r = boost::charconv::from_chars(zeros.data(), zeros.data() + zeros.size(), value);
+    BOOST_TEST(r.ec == std::errc() && r.ptr == zeros.data() + zeros.size() && value == 0);
+
+    const std::string nines = std::string(38, '9');
+    r = boost::charconv::from_chars(nines.data(), nines.data() + nines.size(), value);
+    BOOST_TEST(r.ec == std::errc() && value == static_cast<T>(static_cast<boost::uint128_type>(UINT64_C(10000000000000000000)) * UINT64_C(10000000000000000000) - 1));
+}
+
+template <typename T>
+void test_128bit_limits()
+{
+    char buffer[64] {};
+    for (const T limit : {std::numeric_limits<T>::max(), std::numeric_limits<T>::min()})
+    {
+        auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), limit);
+        T value = 0;
+        BOOST_TEST(boost::charconv::from_chars(buffer, r.ptr, value) && value == limit);
+
+        // One past the limit, in the last digit, which is never 9 for these
+        if (limit == 0)
+        {
+            continue;
+        }
+        --r.ptr;
+        ++*r.ptr;
+        BOOST_TEST(boost::charconv::from_chars(buffer, r.ptr + 1, value).ec == std::errc::result_out_of_range && value == limit);
+    }
+}
+
 #endif // 128-bit testing
 
 #ifndef BOOST_NO_CXX14_CONSTEXPR
@@ -83,12 +160,26 @@ constexpr std::pair<T, boost::charconv::from_chars_result> constexpr_test_helper
     return std::make_pair(v1, r1);
 }
 
+template <typename T>
+constexpr std::pair<T, boost::charconv::from_chars_result> constexpr_long_test_helper()
+{
+    const char* buffer1 = "123456789123456789";
+    T v1 = 0;
+    auto r1 = boost::charconv::from_chars(buffer1, buffer1 + 18, v1);
+
+    return std::make_pair(v1, r1);
+}
+
 template <typename T>
 constexpr void constexpr_test()
 {
     constexpr auto results = constexpr_test_helper<T>();
     static_assert(results.second.ec == std::errc(), "No error");
     static_assert(results.first == 42, "Value is 42");
+
+    constexpr auto long_results = constexpr_long_test_helper<long long>();
+    static_assert(long_results.second.ec == std::errc(), "No error");
+    static_assert(long_results.first == 123456789123456789LL, "Value is 123456789123456789");
 }
 
 #endif
@@ -195,6 +286,21 @@ void invalid_argument_test()
     auto r9 = boost::charconv::from_chars(buffer9, buffer9 + std::strlen(buffer9), v9);
     BOOST_TEST(r9);
     BOOST_TEST_EQ(v9, static_cast<T>(123));
+
+    // No digits at all, or none after the sign
+    const char* buffer10 = "x1";
+    T v10 = 3;
+    auto r10 = boost::charconv::from_chars(buffer10, buffer10 + std::strlen(buffer10), v10);
+    BOOST_TEST(r10.ec == std::errc::invalid_argument);
+    BOOST_TEST(r10.ptr == buffer10);
+    BOOST_TEST_EQ(v10, static_cast<T>(3));
+
+    const char* buffer11 = "-2";
+    T v11 = 3;
+    auto r11 = boost::charconv::from_chars(buffer11, buffer11 + std::strlen(buffer11), v11, 2);
+    BOOST_TEST(r11.ec == std::errc::invalid_argument);
+    BOOST_TEST(r11.ptr == buffer11);
+    BOOST_TEST_EQ(v11, static_cast<T>(3));
 }
 
 // No overflows, negative numbers, locales, etc.
@@ -219,6 +325,41 @@ void simple_test()
     BOOST_TEST(r3.ec == std::errc()) && BOOST_TEST_EQ(v2, static_cast<T>(12));
 }
 
+// Exercises the 8 digits at a time base 10 path with every split of digits and trailing characters
+template <typename T>
+void long_digit_test()
+{
+    const std::string digits = std::to_string((std::numeric_limits<T>::max)());
+
+    for (std::size_t len = 1; len <= digits.size(); ++len)
+    {
+        const std::string prefix = digits.substr(0, len);
+        const auto expected = static_cast<T>(std::stoull(prefix));
+
+        for (const char* suffix : {"", "x", ":1234567", ".5", "/9999999"})
+        {
+            const std::string str = prefix + suffix;
+
+            T v = 0;
+            auto r = boost::charconv::from_chars(str.data(), str.data() + str.size(), v);
+            BOOST_TEST(r.ec == std::errc()) && BOOST_TEST_EQ(v, expected);
+            BOOST_TEST(r.ptr == str.data() + len);
+        }
+    }
+
+    // Leading zeros do not count towards overflow
+    const std::string zeros = std::string(40, '0') + digits;
+    T v = 0;
+    auto r = boost::charconv::from_chars(zeros.data(), zeros.data() + zeros.size(), v);
+    BOOST_TEST(r.ec == std::errc()) && BOOST_TEST_EQ(v, (std::numeric_limits<T>::max)());
+
+    // One more digit than fits
+    const std::string too_long = digits + "0";
+    r = boost::charconv::from_chars(too_long.data(), too_long.data() + too_long.size(), v);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(r.ptr == too_long.data() + too_long.size());
+}
+
 template <typename T>
 void extended_ascii_codes()
 {
@@ -283,8 +424,19 @@ int main()
 
     test_128bit_overflow<boost::int128_type>();
     test_128bit_overflow<boost::uint128_type>();
+
+    test_128bit_chunks<boost::int128_type>();
+    test_128bit_chunks<boost::uint128_type>();
+
+    test_128bit_limits<boost::int128_type>();
+    test_128bit_limits<boost::uint128_type>();
     #endif
 
+    long_digit_test<int>();
+    long_digit_test<unsigned>();
+    long_digit_test<long long>();
+    long_digit_test<unsigned long long>();
+
     extended_ascii_codes<int>();
     extended_ascii_codes<unsigned>();
     extended_ascii_codes<char>();
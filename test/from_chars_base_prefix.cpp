@@ -0,0 +1,156 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Base 0 takes the base from a 0x, 0b, 0o or leading 0 prefix and reads the digits after it in the same pass
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <type_traits>
+#include <random>
+#include <string>
+#include <limits>
+#include <iostream>
+#include <cstdint>
+
+static std::mt19937_64 rng(42);
+
+template <typename T>
+void test_parse(const std::string& str, std::errc expected_ec, std::size_t expected_length, T expected_value = 0)
+{
+    T value = 42;
+    const auto r = boost::charconv::from_chars(str.data(), str.data() + str.size(), value, 0);
+    if (!BOOST_TEST(r.ec == expected_ec) || !BOOST_TEST_EQ(static_cast<std::size_t>(r.ptr - str.data()), expected_length))
+    {
+        // LCOV_EXCL_START
+        std::cerr << "Input: " << str << std::endl;
+        // LCOV_EXCL_STOP
+    }
+
+    BOOST_TEST_EQ(value, expected_ec == std::errc() ? expected_value : T(42));
+}
+
+// Every value written with the prefix of its base parses back to itself, and gives the same result as the explicit base
+template <typename T>
+void test_roundtrip()
+{
+    std::uniform_int_distribution<T> dist((std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        const T value = dist(rng);
+        for (const int base : {2, 8, 10, 16})
+        {
+            char digits[128];
+            const auto tr = boost::charconv::to_chars(digits, digits + sizeof(digits), value, base);
+            BOOST_TEST(tr);
+
+            const bool is_negative = digits[0] == '-';
+            std::string str = is_negative ? "-" : "";
+            switch (base)
+            {
+                case 2:
+                    str += rng() % 2 == 0 ? "0b" : "0B";
+                    break;
+                case 8:
+                    str += rng() % 2 == 0 ? "0o" : "0";
+                    break;
+                case 16:
+                    str += rng() % 2 == 0 ? "0x" : "0X";
+                    break;
+                default:
+                    break;
+            }
+            const std::string unprefixed(digits + static_cast<int>(is_negative), tr.ptr);
+            str += unprefixed;
+
+            // Decimal 0 is the only decimal with a leading zero, and it reads the same in octal
+            test_parse<T>(str, std::errc(), str.size(), value);
+
+            T explicit_value {};
+            const auto er = boost::charconv::from_chars(digits, tr.ptr, explicit_value, base);
+            BOOST_TEST(er && explicit_value == value);
+        }
+    }
+}
+
+template <typename T>
+void test_spot()
+{
+    test_parse<T>("0x1F", std::errc(), 4, 31);
+    test_parse<T>("0X1f", std::errc(), 4, 31);
+    test_parse<T>("0o17", std::errc(), 4, 15);
+    test_parse<T>("0O17", std::errc(), 4, 15);
+    test_parse<T>("017", std::errc(), 3, 15);
+    test_parse<T>("0b1010", std::errc(), 6, 10);
+    test_parse<T>("0B1", std::errc(), 3, 1);
+    test_parse<T>("123", std::errc(), 3, 123);
+    test_parse<T>("0", std::errc(), 1, 0);
+    test_parse<T>("00", std::errc(), 2, 0);
+
+    // A prefix without a digit of its base is the digit 0 followed by something else
+    test_parse<T>("0x", std::errc(), 1, 0);
+    test_parse<T>("0xg", std::errc(), 1, 0);
+    test_parse<T>("0b2", std::errc(), 1, 0);
+    test_parse<T>("0o8", std::errc(), 1, 0);
+    test_parse<T>("08", std::errc(), 1, 0);
+    test_parse<T>("0x1Fz", std::errc(), 4, 31);
+
+    // Only a minus sign can come before the prefix, and nothing between it and the digits
+    test_parse<T>("x1F", std::errc::invalid_argument, 0);
+    test_parse<T>("+0x1", std::errc::invalid_argument, 0);
+    test_parse<T>(" 0x1", std::errc::invalid_argument, 0);
+    test_parse<T>("0x-1", std::errc(), 1, 0);
+    test_parse<T>("", std::errc::invalid_argument, 0);
+
+    BOOST_IF_CONSTEXPR (std::is_signed<T>::value)
+    {
+        test_parse<T>("-0x1F", std::errc(), 5, static_cast<T>(-31));
+        test_parse<T>("-017", std::errc(), 4, static_cast<T>(-15));
+        test_parse<T>("-0b", std::errc(), 2, 0);
+        test_parse<T>("-", std::errc::invalid_argument, 0);
+    }
+    else
+    {
+        test_parse<T>("-0x1F", std::errc::invalid_argument, 0);
+    }
+}
+
+int main()
+{
+    test_roundtrip<std::int16_t>();
+    test_roundtrip<std::uint16_t>();
+    test_roundtrip<std::int32_t>();
+    test_roundtrip<std::uint32_t>();
+    test_roundtrip<std::int64_t>();
+    test_roundtrip<std::uint64_t>();
+
+    test_spot<int>();
+    test_spot<unsigned>();
+    test_spot<long long>();
+    test_spot<unsigned char>();
+
+    // The limits of the type apply to the value after the prefix
+    test_parse<std::int8_t>("-0x80", std::errc(), 5, INT8_MIN);
+    test_parse<std::int8_t>("0x80", std::errc::result_out_of_range, 4);
+    test_parse<std::uint8_t>("0b100000000", std::errc::result_out_of_range, 11);
+    test_parse<std::uint64_t>("0xFFFFFFFFFFFFFFFF", std::errc(), 18, UINT64_MAX);
+    test_parse<std::uint64_t>("01777777777777777777777", std::errc(), 23, UINT64_MAX);
+    test_parse<std::uint64_t>("0o2000000000000000000000", std::errc::result_out_of_range, 24);
+
+    // Other bases are still rejected
+    int value = 42;
+    const char str[] = "10";
+    BOOST_TEST(boost::charconv::from_chars(str, str + 2, value, 1).ec == std::errc::invalid_argument);
+    BOOST_TEST(boost::charconv::from_chars(str, str + 2, value, -1).ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(value, 42);
+
+    // Wide characters take the same prefixes
+    const char16_t wide[] = u"0x7f";
+    const auto wr = boost::charconv::from_chars(wide, wide + 4, value, 0);
+    BOOST_TEST(wr && wr.ptr == wide + 4);
+    BOOST_TEST_EQ(value, 127);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,213 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::number_kind;
+
+static std::mt19937_64 rng(42);
+
+boost::charconv::from_chars_classify_result classify(const std::string& str)
+{
+    return boost::charconv::from_chars_classify(str.data(), str.data() + str.size());
+}
+
+// Float is exact when it prints the same shortest digits as double. The scientific format is used
+// since the general format switches to it at a different exponent for each type
+bool reference_float_exact(const std::string& str)
+{
+    float f {};
+    double d {};
+    if (!boost::charconv::from_chars(str.data(), str.data() + str.size(), f) ||
+        !boost::charconv::from_chars(str.data(), str.data() + str.size(), d))
+    {
+        return false;
+    }
+
+    char f_buffer[64];
+    char d_buffer[64];
+    const auto f_r = boost::charconv::to_chars(f_buffer, f_buffer + sizeof(f_buffer), f, boost::charconv::chars_format::scientific);
+    const auto d_r = boost::charconv::to_chars(d_buffer, d_buffer + sizeof(d_buffer), d, boost::charconv::chars_format::scientific);
+    return std::string(f_buffer, f_r.ptr) == std::string(d_buffer, d_r.ptr);
+}
+
+int reference_integer_bits(std::int64_t value)
+{
+    return value == static_cast<std::int8_t>(value) ? 8 :
+           value == static_cast<std::int16_t>(value) ? 16 :
+           value == static_cast<std::int32_t>(value) ? 32 : 64;
+}
+
+void test_integers()
+{
+    char buffer[64];
+    for (int i = 0; i < 10000; ++i)
+    {
+        const auto value = static_cast<std::int64_t>(rng()) >> (rng() % 64);
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value);
+        const std::string str(buffer, r.ptr);
+
+        const auto c = classify(str);
+        BOOST_TEST(c);
+        BOOST_TEST_EQ(c.ptr - str.data(), r.ptr - buffer);
+        BOOST_TEST(c.kind == number_kind::integer);
+        BOOST_TEST_EQ(c.integer, value);
+        BOOST_TEST_EQ(c.integer_bits, reference_integer_bits(value));
+        BOOST_TEST_EQ(c.real, static_cast<double>(value));
+        BOOST_TEST_EQ(c.float_exact, reference_float_exact(str));
+    }
+
+    for (const std::int64_t value : {INT64_C(0), INT64_C(127), INT64_C(128), INT64_C(-128), INT64_C(-129), INT64_C(32767), INT64_C(-32768), INT64_C(32768),
+                                     INT64_C(2147483647), INT64_C(-2147483648), INT64_C(2147483648), (std::numeric_limits<std::int64_t>::max)(),
+                                     (std::numeric_limits<std::int64_t>::min)()})
+    {
+        const auto c = classify(std::to_string(value));
+        BOOST_TEST(c.kind == number_kind::integer);
+        BOOST_TEST_EQ(c.integer, value);
+        BOOST_TEST_EQ(c.integer_bits, reference_integer_bits(value));
+    }
+
+    // Leading zeros and negative zero
+    auto c = classify("-0007");
+    BOOST_TEST(c.kind == number_kind::integer && c.integer == -7 && c.integer_bits == 8);
+    c = classify("-0");
+    BOOST_TEST(c.kind == number_kind::integer && c.integer == 0 && c.integer_bits == 8);
+    BOOST_TEST(c.float_exact);
+}
+
+void test_128_bit_integers()
+{
+    for (const char* str : {"9223372036854775808", "-9223372036854775809", "18446744073709551616", "00000000000000000000009223372036854775808",
+                            "170141183460469231731687303715884105727", "-170141183460469231731687303715884105728"})
+    {
+        const auto c = classify(str);
+        BOOST_TEST(c);
+        BOOST_TEST(c.kind == number_kind::integer);
+        BOOST_TEST_EQ(c.integer_bits, 128);
+        BOOST_TEST_EQ(c.integer, 0);
+
+        double expected {};
+        boost::charconv::from_chars(str, str + std::strlen(str), expected);
+        BOOST_TEST_EQ(c.real, expected);
+    }
+
+    // Too large for 128 bits is still a number
+    for (const char* str : {"170141183460469231731687303715884105728", "-170141183460469231731687303715884105729", "1000000000000000000000000000000000000000000"})
+    {
+        const auto c = boost::charconv::from_chars_classify(str, str + std::strlen(str));
+        BOOST_TEST(c);
+        BOOST_TEST(c.kind == number_kind::floating);
+        BOOST_TEST_EQ(c.integer_bits, 0);
+        BOOST_TEST(c.ptr == str + std::strlen(str));
+    }
+}
+
+template <typename T>
+void test_floats()
+{
+    char buffer[64];
+    for (int i = 0; i < 10000; ++i)
+    {
+        const auto value = static_cast<T>(static_cast<double>(rng()) / static_cast<double>(rng() | 1U) * (i % 2 == 0 ? 1e-10 : 1e10));
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, (i % 3 == 0) ? boost::charconv::chars_format::scientific : boost::charconv::chars_format::general);
+        const std::string str(buffer, r.ptr);
+
+        double expected {};
+        boost::charconv::from_chars(buffer, r.ptr, expected);
+
+        const auto c = classify(str);
+        BOOST_TEST(c);
+        BOOST_TEST_EQ(c.ptr - str.data(), r.ptr - buffer);
+        BOOST_TEST_EQ(c.real, expected);
+        BOOST_TEST_EQ(c.float_exact, reference_float_exact(str));
+        if (str.find_first_not_of("-0123456789") != std::string::npos)
+        {
+            BOOST_TEST(c.kind == number_kind::floating);
+            BOOST_TEST_EQ(c.integer_bits, 0);
+        }
+
+        // The shortest digits of a float always narrow exactly.
+        // The general format can print more of them, e.g. 1136323328 for 1.1363233e+09
+        BOOST_IF_CONSTEXPR (std::is_same<T, float>::value)
+        {
+            if (i % 3 == 0)
+            {
+                BOOST_TEST(c.float_exact);
+            }
+        }
+    }
+}
+
+void test_spot()
+{
+    auto c = classify("0.1");
+    BOOST_TEST(c.kind == number_kind::floating && c.float_exact && c.real == 0.1);
+
+    c = classify("0.3333333333");
+    BOOST_TEST(c.kind == number_kind::floating && !c.float_exact);
+
+    c = classify("16777216");
+    BOOST_TEST(c.kind == number_kind::integer && c.integer_bits == 32 && c.float_exact);
+
+    c = classify("16777217");
+    BOOST_TEST(c.kind == number_kind::integer && c.integer_bits == 32 && !c.float_exact);
+
+    // Out of the range of float but not of double
+    c = classify("1e300");
+    BOOST_TEST(c.kind == number_kind::floating && !c.float_exact && c.real == 1e300);
+    c = classify("1e-300");
+    BOOST_TEST(c.kind == number_kind::floating && !c.float_exact && c.real == 1e-300);
+
+    c = classify("1e5");
+    BOOST_TEST(c.kind == number_kind::floating && c.real == 1e5);
+    c = classify("1.");
+    BOOST_TEST(c.kind == number_kind::floating && c.real == 1);
+    c = classify(".5");
+    BOOST_TEST(c.kind == number_kind::floating && c.real == 0.5);
+    c = classify("-inf");
+    BOOST_TEST(c.kind == number_kind::floating && c.float_exact && c.real == -std::numeric_limits<double>::infinity());
+    c = classify("nan");
+    BOOST_TEST(c.kind == number_kind::floating && c.float_exact && c.real != c.real);
+
+    // The number ends at the first character that is not part of it
+    const std::string str = "123,456";
+    c = classify(str);
+    BOOST_TEST(c.kind == number_kind::integer && c.integer == 123 && c.ptr == str.data() + 3);
+
+    c = boost::charconv::from_chars_classify(boost::core::string_view("-42x"));
+    BOOST_TEST(c.kind == number_kind::integer && c.integer == -42);
+}
+
+void test_errors()
+{
+    for (const char* str : {"", "-", ".", "-.", "abc", "+1", " 1", "e5"})
+    {
+        const auto c = boost::charconv::from_chars_classify(str, str + std::strlen(str));
+        BOOST_TEST(c.ec == std::errc::invalid_argument);
+        BOOST_TEST(c.ptr == str);
+        BOOST_TEST(c.kind == number_kind::none);
+    }
+
+    const auto c = classify("1e999");
+    BOOST_TEST(c.ec == std::errc::result_out_of_range);
+    BOOST_TEST(c.kind == number_kind::none);
+}
+
+int main()
+{
+    test_integers();
+    test_128_bit_integers();
+    test_floats<float>();
+    test_floats<double>();
+    test_spot();
+    test_errors();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,185 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/from_chars_column.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+
+static std::mt19937_64 rng(42);
+
+// The Arrow string layout of a list of strings
+template <typename Offset>
+struct string_column
+{
+    std::vector<Offset> offsets {0};
+    std::string data;
+
+    void append(const std::string& str)
+    {
+        data += str;
+        offsets.push_back(static_cast<Offset>(data.size()));
+    }
+
+    std::size_t size() const noexcept { return offsets.size() - 1; }
+};
+
+bool bit(const std::vector<std::uint8_t>& bitmap, std::size_t i)
+{
+    return ((bitmap[i / 8] >> (i % 8)) & 1U) != 0;
+}
+
+template <typename T, typename Offset, typename... Args>
+void check_column(const string_column<Offset>& column, const std::uint8_t* input_validity, Args... args)
+{
+    const std::size_t n = column.size();
+    std::vector<T> values(n, T(42));
+    std::vector<std::uint8_t> validity((n + 7) / 8, 0xAA);
+
+    const auto r = boost::charconv::from_chars_column(column.offsets.data(), column.data.data(), n, values.data(), validity.data(), args..., input_validity);
+
+    std::size_t null_count = 0;
+    std::errc first_error {};
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const auto first = column.data.data() + column.offsets[i];
+        const auto last = column.data.data() + column.offsets[i + 1];
+
+        T expected {};
+        bool valid = input_validity == nullptr || ((input_validity[i / 8] >> (i % 8)) & 1U) != 0;
+        if (valid)
+        {
+            const auto er = boost::charconv::from_chars(first, last, expected, args...);
+            valid = er && er.ptr == last;
+            if (!valid)
+            {
+                expected = T {};
+                if (first_error == std::errc())
+                {
+                    first_error = er ? std::errc::invalid_argument : er.ec;
+                }
+            }
+        }
+
+        null_count += valid ? 0U : 1U;
+        BOOST_TEST_EQ(bit(validity, i), valid);
+        BOOST_TEST(std::memcmp(&values[i], &expected, sizeof(T)) == 0);
+    }
+
+    // Padding bits of the last byte are zero
+    for (std::size_t i = n; i < validity.size() * 8; ++i)
+    {
+        BOOST_TEST(!bit(validity, i));
+    }
+
+    BOOST_TEST_EQ(r.null_count, null_count);
+    BOOST_TEST(r.ec == first_error);
+}
+
+template <typename T, typename Offset>
+void test_float()
+{
+    string_column<Offset> column;
+    char buffer[64];
+    for (int i = 0; i < 1000; ++i)
+    {
+        const double value = static_cast<double>(rng()) / static_cast<double>(rng() | 1U);
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), static_cast<T>(value));
+        std::string str(buffer, r.ptr);
+
+        // Every few values are not numbers, partly numbers, empty, or out of range
+        switch (rng() % 16)
+        {
+            case 0: str = "abc"; break;
+            case 1: str += "x"; break;
+            case 2: str.clear(); break;
+            case 3: str = "1e999"; break;
+            case 4: str = " " + str; break;
+            default: break;
+        }
+        column.append(str);
+    }
+
+    check_column<T>(column, nullptr, boost::charconv::chars_format::general);
+    check_column<T>(column, nullptr, boost::charconv::chars_format::scientific);
+
+    std::vector<std::uint8_t> input_validity((column.size() + 7) / 8);
+    for (auto& byte : input_validity)
+    {
+        byte = static_cast<std::uint8_t>(rng());
+    }
+    check_column<T>(column, input_validity.data(), boost::charconv::chars_format::general);
+}
+
+template <typename T, typename Offset>
+void test_integer(int base)
+{
+    string_column<Offset> column;
+    char buffer[128];
+    for (int i = 0; i < 1001; ++i)
+    {
+        const auto value = static_cast<T>(rng() >> (rng() % 64));
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, base);
+        std::string str(buffer, r.ptr);
+
+        switch (rng() % 16)
+        {
+            case 0: str.assign(1, '-'); break;
+            case 1: str += "!"; break;
+            case 2: str.clear(); break;
+            case 3: str = "99999999999999999999999999"; break;
+            default: break;
+        }
+        column.append(str);
+    }
+
+    check_column<T>(column, nullptr, base);
+
+    std::vector<std::uint8_t> input_validity((column.size() + 7) / 8, 0xFF);
+    input_validity[3] = 0;
+    check_column<T>(column, input_validity.data(), base);
+}
+
+void test_spot()
+{
+    string_column<std::int32_t> column;
+    for (const char* str : {"1", "2.5", "", "-3", "nan", "1e400", "4"})
+    {
+        column.append(str);
+    }
+
+    double values[7];
+    std::uint8_t validity[1];
+    const auto r = boost::charconv::from_chars_column(column.offsets.data(), column.data.data(), 7, values, validity);
+    BOOST_TEST_EQ(validity[0], 0x5B); // 1011011: "" and "1e400" are null
+    BOOST_TEST_EQ(r.null_count, 2U);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(values[1], 2.5);
+    BOOST_TEST_EQ(values[5], 0.0);
+
+    // An empty column writes nothing
+    const std::int64_t offsets[] = {0};
+    int dummy = 0;
+    const auto r2 = boost::charconv::from_chars_column(offsets, "", 0, &dummy, nullptr);
+    BOOST_TEST(r2 && r2.null_count == 0);
+}
+
+int main()
+{
+    test_float<float, std::int32_t>();
+    test_float<double, std::int64_t>();
+
+    test_integer<int, std::int32_t>(10);
+    test_integer<std::uint64_t, std::int64_t>(10);
+    test_integer<std::int64_t, std::int32_t>(16);
+    test_integer<short, std::int32_t>(36);
+
+    test_spot();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,109 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <memory>
+#include <string>
+#include <limits>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+
+static std::mt19937_64 rng(42);
+
+// The field is copied to a buffer of exactly N characters, so that reading past it is caught by the sanitizers
+template <std::size_t N, typename T>
+void test_field(const std::string& field, std::errc expected_ec, T expected)
+{
+    std::unique_ptr<char[]> buffer(new char[N]);
+    std::memcpy(buffer.get(), field.data(), N);
+
+    T value = T(42);
+    const auto r = boost::charconv::from_chars_exact<N>(buffer.get(), value);
+    if (!BOOST_TEST(r.ec == expected_ec) || !BOOST_TEST(value == expected))
+    {
+        std::cerr << "Field: " << field << std::endl; // LCOV_EXCL_LINE
+    }
+    BOOST_TEST(r.ptr == (r ? buffer.get() + N : buffer.get()));
+}
+
+template <std::size_t N, typename T>
+void test_length()
+{
+    T max_value = 1;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        max_value = static_cast<T>(max_value * 10);
+    }
+
+    std::uniform_int_distribution<int> digit_dist(0, 9);
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::string field;
+        T value = 0;
+        for (std::size_t j = 0; j < N; ++j)
+        {
+            const int digit = digit_dist(rng);
+            field.push_back(static_cast<char>('0' + digit));
+            value = static_cast<T>(value * 10 + static_cast<T>(digit));
+        }
+        test_field<N>(field, std::errc(), value);
+
+        // Every position is checked, including characters just outside of the digits
+        field[static_cast<std::size_t>(i) % N] = "/:a -\0\xB0"[i % 7];
+        test_field<N>(field, std::errc::invalid_argument, T(42));
+    }
+
+    test_field<N, T>(std::string(N, '0'), std::errc(), T(0));
+    test_field<N, T>(std::string(N, '9'), std::errc(), static_cast<T>(max_value - 1));
+}
+
+template <std::size_t N, typename T>
+struct test_lengths
+{
+    static void run()
+    {
+        test_length<N, T>();
+        test_lengths<N - 1, T>::run();
+    }
+};
+
+template <typename T>
+struct test_lengths<0, T>
+{
+    static void run() {}
+};
+
+int main()
+{
+    test_lengths<19, std::uint64_t>::run();
+    test_lengths<18, std::int64_t>::run();
+    test_lengths<9, std::uint32_t>::run();
+    test_lengths<9, int>::run();
+    test_lengths<4, unsigned short>::run();
+    test_lengths<2, signed char>::run();
+
+    // Fields of a fixed width message
+    const char message[] = "00012345ABCD0099";
+    std::uint32_t price = 0;
+    auto r = boost::charconv::from_chars_exact<8>(message, price);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(price, 12345U);
+    BOOST_TEST(r.ptr == message + 8);
+    r = boost::charconv::from_chars_exact<4>(r.ptr, price);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(price, 12345U);
+    r = boost::charconv::from_chars_exact<4>(message + 12, price);
+    BOOST_TEST_EQ(price, 99U);
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    test_length<38, boost::uint128_type>();
+    test_length<25, boost::int128_type>();
+    #endif
+
+    return boost::report_errors();
+}
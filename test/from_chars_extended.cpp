@@ -0,0 +1,139 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/bit_layouts.hpp>
+
+#if BOOST_CHARCONV_LDBL_BITS > 64 || defined(BOOST_CHARCONV_HAS_FLOAT128)
+
+#include <boost/charconv.hpp>
+#include <boost/charconv/detail/from_chars_slow_path.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <cstdint>
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 20000;
+
+// long double has padding bytes, so compare the values and the sign of zero
+template <typename T>
+bool same_value(T lhs, T rhs)
+{
+    return lhs == rhs && (lhs < 0) == (rhs < 0) && (T(1) / lhs < 0) == (T(1) / rhs < 0);
+}
+
+// The exact slow path is the reference for every input
+template <typename T>
+void check(const std::string& str)
+{
+    T value {};
+    T expected {};
+    const auto r = boost::charconv::from_chars_erange(str.data(), str.data() + str.size(), value);
+    const auto r_expected = boost::charconv::detail::from_chars_slow_path(str.data(), str.data() + str.size(), expected, boost::charconv::chars_format::general);
+
+    if (!BOOST_TEST(r.ec == r_expected.ec) || !BOOST_TEST(r.ptr == r_expected.ptr) || !BOOST_TEST(same_value(value, expected)))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+// Up to 45 digits with exponents over the whole range, including the subnormals and both overflow boundaries
+template <typename T>
+void test_random_strings(int min_exponent, int max_exponent)
+{
+    std::uniform_int_distribution<int> digit_dist(0, 9);
+    std::uniform_int_distribution<int> length_dist(1, 45);
+    std::uniform_int_distribution<int> exp_dist(min_exponent, max_exponent);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        std::string str = (i & 1U) != 0 ? "-" : "";
+        str += static_cast<char>('1' + digit_dist(rng) % 9);
+
+        const int length = length_dist(rng);
+        for (int j = 1; j < length; ++j)
+        {
+            str += static_cast<char>('0' + digit_dist(rng));
+        }
+        str += 'e';
+        str += std::to_string(exp_dist(rng));
+
+        check<T>(str);
+    }
+}
+
+#if BOOST_CHARCONV_LDBL_BITS > 64
+void test_long_double_spot_values()
+{
+    // 2^64 + 1 is halfway between two 80-bit values
+    check<long double>("18446744073709551617");
+    check<long double>("18446744073709551619");
+    check<long double>("18446744073709551617.00000000000000000001");
+    check<long double>("1.43235e38");
+    check<long double>("1.4323500000000000000000000000000000001e38");
+    check<long double>("9.99999999999999999999e-30");
+
+    check<long double>("3.64519953188247460253e-4951");
+    check<long double>("1.82259976594123730126e-4951");
+    check<long double>("3.36210314311209350626e-4932");
+    check<long double>("1.18973149535723176502e4932");
+    check<long double>("1.18973149535723176505e4932");
+    check<long double>("99999999999999999999999999999999999999e-4990");
+    check<long double>("1e4933");
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+void test_float128_spot_values()
+{
+    // Halfway between 2^113 and its neighbours
+    check<__float128>("10384593717069655257060992658440193");
+    check<__float128>("10384593717069655257060992658440195");
+    check<__float128>("10384593717069655257060992658440194999999999999999");
+    check<__float128>("103845937170696552570609926584401950000000000001e-13");
+
+    // Powers of ten that are not exact in binary128
+    check<__float128>("1.3864485552689e-42");
+    check<__float128>("9.999999999999999999999999999999999e-50");
+
+    // Extremes of the range
+    check<__float128>("6.4751751194380251109244389582276465524996e-4966");
+    check<__float128>("3.2375875597190125554622194791138232762498e-4966");
+    check<__float128>("3.2375875597190125554622194791138232763e-4966");
+    check<__float128>("3.3621031431120935062626778173217526025981e-4932");
+    check<__float128>("1.1897314953572317650857593266280070161965e4932");
+    check<__float128>("1.18973149535723176508575932662800702e4932");
+    check<__float128>("1.18973149535723176508575932662800703e4932");
+    check<__float128>("99999999999999999999999999999999999999e-5005");
+    check<__float128>("1e-5006");
+    check<__float128>("1e4933");
+}
+#endif
+
+int main()
+{
+    #if BOOST_CHARCONV_LDBL_BITS > 64
+    test_long_double_spot_values();
+    test_random_strings<long double>(-4995, 4940);
+    test_random_strings<long double>(-60, 60);
+    #endif
+
+    #ifdef BOOST_CHARCONV_HAS_FLOAT128
+    test_float128_spot_values();
+    test_random_strings<__float128>(-5010, 4940);
+    test_random_strings<__float128>(-60, 60);
+    #endif
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    return 0;
+}
+
+#endif
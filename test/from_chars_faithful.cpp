@@ -0,0 +1,212 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// from_chars_faithful must agree with from_chars on significands of up to 19 digits, and be within one unit
+// in the last place of it on longer ones, without ever comparing the digits as a big integer
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <type_traits>
+#include <random>
+#include <string>
+#include <limits>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+static std::mt19937_64 rng(42);
+
+template <typename T>
+using bits_type = typename std::conditional<std::is_same<T, float>::value, std::uint32_t, std::uint64_t>::type;
+
+template <typename T>
+bits_type<T> to_bits(T value)
+{
+    bits_type<T> bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    return bits;
+}
+
+// With exact the result is the correctly rounded value, and otherwise it can also be the one next to it toward zero
+template <typename T>
+void test_string(const std::string& str, bool exact, boost::charconv::chars_format fmt = boost::charconv::chars_format::general)
+{
+    T expected {};
+    const auto r1 = boost::charconv::from_chars(str.data(), str.data() + str.size(), expected, fmt);
+
+    T value {};
+    const auto r2 = boost::charconv::from_chars_faithful(str.data(), str.data() + str.size(), value, fmt);
+    BOOST_TEST(r2.ec == r1.ec);
+    BOOST_TEST(r2.ptr == r1.ptr);
+
+    const auto expected_bits = to_bits(expected);
+    const auto value_bits = to_bits(value);
+    const bool ok = expected_bits == value_bits || (!exact && value_bits + 1 == expected_bits);
+    if (!BOOST_TEST(ok))
+    {
+        std::cerr << "String: " << str << "\n  from_chars: " << expected << "\n  faithful:   " << value << std::endl; // LCOV_EXCL_LINE
+    }
+
+    T sv_value {};
+    const auto r3 = boost::charconv::from_chars_faithful(boost::core::string_view(str), sv_value, fmt);
+    BOOST_TEST(r3.ec == r2.ec);
+    BOOST_TEST(r3.ptr - str.data() == r2.ptr - str.data());
+    BOOST_TEST(to_bits(sv_value) == value_bits);
+}
+
+template <typename T>
+T random_value()
+{
+    bits_type<T> bits;
+    T value;
+    do
+    {
+        bits = static_cast<bits_type<T>>(rng());
+        std::memcpy(&value, &bits, sizeof(T));
+    } while (!std::isfinite(value));
+
+    return value;
+}
+
+// Up to 19 significant digits Eisel-Lemire is exact, so nothing changes
+template <typename T>
+void test_short()
+{
+    char buffer[128];
+    for (int i = 0; i < 100000; ++i)
+    {
+        const T value = random_value<T>();
+
+        auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value);
+        BOOST_TEST(r);
+        test_string<T>(std::string(buffer, r.ptr), true);
+
+        const int precision = static_cast<int>(rng() % 19);
+        r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, boost::charconv::chars_format::scientific, precision);
+        BOOST_TEST(r);
+        test_string<T>(std::string(buffer, r.ptr), true);
+
+        r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, boost::charconv::chars_format::hex);
+        BOOST_TEST(r);
+        test_string<T>(std::string(buffer, r.ptr), true, boost::charconv::chars_format::hex);
+    }
+}
+
+// Longer significands are rounded from their first 19 digits. The exact decimal values of the midpoints
+// between two neighbours are the inputs that from_chars needs the big integers for
+template <typename T>
+void test_long()
+{
+    char buffer[2048];
+    for (int i = 0; i < 20000; ++i)
+    {
+        T value = random_value<T>();
+        if (value == 0)
+        {
+            continue;
+        }
+
+        const int precision = 19 + static_cast<int>(rng() % 60);
+        auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, boost::charconv::chars_format::scientific, precision);
+        BOOST_TEST(r);
+        test_string<T>(std::string(buffer, r.ptr), false);
+
+        // The exact value of the double halfway between value and its neighbour is a long double of 80 or 128 bits
+        BOOST_CHARCONV_IF_CONSTEXPR (std::numeric_limits<long double>::digits > std::numeric_limits<T>::digits + 1)
+        {
+            const T next = std::nextafter(value, value < 0 ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity());
+            if (std::isinf(next))
+            {
+                continue;
+            }
+
+            const long double midpoint = (static_cast<long double>(value) + static_cast<long double>(next)) / 2;
+            r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), midpoint, boost::charconv::chars_format::scientific, 800);
+            if (r)
+            {
+                std::string str(buffer, r.ptr);
+
+                // Just above and below the midpoint as well
+                test_string<T>(str, false);
+                const auto e = str.find('e');
+                test_string<T>(str.substr(0, e) + "1" + str.substr(e), false);
+            }
+        }
+    }
+}
+
+void test_known()
+{
+    // 2^53 + 1 is halfway and ties to even, and the digit far past it rounds up, which the first 19 digits do not see
+    test_string<double>("9007199254740993", true);
+    test_string<double>("9007199254740993.00000000000000000001", false);
+
+    double value {};
+    const char* str = "9007199254740993.00000000000000000001";
+    auto r = boost::charconv::from_chars_faithful(str, str + std::strlen(str), value);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(value, 9007199254740992.0);
+
+    // The smallest subnormal and the largest finite value
+    test_string<double>("4.9406564584124654e-324", true);
+    test_string<double>("1.7976931348623157e308", true);
+    test_string<float>("1.4012984643e-45", true);
+    test_string<float>("3.4028234663852885981170418348451692544e38", false);
+
+    // A significand of ten thousand digits is scanned and then rounded from its first 19
+    std::string long_str = "1." + std::string(10000, '3');
+    test_string<double>(long_str, false);
+    test_string<float>(long_str + "e-20", false);
+    long_str = "0." + std::string(5000, '0') + "7" + std::string(5000, '9') + "e5000";
+    test_string<double>(long_str, false);
+
+    // Non finite values, errors, and the other formats are the same as those of from_chars
+    for (const char* s : {"inf", "-infinity", "nan", "-nan(ind)", "abc", "-", "1e400", "1e-400", "0.0", "-0", "1.5e", "0x1p3"})
+    {
+        test_string<double>(s, true);
+        test_string<float>(s, true);
+    }
+
+    test_string<double>("12345.678", true, boost::charconv::chars_format::fixed);
+    test_string<double>("1.2345678e4", true, boost::charconv::chars_format::scientific);
+    test_string<double>("1.8p3", true, boost::charconv::chars_format::hex);
+
+    // value is only written on success
+    value = 2.0;
+    r = boost::charconv::from_chars_faithful(str, str, value);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(value, 2.0);
+    str = "1e400";
+    r = boost::charconv::from_chars_faithful(str, str + std::strlen(str), value);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(value, 2.0);
+}
+
+void test_no_digit_comparison()
+{
+    boost::charconv::reset_slow_path_counters();
+
+    const std::string str = "9007199254740993." + std::string(1000, '0') + "1";
+    double value {};
+    BOOST_TEST(boost::charconv::from_chars_faithful(str.data(), str.data() + str.size(), value));
+    BOOST_TEST_EQ(boost::charconv::get_slow_path_counters().from_chars_digit_comparison, 0U);
+
+    // from_chars needs them for the same digits
+    BOOST_TEST(boost::charconv::from_chars(str.data(), str.data() + str.size(), value));
+    BOOST_TEST_EQ(boost::charconv::get_slow_path_counters().from_chars_digit_comparison, boost::charconv::slow_path_counters_enabled() ? 1U : 0U);
+}
+
+int main()
+{
+    test_short<double>();
+    test_short<float>();
+    test_long<double>();
+    test_long<float>();
+    test_known();
+    test_no_digit_comparison();
+
+    return boost::report_errors();
+}
@@ -2,7 +2,8 @@
 // Distributed under the Boost Software License, Version 1.0.
 // https://www.boost.org/LICENSE_1_0.txt
 
-#include "../src/from_chars_float_impl.hpp"
+#include <boost/charconv/detail/from_chars_float_impl.hpp>
+#include <boost/charconv/detail/fallback_routines.hpp>
 #include <boost/charconv.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include <system_error>
@@ -155,13 +156,13 @@ void simple_hex_scientific_test()
     T v1;
     auto r1 = boost::charconv::from_chars(buffer1, buffer1 + std::strlen(buffer1), v1, boost::charconv::chars_format::hex);
     BOOST_TEST(r1.ec == std::errc());
-    BOOST_TEST_EQ(v1, static_cast<T>(80427e-14L));
+    BOOST_TEST_EQ(v1, static_cast<T>(std::ldexp(80427.0L, -26)));
 
     const char* buffer2 = "1.234p-10";
     T v2;
     auto r2 = boost::charconv::from_chars(buffer2, buffer2 + std::strlen(buffer2), v2, boost::charconv::chars_format::hex);
     BOOST_TEST(r2.ec == std::errc());
-    BOOST_TEST_EQ(v2, static_cast<T>(4660e-13L));
+    BOOST_TEST_EQ(v2, static_cast<T>(std::ldexp(4660.0L, -22)));
 }
 
 template <typename T>
@@ -492,6 +493,27 @@ void test_strtod_routines(T val, const char* str)
     }
 }
 
+// Strings longer than the stack buffer keep only the digits that can change the rounding
+void test_strtod_long_strings()
+{
+    const std::string halfway = "1.00000000000000011102230246251565404236316680908203125";
+    const std::string zeros(1100, '0');
+
+    test_strtod_routines(1.0, (halfway + zeros).c_str());
+    test_strtod_routines(1.0000000000000002, (halfway + zeros + "1").c_str());
+    test_strtod_routines(-1.0000000000000002, ("-" + halfway + zeros + "1e0").c_str());
+    test_strtod_routines(1.0, ("1" + zeros + "e-1100").c_str());
+    test_strtod_routines(1.5, ("0." + zeros + "15e+1101").c_str());
+    test_strtod_routines(0.0, ("0." + zeros).c_str());
+
+    const std::string str = "0.25" + zeros + "e1x";
+    double value = 0;
+    const auto r = boost::charconv::detail::from_chars_strtod(str.c_str(), str.c_str() + str.size(), value);
+    BOOST_TEST(r);
+    BOOST_TEST(r.ptr == str.c_str() + str.size() - 1);
+    BOOST_TEST_EQ(value, 2.5);
+}
+
 // Parser ignoring null terminator
 template <typename T>
 void test_issue_48(const T val, const char* str, const std::ptrdiff_t expected_pos, boost::charconv::chars_format fmt = boost::charconv::chars_format::general)
@@ -1202,6 +1224,7 @@ int main()
     test_strtod_routines(-0.0F, "-1e-50");
     test_strtod_routines(1.5738291047382910487, "1.5738291047382910487");
     test_strtod_routines(-1.5738291047382910487F, "-1.5738291047382910487");
+    test_strtod_long_strings();
 
     // Every power
     spot_check(1.7e+308, "1.7e+308", boost::charconv::chars_format::scientific);
@@ -0,0 +1,229 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/charconv/detail/from_chars_half.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <limits>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+#  include <stdfloat>
+#endif
+
+using boost::charconv::detail::binary16_bits;
+using boost::charconv::detail::bfloat16_bits;
+
+static std::mt19937_64 rng(42);
+
+// Widens the 16-bit patterns into doubles which hold every value and every halfway point exactly
+double to_double(binary16_bits val)
+{
+    const bool sign = (val.bits & 0x8000U) != 0;
+    const int exponent = (val.bits >> 10) & 0x1F;
+    const int fraction = val.bits & 0x3FF;
+
+    double result;
+    if (exponent == 0x1F)
+    {
+        result = fraction == 0 ? std::numeric_limits<double>::infinity() : std::numeric_limits<double>::quiet_NaN();
+    }
+    else if (exponent == 0)
+    {
+        result = std::ldexp(fraction, -24);
+    }
+    else
+    {
+        result = std::ldexp(fraction + 1024, exponent - 25);
+    }
+
+    return sign ? -result : result;
+}
+
+double to_double(bfloat16_bits val)
+{
+    const std::uint64_t bits = static_cast<std::uint64_t>(val.bits) << 16;
+    float f;
+    const auto bits32 = static_cast<std::uint32_t>(bits);
+    std::memcpy(&f, &bits32, sizeof(f));
+    return static_cast<double>(f);
+}
+
+template <typename T>
+T parse(const std::string& str, std::errc expected_ec = std::errc(), boost::charconv::chars_format fmt = boost::charconv::chars_format::general)
+{
+    T val {};
+    const auto r = boost::charconv::detail::from_chars_half(str.data(), str.data() + str.size(), val, fmt);
+    if (!BOOST_TEST(r.ec == expected_ec) || !BOOST_TEST(r.ptr == str.data() + str.size()))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+
+    return val;
+}
+
+// Prints the exact decimal value of a double
+std::string exact_string(double val)
+{
+    char buffer[1100];
+    std::snprintf(buffer, sizeof(buffer), "%.1000e", val);
+    std::string str = buffer;
+
+    // Trim the trailing zeros of the significand
+    const auto e_pos = str.find('e');
+    auto last_digit = str.find_last_not_of('0', e_pos - 1);
+    if (str[last_digit] == '.')
+    {
+        --last_digit;
+    }
+    return str.substr(0, last_digit + 1) + str.substr(e_pos);
+}
+
+// Every finite value, every halfway point, and values just above and below each halfway point
+template <typename T>
+void test_all_values()
+{
+    for (std::uint32_t i = 0; i < 0x7FFF; ++i)
+    {
+        const T val {static_cast<std::uint16_t>(i)};
+        const T next {static_cast<std::uint16_t>(i + 1)};
+        const double d = to_double(val);
+        if (std::isinf(d) || std::isnan(d) || std::isinf(to_double(next)) || std::isnan(to_double(next)))
+        {
+            continue;
+        }
+
+        const auto parsed = parse<T>(exact_string(d));
+        BOOST_TEST_EQ(parsed.bits, val.bits);
+
+        // Shortest round trip representation of a double which is also the closest to the 16-bit value
+        char buffer[64];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), d);
+        BOOST_TEST_EQ(parse<T>(std::string(buffer, r.ptr)).bits, val.bits);
+
+        const std::string halfway = exact_string((d + to_double(next)) / 2);
+        const auto tie = parse<T>(halfway, i == 0 ? std::errc::result_out_of_range : std::errc());
+        BOOST_TEST_EQ(tie.bits, (i & 1U) == 0 ? val.bits : next.bits);
+
+        // Insert a non zero digit far past the end of the exact halfway digits
+        const auto e_pos = halfway.find('e');
+        const std::string mantissa = halfway.substr(0, e_pos);
+        const std::string exponent = halfway.substr(e_pos);
+        const std::string above = mantissa + (mantissa.find('.') == std::string::npos ? "." : "") + "00000000000000000000001" + exponent;
+        BOOST_TEST_EQ(parse<T>(above).bits, next.bits);
+
+        // Just below is the halfway point minus one in its last digit
+        std::string below = mantissa;
+        auto pos = below.size() - 1;
+        while (below[pos] == '0' || below[pos] == '.')
+        {
+            if (below[pos] == '0')
+            {
+                below[pos] = '9';
+            }
+            --pos;
+        }
+        --below[pos];
+        below += (below.find('.') == std::string::npos ? "." : "") + std::string("99999999999999999999999") + exponent;
+        if (below[0] != '0')
+        {
+            BOOST_TEST_EQ(parse<T>(below, i == 0 ? std::errc::result_out_of_range : std::errc()).bits, val.bits);
+        }
+    }
+}
+
+template <typename T>
+void test_random_strings()
+{
+    std::uniform_int_distribution<int> digit_dist(0, 9);
+    std::uniform_int_distribution<int> length_dist(1, 30);
+    std::uniform_int_distribution<int> exp_dist(-50, 45);
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        std::string str;
+        const int length = length_dist(rng);
+        for (int j = 0; j < length; ++j)
+        {
+            str += static_cast<char>('0' + digit_dist(rng));
+        }
+        str += 'e';
+        str += std::to_string(exp_dist(rng));
+
+        T fast {};
+        T exact {};
+        const auto r1 = boost::charconv::detail::from_chars_half(str.data(), str.data() + str.size(), fast, boost::charconv::chars_format::general);
+        const auto r2 = boost::charconv::detail::from_chars_slow_path(str.data(), str.data() + str.size(), exact, boost::charconv::chars_format::general);
+        if (!BOOST_TEST(r1.ec == r2.ec) || !BOOST_TEST_EQ(fast.bits, exact.bits))
+        {
+            std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+}
+
+void test_special_values()
+{
+    BOOST_TEST_EQ(parse<binary16_bits>("65504").bits, 0x7BFF);
+    BOOST_TEST_EQ(parse<binary16_bits>("65519.99").bits, 0x7BFF);
+    BOOST_TEST_EQ(parse<binary16_bits>("65520", std::errc::result_out_of_range).bits, 0x7C00);
+    BOOST_TEST_EQ(parse<binary16_bits>("-1e10", std::errc::result_out_of_range).bits, 0xFC00);
+    BOOST_TEST_EQ(parse<binary16_bits>("1e-10", std::errc::result_out_of_range).bits, 0x0000);
+    BOOST_TEST_EQ(parse<binary16_bits>("-0").bits, 0x8000);
+    BOOST_TEST_EQ(parse<binary16_bits>("inf").bits, 0x7C00);
+    BOOST_TEST_EQ(parse<binary16_bits>("-infinity").bits, 0xFC00);
+    BOOST_TEST_EQ(parse<binary16_bits>("nan").bits & 0x7E00, 0x7E00);
+    BOOST_TEST_EQ(parse<binary16_bits>("1.ffcp+15", std::errc(), boost::charconv::chars_format::hex).bits, 0x7BFF);
+    BOOST_TEST_EQ(parse<binary16_bits>("1p-24", std::errc(), boost::charconv::chars_format::hex).bits, 0x0001);
+
+    BOOST_TEST_EQ(parse<bfloat16_bits>("1").bits, 0x3F80);
+    BOOST_TEST_EQ(parse<bfloat16_bits>("3.3895313892515355e38").bits, 0x7F7F);
+    BOOST_TEST_EQ(parse<bfloat16_bits>("3.4e38", std::errc::result_out_of_range).bits, 0x7F80);
+    BOOST_TEST_EQ(parse<bfloat16_bits>("-inf").bits, 0xFF80);
+    BOOST_TEST_EQ(parse<bfloat16_bits>("1.01p0", std::errc(), boost::charconv::chars_format::hex).bits, 0x3F80);
+    BOOST_TEST_EQ(parse<bfloat16_bits>("1.03p0", std::errc(), boost::charconv::chars_format::hex).bits, 0x3F82);
+
+    // Just above the tie between 1 and the next value. Rounding to float first gives exactly the tie and then 0x3C00
+    BOOST_TEST_EQ(parse<binary16_bits>("1.00048828125000005").bits, 0x3C01);
+    BOOST_TEST_EQ(parse<binary16_bits>("1.00048828125").bits, 0x3C00);
+    BOOST_TEST_EQ(parse<binary16_bits>("1.000488281249999999999").bits, 0x3C00);
+
+    BOOST_TEST_EQ(parse<binary16_bits>("", std::errc::invalid_argument).bits, 0);
+}
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+void test_public_api()
+{
+    std::float16_t val {};
+    BOOST_TEST(boost::charconv::from_chars("1.5", val));
+    BOOST_TEST(val == 1.5f16);
+    BOOST_TEST(boost::charconv::from_chars("1.00048828125000005", val));
+    BOOST_TEST(val == 1.0009765625f16);
+
+    std::bfloat16_t bval {};
+    BOOST_TEST(boost::charconv::from_chars("-2.5", bval));
+    BOOST_TEST(bval == -2.5bf16);
+}
+#endif
+
+int main()
+{
+    test_special_values();
+
+    test_all_values<binary16_bits>();
+    test_all_values<bfloat16_bits>();
+
+    test_random_strings<binary16_bits>();
+    test_random_strings<bfloat16_bits>();
+
+    #ifdef BOOST_CHARCONV_HAS_FLOAT16
+    test_public_api();
+    #endif
+
+    return boost::report_errors();
+}
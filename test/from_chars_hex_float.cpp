@@ -0,0 +1,153 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <limits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 1024;
+
+template <typename T>
+void test_value(const char* str, T expected, std::size_t expected_length, std::errc expected_ec = std::errc())
+{
+    T value {};
+    const auto r = boost::charconv::from_chars_erange(str, str + std::strlen(str), value, boost::charconv::chars_format::hex);
+    if (!BOOST_TEST(r.ec == expected_ec) || !BOOST_TEST_EQ(r.ptr - str, static_cast<std::ptrdiff_t>(expected_length)))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+
+    if (expected_ec == std::errc() || expected_ec == std::errc::result_out_of_range)
+    {
+        BOOST_TEST_EQ(value, expected);
+        BOOST_TEST_EQ(std::signbit(value), std::signbit(expected));
+    }
+}
+
+template <typename T>
+void test_grammar()
+{
+    test_value<T>("1", T(1), 1);
+    test_value<T>("-a", T(-10), 2);
+    test_value<T>("1.8", T(1.5), 3);
+    test_value<T>(".8", T(0.5), 2);
+    test_value<T>("8.", T(8), 2);
+    test_value<T>("0", T(0), 1);
+    test_value<T>("-0.000p+100", -T(0), 11);
+    test_value<T>("1p4", T(16), 3);
+    test_value<T>("1P-4", T(0.0625), 4);
+    test_value<T>("1p+04", T(16), 5);
+    test_value<T>("0000000000000000000000000000000000000001p0", T(1), 42);
+    test_value<T>("0.0000000000000000000000000000000000000001p160", T(1), 46);
+
+    // An exponent without digits is not part of the number
+    test_value<T>("1p", T(1), 1);
+    test_value<T>("1p+", T(1), 1);
+    test_value<T>("1.8px", T(1.5), 3);
+
+    // Stops at the first character that can not continue the number
+    test_value<T>("1.8p1,2", T(3), 5);
+    test_value<T>("1.8.8", T(1.5), 3);
+    test_value<T>("1g", T(1), 1);
+
+    test_value<T>("", T(0), 0, std::errc::invalid_argument);
+    test_value<T>(".", T(0), 0, std::errc::invalid_argument);
+    test_value<T>("-", T(0), 0, std::errc::invalid_argument);
+    test_value<T>("p1", T(0), 0, std::errc::invalid_argument);
+    test_value<T>("+1", T(0), 0, std::errc::invalid_argument);
+    test_value<T>("x1", T(0), 0, std::errc::invalid_argument);
+
+    // Non-finite values are still recognized
+    T value {};
+    BOOST_TEST(boost::charconv::from_chars("-inf", value, boost::charconv::chars_format::hex));
+    BOOST_TEST(std::isinf(value) && std::signbit(value));
+    BOOST_TEST(boost::charconv::from_chars("nan", value, boost::charconv::chars_format::hex));
+    BOOST_TEST(std::isnan(value));
+}
+
+template <typename T>
+void test_limits()
+{
+    const auto denorm_min = std::numeric_limits<T>::denorm_min();
+    const auto max_exponent = std::numeric_limits<T>::max_exponent;
+    const std::string min_str = "1p" + std::to_string(std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits);
+
+    test_value<T>(min_str.c_str(), denorm_min, min_str.size());
+
+    // Half of the smallest subnormal rounds to even (zero), anything above it rounds up
+    const std::string half_min_str = "1p" + std::to_string(std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits - 1);
+    test_value<T>(half_min_str.c_str(), T(0), half_min_str.size(), std::errc::result_out_of_range);
+    const std::string above_half_min_str = "1.000000000000000000000000000000000000001p" + std::to_string(std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits - 1);
+    test_value<T>(above_half_min_str.c_str(), denorm_min, above_half_min_str.size());
+
+    const std::string max_str = "ffffffffffffffffffffffffffffffffffffffffp" + std::to_string(max_exponent - 160);
+    test_value<T>(max_str.c_str(), std::numeric_limits<T>::infinity(), max_str.size(), std::errc::result_out_of_range);
+
+    const std::string overflow_str = "-1p" + std::to_string(max_exponent);
+    test_value<T>(overflow_str.c_str(), -std::numeric_limits<T>::infinity(), overflow_str.size(), std::errc::result_out_of_range);
+
+    test_value<T>("1p99999999999999999999", std::numeric_limits<T>::infinity(), 22, std::errc::result_out_of_range);
+    test_value<T>("1p-99999999999999999999", T(0), 23, std::errc::result_out_of_range);
+}
+
+// Every value written by to_chars in hex must read back exactly
+template <typename T>
+void test_roundtrip()
+{
+    std::uniform_real_distribution<T> dist(-std::numeric_limits<T>::max() / 2, std::numeric_limits<T>::max() / 2);
+    std::uniform_int_distribution<int> exp_dist(std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits, std::numeric_limits<T>::max_exponent - 1);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const T val = (i & 1U) != 0 ? dist(rng) : std::ldexp(T(1) + dist(rng) / std::numeric_limits<T>::max(), exp_dist(rng));
+
+        char buffer[256];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), val, boost::charconv::chars_format::hex);
+        BOOST_TEST(r);
+
+        T parsed {};
+        const auto r2 = boost::charconv::from_chars(buffer, r.ptr, parsed, boost::charconv::chars_format::hex);
+        if (!BOOST_TEST(r2) || !BOOST_TEST(r2.ptr == r.ptr) || !BOOST_TEST_EQ(parsed, val))
+        {
+            std::cerr << "Input: " << std::string(buffer, r.ptr) << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+}
+
+// Long significands must round once with every trailing digit taken into account
+void test_long_significands()
+{
+    test_value<double>("1.00000000000008p0", 1.0, 18);
+    test_value<double>("1.00000000000018p0", 1.0 + 2 * std::numeric_limits<double>::epsilon(), 18);
+    test_value<double>("1.000000000000080000000000000000000000000000001p0", 1.0 + std::numeric_limits<double>::epsilon(), 49);
+    test_value<double>("1000000000000080000000000000000000000000000000.1p-180", 1.0 + std::numeric_limits<double>::epsilon(), 53);
+    test_value<float>("1.000001p0", 1.0F, 10);
+    test_value<float>("1.0000011p0", 1.0F + std::numeric_limits<float>::epsilon(), 11);
+}
+
+int main()
+{
+    test_grammar<float>();
+    test_grammar<double>();
+    test_grammar<long double>();
+
+    test_limits<float>();
+    test_limits<double>();
+    test_limits<long double>();
+
+    test_roundtrip<float>();
+    test_roundtrip<double>();
+    test_roundtrip<long double>();
+
+    test_long_significands();
+
+    return boost::report_errors();
+}
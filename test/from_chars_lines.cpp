@@ -0,0 +1,158 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/from_chars_lines.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+
+static std::mt19937_64 rng(42);
+
+// Parses the lines one at a time with from_chars, and compares the values, the error, and where it stopped
+template <typename T>
+void check_lines(const std::string& str, std::size_t cap)
+{
+    std::vector<T> values(cap + 1, T(42));
+    const auto r = boost::charconv::from_chars_lines(str.data(), str.data() + str.size(), values.data(), cap);
+
+    std::size_t count = 0;
+    std::size_t pos = 0;
+    std::errc ec {};
+    while (pos != str.size() && count < cap)
+    {
+        auto end = str.find('\n', pos);
+        const auto next = end == std::string::npos ? str.size() : end + 1;
+        end = end == std::string::npos ? str.size() : end;
+        if (end != pos && str[end - 1] == '\r')
+        {
+            --end;
+        }
+
+        T expected {};
+        const auto er = boost::charconv::from_chars(str.data() + pos, str.data() + end, expected);
+        if (!er || er.ptr != str.data() + end)
+        {
+            ec = er ? std::errc::invalid_argument : er.ec;
+            break;
+        }
+
+        BOOST_TEST_EQ(values[count], expected);
+        ++count;
+        pos = next;
+    }
+
+    BOOST_TEST(r.ec == ec);
+    BOOST_TEST_EQ(r.count, count);
+    BOOST_TEST(r.ptr == str.data() + pos);
+
+    // Nothing is written past the values that were parsed
+    BOOST_TEST_EQ(values[count], T(42));
+}
+
+template <typename T>
+void test_random(std::size_t max_digits_shift)
+{
+    std::string str;
+    char buffer[64];
+    for (int i = 0; i < 3000; ++i)
+    {
+        const auto value = static_cast<T>(rng() >> (max_digits_shift + rng() % (64 - max_digits_shift)));
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value);
+        str.append(buffer, r.ptr);
+        str += (rng() % 8 == 0) ? "\r\n" : "\n";
+    }
+
+    check_lines<T>(str, 5000);
+    check_lines<T>(str, 1234);
+
+    // Without the final newline, and with an error at a random line
+    str.pop_back();
+    check_lines<T>(str, 5000);
+
+    for (int i = 0; i < 20; ++i)
+    {
+        std::string bad = str;
+        const auto pos = bad.find('\n', rng() % bad.size());
+        if (pos != std::string::npos)
+        {
+            switch (rng() % 4)
+            {
+                case 0: bad.insert(pos, "x"); break;
+                case 1: bad.insert(pos, "\n"); break;
+                case 2: bad.insert(pos + 1, " "); break;
+                default: bad.insert(pos + 1, "99999999999999999999999"); break;
+            }
+        }
+        check_lines<T>(bad, 5000);
+    }
+}
+
+void test_spot()
+{
+    std::int64_t values[8] {};
+
+    auto r = boost::charconv::from_chars_lines("1\n-2\r\n3", values, 8);
+    BOOST_TEST(r && r.count == 3);
+    BOOST_TEST_EQ(values[0], 1);
+    BOOST_TEST_EQ(values[1], -2);
+    BOOST_TEST_EQ(values[2], 3);
+
+    // The index of the first line that is not a number
+    const char str[] = "10\n20\n2x\n40\n";
+    r = boost::charconv::from_chars_lines(str, str + std::strlen(str), values, 8);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(r.count, 2U);
+    BOOST_TEST(r.ptr == str + 6);
+
+    // Stops at cap, at the start of the next line
+    r = boost::charconv::from_chars_lines(str, str + std::strlen(str), values, 1);
+    BOOST_TEST(r && r.count == 1 && r.ptr == str + 3);
+
+    std::uint8_t small[2] {};
+    r = boost::charconv::from_chars_lines("255\n256\n", small, 2);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(r.count, 1U);
+
+    // No input and no room
+    r = boost::charconv::from_chars_lines("", values, 8);
+    BOOST_TEST(r && r.count == 0);
+    r = boost::charconv::from_chars_lines("1\n", values, 0);
+    BOOST_TEST(r && r.count == 0);
+
+    // Floating point values in a format
+    double reals[3] {};
+    r = boost::charconv::from_chars_lines("1.5\r\n2e3\n-0.25", reals, 3);
+    BOOST_TEST(r && r.count == 3);
+    BOOST_TEST_EQ(reals[1], 2000.0);
+    BOOST_TEST_EQ(reals[2], -0.25);
+    r = boost::charconv::from_chars_lines("1.5\n2e3\n", reals, 3, boost::charconv::chars_format::fixed);
+    BOOST_TEST(r.ec == std::errc::invalid_argument && r.count == 1);
+}
+
+int main()
+{
+    test_random<std::uint64_t>(0);
+    test_random<std::int64_t>(0);
+    test_random<std::uint32_t>(32);
+    test_random<int>(40);
+
+    // Long lines that cross several blocks
+    for (std::size_t cap : {1U, 10U, 100U})
+    {
+        std::string str;
+        for (std::size_t i = 0; i < cap; ++i)
+        {
+            str += std::string(100, '0') + std::to_string(i) + "\n";
+        }
+        check_lines<unsigned>(str, cap);
+    }
+
+    test_spot();
+
+    return boost::report_errors();
+}
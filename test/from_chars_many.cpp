@@ -0,0 +1,213 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <limits>
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 1024;
+
+template <typename T>
+void test_roundtrip(char delimiter)
+{
+    std::uniform_real_distribution<T> dist(T(-1e10), T(1e10));
+
+    std::vector<T> values(N);
+    std::string buffer;
+    char temp[64];
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        values[i] = dist(rng);
+        const auto r = boost::charconv::to_chars(temp, temp + sizeof(temp), values[i]);
+        BOOST_TEST(r);
+        buffer.append(temp, r.ptr);
+        if (i != N - 1)
+        {
+            buffer.push_back(delimiter);
+        }
+    }
+
+    std::vector<T> parsed(N);
+    const auto r = boost::charconv::from_chars_many(buffer.data(), buffer.data() + buffer.size(), parsed.data(), N, delimiter);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.count, N);
+    BOOST_TEST(r.ptr == buffer.data() + buffer.size());
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        BOOST_TEST_EQ(parsed[i], values[i]);
+    }
+
+    // Parsing in two halves must resume at the next field
+    std::vector<T> first_half(N / 2);
+    std::vector<T> second_half(N - N / 2);
+    const auto r1 = boost::charconv::from_chars_many(buffer, first_half.data(), first_half.size(), delimiter);
+    BOOST_TEST(r1);
+    BOOST_TEST_EQ(r1.count, first_half.size());
+    const auto r2 = boost::charconv::from_chars_many(r1.ptr, buffer.data() + buffer.size(), second_half.data(), second_half.size(), delimiter);
+    BOOST_TEST(r2);
+    BOOST_TEST_EQ(r2.count, second_half.size());
+
+    for (std::size_t i = 0; i < first_half.size(); ++i)
+    {
+        BOOST_TEST_EQ(first_half[i], values[i]);
+    }
+    for (std::size_t i = 0; i < second_half.size(); ++i)
+    {
+        BOOST_TEST_EQ(second_half[i], values[first_half.size() + i]);
+    }
+}
+
+template <typename T>
+void test_errors()
+{
+    T out[4] {};
+
+    // Bad field in the middle
+    const char* buffer = "1.5,2.25,abc,4";
+    auto r = boost::charconv::from_chars_many(buffer, buffer + std::strlen(buffer), out, 4, ',');
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(r.count, 2U);
+    BOOST_TEST(r.ptr == buffer + 9);
+    BOOST_TEST_EQ(out[0], T(1.5));
+    BOOST_TEST_EQ(out[1], T(2.25));
+    BOOST_TEST_EQ(out[2], T(0));
+
+    // Wrong delimiter
+    buffer = "1;2";
+    r = boost::charconv::from_chars_many(buffer, buffer + std::strlen(buffer), out, 4, ',');
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(r.count, 1U);
+    BOOST_TEST(r.ptr == buffer + 1);
+
+    // Empty field
+    buffer = "1,,2";
+    r = boost::charconv::from_chars_many(buffer, buffer + std::strlen(buffer), out, 4, ',');
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(r.count, 1U);
+    BOOST_TEST(r.ptr == buffer + 2);
+
+    // Out of range value leaves the output untouched
+    out[1] = T(42);
+    buffer = "1,1e99999,2";
+    r = boost::charconv::from_chars_many(buffer, buffer + std::strlen(buffer), out, 4, ',');
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(r.count, 1U);
+    BOOST_TEST(r.ptr == buffer + 2);
+    BOOST_TEST_EQ(out[1], T(42));
+
+    // Stops after n values and points at the next field
+    buffer = "1\t2\t3\t4";
+    r = boost::charconv::from_chars_many(buffer, buffer + std::strlen(buffer), out, 2, '\t');
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.count, 2U);
+    BOOST_TEST(r.ptr == buffer + 4);
+
+    // Trailing delimiter and empty input
+    buffer = "1,2,";
+    r = boost::charconv::from_chars_many(buffer, buffer + std::strlen(buffer), out, 4, ',');
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.count, 2U);
+    BOOST_TEST(r.ptr == buffer + 4);
+
+    r = boost::charconv::from_chars_many(buffer, buffer, out, 4, ',');
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.count, 0U);
+
+    // Format is honored for every field
+    buffer = "1e5,2";
+    r = boost::charconv::from_chars_many(buffer, buffer + std::strlen(buffer), out, 4, ',', boost::charconv::chars_format::fixed);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(r.count, 1U);
+    BOOST_TEST_EQ(out[0], T(1));
+}
+
+#if defined(BOOST_CHARCONV_HAS_FLOAT16) || defined(BOOST_CHARCONV_HAS_BRAINFLOAT16)
+
+// Every bit pattern printed with more digits than it needs, so that most fields have to be rounded to 16 bits,
+// must parse to the same value as from_chars of each field
+template <typename T>
+void test_half_batch(boost::charconv::chars_format fmt, int precision)
+{
+    std::string buffer;
+    char temp[128];
+    std::vector<std::size_t> starts;
+
+    constexpr std::size_t count = 65536;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto bits = static_cast<std::uint16_t>(i);
+        T value;
+        std::memcpy(&value, &bits, sizeof(bits));
+
+        const auto r = boost::charconv::to_chars(temp, temp + sizeof(temp), static_cast<float>(value), fmt, precision);
+        BOOST_TEST(r);
+        starts.push_back(buffer.size());
+        buffer.append(temp, r.ptr);
+        buffer.push_back(',');
+    }
+
+    std::vector<T> parsed(count);
+    const auto r = boost::charconv::from_chars_many(buffer, parsed.data(), count, ',', fmt);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.count, count);
+    BOOST_TEST(r.ptr == buffer.data() + buffer.size());
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const char* first = buffer.data() + starts[i];
+        T expected {};
+        boost::charconv::from_chars(first, buffer.data() + buffer.size(), expected, fmt);
+        BOOST_TEST(std::memcmp(&parsed[i], &expected, sizeof(T)) == 0);
+    }
+}
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+
+// 1e6 is larger than the largest float16
+void test_half_errors()
+{
+    using T = std::float16_t;
+    T out[4] {};
+    const char* buffer = "1.5,1e6,2";
+    const auto r = boost::charconv::from_chars_many(buffer, buffer + std::strlen(buffer), out, 4, ',');
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(r.count, 1U);
+    BOOST_TEST(r.ptr == buffer + 4);
+    BOOST_TEST(out[0] == T(1.5));
+    BOOST_TEST(out[1] == T(0));
+}
+
+#endif
+
+#endif
+
+int main()
+{
+    test_roundtrip<float>(',');
+    test_roundtrip<double>(',');
+    test_roundtrip<double>('\n');
+
+    test_errors<float>();
+    test_errors<double>();
+
+    #ifdef BOOST_CHARCONV_HAS_FLOAT16
+    test_half_batch<std::float16_t>(boost::charconv::chars_format::general, 9);
+    test_half_batch<std::float16_t>(boost::charconv::chars_format::hex, -1);
+    test_half_errors();
+    #endif
+
+    #ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+    test_half_batch<std::bfloat16_t>(boost::charconv::chars_format::scientific, 5);
+    test_half_batch<std::bfloat16_t>(boost::charconv::chars_format::hex, -1);
+    #endif
+
+    return boost::report_errors();
+}
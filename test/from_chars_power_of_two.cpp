@@ -0,0 +1,285 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Bases 2, 8 and 16 read 8 characters at a time. Compare them with a reference that reads one character at a time
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <type_traits>
+#include <random>
+#include <memory>
+#include <string>
+#include <limits>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+
+static std::mt19937_64 rng(42);
+
+static unsigned digit_value(char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        return static_cast<unsigned>(c - '0');
+    }
+    if (c >= 'a' && c <= 'z')
+    {
+        return static_cast<unsigned>(c - 'a' + 10);
+    }
+    if (c >= 'A' && c <= 'Z')
+    {
+        return static_cast<unsigned>(c - 'A' + 10);
+    }
+    return 255;
+}
+
+template <typename T>
+struct reference_result
+{
+    std::size_t length;
+    std::errc ec;
+    T value;
+};
+
+template <typename T>
+reference_result<T> reference_from_chars(const std::string& str, int base)
+{
+    using Unsigned = typename std::make_unsigned<T>::type;
+
+    std::size_t i = 0;
+    bool negative = false;
+    if (std::is_signed<T>::value && !str.empty() && str[0] == '-')
+    {
+        negative = true;
+        ++i;
+    }
+
+    const std::size_t digits_first = i;
+    const auto max_value = static_cast<Unsigned>(static_cast<Unsigned>((std::numeric_limits<T>::max)()) + (negative ? 1U : 0U));
+    const auto unsigned_base = static_cast<Unsigned>(base);
+
+    Unsigned value = 0;
+    bool overflowed = false;
+    for (; i < str.size() && digit_value(str[i]) < static_cast<unsigned>(base); ++i)
+    {
+        const auto digit = static_cast<Unsigned>(digit_value(str[i]));
+        if (value > (max_value - digit) / unsigned_base)
+        {
+            overflowed = true;
+        }
+        value = static_cast<Unsigned>(value * unsigned_base + digit);
+    }
+
+    if (i == digits_first)
+    {
+        return {0, std::errc::invalid_argument, T(0)};
+    }
+    if (overflowed)
+    {
+        return {i, std::errc::result_out_of_range, T(0)};
+    }
+
+    return {i, std::errc(), negative ? static_cast<T>(0U - value) : static_cast<T>(value)};
+}
+
+// The string is copied to a buffer of exactly its size, so that reading past it is caught by the sanitizers
+template <typename T>
+void test_string(const std::string& str, int base)
+{
+    std::unique_ptr<char[]> buffer(new char[str.size() + 1]);
+    std::memcpy(buffer.get(), str.data(), str.size());
+
+    const auto expected = reference_from_chars<T>(str, base);
+
+    T value = T(42);
+    const auto r = boost::charconv::from_chars(buffer.get(), buffer.get() + str.size(), value, base);
+
+    const bool ok = BOOST_TEST(r.ec == expected.ec) &&
+                    BOOST_TEST(value == (expected.ec == std::errc() ? expected.value : T(42))) &&
+                    BOOST_TEST(r.ptr == buffer.get() + expected.length);
+    if (!ok)
+    {
+        std::cerr << "String: " << str << ", base: " << base << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T>
+std::string to_string(T value, int base)
+{
+    char buffer[256];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, base);
+    return std::string(buffer, r.ptr);
+}
+
+template <typename T>
+void test_random_values(int base)
+{
+    const std::string terminators[] = {"", " ", "/", ":", "@", "`", "G", "g", "z", "8", "2", "\x80", "\xB0", "\xE6", "\xFF", "."};
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        using Unsigned = typename std::make_unsigned<T>::type;
+
+        const auto bits = static_cast<int>(rng() % static_cast<unsigned>(std::numeric_limits<Unsigned>::digits)) + 1;
+        auto value = static_cast<Unsigned>(rng() >> (64 - bits));
+        if (std::is_signed<T>::value && (rng() & 1U) != 0)
+        {
+            value = static_cast<Unsigned>(0U - value);
+        }
+
+        std::string str = to_string(static_cast<T>(value), base);
+        if ((rng() & 1U) != 0)
+        {
+            // Upper case hex digits
+            for (auto& c : str)
+            {
+                if (c >= 'a' && c <= 'f')
+                {
+                    c = static_cast<char>(c - 'a' + 'A');
+                }
+            }
+        }
+
+        const std::size_t leading_zeros = rng() % 20;
+        const std::size_t digits_first = (str[0] == '-') ? 1U : 0U;
+        str.insert(digits_first, leading_zeros, '0');
+
+        test_string<T>(str + terminators[rng() % (sizeof(terminators) / sizeof(terminators[0]))], base);
+    }
+}
+
+// Every length of input that fills the type, with and without an extra digit, and its largest magnitudes
+template <typename T>
+void test_limits(int base)
+{
+    const std::string max_str = to_string((std::numeric_limits<T>::max)(), base);
+    const std::string digits = base == 16 ? "0123456789abcdefABCDEF" : base == 8 ? "01234567" : "01";
+
+    test_string<T>(max_str, base);
+    test_string<T>(std::string(100, '0') + max_str, base);
+    test_string<T>(max_str + "0", base);
+    test_string<T>(max_str + "1x", base);
+    test_string<T>(to_string((std::numeric_limits<T>::min)(), base), base);
+
+    // The leading digit of a full width octal number only has width % 3 bits to spare
+    for (const char leading : digits)
+    {
+        std::string str(1, leading);
+        str += max_str.substr(1);
+        test_string<T>(str, base);
+
+        str += std::string(40, '0');
+        for (std::size_t len = 1; len <= str.size(); ++len)
+        {
+            test_string<T>(str.substr(0, len), base);
+            test_string<T>(str.substr(0, len) + "#", base);
+        }
+    }
+}
+
+template <typename T>
+void test_edge_cases(int base)
+{
+    test_string<T>("", base);
+    test_string<T>("-", base);
+    test_string<T>("0", base);
+    test_string<T>("-0", base);
+    test_string<T>("x", base);
+    test_string<T>(std::string(8, '0'), base);
+    test_string<T>(std::string(17, '0') + "x", base);
+    test_string<T>(std::string(300, '0'), base);
+    test_string<T>(std::string(300, '1'), base);
+    test_string<T>(std::string(300, '1') + "x", base);
+    test_string<T>("0x10", base);
+}
+
+template <typename T>
+void test_type()
+{
+    for (const int base : {2, 8, 16})
+    {
+        test_random_values<T>(base);
+        test_limits<T>(base);
+        test_edge_cases<T>(base);
+    }
+}
+
+// Other bases and a group separator still read one character at a time
+void test_other_paths()
+{
+    std::uint32_t value = 0;
+    const char str[] = "3vvvvvv";
+    auto r = boost::charconv::from_chars(str, str + 7, value, 32);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST_EQ(value, UINT32_MAX);
+
+    std::uint64_t value64 = 0;
+    const char hex[] = "0123456789abcdefGH";
+    r = boost::charconv::from_chars(hex, hex + 18, value64, 17);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(r.ptr == hex + 17);
+
+    r = boost::charconv::from_chars(hex, hex + 18, value64, 16);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(r.ptr == hex + 16);
+    BOOST_TEST_EQ(value64, UINT64_C(0x0123456789abcdef));
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+void test_uint128()
+{
+    boost::uint128_type value = 0;
+    const std::string max_str(32, 'f');
+    auto r = boost::charconv::from_chars(max_str.data(), max_str.data() + max_str.size(), value, 16);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(value == BOOST_CHARCONV_UINT128_MAX);
+
+    const std::string too_long = std::string(1, '1') + std::string(32, '0');
+    r = boost::charconv::from_chars(too_long.data(), too_long.data() + too_long.size(), value, 16);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(r.ptr == too_long.data() + too_long.size());
+
+    // 2^128 - 1 is 3 followed by 42 7s in octal
+    const std::string octal_max = std::string(1, '3') + std::string(42, '7');
+    r = boost::charconv::from_chars(octal_max.data(), octal_max.data() + octal_max.size(), value, 8);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(value == BOOST_CHARCONV_UINT128_MAX);
+
+    const std::string octal_over = std::string(1, '4') + std::string(42, '0');
+    r = boost::charconv::from_chars(octal_over.data(), octal_over.data() + octal_over.size(), value, 8);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+
+    boost::int128_type signed_value = 0;
+    const std::string min_str = "-1" + std::string(127, '0');
+    r = boost::charconv::from_chars(min_str.data(), min_str.data() + min_str.size(), signed_value, 2);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(signed_value == BOOST_CHARCONV_INT128_MIN);
+
+    r = boost::charconv::from_chars(min_str.data() + 1, min_str.data() + min_str.size(), signed_value, 2);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+}
+#endif
+
+int main()
+{
+    test_type<unsigned char>();
+    test_type<signed char>();
+    test_type<unsigned short>();
+    test_type<short>();
+    test_type<unsigned>();
+    test_type<int>();
+    test_type<unsigned long>();
+    test_type<long>();
+    test_type<unsigned long long>();
+    test_type<long long>();
+
+    test_other_paths();
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    test_uint128();
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,250 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// from_chars_saturating gives the same value and end as from_chars for values in range, and clamps the others to the
+// limits of the type with the end after all of their digits
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <type_traits>
+#include <random>
+#include <string>
+#include <limits>
+#include <iostream>
+#include <cstdint>
+
+static std::mt19937_64 rng(42);
+
+static const char digit_chars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+template <typename T>
+void test_string(const std::string& str, int base)
+{
+    T expected = 42;
+    const auto er = boost::charconv::from_chars(str.data(), str.data() + str.size(), expected, base);
+
+    T value = 42;
+    const auto r = boost::charconv::from_chars_saturating(str.data(), str.data() + str.size(), value, base);
+
+    if (er.ec == std::errc::result_out_of_range)
+    {
+        // Either limit, from the sign
+        const T limit = str[0] == '-' ? (std::numeric_limits<T>::min)() : (std::numeric_limits<T>::max)();
+        BOOST_TEST(r);
+        BOOST_TEST(r.ptr == er.ptr);
+        if (!BOOST_TEST(value == limit))
+        {
+            // LCOV_EXCL_START
+            std::cerr << "Input: " << str << "\nBase: " << base << std::endl;
+            // LCOV_EXCL_STOP
+        }
+    }
+    else
+    {
+        BOOST_TEST(r.ec == er.ec);
+        BOOST_TEST(r.ptr == er.ptr);
+        BOOST_TEST(value == expected);
+    }
+
+    // The end of an out of range value is the first character that is not a digit of base
+    std::size_t end = str[0] == '-' ? 1 : 0;
+    while (end < str.size() && std::string(digit_chars, static_cast<std::size_t>(base)).find(str[end]) != std::string::npos)
+    {
+        ++end;
+    }
+    if (er.ec == std::errc::result_out_of_range)
+    {
+        BOOST_TEST_EQ(static_cast<std::size_t>(er.ptr - str.data()), end);
+    }
+}
+
+template <typename T>
+void test_random()
+{
+    for (int i = 0; i < 20000; ++i)
+    {
+        const int base = static_cast<int>(2 + rng() % 35);
+        std::string str = std::is_signed<T>::value && rng() % 2 == 0 ? "-" : "";
+        const auto length = rng() % 80;
+        for (std::size_t j = 0; j < length; ++j)
+        {
+            str += digit_chars[rng() % static_cast<std::uint64_t>(base)];
+        }
+        if (rng() % 2 == 0)
+        {
+            str += rng() % 2 == 0 ? "," : "z";
+        }
+
+        test_string<T>(str, base);
+        test_string<T>(str, 10);
+    }
+}
+
+template <typename T>
+void test_limits()
+{
+    for (const int base : {2, 8, 10, 16, 36})
+    {
+        char buffer[256];
+        auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), (std::numeric_limits<T>::max)(), base);
+        const std::string max_str(buffer, r.ptr);
+        r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), (std::numeric_limits<T>::min)(), base);
+        const std::string min_str(buffer, r.ptr);
+
+        for (const std::string& str : {max_str, min_str, max_str + "0", min_str + "0", max_str + "1", "-" + max_str + "9",
+                                       max_str + std::string(40, digit_chars[base - 1]), max_str + "0;"})
+        {
+            test_string<T>(str, base);
+        }
+    }
+}
+
+// The value of the digits of str in base, accumulated in 64 bits one digit at a time and checked against the
+// limits of T, which is what from_chars gives for every type of up to 64 bits
+template <typename T>
+void test_accumulator(const std::string& str, int base)
+{
+    const bool negative = str[0] == '-';
+    const std::uint64_t limit = negative ? static_cast<std::uint64_t>(-static_cast<std::int64_t>((std::numeric_limits<T>::min)() + 1)) + 1 :
+                                           static_cast<std::uint64_t>((std::numeric_limits<T>::max)());
+    std::uint64_t magnitude = 0;
+    bool overflowed = false;
+    for (std::size_t i = negative ? 1 : 0; i < str.size(); ++i)
+    {
+        const auto digit = static_cast<std::uint64_t>(std::string(digit_chars).find(str[i]));
+        if (overflowed || limit < digit || magnitude > (limit - digit) / static_cast<std::uint64_t>(base))
+        {
+            overflowed = true;
+        }
+        else
+        {
+            magnitude = magnitude * static_cast<std::uint64_t>(base) + digit;
+        }
+    }
+
+    T value = 42;
+    auto r = boost::charconv::from_chars(str.data(), str.data() + str.size(), value, base);
+    BOOST_TEST(r.ptr == str.data() + str.size());
+    if (overflowed)
+    {
+        BOOST_TEST(r.ec == std::errc::result_out_of_range);
+        BOOST_TEST_EQ(value, static_cast<T>(42));
+    }
+    else
+    {
+        const T expected = negative ? static_cast<T>(0 - magnitude) : static_cast<T>(magnitude);
+        BOOST_TEST(r);
+        if (!BOOST_TEST_EQ(value, expected))
+        {
+            std::cerr << "Input: " << str << "\nBase: " << base << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+
+    r = boost::charconv::from_chars_saturating(str.data(), str.data() + str.size(), value, base);
+    BOOST_TEST(r && r.ptr == str.data() + str.size());
+    if (overflowed)
+    {
+        BOOST_TEST_EQ(value, negative ? (std::numeric_limits<T>::min)() : (std::numeric_limits<T>::max)());
+    }
+}
+
+// Around the width of the limit in every base, where the digits that cannot overflow end
+template <typename T>
+void test_bases()
+{
+    for (int base = 2; base <= 36; ++base)
+    {
+        char buffer[128];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), (std::numeric_limits<T>::max)(), base);
+        const auto width = static_cast<std::size_t>(r.ptr - buffer);
+
+        for (int i = 0; i < 500; ++i)
+        {
+            std::string str = std::is_signed<T>::value && rng() % 2 == 0 ? "-" : "";
+            const auto length = width - 2 + rng() % 4;
+            str += digit_chars[1 + rng() % static_cast<std::uint64_t>(base - 1)];
+            for (std::size_t j = 1; j < length; ++j)
+            {
+                str += digit_chars[rng() % static_cast<std::uint64_t>(base)];
+            }
+
+            test_accumulator<T>(str, base);
+        }
+    }
+
+    // All digits the largest of their base
+    for (int base = 2; base <= 36; ++base)
+    {
+        for (std::size_t length = 1; length <= 20; ++length)
+        {
+            test_accumulator<T>(std::string(length, digit_chars[base - 1]), base);
+        }
+    }
+}
+
+int main()
+{
+    test_random<std::int8_t>();
+    test_random<std::uint8_t>();
+    test_random<std::int32_t>();
+    test_random<std::uint32_t>();
+    test_random<std::int64_t>();
+    test_random<std::uint64_t>();
+
+    test_limits<std::int8_t>();
+    test_limits<std::uint16_t>();
+    test_limits<std::int64_t>();
+    test_limits<std::uint64_t>();
+
+    test_bases<std::int8_t>();
+    test_bases<std::uint8_t>();
+    test_bases<std::int16_t>();
+    test_bases<std::uint16_t>();
+    test_bases<std::int32_t>();
+    test_bases<std::uint32_t>();
+    test_bases<std::int64_t>();
+    test_bases<std::uint64_t>();
+
+    // Bases above 10 whose first digits10 digits can overflow
+    int int_value = 42;
+    auto br = boost::charconv::from_chars(boost::core::string_view("zzzzzz"), int_value, 36);
+    BOOST_TEST(br.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(int_value, 42);
+    std::uint8_t byte_value = 42;
+    br = boost::charconv::from_chars_saturating(boost::core::string_view("fb"), byte_value, 19);
+    BOOST_TEST(br);
+    BOOST_TEST_EQ(byte_value, 255U);
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    test_random<boost::int128_type>();
+    test_random<boost::uint128_type>();
+    #endif
+
+    std::uint8_t value {};
+    const char str[] = "1000,";
+    auto r = boost::charconv::from_chars_saturating(str, str + 5, value);
+    BOOST_TEST(r && r.ptr == str + 4);
+    BOOST_TEST_EQ(value, 255U);
+
+    std::int64_t signed_value {};
+    r = boost::charconv::from_chars_saturating(boost::core::string_view("-99999999999999999999999999999x"), signed_value);
+    BOOST_TEST(r && *r.ptr == 'x');
+    BOOST_TEST_EQ(signed_value, INT64_MIN);
+
+    // Invalid input is still an error
+    r = boost::charconv::from_chars_saturating(boost::core::string_view("-"), signed_value);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+
+    // The digits after an overflow are skipped with the group separators between them
+    int grouped = 42;
+    const std::string grouped_str = "123,456,789,012,345,678,901,234";
+    const auto gr = boost::charconv::from_chars(grouped_str.data(), grouped_str.data() + grouped_str.size(), grouped,
+                                                boost::charconv::chars_format_options('.', 'e', ','));
+    BOOST_TEST(gr.ec == std::errc::result_out_of_range);
+    BOOST_TEST(gr.ptr == grouped_str.data() + grouped_str.size());
+    BOOST_TEST_EQ(grouped, 42);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,235 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/charconv/detail/from_chars_slow_path.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <cstdio>
+#include <cmath>
+#include <limits>
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 1024;
+
+template <typename T>
+T reference_strtod(const char* str);
+
+template <>
+float reference_strtod<float>(const char* str) { return std::strtof(str, nullptr); }
+
+template <>
+double reference_strtod<double>(const char* str) { return std::strtod(str, nullptr); }
+
+template <>
+long double reference_strtod<long double>(const char* str) { return std::strtold(str, nullptr); }
+
+template <typename T>
+void test_value(const std::string& str, T expected, std::errc expected_ec = std::errc())
+{
+    T value {};
+    const auto r = boost::charconv::detail::from_chars_slow_path(str.data(), str.data() + str.size(), value,
+                                                                 str.find('p') != std::string::npos ? boost::charconv::chars_format::hex :
+                                                                                                      boost::charconv::chars_format::general);
+    if (!BOOST_TEST(r.ec == expected_ec) || !BOOST_TEST(r.ptr == str.data() + str.size()) || !BOOST_TEST_EQ(value, expected))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+
+    BOOST_TEST_EQ(std::signbit(value), std::signbit(expected));
+}
+
+// Long digit strings with exponents spread over the whole range of T compared against the C library
+template <typename T>
+void test_random_digits()
+{
+    std::uniform_int_distribution<int> digit_dist(0, 9);
+    std::uniform_int_distribution<int> length_dist(1, 60);
+    std::uniform_int_distribution<int> exponent_dist(std::numeric_limits<T>::min_exponent10 - 40, std::numeric_limits<T>::max_exponent10 + 2);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        std::string str = (i & 1U) != 0 ? "-" : "";
+        str += static_cast<char>('1' + digit_dist(rng) % 9);
+        str += '.';
+
+        const int length = length_dist(rng);
+        for (int j = 0; j < length; ++j)
+        {
+            str += static_cast<char>('0' + digit_dist(rng));
+        }
+
+        str += 'e';
+        str += std::to_string(exponent_dist(rng));
+
+        errno = 0;
+        const T expected = reference_strtod<T>(str.c_str());
+        const bool out_of_range = expected == 0 || expected == std::numeric_limits<T>::infinity() || expected == -std::numeric_limits<T>::infinity();
+
+        T value {};
+        const auto r = boost::charconv::detail::from_chars_slow_path(str.data(), str.data() + str.size(), value, boost::charconv::chars_format::general);
+
+        if (out_of_range)
+        {
+            BOOST_TEST(r.ec == std::errc::result_out_of_range);
+        }
+        else
+        {
+            if (!BOOST_TEST(r) || !BOOST_TEST_EQ(value, expected))
+            {
+                std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+            }
+        }
+    }
+}
+
+// Exactly halfway between two doubles, then just above and below
+void test_halfway()
+{
+    std::uniform_int_distribution<std::uint64_t> significand_dist(0, (UINT64_C(1) << 52) - 1);
+    std::uniform_int_distribution<int> exponent_dist(-1022, 1022);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const std::uint64_t significand = significand_dist(rng);
+        const int exponent = exponent_dist(rng);
+
+        char buffer[64];
+        std::snprintf(buffer, sizeof(buffer), "1.%013llx", static_cast<unsigned long long>(significand));
+        const std::string digits = buffer;
+        const std::string exp_str = 'p' + std::to_string(exponent);
+
+        const double lower = std::ldexp(1.0 + static_cast<double>(significand) / 4503599627370496.0, exponent);
+        const double upper = std::nextafter(lower, std::numeric_limits<double>::infinity());
+
+        test_value<double>(digits + "8" + exp_str, (significand & 1U) == 0 ? lower : upper);
+        test_value<double>(digits + "80000000000000000000000001" + exp_str, upper);
+        test_value<double>(digits + "7ffffffffffffffffffffffff" + exp_str, lower);
+    }
+}
+
+void test_double_special_cases()
+{
+    // Ties to even
+    test_value<double>("9007199254740993", 9007199254740992.0);
+    test_value<double>("9007199254740995", 9007199254740996.0);
+    test_value<double>("9007199254740993.0000000000000000000000000000000000000001", 9007199254740994.0);
+
+    // Smallest and largest values
+    test_value<double>("4.9406564584124654e-324", std::numeric_limits<double>::denorm_min());
+    test_value<double>("2.2250738585072014e-308", std::numeric_limits<double>::min());
+    test_value<double>("2.2250738585072011e-308", 2.2250738585072009e-308);
+    test_value<double>("1.7976931348623157e308", std::numeric_limits<double>::max());
+    test_value<double>("-1.7976931348623157e308", -std::numeric_limits<double>::max());
+
+    // Halfway between zero and the smallest subnormal rounds to zero, anything larger rounds up
+    const std::string half_denorm_min = "2.4703282292062327208828439643411068618252990130716238221279284125033775363510437593264991818081799618989828234772285886546332835517796989819938739800539093906315035659515570226392290858392449105184435931802849936536152500319370457678249219365623669863658480757001585769269903706311928279558551332927834338409351978015531246597263579574622766465272827220056374006485499977096599470454020828166226237857393450736339007967761930577506740176324673600968951340535537458516661134223766678604162159680461914467291840300530057530849048765391711386591646239524912623653881879636239373280423891018672348497668235089863388587925628302755995657524455507255189313690836254779186948667994968324049705821028513185451396213837722826145437693412532098591327667236328125";
+    test_value<double>(half_denorm_min + "e-324", 0.0, std::errc::result_out_of_range);
+    test_value<double>(half_denorm_min + "0000000000000000000000000000000000001e-324", std::numeric_limits<double>::denorm_min());
+    test_value<double>("-" + half_denorm_min + "1e-324", -std::numeric_limits<double>::denorm_min());
+
+    // Halfway between the largest value and the next power of two rounds to infinity
+    test_value<double>("1.79769313486231580793728971405303415079934132710037827e308", std::numeric_limits<double>::infinity(), std::errc::result_out_of_range);
+    test_value<double>("1.79769313486231580793728971405303415079934132710037826e308", std::numeric_limits<double>::max());
+
+    test_value<double>("1.79769313486231580793728971405303415079934132710037826936173778980444968292764750946649017977587207096330286416692887910946555547851940402630657488671505820681908902000708383676273854845817711531764475730270069855571366959622842914819860834936475292719074168444365510704342711559699508093042880177904174497792e308", std::numeric_limits<double>::infinity(), std::errc::result_out_of_range);
+
+    // Out of range
+    test_value<double>("1e-400", 0.0, std::errc::result_out_of_range);
+    test_value<double>("-1e-400", -0.0, std::errc::result_out_of_range);
+    test_value<double>("1e400", std::numeric_limits<double>::infinity(), std::errc::result_out_of_range);
+    test_value<double>("1e999999999999999999", std::numeric_limits<double>::infinity(), std::errc::result_out_of_range);
+    test_value<double>("0.0000e999999999999999999", 0.0);
+
+    // Leading and trailing zeros
+    test_value<double>("000000000000000000000000000000000000000123.45000000000000000000000000000000000000", 123.45);
+    test_value<double>("0.000000000000000000000000000000000000000012345", 1.2345e-41);
+}
+
+// Hex values have been parsed as if they were decimal in the past
+void test_hex()
+{
+    const auto hex = boost::charconv::chars_format::hex;
+
+    double d {};
+    BOOST_TEST(boost::charconv::from_chars("1.8p+1", d, hex));
+    BOOST_TEST_EQ(d, 3.0);
+    BOOST_TEST(boost::charconv::from_chars("-1.3a2bp-10", d, hex));
+    BOOST_TEST_EQ(d, -std::ldexp(80427.0, -26));
+    BOOST_TEST(boost::charconv::from_chars("0.1p0", d, hex));
+    BOOST_TEST_EQ(d, 0.0625);
+    BOOST_TEST(boost::charconv::from_chars("1p-1074", d, hex));
+    BOOST_TEST_EQ(d, std::numeric_limits<double>::denorm_min());
+    BOOST_TEST(boost::charconv::from_chars("1.fffffffffffffp+1023", d, hex));
+    BOOST_TEST_EQ(d, std::numeric_limits<double>::max());
+    BOOST_TEST(boost::charconv::from_chars("2p+1023", d, hex).ec == std::errc::result_out_of_range);
+
+    float f {};
+    BOOST_TEST(boost::charconv::from_chars("1.8p+1", f, hex));
+    BOOST_TEST_EQ(f, 3.0F);
+    BOOST_TEST(boost::charconv::from_chars("1p-149", f, hex));
+    BOOST_TEST_EQ(f, std::numeric_limits<float>::denorm_min());
+    BOOST_TEST(boost::charconv::from_chars("1.fffffep+127", f, hex));
+    BOOST_TEST_EQ(f, std::numeric_limits<float>::max());
+    BOOST_TEST(boost::charconv::from_chars("1.fffffffp+127", f, hex).ec == std::errc::result_out_of_range);
+
+    long double ld {};
+    BOOST_TEST(boost::charconv::from_chars("1.8p+1", ld, hex));
+    BOOST_TEST_EQ(ld, 3.0L);
+    BOOST_TEST(boost::charconv::from_chars("abc.defp-3", ld, hex));
+    BOOST_TEST_EQ(ld, std::ldexp(11259375.0L, -15));
+
+    // Round trip through to_chars
+    std::uniform_real_distribution<double> dist(-1e300, 1e300);
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const double val = dist(rng);
+        char buffer[64];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), val, hex);
+        BOOST_TEST(r);
+        double parsed {};
+        BOOST_TEST(boost::charconv::from_chars(buffer, r.ptr, parsed, hex));
+        BOOST_TEST_EQ(parsed, val);
+    }
+}
+
+// long double values that do not fit the fast path
+void test_long_double()
+{
+    const auto check = [](const char* str)
+    {
+        const long double expected = std::strtold(str, nullptr);
+        long double value {};
+        const auto r = boost::charconv::from_chars(str, str + std::strlen(str), value);
+        if (!BOOST_TEST(r) || !BOOST_TEST_EQ(value, expected))
+        {
+            std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+        }
+    };
+
+    check("1.18973149535723176502e+4932");
+    check("3.64519953188247460253e-4951");
+    check("1.00000000000000000000000000000000000000000000000000000001");
+    check("123456789012345678901234567890123456789012345678901234567890e-100");
+    check("0.999999999999999999999999999999999999999999999999999999999e-4940");
+}
+
+int main()
+{
+    test_double_special_cases();
+    test_hex();
+    test_long_double();
+
+    test_random_digits<float>();
+    test_random_digits<double>();
+    test_random_digits<long double>();
+
+    test_halfway();
+
+    return boost::report_errors();
+}
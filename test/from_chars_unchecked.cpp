@@ -0,0 +1,197 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// from_chars_unchecked must read back everything that to_chars writes exactly as from_chars does
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <type_traits>
+#include <random>
+#include <memory>
+#include <string>
+#include <limits>
+#include <iomanip>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+static std::mt19937_64 rng(42);
+
+// The characters are copied to a buffer of exactly their size, so that reading past last is caught by the sanitizers
+template <typename T, typename... Args>
+void test_string(const char* first, const char* last, Args... args)
+{
+    const auto size = static_cast<std::size_t>(last - first);
+    std::unique_ptr<char[]> buffer(new char[size]);
+    std::memcpy(buffer.get(), first, size);
+
+    // Values out of the range of the type are still well formed, and both report the same error
+    T expected {};
+    const auto r1 = boost::charconv::from_chars(buffer.get(), buffer.get() + size, expected, args...);
+    BOOST_TEST(r1.ptr == buffer.get() + size);
+
+    T value {};
+    const auto r2 = boost::charconv::from_chars_unchecked(buffer.get(), buffer.get() + size, value, args...);
+    BOOST_TEST(r2.ec == r1.ec);
+    BOOST_TEST(r2.ptr == buffer.get() + size);
+
+    // Compares the bits, so that -0.0 is told apart from 0.0
+    if (!BOOST_TEST(std::memcmp(&value, &expected, sizeof(T)) == 0))
+    {
+        std::cerr << "String: " << std::string(first, last) << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T>
+void test_integer(T value)
+{
+    char buffer[256];
+    for (const int base : {2, 3, 8, 10, 16, 36})
+    {
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, base);
+        BOOST_TEST(r);
+        test_string<T>(buffer, r.ptr, base);
+    }
+}
+
+template <typename T>
+void test_integer_type()
+{
+    using Unsigned = boost::charconv::detail::make_unsigned_t<T>;
+    constexpr int bits = std::numeric_limits<Unsigned>::digits;
+
+    test_integer(T(0));
+    test_integer((std::numeric_limits<T>::max)());
+    test_integer((std::numeric_limits<T>::min)());
+
+    for (int width = 1; width <= bits; ++width)
+    {
+        for (int i = 0; i < 20; ++i)
+        {
+            const auto value = static_cast<Unsigned>(rng() >> (64 - width));
+            test_integer(static_cast<T>(value));
+        }
+    }
+}
+
+template <typename T>
+void test_float(T value)
+{
+    char buffer[512];
+
+    for (const auto fmt : {boost::charconv::chars_format::general, boost::charconv::chars_format::scientific, boost::charconv::chars_format::fixed})
+    {
+        auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt);
+        BOOST_TEST(r);
+        test_string<T>(buffer, r.ptr);
+
+        const int precision = static_cast<int>(rng() % 30);
+        r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt, precision);
+        BOOST_TEST(r);
+        test_string<T>(buffer, r.ptr);
+    }
+}
+
+template <typename T>
+void test_float_type()
+{
+    using Bits = typename std::conditional<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>::type;
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        T value;
+        Bits bits;
+        do
+        {
+            bits = static_cast<Bits>(rng());
+            std::memcpy(&value, &bits, sizeof(value));
+        } while (!std::isfinite(value));
+
+        test_float(value);
+    }
+
+    const T spot_values[] = {T(0), -T(0), T(1), T(-1), T(0.1), T(123456), T(1e-5), T(0.5),
+                             (std::numeric_limits<T>::max)(), (std::numeric_limits<T>::min)(),
+                             std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::lowest()};
+    for (const T value : spot_values)
+    {
+        test_float(value);
+    }
+}
+
+// Hand written canonical strings, including more significant digits than 64 bits hold
+void test_float_strings()
+{
+    const char* const strings[] = {"0", "-0", "7", "1e+00", "1e-05", "1.5e+300", "-2.2250738585072014e-308",
+                                   "4.9406564584124654e-324", "123.456", "0.000001",
+                                   "3.14159265358979323846264338327950288419716939937510",
+                                   "10000000000000000000000000000000000000000.5", "9007199254740993",
+                                   "0.00000000000000000000000000000000000000000000000000000000001"};
+    for (const char* str : strings)
+    {
+        test_string<double>(str, str + std::strlen(str));
+        test_string<float>(str, str + std::strlen(str));
+    }
+
+    double value {};
+    const std::string str = "2.5e-10";
+    const auto r = boost::charconv::from_chars_unchecked(boost::core::string_view(str), value);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST_EQ(value, 2.5e-10);
+}
+
+#if !defined(BOOST_CHARCONV_NO_CONSTEXPR_DETECTION) && !defined(BOOST_NO_CXX14_CONSTEXPR)
+constexpr bool constexpr_unchecked()
+{
+    const char str[] = "-123456789012";
+    long long value = 0;
+    const auto r = boost::charconv::from_chars_unchecked(str, str + sizeof(str) - 1, value);
+    return r.ptr == str + sizeof(str) - 1 && value == -123456789012LL;
+}
+
+static_assert(constexpr_unchecked(), "from_chars_unchecked at compile time");
+#endif
+
+int main()
+{
+    test_integer_type<char>();
+    test_integer_type<signed char>();
+    test_integer_type<unsigned char>();
+    test_integer_type<short>();
+    test_integer_type<unsigned short>();
+    test_integer_type<int>();
+    test_integer_type<unsigned>();
+    test_integer_type<long>();
+    test_integer_type<unsigned long>();
+    test_integer_type<long long>();
+    test_integer_type<unsigned long long>();
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    {
+        test_integer(BOOST_CHARCONV_UINT128_MAX);
+        test_integer(BOOST_CHARCONV_INT128_MIN);
+        test_integer(BOOST_CHARCONV_INT128_MAX);
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            const auto value = (static_cast<boost::uint128_type>(rng()) << 64 | rng()) >> (rng() % 128);
+            test_integer(value);
+            test_integer(static_cast<boost::int128_type>(value));
+        }
+    }
+    #endif
+
+    std::string str = "42";
+    int value = 0;
+    BOOST_TEST(boost::charconv::from_chars_unchecked(boost::core::string_view(str), value));
+    BOOST_TEST_EQ(value, 42);
+
+    test_float_type<float>();
+    test_float_type<double>();
+    test_float_strings();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,146 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// parse<T>(first, last) returns the same value, ptr and ec as from_chars(first, last, value)
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <string>
+#include <limits>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+
+static std::mt19937_64 rng(42);
+
+template <typename T>
+void test_integer(const std::string& str, int base)
+{
+    T expected {};
+    const auto er = boost::charconv::from_chars(str.data(), str.data() + str.size(), expected, base);
+    const auto r = boost::charconv::parse<T>(str.data(), str.data() + str.size(), base);
+    BOOST_TEST(r.ec == er.ec);
+    BOOST_TEST(r.ptr == er.ptr);
+    if (!BOOST_TEST(r.value == expected))
+    {
+        // LCOV_EXCL_START
+        std::cerr << "Input: " << str << "\nBase: " << base << std::endl;
+        // LCOV_EXCL_STOP
+    }
+
+    const auto sr = boost::charconv::parse<T>(boost::core::string_view(str), base);
+    BOOST_TEST(sr == r);
+}
+
+template <typename T>
+void test_integers()
+{
+    std::uniform_int_distribution<T> dist((std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+    for (int i = 0; i < 10000; ++i)
+    {
+        const int base = static_cast<int>(2 + rng() % 35);
+        char buffer[128];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), dist(rng), base);
+        test_integer<T>(std::string(buffer, r.ptr), base);
+        test_integer<T>(std::string(buffer, r.ptr) + "9z", base);
+    }
+
+    for (const std::string str : {"", "-", "+1", "x", "99999999999999999999999999999999999999999", "0x1f"})
+    {
+        test_integer<T>(str, 10);
+        test_integer<T>(str, 0);
+    }
+}
+
+template <typename T, typename Bits>
+void test_floats()
+{
+    for (int i = 0; i < 10000; ++i)
+    {
+        const auto bits = static_cast<Bits>(rng());
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        for (const auto fmt : {boost::charconv::chars_format::general, boost::charconv::chars_format::scientific,
+                               boost::charconv::chars_format::hex})
+        {
+            char buffer[128];
+            const auto tr = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt);
+            const std::string str(buffer, tr.ptr);
+
+            T expected {};
+            const auto er = boost::charconv::from_chars(str.data(), str.data() + str.size(), expected, fmt);
+            const auto r = boost::charconv::parse<T>(str.data(), str.data() + str.size(), fmt);
+            BOOST_TEST(r.ec == er.ec);
+            BOOST_TEST(r.ptr == er.ptr);
+            BOOST_TEST(std::memcmp(&r.value, &expected, sizeof(T)) == 0);
+
+            const auto sr = boost::charconv::parse<T>(boost::core::string_view(str), fmt);
+            BOOST_TEST(std::memcmp(&sr.value, &r.value, sizeof(T)) == 0 && sr.ptr == r.ptr && sr.ec == r.ec);
+        }
+    }
+}
+
+#if !(defined(__GNUC__) && __GNUC__ == 5) && !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+constexpr boost::charconv::from_chars_value<int> constexpr_test_helper()
+{
+    return boost::charconv::parse<int>(boost::core::string_view("-42"));
+}
+
+static_assert(constexpr_test_helper().value == -42, "Value is -42");
+static_assert(constexpr_test_helper().ec == std::errc(), "No error");
+
+#endif
+
+int main()
+{
+    test_integers<std::int8_t>();
+    test_integers<std::uint16_t>();
+    test_integers<std::int32_t>();
+    test_integers<std::uint32_t>();
+    test_integers<std::int64_t>();
+    test_integers<std::uint64_t>();
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    test_integer<boost::int128_type>("-170141183460469231731687303715884105728", 10);
+    test_integer<boost::uint128_type>("340282366920938463463374607431768211456", 10);
+    #endif
+
+    test_floats<double, std::uint64_t>();
+    test_floats<float, std::uint32_t>();
+
+    const char str[] = "12,3.5";
+    const auto r = boost::charconv::parse<unsigned>(str, str + 6);
+    BOOST_TEST(r && r.value == 12U && *r.ptr == ',');
+    const auto fr = boost::charconv::parse<double>(r.ptr + 1, str + 6);
+    BOOST_TEST(fr && fr.value == 3.5 && fr.ptr == str + 6);
+
+    // On failure the value is T{} for integers
+    const auto er = boost::charconv::parse<int>(boost::core::string_view("-"));
+    BOOST_TEST(!er && er.ec == std::errc::invalid_argument && er.value == 0);
+
+    // from_chars with the type of a reference given explicitly still writes the value through it
+    int value = 42;
+    const auto vr = boost::charconv::from_chars<int>(str, str + 6, value);
+    BOOST_TEST(vr && vr.ptr == str + 2);
+    BOOST_TEST_EQ(value, 12);
+    value = 42;
+    const auto zr = boost::charconv::from_chars<int>(str, str + 6, value, 16);
+    BOOST_TEST(zr && zr.ptr == str + 2);
+    BOOST_TEST_EQ(value, 0x12);
+    std::uint64_t wide_value = 0;
+    BOOST_TEST(boost::charconv::from_chars<std::uint64_t>(boost::core::string_view("18446744073709551615"), wide_value));
+    BOOST_TEST_EQ(wide_value, UINT64_MAX);
+
+    // A zero value is not taken for the base
+    value = 0;
+    const char digits[] = "77";
+    BOOST_TEST(boost::charconv::from_chars<int>(digits, digits + 2, value));
+    BOOST_TEST_EQ(value, 77);
+
+    return boost::report_errors();
+}
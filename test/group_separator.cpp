@@ -0,0 +1,309 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <string>
+#include <limits>
+#include <type_traits>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+using boost::charconv::chars_format_options;
+
+static std::mt19937_64 rng(42);
+
+// The same string with separator between every three digits of the integer part
+std::string group(std::string str, char separator)
+{
+    const std::size_t digits_first = !str.empty() && str[0] == '-' ? 1 : 0;
+    std::size_t digits_last = digits_first;
+    while (digits_last < str.size() && str[digits_last] >= '0' && str[digits_last] <= '9')
+    {
+        ++digits_last;
+    }
+
+    while (digits_last > digits_first + 3)
+    {
+        digits_last -= 3;
+        str.insert(digits_last, 1, separator);
+    }
+    return str;
+}
+
+template <typename T>
+void test_integer_value(T value, chars_format_options options)
+{
+    char expected[128];
+    const auto expected_r = boost::charconv::to_chars(expected, expected + sizeof(expected), value);
+    BOOST_TEST(expected_r);
+    const std::string expected_str = group(std::string(expected, expected_r.ptr), options.group_separator);
+
+    char buffer[128];
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, options);
+    const std::string str(buffer, r.ptr);
+    if (!BOOST_TEST(r) || !BOOST_TEST_EQ(str, expected_str))
+    {
+        std::cerr << "Value: " << std::string(expected, expected_r.ptr) << std::endl; // LCOV_EXCL_LINE
+    }
+
+    T roundtrip = T(42);
+    const auto from_r = boost::charconv::from_chars(str.data(), str.data() + str.size(), roundtrip, options);
+    BOOST_TEST(from_r);
+    BOOST_TEST(from_r.ptr == str.data() + str.size());
+    BOOST_TEST(roundtrip == value);
+
+    // Exactly enough room, and one less
+    const auto length = static_cast<std::ptrdiff_t>(str.size());
+    r = boost::charconv::to_chars(buffer, buffer + length, value, options);
+    BOOST_TEST(r);
+    BOOST_TEST(r.ptr == buffer + length);
+    r = boost::charconv::to_chars(buffer, buffer + length - 1, value, options);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(r.ptr == buffer + length - 1);
+}
+
+template <typename T>
+void test_integer()
+{
+    std::uniform_int_distribution<T> dist((std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+    for (const auto options : {chars_format_options('.', 'e', ','), chars_format_options(',', 'e', '.'), chars_format_options('.', 'e', '_'),
+                               chars_format_options('.', 'e', '\'')})
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            test_integer_value(static_cast<T>(dist(rng) >> (i % (static_cast<int>(sizeof(T)) * 8))), options);
+        }
+
+        for (const T value : {T(0), T(1), T(12), T(123), T(999), T(100), (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)()})
+        {
+            test_integer_value(value, options);
+        }
+    }
+
+    // Without a separator nothing changes
+    char buffer[64];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), (std::numeric_limits<T>::max)(), chars_format_options());
+    const auto expected_r = boost::charconv::to_chars(buffer + 32, buffer + sizeof(buffer), (std::numeric_limits<T>::max)());
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), std::string(buffer + 32, expected_r.ptr));
+}
+
+template <typename T>
+void test_integer_parse(const std::string& str, std::errc expected_ec, std::size_t expected_length, T expected = T(42))
+{
+    const chars_format_options options('.', 'e', ',');
+    T value = T(42);
+    const auto r = boost::charconv::from_chars(str.data(), str.data() + str.size(), value, options);
+    if (!BOOST_TEST(r.ec == expected_ec) || !BOOST_TEST_EQ(r.ptr - str.data(), static_cast<std::ptrdiff_t>(expected_length)) ||
+        !BOOST_TEST_EQ(value, expected))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+
+    T sv_value = T(42);
+    const auto sv_r = boost::charconv::from_chars(boost::core::string_view(str), sv_value, options);
+    BOOST_TEST(sv_r.ptr == r.ptr);
+    BOOST_TEST_EQ(sv_value, value);
+}
+
+// Formatting with a group separator writes what to_chars writes with the separators added, and parses back to the same value
+template <typename T, typename... Args>
+void test_float_value(T value, chars_format_options options, chars_format fmt, Args... args)
+{
+    char plain[1200];
+    const auto plain_r = boost::charconv::to_chars(plain, plain + sizeof(plain), value, fmt, args..., chars_format_options(options.decimal_point));
+    BOOST_TEST(plain_r);
+    const std::string expected_str = group(std::string(plain, plain_r.ptr), options.group_separator);
+
+    char buffer[1200];
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt, args..., options);
+    BOOST_TEST(r);
+    const std::string str(buffer, r.ptr);
+    BOOST_TEST_EQ(str, expected_str);
+
+    T roundtrip = T(42);
+    const auto from_r = boost::charconv::from_chars(str.data(), str.data() + str.size(), roundtrip, fmt, options);
+    T parsed = T(42);
+    const auto parsed_r = boost::charconv::from_chars(plain, plain_r.ptr, parsed, fmt, chars_format_options(options.decimal_point));
+    BOOST_TEST(from_r.ec == parsed_r.ec);
+    BOOST_TEST_EQ(str.data() + str.size() - from_r.ptr, plain_r.ptr - parsed_r.ptr);
+    if (!BOOST_TEST(roundtrip == parsed || (roundtrip != roundtrip && parsed != parsed)))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+
+    // Too small buffers fail the same way, and always when the separators do not fit
+    const auto length = static_cast<std::ptrdiff_t>(str.size());
+    r = boost::charconv::to_chars(buffer, buffer + length - 1, value, fmt, args..., options);
+    if (str.size() != static_cast<std::size_t>(plain_r.ptr - plain))
+    {
+        BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    }
+    else
+    {
+        BOOST_TEST(r.ec == boost::charconv::to_chars(plain, plain + length - 1, value, fmt, args..., chars_format_options(options.decimal_point)).ec);
+    }
+}
+
+template <typename T>
+void test_float()
+{
+    using bits_type = typename std::conditional<sizeof(T) == sizeof(std::uint64_t), std::uint64_t, std::uint32_t>::type;
+    std::uniform_int_distribution<std::uint64_t> bits_dist;
+
+    for (const auto options : {chars_format_options('.', 'e', ','), chars_format_options(',', 'e', '.'), chars_format_options('.', 'e', ' ')})
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            const auto bits = static_cast<bits_type>(bits_dist(rng));
+            T value;
+            std::memcpy(&value, &bits, sizeof(value));
+
+            for (const auto fmt : {chars_format::general, chars_format::scientific, chars_format::fixed})
+            {
+                test_float_value(value, options, fmt);
+                test_float_value(value, options, fmt, 3);
+            }
+        }
+
+        for (const T value : {T(0), -T(0), T(1), T(-1234.5), T(123456), T(1e10), T(1e20), T(-9.87654321e15),
+                              (std::numeric_limits<T>::max)(), (std::numeric_limits<T>::min)(),
+                              std::numeric_limits<T>::infinity(), std::numeric_limits<T>::quiet_NaN()})
+        {
+            for (const auto fmt : {chars_format::general, chars_format::scientific, chars_format::fixed})
+            {
+                test_float_value(value, options, fmt);
+                test_float_value(value, options, fmt, 0);
+                test_float_value(value, options, fmt, 20);
+            }
+        }
+    }
+}
+
+template <typename T>
+void test_float_parse(const std::string& str, chars_format_options options, T expected, std::size_t expected_length)
+{
+    T value = T(42);
+    const auto r = boost::charconv::from_chars(str.data(), str.data() + str.size(), value, chars_format::general, options);
+    if (!BOOST_TEST(r) || !BOOST_TEST_EQ(r.ptr - str.data(), static_cast<std::ptrdiff_t>(expected_length)) || !BOOST_TEST_EQ(value, expected))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+void test_float_parse()
+{
+    const chars_format_options comma('.', 'e', ',');
+    test_float_parse("1,234,567.89", comma, 1234567.89, 12);
+    test_float_parse("-1,234,567.89e-3", comma, -1234.56789, 16);
+    test_float_parse("1_000_000", chars_format_options('.', 'e', '_'), 1e6, 9);
+    test_float_parse("1.234.567,125", chars_format_options(',', 'e', '.'), 1234567.125, 13);
+    test_float_parse("0,000,000.5", comma, 0.5, 11);
+
+    // Long integer parts take the paths that read the digits again
+    test_float_parse("12,345,678,901,234,567,890,123", comma, 12345678901234567890123.0, 30);
+    test_float_parse("9,007,199,254,740,993", comma, 9007199254740992.0, 21);
+    test_float_parse("9,007,199,254,740,993.000000000000000000001", comma, 9007199254740994.0, 43);
+    test_float_parse('1' + group(std::string(400, '0'), ',') + "e-400", comma, 1.0, 539);
+
+    // A separator needs a digit on both sides, and is never read in the fraction or the exponent
+    test_float_parse("1,,234", comma, 1.0, 1);
+    test_float_parse("1,234,", comma, 1234.0, 5);
+    test_float_parse("1.234,567", comma, 1.234, 5);
+    test_float_parse("1e1,000", comma, 10.0, 3);
+    test_float_parse("12,34", comma, 1234.0, 5);
+
+    double value = 42;
+    const std::string leading = ",123";
+    const auto r = boost::charconv::from_chars(leading.data(), leading.data() + leading.size(), value, chars_format::general, comma);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(value, 42.0);
+}
+
+// A separator that could be read as part of a number is rejected by both directions
+void test_invalid_options()
+{
+    const std::string str = "1,234";
+    for (const auto options : {chars_format_options('.', 'e', '5'), chars_format_options('.', 'e', '-'), chars_format_options('.', 'e', 'a'),
+                               chars_format_options('.', 'e', 'E'), chars_format_options('.', 'e', '.'), chars_format_options(',', 'e', ','),
+                               chars_format_options('.', '^', '^')})
+    {
+        double value = 42;
+        const auto from_r = boost::charconv::from_chars(str.data(), str.data() + str.size(), value, chars_format::general, options);
+        BOOST_TEST(from_r.ec == std::errc::invalid_argument);
+        BOOST_TEST(from_r.ptr == str.data());
+        BOOST_TEST_EQ(value, 42.0);
+
+        int int_value = 42;
+        const auto int_r = boost::charconv::from_chars(str.data(), str.data() + str.size(), int_value, options);
+        BOOST_TEST(int_r.ec == std::errc::invalid_argument);
+        BOOST_TEST_EQ(int_value, 42);
+
+        char buffer[64];
+        auto to_r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 1234.5, chars_format::fixed, options);
+        BOOST_TEST(to_r.ec == std::errc::invalid_argument);
+        to_r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 1234, options);
+        BOOST_TEST(to_r.ec == std::errc::invalid_argument);
+    }
+}
+
+int main()
+{
+    test_integer<short>();
+    test_integer<unsigned short>();
+    test_integer<int>();
+    test_integer<unsigned>();
+    test_integer<long long>();
+    test_integer<unsigned long long>();
+
+    test_integer_parse<int>("1,234,567", std::errc(), 9, 1234567);
+    test_integer_parse<int>("-1,000", std::errc(), 6, -1000);
+    test_integer_parse<int>("12,34", std::errc(), 5, 1234);
+    test_integer_parse<int>("1,,2", std::errc(), 1, 1);
+    test_integer_parse<int>("12,", std::errc(), 2, 12);
+    test_integer_parse<int>("1,2a", std::errc(), 3, 12);
+    test_integer_parse<int>(",1", std::errc::invalid_argument, 0);
+    test_integer_parse<int>("-,1", std::errc::invalid_argument, 0);
+    test_integer_parse<int>("2,147,483,648", std::errc::result_out_of_range, 13);
+    test_integer_parse<unsigned long long>("18,446,744,073,709,551,615", std::errc(), 26, UINT64_C(18446744073709551615));
+    test_integer_parse<unsigned long long>("18,446,744,073,709,551,616", std::errc::result_out_of_range, 26);
+
+    test_float<float>();
+    test_float<double>();
+    test_float_parse();
+    test_invalid_options();
+
+    // A fixed set of outputs
+    char buffer[128];
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 1234567.89, chars_format::fixed, 2, chars_format_options('.', 'e', ','));
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1,234,567.89");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), -1234567.89, chars_format::fixed, 2, chars_format_options(',', 'e', '.'));
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "-1.234.567,89");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 1e6, chars_format::fixed, chars_format_options('.', 'e', '_'));
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1_000_000");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 123456.0, chars_format::scientific, chars_format_options('.', 'e', ','));
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1.23456e+05");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 1234.5, chars_format::hex, chars_format_options('.', 'e', ','));
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1.34ap+10");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), -1000000, chars_format_options('.', 'e', '_'));
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "-1_000_000");
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    const auto max128 = (std::numeric_limits<boost::uint128_type>::max)();
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), max128, chars_format_options('.', 'e', ','));
+    const std::string max128_str = "340,282,366,920,938,463,463,374,607,431,768,211,455";
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), max128_str);
+    boost::uint128_type value128 = 0;
+    const auto from_r = boost::charconv::from_chars(max128_str.data(), max128_str.data() + max128_str.size(), value128,
+                                                    chars_format_options('.', 'e', ','));
+    BOOST_TEST(from_r);
+    BOOST_TEST(value128 == max128);
+    #endif
+
+    return boost::report_errors();
+}
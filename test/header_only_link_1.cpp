@@ -0,0 +1,46 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Both translation units include the definitions, which have to link without duplicate symbols
+
+#ifndef BOOST_CHARCONV_HEADER_ONLY
+#  define BOOST_CHARCONV_HEADER_ONLY
+#endif
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <cstring>
+
+void test_second_unit();
+
+template <typename T>
+void test_roundtrip(T value, const char* expected)
+{
+    char buffer[64];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), expected);
+
+    T parsed {};
+    const auto r2 = boost::charconv::from_chars(buffer, r.ptr, parsed);
+    BOOST_TEST(r2);
+    BOOST_TEST_EQ(parsed, value);
+}
+
+int main()
+{
+    test_roundtrip(0.1, "1e-01");
+    test_roundtrip(1234.5, "1234.5");
+    test_roundtrip(3.14159F, "3.14159");
+    test_roundtrip(1e23, "1e+23");
+
+    char buffer[64];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 0.1, boost::charconv::chars_format::fixed, 3);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "0.100");
+
+    test_second_unit();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,36 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_HEADER_ONLY
+#  define BOOST_CHARCONV_HEADER_ONLY
+#endif
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+
+void test_second_unit()
+{
+    const double values[] = {0.5, 1e-300, 42};
+    char buffer[64];
+    const auto r = boost::charconv::to_chars_many(buffer, buffer + sizeof(buffer), values, 3, ',');
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "5e-01,1e-300,42");
+
+    double parsed[3] {};
+    const auto r2 = boost::charconv::from_chars_many(buffer, r.ptr, parsed, 3, ',');
+    BOOST_TEST(r2);
+    BOOST_TEST_EQ(r2.count, 3U);
+    BOOST_TEST_EQ(parsed[1], 1e-300);
+
+    long double ld {};
+    const auto r3 = boost::charconv::from_chars(boost::core::string_view("1.5"), ld);
+    BOOST_TEST(r3);
+    BOOST_TEST_EQ(ld, 1.5L);
+
+    float hex {};
+    const char str[] = "1.8p+3";
+    const auto r4 = boost::charconv::from_chars(str, str + sizeof(str) - 1, hex, boost::charconv::chars_format::hex);
+    BOOST_TEST(r4);
+    BOOST_TEST_EQ(hex, 12.0F);
+}
@@ -0,0 +1,39 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// <boost/charconv/integer.hpp> is enough for the integer conversions, and does not pull in the floating point ones
+
+#include <boost/charconv/integer.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <string>
+#include <cstdint>
+
+#if defined(BOOST_CHARCONV_FLOAT_HPP_INCLUDED) || defined(BOOST_CHARCONV_EXTENDED_FLOAT_HPP_INCLUDED)
+#  error "integer.hpp includes the floating point declarations"
+#endif
+
+int main()
+{
+    char buffer[64];
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), INT64_MIN);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "-9223372036854775808");
+
+    std::int64_t value {};
+    const auto fr = boost::charconv::from_chars(buffer, r.ptr, value);
+    BOOST_TEST(fr && fr.ptr == r.ptr);
+    BOOST_TEST_EQ(value, INT64_MIN);
+
+    r = boost::charconv::to_chars<36>(buffer, buffer + sizeof(buffer), 1295U);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "zz");
+
+    unsigned hex {};
+    BOOST_TEST(boost::charconv::from_chars(boost::core::string_view("ff"), hex, 16));
+    BOOST_TEST_EQ(hex, 255U);
+
+    BOOST_TEST_EQ(boost::charconv::to_chars_length(-100), 4);
+
+    return boost::report_errors();
+}
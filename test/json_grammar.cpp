@@ -0,0 +1,143 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <string>
+#include <limits>
+#include <type_traits>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+
+static std::mt19937_64 rng(42);
+
+// Numbers of the JSON grammar give the same value and end as from_chars
+template <typename T>
+void test_valid(const std::string& str, std::size_t expected_length)
+{
+    T expected {};
+    const auto expected_r = boost::charconv::from_chars(str.data(), str.data() + str.size(), expected);
+
+    T value {};
+    const auto r = boost::charconv::json_from_chars(str.data(), str.data() + str.size(), value);
+    if (!BOOST_TEST(r) || !BOOST_TEST_EQ(r.ptr - str.data(), static_cast<std::ptrdiff_t>(expected_length)) || !BOOST_TEST_EQ(value, expected))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+    BOOST_TEST(expected_r.ptr == r.ptr);
+
+    T sv_value {};
+    const auto sv_r = boost::charconv::json_from_chars(boost::core::string_view(str), sv_value);
+    BOOST_TEST(sv_r.ptr == r.ptr);
+    BOOST_TEST_EQ(sv_value, value);
+}
+
+template <typename T>
+void test_invalid(const std::string& str)
+{
+    T value = T(42);
+    const auto r = boost::charconv::json_from_chars(str.data(), str.data() + str.size(), value);
+    if (!BOOST_TEST(r.ec == std::errc::invalid_argument) || !BOOST_TEST(r.ptr == str.data()))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+    BOOST_TEST_EQ(value, T(42));
+}
+
+template <typename T>
+void test_from_chars()
+{
+    for (const auto str : {"0", "-0", "1", "-1", "0.5", "-0.5", "10", "1.5e10", "1E-5", "1e+5", "0e0", "-0.0E-0", "123.456e-7",
+                           "123456789012345678901234567890", "0.000000000000000000000000000000000000001", "3.14159265358979323846264338327950288"})
+    {
+        test_valid<T>(str, std::strlen(str));
+    }
+
+    // The number ends where the grammar does, just like with from_chars
+    test_valid<T>("1.5,", 3);
+    test_valid<T>("0,1", 1);
+    test_valid<T>("-2e5]", 4);
+    test_valid<T>("1.5.3", 3);
+    test_valid<T>("7 ", 1);
+
+    // Not JSON numbers, although chars_format::general accepts many of them
+    for (const auto str : {"+1", "01", "-01", "00", "00.5", ".5", "-.5", "1.", "-1.", "1.e5", "1e", "1e+", "1E-", "1ex", "1.5e",
+                           "inf", "-inf", "infinity", "nan", "-nan", "nan(snan)", "NaN",
+                           "-", "", "abc", "x1", "-x", "[1]", " 1"})
+    {
+        test_invalid<T>(str);
+    }
+
+    // Out of range values keep the usual from_chars behavior
+    T value = T(42);
+    const std::string huge = "1e400";
+    auto r = boost::charconv::json_from_chars(huge.data(), huge.data() + huge.size(), value);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(r.ptr == huge.data() + huge.size());
+    BOOST_TEST_EQ(value, T(42));
+}
+
+template <typename T>
+void test_to_chars()
+{
+    using bits_type = typename std::conditional<sizeof(T) == sizeof(std::uint64_t), std::uint64_t, std::uint32_t>::type;
+    std::uniform_int_distribution<std::uint64_t> bits_dist;
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        const auto bits = static_cast<bits_type>(bits_dist(rng));
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        char buffer[64];
+        const auto r = boost::charconv::json_to_chars(buffer, buffer + sizeof(buffer), value);
+        BOOST_TEST(r);
+        const std::string str(buffer, r.ptr);
+
+        if (value != value || value == std::numeric_limits<T>::infinity() || value == -std::numeric_limits<T>::infinity())
+        {
+            BOOST_TEST_EQ(str, "null");
+            continue;
+        }
+
+        // The output is the same as to_chars, and a JSON number that parses back to the value
+        char expected[64];
+        const auto expected_r = boost::charconv::to_chars(expected, expected + sizeof(expected), value);
+        BOOST_TEST_EQ(str, std::string(expected, expected_r.ptr));
+
+        T roundtrip {};
+        const auto from_r = boost::charconv::json_from_chars(str.data(), str.data() + str.size(), roundtrip);
+        if (!BOOST_TEST(from_r) || !BOOST_TEST(from_r.ptr == str.data() + str.size()) || !BOOST_TEST_EQ(roundtrip, value))
+        {
+            std::cerr << "Output: " << str << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+
+    for (const T value : {std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+                          std::numeric_limits<T>::quiet_NaN(), -std::numeric_limits<T>::signaling_NaN()})
+    {
+        char buffer[4];
+        auto r = boost::charconv::json_to_chars(buffer, buffer + sizeof(buffer), value);
+        BOOST_TEST(r);
+        BOOST_TEST_EQ(std::string(buffer, r.ptr), "null");
+
+        r = boost::charconv::json_to_chars(buffer, buffer + 3, value);
+        BOOST_TEST(r.ec == std::errc::result_out_of_range);
+        BOOST_TEST(r.ptr == buffer + 3);
+    }
+}
+
+int main()
+{
+    test_from_chars<double>();
+    test_from_chars<float>();
+
+    test_to_chars<double>();
+    test_to_chars<float>();
+
+    return boost::report_errors();
+}
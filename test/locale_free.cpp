@@ -0,0 +1,263 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// No conversion may read the process locale or take a lock, whatever the values are.
+// The C library functions that do are replaced by ones that count the calls made from within a conversion,
+// and a sample of the seed corpora of the fuzzers, locale_free_corpus.txt, is converted in every format on several threads at once
+
+// The fortified stdio wrappers are inline definitions, which would clash with the ones below
+#ifdef _FORTIFY_SOURCE
+#  undef _FORTIFY_SOURCE
+#endif
+
+#include <cstdlib>
+
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__)
+#  if defined(__has_feature)
+#    if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer) || __has_feature(memory_sanitizer)
+#      define BOOST_CHARCONV_TEST_NO_INTERPOSE
+#    endif
+#  endif
+#else
+#  define BOOST_CHARCONV_TEST_NO_INTERPOSE
+#endif
+
+#ifndef BOOST_CHARCONV_TEST_NO_INTERPOSE
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <clocale>
+#include <dlfcn.h>
+#include <langinfo.h>
+#include <locale.h>
+#include <pthread.h>
+
+namespace {
+
+thread_local bool in_conversion = false;
+std::atomic<int> forbidden_calls {0};
+std::atomic<const char*> last_forbidden {nullptr};
+
+void record(const char* name) noexcept
+{
+    if (in_conversion)
+    {
+        ++forbidden_calls;
+        last_forbidden.store(name);
+    }
+}
+
+// The definition that the one of this program hides
+template <typename F>
+F next_definition(const char* name) noexcept
+{
+    return reinterpret_cast<F>(::dlsym(RTLD_NEXT, name));
+}
+
+} // namespace
+
+extern "C" {
+
+lconv* localeconv() noexcept
+{
+    record("localeconv");
+    return next_definition<lconv* (*)()>("localeconv")();
+}
+
+char* setlocale(int category, const char* locale) noexcept
+{
+    record("setlocale");
+    return next_definition<char* (*)(int, const char*)>("setlocale")(category, locale);
+}
+
+locale_t newlocale(int category_mask, const char* locale, locale_t base) noexcept
+{
+    record("newlocale");
+    return next_definition<locale_t (*)(int, const char*, locale_t)>("newlocale")(category_mask, locale, base);
+}
+
+locale_t uselocale(locale_t locale) noexcept
+{
+    record("uselocale");
+    return next_definition<locale_t (*)(locale_t)>("uselocale")(locale);
+}
+
+char* nl_langinfo(nl_item item) noexcept
+{
+    record("nl_langinfo");
+    return next_definition<char* (*)(nl_item)>("nl_langinfo")(item);
+}
+
+double strtod(const char* str, char** str_end) noexcept
+{
+    record("strtod");
+    return next_definition<double (*)(const char*, char**)>("strtod")(str, str_end);
+}
+
+float strtof(const char* str, char** str_end) noexcept
+{
+    record("strtof");
+    return next_definition<float (*)(const char*, char**)>("strtof")(str, str_end);
+}
+
+long double strtold(const char* str, char** str_end) noexcept
+{
+    record("strtold");
+    return next_definition<long double (*)(const char*, char**)>("strtold")(str, str_end);
+}
+
+int vsnprintf(char* buffer, std::size_t size, const char* format, va_list args) noexcept
+{
+    record("vsnprintf");
+    return next_definition<int (*)(char*, std::size_t, const char*, va_list)>("vsnprintf")(buffer, size, format, args);
+}
+
+int snprintf(char* buffer, std::size_t size, const char* format, ...) noexcept
+{
+    record("snprintf");
+    va_list args;
+    va_start(args, format);
+    const int result = next_definition<int (*)(char*, std::size_t, const char*, va_list)>("vsnprintf")(buffer, size, format, args);
+    va_end(args);
+    return result;
+}
+
+int __snprintf_chk(char* buffer, std::size_t size, int flag, std::size_t buffer_size, const char* format, ...) noexcept
+{
+    record("__snprintf_chk");
+    va_list args;
+    va_start(args, format);
+    const int result = next_definition<int (*)(char*, std::size_t, int, std::size_t, const char*, va_list)>("__vsnprintf_chk")(buffer, size, flag, buffer_size, format, args);
+    va_end(args);
+    return result;
+}
+
+int pthread_mutex_lock(pthread_mutex_t* mutex) noexcept
+{
+    record("pthread_mutex_lock");
+    return next_definition<int (*)(pthread_mutex_t*)>("pthread_mutex_lock")(mutex);
+}
+
+} // extern "C"
+
+namespace {
+
+std::vector<std::string> read_lines(const char* path)
+{
+    std::vector<std::string> lines;
+    std::ifstream file(path);
+    BOOST_TEST(file.is_open());
+    for (std::string line; std::getline(file, line);)
+    {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+template <typename T>
+void convert_float(const std::string& str)
+{
+    char buffer[2048];
+    for (const auto fmt : {boost::charconv::chars_format::general, boost::charconv::chars_format::scientific,
+                           boost::charconv::chars_format::fixed, boost::charconv::chars_format::hex})
+    {
+        T value {};
+        static_cast<void>(boost::charconv::from_chars(str.data(), str.data() + str.size(), value, fmt));
+
+        for (const int precision : {-1, 0, 6, 17, 40, 400})
+        {
+            static_cast<void>(boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt, precision));
+        }
+        static_cast<void>(boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt));
+    }
+}
+
+template <typename T>
+void convert_integer(const std::string& str)
+{
+    char buffer[256];
+    for (const int base : {2, 8, 10, 16, 36})
+    {
+        T value {};
+        static_cast<void>(boost::charconv::from_chars(str.data(), str.data() + str.size(), value, base));
+        static_cast<void>(boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, base));
+    }
+}
+
+void convert_all(const std::vector<std::string>& lines)
+{
+    in_conversion = true;
+    for (const auto& line : lines)
+    {
+        convert_float<float>(line);
+        convert_float<double>(line);
+        convert_float<long double>(line);
+
+        convert_integer<int>(line);
+        convert_integer<unsigned>(line);
+        convert_integer<std::int64_t>(line);
+        convert_integer<std::uint64_t>(line);
+        #ifdef BOOST_CHARCONV_HAS_INT128
+        convert_integer<boost::int128_type>(line);
+        #endif
+    }
+    in_conversion = false;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::vector<std::string> lines;
+    for (int i = 1; i < argc; ++i)
+    {
+        const auto file_lines = read_lines(argv[i]);
+        lines.insert(lines.end(), file_lines.begin(), file_lines.end());
+    }
+
+    // A few values that no corpus is complete without
+    for (const char* str : {"0", "-0", "inf", "-nan", "nan(snan)", "1e-400", "1e400", "0x1.fffffffffffffp+1023",
+                            "4.9406564584124654e-324", "340282366920938463463374607431768211456", "-9223372036854775809"})
+    {
+        lines.emplace_back(str);
+    }
+
+    // The calling thread, and then several at once
+    convert_all(lines);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&lines]() { convert_all(lines); });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    if (!BOOST_TEST_EQ(forbidden_calls.load(), 0))
+    {
+        std::cerr << "A conversion called " << last_forbidden.load() << std::endl;
+    }
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    return 0;
+}
+
+#endif
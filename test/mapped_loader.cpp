@@ -0,0 +1,162 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/mapped_loader.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#ifdef BOOST_CHARCONV_HAS_MAPPED_FILE
+
+#include <boost/charconv.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+
+static std::mt19937_64 rng(42);
+static const char* const path = "mapped_loader_test.txt";
+
+// Runs the tasks in reverse order on the calling thread to check the result does not depend on scheduling
+struct reverse_executor
+{
+    template <typename Task>
+    void operator()(std::size_t num_tasks, const Task& task) const noexcept
+    {
+        for (std::size_t i = num_tasks; i > 0; --i)
+        {
+            task(i - 1);
+        }
+    }
+};
+
+void write_file(const std::string& str)
+{
+    std::FILE* file = std::fopen(path, "wb");
+    BOOST_TEST(file != nullptr);
+    if (file != nullptr)
+    {
+        BOOST_TEST_EQ(std::fwrite(str.data(), 1, str.size(), file), str.size());
+        std::fclose(file);
+    }
+}
+
+template <typename T>
+void check_file(const std::string& str, std::size_t num_chunks)
+{
+    write_file(str);
+
+    std::vector<T> expected(str.size() / 2 + 1);
+    const auto er = boost::charconv::from_chars_lines(str.data(), str.data() + str.size(), expected.data(), expected.size());
+    expected.resize(er.count);
+
+    std::vector<T> values;
+    const auto r = boost::charconv::load_mapped(path, values, reverse_executor(), num_chunks);
+    BOOST_TEST(r.ec == er.ec);
+    BOOST_TEST_EQ(r.count, er.count);
+    BOOST_TEST_EQ(r.offset, static_cast<std::size_t>(er.ptr - str.data()));
+    BOOST_TEST(values == expected);
+
+    // The default executor gives the same values
+    std::vector<T> threaded_values;
+    const auto r2 = boost::charconv::load_mapped(path, threaded_values);
+    BOOST_TEST(r2 == r);
+    BOOST_TEST(threaded_values == expected);
+}
+
+template <typename T>
+void test_type()
+{
+    // A few huge pages, so that the file is split into more than one chunk
+    std::string str;
+    char buffer[64];
+    while (str.size() < (std::size_t(5) << 20))
+    {
+        const auto value = static_cast<T>(rng() >> (rng() % 64));
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value);
+        str.append(buffer, r.ptr);
+        str += (rng() % 8 == 0) ? "\r\n" : "\n";
+    }
+
+    for (std::size_t num_chunks : {1U, 3U, 16U})
+    {
+        check_file<T>(str, num_chunks);
+    }
+
+    // An error in the last chunk, and one without the final newline
+    str.insert(str.size() - 100, 1, 'x');
+    check_file<T>(str, 16);
+    str.erase(str.find('x'), 1);
+    str.pop_back();
+    check_file<T>(str, 16);
+}
+
+template <typename T>
+void test_float()
+{
+    std::string str;
+    char buffer[64];
+    while (str.size() < (std::size_t(3) << 20))
+    {
+        const auto value = static_cast<T>(static_cast<double>(rng()) / static_cast<double>(rng() | 1U));
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value);
+        str.append(buffer, r.ptr);
+        str += "\n";
+    }
+
+    check_file<T>(str, 8);
+
+    str.insert(str.size() / 2, 1, '\n');
+    check_file<T>(str, 8);
+}
+
+void test_spot()
+{
+    std::vector<int> values {1, 2, 3};
+
+    // A file that does not exist leaves the output empty
+    auto r = boost::charconv::load_mapped("mapped_loader_does_not_exist.txt", values);
+    BOOST_TEST(r.ec == std::errc::no_such_file_or_directory);
+    BOOST_TEST(values.empty());
+
+    write_file("");
+    r = boost::charconv::load_mapped(path, values);
+    BOOST_TEST(r && r.count == 0);
+
+    write_file("1\n2\n3\n");
+    r = boost::charconv::load_mapped(path, values);
+    BOOST_TEST(r && r.count == 3 && r.offset == 6);
+    BOOST_TEST_EQ(values.size(), 3U);
+
+    // The file can also be mapped on its own
+    boost::charconv::mapped_file file;
+    BOOST_TEST(file.open(path) == std::errc());
+    BOOST_TEST_EQ(file.size(), 6U);
+    BOOST_TEST(std::memcmp(file.data(), "1\n2\n3\n", 6) == 0);
+
+    boost::charconv::mapped_file moved {std::move(file)};
+    BOOST_TEST(file.data() == nullptr);
+    BOOST_TEST_EQ(moved.size(), 6U);
+}
+
+int main()
+{
+    test_type<std::uint64_t>();
+    test_type<std::int32_t>();
+    test_float<double>();
+    test_float<float>();
+    test_spot();
+
+    std::remove(path);
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,233 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/number_stream.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+
+static std::mt19937_64 rng(42);
+
+template <typename T>
+struct read_value
+{
+    std::errc ec;
+    T value;
+
+    bool operator==(const read_value& other) const
+    {
+        return ec == other.ec && (ec != std::errc() || std::memcmp(&value, &other.value, sizeof(T)) == 0);
+    }
+};
+
+// Splits the input into tokens at the same separators as number_stream, and parses each of them in one piece
+template <typename T, typename Arg>
+std::vector<read_value<T>> reference_read(const std::string& str, char delimiter, Arg arg)
+{
+    std::vector<read_value<T>> values;
+    std::size_t pos = 0;
+    for (;;)
+    {
+        pos = str.find_first_not_of(std::string(1, delimiter) + " \t\r\n", pos);
+        if (pos == std::string::npos)
+        {
+            return values;
+        }
+
+        auto end = str.find_first_of(std::string(1, delimiter) + " \t\r\n", pos);
+        end = end == std::string::npos ? str.size() : end;
+
+        read_value<T> v {std::errc(), T {}};
+        const auto r = boost::charconv::from_chars(str.data() + pos, str.data() + end, v.value, arg);
+        v.ec = !r ? r.ec : r.ptr != str.data() + end ? std::errc::invalid_argument : std::errc();
+        values.push_back(v);
+        pos = end;
+    }
+}
+
+// Feeds the input in pieces of random length, copied into a buffer that is overwritten
+// as soon as need_more_input has been reported, the way a socket read would reuse it
+template <typename T, typename Arg>
+std::vector<read_value<T>> stream_read(const std::string& str, char delimiter, Arg arg, std::size_t max_piece)
+{
+    boost::charconv::number_stream<T> stream(delimiter, arg);
+    std::vector<read_value<T>> values;
+    std::vector<char> buffer(max_piece);
+
+    std::size_t pos = 0;
+    bool fed_last = false;
+    while (!fed_last)
+    {
+        const auto length = (std::min)(static_cast<std::size_t>(rng() % (max_piece + 1)), str.size() - pos);
+        std::fill(buffer.begin(), buffer.end(), 'x');
+        std::memcpy(buffer.data(), str.data() + pos, length);
+        pos += length;
+        fed_last = pos == str.size() && rng() % 2 == 0;
+        stream.feed(buffer.data(), buffer.data() + length, fed_last);
+
+        for (;;)
+        {
+            T value {};
+            const auto r = stream.next(value);
+            if (r.need_more_input || r.end_of_input)
+            {
+                BOOST_TEST(!r.end_of_input || fed_last);
+                BOOST_TEST(r.ec == std::errc());
+                break;
+            }
+            values.push_back({r.ec, value});
+        }
+    }
+
+    // Once the input has ended it stays ended
+    T value {};
+    BOOST_TEST(stream.next(value).end_of_input);
+    BOOST_TEST_EQ(stream.pending(), 0U);
+
+    return values;
+}
+
+template <typename T, typename Arg>
+void test_stream(const std::string& str, char delimiter, Arg arg)
+{
+    const auto expected = reference_read<T>(str, delimiter, arg);
+    for (const std::size_t max_piece : {1U, 2U, 7U, 64U, 4096U})
+    {
+        const auto values = stream_read<T>(str, delimiter, arg, max_piece);
+        BOOST_TEST_EQ(values.size(), expected.size());
+        if (values.size() == expected.size())
+        {
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                if (!BOOST_TEST(values[i] == expected[i]))
+                {
+                    break;
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+void test_floats()
+{
+    std::string str;
+    char buffer[64];
+    for (int i = 0; i < 2000; ++i)
+    {
+        const auto value = static_cast<T>(static_cast<double>(rng()) / static_cast<double>(rng() | 1U));
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value);
+        str.append(buffer, r.ptr);
+
+        // Line protocol style fields, with a few values that are not numbers
+        switch (rng() % 32)
+        {
+            case 0: str += "abc"; break;
+            case 1: str += "e"; break;
+            case 2: str += "1e999"; break;
+            default: break;
+        }
+        str += (i % 10 == 9) ? "\n" : (rng() % 2 == 0 ? "," : " ");
+    }
+
+    test_stream<T>(str, ',', chars_format::general);
+    test_stream<T>(str, ';', chars_format::general);
+}
+
+template <typename T>
+void test_integers(int base)
+{
+    std::string str;
+    char buffer[128];
+    for (int i = 0; i < 2000; ++i)
+    {
+        const auto value = static_cast<T>(rng() >> (rng() % 64));
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, base);
+        str.append(buffer, r.ptr);
+        str += (rng() % 4 == 0) ? "\r\n" : ",";
+    }
+
+    test_stream<T>(str, ',', base);
+}
+
+void test_long_values()
+{
+    // A value longer than max_token_length is an error when it is split, and the one after it is still read
+    const std::string long_value = "1." + std::string(400, '5');
+    const std::string str = long_value + "," + long_value + ",42";
+
+    boost::charconv::number_stream<double> stream;
+    stream.feed(str.data(), str.data() + 300);
+
+    double value = 0;
+    auto r = stream.next(value);
+    BOOST_TEST(r.ec == std::errc::value_too_large);
+    r = stream.next(value);
+    BOOST_TEST(r.need_more_input);
+
+    stream.feed(str.data() + 300, str.data() + str.size(), true);
+    r = stream.next(value);
+    BOOST_TEST(r && value == 1.5555555555555556);
+    r = stream.next(value);
+    BOOST_TEST(r && value == 42);
+    BOOST_TEST(stream.next(value).end_of_input);
+}
+
+void test_spot()
+{
+    boost::charconv::number_stream<std::int64_t> stream;
+    std::int64_t value = 0;
+
+    // Nothing fed yet
+    BOOST_TEST(stream.next(value).need_more_input);
+
+    stream.feed("12,-3", false);
+    BOOST_TEST(stream.next(value) && value == 12);
+    BOOST_TEST(stream.next(value).need_more_input);
+    BOOST_TEST_EQ(stream.pending(), 2U);
+
+    stream.feed("4,,5x,", false);
+    BOOST_TEST(stream.next(value) && value == -34);
+    BOOST_TEST(stream.next(value).ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(value, -34);
+    BOOST_TEST(stream.next(value).need_more_input);
+
+    stream.feed("", true);
+    BOOST_TEST(stream.next(value).end_of_input);
+
+    stream.reset();
+    stream.feed("7", true);
+    BOOST_TEST(stream.next(value) && value == 7);
+    BOOST_TEST(stream.next(value).end_of_input);
+
+    // Hexadecimal with a tab delimiter
+    boost::charconv::number_stream<unsigned> hex_stream('\t', 16);
+    unsigned hex_value = 0;
+    hex_stream.feed("ff\t1", false);
+    BOOST_TEST(hex_stream.next(hex_value) && hex_value == 255);
+    BOOST_TEST(hex_stream.next(hex_value).need_more_input);
+    hex_stream.feed("0", true);
+    BOOST_TEST(hex_stream.next(hex_value) && hex_value == 16);
+}
+
+int main()
+{
+    test_floats<double>();
+    test_floats<float>();
+
+    test_integers<std::int64_t>(10);
+    test_integers<std::uint32_t>(16);
+
+    test_long_values();
+    test_spot();
+
+    return boost::report_errors();
+}
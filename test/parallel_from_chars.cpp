@@ -0,0 +1,113 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/parallel_from_chars.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstring>
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 100000;
+
+// Runs the tasks in reverse order on the calling thread to check the result does not depend on scheduling
+struct reverse_executor
+{
+    template <typename Task>
+    void operator()(std::size_t num_tasks, const Task& task) const noexcept
+    {
+        for (std::size_t i = num_tasks; i > 0; --i)
+        {
+            task(i - 1);
+        }
+    }
+};
+
+template <typename T>
+std::string make_buffer(std::vector<T>& values, char delimiter)
+{
+    std::uniform_real_distribution<T> dist(T(-1e10), T(1e10));
+    std::string buffer;
+    char temp[64];
+
+    for (auto& value : values)
+    {
+        value = dist(rng);
+        const auto r = boost::charconv::to_chars(temp, temp + sizeof(temp), value);
+        buffer.append(temp, r.ptr);
+        buffer.push_back(delimiter);
+    }
+
+    return buffer;
+}
+
+template <typename T>
+void test_roundtrip()
+{
+    std::vector<T> values(N);
+    std::string buffer = make_buffer(values, ',');
+
+    for (std::size_t num_chunks : {1U, 2U, 7U, 64U, 1000U})
+    {
+        std::vector<T> parsed(N);
+        const auto r = boost::charconv::parallel_from_chars(buffer.data(), buffer.data() + buffer.size(), parsed.data(), N, ',',
+                                                            reverse_executor(), num_chunks);
+        BOOST_TEST(r);
+        BOOST_TEST_EQ(r.count, N);
+        BOOST_TEST(r.ptr == buffer.data() + buffer.size());
+        BOOST_TEST(parsed == values);
+    }
+
+    // Without the trailing delimiter and with the default thread executor
+    buffer.pop_back();
+    std::vector<T> parsed(N);
+    const auto r = boost::charconv::parallel_from_chars(buffer.data(), buffer.data() + buffer.size(), parsed.data(), N, ',');
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.count, N);
+    BOOST_TEST(r.ptr == buffer.data() + buffer.size());
+    BOOST_TEST(parsed == values);
+
+    const boost::charconv::thread_executor executor(8);
+    std::vector<T> parsed2(N);
+    const auto r2 = boost::charconv::parallel_from_chars(buffer.data(), buffer.data() + buffer.size(), parsed2.data(), N, ',', executor, 32);
+    BOOST_TEST(r2);
+    BOOST_TEST(parsed2 == values);
+}
+
+// The result must match from_chars_many over the whole buffer
+template <typename T>
+void test_matches_serial()
+{
+    std::vector<T> values(1000);
+    std::string buffer = make_buffer(values, '\n');
+    buffer[buffer.size() / 2] = 'x';
+
+    for (std::size_t n : {std::size_t(10), std::size_t(999), std::size_t(1000), std::size_t(2000)})
+    {
+        std::vector<T> serial(n);
+        const auto expected = boost::charconv::from_chars_many(buffer.data(), buffer.data() + buffer.size(), serial.data(), n, '\n');
+
+        for (std::size_t num_chunks : {1U, 3U, 16U})
+        {
+            std::vector<T> parsed(n);
+            const auto r = boost::charconv::parallel_from_chars(buffer.data(), buffer.data() + buffer.size(), parsed.data(), n, '\n',
+                                                                reverse_executor(), num_chunks);
+            BOOST_TEST(r == expected);
+            BOOST_TEST(std::equal(parsed.begin(), parsed.begin() + static_cast<std::ptrdiff_t>(r.count), serial.begin()));
+        }
+    }
+}
+
+int main()
+{
+    test_roundtrip<float>();
+    test_roundtrip<double>();
+
+    test_matches_serial<float>();
+    test_matches_serial<double>();
+
+    return boost::report_errors();
+}
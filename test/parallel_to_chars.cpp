@@ -0,0 +1,198 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/parallel_to_chars.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 100000;
+
+// Runs the tasks in reverse order on the calling thread to check the result does not depend on scheduling
+struct reverse_executor
+{
+    template <typename Task>
+    void operator()(std::size_t num_tasks, const Task& task) const noexcept
+    {
+        for (std::size_t i = num_tasks; i > 0; --i)
+        {
+            task(i - 1);
+        }
+    }
+};
+
+template <typename T>
+std::vector<T> make_values(std::size_t n)
+{
+    using Bits = typename std::conditional<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>::type;
+
+    // Random bits, so there are subnormals, infinities and nans of every length
+    std::vector<T> values(n);
+    for (auto& value : values)
+    {
+        const auto bits = static_cast<Bits>(rng());
+        std::memcpy(&value, &bits, sizeof(value));
+    }
+    return values;
+}
+
+template <typename T>
+std::vector<T> make_integers(std::size_t n)
+{
+    std::vector<T> values(n);
+    for (auto& value : values)
+    {
+        value = static_cast<T>(rng() >> (rng() % 64));
+    }
+    return values;
+}
+
+template <typename T>
+void test_float(boost::charconv::chars_format fmt, int precision)
+{
+    const auto values = make_values<T>(N);
+
+    std::vector<char> serial(N * 400);
+    const auto expected = boost::charconv::to_chars_many(serial.data(), serial.data() + serial.size(), values.data(), N, ',', fmt, precision);
+    BOOST_TEST(expected);
+
+    for (std::size_t num_chunks : {1U, 2U, 7U, 64U, 1000U})
+    {
+        std::vector<char> buffer(serial.size());
+        const auto r = boost::charconv::parallel_to_chars(buffer.data(), buffer.data() + buffer.size(), values.data(), N, ',',
+                                                          reverse_executor(), num_chunks, fmt, precision);
+        BOOST_TEST(r);
+        BOOST_TEST_EQ(r.count, N);
+        BOOST_TEST_EQ(r.ptr - buffer.data(), expected.ptr - serial.data());
+        BOOST_TEST(std::equal(buffer.data(), r.ptr, serial.data()));
+    }
+
+    // Exactly enough space and the default thread executor
+    const auto size = static_cast<std::size_t>(expected.ptr - serial.data());
+    std::vector<char> buffer(size);
+    const auto r = boost::charconv::parallel_to_chars(buffer.data(), buffer.data() + size, values.data(), N, ',', fmt, precision);
+    BOOST_TEST(r);
+    BOOST_TEST(r.ptr == buffer.data() + size);
+    BOOST_TEST(std::equal(buffer.begin(), buffer.end(), serial.data()));
+
+    const boost::charconv::thread_executor executor(8);
+    std::vector<char> buffer2(size);
+    const auto r2 = boost::charconv::parallel_to_chars(buffer2.data(), buffer2.data() + size, values.data(), N, ',', executor, 32, fmt, precision);
+    BOOST_TEST(r2);
+    BOOST_TEST(buffer2 == buffer);
+}
+
+template <typename T>
+void test_integer(int base)
+{
+    const auto values = make_integers<T>(N);
+
+    std::string expected;
+    char temp[128];
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        if (i != 0)
+        {
+            expected.push_back('\n');
+        }
+        const auto r = boost::charconv::to_chars(temp, temp + sizeof(temp), values[i], base);
+        expected.append(temp, r.ptr);
+    }
+
+    for (std::size_t num_chunks : {1U, 3U, 64U})
+    {
+        std::vector<char> buffer(expected.size());
+        const auto r = boost::charconv::parallel_to_chars(buffer.data(), buffer.data() + buffer.size(), values.data(), N, '\n',
+                                                          reverse_executor(), num_chunks, base);
+        BOOST_TEST(r);
+        BOOST_TEST_EQ(r.count, N);
+        BOOST_TEST(r.ptr == buffer.data() + buffer.size());
+        BOOST_TEST(std::string(buffer.data(), r.ptr) == expected);
+    }
+
+    std::vector<char> buffer(expected.size());
+    const auto r = boost::charconv::parallel_to_chars(buffer.data(), buffer.data() + buffer.size(), values.data(), N, '\n', base);
+    BOOST_TEST(r);
+    BOOST_TEST(std::string(buffer.data(), r.ptr) == expected);
+}
+
+// A buffer that is too small holds the values whose characters fit into it
+template <typename T>
+void test_out_of_range()
+{
+    const auto values = make_values<T>(1000);
+
+    std::string serial;
+    std::vector<std::size_t> value_ends;
+    char temp[128];
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        if (i != 0)
+        {
+            serial.push_back(';');
+        }
+        const auto r = boost::charconv::to_chars(temp, temp + sizeof(temp), values[i]);
+        serial.append(temp, r.ptr);
+        value_ends.push_back(serial.size());
+    }
+
+    for (int i = 0; i < 200; ++i)
+    {
+        const std::size_t size = static_cast<std::size_t>(rng() % (serial.size() + 1));
+        const auto expected_count = static_cast<std::size_t>(std::upper_bound(value_ends.begin(), value_ends.end(), size) - value_ends.begin());
+        const std::size_t expected_size = expected_count == 0 ? 0 : value_ends[expected_count - 1];
+
+        for (std::size_t num_chunks : {1U, 5U, 100U})
+        {
+            std::vector<char> buffer(size + 1);
+            const auto r = boost::charconv::parallel_to_chars(buffer.data(), buffer.data() + size, values.data(), values.size(), ';',
+                                                              reverse_executor(), num_chunks);
+            BOOST_TEST(r.ec == (expected_count == values.size() ? std::errc() : std::errc::result_out_of_range));
+            BOOST_TEST_EQ(r.count, expected_count);
+            BOOST_TEST_EQ(static_cast<std::size_t>(r.ptr - buffer.data()), expected_size);
+            BOOST_TEST(std::equal(buffer.data(), r.ptr, serial.data()));
+        }
+    }
+
+    // to_chars_many stops earlier, where the shortest representation asks for more space than it needs
+    std::vector<char> serial_many(serial.size());
+    const auto r_many = boost::charconv::to_chars_many(serial_many.data(), serial_many.data() + serial_many.size(), values.data(), values.size(), ';');
+    BOOST_TEST(std::equal(serial_many.data(), r_many.ptr, serial.data()));
+
+    char c = 'x';
+    auto r = boost::charconv::parallel_to_chars(&c, &c, values.data(), 0, ';', reverse_executor(), 4);
+    BOOST_TEST(r && r.count == 0 && r.ptr == &c);
+    r = boost::charconv::parallel_to_chars(&c, &c, values.data(), 1, ';', reverse_executor(), 4);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range && r.count == 0);
+}
+
+int main()
+{
+    for (const auto fmt : {boost::charconv::chars_format::general, boost::charconv::chars_format::scientific,
+                           boost::charconv::chars_format::fixed, boost::charconv::chars_format::hex})
+    {
+        test_float<float>(fmt, -1);
+        test_float<double>(fmt, -1);
+    }
+    test_float<double>(boost::charconv::chars_format::fixed, 6);
+    test_float<double>(boost::charconv::chars_format::scientific, 17);
+    test_float<float>(boost::charconv::chars_format::general, 3);
+
+    test_integer<int>(10);
+    test_integer<std::uint64_t>(10);
+    test_integer<std::int64_t>(16);
+    test_integer<std::uint32_t>(36);
+
+    test_out_of_range<float>();
+    test_out_of_range<double>();
+
+    return boost::report_errors();
+}
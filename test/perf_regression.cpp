@@ -0,0 +1,350 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Performance regression test of the hot paths. Every case converts the same fixed seed values and its best time
+// per value is divided by that of a calibration loop, so that the ratios recorded on one machine can be compared
+// with later builds on machines alike. The test does nothing unless the environment says so:
+//
+//   BOOST_CHARCONV_PERF_TESTS      check (or 1) to compare with the baseline, update to write the baseline
+//   BOOST_CHARCONV_PERF_BASELINE   the baseline file, by default the first argument or perf_regression_baseline.txt next to this file
+//   BOOST_CHARCONV_PERF_TOLERANCE  the slow down in percent that fails a case (default 15)
+//   BOOST_CHARCONV_PERF_REPORT     the CSV report written by every run (default perf_regression_report.csv)
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+using boost::charconv::chars_format;
+
+constexpr std::size_t values = 10000;
+constexpr int rounds = 100;
+
+#ifdef NDEBUG
+constexpr bool release_build = true;
+#else
+constexpr bool release_build = false;
+#endif
+
+// Converts every value once and returns a checksum
+using perf_function = std::function<std::size_t()>;
+
+struct perf_case
+{
+    const char* name;
+    perf_function f;
+    double ns;      // best time per value
+    double ratio;   // ns divided by the ns of the calibration loop
+};
+
+// Times every case once per round, round after round, so that a change of the clock speed or a busy moment of the
+// machine affects all of them alike, and keeps the best time of each
+static void time_cases(std::vector<perf_case>& cases)
+{
+    volatile std::size_t sink = 0;
+
+    // Until the clock speed settles
+    const auto warm_up = std::chrono::steady_clock::now() + std::chrono::milliseconds(200);
+    while (std::chrono::steady_clock::now() < warm_up)
+    {
+        sink = sink + cases.front().f();
+    }
+
+    for (int round = 0; round < rounds; ++round)
+    {
+        for (auto& c : cases)
+        {
+            const auto t1 = std::chrono::steady_clock::now();
+            sink = sink + c.f();
+            const auto t2 = std::chrono::steady_clock::now();
+
+            const double ns = std::chrono::duration<double, std::nano>(t2 - t1).count() / static_cast<double>(values);
+            if (round == 0 || ns < c.ns)
+            {
+                c.ns = ns;
+            }
+        }
+    }
+}
+
+// A chain of dependent multiplications and shifts, about as many as one conversion, that no build of the library changes
+static std::size_t calibration()
+{
+    std::uint64_t x = 0x9E3779B97F4A7C15;
+
+    for (std::size_t i = 0; i < values; ++i)
+    {
+        for (int j = 0; j < 8; ++j)
+        {
+            x ^= x >> 31;
+            x *= 0xBF58476D1CE4E5B9;
+        }
+    }
+
+    return static_cast<std::size_t>(x);
+}
+
+template <typename T>
+static std::vector<T> random_floats()
+{
+    boost::detail::splitmix64 rng;
+    std::vector<T> data;
+
+    while (data.size() < values)
+    {
+        const std::uint64_t bits = rng();
+        T x;
+
+        BOOST_IF_CONSTEXPR (sizeof(T) == sizeof(std::uint32_t))
+        {
+            const auto bits32 = static_cast<std::uint32_t>(bits);
+            std::memcpy(&x, &bits32, sizeof(x));
+        }
+        else
+        {
+            std::memcpy(&x, &bits, sizeof(x));
+        }
+
+        if (std::isfinite(x))
+        {
+            data.push_back(x);
+        }
+    }
+
+    return data;
+}
+
+template <typename T>
+static std::vector<std::string> format_all(const std::vector<T>& data, chars_format fmt, int precision)
+{
+    std::vector<std::string> strings;
+    strings.reserve(data.size());
+
+    for (const T x : data)
+    {
+        char buffer[64];
+        const auto r = precision < 0 ? boost::charconv::to_chars(buffer, buffer + sizeof(buffer), x, fmt) :
+                                       boost::charconv::to_chars(buffer, buffer + sizeof(buffer), x, fmt, precision);
+        strings.emplace_back(buffer, r.ptr);
+    }
+
+    return strings;
+}
+
+template <typename T>
+static perf_function to_chars_case(const std::vector<T>& data, chars_format fmt, int precision)
+{
+    return [&data, fmt, precision]{
+        std::size_t s = 0;
+        char buffer[512];
+
+        for (const T x : data)
+        {
+            const auto r = precision < 0 ? boost::charconv::to_chars(buffer, buffer + sizeof(buffer), x, fmt) :
+                                           boost::charconv::to_chars(buffer, buffer + sizeof(buffer), x, fmt, precision);
+            s += static_cast<std::size_t>(r.ptr - buffer) + static_cast<unsigned char>(buffer[0]);
+        }
+
+        return s;
+    };
+}
+
+template <typename T>
+static perf_function from_chars_case(const std::vector<std::string>& data)
+{
+    return [&data]{
+        std::size_t s = 0;
+
+        for (const auto& str : data)
+        {
+            T x {};
+            const auto r = boost::charconv::from_chars(str.data(), str.data() + str.size(), x);
+            s += static_cast<std::size_t>(r.ptr - str.data()) + static_cast<std::size_t>(x != 0);
+        }
+
+        return s;
+    };
+}
+
+static std::vector<perf_case> measure()
+{
+    boost::detail::splitmix64 rng;
+
+    std::vector<std::uint64_t> integers;
+    for (std::size_t i = 0; i < values; ++i)
+    {
+        integers.push_back(rng() >> (rng() % 64));
+    }
+
+    const std::vector<double> doubles = random_floats<double>();
+    const std::vector<float> floats = random_floats<float>();
+
+    std::vector<std::string> integer_strings;
+    for (const std::uint64_t x : integers)
+    {
+        integer_strings.push_back(std::to_string(x));
+    }
+
+    const std::vector<std::string> double_strings = format_all(doubles, chars_format::general, -1);
+    const std::vector<std::string> short_double_strings = format_all(doubles, chars_format::scientific, 5);
+    const std::vector<std::string> float_strings = format_all(floats, chars_format::general, -1);
+
+    std::vector<perf_case> cases = {
+        {"calibration", calibration, 0, 0},
+        {"from_chars_uint64", from_chars_case<std::uint64_t>(integer_strings), 0, 0},
+        {"to_chars_uint64", [&]{
+            std::size_t s = 0;
+            char buffer[32];
+            for (const std::uint64_t x : integers)
+            {
+                const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), x);
+                s += static_cast<std::size_t>(r.ptr - buffer) + static_cast<unsigned char>(buffer[0]);
+            }
+            return s;
+        }, 0, 0},
+        {"from_chars_double", from_chars_case<double>(double_strings), 0, 0},
+        {"from_chars_double_6_digits", from_chars_case<double>(short_double_strings), 0, 0},
+        {"from_chars_float", from_chars_case<float>(float_strings), 0, 0},
+        {"to_chars_double_shortest", to_chars_case(doubles, chars_format::general, -1), 0, 0},
+        {"to_chars_double_fixed", to_chars_case(doubles, chars_format::fixed, -1), 0, 0},
+        {"to_chars_double_scientific_6", to_chars_case(doubles, chars_format::scientific, 6), 0, 0},
+        {"to_chars_double_scientific_17", to_chars_case(doubles, chars_format::scientific, 17), 0, 0},
+        {"to_chars_double_hex", to_chars_case(doubles, chars_format::hex, -1), 0, 0},
+        {"to_chars_float_shortest", to_chars_case(floats, chars_format::general, -1), 0, 0},
+        {"to_chars_float_scientific_6", to_chars_case(floats, chars_format::scientific, 6), 0, 0},
+    };
+
+    time_cases(cases);
+
+    // The calibration loop is the first case and takes no part in the comparison
+    const double calibration_ns = cases.front().ns;
+    cases.erase(cases.begin());
+
+    for (auto& c : cases)
+    {
+        c.ratio = c.ns / calibration_ns;
+    }
+
+    return cases;
+}
+
+static std::string setting(const char* name, const std::string& fallback)
+{
+    const char* value = std::getenv(name);
+    return value != nullptr && *value != '\0' ? std::string(value) : fallback;
+}
+
+static std::string default_baseline(int argc, char** argv)
+{
+    if (argc > 1)
+    {
+        return argv[1];
+    }
+
+    std::string dir = __FILE__;
+    const std::size_t slash = dir.find_last_of("/\\");
+    return (slash == std::string::npos ? std::string(".") : dir.substr(0, slash)) + "/perf_regression_baseline.txt";
+}
+
+// Lines of a name and a ratio, and comments starting with #
+static std::map<std::string, double> read_baseline(const std::string& path)
+{
+    std::map<std::string, double> baseline;
+    std::ifstream in(path);
+    std::string name;
+
+    while (in >> name)
+    {
+        if (name[0] == '#')
+        {
+            std::getline(in, name);
+            continue;
+        }
+
+        double ratio = 0;
+        if (in >> ratio)
+        {
+            baseline[name] = ratio;
+        }
+    }
+
+    return baseline;
+}
+
+int main(int argc, char** argv)
+{
+    const std::string mode = setting("BOOST_CHARCONV_PERF_TESTS", "0");
+
+    if (mode == "0")
+    {
+        std::cerr << "Performance regression tests not run, set BOOST_CHARCONV_PERF_TESTS=check to run them" << std::endl;
+        return 0;
+    }
+
+    if (!release_build)
+    {
+        std::cerr << "Performance regression tests not run in a debug build, build with variant=release" << std::endl;
+        return 0;
+    }
+
+    const std::string baseline_path = setting("BOOST_CHARCONV_PERF_BASELINE", default_baseline(argc, argv));
+    const std::string report_path = setting("BOOST_CHARCONV_PERF_REPORT", "perf_regression_report.csv");
+    const double tolerance = std::atof(setting("BOOST_CHARCONV_PERF_TOLERANCE", "15").c_str());
+
+    const std::vector<perf_case> cases = measure();
+
+    if (mode == "update")
+    {
+        std::ofstream out(baseline_path);
+        out << "# Best time per value divided by that of the calibration loop, written by perf_regression.cpp\n"
+            << "# " << BOOST_COMPILER << ", " << BOOST_STDLIB << ", " << BOOST_PLATFORM << "\n";
+        for (const auto& c : cases)
+        {
+            out << c.name << ' ' << c.ratio << '\n';
+        }
+
+        BOOST_TEST(out.good());
+        std::cerr << "Wrote " << baseline_path << std::endl;
+        return boost::report_errors();
+    }
+
+    BOOST_TEST(mode == "check" || mode == "1");
+
+    const std::map<std::string, double> baseline = read_baseline(baseline_path);
+    BOOST_TEST(!baseline.empty());
+
+    std::ofstream report(report_path);
+    report << "name,ns_per_value,ratio,baseline,change_percent,status\n";
+
+    for (const auto& c : cases)
+    {
+        const auto it = baseline.find(c.name);
+        const bool known = it != baseline.end() && it->second > 0;
+        const double change = known ? (c.ratio / it->second - 1) * 100 : 0;
+        const char* status = !known ? "new" : change > tolerance ? "regressed" : "ok";
+
+        report << c.name << ',' << c.ns << ',' << c.ratio << ',' << (known ? it->second : 0) << ',' << change << ',' << status << '\n';
+        std::cerr << c.name << ": " << c.ns << " ns, " << (known ? std::to_string(change) + "% slower than the baseline" : "no baseline")
+                  << ", " << status << std::endl;
+
+        if (known && change > tolerance)
+        {
+            BOOST_ERROR(c.name);
+        }
+    }
+
+    BOOST_TEST(report.good());
+    return boost::report_errors();
+}
@@ -0,0 +1,264 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/resumable_from_chars.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <limits>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+
+static std::mt19937_64 rng(42);
+
+template <typename T>
+boost::charconv::from_chars_result contiguous(const std::string& str, T& value, chars_format fmt)
+{
+    return boost::charconv::from_chars(str.data(), str.data() + str.size(), value, fmt);
+}
+
+template <typename T>
+boost::charconv::from_chars_result contiguous(const std::string& str, T& value, int base)
+{
+    return boost::charconv::from_chars(str.data(), str.data() + str.size(), value, base);
+}
+
+// Splitting the input anywhere, or into single characters, has to give the same value, error and end
+// as parsing it in one piece. The end can only differ when the value ends within an earlier piece
+template <typename T, typename Arg>
+void test_split(const std::string& str, Arg arg)
+{
+    T expected {};
+    const auto expected_r = contiguous(str, expected, arg);
+    const auto expected_length = static_cast<std::size_t>(expected_r.ptr - str.data());
+
+    std::vector<std::size_t> cuts_list;
+    for (std::size_t cut = 0; cut <= str.size(); ++cut)
+    {
+        cuts_list.push_back(cut);
+    }
+
+    // Every cut on its own, then every character as its own piece
+    for (std::size_t pass = 0; pass <= cuts_list.size(); ++pass)
+    {
+        std::vector<std::size_t> cuts;
+        if (pass < cuts_list.size())
+        {
+            cuts.push_back(cuts_list[pass]);
+        }
+        else
+        {
+            cuts = cuts_list;
+        }
+        cuts.push_back(str.size());
+
+        boost::charconv::resumable_from_chars<T> parser(arg);
+        T value {};
+        std::size_t piece_first = 0;
+        bool done = false;
+        for (std::size_t i = 0; i < cuts.size() && !done; ++i)
+        {
+            const std::size_t piece_last = cuts[i];
+            const bool last_piece = i + 1 == cuts.size();
+            const auto r = parser.parse(str.data() + piece_first, str.data() + piece_last, value, last_piece);
+
+            if (r.need_more_input)
+            {
+                BOOST_TEST(!last_piece);
+                BOOST_TEST(r.ptr == str.data() + piece_last);
+                BOOST_TEST_EQ(parser.pending(), piece_last);
+                piece_first = piece_last;
+                continue;
+            }
+
+            done = true;
+            const auto length = static_cast<std::size_t>(r.ptr - str.data());
+            const bool same_end = length == (expected_length > piece_first ? expected_length : piece_first);
+            if (!BOOST_TEST(r.ec == expected_r.ec) || !BOOST_TEST(same_end) || (r && !BOOST_TEST(value == expected || (value != value && expected != expected))))
+            {
+                std::cerr << "Input: " << str << "\nPieces end at:"; // LCOV_EXCL_LINE
+                for (const auto cut : cuts)                          // LCOV_EXCL_LINE
+                {
+                    std::cerr << ' ' << cut;                         // LCOV_EXCL_LINE
+                }
+                std::cerr << std::endl;                              // LCOV_EXCL_LINE
+            }
+            BOOST_TEST_EQ(parser.pending(), 0U);
+        }
+        BOOST_TEST(done);
+    }
+}
+
+template <typename T>
+void test_float()
+{
+    const std::vector<std::string> inputs = {
+        "1", "12", "1.5", "-2.25", ".5", "1.", "1e5", "1e+5", "1E-5", "1e", "1e+", "12e,", "12e+,", "-", ".", "-.", "",
+        "inf", "-inf", "infinity", "INFINITY", "infin", "infinity5", "nan", "-nan(ind)", "nan(snan)", "nan(", "nan(ab", "nanx",
+        "2.2250738585072011e-308", "1e400", "-1e-400", "4.9406564584124654e-324", "123456789012345678901234567890",
+        "1,2", "1.5 2.5", "abc", "+1", "1e5e5", "0x10"
+    };
+
+    for (const auto fmt : {chars_format::general, chars_format::scientific, chars_format::fixed})
+    {
+        for (const auto& input : inputs)
+        {
+            test_split<T>(input, fmt);
+            test_split<T>(input + ",", fmt);
+        }
+    }
+
+    for (const auto& input : {"1.8p+3", "1.8p", "-a.bp-2", "ffp", "1p+", "inf", "nan(1)", "1.8p+3,2"})
+    {
+        test_split<T>(input, chars_format::hex);
+    }
+
+    // Random values in every format
+    std::uniform_int_distribution<std::uint64_t> bits_dist;
+    for (int i = 0; i < 200; ++i)
+    {
+        double d;
+        const std::uint64_t bits = bits_dist(rng);
+        std::memcpy(&d, &bits, sizeof(d));
+        const auto value = static_cast<T>(d);
+
+        for (const auto fmt : {chars_format::general, chars_format::scientific, chars_format::fixed, chars_format::hex})
+        {
+            char buffer[2048];
+            const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt);
+            if (r && r.ptr - buffer < 200)
+            {
+                test_split<T>(std::string(buffer, r.ptr) + ";", fmt);
+            }
+        }
+    }
+}
+
+template <typename T>
+void test_integer()
+{
+    const std::vector<std::string> inputs = {"0", "7", "-7", "123", "-", "", "+1", "12,3", "ff", "FF,", "zz", "99999999999999999999999999999999999999999", "1-2"};
+
+    for (const int base : {2, 10, 16, 36})
+    {
+        for (const auto& input : inputs)
+        {
+            test_split<T>(input, base);
+        }
+    }
+
+    std::uniform_int_distribution<T> dist((std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+    for (int i = 0; i < 200; ++i)
+    {
+        const T value = dist(rng);
+        for (const int base : {2, 10, 16})
+        {
+            char buffer[128];
+            const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, base);
+            test_split<T>(std::string(buffer, r.ptr) + "\n", base);
+        }
+    }
+}
+
+// A sequence of values that wraps around a ring buffer
+void test_ring_buffer()
+{
+    const std::string data = "3.25,-17,1e-5,6.02214076e23,0.1,";
+
+    for (std::size_t wrap = 0; wrap <= data.size(); ++wrap)
+    {
+        const std::string pieces[] = {data.substr(0, wrap), data.substr(wrap)};
+
+        boost::charconv::resumable_from_chars<double> parser;
+        std::vector<double> values;
+        double value {};
+
+        for (std::size_t i = 0; i < 2; ++i)
+        {
+            const char* first = pieces[i].data();
+            const char* const last = first + pieces[i].size();
+            while (first != last)
+            {
+                if (*first == ',' && parser.pending() == 0)
+                {
+                    ++first;
+                    continue;
+                }
+
+                const auto r = parser.parse(first, last, value, i == 1);
+                first = r.ptr;
+                if (r.need_more_input)
+                {
+                    break;
+                }
+
+                BOOST_TEST(r);
+                values.push_back(value);
+            }
+        }
+
+        BOOST_TEST_EQ(values.size(), 5U);
+        if (values.size() == 5)
+        {
+            BOOST_TEST_EQ(values[0], 3.25);
+            BOOST_TEST_EQ(values[1], -17.0);
+            BOOST_TEST_EQ(values[2], 1e-5);
+            BOOST_TEST_EQ(values[3], 6.02214076e23);
+            BOOST_TEST_EQ(values[4], 0.1);
+        }
+    }
+}
+
+void test_limits()
+{
+    boost::charconv::resumable_from_chars<double> parser;
+    double value = 42;
+
+    const std::string digits(boost::charconv::resumable_from_chars<double>::max_token_length, '1');
+    auto r = parser.parse(digits.data(), digits.data() + digits.size(), value);
+    BOOST_TEST(r.need_more_input);
+
+    r = parser.parse(digits.data(), digits.data() + 1, value);
+    BOOST_TEST(r.ec == std::errc::value_too_large);
+    BOOST_TEST(!r.need_more_input);
+    BOOST_TEST_EQ(parser.pending(), 0U);
+    BOOST_TEST_EQ(value, 42.0);
+
+    // The value is unmodified while more input is needed
+    r = parser.parse(boost::core::string_view("12"), value);
+    BOOST_TEST(r.need_more_input);
+    BOOST_TEST_EQ(value, 42.0);
+    parser.reset();
+    BOOST_TEST_EQ(parser.pending(), 0U);
+
+    r = parser.parse(boost::core::string_view("5"), value, true);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(value, 5.0);
+
+    boost::charconv::resumable_from_chars<unsigned> unsigned_parser;
+    unsigned u = 0;
+    r = unsigned_parser.parse(boost::core::string_view("-"), u);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+}
+
+int main()
+{
+    test_float<double>();
+    test_float<float>();
+
+    test_integer<int>();
+    test_integer<unsigned>();
+    test_integer<std::int64_t>();
+    test_integer<unsigned short>();
+
+    test_ring_buffer();
+    test_limits();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,294 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// The directed modes are checked against the C library, which rounds in the mode of the floating point environment.
+// The conversions of charconv do not depend on that mode, so they are called while it is set too
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <limits>
+#include <iostream>
+#include <cfenv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+
+#if defined(FE_TONEAREST) && defined(FE_TOWARDZERO) && defined(FE_UPWARD) && defined(FE_DOWNWARD) && defined(__GLIBC__)
+
+using boost::charconv::chars_format;
+using boost::charconv::rounding_mode;
+
+static std::mt19937_64 rng(42);
+
+static constexpr rounding_mode modes[] {rounding_mode::to_nearest, rounding_mode::toward_zero,
+                                        rounding_mode::toward_infinity, rounding_mode::toward_neg_infinity};
+
+int fe_mode(rounding_mode mode)
+{
+    switch (mode)
+    {
+        case rounding_mode::toward_zero: return FE_TOWARDZERO;
+        case rounding_mode::toward_infinity: return FE_UPWARD;
+        case rounding_mode::toward_neg_infinity: return FE_DOWNWARD;
+        default: return FE_TONEAREST;
+    }
+}
+
+template <typename T>
+T c_strto(const char* str);
+
+template <>
+float c_strto<float>(const char* str)
+{
+    return std::strtof(str, nullptr);
+}
+
+template <>
+double c_strto<double>(const char* str)
+{
+    return std::strtod(str, nullptr);
+}
+
+template <typename T>
+bool same_bits(T lhs, T rhs)
+{
+    return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+}
+
+template <typename T>
+void check_from_chars(const std::string& str, chars_format fmt = chars_format::general)
+{
+    for (const auto mode : modes)
+    {
+        std::fesetround(fe_mode(mode));
+        const bool negative = str[0] == '-';
+        const std::string c_str = fmt == chars_format::hex ? (negative ? "-0x" : "0x") + str.substr(negative ? 1 : 0) : str;
+        const T expected = c_strto<T>(c_str.c_str());
+
+        T value = T(42);
+        const auto r = boost::charconv::from_chars(str.data(), str.data() + str.size(), value, fmt, mode);
+        std::fesetround(FE_TONEAREST);
+
+        const bool nonzero = fmt == chars_format::hex ? str.find_first_of("123456789abcdefABCDEF") < str.find_first_of("pP") :
+                                                        str.find_first_of("123456789") < str.find_first_of("eE");
+        const bool out_of_range = std::isinf(expected) || (expected == 0 && nonzero);
+        BOOST_TEST(r.ptr == str.data() + str.size());
+        if (out_of_range)
+        {
+            BOOST_TEST(r.ec == std::errc::result_out_of_range);
+            BOOST_TEST_EQ(value, T(42));
+        }
+        else if (BOOST_TEST(r) && !BOOST_TEST(same_bits(value, expected)))
+        {
+            // LCOV_EXCL_START
+            std::cerr << std::hexfloat << "String: " << str << "\nMode: " << static_cast<unsigned>(mode)
+                      << "\nValue: " << value << "\nExpected: " << expected << std::endl;
+            // LCOV_EXCL_STOP
+        }
+    }
+}
+
+std::string random_digits(std::size_t count)
+{
+    std::string str;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        str += static_cast<char>('0' + rng() % 10);
+    }
+    return str;
+}
+
+template <typename T>
+void test_random_from_chars()
+{
+    std::uniform_int_distribution<int> exponent_dist(std::numeric_limits<T>::min_exponent10 - 25, std::numeric_limits<T>::max_exponent10 + 5);
+    for (int i = 0; i < 20000; ++i)
+    {
+        // Short inputs in and out of Clinger's range, and long ones past the digits that the fast path reads
+        const std::size_t count = i % 4 == 0 ? 30 + rng() % 800 : 1 + rng() % 20;
+        std::string str = random_digits(1) + "." + random_digits(count);
+        str += 'e';
+        str += std::to_string(i % 3 == 0 ? static_cast<int>(rng() % 20) - 10 : exponent_dist(rng));
+        if (rng() % 2 == 0)
+        {
+            str.insert(0, 1, '-');
+        }
+        check_from_chars<T>(str);
+    }
+
+    // The values themselves are exact, and the midpoints next to them are too close to tell from the product
+    for (int i = 0; i < 5000; ++i)
+    {
+        using bits_type = typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type;
+        const auto bits = static_cast<bits_type>(rng()) & ~(bits_type(1) << (sizeof(T) * 8 - 1));
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (std::isfinite(value))
+        {
+            char buffer[1100];
+            auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, chars_format::scientific, 1000);
+            check_from_chars<T>(std::string(buffer, r.ptr));
+
+            const T next = std::nextafter(value, std::numeric_limits<T>::infinity());
+            if (std::isfinite(next))
+            {
+                // 60 digits are enough to tell the midpoint from the ones next to it for both types
+                r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), static_cast<long double>(value) / 2 + static_cast<long double>(next) / 2,
+                                              chars_format::scientific, 60);
+                check_from_chars<T>(std::string(buffer, r.ptr));
+            }
+
+            r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, chars_format::hex);
+            check_from_chars<T>(std::string(buffer, r.ptr) + "8", chars_format::hex);
+        }
+    }
+}
+
+template <typename T>
+void test_spot_from_chars()
+{
+    for (const char* str : {"0", "-0", "1", "0.1", "-0.1", "1e400", "-1e400", "1e-400", "-1e-400", "1e-46", "1e39",
+                            "4.9406564584124654e-324", "2.4703282292062327e-324", "2.4703282292062328e-324",
+                            "1.7976931348623157e308", "1.7976931348623158e308", "1.7976931348623159e308",
+                            "3.4028235e38", "3.4028236e38", "1.401298464e-45", "7e-46", "9007199254740993",
+                            "18014398509481984", "123456789012345678901234567890", "0.000000000000000000000000000001"})
+    {
+        check_from_chars<T>(str);
+    }
+
+    for (const char* str : {"1.000001", "1.0000000000000008", "1.fffffffffffff8p1023", "1.ffffffp127", "1p-1075", "1.8p-1075",
+                            "1p-150", "1.000000000000000000000001p0", "-1.0000000000000000001p-1022"})
+    {
+        check_from_chars<T>(str, chars_format::hex);
+    }
+
+    // Infinity and nan are not rounded, and the format still applies
+    T value = T(42);
+    auto r = boost::charconv::from_chars("inf", value, chars_format::general, rounding_mode::toward_zero);
+    BOOST_TEST(r && std::isinf(value));
+    r = boost::charconv::from_chars("-nan", value, chars_format::general, rounding_mode::toward_infinity);
+    BOOST_TEST(r && std::isnan(value));
+    value = T(42);
+    r = boost::charconv::from_chars("1e5", value, chars_format::fixed, rounding_mode::toward_zero);
+    BOOST_TEST(r && value == T(1));
+    r = boost::charconv::from_chars("x", value, chars_format::general, rounding_mode::toward_zero);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+
+    // The two directed modes bound the value, and are one unit in the last place apart unless it is exact
+    T lower;
+    T upper;
+    BOOST_TEST(boost::charconv::from_chars("0.1", lower, chars_format::general, rounding_mode::toward_neg_infinity));
+    BOOST_TEST(boost::charconv::from_chars("0.1", upper, chars_format::general, rounding_mode::toward_infinity));
+    BOOST_TEST_EQ(std::nextafter(lower, T(1)), upper);
+    BOOST_TEST(boost::charconv::from_chars("0.5", lower, chars_format::general, rounding_mode::toward_neg_infinity));
+    BOOST_TEST(boost::charconv::from_chars("0.5", upper, chars_format::general, rounding_mode::toward_infinity));
+    BOOST_TEST_EQ(lower, upper);
+}
+
+template <typename T>
+void check_to_chars(T value, chars_format fmt, int precision)
+{
+    const char* const c_format = fmt == chars_format::fixed ? "%.*f" : fmt == chars_format::scientific ? "%.*e" : "%.*g";
+    for (const auto mode : modes)
+    {
+        char buffer[1200];
+        char expected[1200];
+        std::fesetround(fe_mode(mode));
+        const int expected_length = std::snprintf(expected, sizeof(expected), c_format, precision, static_cast<double>(value));
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt, precision, mode);
+        std::fesetround(FE_TONEAREST);
+
+        BOOST_TEST(r);
+        if (!BOOST_TEST_EQ(std::string(buffer, r.ptr), std::string(expected, static_cast<std::size_t>(expected_length))))
+        {
+            // LCOV_EXCL_START
+            std::cerr << std::hexfloat << "Value: " << value << "\nMode: " << static_cast<unsigned>(mode)
+                      << "\nFormat: " << static_cast<unsigned>(fmt) << "\nPrecision: " << precision << std::endl;
+            // LCOV_EXCL_STOP
+        }
+    }
+}
+
+template <typename T>
+void test_random_to_chars()
+{
+    using bits_type = typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type;
+    for (int i = 0; i < 5000; ++i)
+    {
+        const auto bits = static_cast<bits_type>(rng());
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (!std::isfinite(value))
+        {
+            continue;
+        }
+
+        // Values that are small enough for fixed notation to show some of their digits, and precisions on both sides of floff's
+        const int precision = static_cast<int>(rng() % 30);
+        check_to_chars(value, chars_format::scientific, precision);
+        check_to_chars(value, chars_format::general, precision);
+        if (std::fabs(value) < T(1e30))
+        {
+            check_to_chars(value, chars_format::fixed, precision);
+        }
+
+        // Decimal values keep their fraction in one word of the fast fixed path
+        const T decimal = static_cast<T>(static_cast<double>(static_cast<std::int64_t>(rng() % 2000000) - 1000000) / 1024.0 + 0.1);
+        check_to_chars(decimal, chars_format::fixed, static_cast<int>(rng() % 12));
+    }
+}
+
+void test_spot_to_chars()
+{
+    for (const double value : {0.0, -0.0, 1.0, -1.0, 0.5, 2.5, -2.5, 0.1, -0.1, 0.125, 9.9999, -9.9999, 1e300, 5e-324, -5e-324, 1e-310})
+    {
+        for (const int precision : {0, 1, 2, 3, 6, 17, 20, 40})
+        {
+            check_to_chars(value, chars_format::scientific, precision);
+            check_to_chars(value, chars_format::general, precision);
+            check_to_chars(value, chars_format::fixed, precision);
+            check_to_chars(static_cast<float>(value), chars_format::scientific, precision);
+        }
+    }
+
+    char buffer[64];
+    BOOST_TEST(boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 1.0, chars_format::hex, 2, rounding_mode::toward_zero).ec == std::errc::invalid_argument);
+    BOOST_TEST(boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 1.0, chars_format::general, -1, rounding_mode::toward_zero).ec == std::errc::invalid_argument);
+    BOOST_TEST(boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 1.0, chars_format::hex, -1, rounding_mode::to_nearest));
+    BOOST_TEST(boost::charconv::to_chars(buffer, buffer + 2, 0.1, chars_format::fixed, 3, rounding_mode::toward_infinity).ec == std::errc::result_out_of_range);
+
+    // Carries into a new digit
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 9.95, chars_format::fixed, 1, rounding_mode::toward_infinity);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "10.0");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), -9.99, chars_format::scientific, 1, rounding_mode::toward_neg_infinity);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "-1.0e+01");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 0.1, chars_format::general, 3, rounding_mode::toward_zero);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "0.1");
+}
+
+int main()
+{
+    test_random_from_chars<double>();
+    test_random_from_chars<float>();
+    test_spot_from_chars<double>();
+    test_spot_from_chars<float>();
+    test_random_to_chars<double>();
+    test_random_to_chars<float>();
+    test_spot_to_chars();
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,116 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/slow_path_counters.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <thread>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+
+// Exactly halfway between two doubles after the first 19 digits, so only the digit comparison can round it
+static const char* const halfway_double = "9007199254740993.00000000000000000001";
+static const char* const halfway_float = "1.00000005960464477539062500000001";
+
+template <typename T>
+void parse(const char* str)
+{
+    T value {};
+    const auto r = boost::charconv::from_chars(str, str + std::strlen(str), value);
+    BOOST_TEST(r.ec == std::errc());
+}
+
+template <typename T>
+void print(T value, chars_format fmt, int precision)
+{
+    char buffer[128] {};
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt, precision);
+    BOOST_TEST(r.ec == std::errc());
+}
+
+void test_fast_paths()
+{
+    boost::charconv::reset_slow_path_counters();
+
+    parse<double>("1.5");
+    parse<double>("-2.2250738585072014e-308");
+    parse<float>("3.4028235e+38");
+    print(1.0 / 3, chars_format::general, -1);
+    print(1.0f / 3, chars_format::scientific, -1);
+
+    const auto c = boost::charconv::get_slow_path_counters();
+    BOOST_TEST_EQ(c.from_chars_slow_path, UINT64_C(0));
+    BOOST_TEST_EQ(c.from_chars_digit_comparison, UINT64_C(0));
+    BOOST_TEST_EQ(c.to_chars_printf, UINT64_C(0));
+    BOOST_TEST_EQ(c.to_chars_floff, UINT64_C(0));
+    BOOST_TEST_EQ(c.to_chars_exact, UINT64_C(0));
+}
+
+void test_slow_paths()
+{
+    boost::charconv::reset_slow_path_counters();
+
+    parse<double>(halfway_double);
+    parse<float>(halfway_float);
+    print(1.0 / 3, chars_format::scientific, 6);
+    print(1.0 / 3, chars_format::general, 10);
+    print(1.0 / 3, chars_format::scientific, 40);
+
+    #if BOOST_CHARCONV_LDBL_BITS == 80
+    parse<long double>("1.00000000000000000005421010862427522170037264004349708557128906250000001");
+    #endif
+
+    const std::uint64_t n = boost::charconv::slow_path_counters_enabled() ? 1 : 0;
+
+    auto c = boost::charconv::get_slow_path_counters();
+    BOOST_TEST_EQ(c.from_chars_digit_comparison, 2 * n);
+    BOOST_TEST_EQ(c.to_chars_floff, 2 * n);
+    BOOST_TEST_EQ(c.to_chars_exact, n);
+    #if BOOST_CHARCONV_LDBL_BITS == 80
+    BOOST_TEST_EQ(c.from_chars_slow_path, n);
+    #endif
+
+    boost::charconv::reset_slow_path_counters();
+    c = boost::charconv::get_slow_path_counters();
+    BOOST_TEST_EQ(c.from_chars_slow_path, UINT64_C(0));
+    BOOST_TEST_EQ(c.from_chars_digit_comparison, UINT64_C(0));
+    BOOST_TEST_EQ(c.to_chars_floff, UINT64_C(0));
+    BOOST_TEST_EQ(c.to_chars_exact, UINT64_C(0));
+}
+
+// Every thread counts its own conversions
+void test_threads()
+{
+    boost::charconv::reset_slow_path_counters();
+    parse<double>(halfway_double);
+
+    std::uint64_t other_thread = 0;
+    std::thread t([&]
+    {
+        parse<double>(halfway_double);
+        parse<double>(halfway_double);
+        parse<double>(halfway_double);
+        other_thread = boost::charconv::get_slow_path_counters().from_chars_digit_comparison;
+    });
+    t.join();
+
+    const std::uint64_t n = boost::charconv::slow_path_counters_enabled() ? 1 : 0;
+    BOOST_TEST_EQ(other_thread, 3 * n);
+    BOOST_TEST_EQ(boost::charconv::get_slow_path_counters().from_chars_digit_comparison, n);
+}
+
+int main()
+{
+    #ifdef BOOST_CHARCONV_ENABLE_SLOW_PATH_COUNTERS
+    BOOST_TEST(boost::charconv::slow_path_counters_enabled());
+    #endif
+
+    test_fast_paths();
+    test_slow_paths();
+    test_threads();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,190 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/slow_path_counters.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <thread>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+using boost::charconv::chars_format;
+using boost::charconv::slow_path;
+using boost::charconv::slow_path_sample;
+
+// Exactly halfway between two doubles after the first 19 digits, so only the digit comparison can round it
+static const char* const halfway_double = "9007199254740993.00000000000000000001";
+
+template <typename T>
+void parse(const char* str)
+{
+    T value {};
+    const auto r = boost::charconv::from_chars(str, str + std::strlen(str), value);
+    BOOST_TEST(r.ec == std::errc());
+}
+
+void print(double value, int precision)
+{
+    char buffer[128] {};
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, chars_format::scientific, precision);
+    BOOST_TEST(r.ec == std::errc());
+}
+
+std::vector<slow_path_sample> drain()
+{
+    std::vector<slow_path_sample> samples(boost::charconv::slow_path_samples_capacity() + 1);
+    samples.resize(boost::charconv::drain_slow_path_samples(samples.data(), samples.size()));
+    return samples;
+}
+
+bool holds_value(const slow_path_sample& sample, double value)
+{
+    return sample.size == sizeof(value) && std::memcmp(sample.data, &value, sizeof(value)) == 0;
+}
+
+void test_disabled()
+{
+    BOOST_TEST_EQ(boost::charconv::slow_path_samples_capacity(), static_cast<std::size_t>(0));
+
+    parse<double>(halfway_double);
+    print(1.0 / 3, 6);
+
+    slow_path_sample sample {};
+    BOOST_TEST_EQ(boost::charconv::drain_slow_path_samples(&sample, 1), static_cast<std::size_t>(0));
+    BOOST_TEST_EQ(boost::charconv::dropped_slow_path_samples(), UINT64_C(0));
+}
+
+void test_fast_paths()
+{
+    boost::charconv::clear_slow_path_samples();
+
+    parse<double>("1.5");
+    parse<float>("3.4028235e+38");
+    print(1.0 / 3, -1);
+
+    BOOST_TEST(drain().empty());
+}
+
+void test_inputs()
+{
+    boost::charconv::clear_slow_path_samples();
+
+    // The digit comparison keeps the number from its first significant digit
+    parse<double>(halfway_double);
+    print(1.0 / 3, 6);
+    print(1.0 / 3, 40);
+
+    // Longer than a sample
+    const std::string long_input = std::string("-9007199254740993.") + std::string(80, '0') + "1e0";
+    parse<double>(long_input.c_str());
+
+    const auto samples = drain();
+    BOOST_TEST_EQ(samples.size(), static_cast<std::size_t>(4));
+    if (samples.size() != 4)
+    {
+        return;
+    }
+
+    BOOST_TEST(samples[0].path == slow_path::from_chars_digit_comparison);
+    BOOST_TEST_EQ(samples[0].digits, 53);
+    BOOST_TEST_EQ(samples[0].input_size, std::strlen(halfway_double));
+    BOOST_TEST_EQ(samples[0].size, std::strlen(halfway_double));
+    BOOST_TEST_EQ(std::string(reinterpret_cast<const char*>(samples[0].data), samples[0].size), std::string(halfway_double));
+
+    BOOST_TEST(samples[1].path == slow_path::to_chars_floff);
+    BOOST_TEST_EQ(samples[1].digits, 53);
+    BOOST_TEST(holds_value(samples[1], 1.0 / 3));
+
+    BOOST_TEST(samples[2].path == slow_path::to_chars_exact);
+    BOOST_TEST_EQ(samples[2].digits, 53);
+    BOOST_TEST(holds_value(samples[2], 1.0 / 3));
+
+    BOOST_TEST(samples[3].path == slow_path::from_chars_digit_comparison);
+    BOOST_TEST_EQ(samples[3].digits, 53);
+    BOOST_TEST_EQ(samples[3].input_size, long_input.size() - 1);
+    BOOST_TEST_EQ(samples[3].size, boost::charconv::slow_path_sample_max_size);
+    BOOST_TEST_EQ(std::string(reinterpret_cast<const char*>(samples[3].data), samples[3].size),
+                  long_input.substr(1, boost::charconv::slow_path_sample_max_size));
+
+    BOOST_TEST(drain().empty());
+}
+
+// A full buffer drops its oldest samples
+void test_overflow()
+{
+    boost::charconv::clear_slow_path_samples();
+
+    const std::size_t capacity = boost::charconv::slow_path_samples_capacity();
+    const std::size_t extra = 5;
+    for (std::size_t i = 0; i != capacity + extra; ++i)
+    {
+        print(static_cast<double>(i) + 0.25, 6);
+    }
+
+    BOOST_TEST_EQ(boost::charconv::dropped_slow_path_samples(), static_cast<std::uint64_t>(extra));
+
+    // Draining in two parts keeps the order
+    slow_path_sample first_two[2] {};
+    BOOST_TEST_EQ(boost::charconv::drain_slow_path_samples(first_two, 2), static_cast<std::size_t>(2));
+    BOOST_TEST(holds_value(first_two[0], static_cast<double>(extra) + 0.25));
+    BOOST_TEST(holds_value(first_two[1], static_cast<double>(extra + 1) + 0.25));
+
+    const auto rest = drain();
+    BOOST_TEST_EQ(rest.size(), capacity - 2);
+    for (std::size_t i = 0; i != rest.size(); ++i)
+    {
+        BOOST_TEST(holds_value(rest[i], static_cast<double>(extra + 2 + i) + 0.25));
+    }
+
+    boost::charconv::clear_slow_path_samples();
+    BOOST_TEST_EQ(boost::charconv::dropped_slow_path_samples(), UINT64_C(0));
+
+    print(0.5, 6);
+    boost::charconv::clear_slow_path_samples();
+    BOOST_TEST(drain().empty());
+}
+
+// Every thread keeps its own samples
+void test_threads()
+{
+    boost::charconv::clear_slow_path_samples();
+    print(0.75, 6);
+
+    std::size_t other_thread = 0;
+    std::thread t([&]
+    {
+        parse<double>(halfway_double);
+        parse<double>(halfway_double);
+        other_thread = drain().size();
+    });
+    t.join();
+
+    BOOST_TEST_EQ(other_thread, static_cast<std::size_t>(2));
+
+    const auto samples = drain();
+    BOOST_TEST_EQ(samples.size(), static_cast<std::size_t>(1));
+    BOOST_TEST(!samples.empty() && holds_value(samples[0], 0.75));
+}
+
+int main()
+{
+    #ifdef BOOST_CHARCONV_ENABLE_SLOW_PATH_SAMPLES
+    BOOST_TEST(boost::charconv::slow_path_samples_enabled());
+    BOOST_TEST(boost::charconv::slow_path_samples_capacity() != 0);
+
+    test_fast_paths();
+    test_inputs();
+    test_overflow();
+    test_threads();
+    #else
+    BOOST_TEST(!boost::charconv::slow_path_samples_enabled());
+
+    test_disabled();
+    #endif
+
+    return boost::report_errors();
+}
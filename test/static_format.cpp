@@ -0,0 +1,126 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The overloads with the format and the precision as template arguments give the same results as the ones with them
+// as function arguments
+
+#include <boost/charconv/static_format.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <string>
+#include <limits>
+#include <iomanip>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+
+static std::mt19937_64 rng(42);
+
+template <chars_format Fmt, int Precision, typename T>
+void test_to_chars(T value)
+{
+    char expected[2048];
+    char buffer[2048];
+    for (const std::ptrdiff_t size : {std::ptrdiff_t(sizeof(buffer)), std::ptrdiff_t(8), std::ptrdiff_t(1), std::ptrdiff_t(0)})
+    {
+        const auto r1 = Precision < 0 ? boost::charconv::to_chars(expected, expected + size, value, Fmt) :
+                                        boost::charconv::to_chars(expected, expected + size, value, Fmt, Precision);
+        const auto r2 = boost::charconv::to_chars<Fmt, Precision>(buffer, buffer + size, value);
+        if (!BOOST_TEST(r1.ec == r2.ec) || (r1 && !BOOST_TEST_EQ(std::string(expected, r1.ptr), std::string(buffer, r2.ptr))))
+        {
+            // LCOV_EXCL_START
+            std::cerr << std::setprecision(std::numeric_limits<T>::max_digits10) << "Value: " << value
+                      << "\nFormat: " << static_cast<int>(Fmt) << "\nPrecision: " << Precision << "\nSize: " << size << std::endl;
+            // LCOV_EXCL_STOP
+        }
+    }
+}
+
+template <chars_format Fmt, typename T>
+void test_format(T value)
+{
+    test_to_chars<Fmt, -1>(value);
+    test_to_chars<Fmt, 0>(value);
+    test_to_chars<Fmt, 1>(value);
+    test_to_chars<Fmt, 2>(value);
+    test_to_chars<Fmt, 6>(value);
+    test_to_chars<Fmt, 17>(value);
+    test_to_chars<Fmt, 40>(value);
+
+    // Parsing the shortest output, and something else to parse
+    char buffer[64];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, Fmt == chars_format::fixed ? chars_format::general : Fmt);
+    for (const std::string& str : {std::string(buffer, r.ptr), std::string("1e5"), std::string("-12.5"), std::string("0x1p3"), std::string("inf"), std::string("")})
+    {
+        T expected = T(42);
+        T parsed = T(42);
+        const auto r1 = boost::charconv::from_chars(str.data(), str.data() + str.size(), expected, Fmt);
+        const auto r2 = boost::charconv::from_chars<Fmt>(str.data(), str.data() + str.size(), parsed);
+        BOOST_TEST(r1.ec == r2.ec);
+        BOOST_TEST(r1.ptr == r2.ptr);
+        if (!(std::isnan(expected) && std::isnan(parsed)))
+        {
+            BOOST_TEST_EQ(expected, parsed);
+        }
+    }
+}
+
+template <typename T>
+void test_value(T value)
+{
+    test_format<chars_format::general>(value);
+    test_format<chars_format::fixed>(value);
+    test_format<chars_format::scientific>(value);
+    test_format<chars_format::hex>(value);
+    test_format<chars_format::engineering>(value);
+}
+
+template <typename T, typename Bits>
+void test_random_bits()
+{
+    for (int i = 0; i < 2000; ++i)
+    {
+        const auto bits = static_cast<Bits>(rng());
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+        test_value(value);
+    }
+
+    // Prices and metrics, which the fixed precision printer writes from a single multiplication
+    std::uniform_real_distribution<T> dist(T(-1e6), T(1e6));
+    for (int i = 0; i < 2000; ++i)
+    {
+        test_value(dist(rng));
+    }
+
+    for (const T value : {T(0), -T(0), T(1), T(0.5), T(9.995), (std::numeric_limits<T>::max)(), std::numeric_limits<T>::denorm_min(),
+                          std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::quiet_NaN()})
+    {
+        test_value(value);
+    }
+}
+
+int main()
+{
+    test_random_bits<double, std::uint64_t>();
+    test_random_bits<float, std::uint32_t>();
+
+    char buffer[64];
+    auto r = boost::charconv::to_chars<chars_format::fixed, 2>(buffer, buffer + sizeof(buffer), 1234.5678);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1234.57");
+    r = boost::charconv::to_chars<chars_format::scientific, 3>(buffer, buffer + sizeof(buffer), 0.1F);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1.000e-01");
+    r = boost::charconv::to_chars<chars_format::scientific>(buffer, buffer + sizeof(buffer), 1e300);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1e+300");
+
+    double value {};
+    const auto fr = boost::charconv::from_chars<chars_format::fixed>(boost::core::string_view("3.25e2"), value);
+    BOOST_TEST(fr && value == 3.25);
+
+    return boost::report_errors();
+}
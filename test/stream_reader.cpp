@@ -0,0 +1,162 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/stream_reader.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 1024;
+
+void test_basic()
+{
+    const char* buffer = "1,2.5,skip me,0.25\r\n"
+                         "-2,1e10,xx,-1.5\n"
+                         "\n"
+                         "3,-0,,1";
+
+    std::int64_t ids[4] {};
+    double prices[4] {};
+    float sizes[4] {};
+
+    const boost::charconv::stream_column columns[] = {ids, prices, nullptr, sizes};
+    boost::charconv::stream_reader reader(columns, 4, 4);
+
+    // Without final_chunk the last row is incomplete and not consumed
+    auto r = reader.feed(buffer, buffer + std::strlen(buffer));
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(reader.rows(), 2U);
+    BOOST_TEST(r.ptr == std::strstr(buffer, "3,-0"));
+
+    r = reader.feed(r.ptr, buffer + std::strlen(buffer), true);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(reader.rows(), 3U);
+    BOOST_TEST(r.ptr == buffer + std::strlen(buffer));
+
+    BOOST_TEST_EQ(ids[0], 1);
+    BOOST_TEST_EQ(ids[1], -2);
+    BOOST_TEST_EQ(ids[2], 3);
+    BOOST_TEST_EQ(prices[0], 2.5);
+    BOOST_TEST_EQ(prices[1], 1e10);
+    BOOST_TEST_EQ(prices[2], 0.0);
+    BOOST_TEST_EQ(sizes[0], 0.25F);
+    BOOST_TEST_EQ(sizes[1], -1.5F);
+    BOOST_TEST_EQ(sizes[2], 1.0F);
+}
+
+void test_errors()
+{
+    std::int64_t a[4] {};
+    double b[4] {};
+    const boost::charconv::stream_column columns[] = {a, b};
+
+    // Bad field
+    const char* buffer = "1,2\n3,x\n";
+    boost::charconv::stream_reader reader(columns, 2, 4);
+    auto r = reader.feed(buffer, buffer + std::strlen(buffer));
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST(r.ptr == buffer + 6);
+    BOOST_TEST_EQ(reader.rows(), 1U);
+
+    // Missing field
+    buffer = "1\n";
+    boost::charconv::stream_reader reader2(columns, 2, 4);
+    r = reader2.feed(buffer, buffer + std::strlen(buffer));
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST(r.ptr == buffer + 1);
+    BOOST_TEST_EQ(reader2.rows(), 0U);
+
+    // Extra field
+    buffer = "1,2,3\n";
+    boost::charconv::stream_reader reader3(columns, 2, 4);
+    r = reader3.feed(buffer, buffer + std::strlen(buffer));
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST(r.ptr == buffer + 3);
+
+    // Integer overflow
+    buffer = "99999999999999999999,2\n";
+    boost::charconv::stream_reader reader4(columns, 2, 4);
+    r = reader4.feed(buffer, buffer + std::strlen(buffer));
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+
+    // Output capacity exhausted, then drained and resumed
+    buffer = "1,1\n2,2\n3,3\n";
+    boost::charconv::stream_reader reader5(columns, 2, 2);
+    r = reader5.feed(buffer, buffer + std::strlen(buffer));
+    BOOST_TEST(r.ec == std::errc::value_too_large);
+    BOOST_TEST(r.ptr == buffer + 8);
+    BOOST_TEST_EQ(reader5.rows(), 2U);
+    reader5.reset();
+    r = reader5.feed(r.ptr, buffer + std::strlen(buffer));
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(reader5.rows(), 1U);
+    BOOST_TEST_EQ(a[0], 3);
+    BOOST_TEST_EQ(b[0], 3.0);
+}
+
+// Feeds random data in random sized chunks carrying the incomplete row over like a file reader would
+void test_chunked()
+{
+    std::uniform_int_distribution<std::int64_t> int_dist(INT64_MIN, INT64_MAX);
+    std::uniform_real_distribution<double> double_dist(-1e100, 1e100);
+
+    std::vector<std::int64_t> expected_ints(N);
+    std::vector<double> expected_doubles(N);
+    std::string text;
+    char temp[64];
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        expected_ints[i] = int_dist(rng);
+        expected_doubles[i] = double_dist(rng);
+
+        auto r = boost::charconv::to_chars(temp, temp + sizeof(temp), expected_ints[i]);
+        text.append(temp, r.ptr);
+        text.push_back('\t');
+        r = boost::charconv::to_chars(temp, temp + sizeof(temp), expected_doubles[i]);
+        text.append(temp, r.ptr);
+        text.push_back('\n');
+    }
+
+    std::vector<std::int64_t> ints(N);
+    std::vector<double> doubles(N);
+    const boost::charconv::stream_column columns[] = {ints.data(), doubles.data()};
+    boost::charconv::stream_reader reader(columns, 2, N, '\t');
+
+    std::uniform_int_distribution<std::size_t> chunk_dist(1, 100);
+    std::string carry;
+    std::size_t pos = 0;
+    while (pos < text.size())
+    {
+        const std::size_t len = (std::min)(chunk_dist(rng), text.size() - pos);
+        carry.append(text, pos, len);
+        pos += len;
+
+        const auto r = reader.feed(carry, pos == text.size());
+        BOOST_TEST(r);
+        carry.erase(0, static_cast<std::size_t>(r.ptr - carry.data()));
+    }
+
+    BOOST_TEST(carry.empty());
+    BOOST_TEST_EQ(reader.rows(), N);
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        BOOST_TEST_EQ(ints[i], expected_ints[i]);
+        BOOST_TEST_EQ(doubles[i], expected_doubles[i]);
+    }
+}
+
+int main()
+{
+    test_basic();
+    test_errors();
+    test_chunked();
+
+    return boost::report_errors();
+}
@@ -61,6 +61,7 @@ std::ostream& operator<<( std::ostream& os, boost::int128_type v )
 
 #include <boost/charconv/detail/emulated128.hpp>
 #include <boost/core/lightweight_test.hpp>
+#include <boost/core/detail/splitmix64.hpp>
 #include <limits>
 #include <iostream>
 #include <climits>
@@ -225,6 +226,64 @@ void test_limits()
     BOOST_TEST(std::numeric_limits<uint128>::digits10 == 38);
 }
 
+#ifdef BOOST_CHARCONV_HAS_INT128
+
+// The quotients and remainders by constants, and the division by divisors below 2^32, against the built-in type
+void test_division_by_constants()
+{
+    using boost::charconv::detail::div_mod_5;
+    using boost::charconv::detail::div_mod_10;
+    using boost::charconv::detail::div_mod_10_9;
+    using boost::charconv::detail::div_mod_10_19;
+
+    boost::detail::splitmix64 rng;
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        boost::uint128_type reference = (static_cast<boost::uint128_type>(rng()) << 64) | rng();
+        reference >>= i % 128;
+        if (i < 4)
+        {
+            reference = i < 2 ? static_cast<boost::uint128_type>(i) : ~static_cast<boost::uint128_type>(0) - static_cast<boost::uint128_type>(i - 2);
+        }
+
+        uint128 x = reference;
+        BOOST_TEST_EQ(div_mod_5(x), static_cast<std::uint32_t>(reference % 5));
+        BOOST_TEST(x == reference / 5);
+
+        x = reference;
+        BOOST_TEST_EQ(div_mod_10(x), static_cast<std::uint32_t>(reference % 10));
+        BOOST_TEST(x == reference / 10);
+
+        x = reference;
+        BOOST_TEST_EQ(div_mod_10_9(x), static_cast<std::uint32_t>(reference % 1000000000));
+        BOOST_TEST(x == reference / 1000000000);
+
+        x = reference;
+        BOOST_TEST_EQ(div_mod_10_19(x), static_cast<std::uint64_t>(reference % UINT64_C(10000000000000000000)));
+        BOOST_TEST(x == reference / UINT64_C(10000000000000000000));
+
+        boost::uint128_type builtin = reference;
+        BOOST_TEST_EQ(div_mod_10(builtin), static_cast<std::uint32_t>(reference % 10));
+        BOOST_TEST(builtin == reference / 10);
+
+        const std::uint64_t divisor = i % 2 == 0 ? (rng() >> 32) + 1 : rng() >> (i % 64);
+        if (divisor != 0)
+        {
+            BOOST_TEST(uint128(reference) / divisor == reference / divisor);
+            BOOST_TEST(uint128(reference) % divisor == reference % divisor);
+        }
+    }
+}
+
+#else
+
+void test_division_by_constants()
+{
+}
+
+#endif
+
 int main()
 {
     test_relational_operators<char>();
@@ -241,6 +300,8 @@ int main()
 
     test_arithmetic_operators();
 
+    test_division_by_constants();
+
     test_bitwise_operators();
 
     test_memcpy();
@@ -10,6 +10,10 @@
 #include <cmath>
 
 using boost::charconv::detail::compute_float64;
+using boost::charconv::detail::significands_table;
+using boost::charconv::detail::significand_high;
+using boost::charconv::detail::significand_low;
+using boost::charconv::detail::significand_is_exact;
 
 inline void simple_test()
 {
@@ -29,9 +33,67 @@ inline void simple_test()
     BOOST_TEST_EQ(compute_float64(100, UINT64_C(4444444444444444444), false, success), 4444444444444444444e100);
 }
 
+// The table of powers of ten shared by from_chars and to_chars: every entry is normalized,
+// the exact ones are 5^k, and every other one is 10 times the one before it truncated,
+// which is within two units in the last place of truncating 10 times its truncated value
+inline void test_shared_table()
+{
+    using boost::charconv::detail::umul128;
+
+    std::uint64_t exact_high = 0;
+    std::uint64_t exact_low = 1;
+
+    for (int k = significands_table::smallest_power; k <= significands_table::largest_power; ++k)
+    {
+        const std::uint64_t high = significand_high(k);
+        const std::uint64_t low = significand_low(k);
+        BOOST_TEST((high >> 63) == 1U);
+
+        if (significand_is_exact(k))
+        {
+            std::uint64_t h = exact_high;
+            std::uint64_t l = exact_low;
+            while ((h >> 63) == 0)
+            {
+                h = (h << 1) | (l >> 63);
+                l <<= 1;
+            }
+            BOOST_TEST_EQ(high, h);
+            BOOST_TEST_EQ(low, l);
+
+            const auto product_low = umul128(exact_low, 5);
+            exact_high = exact_high * 5 + product_low.high;
+            exact_low = product_low.low;
+        }
+        else
+        {
+            // Rounding it up never carries into the high word
+            BOOST_TEST_NE(low, UINT64_MAX);
+        }
+
+        // Ten times the truncated 10^-1 falls just short of the power of two 10^0, so it is normalized differently
+        if (k > significands_table::smallest_power && k != 0)
+        {
+            // Ten times the previous entry in three words, shifted right by 3 or 4 bits to normalize it
+            const auto low_product = umul128(significand_low(k - 1), 10);
+            const auto high_product = umul128(significand_high(k - 1), 10);
+            const std::uint64_t middle = high_product.low + low_product.high;
+            const std::uint64_t top = high_product.high + (middle < low_product.high ? 1U : 0U);
+            const int shift = top >= 8 ? 4 : 3;
+            const std::uint64_t expected_low = (low_product.low >> shift) | (middle << (64 - shift));
+            const std::uint64_t expected_high = (middle >> shift) | (top << (64 - shift));
+
+            BOOST_TEST(high > expected_high || (high == expected_high && low >= expected_low));
+            const std::uint64_t difference = low - expected_low;
+            BOOST_TEST(difference <= 2U);
+        }
+    }
+}
+
 int main(void)
 {
     simple_test();
+    test_shared_table();
 
     return boost::report_errors();
 }
@@ -87,6 +87,7 @@ std::ostream& operator<<( std::ostream& os, boost::int128_type v )
 #include <boost/core/detail/splitmix64.hpp>
 #include <boost/charconv/detail/generate_nan.hpp>
 #include <boost/charconv/detail/issignaling.hpp>
+#include <boost/charconv/detail/ryu/ryu_generic_128.hpp>
 #include <limits>
 #include <iostream>
 #include <iomanip>
@@ -263,6 +264,9 @@ void test_sprintf_float( T value, boost::charconv::chars_format fmt = boost::cha
             sprintf_fmt = fmt_from_type_hex(value);
             error_format = "Hex";
             break;
+        default:
+            BOOST_UNREACHABLE_RETURN(fmt);
+            break;
     }
 
     print( value, buffer2, sizeof(buffer2), sprintf_fmt );
@@ -330,6 +334,74 @@ void test_roundtrip_bv()
     test_roundtrip( static_cast<T>(-FLT128_MAX) );
 }
 
+__float128 float128_from_bits(boost::uint128_type bits)
+{
+    __float128 value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+void test_shortest_spot(boost::uint128_type bits, const char* expected)
+{
+    char buffer[256];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), float128_from_bits(bits), boost::charconv::chars_format::scientific);
+
+    if (BOOST_TEST(r.ec == std::errc()))
+    {
+        *r.ptr = '\0';
+        BOOST_TEST_CSTR_EQ(buffer, expected);
+    }
+}
+
+// The shortest representations from Dragonbox against those of the generic Ryu algorithm
+void test_shortest_binary128()
+{
+    using boost::charconv::detail::ryu::float128_to_fd128;
+    using boost::charconv::detail::ryu::generic_binary_to_decimal;
+
+    // Every power of two, of which the interval is shorter below than above
+    for (boost::uint128_type exponent = 1; exponent < 0x7FFF; ++exponent)
+    {
+        const boost::uint128_type bits = exponent << 112;
+        const auto fd = float128_to_fd128(float128_from_bits(bits));
+        const auto expected = generic_binary_to_decimal(bits, 112, 15, false);
+
+        // BOOST_TEST_EQ would look up the operator<< for uint128_type from within namespace boost, where it is hidden
+        if (!BOOST_TEST(fd.mantissa == expected.mantissa))
+        {
+            std::cerr << "Mantissa: " << fd.mantissa << "\nExpected: " << expected.mantissa << std::endl; // LCOV_EXCL_LINE
+        }
+        BOOST_TEST_EQ(fd.exponent, expected.exponent);
+    }
+
+    // Random significands and exponents, including subnormals. The generic algorithm rounds a few integers
+    // to the farther of two candidates of the same length, so only the number of digits is compared
+    std::mt19937_64 gen(42);
+    for (int i = 0; i < N * 64; ++i)
+    {
+        const boost::uint128_type bits = (static_cast<boost::uint128_type>(gen() % 0x7FFF) << 112) |
+                                         (((static_cast<boost::uint128_type>(gen()) << 64) | gen()) >> (16 + gen() % 112));
+        const auto value = float128_from_bits(bits);
+        test_roundtrip(value);
+
+        const auto fd = float128_to_fd128(value);
+        const auto expected = generic_binary_to_decimal(bits, 112, 15, false);
+        BOOST_TEST_LE(boost::charconv::detail::num_digits(fd.mantissa), boost::charconv::detail::num_digits(expected.mantissa));
+    }
+
+    // 2^402, of which the lower endpoint of the shorter interval is 4.4e-6 above an integer of the last digit
+    test_shortest_spot(static_cast<boost::uint128_type>(0x4191) << 112, "1.0328999512347634358623676688012047e+121");
+
+    // An integer that the generic algorithm gives as ...554e+03, which is farther than ...555e+03
+    test_shortest_spot((static_cast<boost::uint128_type>(UINT64_C(0x407B7210E9A668E7)) << 64) | UINT64_C(0x4181352291E9119A),
+                       "3.0743885885995879415411558879279555e+37");
+
+    // Smallest subnormal and normal, and the largest finite value
+    test_shortest_spot(1, "6e-4966");
+    test_shortest_spot(static_cast<boost::uint128_type>(1) << 112, "3.3621031431120935062626778173217526e-4932");
+    test_shortest_spot((static_cast<boost::uint128_type>(0x7FFF) << 112) - 1, "1.189731495357231765085759326628007e+4932");
+}
+
 #ifdef BOOST_CHARCONV_HAS_STDFLOAT128
 template <typename T>
 void test_spot(T val, boost::charconv::chars_format fmt = boost::charconv::chars_format::general, int precision = -1)
@@ -631,6 +703,7 @@ int main()
     #endif
 
     test_signaling_nan<__float128>();
+    test_shortest_binary128();
 
     // __float128
     {
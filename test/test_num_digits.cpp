@@ -81,6 +81,56 @@ void test_emulated128()
     BOOST_TEST_EQ(num_digits(v3), 39);
 }
 
+// 0 has one digit, and each 10^k - 1 and 10^k are either side of a change in the count
+template <typename T>
+void test_boundaries()
+{
+    using boost::charconv::detail::num_digits;
+
+    BOOST_TEST_EQ(num_digits(static_cast<T>(0)), 1);
+
+    T val = 10;
+    for (int i = 2; i <= std::numeric_limits<T>::digits10; ++i)
+    {
+        BOOST_TEST_EQ(num_digits(static_cast<T>(val - 1)), i - 1);
+        BOOST_TEST_EQ(num_digits(val), i);
+
+        val = static_cast<T>(val * 10);
+    }
+
+    BOOST_TEST_EQ(num_digits((std::numeric_limits<T>::max)()), std::numeric_limits<T>::digits10 + 1);
+}
+
+void test_emulated128_boundaries()
+{
+    using namespace boost::charconv::detail;
+
+    BOOST_TEST_EQ(num_digits(uint128 {0, 0}), 1);
+
+    uint128 val {0, 10};
+    for (int i = 2; i <= 39; ++i)
+    {
+        uint128 below = val;
+        below -= 1;
+
+        BOOST_TEST_EQ(num_digits(below), i - 1);
+        BOOST_TEST_EQ(num_digits(val), i);
+
+        val *= 10;
+    }
+}
+
+void test_signed()
+{
+    using boost::charconv::detail::num_digits;
+
+    BOOST_TEST_EQ(num_digits(-1), 1);
+    BOOST_TEST_EQ(num_digits(-10), 2);
+    BOOST_TEST_EQ(num_digits(static_cast<signed char>(-128)), 3);
+    BOOST_TEST_EQ(num_digits((std::numeric_limits<int>::min)()), 10);
+    BOOST_TEST_EQ(num_digits((std::numeric_limits<long long>::min)()), 19);
+}
+
 int main()
 {
     test<char>();
@@ -104,5 +154,15 @@ int main()
 
     test_emulated128();
 
+    test_boundaries<unsigned char>();
+    test_boundaries<unsigned short>();
+    test_boundaries<std::uint32_t>();
+    test_boundaries<std::uint64_t>();
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    BOOST_TEST_EQ(boost::charconv::detail::num_digits(static_cast<boost::uint128_type>(0)), 1);
+    #endif
+    test_emulated128_boundaries();
+    test_signed();
+
     return boost::report_errors();
 }
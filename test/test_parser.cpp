@@ -10,6 +10,7 @@
 #include <cstdint>
 #include <cstring>
 #include <cerrno>
+#include <string>
 
 template <typename T>
 void test_integer()
@@ -167,8 +168,48 @@ void test_hex_scientific()
     BOOST_TEST_EQ(significand, UINT64_C(80427));
 }
 
+// The run scanner must agree with a character at a time scan for every length and terminator position
+void test_digit_run_scan()
+{
+    const char terminators[] = {'.', 'e', 'p', 'g', 'G', '/', ':', '@', '`', '\0', ' ', '\x80', '\xB0', '\xFF'};
+    const std::string digits = "0123456789abcdefABCDEF0123456789abcdefABCDEF";
+
+    for (std::size_t len = 0; len <= 40; ++len)
+    {
+        for (char terminator : terminators)
+        {
+            std::string decimal(len, '7');
+            decimal.push_back(terminator);
+            decimal.append(20, '1');
+
+            std::string hex = digits.substr(0, len);
+            hex.push_back(terminator);
+            hex.append(20, 'A');
+
+            const bool hex_terminator = (terminator >= 'a' && terminator <= 'f') || (terminator >= 'A' && terminator <= 'F');
+
+            auto end = boost::charconv::detail::find_digit_run_end(decimal.data(), decimal.data() + decimal.size(), false);
+            BOOST_TEST(end == decimal.data() + len);
+
+            if (!hex_terminator)
+            {
+                end = boost::charconv::detail::find_digit_run_end(hex.data(), hex.data() + hex.size(), true);
+                BOOST_TEST(end == hex.data() + len);
+            }
+
+            // Run that reaches last
+            end = boost::charconv::detail::find_digit_run_end(decimal.data(), decimal.data() + len, false);
+            BOOST_TEST(end == decimal.data() + len);
+            end = boost::charconv::detail::find_digit_run_end(hex.data(), hex.data() + len, true);
+            BOOST_TEST(end == hex.data() + len);
+        }
+    }
+}
+
 int main()
 {
+    test_digit_run_scan();
+
     test_integer<float>();
     test_integer<double>();
     test_integer<long double>();
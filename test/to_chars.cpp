@@ -83,6 +83,81 @@ void test_128bit_int()
         BOOST_TEST(v10 == v11);
     }
 }
+
+std::string reference_string(boost::uint128_type value)
+{
+    std::string str;
+    do
+    {
+        str.insert(str.begin(), static_cast<char>('0' + static_cast<int>(value % 10)));
+        value /= 10;
+    } while (value != 0);
+
+    return str;
+}
+
+// Values at the boundaries of the base 10^19 limbs and of the 64-bit fast path
+void test_128bit_limbs()
+{
+    const auto ten_19 = static_cast<boost::uint128_type>(UINT64_C(10000000000000000000));
+    const boost::uint128_type max_value = ~static_cast<boost::uint128_type>(0);
+
+    boost::uint128_type values[] = {
+        static_cast<boost::uint128_type>(UINT64_MAX), static_cast<boost::uint128_type>(UINT64_MAX) + 1,
+        ten_19 * ten_19 - 1, ten_19 * ten_19, ten_19 * ten_19 + 1, ten_19 * ten_19 * 3,
+        ten_19 * (static_cast<boost::uint128_type>(1) << 64), max_value, max_value / 2, max_value / 10
+    };
+
+    char buffer[64];
+    for (const auto value : values)
+    {
+        for (const auto v : {value - 1, value, value + 1})
+        {
+            if (v < static_cast<boost::uint128_type>(UINT64_MAX) - 1)
+            {
+                continue;
+            }
+
+            auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), v);
+            BOOST_TEST(r.ec == std::errc());
+            BOOST_TEST_EQ(std::string(buffer, r.ptr), reference_string(v));
+
+            if (v <= max_value / 2)
+            {
+                r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), -static_cast<boost::int128_type>(v));
+                BOOST_TEST(r.ec == std::errc());
+                BOOST_TEST_EQ(std::string(buffer, r.ptr), '-' + reference_string(v));
+            }
+
+            // Exactly enough room and one character too few
+            const auto length = static_cast<std::ptrdiff_t>(reference_string(v).size());
+            r = boost::charconv::to_chars(buffer, buffer + length, v);
+            BOOST_TEST(r.ec == std::errc());
+            BOOST_TEST(r.ptr == buffer + length);
+            r = boost::charconv::to_chars(buffer, buffer + length - 1, v);
+            BOOST_TEST(r.ec == std::errc::result_out_of_range);
+        }
+    }
+
+    // Every power of ten and the values next to it
+    boost::uint128_type power = 1;
+    for (int i = 0; i < 39; ++i, power *= 10)
+    {
+        for (const auto v : {power - 1, power, power + 1})
+        {
+            const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), v);
+            BOOST_TEST_EQ(std::string(buffer, r.ptr), reference_string(v));
+        }
+    }
+
+    // Negative values that fit into 64 bits
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), static_cast<boost::int128_type>(-5));
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "-5");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), -static_cast<boost::int128_type>(UINT64_MAX));
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "-18446744073709551615");
+    r = boost::charconv::to_chars(buffer, buffer + 1, static_cast<boost::int128_type>(-5));
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+}
 #endif
 
 template <typename T>
@@ -225,6 +300,88 @@ void sixty_four_bit_tests<std::uint64_t>()
     BOOST_TEST_CSTR_EQ(buffer3, "10000000000000000000");
 }
 
+// Every digit count around the split points of the 64-bit conversion
+template <typename T>
+void digit_boundary_tests()
+{
+    std::uint64_t power = 1;
+    for (int i = 0; i < 19; ++i)
+    {
+        power *= 10;
+        const std::uint64_t values[] = {power - 1, power, power + 1, power / 2 * 3, power - power / 10};
+        for (const auto value : values)
+        {
+            if (value <= static_cast<std::uint64_t>((std::numeric_limits<T>::max)()))
+            {
+                specific_value_tests(static_cast<T>(value));
+                BOOST_IF_CONSTEXPR (std::is_signed<T>::value)
+                {
+                    specific_value_tests(static_cast<T>(-static_cast<T>(value)));
+                }
+            }
+        }
+    }
+
+    specific_value_tests(static_cast<T>(UINT64_C(1000000000000000001)));
+    specific_value_tests(static_cast<T>(UINT64_C(1234567800000000)));
+    specific_value_tests(static_cast<T>(UINT64_C(12345678000000009)));
+    specific_value_tests((std::numeric_limits<T>::max)());
+    specific_value_tests((std::numeric_limits<T>::min)());
+}
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR) && !defined(BOOST_CHARCONV_NO_CONSTEXPR_DETECTION)
+
+struct constexpr_digits
+{
+    char buffer[21];
+    std::ptrdiff_t length;
+};
+
+constexpr constexpr_digits constexpr_to_chars(std::uint64_t value)
+{
+    constexpr_digits result {};
+    const auto r = boost::charconv::to_chars(result.buffer, result.buffer + sizeof(result.buffer), value);
+    result.length = r.ptr - result.buffer;
+    return result;
+}
+
+void constexpr_test()
+{
+    constexpr auto result = constexpr_to_chars(UINT64_C(18446744073709551615));
+    static_assert(result.length == 20, "20 digits");
+    static_assert(result.buffer[0] == '1' && result.buffer[19] == '5', "Digits of UINT64_MAX");
+    BOOST_TEST_EQ(std::string(result.buffer, static_cast<std::size_t>(result.length)), "18446744073709551615");
+
+    constexpr auto short_result = constexpr_to_chars(UINT64_C(1234567890123));
+    static_assert(short_result.length == 13, "13 digits");
+    BOOST_TEST_EQ(std::string(short_result.buffer, static_cast<std::size_t>(short_result.length)), "1234567890123");
+}
+
+#endif
+
+// Every value of the small integer table, with exactly enough room and one character too little,
+// and nothing after the digits is written
+template <typename T>
+void small_integer_tests()
+{
+    for (int i = std::is_signed<T>::value ? -10000 : 0; i <= 10000; ++i)
+    {
+        const auto v = static_cast<T>(i);
+        const std::string expected = std::to_string(i);
+        char buffer[16];
+        std::memset(buffer, 'x', sizeof(buffer));
+        const auto size = static_cast<std::ptrdiff_t>(expected.size());
+        auto r = boost::charconv::to_chars(buffer, buffer + size, v);
+        BOOST_TEST(r.ec == std::errc());
+        BOOST_TEST_EQ(std::string(buffer, r.ptr), expected);
+        BOOST_TEST_EQ(std::string(buffer + size, buffer + sizeof(buffer)), std::string(sizeof(buffer) - expected.size(), 'x'));
+
+        r = boost::charconv::to_chars(buffer, buffer + size - 1, v);
+        BOOST_TEST(r.ec == std::errc::result_out_of_range);
+        BOOST_TEST(r.ptr == buffer + size - 1);
+    }
+}
+
 template <typename T>
 void negative_vals_test()
 {
@@ -283,9 +440,21 @@ int main()
     negative_vals_test<int>();
     negative_vals_test<long>();
 
+    small_integer_tests<short>();
+    small_integer_tests<unsigned short>();
+    small_integer_tests<int>();
+    small_integer_tests<std::uint64_t>();
+
     sixty_four_bit_tests<long long>();
     sixty_four_bit_tests<std::uint64_t>();
 
+    digit_boundary_tests<long long>();
+    digit_boundary_tests<std::uint64_t>();
+
+    #if !defined(BOOST_NO_CXX14_CONSTEXPR) && !defined(BOOST_CHARCONV_NO_CONSTEXPR_DETECTION)
+    constexpr_test();
+    #endif
+
     // Tests for every specialized base
     base_two_tests<int>();
     base_two_tests<unsigned>();
@@ -329,6 +498,7 @@ int main()
     #ifdef BOOST_CHARCONV_HAS_INT128
     test_128bit_int<boost::int128_type>();
     test_128bit_int<boost::uint128_type>();
+    test_128bit_limbs();
     #endif
 
     return boost::report_errors();
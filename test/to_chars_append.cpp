@@ -0,0 +1,176 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/to_chars_append.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+
+static std::mt19937_64 rng(42);
+
+// A fixed block of memory handed out from the front, like an arena
+class arena_buffer
+{
+public:
+    char* end() noexcept { return end_; }
+    std::size_t size() const noexcept { return static_cast<std::size_t>(end_ - data_); }
+    std::string str() const { return std::string(data_, size()); }
+
+    std::size_t prepared {};
+
+private:
+    friend struct boost::charconv::sink_traits<arena_buffer>;
+
+    char data_[4096] {};
+    char* end_ {data_};
+};
+
+namespace boost { namespace charconv {
+
+template <>
+struct sink_traits<arena_buffer>
+{
+    static char* prepare(arena_buffer& sink, std::size_t n)
+    {
+        BOOST_TEST(sink.end_ + n <= sink.data_ + sizeof(sink.data_));
+        sink.prepared += n;
+        return sink.end_;
+    }
+
+    static void commit(arena_buffer& sink, char* end)
+    {
+        sink.end_ = end;
+    }
+};
+
+}} // Namespaces
+
+template <typename T, typename... Args>
+std::string expected_output(T value, Args... args)
+{
+    char buffer[2048];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, args...);
+    BOOST_TEST(r);
+    return std::string(buffer, r.ptr);
+}
+
+// Appending has to keep what is in the sink and add exactly what to_chars writes
+template <typename T, typename... Args>
+void test_value(T value, Args... args)
+{
+    const std::string expected = expected_output(value, args...);
+
+    std::string str = "x";
+    auto r = boost::charconv::to_chars_append(str, value, args...);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(str, "x" + expected);
+    BOOST_TEST(r.ptr == &str[0] + str.size());
+
+    std::vector<char> vec {'y'};
+    r = boost::charconv::to_chars_append(vec, value, args...);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(std::string(vec.begin(), vec.end()), "y" + expected);
+
+    arena_buffer arena;
+    r = boost::charconv::to_chars_append(arena, value, args...);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(arena.str(), expected);
+    BOOST_TEST(r.ptr == arena.end());
+}
+
+template <typename T>
+void test_integer()
+{
+    std::uniform_int_distribution<T> dist((std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+    for (int i = 0; i < 1000; ++i)
+    {
+        const T value = dist(rng);
+        test_value(value);
+        test_value(value, 2);
+        test_value(value, 36);
+    }
+
+    test_value((std::numeric_limits<T>::min)());
+    test_value((std::numeric_limits<T>::max)(), 2);
+
+    // Exactly the written length is made room for
+    arena_buffer arena;
+    boost::charconv::to_chars_append(arena, T(123));
+    BOOST_TEST_EQ(arena.prepared, 3U);
+
+    std::string str = "abc";
+    const auto r = boost::charconv::to_chars_append(str, T(1), 1);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(str, "abc");
+}
+
+template <typename T>
+void test_float()
+{
+    std::uniform_int_distribution<std::uint64_t> bits_dist;
+    for (int i = 0; i < 1000; ++i)
+    {
+        using bits_type = typename std::conditional<sizeof(T) == sizeof(std::uint64_t), std::uint64_t, std::uint32_t>::type;
+        const auto bits = static_cast<bits_type>(bits_dist(rng));
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        test_value(value);
+        for (const auto fmt : {chars_format::general, chars_format::scientific, chars_format::fixed, chars_format::hex})
+        {
+            test_value(value, fmt);
+            test_value(value, fmt, 3);
+        }
+    }
+
+    test_value((std::numeric_limits<T>::max)(), chars_format::fixed);
+    test_value((std::numeric_limits<T>::max)(), chars_format::fixed, 50);
+    test_value(std::numeric_limits<T>::denorm_min(), chars_format::fixed);
+
+    // The shortest representation makes room for max_chars, and fixed or a precision for the exact length
+    arena_buffer arena;
+    boost::charconv::to_chars_append(arena, T(0.5));
+    BOOST_TEST_EQ(arena.prepared, static_cast<std::size_t>(boost::charconv::limits<T>::max_chars));
+    arena.prepared = 0;
+    boost::charconv::to_chars_append(arena, (std::numeric_limits<T>::max)(), chars_format::fixed, 50);
+    BOOST_TEST_EQ(arena.prepared, boost::charconv::to_chars_length((std::numeric_limits<T>::max)(), chars_format::fixed, 50));
+    BOOST_TEST_EQ(arena.str(), "5e-01" + expected_output((std::numeric_limits<T>::max)(), chars_format::fixed, 50));
+}
+
+// A CSV row built value by value
+void test_row()
+{
+    std::string row;
+    boost::charconv::to_chars_append(row, 42);
+    row += ',';
+    boost::charconv::to_chars_append(row, 2.5);
+    row += ',';
+    boost::charconv::to_chars_append(row, 0.1F, chars_format::fixed, 2);
+    row += ',';
+    boost::charconv::to_chars_append(row, 255U, 16);
+    BOOST_TEST_EQ(row, "42,2.5,0.10,ff");
+}
+
+int main()
+{
+    test_integer<int>();
+    test_integer<unsigned>();
+    test_integer<long long>();
+    test_integer<unsigned long long>();
+    test_integer<short>();
+
+    test_float<float>();
+    test_float<double>();
+
+    test_row();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,116 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// The compact caches selected with BOOST_CHARCONV_CACHE_POLICY and BOOST_CHARCONV_EXTENDED_CACHE_POLICY
+// must give exactly the same results as the full tables
+
+#include <boost/charconv.hpp>
+#include <boost/charconv/detail/dragonbox/dragonbox.hpp>
+#include <boost/charconv/detail/dragonbox/floff.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <limits>
+#include <iomanip>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+static std::mt19937_64 rng(42);
+
+using namespace boost::charconv::detail;
+
+// The recovered entries are never below the stored ones, and at most a few units larger in the last place.
+// Both algorithms are correct with such an overestimate, which is checked against the full tables below
+void test_main_cache()
+{
+    for (int k = main_cache_holder::min_k; k <= main_cache_holder::max_k; ++k)
+    {
+        const auto full = policy_impl::cache::full::get_cache<ieee754_binary64>(k);
+        const auto compact = policy_impl::cache::compact::get_cache<ieee754_binary64>(k);
+        BOOST_TEST_EQ(full.high, compact.high);
+        BOOST_TEST(compact.low >= full.low && compact.low - full.low <= 2U);
+
+        const auto floff_full = main_cache_full::get_cache<ieee754_binary64>(k);
+        const auto floff_compressed = main_cache_compressed::get_cache<ieee754_binary64>(k);
+        BOOST_TEST_EQ(floff_full.high, floff_compressed.high);
+        BOOST_TEST(floff_compressed.low >= floff_full.low && floff_compressed.low - floff_full.low <= 2U);
+    }
+
+    for (int k = cache_holder_ieee754_binary32::min_k; k <= cache_holder_ieee754_binary32::max_k; ++k)
+    {
+        BOOST_TEST_EQ(policy_impl::cache::full::get_cache<ieee754_binary32>(k), policy_impl::cache::compact::get_cache<ieee754_binary32>(k));
+    }
+}
+
+template <typename MainCache, typename ExtendedCache>
+void test_floff(double value, int precision)
+{
+    char expected[64];
+    char buffer[64];
+    const auto r1 = floff<main_cache_full, extended_cache_long>(value, precision, expected, expected + sizeof(expected));
+    const auto r2 = floff<MainCache, ExtendedCache>(value, precision, buffer, buffer + sizeof(buffer));
+    if (!BOOST_TEST(r2) || !BOOST_TEST_EQ(std::string(expected, r1.ptr), std::string(buffer, r2.ptr)))
+    {
+        // LCOV_EXCL_START
+        std::cerr << std::setprecision(std::numeric_limits<double>::max_digits10) << "Value: " << value
+                  << "\nPrecision: " << precision << std::endl;
+        // LCOV_EXCL_STOP
+    }
+}
+
+void test_floff_random()
+{
+    std::uniform_int_distribution<std::uint64_t> bits_dist(UINT64_C(0x0010000000000000), UINT64_C(0x7FEFFFFFFFFFFFFF));
+    std::uniform_int_distribution<int> precision_dist(0, 20);
+    for (int i = 0; i < 100000; ++i)
+    {
+        const std::uint64_t bits = bits_dist(rng);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        const int precision = precision_dist(rng);
+
+        test_floff<main_cache_compressed, extended_cache_long>(value, precision);
+        test_floff<main_cache_full, extended_cache_super_compact>(value, precision);
+        test_floff<main_cache_compressed, extended_cache_super_compact>(value, precision);
+    }
+
+    // Ties and values next to them in the last printed digit
+    test_floff<main_cache_compressed, extended_cache_super_compact>(0.125, 1);
+    test_floff<main_cache_compressed, extended_cache_super_compact>(2.5, 0);
+    test_floff<main_cache_compressed, extended_cache_super_compact>(1e23, 17);
+    test_floff<main_cache_compressed, extended_cache_super_compact>(5e-324 * 4503599627370496.0, 10);
+}
+
+#ifndef BOOST_CHARCONV_NO_CXX14_RETURN_TYPE_DEDUCTION
+void test_shortest_random()
+{
+    std::uniform_int_distribution<std::uint64_t> bits_dist(0, UINT64_C(0x7FEFFFFFFFFFFFFF));
+    for (int i = 0; i < 100000; ++i)
+    {
+        const std::uint64_t bits = bits_dist(rng);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        char expected[64];
+        char buffer[64];
+        const auto r1 = to_chars_n(value, expected, expected + sizeof(expected), boost::charconv::chars_format::general, policy::cache::full);
+        const auto r2 = to_chars_n(value, buffer, buffer + sizeof(buffer), boost::charconv::chars_format::general, policy::cache::compact);
+        BOOST_TEST_EQ(std::string(expected, r1.ptr), std::string(buffer, r2.ptr));
+    }
+}
+#endif
+
+int main()
+{
+    test_main_cache();
+    test_floff_random();
+
+    #ifndef BOOST_CHARCONV_NO_CXX14_RETURN_TYPE_DEDUCTION
+    test_shortest_random();
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,133 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <string>
+#include <limits>
+#include <iostream>
+#include <cstring>
+#include <cstdio>
+#include <cstdint>
+
+static std::mt19937_64 rng(42);
+
+// The field is what printf writes with the zero flag or the default space padding, and nothing if the value does not fit
+template <typename T>
+void test_value(T value, int width, char fill)
+{
+    char expected[128];
+    const bool is_signed = std::numeric_limits<T>::is_signed;
+    if (fill == '0')
+    {
+        is_signed ? std::snprintf(expected, sizeof(expected), "%0*lld", width, static_cast<long long>(value)) :
+                    std::snprintf(expected, sizeof(expected), "%0*llu", width, static_cast<unsigned long long>(value));
+    }
+    else
+    {
+        is_signed ? std::snprintf(expected, sizeof(expected), "%*lld", width, static_cast<long long>(value)) :
+                    std::snprintf(expected, sizeof(expected), "%*llu", width, static_cast<unsigned long long>(value));
+        for (char* c = expected; *c == ' '; ++c)
+        {
+            *c = fill;
+        }
+    }
+    const std::string expected_str(expected);
+
+    char buffer[128];
+    const auto r = boost::charconv::to_chars_fixed_width(buffer, buffer + sizeof(buffer), value, width, fill);
+    if (expected_str.size() == static_cast<std::size_t>(width))
+    {
+        if (!BOOST_TEST(r) || !BOOST_TEST_EQ(std::string(buffer, r.ptr), expected_str))
+        {
+            std::cerr << "Value: " << expected << "\nWidth: " << width << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+    else
+    {
+        // Wider than the field
+        if (!BOOST_TEST(r.ec == std::errc::result_out_of_range) || !BOOST_TEST(r.ptr == buffer + sizeof(buffer)))
+        {
+            std::cerr << "Value: " << expected << "\nWidth: " << width << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+
+    // The buffer has to hold the whole field
+    if (width > 0)
+    {
+        const auto small_r = boost::charconv::to_chars_fixed_width(buffer, buffer + width - 1, value, width, fill);
+        BOOST_TEST(small_r.ec == std::errc::result_out_of_range);
+        BOOST_TEST(small_r.ptr == buffer + width - 1);
+    }
+}
+
+template <typename T>
+void test_type()
+{
+    std::uniform_int_distribution<T> dist((std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+    for (int i = 0; i < 10000; ++i)
+    {
+        const T value = static_cast<T>(dist(rng) >> (i % (static_cast<int>(sizeof(T)) * 8)));
+        for (const int width : {0, 1, 2, 5, 9, 10, 19, 20, 21, 30})
+        {
+            test_value(value, width, '0');
+            test_value(value, width, ' ');
+            test_value(value, width, '*');
+        }
+    }
+
+    for (const T value : {T(0), T(1), T(9), T(10), T(99), T(100), (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)()})
+    {
+        for (int width = 0; width < 25; ++width)
+        {
+            test_value(value, width, '0');
+            test_value(value, width, ' ');
+        }
+    }
+}
+
+int main()
+{
+    test_type<short>();
+    test_type<unsigned short>();
+    test_type<int>();
+    test_type<unsigned>();
+    test_type<long long>();
+    test_type<unsigned long long>();
+
+    // Fields of a timestamp
+    char buffer[64];
+    char* next = buffer;
+    next = boost::charconv::to_chars_fixed_width<4>(next, buffer + sizeof(buffer), 2024).ptr;
+    *next++ = '-';
+    next = boost::charconv::to_chars_fixed_width<2>(next, buffer + sizeof(buffer), 3).ptr;
+    *next++ = '-';
+    next = boost::charconv::to_chars_fixed_width<2>(next, buffer + sizeof(buffer), 7).ptr;
+    *next++ = 'T';
+    next = boost::charconv::to_chars_fixed_width<2>(next, buffer + sizeof(buffer), 0).ptr;
+    *next++ = '.';
+    next = boost::charconv::to_chars_fixed_width<9>(next, buffer + sizeof(buffer), 12345U).ptr;
+    BOOST_TEST_EQ(std::string(buffer, next), "2024-03-07T00.000012345");
+
+    auto r = boost::charconv::to_chars_fixed_width<3>(buffer, buffer + sizeof(buffer), -5, ' ');
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), " -5");
+    r = boost::charconv::to_chars_fixed_width<1>(buffer, buffer + sizeof(buffer), -5);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    r = boost::charconv::to_chars_fixed_width(buffer, buffer + sizeof(buffer), 5, -1);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    const auto max128 = (std::numeric_limits<boost::uint128_type>::max)();
+    r = boost::charconv::to_chars_fixed_width(buffer, buffer + sizeof(buffer), max128, 41);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "00340282366920938463463374607431768211455");
+    r = boost::charconv::to_chars_fixed_width(buffer, buffer + sizeof(buffer), max128, 38);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    r = boost::charconv::to_chars_fixed_width(buffer, buffer + sizeof(buffer), -static_cast<boost::int128_type>(max128 / 2) - 1, 42, ' ');
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "  -170141183460469231731687303715884105728");
+    #endif
+
+    return boost::report_errors();
+}
@@ -16,6 +16,8 @@
 #include <string>
 #include <random>
 #include <iomanip>
+#include <iostream>
+#include <cmath>
 
 // These numbers diverge from what the formatting is using printf
 // See: https://godbolt.org/z/zd34KcWMW
@@ -105,6 +107,108 @@ void fixed_values()
     BOOST_TEST_CSTR_EQ(buffer1, "61851632");
 }
 
+// Shortest fixed output of large and small values: the shortest digits and the zeros up to or after the decimal point.
+// A buffer that is too small is left untouched
+template <typename T>
+void fixed_extreme_value(T value, const std::string& expected)
+{
+    char buffer[512];
+    std::memset(buffer, 'x', sizeof(buffer));
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, boost::charconv::chars_format::fixed);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), expected);
+    BOOST_TEST_EQ(boost::charconv::to_chars_length(value, boost::charconv::chars_format::fixed), expected.size());
+
+    T parsed {};
+    const auto pr = boost::charconv::from_chars(buffer, r.ptr, parsed, boost::charconv::chars_format::fixed);
+    BOOST_TEST(pr.ec == std::errc() && pr.ptr == r.ptr);
+    BOOST_TEST_EQ(parsed, value);
+
+    std::memset(buffer, 'x', sizeof(buffer));
+    char* const short_last = buffer + expected.size() - 1;
+    r = boost::charconv::to_chars(buffer, short_last, value, boost::charconv::chars_format::fixed);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(r.ptr == short_last);
+    BOOST_TEST_EQ(std::string(buffer, short_last), std::string(expected.size() - 1, 'x'));
+}
+
+template <typename T>
+void fixed_extreme_values()
+{
+    fixed_extreme_value(T(1e-30), "0." + std::string(29, '0') + "1");
+    fixed_extreme_value(T(-1.5e-10), "-0.00000000015");
+    fixed_extreme_value(T(0.25), "0.25");
+    fixed_extreme_value(T(1e20), "1" + std::string(20, '0'));
+    fixed_extreme_value(T(-3e30), "-3" + std::string(30, '0'));
+
+    BOOST_IF_CONSTEXPR (std::is_same<T, double>::value)
+    {
+        fixed_extreme_value(T(1e300), "1" + std::string(300, '0'));
+        fixed_extreme_value(T(-1e-300), "-0." + std::string(299, '0') + "1");
+        fixed_extreme_value(std::numeric_limits<T>::denorm_min(), "0." + std::string(323, '0') + "5");
+        fixed_extreme_value((std::numeric_limits<T>::max)(), "17976931348623157" + std::string(292, '0'));
+    }
+    else
+    {
+        fixed_extreme_value(std::numeric_limits<T>::denorm_min(), "0." + std::string(44, '0') + "1");
+        fixed_extreme_value((std::numeric_limits<T>::max)(), "34028235" + std::string(31, '0'));
+    }
+}
+
+// The output fits a buffer of exactly its length, one character less is std::errc::result_out_of_range,
+// and nothing is written past last either way
+template <typename T>
+void exact_buffer_size(T value, boost::charconv::chars_format fmt, const std::string& expected = "")
+{
+    char full[1024];
+    const auto r = boost::charconv::to_chars(full, full + sizeof(full), value, fmt);
+    BOOST_TEST(r.ec == std::errc());
+    const auto length = r.ptr - full;
+    if (!expected.empty())
+    {
+        BOOST_TEST_EQ(std::string(full, r.ptr), expected);
+    }
+
+    for (const std::ptrdiff_t size : {length, length - 1})
+    {
+        char buffer[sizeof(full) + 8];
+        std::memset(buffer, 'x', sizeof(buffer));
+        const auto sr = boost::charconv::to_chars(buffer, buffer + size, value, fmt);
+        if (size == length)
+        {
+            BOOST_TEST(sr.ec == std::errc());
+            BOOST_TEST_EQ(std::string(buffer, sr.ptr), std::string(full, r.ptr));
+        }
+        else
+        {
+            BOOST_TEST(sr.ec == std::errc::result_out_of_range);
+            BOOST_TEST(sr.ptr == buffer + size);
+        }
+
+        if (!BOOST_TEST_EQ(std::string(buffer + size, buffer + sizeof(buffer)), std::string(sizeof(buffer) - static_cast<std::size_t>(size), 'x')))
+        {
+            std::cerr << std::setprecision(std::numeric_limits<T>::max_digits10) << "Value: " << value // LCOV_EXCL_LINE
+                      << "\nFormat: " << static_cast<int>(fmt) << "\nBuffer size: " << size << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+}
+
+template <typename T>
+void exact_buffer_sizes(boost::charconv::chars_format fmt)
+{
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<int> exponent_dist(std::numeric_limits<T>::min_exponent10, std::numeric_limits<T>::max_exponent10);
+    std::uniform_real_distribution<T> significand_dist(1, 10);
+    for (int i = 0; i < 10000; ++i)
+    {
+        const T value = significand_dist(rng) * static_cast<T>(std::pow(10.0L, exponent_dist(rng) - 1));
+        if (std::isfinite(value) && value != 0)
+        {
+            exact_buffer_size(i % 2 == 0 ? value : -value, fmt);
+        }
+    }
+}
+
 template <typename T>
 void failing_ci_values()
 {
@@ -208,9 +312,31 @@ int main()
 
     fixed_values<float>();
     fixed_values<double>();
+    fixed_extreme_values<float>();
+    fixed_extreme_values<double>();
 
     failing_ci_values<double>();
 
+    // An exponent of 0 is two digits, and the digit printers write past the digits before the exponent is known
+    exact_buffer_size(6288683.0F, boost::charconv::chars_format::scientific, "6.288683e+06");
+    exact_buffer_size(6288683.0, boost::charconv::chars_format::scientific, "6.288683e+06");
+    exact_buffer_size(-2.1847062606175414e+17, boost::charconv::chars_format::scientific, "-2.1847062606175414e+17");
+    exact_buffer_size(1e-300, boost::charconv::chars_format::scientific, "1e-300");
+    exact_buffer_size(-1.5e-30F, boost::charconv::chars_format::general, "-1.5e-30");
+    exact_buffer_size(3.0F, boost::charconv::chars_format::scientific, "3e+00");
+    exact_buffer_sizes<float>(boost::charconv::chars_format::scientific);
+    exact_buffer_sizes<double>(boost::charconv::chars_format::scientific);
+
+    // Shortest fixed output is exactly the sign, the integer digits, '.' and the fraction digits
+    exact_buffer_size(193489.07470703125, boost::charconv::chars_format::fixed, "193489.07470703125");
+    exact_buffer_size(13.651813F, boost::charconv::chars_format::general, "13.651813");
+    exact_buffer_size(-1e15, boost::charconv::chars_format::fixed, "-1000000000000000");
+    exact_buffer_size(0.015625F, boost::charconv::chars_format::fixed, "0.015625");
+    exact_buffer_sizes<float>(boost::charconv::chars_format::fixed);
+    exact_buffer_sizes<double>(boost::charconv::chars_format::fixed);
+    exact_buffer_sizes<float>(boost::charconv::chars_format::general);
+    exact_buffer_sizes<double>(boost::charconv::chars_format::general);
+
     // Values from ryu tests
     spot_check(1.0, "1");
     spot_check(1.2, "1.2");
@@ -1006,5 +1132,10 @@ int main()
     spot_check(1.7e-01, "1.7e-01", boost::charconv::chars_format::scientific);
     spot_check(1.7e-00, "1.7e+00", boost::charconv::chars_format::scientific);
 
+    // An exponent of 0 still has its two digits
+    spot_check(1.5L, "1.5e+00", boost::charconv::chars_format::scientific);
+    spot_check(1.5e+01L, "1.5e+01", boost::charconv::chars_format::scientific);
+    spot_check(1.5e-01L, "1.5e-01", boost::charconv::chars_format::scientific);
+
     return boost::report_errors();
 }
@@ -22,6 +22,7 @@
 #include <cstring>
 #include <cstdint>
 #include <cerrno>
+#include <cmath>
 
 template <typename T>
 void test_spot(T val, boost::charconv::chars_format fmt = boost::charconv::chars_format::general, int precision = -1)
@@ -172,6 +173,17 @@ void fixed_test()
     {
         test_spot(dist(gen), boost::charconv::chars_format::fixed);
     }    
+
+    // Values below 1, down to where the leading zeros and the digits still fit into the buffers of test_spot
+    std::uniform_real_distribution<T> fraction_dist(T(0.5), T(1));
+    std::uniform_int_distribution<int> exponent_dist(std::is_same<T, double>::value ? -700 : -125, 0);
+
+    for (std::size_t i = 0; i < 10'000; ++i)
+    {
+        const T value = std::ldexp(fraction_dist(gen), exponent_dist(gen));
+        test_spot(value, boost::charconv::chars_format::fixed);
+        test_spot(-value, boost::charconv::chars_format::fixed);
+    }
 }
 
 // Clang 16 (most recent at time of writing) only has integral from_chars implemented
@@ -0,0 +1,252 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/charconv/detail/bit_layouts.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <limits>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+#  include <quadmath.h>
+#endif
+
+static std::mt19937_64 rng(42);
+
+// Random bit patterns cover every exponent along with the subnormals
+template <typename T>
+T random_value()
+{
+    using bits_type = typename std::conditional<sizeof(T) == sizeof(std::uint64_t), std::uint64_t, std::uint32_t>::type;
+    T val;
+    do
+    {
+        const auto bits = static_cast<bits_type>(rng());
+        std::memcpy(&val, &bits, sizeof(val));
+    } while (!std::isfinite(val));
+
+    return val;
+}
+
+const char* printf_format(boost::charconv::chars_format fmt)
+{
+    switch (fmt)
+    {
+        case boost::charconv::chars_format::fixed:
+            return "%.*f";
+        case boost::charconv::chars_format::scientific:
+            return "%.*e";
+        default:
+            return "%.*g";
+    }
+}
+
+template <typename T>
+int printf_value(char* buffer, std::size_t size, boost::charconv::chars_format fmt, int precision, T value)
+{
+    return std::snprintf(buffer, size, printf_format(fmt), precision, static_cast<double>(value));
+}
+
+#if BOOST_CHARCONV_LDBL_BITS == 80 || BOOST_CHARCONV_LDBL_BITS == 128
+int printf_value(char* buffer, std::size_t size, boost::charconv::chars_format fmt, int precision, long double value)
+{
+    const char* format = fmt == boost::charconv::chars_format::fixed ? "%.*Lf" :
+                         fmt == boost::charconv::chars_format::scientific ? "%.*Le" : "%.*Lg";
+    return std::snprintf(buffer, size, format, precision, value);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT128
+int printf_value(char* buffer, std::size_t size, boost::charconv::chars_format fmt, int precision, __float128 value)
+{
+    const char* format = fmt == boost::charconv::chars_format::fixed ? "%.*Qf" :
+                         fmt == boost::charconv::chars_format::scientific ? "%.*Qe" : "%.*Qg";
+    return quadmath_snprintf(buffer, size, format, precision, value);
+}
+#endif
+
+// The result must be the same as printf (correctly rounded, ties to even), and must fit into a buffer of exactly its length
+template <typename T>
+void test_value(T value, boost::charconv::chars_format fmt, int precision)
+{
+    static char printf_buffer[20000];
+    const int length = printf_value(printf_buffer, sizeof(printf_buffer), fmt, precision, value);
+    BOOST_TEST(length > 0 && length < static_cast<int>(sizeof(printf_buffer)));
+
+    static char buffer[20000];
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt, precision);
+    if (!BOOST_TEST(r) || !BOOST_TEST_EQ(std::string(buffer, r.ptr), std::string(printf_buffer)))
+    {
+        // LCOV_EXCL_START
+        std::cerr << std::setprecision(std::numeric_limits<double>::max_digits10) << "Value: " << static_cast<double>(value)
+                  << "\nPrecision: " << precision << std::endl;
+        // LCOV_EXCL_STOP
+    }
+
+    r = boost::charconv::to_chars(buffer, buffer + length, value, fmt, precision);
+    BOOST_TEST(r);
+    BOOST_TEST(r.ptr == buffer + length);
+
+    r = boost::charconv::to_chars(buffer, buffer + length - 1, value, fmt, precision);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+}
+
+template <typename T>
+void test_random(int max_precision, int iterations)
+{
+    std::uniform_int_distribution<int> precision_dist(0, max_precision);
+    for (int i = 0; i < iterations; ++i)
+    {
+        const T value = random_value<T>();
+        const int precision = precision_dist(rng);
+        test_value(value, boost::charconv::chars_format::fixed, precision);
+        test_value(value, boost::charconv::chars_format::scientific, precision);
+        test_value(value, boost::charconv::chars_format::general, precision);
+    }
+}
+
+// Values near 1 in magnitude are where the fixed and general notations differ the most from scientific
+void test_moderate_values()
+{
+    std::uniform_real_distribution<double> exponent_dist(-30, 40);
+    std::uniform_int_distribution<int> precision_dist(0, 20);
+    for (int i = 0; i < 100000; ++i)
+    {
+        const double value = std::pow(10.0, exponent_dist(rng)) * ((rng() & 1U) != 0 ? 1 : -1);
+        const int precision = precision_dist(rng);
+        test_value(value, boost::charconv::chars_format::fixed, precision);
+        test_value(value, boost::charconv::chars_format::scientific, precision);
+        test_value(value, boost::charconv::chars_format::general, precision);
+    }
+}
+
+// float readings with a few decimals take the binary32 paths, whose edges are the ties, the carries into a new digit and
+// the values where the 64-bit arithmetic stops. The directed modes give the same output as for the double of the value
+void test_float_readings()
+{
+    std::uniform_real_distribution<float> reading_dist(-1000, 1000);
+    std::uniform_real_distribution<double> exponent_dist(-12, 20);
+    std::uniform_int_distribution<int> precision_dist(0, 12);
+    for (int i = 0; i < 100000; ++i)
+    {
+        const float value = i % 2 == 0 ? reading_dist(rng) : static_cast<float>(std::pow(10.0, exponent_dist(rng)));
+        const int precision = precision_dist(rng);
+        test_value(value, boost::charconv::chars_format::fixed, precision);
+        test_value(value, boost::charconv::chars_format::scientific, precision);
+
+        for (const auto mode : {boost::charconv::rounding_mode::toward_zero, boost::charconv::rounding_mode::toward_infinity,
+                                boost::charconv::rounding_mode::toward_neg_infinity})
+        {
+            for (const auto fmt : {boost::charconv::chars_format::fixed, boost::charconv::chars_format::scientific})
+            {
+                char expected[128];
+                char buffer[128];
+                const auto r1 = boost::charconv::to_chars(expected, expected + sizeof(expected), static_cast<double>(value), fmt, precision, mode);
+                const auto r2 = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt, precision, mode);
+                BOOST_TEST(r1 && r2);
+                BOOST_TEST_EQ(std::string(expected, r1.ptr), std::string(buffer, r2.ptr));
+            }
+        }
+    }
+
+    for (const float value : {0.125F, 2.5F, 0.5F, 9.5F, 99.5F, 0.95F, 9.9999F, 1e-5F, 3.0517578125e-5F, 999999.5F, 16777216.0F,
+                              1e10F, 1.8446744e19F, 1e20F, 0.0F, -0.0F})
+    {
+        for (int precision = 0; precision < 20; ++precision)
+        {
+            test_value(value, boost::charconv::chars_format::fixed, precision);
+            test_value(value, boost::charconv::chars_format::scientific, precision);
+        }
+    }
+}
+
+void test_special_values()
+{
+    const boost::charconv::chars_format formats[] = {boost::charconv::chars_format::fixed,
+                                                     boost::charconv::chars_format::scientific,
+                                                     boost::charconv::chars_format::general};
+
+    const double values[] = {0.0, -0.0, 0.5, 1.5, 2.5, -2.5, 0.125, 0.375, 9.5, 99.5, 0.05, 0.95, 9.995, 1e10, 1e22, 1e23,
+                             -478.3177, 1e-4, 9.99995e-5, 123456, 999999.5, 5e-324, 2.2250738585072014e-308,
+                             1.7976931348623157e308, 9007199254740993.0, 0.1, 1.0 / 3};
+
+    for (const auto fmt : formats)
+    {
+        for (const auto value : values)
+        {
+            for (int precision = 0; precision <= 20; ++precision)
+            {
+                test_value(value, fmt, precision);
+            }
+
+            test_value(value, fmt, 50);
+            test_value(value, fmt, 400);
+            test_value(value, fmt, 1100);
+        }
+    }
+
+    char buffer[64];
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 1e10, boost::charconv::chars_format::fixed, 2);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "10000000000.00");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 3.6e-165, boost::charconv::chars_format::scientific, 0);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "4e-165");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 0.5, boost::charconv::chars_format::fixed, 0);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "0");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 9.99995e-5, boost::charconv::chars_format::general, 5);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "9.9999e-05");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), -std::numeric_limits<double>::infinity(), boost::charconv::chars_format::fixed, 3);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "-inf");
+}
+
+// Random 128-bit significands scaled over the whole exponent range including the subnormals.
+// Both formats have a 15-bit exponent, and std::numeric_limits is not specialized for __float128
+template <typename T>
+void test_random_wide(int max_precision, int iterations)
+{
+    std::uniform_int_distribution<int> exponent_dist(-16382 - 113 - 64, 16384 - 128);
+    std::uniform_int_distribution<int> precision_dist(0, max_precision);
+    for (int i = 0; i < iterations; ++i)
+    {
+        const T significand = static_cast<T>(rng()) * static_cast<T>(18446744073709551616.0) + static_cast<T>(rng());
+        const int exponent = exponent_dist(rng);
+        T value = significand;
+        for (int j = 0; j < (exponent < 0 ? -exponent : exponent); ++j)
+        {
+            value = exponent < 0 ? value / 2 : value * 2;
+        }
+
+        const int precision = precision_dist(rng);
+        test_value(value, boost::charconv::chars_format::fixed, precision);
+        test_value(value, boost::charconv::chars_format::scientific, precision);
+        test_value(value, boost::charconv::chars_format::general, precision);
+    }
+}
+
+int main()
+{
+    test_special_values();
+    test_moderate_values();
+    test_float_readings();
+
+    test_random<double>(30, 100000);
+    test_random<float>(30, 100000);
+    test_random<double>(1100, 2000);
+
+    #if BOOST_CHARCONV_LDBL_BITS == 80 || BOOST_CHARCONV_LDBL_BITS == 128
+    test_random_wide<long double>(40, 2000);
+    #endif
+
+    #ifdef BOOST_CHARCONV_HAS_FLOAT128
+    test_random_wide<__float128>(40, 2000);
+    #endif
+
+    return boost::report_errors();
+}
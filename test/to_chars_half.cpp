@@ -0,0 +1,206 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/charconv/detail/to_chars_half.hpp>
+#include <boost/charconv/detail/from_chars_half.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <limits>
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+#  include <stdfloat>
+#endif
+
+using boost::charconv::detail::binary16_bits;
+using boost::charconv::detail::bfloat16_bits;
+using boost::charconv::chars_format;
+
+template <typename T>
+std::string print(T val, chars_format fmt = chars_format::general, int precision = -1)
+{
+    char buffer[64];
+    const auto r = boost::charconv::detail::to_chars_half(buffer, buffer + sizeof(buffer), val, fmt, precision);
+    BOOST_TEST(r);
+    return std::string(buffer, r.ptr);
+}
+
+template <typename T>
+bool round_trips(const std::string& str, T val, chars_format fmt = chars_format::general)
+{
+    T parsed {};
+    const auto r = boost::charconv::detail::from_chars_half(str.data(), str.data() + str.size(), parsed, fmt);
+    return r.ec == std::errc() && r.ptr == str.data() + str.size() && parsed.bits == val.bits;
+}
+
+int significant_digits(const std::string& scientific)
+{
+    int count = 0;
+    for (const char c : scientific.substr(0, scientific.find('e')))
+    {
+        count += (c >= '0' && c <= '9') ? 1 : 0;
+    }
+    return count;
+}
+
+// Every finite value. The scientific output has to round trip, no representation with one digit less may round trip,
+// and it has to be the closest representation with its number of digits whenever that one round trips
+template <typename T>
+void test_all_values()
+{
+    for (std::uint32_t i = 1; i < 0x10000; ++i)
+    {
+        const T val {static_cast<std::uint16_t>(i)};
+        const float f = boost::charconv::detail::half_to_float(val);
+        if (!std::isfinite(f) || f == 0)
+        {
+            continue;
+        }
+
+        const std::string scientific = print(val, chars_format::scientific);
+        if (!BOOST_TEST(round_trips(scientific, val)))
+        {
+            std::cerr << "Value: " << std::hex << i << std::dec << "\nOutput: " << scientific << std::endl; // LCOV_EXCL_LINE
+            continue;                                                                                     // LCOV_EXCL_LINE
+        }
+
+        const int digits = significant_digits(scientific);
+        const double d = static_cast<double>(f);
+        char buffer[64];
+        if (digits > 1)
+        {
+            std::snprintf(buffer, sizeof(buffer), "%.*e", digits - 2, d);
+            const double nearest = std::strtod(buffer, nullptr);
+            const double unit = std::pow(10.0, std::floor(std::log10(std::fabs(nearest))) - (digits - 2));
+            for (const double candidate : {nearest - unit, nearest, nearest + unit})
+            {
+                std::snprintf(buffer, sizeof(buffer), "%.*e", digits - 2, candidate);
+                if (!BOOST_TEST(!round_trips(std::string(buffer), val)))
+                {
+                    std::cerr << "Value: " << std::hex << i << std::dec << "\nOutput: " << scientific << "\nShorter: " << buffer << std::endl; // LCOV_EXCL_LINE
+                }
+            }
+        }
+
+        std::snprintf(buffer, sizeof(buffer), "%.*e", digits - 1, d);
+        if (round_trips(std::string(buffer), val) && !BOOST_TEST_EQ(std::strtod(buffer, nullptr), std::strtod(scientific.c_str(), nullptr)))
+        {
+            std::cerr << "Value: " << std::hex << i << std::dec << "\nOutput: " << scientific << "\nCloser: " << buffer << std::endl; // LCOV_EXCL_LINE
+        }
+
+        // General and fixed switch to plain integers and fractions for values from 1 up to 2^32,
+        // and fixed writes all the others out with zeros
+        const std::string general = print(val, chars_format::general);
+        const std::string fixed = print(val, chars_format::fixed);
+        BOOST_TEST(round_trips(general, val));
+        if (!BOOST_TEST(round_trips(fixed, val, chars_format::fixed)) || !BOOST_TEST(fixed.find('e') == std::string::npos))
+        {
+            std::cerr << "Value: " << std::hex << i << std::dec << "\nFixed: " << fixed << std::endl; // LCOV_EXCL_LINE
+        }
+
+        const double abs_value = std::fabs(d);
+        if (abs_value >= 1 && abs_value < 4294967296.0)
+        {
+            BOOST_TEST_EQ(general, fixed);
+            if (d == std::floor(d))
+            {
+                std::snprintf(buffer, sizeof(buffer), "%.0f", d);
+                BOOST_TEST_EQ(general, std::string(buffer));
+            }
+            else
+            {
+                BOOST_TEST_EQ(std::strtod(general.c_str(), nullptr), std::strtod(scientific.c_str(), nullptr));
+            }
+        }
+        else
+        {
+            BOOST_TEST_EQ(std::strtod(general.c_str(), nullptr), std::strtod(scientific.c_str(), nullptr));
+            BOOST_TEST_EQ(std::strtod(fixed.c_str(), nullptr), std::strtod(scientific.c_str(), nullptr));
+            BOOST_TEST(general.find('.') == std::string::npos || general.find('e') != std::string::npos);
+        }
+    }
+}
+
+void test_special_values()
+{
+    BOOST_TEST_EQ(print(binary16_bits{0x3C00}), "1");
+    BOOST_TEST_EQ(print(binary16_bits{0x3C00}, chars_format::scientific), "1e+00");
+    BOOST_TEST_EQ(print(binary16_bits{0x2E66}), "1e-01");
+    BOOST_TEST_EQ(print(binary16_bits{0x3E00}), "1.5");
+    BOOST_TEST_EQ(print(binary16_bits{0x3C01}), "1.001");
+    BOOST_TEST_EQ(print(binary16_bits{0x7BFF}), "65504");
+    BOOST_TEST_EQ(print(binary16_bits{0x7BFF}, chars_format::scientific), "6.55e+04");
+    BOOST_TEST_EQ(print(binary16_bits{0x0001}), "6e-08");
+    BOOST_TEST_EQ(print(binary16_bits{0x0400}), "6.104e-05");
+    BOOST_TEST_EQ(print(binary16_bits{0xC500}), "-5");
+    BOOST_TEST_EQ(print(binary16_bits{0x8001}), "-6e-08");
+
+    BOOST_TEST_EQ(print(bfloat16_bits{0x3F80}), "1");
+    BOOST_TEST_EQ(print(bfloat16_bits{0x3DCD}), "1e-01");
+    BOOST_TEST_EQ(print(bfloat16_bits{0x7F7F}), "3.39e+38");
+    BOOST_TEST_EQ(print(bfloat16_bits{0x0001}), "9e-41");
+    BOOST_TEST_EQ(print(bfloat16_bits{0x4B18}), "9961472");
+    BOOST_TEST_EQ(print(bfloat16_bits{0x4F80}), "4.3e+09");
+
+    BOOST_TEST_EQ(print(binary16_bits{0x0001}, chars_format::fixed), "0.00000006");
+    BOOST_TEST_EQ(print(binary16_bits{0x8001}, chars_format::fixed), "-0.00000006");
+    BOOST_TEST_EQ(print(binary16_bits{0x2E66}, chars_format::fixed), "0.1");
+    BOOST_TEST_EQ(print(bfloat16_bits{0x0001}, chars_format::fixed), "0." + std::string(40, '0') + "9");
+    BOOST_TEST_EQ(print(bfloat16_bits{0x4F80}, chars_format::fixed), "4300000000");
+    BOOST_TEST_EQ(print(bfloat16_bits{0x60AD}, chars_format::fixed), "100000000000000000000");
+
+    // Everything that is not the shortest representation is the same as for float
+    BOOST_TEST_EQ(print(binary16_bits{0x0000}), "0");
+    BOOST_TEST_EQ(print(binary16_bits{0x8000}), "-0");
+    BOOST_TEST_EQ(print(binary16_bits{0x0000}, chars_format::scientific), "0e+00");
+    BOOST_TEST_EQ(print(binary16_bits{0x7C00}), "inf");
+    BOOST_TEST_EQ(print(binary16_bits{0xFC00}), "-inf");
+    BOOST_TEST_EQ(print(binary16_bits{0x7E00}), "nan");
+    BOOST_TEST_EQ(print(bfloat16_bits{0x7FC0}), "nan");
+    BOOST_TEST_EQ(print(binary16_bits{0x2E66}, chars_format::fixed, 5), "0.09998");
+    BOOST_TEST_EQ(print(binary16_bits{0x2E66}, chars_format::scientific, 3), "9.998e-02");
+    BOOST_TEST_EQ(print(binary16_bits{0x3C01}, chars_format::hex), "1.004p+0");
+
+    char buffer[4];
+    BOOST_TEST(boost::charconv::detail::to_chars_half(buffer, buffer + sizeof(buffer), binary16_bits{0x7BFF}).ec == std::errc::result_out_of_range);
+    BOOST_TEST(boost::charconv::detail::to_chars_half(buffer, buffer + sizeof(buffer), binary16_bits{0x3C01}).ec == std::errc::result_out_of_range);
+    BOOST_TEST(boost::charconv::detail::to_chars_half(buffer, buffer + sizeof(buffer), binary16_bits{0x2E66}).ec == std::errc::result_out_of_range);
+    BOOST_TEST(boost::charconv::detail::to_chars_half(buffer, buffer, binary16_bits{0x3C00}).ec == std::errc::result_out_of_range);
+    BOOST_TEST(boost::charconv::detail::to_chars_half(buffer, buffer + sizeof(buffer), binary16_bits{0x2E66}, chars_format::fixed).ec == std::errc());
+    BOOST_TEST(boost::charconv::detail::to_chars_half(buffer, buffer + sizeof(buffer), binary16_bits{0x0001}, chars_format::fixed).ec == std::errc::result_out_of_range);
+}
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+void test_public_api()
+{
+    char buffer[64];
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 0.1f16);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1e-01");
+
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 0.1bf16);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1e-01");
+}
+#endif
+
+int main()
+{
+    test_special_values();
+
+    test_all_values<binary16_bits>();
+    test_all_values<bfloat16_bits>();
+
+    #ifdef BOOST_CHARCONV_HAS_FLOAT16
+    test_public_api();
+    #endif
+
+    return boost::report_errors();
+}
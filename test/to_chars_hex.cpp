@@ -0,0 +1,198 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <type_traits>
+#include <random>
+#include <string>
+#include <limits>
+#include <iostream>
+#include <cstring>
+#include <cstdio>
+#include <cstdint>
+
+static std::mt19937_64 rng(42);
+
+// The digits of value one at a time from the least significant
+template <typename T>
+std::string reference_to_chars(T value, int base, int min_digits = 0, bool uppercase = false, bool prefix = false)
+{
+    using Unsigned = boost::charconv::detail::make_unsigned_t<T>;
+
+    const bool negative = value < T(0);
+    auto unsigned_value = static_cast<Unsigned>(value);
+    if (negative)
+    {
+        unsigned_value = static_cast<Unsigned>(0U - unsigned_value);
+    }
+
+    const char* const letters = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+    std::string digits;
+    do
+    {
+        digits.insert(digits.begin(), letters[static_cast<std::size_t>(unsigned_value % static_cast<Unsigned>(base))]);
+        unsigned_value = static_cast<Unsigned>(unsigned_value / static_cast<Unsigned>(base));
+    } while (unsigned_value != 0);
+
+    if (digits.size() < static_cast<std::size_t>(min_digits))
+    {
+        digits.insert(0, static_cast<std::size_t>(min_digits) - digits.size(), '0');
+    }
+
+    return std::string(negative ? "-" : "") + (prefix ? (uppercase ? "0X" : "0x") : "") + digits;
+}
+
+template <typename T>
+void test_value(T value)
+{
+    char buffer[256];
+
+    for (const int base : {2, 16})
+    {
+        const std::string expected = reference_to_chars(value, base);
+        auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, base);
+        if (!BOOST_TEST(r) || !BOOST_TEST_EQ(std::string(buffer, r.ptr), expected))
+        {
+            std::cerr << "Base: " << base << std::endl; // LCOV_EXCL_LINE
+        }
+
+        // Exactly enough space, and one character less
+        r = boost::charconv::to_chars(buffer, buffer + expected.size(), value, base);
+        BOOST_TEST(r && r.ptr == buffer + expected.size());
+        r = boost::charconv::to_chars(buffer, buffer + expected.size() - 1, value, base);
+        BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    }
+
+    const int min_digits = static_cast<int>(rng() % 40);
+    const bool uppercase = (rng() & 1U) != 0;
+    const bool prefix = (rng() & 1U) != 0;
+    const std::string expected = reference_to_chars(value, 16, min_digits, uppercase, prefix);
+
+    auto r = boost::charconv::to_chars_hex(buffer, buffer + sizeof(buffer), value, min_digits, uppercase, prefix);
+    if (!BOOST_TEST(r) || !BOOST_TEST_EQ(std::string(buffer, r.ptr), expected))
+    {
+        std::cerr << "Min digits: " << min_digits << ", uppercase: " << uppercase << ", prefix: " << prefix << std::endl; // LCOV_EXCL_LINE
+    }
+
+    r = boost::charconv::to_chars_hex(buffer, buffer + expected.size() - 1, value, min_digits, uppercase, prefix);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(r.ptr == buffer + expected.size() - 1);
+}
+
+template <typename T>
+void test_type()
+{
+    using Unsigned = typename std::make_unsigned<T>::type;
+    constexpr int bits = std::numeric_limits<Unsigned>::digits;
+
+    test_value(T(0));
+    test_value((std::numeric_limits<T>::max)());
+    test_value((std::numeric_limits<T>::min)());
+
+    // Every bit width, and random values of it
+    for (int width = 1; width <= bits; ++width)
+    {
+        test_value(static_cast<T>(static_cast<Unsigned>(UINT64_MAX >> (64 - width))));
+        test_value(static_cast<T>(static_cast<Unsigned>(UINT64_C(1) << (width - 1))));
+
+        for (int i = 0; i < 20; ++i)
+        {
+            const auto value = static_cast<Unsigned>(rng() >> (64 - width));
+            test_value(static_cast<T>(value));
+        }
+    }
+}
+
+void test_printf()
+{
+    char buffer[64];
+    char expected[64];
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        const std::uint64_t value = rng() >> (rng() % 64);
+        const int min_digits = static_cast<int>(rng() % 20);
+        const bool uppercase = (rng() & 1U) != 0;
+
+        std::snprintf(expected, sizeof(expected), uppercase ? "%.*llX" : "%.*llx", min_digits, static_cast<unsigned long long>(value));
+        if (value == 0 && min_digits == 0)
+        {
+            // printf writes no digits for 0 with a precision of 0
+            std::strcpy(expected, "0");
+        }
+
+        const auto r = boost::charconv::to_chars_hex(buffer, buffer + sizeof(buffer), value, min_digits, uppercase);
+        BOOST_TEST(r);
+        BOOST_TEST_EQ(std::string(buffer, r.ptr), std::string(expected));
+    }
+}
+
+void test_spot_values()
+{
+    char buffer[64];
+
+    auto r = boost::charconv::to_chars_hex(buffer, buffer + sizeof(buffer), UINT64_C(0x4bf92f3577b34da6), 16, false, true);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "0x4bf92f3577b34da6");
+
+    r = boost::charconv::to_chars_hex(buffer, buffer + sizeof(buffer), 0xABCU, 8, true, true);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "0X00000ABC");
+
+    r = boost::charconv::to_chars_hex(buffer, buffer + sizeof(buffer), -255, 4, false, true);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "-0x00ff");
+
+    r = boost::charconv::to_chars_hex(buffer, buffer + sizeof(buffer), 0, 0, false, true);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "0x0");
+
+    r = boost::charconv::to_chars_hex(buffer, buffer + sizeof(buffer), 1, -1);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+}
+
+#if !defined(BOOST_CHARCONV_NO_CONSTEXPR_DETECTION) && !defined(BOOST_NO_CXX14_CONSTEXPR)
+constexpr bool constexpr_hex()
+{
+    char buffer[32] {};
+    const auto r = boost::charconv::to_chars_hex(buffer, buffer + sizeof(buffer), 0xBEEFU, 6, true, true);
+    return r.ptr == buffer + 8 && buffer[0] == '0' && buffer[1] == 'X' && buffer[2] == '0' && buffer[4] == 'B' && buffer[7] == 'F';
+}
+
+static_assert(constexpr_hex(), "to_chars_hex at compile time");
+#endif
+
+int main()
+{
+    test_type<char>();
+    test_type<signed char>();
+    test_type<unsigned char>();
+    test_type<short>();
+    test_type<unsigned short>();
+    test_type<int>();
+    test_type<unsigned>();
+    test_type<long>();
+    test_type<unsigned long>();
+    test_type<long long>();
+    test_type<unsigned long long>();
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    {
+        test_value(static_cast<boost::uint128_type>(0));
+        test_value(BOOST_CHARCONV_UINT128_MAX);
+        test_value(BOOST_CHARCONV_INT128_MIN);
+        test_value(BOOST_CHARCONV_INT128_MAX);
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            const auto value = (static_cast<boost::uint128_type>(rng()) << 64 | rng()) >> (rng() % 128);
+            test_value(value);
+            test_value(static_cast<boost::int128_type>(value));
+        }
+    }
+    #endif
+
+    test_printf();
+    test_spot_values();
+
+    return boost::report_errors();
+}
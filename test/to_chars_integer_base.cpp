@@ -0,0 +1,144 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// to_chars<Base>(first, last, value) writes the same digits as to_chars(first, last, value, Base) for every base
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <type_traits>
+#include <random>
+#include <string>
+#include <limits>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+
+static std::mt19937_64 rng(42);
+
+// Digits written one at a time from the least significant one
+template <typename T>
+std::string reference(T value, int base)
+{
+    using Unsigned = boost::charconv::detail::make_unsigned_t<T>;
+    const bool is_negative = value < 0;
+    auto unsigned_value = is_negative ? static_cast<Unsigned>(Unsigned(0) - static_cast<Unsigned>(value)) : static_cast<Unsigned>(value);
+
+    std::string digits;
+    do
+    {
+        digits.insert(digits.begin(), "0123456789abcdefghijklmnopqrstuvwxyz"[unsigned_value % static_cast<Unsigned>(base)]);
+        unsigned_value = static_cast<Unsigned>(unsigned_value / static_cast<Unsigned>(base));
+    } while (unsigned_value != 0);
+
+    return is_negative ? "-" + digits : digits;
+}
+
+template <int Base, typename T>
+void test_value(T value)
+{
+    const auto expected = reference(value, Base);
+
+    char buffer[160];
+    auto r = boost::charconv::to_chars<Base>(buffer, buffer + sizeof(buffer), value);
+    if (!BOOST_TEST(r) || !BOOST_TEST_EQ(std::string(buffer, r.ptr), expected))
+    {
+        std::cerr << "Base: " << Base << "\nExpected: " << expected << std::endl; // LCOV_EXCL_LINE
+    }
+
+    char runtime[160];
+    const auto rr = boost::charconv::to_chars(runtime, runtime + sizeof(runtime), value, Base);
+    BOOST_TEST(rr && std::string(runtime, rr.ptr) == expected);
+
+    // The output has to fit, and nothing is written past last if it does not
+    const auto length = static_cast<std::ptrdiff_t>(expected.size());
+    r = boost::charconv::to_chars<Base>(buffer, buffer + length, value);
+    BOOST_TEST(r && r.ptr == buffer + length);
+
+    std::memset(buffer, '#', sizeof(buffer));
+    r = boost::charconv::to_chars<Base>(buffer, buffer + length - 1, value);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(r.ptr == buffer + length - 1);
+    BOOST_TEST_EQ(buffer[length - 1], '#');
+
+    // Including the sign with the runtime base
+    std::memset(runtime, '#', sizeof(runtime));
+    const auto rs = boost::charconv::to_chars(runtime, runtime + length - 1, value, Base);
+    BOOST_TEST(rs.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(runtime[length - 1], '#');
+}
+
+template <int Base, typename T>
+void test_type()
+{
+    std::uniform_int_distribution<std::uint64_t> shift_dist(0, 63);
+    for (int i = 0; i < 200; ++i)
+    {
+        T value;
+        BOOST_IF_CONSTEXPR (sizeof(T) > sizeof(std::uint64_t))
+        {
+            value = static_cast<T>((static_cast<T>(rng()) << 64) | static_cast<T>(rng()));
+        }
+        else
+        {
+            value = static_cast<T>(rng() >> shift_dist(rng));
+        }
+        test_value<Base>(value);
+    }
+
+    for (const T value : {T(0), T(1), static_cast<T>(Base - 1), static_cast<T>(Base), (std::numeric_limits<T>::max)(), (std::numeric_limits<T>::min)()})
+    {
+        test_value<Base>(value);
+    }
+}
+
+template <int Base>
+struct test_bases
+{
+    static void run()
+    {
+        test_type<Base, char>();
+        test_type<Base, signed char>();
+        test_type<Base, unsigned char>();
+        test_type<Base, short>();
+        test_type<Base, unsigned short>();
+        test_type<Base, int>();
+        test_type<Base, unsigned>();
+        test_type<Base, long>();
+        test_type<Base, unsigned long>();
+        test_type<Base, long long>();
+        test_type<Base, unsigned long long>();
+
+        #ifdef BOOST_CHARCONV_HAS_INT128
+        test_type<Base, boost::int128_type>();
+        test_type<Base, boost::uint128_type>();
+        #endif
+
+        test_bases<Base + 1>::run();
+    }
+};
+
+template <>
+struct test_bases<37>
+{
+    static void run() {}
+};
+
+int main()
+{
+    test_bases<2>::run();
+
+    char buffer[64];
+    auto r = boost::charconv::to_chars<36>(buffer, buffer + sizeof(buffer), UINT64_C(1234567890123));
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "fr5hugnf");
+    r = boost::charconv::to_chars<7>(buffer, buffer + sizeof(buffer), -50);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "-101");
+
+    r = boost::charconv::to_chars<36>(buffer, buffer, 0);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range && r.ptr == buffer);
+    r = boost::charconv::to_chars<36>(buffer + 1, buffer, 0);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+
+    return boost::report_errors();
+}
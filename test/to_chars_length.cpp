@@ -0,0 +1,182 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <vector>
+#include <limits>
+#include <iomanip>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+
+static std::mt19937_64 rng(42);
+
+#if !defined(BOOST_CHARCONV_NO_CONSTEXPR_DETECTION) && defined(BOOST_CXX14_CONSTEXPR)
+static_assert(boost::charconv::to_chars_length(0) == 1, "0");
+static_assert(boost::charconv::to_chars_length(-1) == 2, "-1");
+static_assert(boost::charconv::to_chars_length(UINT64_C(18446744073709551615)) == 20, "UINT64_MAX");
+static_assert(boost::charconv::to_chars_length(255, 16) == 2, "ff");
+static_assert(boost::charconv::to_chars_length(1, 37) == 0, "Invalid base");
+#endif
+
+template <typename T>
+void test_integer_value(T value)
+{
+    char buffer[256];
+    for (int base = 2; base <= 36; ++base)
+    {
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, base);
+        BOOST_TEST(r);
+        if (!BOOST_TEST_EQ(boost::charconv::to_chars_length(value, base), static_cast<std::size_t>(r.ptr - buffer)))
+        {
+            std::cerr << "Value: " << std::string(buffer, r.ptr) << "\nBase: " << base << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+
+    BOOST_TEST_EQ(boost::charconv::to_chars_length(value, 0), 0U);
+    BOOST_TEST_EQ(boost::charconv::to_chars_length(value, 37), 0U);
+}
+
+template <typename T>
+void test_integer()
+{
+    std::uniform_int_distribution<T> dist((std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+    for (int i = 0; i < 1000; ++i)
+    {
+        test_integer_value(dist(rng));
+    }
+
+    // Every power of 10 and its neighbours
+    for (T power = 1; ; power = static_cast<T>(power * 10))
+    {
+        test_integer_value(static_cast<T>(power - 1));
+        test_integer_value(power);
+        BOOST_IF_CONSTEXPR (std::numeric_limits<T>::is_signed)
+        {
+            test_integer_value(static_cast<T>(-power));
+            test_integer_value(static_cast<T>(1 - power));
+        }
+
+        if (power > (std::numeric_limits<T>::max)() / 10)
+        {
+            break;
+        }
+    }
+
+    test_integer_value(T(0));
+    test_integer_value((std::numeric_limits<T>::min)());
+    test_integer_value((std::numeric_limits<T>::max)());
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+void test_int128()
+{
+    for (int i = 0; i < 1000; ++i)
+    {
+        const auto bits = (static_cast<boost::uint128_type>(rng()) << 64) | rng();
+        test_integer_value(bits);
+        test_integer_value(static_cast<boost::int128_type>(bits));
+        test_integer_value(bits >> (rng() % 128));
+    }
+
+    test_integer_value(static_cast<boost::uint128_type>(0));
+    test_integer_value(~static_cast<boost::uint128_type>(0));
+    test_integer_value(static_cast<boost::int128_type>(~static_cast<boost::uint128_type>(0) >> 1));
+    test_integer_value(-static_cast<boost::int128_type>(~static_cast<boost::uint128_type>(0) >> 1) - 1);
+}
+#endif
+
+// The length has to be the number of characters to_chars writes for every format and precision
+template <typename T>
+void test_float_value(T value)
+{
+    static std::vector<char> buffer(4096);
+
+    for (const auto fmt : {chars_format::general, chars_format::scientific, chars_format::fixed, chars_format::hex})
+    {
+        for (const int precision : {-1, 0, 1, 2, 3, 6, 9, 13, 17, 20, 40, 100, 779, 780, 1000, 1074, 1100, 2000})
+        {
+            const auto r = boost::charconv::to_chars(buffer.data(), buffer.data() + buffer.size(), value, fmt, precision);
+            BOOST_TEST(r);
+            if (!BOOST_TEST_EQ(boost::charconv::to_chars_length(value, fmt, precision), static_cast<std::size_t>(r.ptr - buffer.data())))
+            {
+                // LCOV_EXCL_START
+                std::cerr << std::setprecision(std::numeric_limits<T>::max_digits10) << "Value: " << value
+                          << "\nFormat: " << static_cast<int>(fmt) << "\nPrecision: " << precision << std::endl;
+                // LCOV_EXCL_STOP
+            }
+        }
+    }
+}
+
+template <typename T, typename Unsigned_Integer>
+void test_float()
+{
+    // Random bit patterns cover every exponent along with the subnormals, infinities and NaNs
+    std::uniform_int_distribution<Unsigned_Integer> bits_dist(0, (std::numeric_limits<Unsigned_Integer>::max)());
+    for (int i = 0; i < 2000; ++i)
+    {
+        const auto bits = bits_dist(rng);
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+        test_float_value(value);
+    }
+
+    // Values in the fixed and integer ranges of the shortest representation
+    std::uniform_real_distribution<T> value_dist(1, std::is_same<T, float>::value ? static_cast<T>(1e10) : static_cast<T>(1e20));
+    for (int i = 0; i < 2000; ++i)
+    {
+        test_float_value(value_dist(rng));
+        test_float_value(-value_dist(rng));
+    }
+
+    // Values that round up to the next power of 10 and everything next to the limits of the exponent digits
+    for (const T value : {T(0), -T(0), T(1), T(9.5), T(9.96), T(99.5), T(999.9996), T(0.999), T(0.0625), T(1e7), T(1e15), T(1e16),
+                          T(4294967296.0), T(1e23), T(1e38), T(1e-38), T(3.4e38),
+                          std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+                          std::numeric_limits<T>::quiet_NaN(), -std::numeric_limits<T>::quiet_NaN(),
+                          std::numeric_limits<T>::signaling_NaN(), std::numeric_limits<T>::denorm_min(),
+                          (std::numeric_limits<T>::max)(), (std::numeric_limits<T>::min)(), std::numeric_limits<T>::epsilon(),
+                          T(1) - std::numeric_limits<T>::epsilon(), T(18446744073709551616.0), T(9999999999999999999.0)})
+    {
+        test_float_value(value);
+    }
+
+    BOOST_IF_CONSTEXPR (std::is_same<T, double>::value)
+    {
+        for (const double value : {1e99, 9.9999e99, 9.9999999999999999e99, 1e100, 1.05e100, 1e-99, 1.05e-99, 1e-100, 9.99999e-101, 1e-101, 5e-324})
+        {
+            test_float_value(static_cast<T>(value));
+            test_float_value(-static_cast<T>(value));
+        }
+    }
+}
+
+int main()
+{
+    test_integer<char>();
+    test_integer<signed char>();
+    test_integer<unsigned char>();
+    test_integer<short>();
+    test_integer<unsigned short>();
+    test_integer<int>();
+    test_integer<unsigned>();
+    test_integer<long>();
+    test_integer<unsigned long>();
+    test_integer<long long>();
+    test_integer<unsigned long long>();
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    test_int128();
+    #endif
+
+    test_float<float, std::uint32_t>();
+    test_float<double, std::uint64_t>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,192 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <limits>
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 1024;
+
+// Random bit patterns cover every exponent along with the subnormals, infinities and NaNs
+template <typename T>
+T random_value()
+{
+    using bits_type = typename std::conditional<sizeof(T) == sizeof(std::uint64_t), std::uint64_t, std::uint32_t>::type;
+    const auto bits = static_cast<bits_type>(rng());
+    T val;
+    std::memcpy(&val, &bits, sizeof(val));
+    return val;
+}
+
+// The batch must be the same as calling to_chars for each value and joining the results
+template <typename T>
+std::string expected_output(const std::vector<T>& values, char delimiter, boost::charconv::chars_format fmt, int precision)
+{
+    std::string str;
+    char temp[1100];
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        if (i != 0)
+        {
+            str.push_back(delimiter);
+        }
+
+        const auto r = boost::charconv::to_chars(temp, temp + sizeof(temp), values[i], fmt, precision);
+        BOOST_TEST(r);
+        str.append(temp, r.ptr);
+    }
+
+    return str;
+}
+
+template <typename T>
+void test_batch(boost::charconv::chars_format fmt, int precision, char delimiter)
+{
+    std::vector<T> values(N);
+    for (auto& val : values)
+    {
+        val = random_value<T>();
+    }
+
+    const std::string expected = expected_output(values, delimiter, fmt, precision);
+
+    std::vector<char> buffer(N * 1100);
+    auto r = boost::charconv::to_chars_many(buffer.data(), buffer.data() + buffer.size(), values.data(), N, delimiter, fmt, precision);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.count, N);
+    BOOST_TEST_EQ(std::string(buffer.data(), r.ptr), expected);
+
+    // A buffer that ends where the last delimiter goes can not hold every value,
+    // and must keep a prefix of complete values
+    const auto last_delimiter = expected.find_last_of(delimiter);
+    r = boost::charconv::to_chars_many(buffer.data(), buffer.data() + last_delimiter, values.data(), N, delimiter, fmt, precision);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST_LT(r.count, N);
+    BOOST_TEST_EQ(std::string(buffer.data(), r.ptr), expected_output(std::vector<T>(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(r.count)), delimiter, fmt, precision));
+}
+
+template <typename T>
+void test_errors()
+{
+    const T values[] = {T(1.5), T(-2.25), T(100), T(0)};
+    char buffer[128];
+
+    auto r = boost::charconv::to_chars_many(buffer, buffer + sizeof(buffer), values, 4, ',');
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.count, 4U);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1.5,-2.25,100,0");
+
+    // The values that fit are kept
+    r = boost::charconv::to_chars_many(buffer, buffer + 12, values, 4, ',');
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST_LT(r.count, 3U);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), expected_output(std::vector<T>(values, values + r.count), ',', boost::charconv::chars_format::general, -1));
+
+    // No room for the first value
+    r = boost::charconv::to_chars_many(buffer, buffer + 2, values, 4, ',');
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(r.count, 0U);
+    BOOST_TEST(r.ptr == buffer);
+
+    // Nothing to write
+    r = boost::charconv::to_chars_many(buffer, buffer, values, 0, ',');
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.count, 0U);
+    BOOST_TEST(r.ptr == buffer);
+
+    r = boost::charconv::to_chars_many(buffer, buffer + sizeof(buffer), values, 2, '\t', boost::charconv::chars_format::scientific);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1.5e+00\t-2.25e+00");
+
+    r = boost::charconv::to_chars_many(buffer, buffer + sizeof(buffer), values, 2, ' ', boost::charconv::chars_format::fixed, 2);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1.50 -2.25");
+}
+
+// Shortest fixed output of integral values appends the trailing zeros of the exponent
+void test_trailing_zeros()
+{
+    const double values[] = {10, 1000, 120, 9007199254740990, 1e15, 5e7};
+    char buffer[128];
+    const auto r = boost::charconv::to_chars_many(buffer, buffer + sizeof(buffer), values, 6, ',');
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "10,1000,120,9007199254740990,1000000000000000,50000000");
+}
+
+#if defined(BOOST_CHARCONV_HAS_FLOAT16) || defined(BOOST_CHARCONV_HAS_BRAINFLOAT16)
+
+// Every bit pattern, including the signaling NaNs that a widening instruction would quiet. The blocks mix finite
+// values with infinities and NaNs at every offset, and the count is not a multiple of a block
+template <typename T>
+void test_half_batch(boost::charconv::chars_format fmt, int precision, char delimiter)
+{
+    std::vector<T> values(65536 + 5);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        const auto bits = static_cast<std::uint16_t>(i * 40503U);
+        std::memcpy(&values[i], &bits, sizeof(bits));
+    }
+
+    const std::string expected = expected_output(values, delimiter, fmt, precision);
+
+    std::vector<char> buffer(expected.size() + 64);
+    auto r = boost::charconv::to_chars_many(buffer.data(), buffer.data() + buffer.size(), values.data(), values.size(), delimiter, fmt, precision);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.count, values.size());
+    BOOST_TEST(std::string(buffer.data(), r.ptr) == expected);
+
+    const auto last_delimiter = expected.find_last_of(delimiter);
+    r = boost::charconv::to_chars_many(buffer.data(), buffer.data() + last_delimiter, values.data(), values.size(), delimiter, fmt, precision);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST_LT(r.count, values.size());
+    BOOST_TEST(std::string(buffer.data(), r.ptr) == expected_output(std::vector<T>(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(r.count)), delimiter, fmt, precision));
+}
+
+template <typename T>
+void test_half_formats()
+{
+    test_half_batch<T>(boost::charconv::chars_format::general, -1, ',');
+    test_half_batch<T>(boost::charconv::chars_format::scientific, -1, '\n');
+    test_half_batch<T>(boost::charconv::chars_format::fixed, -1, ';');
+    test_half_batch<T>(boost::charconv::chars_format::hex, -1, ',');
+    test_half_batch<T>(boost::charconv::chars_format::general, 3, ' ');
+    test_half_batch<T>(boost::charconv::chars_format::scientific, 5, ',');
+    test_half_batch<T>(boost::charconv::chars_format::fixed, 2, ',');
+    test_half_batch<T>(boost::charconv::chars_format::hex, 1, ',');
+}
+
+#endif
+
+int main()
+{
+    test_batch<float>(boost::charconv::chars_format::general, -1, ',');
+    test_batch<double>(boost::charconv::chars_format::general, -1, ',');
+    test_batch<double>(boost::charconv::chars_format::scientific, -1, '\n');
+    test_batch<double>(boost::charconv::chars_format::fixed, -1, ';');
+    test_batch<float>(boost::charconv::chars_format::hex, -1, ',');
+    test_batch<double>(boost::charconv::chars_format::scientific, 17, ' ');
+    test_batch<double>(boost::charconv::chars_format::fixed, 6, ';');
+    test_batch<float>(boost::charconv::chars_format::general, 6, ',');
+
+    test_errors<float>();
+    test_errors<double>();
+
+    test_trailing_zeros();
+
+    #ifdef BOOST_CHARCONV_HAS_FLOAT16
+    test_half_formats<std::float16_t>();
+    #endif
+
+    #ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+    test_half_formats<std::bfloat16_t>();
+    #endif
+
+    return boost::report_errors();
+}
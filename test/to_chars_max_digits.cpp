@@ -0,0 +1,144 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <limits>
+#include <iomanip>
+#include <iostream>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+
+static std::mt19937_64 rng(42);
+
+// Number of digits of the shortest representation, which scientific notation prints all of
+template <typename T>
+int shortest_digits(T value)
+{
+    char buffer[64];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, chars_format::scientific);
+    int digits = 0;
+    for (const char* ptr = buffer; ptr != r.ptr && *ptr != 'e'; ++ptr)
+    {
+        digits += static_cast<int>(*ptr >= '0' && *ptr <= '9');
+    }
+    return digits;
+}
+
+// The shortest representation when it fits, and the one with the precision otherwise
+template <typename T>
+void test_value(T value)
+{
+    const int digits = shortest_digits(value);
+    for (const auto fmt : {chars_format::general, chars_format::scientific})
+    {
+        for (int max_digits = 1; max_digits <= 19; ++max_digits)
+        {
+            char expected[128];
+            const auto er = digits <= max_digits || !std::isfinite(value) || value == 0 ?
+                            boost::charconv::to_chars(expected, expected + sizeof(expected), value, fmt) :
+                            boost::charconv::to_chars(expected, expected + sizeof(expected), value, fmt, fmt == chars_format::general ? max_digits : max_digits - 1);
+            BOOST_TEST(er);
+
+            char buffer[128];
+            const auto r = boost::charconv::to_chars_max_digits(buffer, buffer + sizeof(buffer), value, max_digits, fmt);
+            BOOST_TEST(r);
+            if (!BOOST_TEST_EQ(std::string(buffer, r.ptr), std::string(expected, er.ptr)))
+            {
+                // LCOV_EXCL_START
+                std::cerr << std::setprecision(std::numeric_limits<T>::max_digits10) << "Value: " << value
+                          << "\nMax digits: " << max_digits << "\nFormat: " << static_cast<int>(fmt) << std::endl;
+                // LCOV_EXCL_STOP
+            }
+
+            // Every buffer shorter than the digits is too small
+            if (std::isfinite(value) && value != 0)
+            {
+                const auto length = r.ptr - buffer;
+                const auto small = boost::charconv::to_chars_max_digits(buffer, buffer + length - 1, value, max_digits, fmt);
+                BOOST_TEST(small.ec == std::errc::result_out_of_range);
+            }
+        }
+    }
+}
+
+template <typename T, typename Bits>
+void test_random_bits()
+{
+    for (int i = 0; i < 20000; ++i)
+    {
+        const auto bits = static_cast<Bits>(rng());
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+        test_value(value);
+    }
+}
+
+// Short decimals that end in 5, which are midpoints of the shorter ones. Their binary values are almost never exactly
+// the midpoint, so which way they round depends on the digits that the shortest representation leaves out
+template <typename T>
+void test_ties()
+{
+    std::uniform_int_distribution<int> exponent_dist(std::numeric_limits<T>::min_exponent10, std::numeric_limits<T>::max_exponent10 - 1);
+    for (int i = 0; i < 20000; ++i)
+    {
+        std::string str = std::to_string(rng() % 100000000U) + "5e" + std::to_string(exponent_dist(rng) - 8);
+        T value;
+        const auto r = boost::charconv::from_chars(str.data(), str.data() + str.size(), value);
+        if (r)
+        {
+            test_value(value);
+        }
+    }
+
+    // Exact binary midpoints round to even
+    for (const T value : {T(0.125), T(-0.375), T(2.5), T(1.5), T(0.5), T(1048576.5), T(9.5)})
+    {
+        test_value(value);
+    }
+}
+
+template <typename T>
+void test_spot()
+{
+    for (const T value : {T(1), T(-1), T(0), -T(0), T(9.999999), T(99.5), T(0.0001), T(0.00001), T(123456),
+                          (std::numeric_limits<T>::max)(), (std::numeric_limits<T>::min)(), std::numeric_limits<T>::denorm_min(),
+                          std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::quiet_NaN(), T(1e16), T(123456789012345678.0)})
+    {
+        test_value(value);
+    }
+
+    char buffer[64];
+    BOOST_TEST(boost::charconv::to_chars_max_digits(buffer, buffer + sizeof(buffer), T(1), 0).ec == std::errc::invalid_argument);
+    BOOST_TEST(boost::charconv::to_chars_max_digits(buffer, buffer + sizeof(buffer), T(1), 6, chars_format::fixed).ec == std::errc::invalid_argument);
+    BOOST_TEST(boost::charconv::to_chars_max_digits(buffer, buffer + sizeof(buffer), T(1), 6, chars_format::hex).ec == std::errc::invalid_argument);
+    BOOST_TEST(boost::charconv::to_chars_max_digits(buffer, buffer, T(1), 6).ec == std::errc::result_out_of_range);
+}
+
+int main()
+{
+    test_random_bits<double, std::uint64_t>();
+    test_random_bits<float, std::uint32_t>();
+    test_ties<double>();
+    test_ties<float>();
+    test_spot<double>();
+    test_spot<float>();
+
+    char buffer[64];
+    auto r = boost::charconv::to_chars_max_digits(buffer, buffer + sizeof(buffer), 0.1, 6);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1e-01");
+    r = boost::charconv::to_chars_max_digits(buffer, buffer + sizeof(buffer), 1.0 / 3, 6);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "0.333333");
+    r = boost::charconv::to_chars_max_digits(buffer, buffer + sizeof(buffer), 2.675, 3);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "2.67");
+    r = boost::charconv::to_chars_max_digits(buffer, buffer + sizeof(buffer), 1e-7 / 3, 4, chars_format::scientific);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "3.333e-08");
+
+    return boost::report_errors();
+}
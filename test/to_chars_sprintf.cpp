@@ -137,7 +137,8 @@ template<class T> void test_sprintf( T value )
 
 template<class T> void test_sprintf_float( T value, boost::charconv::chars_format fmt )
 {
-    char buffer[ 256 ];
+    // Shortest fixed output has up to 326 characters for the subnormals
+    char buffer[ 512 ];
 
         
     boost::charconv::to_chars_result r;
@@ -302,6 +303,9 @@ template<> void test_sprintf_float( long double value, boost::charconv::chars_fo
             case boost::charconv::chars_format::hex:
                 error_format = "Hex";
                 break;
+            case boost::charconv::chars_format::engineering:
+                error_format = "Engineering";
+                break;
         }
 
         std::cerr << "Failure: " << static_cast<int>(r.ec)
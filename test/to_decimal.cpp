@@ -0,0 +1,179 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <limits>
+#include <iomanip>
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+
+static std::mt19937_64 rng(42);
+
+// The significand and exponent are the digits that to_chars prints in scientific notation, and convert back to the value
+template <typename T>
+void test_value(T value)
+{
+    const auto decimal = boost::charconv::to_decimal(value);
+    BOOST_TEST(decimal);
+    BOOST_TEST_EQ(decimal.is_negative, static_cast<bool>(std::signbit(value)));
+    BOOST_TEST(decimal.significand % 10U != 0 || decimal.significand == 0);
+
+    char buffer[64];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, boost::charconv::chars_format::scientific);
+    std::string expected;
+    const char* ptr = buffer + static_cast<int>(*buffer == '-');
+    for (; *ptr != 'e'; ++ptr)
+    {
+        if (*ptr != '.')
+        {
+            expected += *ptr;
+        }
+    }
+    const int scientific_exponent = std::atoi(std::string(ptr + 1, static_cast<const char*>(r.ptr)).c_str());
+    const auto digits = std::to_string(decimal.significand);
+    BOOST_TEST_EQ(digits, expected);
+    BOOST_TEST_EQ(decimal.exponent + static_cast<int>(digits.size()) - 1, decimal.significand == 0 ? 0 : scientific_exponent);
+
+    T converted {};
+    BOOST_TEST(boost::charconv::from_decimal(decimal.significand, decimal.exponent, decimal.is_negative, converted) == std::errc());
+    if (!BOOST_TEST_EQ(converted, value) || !BOOST_TEST_EQ(std::signbit(converted), std::signbit(value)))
+    {
+        // LCOV_EXCL_START
+        std::cerr << std::setprecision(std::numeric_limits<T>::max_digits10) << "Value: " << value << std::endl;
+        // LCOV_EXCL_STOP
+    }
+}
+
+template <typename T, typename Bits>
+void test_random_bits()
+{
+    for (int i = 0; i < 100000; ++i)
+    {
+        const auto bits = static_cast<Bits>(rng());
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (std::isfinite(value))
+        {
+            test_value(value);
+        }
+    }
+}
+
+// from_decimal gives the same value and error as from_chars for the digits, including significands of 20 digits,
+// and ones close to the midpoints between two values where fast_float needs to compare the digits
+template <typename T>
+void test_from_chars(std::uint64_t significand, std::int32_t exponent, bool is_negative)
+{
+    std::string str = std::to_string(significand);
+    if (is_negative)
+    {
+        str.insert(0, 1, '-');
+    }
+    str += 'e';
+    str += std::to_string(exponent);
+    T expected = T(42);
+    const auto er = boost::charconv::from_chars(str.data(), str.data() + str.size(), expected);
+
+    T value = T(42);
+    const auto ec = boost::charconv::from_decimal(significand, exponent, is_negative, value);
+    BOOST_TEST(ec == er.ec);
+    if (!BOOST_TEST_EQ(value, expected))
+    {
+        // LCOV_EXCL_START
+        std::cerr << "Input: " << str << std::endl;
+        // LCOV_EXCL_STOP
+    }
+}
+
+template <typename T>
+void test_random_decimals()
+{
+    std::uniform_int_distribution<std::int32_t> exponent_dist(std::numeric_limits<T>::min_exponent10 - 40, std::numeric_limits<T>::max_exponent10 + 5);
+    for (int i = 0; i < 100000; ++i)
+    {
+        const auto significand = rng() >> (rng() % 64);
+        test_from_chars<T>(significand, exponent_dist(rng), rng() % 2 == 0);
+    }
+
+    // Midpoints between two values: the shortest digits of a value with a 5 appended, and one more digit on either side
+    for (int i = 0; i < 20000; ++i)
+    {
+        const auto bits = rng();
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (!std::isfinite(value) || value == 0)
+        {
+            continue;
+        }
+
+        const auto decimal = boost::charconv::to_decimal(std::nextafter(value, std::numeric_limits<T>::infinity()));
+        if (decimal.significand < UINT64_C(100000000000000000))
+        {
+            for (const std::uint64_t last_digit : {4U, 5U, 6U})
+            {
+                test_from_chars<T>(decimal.significand * 10U + last_digit, decimal.exponent - 1, decimal.is_negative);
+            }
+        }
+    }
+}
+
+template <typename T>
+void test_spot()
+{
+    for (const T value : {T(1), T(-1), T(0.1), T(123456), (std::numeric_limits<T>::max)(), (std::numeric_limits<T>::min)(),
+                          std::numeric_limits<T>::denorm_min(), -std::numeric_limits<T>::denorm_min(), T(0), -T(0)})
+    {
+        test_value(value);
+    }
+
+    // Zero is always 0e0 with its sign
+    auto decimal = boost::charconv::to_decimal(-T(0));
+    BOOST_TEST(decimal.significand == 0 && decimal.exponent == 0 && decimal.is_negative);
+
+    decimal = boost::charconv::to_decimal(std::numeric_limits<T>::infinity());
+    BOOST_TEST(decimal.ec == std::errc::invalid_argument);
+    decimal = boost::charconv::to_decimal(-std::numeric_limits<T>::quiet_NaN());
+    BOOST_TEST(decimal.ec == std::errc::invalid_argument);
+
+    // Out of range values leave the value unmodified
+    T value = T(42);
+    BOOST_TEST(boost::charconv::from_decimal(1, 400, false, value) == std::errc::result_out_of_range);
+    BOOST_TEST(boost::charconv::from_decimal(1, -400, true, value) == std::errc::result_out_of_range);
+    BOOST_TEST(boost::charconv::from_decimal(UINT64_MAX, (std::numeric_limits<std::int32_t>::max)(), false, value) == std::errc::result_out_of_range);
+    BOOST_TEST(boost::charconv::from_decimal(UINT64_MAX, (std::numeric_limits<std::int32_t>::min)(), false, value) == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(value, T(42));
+
+    // Zero with any exponent
+    BOOST_TEST(boost::charconv::from_decimal(0, 1000, true, value) == std::errc());
+    BOOST_TEST(value == 0 && std::signbit(value));
+
+    test_from_chars<T>(UINT64_MAX, 0, false);
+    test_from_chars<T>(UINT64_C(10000000000000000000), -19, true);
+    test_from_chars<T>(UINT64_C(18446744073709551615), -350, false);
+}
+
+int main()
+{
+    test_random_bits<double, std::uint64_t>();
+    test_random_bits<float, std::uint32_t>();
+    test_random_decimals<double>();
+    test_random_decimals<float>();
+    test_spot<double>();
+    test_spot<float>();
+
+    const auto decimal = boost::charconv::to_decimal(0.3);
+    BOOST_TEST(decimal.significand == 3 && decimal.exponent == -1 && !decimal.is_negative);
+
+    double value {};
+    BOOST_TEST(boost::charconv::from_decimal(25, -2, true, value) == std::errc());
+    BOOST_TEST_EQ(value, -0.25);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,188 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// validate_numbers accepts a buffer exactly when every field of it parses with from_chars, without converting them
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+
+static std::mt19937_64 rng(42);
+
+// The result from parsing every field with from_chars. Fields out of the range of double still have valid syntax
+boost::charconv::from_chars_many_result expected_result(const std::string& str, char delimiter, chars_format fmt)
+{
+    const char* first = str.data();
+    const char* const last = str.data() + str.size();
+    boost::charconv::from_chars_many_result result {first, std::errc(), 0};
+    while (first != last)
+    {
+        const char* field_end = std::find(first, last, delimiter);
+        double value {};
+        const auto r = boost::charconv::from_chars(first, field_end, value, fmt);
+        if (r.ec == std::errc::invalid_argument || r.ptr != field_end)
+        {
+            result.ptr = first;
+            result.ec = std::errc::invalid_argument;
+            return result;
+        }
+
+        ++result.count;
+        first = field_end == last ? last : field_end + 1;
+    }
+
+    result.ptr = last;
+    return result;
+}
+
+void test_buffer(const std::string& str, char delimiter, chars_format fmt)
+{
+    const auto expected = expected_result(str, delimiter, fmt);
+    const auto r = boost::charconv::validate_numbers(str.data(), str.data() + str.size(), delimiter, fmt);
+    if (!BOOST_TEST(r == expected))
+    {
+        // LCOV_EXCL_START
+        std::cerr << "Input: " << str << "\nFormat: " << static_cast<int>(fmt)
+                  << "\nOffset: " << r.ptr - str.data() << " (expected " << expected.ptr - str.data() << ")"
+                  << "\nCount: " << r.count << " (expected " << expected.count << ")" << std::endl;
+        // LCOV_EXCL_STOP
+    }
+
+    BOOST_TEST(boost::charconv::validate_numbers(boost::core::string_view(str), delimiter, fmt) == r);
+
+    // A valid buffer of numbers in range is one that from_chars_many parses completely
+    if (r)
+    {
+        std::vector<double> values(r.count + 1);
+        const auto many = boost::charconv::from_chars_many(str.data(), str.data() + str.size(), values.data(), values.size(), delimiter, fmt);
+        BOOST_TEST(many.ec == std::errc::result_out_of_range || (many && many.count == r.count && many.ptr == r.ptr));
+    }
+}
+
+// Fields made of pieces of numbers, some of which do not go together
+std::string random_field()
+{
+    static const char* const pieces[] = {"0", "1", "7", "12345678", "1234567890123456789", "0000000000000000000000000000000000001",
+                                         "-", "+", ".", "e", "E", "e-", "e+", "p", "p-", "x", "0x", "inf", "INFINITY", "nan",
+                                         "nan(abc_1)", "nan(", "in", "a", "F", " ", "e999", "e-999", "\xff"};
+    std::string field;
+    const auto count = rng() % 5;
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        field += pieces[rng() % (sizeof(pieces) / sizeof(pieces[0]))];
+    }
+    return field;
+}
+
+void test_random()
+{
+    for (const chars_format fmt : {chars_format::general, chars_format::fixed, chars_format::scientific, chars_format::hex, chars_format::engineering})
+    {
+        for (int i = 0; i < 20000; ++i)
+        {
+            const char delimiter = ",; \n"[rng() % 4];
+            std::string str;
+            const auto fields = rng() % 6;
+            for (std::uint64_t j = 0; j < fields; ++j)
+            {
+                if (j != 0)
+                {
+                    str += delimiter;
+                }
+                str += random_field();
+            }
+            test_buffer(str, delimiter, fmt);
+        }
+    }
+}
+
+// Long buffers of mostly simple fields go through the checks of 64 characters at a time, with fields across blocks
+void test_long_buffers()
+{
+    static const char* const fields[] = {"1", "-2", "3.25", "-0.5", ".5", "5.", "12345678901234567890123", "1e5", "-inf", "nan",
+                                         "-", ".", "1.2.3", "1-2", "--1", "", "x", "1e", "0000000000000000000000000000000000000000000000000000000000000000000001.5"};
+    for (const chars_format fmt : {chars_format::general, chars_format::fixed, chars_format::scientific})
+    {
+        for (int i = 0; i < 5000; ++i)
+        {
+            const char delimiter = ",; \n"[rng() % 4];
+            std::string str;
+            const auto count = rng() % 100;
+            for (std::uint64_t j = 0; j < count; ++j)
+            {
+                if (j != 0)
+                {
+                    str += delimiter;
+                }
+
+                // Mostly valid fields, so that the invalid one is anywhere in the buffer
+                str += fields[rng() % 32 < 30 ? rng() % 8 : rng() % (sizeof(fields) / sizeof(fields[0]))];
+            }
+            test_buffer(str, delimiter, fmt);
+        }
+    }
+}
+
+// Valid buffers of the output of to_chars, with an invalid field at a random position
+void test_to_chars_output()
+{
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+    for (int i = 0; i < 2000; ++i)
+    {
+        std::string str;
+        const int fields = 1 + static_cast<int>(rng() % 50);
+        for (int j = 0; j < fields; ++j)
+        {
+            char buffer[64];
+            const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), dist(rng));
+            if (j != 0)
+            {
+                str += ',';
+            }
+            str.append(buffer, r.ptr);
+        }
+
+        auto r = boost::charconv::validate_numbers(str, ',');
+        BOOST_TEST(r && r.count == static_cast<std::size_t>(fields) && r.ptr == str.data() + str.size());
+
+        const auto bad = rng() % str.size();
+        str[bad] = 'x';
+        test_buffer(str, ',', chars_format::general);
+    }
+}
+
+int main()
+{
+    test_random();
+    test_long_buffers();
+    test_to_chars_output();
+
+    const std::string str = "1.5,-2e10,inf,3.25,1e999,abc,7";
+    const auto r = boost::charconv::validate_numbers(str, ',');
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(r.ptr - str.data(), 25);
+    BOOST_TEST_EQ(r.count, 5U);
+
+    // A field must be followed by the delimiter or the end, and only the last field can be empty
+    BOOST_TEST(boost::charconv::validate_numbers(boost::core::string_view("1,2,"), ',').count == 2U);
+    BOOST_TEST(boost::charconv::validate_numbers(boost::core::string_view("1,,2"), ',').ec == std::errc::invalid_argument);
+    BOOST_TEST(boost::charconv::validate_numbers(boost::core::string_view("1.5x"), ',').ec == std::errc::invalid_argument);
+    BOOST_TEST(boost::charconv::validate_numbers(boost::core::string_view(""), ','));
+
+    // The format applies as in from_chars
+    BOOST_TEST(!boost::charconv::validate_numbers(boost::core::string_view("1e5"), ',', chars_format::fixed));
+    BOOST_TEST(!boost::charconv::validate_numbers(boost::core::string_view("15"), ',', chars_format::scientific));
+    BOOST_TEST(boost::charconv::validate_numbers(boost::core::string_view("1.8p3"), ',', chars_format::hex));
+
+    return boost::report_errors();
+}